@@ -5,13 +5,20 @@
 
 #include <string.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
 #include "./protocol.h"
 #include "./ad_block_client.h"
 #include "./bad_fingerprint.h"
 #include "./bad_fingerprints.h"
 #include "./cosmetic_filter.h"
+#include "./fingerprint_postings.h"
 #include "./hashFn.h"
-#include "./no_fingerprint_domain.h"
+#include "./match_cache.h"
+#include "./match_request.h"
+#include "./page_context.h"
+#include "./regex_literals.h"
+#include "./url_lexer.h"
 
 #include "BloomFilter.h"
 
@@ -23,81 +30,57 @@ using std::endl;
 
 std::set<std::string> unknownOptions;
 
-// Fast hash function applicable to 2 byte char checks
-class HashFn2Byte : public HashFn {
- public:
-  HashFn2Byte() : HashFn(0, false) {
-  }
-
-  uint64_t operator()(const char *input, int len,
-      unsigned char lastCharCode, uint64_t lastHash) override;
-
-  uint64_t operator()(const char *input, int len) override;
-};
-
 const int kMaxLineLength = 2048;
 
 const int AdBlockClient::kFingerprintSize = 6;
 
-static HashFn2Byte hashFn2Byte;
+// Matching stats are informational only so there's no need to order them
+// with respect to anything else, which keeps shared clients cheap to update.
+static inline void incrementStat(std::atomic<unsigned int> *stat) {
+  stat->fetch_add(1, std::memory_order_relaxed);
+}
 
-/**
- * Finds the host within the passed in URL and returns its length
- */
-const char * getUrlHost(const char *input, int *len) {
-  const char *p = input;
-  while (*p != '\0' && *p != ':') {
-    p++;
+// Adds the id of a no fingerprint domain only or anti domain only filter to
+// the postings of each domain it lists, without the '~' of anti domains.
+void addFilterDomains(const Filter *filter,
+    HashSet<FingerprintPostings> *postings,
+    HostSuffixTrie *hostSuffixTrie, uint8_t hostSuffixTrieFlag,
+    int filterId) {
+  if (!filter->domainList) {
+    return;
   }
-  if (*p != '\0') {
-    p++;
-    while (*p != '\0' && *p == '/') {
-      p++;
+  const char *domain = filter->domainList;
+  while (true) {
+    const char *end = domain;
+    while (*end != '|' && *end != '\0') {
+      end++;
     }
-  }
-  const char *q = p;
-  while (*q != '\0') {
-    q++;
-  }
-  *len = findFirstSeparatorChar(p, q);
-  return p;
-}
-
-void AddFilterDomainsToHashSet(Filter* filter,
-    HashSet<NoFingerprintDomain> *hashSet) {
-  if (filter->domainList) {
-    char * filter_domain_list = filter->domainList;
-    int start_offset = 0;
-    int len = 0;
-    const char *p = filter_domain_list;
-    while (true) {
-      if (*p == '|' || *p == '\0') {
-        const char *domain = filter_domain_list + start_offset;
-        if (len > 0 && *domain != '~') {
-          char buffer[1024];
-          memset(buffer, 0, 1024);
-          memcpy(buffer, domain, len);
-          // cout << "Adding filter: " << buffer << endl;
-          hashSet->Add(NoFingerprintDomain(domain, len));
-        } else if (len > 0 && *domain == '~') {
-          char buffer[1024];
-          memset(buffer, 0, 1024);
-          memcpy(buffer, domain + 1, len - 1);
-          // cout << "Adding anti filter: " << buffer << endl;
-          hashSet->Add(NoFingerprintDomain(domain + 1, len - 1));
-        }
-        start_offset += len + 1;
-        len = -1;
-      }
-      if (*p == '\0') {
-        break;
+    const char *start = *domain == '~' ? domain + 1 : domain;
+    if (end > start) {
+      const int len = static_cast<int>(end - start);
+      postings->Add(FingerprintPostings(start, len, filterId));
+      if (hostSuffixTrie) {
+        hostSuffixTrie->add(start, len, hostSuffixTrieFlag);
       }
-      p++;
-      len++;
     }
+    if (*end == '\0') {
+      break;
+    }
+    domain = end + 1;
   }
 }
 
+// Adds the id of a host anchored filter to the postings of its host
+void addHostAnchoredFilter(const Filter *filter,
+    HashSet<FingerprintPostings> *postings,
+    HostSuffixTrie *hostSuffixTrie, uint8_t hostSuffixTrieFlag,
+    int filterId) {
+  const int hostLen = filter->hostLen == -1 ?
+    static_cast<int>(strlen(filter->host)) : filter->hostLen;
+  postings->Add(FingerprintPostings(filter->host, hostLen, filterId));
+  hostSuffixTrie->add(filter->host, hostLen, hostSuffixTrieFlag);
+}
+
 inline bool isFingerprintChar(char c) {
   return c != '|' && c != '*' && c != '^';
 }
@@ -173,19 +156,53 @@ bool AdBlockClient::getFingerprint(char *buffer, const char *input) {
   return false;
 }
 
-bool AdBlockClient::getFingerprint(char *buffer, const Filter &f) {
-  if (f.filterType & FTRegex) {
-    // cout << "Get fingerprint for regex returning false; " << endl;
+// Regular expressions get the fingerprint of the longest run of plain
+// characters which every URL they match contains.  They are matched ignoring
+// case so the runs are lowercased like the URL before one is picked, which
+// also keeps them from getting bad fingerprints in another case.
+static bool getRegexFingerprint(char *buffer, const Filter &f) {
+  std::vector<std::string> literals;
+  if (!f.data || !findRegexLiterals(f.data, f.dataLen == -1 ?
+        static_cast<int>(strlen(f.data)) : f.dataLen, &literals)) {
     return false;
   }
-
-  if (f.filterType & FTHostAnchored) {
-    if (AdBlockClient::getFingerprint(buffer, f.data + strlen(f.host))) {
+  std::stable_sort(literals.begin(), literals.end(),
+      [](const std::string &a, const std::string &b) {
+      return a.size() > b.size();
+    });
+  for (std::string &literal : literals) {
+    lowercaseAscii(&literal[0], static_cast<int>(literal.size()),
+        &literal[0]);
+    if (AdBlockClient::getFingerprint(buffer, literal.c_str())) {
       return true;
     }
   }
+  return false;
+}
+
+bool AdBlockClient::getFingerprint(char *buffer, const Filter &f) {
+  if (f.filterType & FTRegex) {
+    return getRegexFingerprint(buffer, f);
+  }
 
-  bool b = AdBlockClient::getFingerprint(buffer, f.data);
+  // Fingerprints are looked up in the lowercased URL, so match-case data is
+  // lowercased before one is picked and checked against the bad ones.
+  const char *data = f.data;
+  char *lowercased = nullptr;
+  if (data && (f.filterOption & FOMatchCase)) {
+    const int len = static_cast<int>(strlen(data));
+    lowercased = new char[len + 1];
+    lowercaseAscii(data, len + 1, lowercased);
+    data = lowercased;
+  }
+  bool b = (f.filterType & FTHostAnchored) &&
+    AdBlockClient::getFingerprint(buffer, data + strlen(f.host));
+  if (!b) {
+    b = AdBlockClient::getFingerprint(buffer, data);
+  }
+  if (lowercased) {
+    delete[] lowercased;
+  }
   // if (!b && f.data) {
   //   cout << "No fingerprint for: " << f.data << endl;
   // }
@@ -209,16 +226,35 @@ int findFirstSeparatorChar(const char *input, const char *end) {
   return static_cast<int>(end - input);
 }
 
+// Filters anchored to the start or the end of the URL don't check the host
+// so they can't be looked up by it.  A host without a dot could be a TLD,
+// which is never looked up on its own, so those are left to the fingerprint
+// lists too unless the rule is only the host.  Rules with a path which only
+// apply on some domains and have no fingerprint stay in the no fingerprint
+// domain lists, which are skipped for requests without a context domain.
+bool isHostIndexedFilter(Filter *f) {
+  if (!(f->filterType & FTHostAnchored) || !f->host ||
+      (f->filterType & (FTRegex | FTLeftAnchored | FTRightAnchored))) {
+    return false;
+  }
+  if (f->filterType & FTHostOnly) {
+    return true;
+  }
+  if (!strchr(f->host, '.')) {
+    return false;
+  }
+  return !f->domainList || !f->isDomainOnlyFilter() ||
+    AdBlockClient::getFingerprint(nullptr, *f);
+}
+
 void parseFilter(const char *input, Filter *f, BloomFilter *bloomFilter,
     BloomFilter *exceptionBloomFilter,
-    HashSet<Filter> *hostAnchoredHashSet,
-    HashSet<Filter> *hostAnchoredExceptionHashSet,
     HashSet<CosmeticFilter> *simpleCosmeticFilters,
-    bool preserveRules) {
+    bool preserveRules, bool compile) {
   const char *end = input;
   while (*end != '\0') end++;
   parseFilter(input, end, f, bloomFilter, exceptionBloomFilter,
-      hostAnchoredHashSet, hostAnchoredExceptionHashSet, simpleCosmeticFilters);
+      simpleCosmeticFilters, preserveRules, compile);
 }
 
 enum FilterParseState {
@@ -235,10 +271,8 @@ enum FilterParseState {
 void parseFilter(const char *input, const char *end, Filter *f,
     BloomFilter *bloomFilter,
     BloomFilter *exceptionBloomFilter,
-    HashSet<Filter> *hostAnchoredHashSet,
-    HashSet<Filter> *hostAnchoredExceptionHashSet,
     HashSet<CosmeticFilter> *simpleCosmeticFilters,
-    bool preserveRules) {
+    bool preserveRules, bool compile) {
   FilterParseState parseState = FPStart;
   const char *p = input;
   const char *filterRuleStart = p;
@@ -349,7 +383,12 @@ void parseFilter(const char *input, const char *end, Filter *f,
                 memcpy(f->ruleDefinition, input + i + 1, len - 1);
               }
 
+              f->dataLen = len - 1;
               f->filterType = FTRegex;
+              if (compile) {
+                f->compileRegex();
+                f->compileMatcher();
+              }
               return;
             } else {
               parseState = FPData;
@@ -433,7 +472,23 @@ void parseFilter(const char *input, const char *end, Filter *f,
 
   data[i] = '\0';
   f->data = new char[i + 1];
+  f->dataLen = i;
   memcpy(f->data, data, i + 1);
+  // URLs are lowercased once per request, so the data of URL filters is
+  // lowercased here unless it has to match as is.  Hosts are never case
+  // sensitive.
+  if (!(f->filterType & (FTElementHiding | FTElementHidingException |
+          FTHTMLFiltering))) {
+    if (!(f->filterOption & FOMatchCase)) {
+      lowercaseAscii(f->data, i, f->data);
+    }
+    if (f->host) {
+      lowercaseAscii(f->host, static_cast<int>(strlen(f->host)), f->host);
+    }
+  }
+  if (compile) {
+    f->compileMatcher();
+  }
 
   char fingerprintBuffer[AdBlockClient::kFingerprintSize + 1];
   fingerprintBuffer[AdBlockClient::kFingerprintSize] = '\0';
@@ -446,13 +501,8 @@ void parseFilter(const char *input, const char *end, Filter *f,
     if (simpleCosmeticFilters && f->domainList) {
       simpleCosmeticFilters->Remove(CosmeticFilter(data));
     }
-  } else if (exceptionBloomFilter
-      && (f->filterType & FTException) && (f->filterType & FTHostOnly)) {
-    // cout << "add host anchored exception bloom filter: " << f->host << endl;
-    hostAnchoredExceptionHashSet->Add(*f);
-  } else if (hostAnchoredHashSet && (f->filterType & FTHostOnly)) {
-    // cout << "add host anchored bloom filter: " << f->host << endl;
-    hostAnchoredHashSet->Add(*f);
+  } else if (isHostIndexedFilter(f)) {
+    // Looked up by host instead, see AdBlockClient::parse
   } else if (AdBlockClient::getFingerprint(fingerprintBuffer, *f)) {
     if (exceptionBloomFilter && f->filterType & FTException) {
       exceptionBloomFilter->add(fingerprintBuffer);
@@ -475,6 +525,8 @@ AdBlockClient::AdBlockClient() : filters(nullptr),
   noFingerprintAntiDomainOnlyFilters(nullptr),
   noFingerprintDomainOnlyExceptionFilters(nullptr),
   noFingerprintAntiDomainOnlyExceptionFilters(nullptr),
+  hostAnchoredFilters(nullptr),
+  hostAnchoredExceptionFilters(nullptr),
   numFilters(0),
   numCosmeticFilters(0),
   numHtmlFilters(0),
@@ -489,12 +541,14 @@ AdBlockClient::AdBlockClient() : filters(nullptr),
   numHostAnchoredExceptionFilters(0),
   bloomFilter(nullptr),
   exceptionBloomFilter(nullptr),
-  hostAnchoredHashSet(nullptr),
-  hostAnchoredExceptionHashSet(nullptr),
-  noFingerprintDomainHashSet(nullptr),
-  noFingerprintAntiDomainHashSet(nullptr),
-  noFingerprintDomainExceptionHashSet(nullptr),
-  noFingerprintAntiDomainExceptionHashSet(nullptr),
+  hostAnchoredPostings(nullptr),
+  hostAnchoredExceptionPostings(nullptr),
+  noFingerprintDomainPostings(nullptr),
+  noFingerprintAntiDomainPostings(nullptr),
+  noFingerprintDomainExceptionPostings(nullptr),
+  noFingerprintAntiDomainExceptionPostings(nullptr),
+  fingerprintPostings(nullptr),
+  exceptionFingerprintPostings(nullptr),
   badFingerprintsHashSet(nullptr),
   numFalsePositives(0),
   numExceptionFalsePositives(0),
@@ -502,15 +556,26 @@ AdBlockClient::AdBlockClient() : filters(nullptr),
   numExceptionBloomFilterSaves(0),
   numHashSetSaves(0),
   numExceptionHashSetSaves(0),
-  deserializedBuffer(nullptr) {
+  numHostDecisionSaves(0),
+  deserializedBuffer(nullptr),
+  matchCache(nullptr),
+  hostDecisionCache(nullptr),
+  contextFiltersCache(nullptr),
+  filterHitCounts(nullptr),
+  filterOrderFrozen(false),
+  fingerprintAutomatonEnabled(false),
+  filterGeneration(1) {
 }
 
 AdBlockClient::~AdBlockClient() {
   clear();
+  disableMatchCache();
+  disableHostDecisionCache();
 }
 
 // Clears all data and stats from the AdBlockClient
 void AdBlockClient::clear() {
+  filterGeneration++;
   if (filters) {
     delete[] filters;
     filters = nullptr;
@@ -551,6 +616,14 @@ void AdBlockClient::clear() {
     delete[] noFingerprintAntiDomainOnlyExceptionFilters;
     noFingerprintAntiDomainOnlyExceptionFilters = nullptr;
   }
+  if (hostAnchoredFilters) {
+    delete[] hostAnchoredFilters;
+    hostAnchoredFilters = nullptr;
+  }
+  if (hostAnchoredExceptionFilters) {
+    delete[] hostAnchoredExceptionFilters;
+    hostAnchoredExceptionFilters = nullptr;
+  }
   if (bloomFilter) {
     delete bloomFilter;
     bloomFilter = nullptr;
@@ -559,34 +632,63 @@ void AdBlockClient::clear() {
     delete exceptionBloomFilter;
     exceptionBloomFilter = nullptr;
   }
-  if (hostAnchoredHashSet) {
-    delete hostAnchoredHashSet;
-    hostAnchoredHashSet = nullptr;
+  if (hostAnchoredPostings) {
+    delete hostAnchoredPostings;
+    hostAnchoredPostings = nullptr;
+  }
+  if (hostAnchoredExceptionPostings) {
+    delete hostAnchoredExceptionPostings;
+    hostAnchoredExceptionPostings = nullptr;
+  }
+  if (noFingerprintDomainPostings) {
+    delete noFingerprintDomainPostings;
+    noFingerprintDomainPostings = nullptr;
   }
-  if (hostAnchoredExceptionHashSet) {
-    delete hostAnchoredExceptionHashSet;
-    hostAnchoredExceptionHashSet = nullptr;
+  if (noFingerprintAntiDomainPostings) {
+    delete noFingerprintAntiDomainPostings;
+    noFingerprintAntiDomainPostings = nullptr;
   }
-  if (noFingerprintDomainHashSet) {
-    delete noFingerprintDomainHashSet;
-    noFingerprintDomainHashSet = nullptr;
+  if (noFingerprintDomainExceptionPostings) {
+    delete noFingerprintDomainExceptionPostings;
+    noFingerprintDomainExceptionPostings = nullptr;
   }
-  if (noFingerprintAntiDomainHashSet) {
-    delete noFingerprintAntiDomainHashSet;
-    noFingerprintAntiDomainHashSet = nullptr;
+  if (noFingerprintAntiDomainExceptionPostings) {
+    delete noFingerprintAntiDomainExceptionPostings;
+    noFingerprintAntiDomainExceptionPostings = nullptr;
   }
-  if (noFingerprintDomainExceptionHashSet) {
-    delete noFingerprintDomainExceptionHashSet;
-    noFingerprintDomainExceptionHashSet = nullptr;
+  if (fingerprintPostings) {
+    delete fingerprintPostings;
+    fingerprintPostings = nullptr;
   }
-  if (noFingerprintAntiDomainExceptionHashSet) {
-    delete noFingerprintAntiDomainExceptionHashSet;
-    noFingerprintAntiDomainExceptionHashSet = nullptr;
+  if (exceptionFingerprintPostings) {
+    delete exceptionFingerprintPostings;
+    exceptionFingerprintPostings = nullptr;
   }
   if (badFingerprintsHashSet) {
     delete badFingerprintsHashSet;
     badFingerprintsHashSet = nullptr;
   }
+  filterOptionIndex.clear();
+  exceptionFilterOptionIndex.clear();
+  noFingerprintFilterOptionIndex.clear();
+  noFingerprintExceptionFilterOptionIndex.clear();
+  noFingerprintDomainOnlyFilterOptionIndex.clear();
+  noFingerprintAntiDomainOnlyFilterOptionIndex.clear();
+  noFingerprintDomainOnlyExceptionFilterOptionIndex.clear();
+  noFingerprintAntiDomainOnlyExceptionFilterOptionIndex.clear();
+  hostSuffixTrie.clear();
+  fingerprintAutomaton.clear();
+  exceptionFingerprintAutomaton.clear();
+  noFingerprintMatcher.clear();
+  noFingerprintExceptionMatcher.clear();
+  if (matchCache) {
+    matchCache->clear();
+  }
+  if (hostDecisionCache) {
+    hostDecisionCache->clear();
+    contextFiltersCache->clear();
+  }
+  stopFilterHitCounting();
 
   numFilters = 0;
   numCosmeticFilters = 0;
@@ -606,26 +708,215 @@ void AdBlockClient::clear() {
   numExceptionBloomFilterSaves = 0;
   numHashSetSaves = 0;
   numExceptionHashSetSaves = 0;
+  numHostDecisionSaves = 0;
+}
+
+// Returns the bitmap of filters to visit for |request|, the candidates of
+// |matcher| which |optionIndex| accepts when the matcher is built.  Either
+// can be left out, nullptr means every filter.
+static const uint64_t * findFiltersToVisit(int numFilters,
+    const FilterOptionIndex *optionIndex,
+    const NoFingerprintMatcher *matcher, const MatchRequest &request,
+    uint64_t *candidates) {
+  const uint64_t *bitmap = optionIndex ?
+    optionIndex->find(request.contextOption, numFilters) : nullptr;
+  if (!matcher || !matcher->findCandidates(request, numFilters, candidates)) {
+    return bitmap;
+  }
+  if (bitmap) {
+    const int numWords = (numFilters + 63) / 64;
+    for (int i = 0; i < numWords; i++) {
+      candidates[i] &= bitmap[i];
+    }
+  }
+  return candidates;
 }
 
 bool AdBlockClient::hasMatchingFilters(Filter *filter, int numFilters,
-    const char *input,
-    int inputLen,
-    FilterOption contextOption,
-    const char *contextDomain,
-    BloomFilter *inputBloomFilter,
-    const char *inputHost,
-    int inputHostLen,
-    Filter **matchingFilter) {
+    const FilterOptionIndex *optionIndex,
+    const MatchRequest &request,
+    Filter **matchingFilter,
+    const NoFingerprintMatcher *matcher) {
+  uint64_t candidates[NoFingerprintMatcher::kMaxWords];
+  const uint64_t *bitmap = findFiltersToVisit(numFilters, optionIndex,
+      matcher, request, candidates);
+  if (bitmap) {
+    // Only visit the filters whose options accept the request context
+    const int numWords = (numFilters + 63) / 64;
+    for (int i = 0; i < numWords; i++) {
+      uint64_t word = bitmap[i];
+      while (word) {
+        Filter *candidate = filter + i * 64 + lowestSetBit(word);
+        word &= word - 1;
+        if (candidate->matches(request)) {
+          if (filterHitCounts) {
+            countFilterHit(filter, candidate);
+          }
+          if (matchingFilter) {
+            *matchingFilter = candidate;
+          }
+          return true;
+        }
+      }
+    }
+    if (matchingFilter) {
+      *matchingFilter = nullptr;
+    }
+    return false;
+  }
+
   for (int i = 0; i < numFilters; i++) {
-    if (filter->matches(input, inputLen, contextOption,
-          contextDomain, inputBloomFilter, inputHost, inputHostLen)) {
+    if (filter[i].matches(request)) {
+      if (filterHitCounts) {
+        countFilterHit(filter, filter + i);
+      }
       if (matchingFilter) {
-        *matchingFilter = filter;
+        *matchingFilter = filter + i;
+      }
+      return true;
+    }
+  }
+  if (matchingFilter) {
+    *matchingFilter = nullptr;
+  }
+  return false;
+}
+
+bool AdBlockClient::hasMatchingFilterIds(Filter *filter, int numFilters,
+    const int *ids, int numIds, const FilterOptionIndex *optionIndex,
+    const MatchRequest &request) {
+  const uint64_t *bitmap = optionIndex ?
+    optionIndex->find(request.contextOption, numFilters) : nullptr;
+  for (int i = 0; i < numIds; i++) {
+    const int filterId = ids[i];
+    if (filterId < 0 || filterId >= numFilters) {
+      continue;
+    }
+    if (bitmap && !(bitmap[filterId / 64] >> (filterId % 64) & 1)) {
+      continue;
+    }
+    if (filter[filterId].matches(request, false)) {
+      if (filterHitCounts) {
+        countFilterHit(filter, filter + filterId);
       }
       return true;
     }
-    filter++;
+  }
+  return false;
+}
+
+int AdBlockClient::findFirstFingerprint(
+    const FingerprintAutomaton &automaton,
+    HashSet<FingerprintPostings> *postings,
+    BloomFilter *bloomFilter,
+    const MatchRequest &request) {
+  if (automaton.isBuilt()) {
+    int state = FingerprintAutomaton::kRootState;
+    for (int i = 0; i < request.inputLen; i++) {
+      state = automaton.next(state, request.input[i]);
+      int numIds;
+      if (automaton.filterIds(state, &numIds)) {
+        return i + 1 - kFingerprintSize;
+      }
+    }
+    return -1;
+  }
+  if (!postings) {
+    if (bloomFilter && !bloomFilter->substringExists(request.input,
+          request.inputLen, AdBlockClient::kFingerprintSize)) {
+      return -1;
+    }
+    return 0;
+  }
+  for (int i = 0; i + kFingerprintSize <= request.inputLen; i++) {
+    if (postings->Find(FingerprintPostings(request.input + i,
+            kFingerprintSize))) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+bool AdBlockClient::hasMatchingFingerprintFilters(Filter *filter,
+    int numFilters,
+    const FingerprintAutomaton &automaton,
+    HashSet<FingerprintPostings> *postings,
+    const FilterOptionIndex *optionIndex,
+    const MatchRequest &request,
+    Filter **matchingFilter,
+    int firstFingerprint) {
+  if (!automaton.isBuilt() && !postings) {
+    return hasMatchingFilters(filter, numFilters, optionIndex, request,
+        matchingFilter);
+  }
+  const uint64_t *bitmap = optionIndex ?
+    optionIndex->find(request.contextOption, numFilters) : nullptr;
+
+  // The same fingerprint can occur more than once in a URL, remember the
+  // last few filter id lists checked so we don't evaluate them again.
+  const int kMaxRecentPostings = 8;
+  const int *recentPostings[kMaxRecentPostings];
+  int numRecentPostings = 0;
+  int nextRecentPosting = 0;
+
+  const char *input = request.input;
+  int state = FingerprintAutomaton::kRootState;
+  for (int i = firstFingerprint; i < request.inputLen; i++) {
+    const int *filterIds;
+    int numFilterIds;
+    if (automaton.isBuilt()) {
+      // The automaton finds fingerprints by the byte they end at
+      state = automaton.next(state, input[i]);
+      filterIds = automaton.filterIds(state, &numFilterIds);
+    } else {
+      if (i + kFingerprintSize > request.inputLen) {
+        break;
+      }
+      FingerprintPostings *fingerprintPostings =
+        postings->Find(FingerprintPostings(input + i, kFingerprintSize));
+      filterIds = fingerprintPostings ? fingerprintPostings->filterIds :
+        nullptr;
+      numFilterIds = fingerprintPostings ? fingerprintPostings->numFilterIds :
+        0;
+    }
+    if (!filterIds) {
+      continue;
+    }
+    bool alreadyChecked = false;
+    for (int j = 0; j < numRecentPostings; j++) {
+      if (recentPostings[j] == filterIds) {
+        alreadyChecked = true;
+        break;
+      }
+    }
+    if (alreadyChecked) {
+      continue;
+    }
+    recentPostings[nextRecentPosting] = filterIds;
+    nextRecentPosting = (nextRecentPosting + 1) % kMaxRecentPostings;
+    if (numRecentPostings < kMaxRecentPostings) {
+      numRecentPostings++;
+    }
+
+    for (int j = 0; j < numFilterIds; j++) {
+      const int filterId = filterIds[j];
+      if (bitmap && !(bitmap[filterId / 64] >> (filterId % 64) & 1)) {
+        continue;
+      }
+      Filter *candidate = filter + filterId;
+      if (j + 1 < numFilterIds) {
+        PREFETCH(filter + filterIds[j + 1]);
+      }
+      if (candidate->matches(request)) {
+        if (filterHitCounts) {
+          countFilterHit(filter, candidate);
+        }
+        if (matchingFilter) {
+          *matchingFilter = candidate;
+        }
+        return true;
+      }
+    }
   }
   if (matchingFilter) {
     *matchingFilter = nullptr;
@@ -635,11 +926,11 @@ bool AdBlockClient::hasMatchingFilters(Filter *filter, int numFilters,
 
 void discoverMatchingPrefix(BadFingerprintsHashSet *badFingerprintsHashSet,
     const char *str,
+    int strLen,
     BloomFilter *bloomFilter,
     int prefixLen = AdBlockClient::kFingerprintSize) {
   char sz[32];
   memset(sz, 0, sizeof(sz));
-  int strLen = static_cast<int>(strlen(str));
   for (int i = 0; i < strLen - prefixLen + 1; i++) {
     if (bloomFilter->exists(str + i, prefixLen)) {
       memcpy(sz, str + i, prefixLen);
@@ -659,112 +950,378 @@ void discoverMatchingPrefix(BadFingerprintsHashSet *badFingerprintsHashSet,
   }
 }
 
-bool isNoFingerprintDomainHashSetMiss(HashSet<NoFingerprintDomain> *hashSet,
-    const char *host, int hostLen) {
-  if (!hashSet) {
-    return false;
+// Finds the no fingerprint domain postings stored under each suffix of the
+// context domain which starts at a label, other than the TLD on its own,
+// which are the suffixes Filter::contextDomainMatchesFilter() checks.
+// Returns how many were put in |foundPostings|.  Only the suffixes which
+// |hostSuffixTrie| has with |flag| are looked up in |postings| when it is
+// built.
+int findDomainPostings(const MatchRequest &request,
+    HashSet<FingerprintPostings> *postings,
+    const HostSuffixTrie &hostSuffixTrie, uint8_t flag,
+    FingerprintPostings **foundPostings) {
+  const char *domain = request.contextDomain;
+  const int domainLen = request.contextDomainLen;
+  if (!domain || request.numContextDomainLabels < 2) {
+    return 0;
+  }
+  int numFound = 0;
+  if (hostSuffixTrie.isBuilt()) {
+    int starts[MatchRequest::kMaxDomainLabels];
+    int numStarts = 0;
+    hostSuffixTrie.findSuffixes(domain, domainLen, flag, starts,
+        MatchRequest::kMaxDomainLabels, &numStarts);
+    for (int i = 0; i < numStarts; i++) {
+      FingerprintPostings *found = postings->Find(
+          FingerprintPostings(domain + starts[i], domainLen - starts[i]));
+      if (found) {
+        foundPostings[numFound++] = found;
+      }
+    }
+    return numFound;
   }
-  const char *start = host + hostLen;
-  // Skip past the TLD
-  while (start != host) {
-    start--;
-    if (*(start) == '.') {
-      break;
+
+  for (int i = 0; i < request.numContextDomainLabels - 1; i++) {
+    const int offset = request.contextDomainLabels[i];
+    FingerprintPostings *found = postings->Find(
+        FingerprintPostings(domain + offset, domainLen - offset));
+    if (found) {
+      foundPostings[numFound++] = found;
     }
   }
-  while (start != host) {
-    if (*(start - 1) == '.') {
-      if (hashSet->Find(NoFingerprintDomain(start,
-          static_cast<int>(host + hostLen - start)))) {
-        return false;
+  return numFound;
+}
+
+// Returns true if |filterId| is in one of the |numPostings| postings
+bool isInPostings(FingerprintPostings **postings, int numPostings,
+    int filterId) {
+  for (int i = 0; i < numPostings; i++) {
+    for (int j = 0; j < postings[i]->numFilterIds; j++) {
+      if (postings[i]->filterIds[j] == filterId) {
+        return true;
       }
     }
-    start--;
   }
-  return !hashSet->Find(NoFingerprintDomain(start,
-      static_cast<int>(host + hostLen - start)));
+  return false;
 }
 
-bool isHostAnchoredHashSetMiss(const char *input, int inputLen,
-    HashSet<Filter> *hashSet,
-    const char *inputHost,
-    int inputHostLen,
-    FilterOption contextOption,
-    const char *contextDomain,
-    Filter **foundFilter = nullptr) {
-  if (!hashSet) {
-    return false;
+// Finds the host anchored filter postings stored under each suffix of the
+// input host which starts at a label, other than the TLD on its own, from
+// the shortest to the full host.  Returns how many were put in
+// |foundPostings|.  Only the suffixes which |hostSuffixTrie| has with |flag|
+// are looked up in |postings| when it is built.
+int findHostAnchoredPostings(const MatchRequest &request,
+    HashSet<FingerprintPostings> *postings,
+    const HostSuffixTrie &hostSuffixTrie, uint8_t flag,
+    FingerprintPostings **foundPostings) {
+  int numFound = 0;
+  const char *host = request.host;
+  const int hostLen = request.hostLen;
+  if (hostSuffixTrie.isBuilt()) {
+    int starts[MatchRequest::kMaxDomainLabels];
+    int numStarts = 0;
+    hostSuffixTrie.findSuffixes(host, hostLen, flag, starts,
+        MatchRequest::kMaxDomainLabels, &numStarts);
+    for (int i = 0; i < numStarts; i++) {
+      FingerprintPostings *found = postings->Find(
+          FingerprintPostings(host + starts[i], hostLen - starts[i]));
+      if (found) {
+        foundPostings[numFound++] = found;
+      }
+    }
+    return numFound;
   }
 
-  const char *start = inputHost + inputHostLen;
-  // Skip past the TLD
-  while (start != inputHost) {
-    start--;
-    if (*(start) == '.') {
-      break;
+  for (int i = request.numHostLabels - 2; i > 0; i--) {
+    const int offset = request.hostLabels[i];
+    FingerprintPostings *found = postings->Find(
+        FingerprintPostings(host + offset, hostLen - offset));
+    if (found) {
+      foundPostings[numFound++] = found;
     }
   }
 
-  while (start != inputHost) {
-    if (*(start - 1) == '.') {
-      Filter *filter = hashSet->Find(Filter(start,
-            static_cast<int>(inputHost + inputHostLen - start),
-            nullptr, start, inputHostLen - (start - inputHost)));
-      if (filter && filter->matches(input, inputLen,
-            contextOption, contextDomain)) {
+  FingerprintPostings *found =
+    postings->Find(FingerprintPostings(host, hostLen));
+  if (found) {
+    foundPostings[numFound++] = found;
+  }
+  return numFound;
+}
+
+// Returns true if none of the filters in |postings| match the request
+bool isHostAnchoredMiss(const MatchRequest &request,
+    Filter *filters,
+    FingerprintPostings **postings,
+    int numPostings,
+    Filter **foundFilter) {
+  for (int i = 0; i < numPostings; i++) {
+    for (int j = 0; j < postings[i]->numFilterIds; j++) {
+      Filter *filter = filters + postings[i]->filterIds[j];
+      if (filter->matches(request)) {
         if (foundFilter) {
           *foundFilter = filter;
         }
         return false;
       }
     }
-    start--;
+  }
+  return true;
+}
+
+bool isHostAnchoredPostingsMiss(const MatchRequest &request,
+    Filter *filters,
+    HashSet<FingerprintPostings> *postings,
+    const HostSuffixTrie &hostSuffixTrie, uint8_t flag,
+    Filter **foundFilter = nullptr) {
+  if (!postings) {
+    return false;
+  }
+  FingerprintPostings *found[MatchRequest::kMaxDomainLabels];
+  int numFound = findHostAnchoredPostings(request, postings, hostSuffixTrie,
+      flag, found);
+  return isHostAnchoredMiss(request, filters, found, numFound, foundFilter);
+}
+
+// Same as above but the postings found are kept in |found| and |numFound|,
+// and only looked up if |numFound| is -1.
+bool isHostAnchoredPostingsMiss(const MatchRequest &request,
+    Filter *filters,
+    HashSet<FingerprintPostings> *postings,
+    const HostSuffixTrie &hostSuffixTrie, uint8_t flag,
+    FingerprintPostings **found,
+    int *numFound) {
+  if (!postings) {
+    return false;
+  }
+  if (*numFound == -1) {
+    *numFound = findHostAnchoredPostings(request, postings, hostSuffixTrie,
+        flag, found);
+  }
+  return isHostAnchoredMiss(request, filters, found, *numFound, nullptr);
+}
+
+// Host anchored filter postings stored under the suffixes of a host, which
+// every URL with that host shares.  The counts are -1 until they are looked
+// up.
+struct AdBlockClient::HostLookups {
+  HostLookups() {
+    reset();
+  }
+  void reset() {
+    numPostings = -1;
+    numExceptionPostings = -1;
   }
 
-  Filter *filter = hashSet->Find(Filter(start,
-        static_cast<int>(inputHost + inputHostLen - start), nullptr,
-        start, inputHostLen));
-  if (!filter) {
+  FingerprintPostings *postings[MatchRequest::kMaxDomainLabels];
+  int numPostings;
+  FingerprintPostings *exceptionPostings[MatchRequest::kMaxDomainLabels];
+  int numExceptionPostings;
+};
+
+bool AdBlockClient::hasMatchingDomainFilters(Filter *filter, int numFilters,
+    HashSet<FingerprintPostings> *postings, uint8_t flag, bool antiDomains,
+    const FilterOptionIndex *optionIndex, const MatchRequest &request,
+    Filter **matchingFilter) {
+  if (!postings) {
+    return hasMatchingFilters(filter, numFilters, optionIndex, request,
+        matchingFilter);
+  }
+  FingerprintPostings *found[MatchRequest::kMaxDomainLabels];
+  const int numFound = findDomainPostings(request, postings, hostSuffixTrie,
+      flag, found);
+  if (matchingFilter) {
+    *matchingFilter = nullptr;
+  }
+  if (!antiDomains && numFound == 0) {
+    return false;
+  }
+  const uint64_t *bitmap = optionIndex ?
+    optionIndex->find(request.contextOption, numFilters) : nullptr;
+  auto check = [&](int filterId) {
+    if (bitmap && !(bitmap[filterId / 64] >> (filterId % 64) & 1)) {
+      return false;
+    }
+    if (!filter[filterId].matches(request, false)) {
+      return false;
+    }
+    if (filterHitCounts) {
+      countFilterHit(filter, filter + filterId);
+    }
+    if (matchingFilter) {
+      *matchingFilter = filter + filterId;
+    }
     return true;
+  };
+
+  if (!antiDomains) {
+    for (int i = 0; i < numFound; i++) {
+      for (int j = 0; j < found[i]->numFilterIds; j++) {
+        if (check(found[i]->filterIds[j])) {
+          return true;
+        }
+      }
+    }
+    return false;
   }
-  bool result = !filter->matches(input, inputLen, contextOption, contextDomain);
-  if (!result && foundFilter) {
-    *foundFilter = filter;
+  for (int i = 0; i < numFilters; i++) {
+    if ((numFound == 0 || !isInPostings(found, numFound, i)) && check(i)) {
+      return true;
+    }
   }
-  return result;
+  return false;
+}
+
+void AdBlockClient::initPageContext(const char *pageUrl,
+    const char *contextDomain, PageContext *pageContext) {
+  initContextDomainFilters(contextDomain, pageContext);
+  if (!pageUrl) {
+    return;
+  }
+  // $document exception filters are checked against the page itself
+  MatchRequest request(pageUrl, static_cast<int>(strlen(pageUrl)),
+      FODocument, pageContext->contextDomain, pageContext->contextDomainLen);
+  pageContext->documentException =
+    matchesException(request, pageContext, nullptr);
+}
+
+void AdBlockClient::initContextDomainFilters(const char *contextDomain,
+    PageContext *pageContext) {
+  pageContext->clear();
+  if (contextDomain) {
+    pageContext->contextDomainLen = static_cast<int>(strlen(contextDomain));
+    pageContext->contextDomain = new char[pageContext->contextDomainLen + 1];
+    memcpy(pageContext->contextDomain, contextDomain,
+        pageContext->contextDomainLen + 1);
+  }
+  // Only the context domain of the request is used to find the filters
+  MatchRequest request("", 0, FONoFilterOption, pageContext->contextDomain,
+      pageContext->contextDomainLen);
+
+  // The same filters which matches() would check for this domain, in list
+  // order.
+  auto findFilterIds = [this, &request](const Filter *filters,
+      int numFilters, HashSet<FingerprintPostings> *postings, uint8_t flag,
+      bool antiDomains, PageContext::FilterIds *filterIds) {
+    filterIds->ids = new int[numFilters > 0 ? numFilters : 1];
+    if (!postings) {
+      for (int i = 0; i < numFilters; i++) {
+        if (!request.contextDomain ||
+            filters[i].contextDomainMatchesFilter(request)) {
+          filterIds->ids[filterIds->numIds++] = i;
+        }
+      }
+      return;
+    }
+    FingerprintPostings *found[MatchRequest::kMaxDomainLabels];
+    const int numFound = findDomainPostings(request, postings,
+        hostSuffixTrie, flag, found);
+    for (int i = 0; i < numFilters; i++) {
+      if (isInPostings(found, numFound, i) != antiDomains) {
+        filterIds->ids[filterIds->numIds++] = i;
+      }
+    }
+  };
+  findFilterIds(noFingerprintDomainOnlyFilters,
+      numNoFingerprintDomainOnlyFilters, noFingerprintDomainPostings,
+      HostSuffixTrie::kNoFingerprintDomain, false,
+      &pageContext->domainOnlyFilters);
+  findFilterIds(noFingerprintAntiDomainOnlyFilters,
+      numNoFingerprintAntiDomainOnlyFilters, noFingerprintAntiDomainPostings,
+      HostSuffixTrie::kNoFingerprintAntiDomain, true,
+      &pageContext->antiDomainOnlyFilters);
+  findFilterIds(noFingerprintDomainOnlyExceptionFilters,
+      numNoFingerprintDomainOnlyExceptionFilters,
+      noFingerprintDomainExceptionPostings,
+      HostSuffixTrie::kNoFingerprintDomainException, false,
+      &pageContext->domainOnlyExceptionFilters);
+  findFilterIds(noFingerprintAntiDomainOnlyExceptionFilters,
+      numNoFingerprintAntiDomainOnlyExceptionFilters,
+      noFingerprintAntiDomainExceptionPostings,
+      HostSuffixTrie::kNoFingerprintAntiDomainException, true,
+      &pageContext->antiDomainOnlyExceptionFilters);
+  pageContext->generation = filterGeneration;
 }
 
 bool AdBlockClient::matches(const char *input, FilterOption contextOption,
     const char *contextDomain) {
-  int inputLen = static_cast<int>(strlen(input));
+  int contextDomainLen =
+    contextDomain ? static_cast<int>(strlen(contextDomain)) : 0;
+  return matchesCached(input, static_cast<int>(strlen(input)), contextOption,
+      contextDomain, contextDomainLen, nullptr);
+}
+
+bool AdBlockClient::matches(const char *input, FilterOption contextOption,
+    const PageContext &pageContext) {
+  if (pageContext.generation != filterGeneration) {
+    return matchesCached(input, static_cast<int>(strlen(input)),
+        contextOption, pageContext.contextDomain,
+        pageContext.contextDomainLen, nullptr);
+  }
+  // Pages allowed by a $document exception are never cached since the same
+  // URL and domain may be blocked without a page context.
+  if (pageContext.documentException) {
+    return false;
+  }
+  return matchesCached(input, static_cast<int>(strlen(input)), contextOption,
+      pageContext.contextDomain, pageContext.contextDomainLen, &pageContext);
+}
 
+bool AdBlockClient::matchesCached(const char *input, int inputLen,
+    FilterOption contextOption, const char *contextDomain,
+    int contextDomainLen, const PageContext *pageContext) {
+  // Checked before building the request so that large data URLs and the
+  // like are never scanned.
   if (!isBlockableProtocol(input, inputLen)) {
       return false;
   }
-
-  int inputHostLen;
-  const char *inputHost = getUrlHost(input, &inputHostLen);
-
-  int contextDomainLen = 0;
-  if (contextDomain) {
-    contextDomainLen = static_cast<int>(strlen(contextDomain));
-    if (isThirdPartyHost(contextDomain, contextDomainLen,
-        inputHost, static_cast<int>(inputHostLen))) {
-      contextOption =
-        static_cast<FilterOption>(contextOption | FOThirdParty);
-    } else {
-      contextOption =
-        static_cast<FilterOption>(contextOption | FONotThirdParty);
+  uint64_t cacheKey = 0;
+  if (matchCache) {
+    cacheKey = matchCache->hash(input, inputLen, contextOption,
+        contextDomain, contextDomainLen);
+    bool cachedMatches;
+    if (matchCache->find(cacheKey, &cachedMatches)) {
+      return cachedMatches;
     }
   }
+  MatchRequest request(input, inputLen, contextOption, contextDomain,
+      contextDomainLen);
+  bool result = matches(request, pageContext, nullptr);
+  if (matchCache) {
+    matchCache->add(cacheKey, result);
+  }
+  return result;
+}
+
+bool AdBlockClient::matches(const MatchRequest &request) {
+  return matches(request, nullptr, nullptr);
+}
 
-  // Optimization for the manual filter checks which are needed.
-  // Avoid having to check individual filters if the filter parts are not found
-  // inside the input bloom filter.
-  HashFn2Byte hashFns[] = { hashFn2Byte };
-  BloomFilter inputBloomFilter(10, 1024, hashFns, 1);
-  for (int i = 1; i < inputLen; i++) {
-    inputBloomFilter.add(input + i - 1, 2);
+bool AdBlockClient::matches(const MatchRequest &request,
+    const PageContext &pageContext) {
+  // A context built for other filters is ignored rather than trusted
+  return matches(request, pageContext.generation == filterGeneration ?
+      &pageContext : nullptr, nullptr);
+}
+
+bool AdBlockClient::matches(const MatchRequest &request,
+    const PageContext *pageContext,
+    HostLookups *hostLookups) {
+  const char *input = request.input;
+  const int inputLen = request.inputLen;
+
+  if (!request.blockableProtocol) {
+      return false;
+  }
+  if (pageContext && pageContext->documentException) {
+    return false;
+  }
+  if (hostDecisionCache) {
+    const HostDecision decision = findCachedHostDecision(request);
+    if (decision != HDCheckUrl) {
+      incrementStat(&numHostDecisionSaves);
+      return decision == HDBlock;
+    }
   }
 
   // We always have to check noFingerprintFilters because the bloom filter opt
@@ -772,204 +1329,610 @@ bool AdBlockClient::matches(const char *input, FilterOption contextOption,
   bool hasMatch = false;
 
   // Only bother checking the no fingerprint domain related filters if needed
-  if (!isNoFingerprintDomainHashSetMiss(
-        noFingerprintDomainHashSet, contextDomain, contextDomainLen)) {
-    hasMatch = hasMatch || hasMatchingFilters(noFingerprintDomainOnlyFilters,
-        numNoFingerprintDomainOnlyFilters, input, inputLen, contextOption,
-        contextDomain, &inputBloomFilter, inputHost, inputHostLen);
-  }
-  if (isNoFingerprintDomainHashSetMiss(
-        noFingerprintAntiDomainHashSet, contextDomain, contextDomainLen)) {
-    hasMatch = hasMatch ||
-      hasMatchingFilters(noFingerprintAntiDomainOnlyFilters,
-        numNoFingerprintAntiDomainOnlyFilters, input, inputLen, contextOption,
-        contextDomain, &inputBloomFilter, inputHost, inputHostLen);
+  if (pageContext) {
+    hasMatch = hasMatchingFilterIds(noFingerprintDomainOnlyFilters,
+        numNoFingerprintDomainOnlyFilters,
+        pageContext->domainOnlyFilters.ids,
+        pageContext->domainOnlyFilters.numIds,
+        &noFingerprintDomainOnlyFilterOptionIndex, request) ||
+      hasMatchingFilterIds(noFingerprintAntiDomainOnlyFilters,
+        numNoFingerprintAntiDomainOnlyFilters,
+        pageContext->antiDomainOnlyFilters.ids,
+        pageContext->antiDomainOnlyFilters.numIds,
+        &noFingerprintAntiDomainOnlyFilterOptionIndex, request);
+  } else {
+    hasMatch = hasMatchingDomainFilters(noFingerprintDomainOnlyFilters,
+        numNoFingerprintDomainOnlyFilters, noFingerprintDomainPostings,
+        HostSuffixTrie::kNoFingerprintDomain, false,
+        &noFingerprintDomainOnlyFilterOptionIndex, request) ||
+      hasMatchingDomainFilters(noFingerprintAntiDomainOnlyFilters,
+        numNoFingerprintAntiDomainOnlyFilters,
+        noFingerprintAntiDomainPostings,
+        HostSuffixTrie::kNoFingerprintAntiDomain, true,
+        &noFingerprintAntiDomainOnlyFilterOptionIndex, request);
   }
 
   hasMatch = hasMatch || hasMatchingFilters(noFingerprintFilters,
-      numNoFingerprintFilters, input, inputLen, contextOption,
-      contextDomain, &inputBloomFilter, inputHost, inputHostLen);
+      numNoFingerprintFilters, &noFingerprintFilterOptionIndex, request,
+      nullptr, &noFingerprintMatcher);
 
   // If no noFingerprintFilters were hit, check the bloom filter substring
   // fingerprint for the normal
   // filter list.   If no substring exists for the input then we know for sure
   // the URL should not be blocked.
+  // The fingerprint postings are exact, so they're used for this when
+  // available instead of the bloom filter.
   bool bloomFilterMiss = false;
-  bool hostAnchoredHashSetMiss = false;
+  bool hostAnchoredMiss = false;
+  int firstFingerprint = 0;
   if (!hasMatch) {
-    bloomFilterMiss = bloomFilter
-      && !bloomFilter->substringExists(input, AdBlockClient::kFingerprintSize);
-    hostAnchoredHashSetMiss = isHostAnchoredHashSetMiss(input, inputLen,
-        hostAnchoredHashSet, inputHost, inputHostLen,
-        contextOption, contextDomain);
-    if (bloomFilterMiss && hostAnchoredHashSetMiss) {
+    firstFingerprint = findFirstFingerprint(fingerprintAutomaton,
+        fingerprintPostings, bloomFilter, request);
+    bloomFilterMiss = firstFingerprint == -1;
+    hostAnchoredMiss = hostLookups ?
+      isHostAnchoredPostingsMiss(request, hostAnchoredFilters,
+          hostAnchoredPostings, hostSuffixTrie, HostSuffixTrie::kHostAnchored,
+          hostLookups->postings, &hostLookups->numPostings) :
+      isHostAnchoredPostingsMiss(request, hostAnchoredFilters,
+          hostAnchoredPostings, hostSuffixTrie,
+          HostSuffixTrie::kHostAnchored);
+    if (bloomFilterMiss && hostAnchoredMiss) {
       if (bloomFilterMiss) {
-        numBloomFilterSaves++;
+        incrementStat(&numBloomFilterSaves);
       }
-      if (hostAnchoredHashSetMiss) {
-        numHashSetSaves++;
+      if (hostAnchoredMiss) {
+        incrementStat(&numHashSetSaves);
       }
       return false;
     }
 
-    hasMatch = !hostAnchoredHashSetMiss;
+    hasMatch = !hostAnchoredMiss;
   }
 
   // We need to check the filters list manually because there is either a match
   // or a false positive
   if (!hasMatch && !bloomFilterMiss) {
-    hasMatch = hasMatchingFilters(filters, numFilters, input, inputLen,
-        contextOption, contextDomain, &inputBloomFilter,
-        inputHost, inputHostLen);
+    hasMatch = hasMatchingFingerprintFilters(filters, numFilters,
+        fingerprintAutomaton, fingerprintPostings, &filterOptionIndex,
+        request, nullptr, firstFingerprint);
     // If there's still no match after checking the block filters, then no need
     // to try to block this because there is a false positive.
     if (!hasMatch) {
-      numFalsePositives++;
+      incrementStat(&numFalsePositives);
       if (badFingerprintsHashSet) {
         // cout << "false positive for input: " << input << " bloomFilterMiss: "
-        // << bloomFilterMiss << ", hostAnchoredHashSetMiss: "
-        // << hostAnchoredHashSetMiss << endl;
-        discoverMatchingPrefix(badFingerprintsHashSet, input, bloomFilter);
+        // << bloomFilterMiss << ", hostAnchoredMiss: "
+        // << hostAnchoredMiss << endl;
+        discoverMatchingPrefix(badFingerprintsHashSet, input, inputLen,
+            bloomFilter);
       }
       return false;
     }
   }
 
+  return !matchesException(request, pageContext, hostLookups);
+}
+
+bool AdBlockClient::matchesException(const MatchRequest &request,
+    const PageContext *pageContext,
+    HostLookups *hostLookups) {
   bool hasExceptionMatch = false;
 
   // Only bother checking the no fingerprint domain related filters if needed
-  if (!isNoFingerprintDomainHashSetMiss(
-        noFingerprintDomainExceptionHashSet, contextDomain, contextDomainLen)) {
-    hasExceptionMatch = hasExceptionMatch ||
-      hasMatchingFilters(noFingerprintDomainOnlyExceptionFilters,
-        numNoFingerprintDomainOnlyExceptionFilters, input, inputLen,
-        contextOption, contextDomain, &inputBloomFilter, inputHost,
-        inputHostLen);
-  }
-
-  if (isNoFingerprintDomainHashSetMiss(
-        noFingerprintAntiDomainExceptionHashSet, contextDomain,
-        contextDomainLen)) {
-    hasExceptionMatch = hasExceptionMatch ||
-    hasMatchingFilters(noFingerprintAntiDomainOnlyExceptionFilters,
-      numNoFingerprintAntiDomainOnlyExceptionFilters, input, inputLen,
-      contextOption, contextDomain, &inputBloomFilter, inputHost, inputHostLen);
+  if (pageContext) {
+    hasExceptionMatch = hasMatchingFilterIds(
+        noFingerprintDomainOnlyExceptionFilters,
+        numNoFingerprintDomainOnlyExceptionFilters,
+        pageContext->domainOnlyExceptionFilters.ids,
+        pageContext->domainOnlyExceptionFilters.numIds,
+        &noFingerprintDomainOnlyExceptionFilterOptionIndex, request) ||
+      hasMatchingFilterIds(noFingerprintAntiDomainOnlyExceptionFilters,
+        numNoFingerprintAntiDomainOnlyExceptionFilters,
+        pageContext->antiDomainOnlyExceptionFilters.ids,
+        pageContext->antiDomainOnlyExceptionFilters.numIds,
+        &noFingerprintAntiDomainOnlyExceptionFilterOptionIndex, request);
+  } else {
+    hasExceptionMatch = hasMatchingDomainFilters(
+        noFingerprintDomainOnlyExceptionFilters,
+        numNoFingerprintDomainOnlyExceptionFilters,
+        noFingerprintDomainExceptionPostings,
+        HostSuffixTrie::kNoFingerprintDomainException, false,
+        &noFingerprintDomainOnlyExceptionFilterOptionIndex, request) ||
+      hasMatchingDomainFilters(noFingerprintAntiDomainOnlyExceptionFilters,
+        numNoFingerprintAntiDomainOnlyExceptionFilters,
+        noFingerprintAntiDomainExceptionPostings,
+        HostSuffixTrie::kNoFingerprintAntiDomainException, true,
+        &noFingerprintAntiDomainOnlyExceptionFilterOptionIndex, request);
   }
 
   hasExceptionMatch = hasExceptionMatch ||
     hasMatchingFilters(noFingerprintExceptionFilters,
-      numNoFingerprintExceptionFilters, input, inputLen, contextOption,
-      contextDomain, &inputBloomFilter, inputHost, inputHostLen);
+      numNoFingerprintExceptionFilters,
+      &noFingerprintExceptionFilterOptionIndex, request, nullptr,
+      &noFingerprintExceptionMatcher);
 
   // If there's a matching no fingerprint exception then we can just return
   // right away because we shouldn't block
   if (hasExceptionMatch) {
-    return false;
+    return true;
   }
 
-  bool bloomExceptionFilterMiss = exceptionBloomFilter
-    && !exceptionBloomFilter->substringExists(input,
-        AdBlockClient::kFingerprintSize);
-  bool hostAnchoredExceptionHashSetMiss =
-    isHostAnchoredHashSetMiss(input, inputLen, hostAnchoredExceptionHashSet,
-        inputHost, inputHostLen, contextOption, contextDomain);
+  int firstExceptionFingerprint = findFirstFingerprint(
+      exceptionFingerprintAutomaton, exceptionFingerprintPostings,
+      exceptionBloomFilter, request);
+  bool bloomExceptionFilterMiss = firstExceptionFingerprint == -1;
+  bool hostAnchoredExceptionMiss = hostLookups ?
+    isHostAnchoredPostingsMiss(request, hostAnchoredExceptionFilters,
+        hostAnchoredExceptionPostings, hostSuffixTrie,
+        HostSuffixTrie::kHostAnchoredException,
+        hostLookups->exceptionPostings, &hostLookups->numExceptionPostings) :
+    isHostAnchoredPostingsMiss(request, hostAnchoredExceptionFilters,
+        hostAnchoredExceptionPostings, hostSuffixTrie,
+        HostSuffixTrie::kHostAnchoredException);
 
   // Now that we have a matching rule, we should check if no exception rule
   // hits, if none hits, we should block
-  if (bloomExceptionFilterMiss && hostAnchoredExceptionHashSetMiss) {
+  if (bloomExceptionFilterMiss && hostAnchoredExceptionMiss) {
     if (bloomExceptionFilterMiss) {
-      numExceptionBloomFilterSaves++;
+      incrementStat(&numExceptionBloomFilterSaves);
     }
-    if (hostAnchoredExceptionHashSetMiss) {
-      numExceptionHashSetSaves++;
+    if (hostAnchoredExceptionMiss) {
+      incrementStat(&numExceptionHashSetSaves);
     }
-    return true;
+    return false;
   }
 
   // If tehre wasn't an exception has set miss, it was a hit, and hash set is
   // deterministic so we shouldn't block this resource.
-  if (!hostAnchoredExceptionHashSetMiss) {
-    numExceptionHashSetSaves++;
-    return false;
+  if (!hostAnchoredExceptionMiss) {
+    incrementStat(&numExceptionHashSetSaves);
+    return true;
   }
 
   if (!bloomExceptionFilterMiss) {
-    if (!hasMatchingFilters(exceptionFilters, numExceptionFilters, input,
-          inputLen, contextOption, contextDomain,
-          &inputBloomFilter, inputHost, inputHostLen)) {
+    if (!hasMatchingFingerprintFilters(exceptionFilters, numExceptionFilters,
+          exceptionFingerprintAutomaton, exceptionFingerprintPostings,
+          &exceptionFilterOptionIndex, request, nullptr,
+          firstExceptionFingerprint)) {
       // False positive on the exception filter list
-      numExceptionFalsePositives++;
+      incrementStat(&numExceptionFalsePositives);
       // cout << "exception false positive for input: " << input << endl;
       if (badFingerprintsHashSet) {
         discoverMatchingPrefix(badFingerprintsHashSet,
-            input, exceptionBloomFilter);
+            request.input, request.inputLen, exceptionBloomFilter);
       }
-      return true;
+      return false;
     }
   }
 
+  return true;
+}
+
+bool AdBlockClient::hasUrlDependentFilters(const Filter *filter,
+    int numFilters, const FilterOptionIndex *optionIndex,
+    const MatchRequest &request) {
+  const uint64_t *bitmap = optionIndex ?
+    optionIndex->find(request.contextOption, numFilters) : nullptr;
+  for (int i = 0; i < numFilters; i++) {
+    if (bitmap && !(bitmap[i / 64] >> (i % 64) & 1)) {
+      continue;
+    }
+    if (filter[i].matchesOptions(request)) {
+      return true;
+    }
+  }
   return false;
 }
 
+uint8_t AdBlockClient::findContextFilters(const MatchRequest &request) {
+  uint64_t key = 0;
+  uint8_t contextFilters;
+  if (contextFiltersCache) {
+    key = contextFiltersCache->hash("", 0, request.contextOption,
+        request.contextDomain, request.contextDomainLen);
+    if (contextFiltersCache->findValue(key, &contextFilters)) {
+      return contextFilters;
+    }
+  }
+  contextFilters = 0;
+  if (hasUrlDependentFilters(noFingerprintFilters, numNoFingerprintFilters,
+        &noFingerprintFilterOptionIndex, request) ||
+      hasUrlDependentFilters(filters, numFilters, &filterOptionIndex,
+        request) ||
+      hasUrlDependentFilters(noFingerprintDomainOnlyFilters,
+        numNoFingerprintDomainOnlyFilters,
+        &noFingerprintDomainOnlyFilterOptionIndex, request) ||
+      hasUrlDependentFilters(noFingerprintAntiDomainOnlyFilters,
+        numNoFingerprintAntiDomainOnlyFilters,
+        &noFingerprintAntiDomainOnlyFilterOptionIndex, request)) {
+    contextFilters |= CFBlock;
+  }
+  if (hasUrlDependentFilters(noFingerprintExceptionFilters,
+        numNoFingerprintExceptionFilters,
+        &noFingerprintExceptionFilterOptionIndex, request) ||
+      hasUrlDependentFilters(exceptionFilters, numExceptionFilters,
+        &exceptionFilterOptionIndex, request) ||
+      hasUrlDependentFilters(noFingerprintDomainOnlyExceptionFilters,
+        numNoFingerprintDomainOnlyExceptionFilters,
+        &noFingerprintDomainOnlyExceptionFilterOptionIndex, request) ||
+      hasUrlDependentFilters(noFingerprintAntiDomainOnlyExceptionFilters,
+        numNoFingerprintAntiDomainOnlyExceptionFilters,
+        &noFingerprintAntiDomainOnlyExceptionFilterOptionIndex, request)) {
+    contextFilters |= CFException;
+  }
+  if (contextFiltersCache) {
+    contextFiltersCache->addValue(key, contextFilters);
+  }
+  return contextFilters;
+}
+
+// Host only filters match every URL of a host or none of them.  A matching
+// host only block filter blocks every URL of the host whatever else could
+// match, unless an exception filter could allow one of them, and a matching
+// host only exception filter allows the host whatever else could match.
+// Without either, nothing is blocked on the host if no block filter could
+// accept the request.  Only the host indexed filters stored under the host
+// are looked at here, the other lists are summed up once per context.
+HostDecision AdBlockClient::findHostDecision(const MatchRequest &request) {
+  if (!hostAnchoredPostings || !hostAnchoredExceptionPostings) {
+    return HDCheckUrl;
+  }
+  FingerprintPostings *found[MatchRequest::kMaxDomainLabels];
+  int numFound = findHostAnchoredPostings(request,
+      hostAnchoredExceptionPostings, hostSuffixTrie,
+      HostSuffixTrie::kHostAnchoredException, found);
+  bool urlDependentException = false;
+  for (int i = 0; i < numFound; i++) {
+    for (int j = 0; j < found[i]->numFilterIds; j++) {
+      const Filter &filter =
+        hostAnchoredExceptionFilters[found[i]->filterIds[j]];
+      if (!filter.matchesOptions(request)) {
+        continue;
+      }
+      if (!(filter.filterType & FTHostOnly)) {
+        urlDependentException = true;
+      } else if (filter.matches(request)) {
+        return HDAllow;
+      }
+    }
+  }
+
+  bool urlDependentFilter = false;
+  bool hostOnlyMatch = false;
+  numFound = findHostAnchoredPostings(request, hostAnchoredPostings,
+      hostSuffixTrie, HostSuffixTrie::kHostAnchored, found);
+  for (int i = 0; i < numFound; i++) {
+    for (int j = 0; j < found[i]->numFilterIds; j++) {
+      const Filter &filter = hostAnchoredFilters[found[i]->filterIds[j]];
+      if (!filter.matchesOptions(request)) {
+        continue;
+      }
+      if (!(filter.filterType & FTHostOnly)) {
+        urlDependentFilter = true;
+      } else {
+        hostOnlyMatch = hostOnlyMatch || filter.matches(request);
+      }
+    }
+  }
+
+  const uint8_t contextFilters = findContextFilters(request);
+  if (hostOnlyMatch) {
+    return urlDependentException || (contextFilters & CFException) ?
+      HDCheckUrl : HDBlock;
+  }
+  return urlDependentFilter || (contextFilters & CFBlock) ?
+    HDCheckUrl : HDAllow;
+}
+
+HostDecision AdBlockClient::findCachedHostDecision(
+    const MatchRequest &request) {
+  const uint64_t key = hostDecisionCache->hash(request.host, request.hostLen,
+      request.contextOption, request.contextDomain,
+      request.contextDomainLen);
+  uint8_t value;
+  if (hostDecisionCache->findValue(key, &value)) {
+    return static_cast<HostDecision>(value);
+  }
+  const HostDecision decision = findHostDecision(request);
+  hostDecisionCache->addValue(key, decision);
+  return decision;
+}
+
+namespace {
+
+// A blockable URL of a batch.  The items are sorted so that URLs with the
+// same host are checked one after the other, and so that repeats of the
+// same URL and option are next to each other.  |host| is lowercased like
+// the host of the URL's MatchRequest, which is what the shared lookups are
+// for.
+struct BatchItem {
+  const char *input;
+  int inputLen;
+  const char *host;
+  int hostLen;
+  FilterOption option;
+  size_t index;
+};
+
+}  // namespace
+
+static bool isSameHost(const BatchItem &lhs, const BatchItem &rhs) {
+  return lhs.hostLen == rhs.hostLen &&
+    !memcmp(lhs.host, rhs.host, lhs.hostLen);
+}
+
+static bool isSameRequest(const BatchItem &lhs, const BatchItem &rhs) {
+  return lhs.option == rhs.option && lhs.inputLen == rhs.inputLen &&
+    !memcmp(lhs.input, rhs.input, lhs.inputLen);
+}
+
+static int compareBatchItems(const void *a, const void *b) {
+  const BatchItem *lhs = static_cast<const BatchItem *>(a);
+  const BatchItem *rhs = static_cast<const BatchItem *>(b);
+  if (lhs->hostLen != rhs->hostLen) {
+    return lhs->hostLen < rhs->hostLen ? -1 : 1;
+  }
+  int result = memcmp(lhs->host, rhs->host, lhs->hostLen);
+  if (result) {
+    return result;
+  }
+  if (lhs->inputLen != rhs->inputLen) {
+    return lhs->inputLen < rhs->inputLen ? -1 : 1;
+  }
+  result = memcmp(lhs->input, rhs->input, lhs->inputLen);
+  if (result) {
+    return result;
+  }
+  if (lhs->option != rhs->option) {
+    return lhs->option < rhs->option ? -1 : 1;
+  }
+  // Keep the batch order for everything else
+  return lhs->index < rhs->index ? -1 : lhs->index > rhs->index;
+}
+
+void AdBlockClient::matchesBatch(const char **urls, const int *lens,
+    const FilterOption *opts, const char *contextDomain, bool *out,
+    size_t n) {
+  if (n == 0) {
+    return;
+  }
+  int contextDomainLen =
+    contextDomain ? static_cast<int>(strlen(contextDomain)) : 0;
+
+  BatchItem *items = new BatchItem[n];
+  size_t numItems = 0;
+  int hostsLen = 0;
+  for (size_t i = 0; i < n; i++) {
+    out[i] = false;
+    int inputLen = lens ? lens[i] : static_cast<int>(strlen(urls[i]));
+    if (!isBlockableProtocol(urls[i], inputLen)) {
+      continue;
+    }
+    BatchItem &item = items[numItems++];
+    item.input = urls[i];
+    item.inputLen = inputLen;
+    item.host = getUrlHost(urls[i], inputLen, &item.hostLen);
+    item.option = opts ? opts[i] : FONoFilterOption;
+    item.index = i;
+    hostsLen += item.hostLen;
+  }
+  // Hosts which only differ in case share their lookups
+  char *hosts = new char[hostsLen > 0 ? hostsLen : 1];
+  char *nextHost = hosts;
+  for (size_t i = 0; i < numItems; i++) {
+    lowercaseAscii(items[i].host, items[i].hostLen, nextHost);
+    items[i].host = nextHost;
+    nextHost += items[i].hostLen;
+  }
+  qsort(items, numItems, sizeof(BatchItem), compareBatchItems);
+
+  // Only the context domain filters of a page context, $document exceptions
+  // aren't applied, the same as matches() with a context domain.
+  PageContext pageContext;
+  initContextDomainFilters(contextDomain, &pageContext);
+  HostLookups hostLookups;
+  for (size_t i = 0; i < numItems; i++) {
+    const BatchItem &item = items[i];
+    if (i > 0 && isSameRequest(items[i - 1], item)) {
+      out[item.index] = out[items[i - 1].index];
+      continue;
+    }
+    if (i > 0 && !isSameHost(items[i - 1], item)) {
+      hostLookups.reset();
+    }
+    MatchRequest request(item.input, item.inputLen, item.option,
+        contextDomain, contextDomainLen);
+    out[item.index] = matches(request, &pageContext, &hostLookups);
+  }
+  delete[] items;
+  delete[] hosts;
+}
+
+void AdBlockClient::addMatchingFilters(Filter *filter, int numFilters,
+    const FilterOptionIndex *optionIndex,
+    const MatchRequest &request,
+    std::vector<Filter *> *found,
+    const NoFingerprintMatcher *matcher) {
+  uint64_t candidates[NoFingerprintMatcher::kMaxWords];
+  const uint64_t *bitmap = findFiltersToVisit(numFilters, optionIndex,
+      matcher, request, candidates);
+  for (int i = 0; i < numFilters; i++) {
+    if (bitmap && !(bitmap[i / 64] >> (i % 64) & 1)) {
+      continue;
+    }
+    if (filter[i].matches(request)) {
+      found->push_back(filter + i);
+    }
+  }
+}
+
+void AdBlockClient::addMatchingFingerprintFilters(Filter *filter,
+    int numFilters,
+    const FingerprintAutomaton &automaton,
+    HashSet<FingerprintPostings> *postings,
+    BloomFilter *bloomFilter,
+    const FilterOptionIndex *optionIndex,
+    const MatchRequest &request,
+    std::vector<Filter *> *found) {
+  const int firstFingerprint = findFirstFingerprint(automaton, postings,
+      bloomFilter, request);
+  if (firstFingerprint == -1) {
+    return;
+  }
+  if (!automaton.isBuilt() && !postings) {
+    addMatchingFilters(filter, numFilters, optionIndex, request, found);
+    return;
+  }
+  const uint64_t *bitmap = optionIndex ?
+    optionIndex->find(request.contextOption, numFilters) : nullptr;
+
+  // Each filter is in the filter ids of its own fingerprint only, so
+  // checking each list of ids once checks each filter once.
+  std::vector<const int *> checkedPostings;
+  int state = FingerprintAutomaton::kRootState;
+  for (int i = firstFingerprint; i < request.inputLen; i++) {
+    const int *filterIds;
+    int numFilterIds;
+    if (automaton.isBuilt()) {
+      state = automaton.next(state, request.input[i]);
+      filterIds = automaton.filterIds(state, &numFilterIds);
+    } else {
+      if (i + kFingerprintSize > request.inputLen) {
+        break;
+      }
+      FingerprintPostings *fingerprintPostings =
+        postings->Find(FingerprintPostings(request.input + i,
+              kFingerprintSize));
+      filterIds = fingerprintPostings ? fingerprintPostings->filterIds :
+        nullptr;
+      numFilterIds = fingerprintPostings ? fingerprintPostings->numFilterIds :
+        0;
+    }
+    if (!filterIds ||
+        std::find(checkedPostings.begin(), checkedPostings.end(),
+          filterIds) != checkedPostings.end()) {
+      continue;
+    }
+    checkedPostings.push_back(filterIds);
+    for (int j = 0; j < numFilterIds; j++) {
+      const int filterId = filterIds[j];
+      if (bitmap && !(bitmap[filterId / 64] >> (filterId % 64) & 1)) {
+        continue;
+      }
+      if (filter[filterId].matches(request)) {
+        found->push_back(filter + filterId);
+      }
+    }
+  }
+}
+
+void AdBlockClient::addMatchingDomainFilters(Filter *filter, int numFilters,
+    HashSet<FingerprintPostings> *postings, uint8_t flag, bool antiDomains,
+    const FilterOptionIndex *optionIndex, const MatchRequest &request,
+    std::vector<Filter *> *found) {
+  if (!postings) {
+    addMatchingFilters(filter, numFilters, optionIndex, request, found);
+    return;
+  }
+  FingerprintPostings *domainPostings[MatchRequest::kMaxDomainLabels];
+  const int numDomainPostings = findDomainPostings(request, postings,
+      hostSuffixTrie, flag, domainPostings);
+  const uint64_t *bitmap = optionIndex ?
+    optionIndex->find(request.contextOption, numFilters) : nullptr;
+  // Going through the list in order adds a filter once even when it is
+  // stored under more than one suffix of the context domain.
+  for (int i = 0; i < numFilters; i++) {
+    if (bitmap && !(bitmap[i / 64] >> (i % 64) & 1)) {
+      continue;
+    }
+    if (isInPostings(domainPostings, numDomainPostings, i) != !antiDomains) {
+      continue;
+    }
+    if (filter[i].matches(request, false)) {
+      found->push_back(filter + i);
+    }
+  }
+}
+
+void AdBlockClient::addMatchingHostAnchoredFilters(Filter *filter,
+    HashSet<FingerprintPostings> *postings,
+    uint8_t flag,
+    const MatchRequest &request,
+    std::vector<Filter *> *found) {
+  if (!postings) {
+    return;
+  }
+  FingerprintPostings *hostPostings[MatchRequest::kMaxDomainLabels];
+  int numHostPostings = findHostAnchoredPostings(request, postings,
+      hostSuffixTrie, flag, hostPostings);
+  for (int i = 0; i < numHostPostings; i++) {
+    for (int j = 0; j < hostPostings[i]->numFilterIds; j++) {
+      Filter *candidate = filter + hostPostings[i]->filterIds[j];
+      if (candidate->matches(request)) {
+        found->push_back(candidate);
+      }
+    }
+  }
+}
+
+bool AdBlockClient::findMatchingFilters(const char *input,
+    FilterOption contextOption,
+    const char *contextDomain,
+    Filter **matchingFilter,
+    Filter **matchingExceptionFilter) {
+  MatchRequest request(input, static_cast<int>(strlen(input)),
+      contextOption, contextDomain,
+      contextDomain ? static_cast<int>(strlen(contextDomain)) : 0);
+  return findMatchingFilters(request, matchingFilter,
+      matchingExceptionFilter);
+}
+
 /**
  * Obtains the first matching filter or nullptr, and if one is found, finds
- * the first matching exception filter or nullptr.
+ * the first matching exception filter or nullptr.  Lists are skipped with
+ * the same bloom filters and hash sets as matches(), so this only costs
+ * more than matches() when a filter matches.
  *
  * @return true if the filter should be blocked
  */
-bool AdBlockClient::findMatchingFilters(const char *input,
-    FilterOption contextOption,
-    const char *contextDomain,
+bool AdBlockClient::findMatchingFilters(const MatchRequest &request,
     Filter **matchingFilter,
     Filter **matchingExceptionFilter) {
   *matchingFilter = nullptr;
   *matchingExceptionFilter = nullptr;
-  int inputLen = static_cast<int>(strlen(input));
-  int inputHostLen;
-  const char *inputHost = getUrlHost(input, &inputHostLen);
-
-  int contextDomainLen = 0;
-  if (contextDomain) {
-    contextDomainLen = static_cast<int>(strlen(contextDomain));
-    if (isThirdPartyHost(contextDomain, contextDomainLen,
-        inputHost, static_cast<int>(inputHostLen))) {
-      contextOption =
-        static_cast<FilterOption>(contextOption | FOThirdParty);
-    } else {
-      contextOption =
-        static_cast<FilterOption>(contextOption | FONotThirdParty);
-    }
-  }
 
   hasMatchingFilters(noFingerprintFilters,
-    numNoFingerprintFilters, input, inputLen, contextOption,
-    contextDomain, nullptr,
-    inputHost, inputHostLen, matchingFilter);
+    numNoFingerprintFilters,
+    &noFingerprintFilterOptionIndex, request, matchingFilter,
+    &noFingerprintMatcher);
 
   if (!*matchingFilter) {
-    hasMatchingFilters(noFingerprintDomainOnlyFilters,
-      numNoFingerprintDomainOnlyFilters, input, inputLen, contextOption,
-      contextDomain, nullptr,
-      inputHost, inputHostLen, matchingFilter);
+    hasMatchingDomainFilters(noFingerprintDomainOnlyFilters,
+      numNoFingerprintDomainOnlyFilters, noFingerprintDomainPostings,
+      HostSuffixTrie::kNoFingerprintDomain, false,
+      &noFingerprintDomainOnlyFilterOptionIndex, request, matchingFilter);
   }
   if (!*matchingFilter) {
-    hasMatchingFilters(noFingerprintAntiDomainOnlyFilters,
-      numNoFingerprintAntiDomainOnlyFilters, input, inputLen, contextOption,
-      contextDomain, nullptr,
-      inputHost, inputHostLen, matchingFilter);
+    hasMatchingDomainFilters(noFingerprintAntiDomainOnlyFilters,
+      numNoFingerprintAntiDomainOnlyFilters, noFingerprintAntiDomainPostings,
+      HostSuffixTrie::kNoFingerprintAntiDomain, true,
+      &noFingerprintAntiDomainOnlyFilterOptionIndex, request, matchingFilter);
   }
 
   if (!*matchingFilter) {
-    hasMatchingFilters(filters,
-      numFilters, input, inputLen, contextOption,
-      contextDomain, nullptr,
-      inputHost, inputHostLen, matchingFilter);
+    int firstFingerprint = findFirstFingerprint(fingerprintAutomaton,
+        fingerprintPostings, bloomFilter, request);
+    if (firstFingerprint != -1) {
+      hasMatchingFingerprintFilters(filters, numFilters, fingerprintAutomaton,
+          fingerprintPostings, &filterOptionIndex, request, matchingFilter,
+          firstFingerprint);
+    }
   }
 
   if (!*matchingFilter) {
-    isHostAnchoredHashSetMiss(input, inputLen,
-      hostAnchoredHashSet, inputHost, inputHostLen,
-      contextOption, contextDomain, matchingFilter);
+    isHostAnchoredPostingsMiss(request, hostAnchoredFilters,
+        hostAnchoredPostings, hostSuffixTrie, HostSuffixTrie::kHostAnchored,
+        matchingFilter);
   }
 
   if (!*matchingFilter) {
@@ -977,43 +1940,118 @@ bool AdBlockClient::findMatchingFilters(const char *input,
   }
 
   hasMatchingFilters(noFingerprintExceptionFilters,
-    numNoFingerprintExceptionFilters, input, inputLen, contextOption,
-    contextDomain,
-    nullptr, inputHost, inputHostLen, matchingExceptionFilter);
+    numNoFingerprintExceptionFilters,
+    &noFingerprintExceptionFilterOptionIndex, request, matchingExceptionFilter,
+    &noFingerprintExceptionMatcher);
 
   if (!*matchingExceptionFilter) {
-    hasMatchingFilters(noFingerprintDomainOnlyExceptionFilters,
-      numNoFingerprintDomainOnlyExceptionFilters, input, inputLen,
-      contextOption, contextDomain, nullptr, inputHost, inputHostLen,
+    hasMatchingDomainFilters(noFingerprintDomainOnlyExceptionFilters,
+      numNoFingerprintDomainOnlyExceptionFilters,
+      noFingerprintDomainExceptionPostings,
+      HostSuffixTrie::kNoFingerprintDomainException, false,
+      &noFingerprintDomainOnlyExceptionFilterOptionIndex, request,
       matchingExceptionFilter);
   }
 
   if (!*matchingExceptionFilter) {
-    hasMatchingFilters(noFingerprintAntiDomainOnlyExceptionFilters,
-      numNoFingerprintAntiDomainOnlyExceptionFilters, input, inputLen,
-      contextOption, contextDomain, nullptr, inputHost, inputHostLen,
+    hasMatchingDomainFilters(noFingerprintAntiDomainOnlyExceptionFilters,
+      numNoFingerprintAntiDomainOnlyExceptionFilters,
+      noFingerprintAntiDomainExceptionPostings,
+      HostSuffixTrie::kNoFingerprintAntiDomainException, true,
+      &noFingerprintAntiDomainOnlyExceptionFilterOptionIndex, request,
       matchingExceptionFilter);
   }
 
   if (!*matchingExceptionFilter) {
-    isHostAnchoredHashSetMiss(input, inputLen, hostAnchoredExceptionHashSet,
-        inputHost, inputHostLen, contextOption, contextDomain,
-        matchingExceptionFilter);
+    isHostAnchoredPostingsMiss(request, hostAnchoredExceptionFilters,
+        hostAnchoredExceptionPostings, hostSuffixTrie,
+        HostSuffixTrie::kHostAnchoredException, matchingExceptionFilter);
   }
 
   if (!*matchingExceptionFilter) {
-    hasMatchingFilters(exceptionFilters,
-      numExceptionFilters, input, inputLen, contextOption,
-      contextDomain,
-      nullptr, inputHost, inputHostLen, matchingExceptionFilter);
+    int firstExceptionFingerprint = findFirstFingerprint(
+        exceptionFingerprintAutomaton, exceptionFingerprintPostings,
+        exceptionBloomFilter, request);
+    if (firstExceptionFingerprint != -1) {
+      hasMatchingFingerprintFilters(exceptionFilters, numExceptionFilters,
+          exceptionFingerprintAutomaton, exceptionFingerprintPostings,
+          &exceptionFilterOptionIndex, request, matchingExceptionFilter,
+          firstExceptionFingerprint);
+    }
   }
   return !*matchingExceptionFilter;
 }
 
+bool AdBlockClient::findAllMatchingFilters(const char *input,
+    FilterOption contextOption,
+    const char *contextDomain,
+    std::vector<Filter *> *matchingFilters,
+    std::vector<Filter *> *matchingExceptionFilters) {
+  MatchRequest request(input, static_cast<int>(strlen(input)),
+      contextOption, contextDomain,
+      contextDomain ? static_cast<int>(strlen(contextDomain)) : 0);
+  return findAllMatchingFilters(request, matchingFilters,
+      matchingExceptionFilters);
+}
+
+bool AdBlockClient::findAllMatchingFilters(const MatchRequest &request,
+    std::vector<Filter *> *matchingFilters,
+    std::vector<Filter *> *matchingExceptionFilters) {
+  matchingFilters->clear();
+  matchingExceptionFilters->clear();
+
+  addMatchingFilters(noFingerprintFilters, numNoFingerprintFilters,
+      &noFingerprintFilterOptionIndex, request, matchingFilters,
+      &noFingerprintMatcher);
+  addMatchingDomainFilters(noFingerprintDomainOnlyFilters,
+      numNoFingerprintDomainOnlyFilters, noFingerprintDomainPostings,
+      HostSuffixTrie::kNoFingerprintDomain, false,
+      &noFingerprintDomainOnlyFilterOptionIndex, request, matchingFilters);
+  addMatchingDomainFilters(noFingerprintAntiDomainOnlyFilters,
+      numNoFingerprintAntiDomainOnlyFilters, noFingerprintAntiDomainPostings,
+      HostSuffixTrie::kNoFingerprintAntiDomain, true,
+      &noFingerprintAntiDomainOnlyFilterOptionIndex, request,
+      matchingFilters);
+  addMatchingFingerprintFilters(filters, numFilters, fingerprintAutomaton,
+      fingerprintPostings, bloomFilter, &filterOptionIndex, request,
+      matchingFilters);
+  addMatchingHostAnchoredFilters(hostAnchoredFilters, hostAnchoredPostings,
+      HostSuffixTrie::kHostAnchored, request, matchingFilters);
+
+  // Exceptions are looked for even when nothing is blocked so that rules
+  // which would allow a request can be checked too.
+  addMatchingFilters(noFingerprintExceptionFilters,
+      numNoFingerprintExceptionFilters,
+      &noFingerprintExceptionFilterOptionIndex, request,
+      matchingExceptionFilters, &noFingerprintExceptionMatcher);
+  addMatchingDomainFilters(noFingerprintDomainOnlyExceptionFilters,
+      numNoFingerprintDomainOnlyExceptionFilters,
+      noFingerprintDomainExceptionPostings,
+      HostSuffixTrie::kNoFingerprintDomainException, false,
+      &noFingerprintDomainOnlyExceptionFilterOptionIndex, request,
+      matchingExceptionFilters);
+  addMatchingDomainFilters(noFingerprintAntiDomainOnlyExceptionFilters,
+      numNoFingerprintAntiDomainOnlyExceptionFilters,
+      noFingerprintAntiDomainExceptionPostings,
+      HostSuffixTrie::kNoFingerprintAntiDomainException, true,
+      &noFingerprintAntiDomainOnlyExceptionFilterOptionIndex, request,
+      matchingExceptionFilters);
+  addMatchingHostAnchoredFilters(hostAnchoredExceptionFilters,
+      hostAnchoredExceptionPostings, HostSuffixTrie::kHostAnchoredException,
+      request, matchingExceptionFilters);
+  addMatchingFingerprintFilters(exceptionFilters, numExceptionFilters,
+      exceptionFingerprintAutomaton, exceptionFingerprintPostings,
+      exceptionBloomFilter,
+      &exceptionFilterOptionIndex, request, matchingExceptionFilters);
+
+  return !matchingFilters->empty() && matchingExceptionFilters->empty();
+}
+
 void AdBlockClient::initBloomFilter(BloomFilter **pp,
     const char *buffer, int len) {
   if (*pp) {
     delete *pp;
+    *pp = nullptr;
   }
   if (len > 0) {
     *pp = new BloomFilter(buffer, len);
@@ -1024,6 +2062,7 @@ template<class T>
 bool AdBlockClient::initHashSet(HashSet<T> **pp, char *buffer, int len) {
   if (*pp) {
     delete *pp;
+    *pp = nullptr;
   }
   if (len > 0) {
     *pp = new HashSet<T>(0, false);
@@ -1043,6 +2082,17 @@ void setFilterBorrowedMemory(Filter *filters, int numFilters) {
 // Parses the filter data into a few collections of filters and enables
 // efficent querying.
 bool AdBlockClient::parse(const char *input, bool preserveRules) {
+  // Page contexts built before refer to the old filter ids
+  filterGeneration++;
+  if (matchCache) {
+    matchCache->clear();
+  }
+  if (hostDecisionCache) {
+    hostDecisionCache->clear();
+    contextFiltersCache->clear();
+  }
+  // Filter ids are about to change
+  stopFilterHitCounting();
   // If the user is parsing and we have regex support,
   // then we can determine the fingerprints for the bloom filter.
   // Otherwise it needs to be done manually via initBloomFilter and
@@ -1053,30 +2103,50 @@ bool AdBlockClient::parse(const char *input, bool preserveRules) {
   if (!exceptionBloomFilter) {
     exceptionBloomFilter = new BloomFilter(10, 20000);
   }
-  if (!hostAnchoredHashSet) {
+  // The trie has to have every host which is in the postings below, so it
+  // can only be started along with them.
+  if (!hostAnchoredPostings && !hostAnchoredExceptionPostings &&
+      !noFingerprintDomainPostings && !noFingerprintAntiDomainPostings &&
+      !noFingerprintDomainExceptionPostings &&
+      !noFingerprintAntiDomainExceptionPostings) {
+    hostSuffixTrie.init();
+  }
+  if (!hostAnchoredPostings) {
     // Optimized to be 1:1 with the easylist / easyprivacy
     // number of host anchored hosts.
-    hostAnchoredHashSet = new HashSet<Filter>(18000, false);
+    hostAnchoredPostings = new HashSet<FingerprintPostings>(18000, false);
   }
-  if (!hostAnchoredExceptionHashSet) {
+  if (!hostAnchoredExceptionPostings) {
     // Optimized to be 1:1 with the easylist / easyprivacy
     // number of host anchored exception hosts.
-    hostAnchoredExceptionHashSet = new HashSet<Filter>(2000, false);
+    hostAnchoredExceptionPostings =
+      new HashSet<FingerprintPostings>(2000, false);
   }
-  if (!noFingerprintDomainHashSet) {
-    noFingerprintDomainHashSet = new HashSet<NoFingerprintDomain>(1000, false);
+  if (!noFingerprintDomainPostings) {
+    noFingerprintDomainPostings = new HashSet<FingerprintPostings>(1000, false);
   }
-  if (!noFingerprintAntiDomainHashSet) {
-    noFingerprintAntiDomainHashSet =
-      new HashSet<NoFingerprintDomain>(100, false);
+  if (!noFingerprintAntiDomainPostings) {
+    noFingerprintAntiDomainPostings =
+      new HashSet<FingerprintPostings>(100, false);
   }
-  if (!noFingerprintDomainExceptionHashSet) {
-    noFingerprintDomainExceptionHashSet =
-      new HashSet<NoFingerprintDomain>(1000, false);
+  if (!noFingerprintDomainExceptionPostings) {
+    noFingerprintDomainExceptionPostings =
+      new HashSet<FingerprintPostings>(1000, false);
   }
-  if (!noFingerprintAntiDomainExceptionHashSet) {
-    noFingerprintAntiDomainExceptionHashSet =
-      new HashSet<NoFingerprintDomain>(100, false);
+  if (!noFingerprintAntiDomainExceptionPostings) {
+    noFingerprintAntiDomainExceptionPostings =
+      new HashSet<FingerprintPostings>(100, false);
+  }
+  // Filters which are already loaded without postings can't be indexed, so
+  // those lists keep being checked linearly.
+  if (!fingerprintPostings && numFilters == 0) {
+    // Optimized to be about 1:1 with the easylist / easyprivacy
+    // number of distinct fingerprints.
+    fingerprintPostings = new HashSet<FingerprintPostings>(20000, false);
+  }
+  if (!exceptionFingerprintPostings && numExceptionFilters == 0) {
+    exceptionFingerprintPostings =
+      new HashSet<FingerprintPostings>(3000, false);
   }
 
   const char *p = input;
@@ -1105,11 +2175,12 @@ bool AdBlockClient::parse(const char *input, bool preserveRules) {
   while (true) {
     if (isEndOfLine(*p) || *p == '\0') {
       Filter f;
-      parseFilter(lineStart, p, &f);
+      // Only counted here, the filters are compiled when they're stored
+      parseFilter(lineStart, p, &f, nullptr, nullptr, nullptr, false, false);
       if (!f.hasUnsupportedOptions()) {
         switch (f.filterType & FTListTypesMask) {
           case FTException:
-            if (f.filterType & FTHostOnly) {
+            if (isHostIndexedFilter(&f)) {
               newNumHostAnchoredExceptionFilters++;
             } else if (AdBlockClient::getFingerprint(nullptr, f)) {
               newNumExceptionFilters++;
@@ -1135,7 +2206,7 @@ bool AdBlockClient::parse(const char *input, bool preserveRules) {
             // No need to store comments
             break;
           default:
-            if (f.filterType & FTHostOnly) {
+            if (isHostIndexedFilter(&f)) {
               newNumHostAnchoredFilters++;
             } else if (AdBlockClient::getFingerprint(nullptr, f)) {
               newNumFilters++;
@@ -1207,6 +2278,11 @@ bool AdBlockClient::parse(const char *input, bool preserveRules) {
   Filter *newNoFingerprintAntiDomainOnlyExceptionFilters =
     new Filter[newNumNoFingerprintAntiDomainOnlyExceptionFilters
     + numNoFingerprintAntiDomainOnlyExceptionFilters];
+  Filter *newHostAnchoredFilters =
+    new Filter[newNumHostAnchoredFilters + numHostAnchoredFilters];
+  Filter *newHostAnchoredExceptionFilters =
+    new Filter[newNumHostAnchoredExceptionFilters +
+    numHostAnchoredExceptionFilters];
 
   Filter *curFilters = newFilters;
   Filter *curCosmeticFilters = newCosmeticFilters;
@@ -1221,6 +2297,8 @@ bool AdBlockClient::parse(const char *input, bool preserveRules) {
     newNoFingerprintDomainOnlyExceptionFilters;
   Filter *curNoFingerprintAntiDomainOnlyExceptionFilters =
     newNoFingerprintAntiDomainOnlyExceptionFilters;
+  Filter *curHostAnchoredFilters = newHostAnchoredFilters;
+  Filter *curHostAnchoredExceptionFilters = newHostAnchoredExceptionFilters;
 
   // If we've had a parse before copy the old data into the new data structure
   if (filters || cosmeticFilters || htmlFilters || exceptionFilters ||
@@ -1228,7 +2306,8 @@ bool AdBlockClient::parse(const char *input, bool preserveRules) {
       noFingerprintDomainOnlyFilters ||
       noFingerprintDomainOnlyExceptionFilters ||
       noFingerprintAntiDomainOnlyFilters ||
-      noFingerprintAntiDomainOnlyExceptionFilters) {
+      noFingerprintAntiDomainOnlyExceptionFilters ||
+      hostAnchoredFilters || hostAnchoredExceptionFilters) {
 
     // Copy the old data in, we can't simply use memcpy here
     // since filtres manages some pointers that get deleted.
@@ -1262,6 +2341,15 @@ bool AdBlockClient::parse(const char *input, bool preserveRules) {
     for (int i = 0; i < numNoFingerprintAntiDomainOnlyExceptionFilters; i++) {
       newNoFingerprintAntiDomainOnlyExceptionFilters[i].swapData(&(noFingerprintAntiDomainOnlyExceptionFilters[i]));
     }
+    // The host anchored filters keep their ids since the new ones go after
+    // them, so their postings stay valid.
+    for (int i = 0; i < numHostAnchoredFilters; i++) {
+      newHostAnchoredFilters[i].swapData(&(hostAnchoredFilters[i]));
+    }
+    for (int i = 0; i < numHostAnchoredExceptionFilters; i++) {
+      newHostAnchoredExceptionFilters[i].swapData(
+          &(hostAnchoredExceptionFilters[i]));
+    }
 
     // Free up the old memory for filter storage
     // Set the old filter lists borrwedMemory to true since it'll be taken by
@@ -1281,6 +2369,9 @@ bool AdBlockClient::parse(const char *input, bool preserveRules) {
         numNoFingerprintDomainOnlyExceptionFilters);
     setFilterBorrowedMemory(noFingerprintAntiDomainOnlyExceptionFilters,
         numNoFingerprintAntiDomainOnlyExceptionFilters);
+    setFilterBorrowedMemory(hostAnchoredFilters, numHostAnchoredFilters);
+    setFilterBorrowedMemory(hostAnchoredExceptionFilters,
+        numHostAnchoredExceptionFilters);
     delete[] filters;
     delete[] cosmeticFilters;
     delete[] htmlFilters;
@@ -1291,6 +2382,8 @@ bool AdBlockClient::parse(const char *input, bool preserveRules) {
     delete[] noFingerprintAntiDomainOnlyFilters;
     delete[] noFingerprintDomainOnlyExceptionFilters;
     delete[] noFingerprintAntiDomainOnlyExceptionFilters;
+    delete[] hostAnchoredFilters;
+    delete[] hostAnchoredExceptionFilters;
 
     // Adjust the current pointers to be just after the copied in data
     curFilters += numFilters;
@@ -1306,6 +2399,8 @@ bool AdBlockClient::parse(const char *input, bool preserveRules) {
       numNoFingerprintDomainOnlyExceptionFilters;
     curNoFingerprintAntiDomainOnlyExceptionFilters +=
       numNoFingerprintAntiDomainOnlyExceptionFilters;
+    curHostAnchoredFilters += numHostAnchoredFilters;
+    curHostAnchoredExceptionFilters += numHostAnchoredExceptionFilters;
   }
 
   // And finally update with the new counts
@@ -1338,34 +2433,54 @@ bool AdBlockClient::parse(const char *input, bool preserveRules) {
     newNoFingerprintDomainOnlyExceptionFilters;
   noFingerprintAntiDomainOnlyExceptionFilters =
     newNoFingerprintAntiDomainOnlyExceptionFilters;
+  hostAnchoredFilters = newHostAnchoredFilters;
+  hostAnchoredExceptionFilters = newHostAnchoredExceptionFilters;
 
   p = input;
   lineStart = p;
 
+  char fingerprintBuffer[kFingerprintSize + 1];
   while (true) {
     if (isEndOfLine(*p) || *p == '\0') {
       Filter f;
       parseFilter(lineStart, p, &f, bloomFilter, exceptionBloomFilter,
-          hostAnchoredHashSet,
-          hostAnchoredExceptionHashSet,
           &simpleCosmeticFilters,
           preserveRules);
       if (!f.hasUnsupportedOptions()) {
         switch (f.filterType & FTListTypesMask) {
           case FTException:
-            if (f.filterType & FTHostOnly) {
-              // do nothing, handled by hash set.
-            } else if (AdBlockClient::getFingerprint(nullptr, f)) {
+            if (isHostIndexedFilter(&f)) {
+              addHostAnchoredFilter(&f, hostAnchoredExceptionPostings,
+                  &hostSuffixTrie, HostSuffixTrie::kHostAnchoredException,
+                  static_cast<int>(curHostAnchoredExceptionFilters -
+                    hostAnchoredExceptionFilters));
+              (*curHostAnchoredExceptionFilters).swapData(&f);
+              curHostAnchoredExceptionFilters++;
+            } else if (AdBlockClient::getFingerprint(fingerprintBuffer, f)) {
+              if (exceptionFingerprintPostings) {
+                exceptionFingerprintPostings->Add(FingerprintPostings(
+                      fingerprintBuffer, kFingerprintSize,
+                      static_cast<int>(curExceptionFilters -
+                        exceptionFilters)));
+              }
               (*curExceptionFilters).swapData(&f);
               curExceptionFilters++;
             } else if (f.isDomainOnlyFilter()) {
-              AddFilterDomainsToHashSet(&f,
-                  noFingerprintDomainExceptionHashSet);
+              addFilterDomains(&f, noFingerprintDomainExceptionPostings,
+                  &hostSuffixTrie,
+                  HostSuffixTrie::kNoFingerprintDomainException,
+                  static_cast<int>(
+                    curNoFingerprintDomainOnlyExceptionFilters -
+                    noFingerprintDomainOnlyExceptionFilters));
               (*curNoFingerprintDomainOnlyExceptionFilters).swapData(&f);
               curNoFingerprintDomainOnlyExceptionFilters++;
             } else if (f.isAntiDomainOnlyFilter()) {
-              AddFilterDomainsToHashSet(&f,
-                  noFingerprintAntiDomainExceptionHashSet);
+              addFilterDomains(&f, noFingerprintAntiDomainExceptionPostings,
+                  &hostSuffixTrie,
+                  HostSuffixTrie::kNoFingerprintAntiDomainException,
+                  static_cast<int>(
+                    curNoFingerprintAntiDomainOnlyExceptionFilters -
+                    noFingerprintAntiDomainOnlyExceptionFilters));
               (*curNoFingerprintAntiDomainOnlyExceptionFilters).swapData(&f);
               curNoFingerprintAntiDomainOnlyExceptionFilters++;
             } else {
@@ -1387,19 +2502,33 @@ bool AdBlockClient::parse(const char *input, bool preserveRules) {
             // No need to store
             break;
           default:
-            if (f.filterType & FTHostOnly) {
-              // Do nothing
-            } else if (AdBlockClient::getFingerprint(nullptr, f)) {
+            if (isHostIndexedFilter(&f)) {
+              addHostAnchoredFilter(&f, hostAnchoredPostings, &hostSuffixTrie,
+                  HostSuffixTrie::kHostAnchored,
+                  static_cast<int>(curHostAnchoredFilters -
+                    hostAnchoredFilters));
+              (*curHostAnchoredFilters).swapData(&f);
+              curHostAnchoredFilters++;
+            } else if (AdBlockClient::getFingerprint(fingerprintBuffer, f)) {
+              if (fingerprintPostings) {
+                fingerprintPostings->Add(
+                    FingerprintPostings(fingerprintBuffer, kFingerprintSize,
+                      static_cast<int>(curFilters - filters)));
+              }
               (*curFilters).swapData(&f);
               curFilters++;
             } else if (f.isDomainOnlyFilter()) {
-              AddFilterDomainsToHashSet(&f,
-                  noFingerprintDomainHashSet);
+              addFilterDomains(&f, noFingerprintDomainPostings,
+                  &hostSuffixTrie, HostSuffixTrie::kNoFingerprintDomain,
+                  static_cast<int>(curNoFingerprintDomainOnlyFilters -
+                    noFingerprintDomainOnlyFilters));
               (*curNoFingerprintDomainOnlyFilters).swapData(&f);
               curNoFingerprintDomainOnlyFilters++;
             } else if (f.isAntiDomainOnlyFilter()) {
-              AddFilterDomainsToHashSet(&f,
-                  noFingerprintAntiDomainHashSet);
+              addFilterDomains(&f, noFingerprintAntiDomainPostings,
+                  &hostSuffixTrie, HostSuffixTrie::kNoFingerprintAntiDomain,
+                  static_cast<int>(curNoFingerprintAntiDomainOnlyFilters -
+                    noFingerprintAntiDomainOnlyFilters));
               (*curNoFingerprintAntiDomainOnlyFilters).swapData(&f);
               curNoFingerprintAntiDomainOnlyFilters++;
             } else {
@@ -1424,9 +2553,55 @@ bool AdBlockClient::parse(const char *input, bool preserveRules) {
     << simpleCosmeticFilters.GetSize() << endl;
 #endif
 
+  buildFilterOptionIndexes();
+  buildNoFingerprintMatchers();
+  if (fingerprintAutomatonEnabled) {
+    buildFingerprintAutomatons();
+  }
   return true;
 }
 
+void AdBlockClient::buildFilterOptionIndexes() {
+  filterOptionIndex.build(filters, numFilters);
+  exceptionFilterOptionIndex.build(exceptionFilters, numExceptionFilters);
+  noFingerprintFilterOptionIndex.build(noFingerprintFilters,
+      numNoFingerprintFilters);
+  noFingerprintExceptionFilterOptionIndex.build(noFingerprintExceptionFilters,
+      numNoFingerprintExceptionFilters);
+  noFingerprintDomainOnlyFilterOptionIndex.build(
+      noFingerprintDomainOnlyFilters, numNoFingerprintDomainOnlyFilters);
+  noFingerprintAntiDomainOnlyFilterOptionIndex.build(
+      noFingerprintAntiDomainOnlyFilters,
+      numNoFingerprintAntiDomainOnlyFilters);
+  noFingerprintDomainOnlyExceptionFilterOptionIndex.build(
+      noFingerprintDomainOnlyExceptionFilters,
+      numNoFingerprintDomainOnlyExceptionFilters);
+  noFingerprintAntiDomainOnlyExceptionFilterOptionIndex.build(
+      noFingerprintAntiDomainOnlyExceptionFilters,
+      numNoFingerprintAntiDomainOnlyExceptionFilters);
+}
+
+void AdBlockClient::buildFingerprintAutomatons() {
+  fingerprintAutomaton.build(filters, numFilters);
+  exceptionFingerprintAutomaton.build(exceptionFilters, numExceptionFilters);
+}
+
+void AdBlockClient::buildNoFingerprintMatchers() {
+  noFingerprintMatcher.build(noFingerprintFilters, numNoFingerprintFilters);
+  noFingerprintExceptionMatcher.build(noFingerprintExceptionFilters,
+      numNoFingerprintExceptionFilters);
+}
+
+void AdBlockClient::setFingerprintAutomatonEnabled(bool enabled) {
+  fingerprintAutomatonEnabled = enabled;
+  if (enabled) {
+    buildFingerprintAutomatons();
+  } else {
+    fingerprintAutomaton.clear();
+    exceptionFingerprintAutomaton.clear();
+  }
+}
+
 // Fills the specified buffer if specified, returns the number of characters
 // written or needed
 int serializeFilters(char * buffer, size_t bufferSizeAvail,
@@ -1482,56 +2657,99 @@ char * AdBlockClient::serialize(int *totalSize,
     ignoreCosmeticFilters ? 0 : numCosmeticFilters;
   int adjustedNumHtmlFilters = ignoreHtmlFilters ? 0 : numHtmlFilters;
 
-  uint32_t hostAnchoredHashSetSize = 0;
-  char *hostAnchoredHashSetBuffer = nullptr;
-  if (hostAnchoredHashSet) {
-    hostAnchoredHashSetBuffer =
-      hostAnchoredHashSet->Serialize(&hostAnchoredHashSetSize);
-  }
-
-  uint32_t hostAnchoredExceptionHashSetSize = 0;
-  char *hostAnchoredExceptionHashSetBuffer = nullptr;
-  if (hostAnchoredExceptionHashSet) {
-    hostAnchoredExceptionHashSetBuffer =
-      hostAnchoredExceptionHashSet->Serialize(
-          &hostAnchoredExceptionHashSetSize);
-  }
-
-  uint32_t noFingerprintDomainHashSetSize = 0;
-  char *noFingerprintDomainHashSetBuffer = nullptr;
-  if (noFingerprintDomainHashSet) {
-    noFingerprintDomainHashSetBuffer =
-      noFingerprintDomainHashSet->Serialize(&noFingerprintDomainHashSetSize);
-  }
-
-  uint32_t noFingerprintAntiDomainHashSetSize = 0;
-  char *noFingerprintAntiDomainHashSetBuffer = nullptr;
-  if (noFingerprintAntiDomainHashSet) {
-    noFingerprintAntiDomainHashSetBuffer =
-      noFingerprintAntiDomainHashSet->Serialize(
-          &noFingerprintAntiDomainHashSetSize);
-  }
-
-  uint32_t noFingerprintDomainExceptionHashSetSize = 0;
-  char *noFingerprintDomainExceptionHashSetBuffer = nullptr;
-  if (noFingerprintDomainExceptionHashSet) {
-    noFingerprintDomainExceptionHashSetBuffer =
-      noFingerprintDomainExceptionHashSet->Serialize(
-          &noFingerprintDomainExceptionHashSetSize);
-  }
-
-  uint32_t noFingerprintAntiDomainExceptionHashSetSize = 0;
-  char *noFingerprintAntiDomainExceptionHashSetBuffer = nullptr;
-  if (noFingerprintAntiDomainExceptionHashSet) {
-    noFingerprintAntiDomainExceptionHashSetBuffer =
-      noFingerprintAntiDomainExceptionHashSet->Serialize(
-          &noFingerprintAntiDomainExceptionHashSetSize);
-  }
+  uint32_t hostAnchoredPostingsSize = 0;
+  char *hostAnchoredPostingsBuffer = nullptr;
+  if (hostAnchoredPostings) {
+    hostAnchoredPostingsBuffer =
+      hostAnchoredPostings->Serialize(&hostAnchoredPostingsSize);
+  }
+
+  uint32_t hostAnchoredExceptionPostingsSize = 0;
+  char *hostAnchoredExceptionPostingsBuffer = nullptr;
+  if (hostAnchoredExceptionPostings) {
+    hostAnchoredExceptionPostingsBuffer =
+      hostAnchoredExceptionPostings->Serialize(
+          &hostAnchoredExceptionPostingsSize);
+  }
+
+  uint32_t noFingerprintDomainPostingsSize = 0;
+  char *noFingerprintDomainPostingsBuffer = nullptr;
+  if (noFingerprintDomainPostings) {
+    noFingerprintDomainPostingsBuffer =
+      noFingerprintDomainPostings->Serialize(&noFingerprintDomainPostingsSize);
+  }
+
+  uint32_t noFingerprintAntiDomainPostingsSize = 0;
+  char *noFingerprintAntiDomainPostingsBuffer = nullptr;
+  if (noFingerprintAntiDomainPostings) {
+    noFingerprintAntiDomainPostingsBuffer =
+      noFingerprintAntiDomainPostings->Serialize(
+          &noFingerprintAntiDomainPostingsSize);
+  }
+
+  uint32_t noFingerprintDomainExceptionPostingsSize = 0;
+  char *noFingerprintDomainExceptionPostingsBuffer = nullptr;
+  if (noFingerprintDomainExceptionPostings) {
+    noFingerprintDomainExceptionPostingsBuffer =
+      noFingerprintDomainExceptionPostings->Serialize(
+          &noFingerprintDomainExceptionPostingsSize);
+  }
+
+  uint32_t noFingerprintAntiDomainExceptionPostingsSize = 0;
+  char *noFingerprintAntiDomainExceptionPostingsBuffer = nullptr;
+  if (noFingerprintAntiDomainExceptionPostings) {
+    noFingerprintAntiDomainExceptionPostingsBuffer =
+      noFingerprintAntiDomainExceptionPostings->Serialize(
+          &noFingerprintAntiDomainExceptionPostingsSize);
+  }
+
+  uint32_t fingerprintPostingsSize = 0;
+  char *fingerprintPostingsBuffer = nullptr;
+  if (fingerprintPostings) {
+    fingerprintPostingsBuffer =
+      fingerprintPostings->Serialize(&fingerprintPostingsSize);
+  }
+
+  uint32_t exceptionFingerprintPostingsSize = 0;
+  char *exceptionFingerprintPostingsBuffer = nullptr;
+  if (exceptionFingerprintPostings) {
+    exceptionFingerprintPostingsBuffer =
+      exceptionFingerprintPostings->Serialize(
+          &exceptionFingerprintPostingsSize);
+  }
+
+  // In the same order as the filter lists they index
+  const FilterOptionIndex *optionIndexes[] = {
+    &filterOptionIndex,
+    &exceptionFilterOptionIndex,
+    &noFingerprintFilterOptionIndex,
+    &noFingerprintExceptionFilterOptionIndex,
+    &noFingerprintDomainOnlyFilterOptionIndex,
+    &noFingerprintAntiDomainOnlyFilterOptionIndex,
+    &noFingerprintDomainOnlyExceptionFilterOptionIndex,
+    &noFingerprintAntiDomainOnlyExceptionFilterOptionIndex,
+  };
+  const int kNumOptionIndexes =
+    sizeof(optionIndexes) / sizeof(optionIndexes[0]);
+  uint32_t optionIndexSizes[kNumOptionIndexes];
+  for (int i = 0; i < kNumOptionIndexes; i++) {
+    optionIndexSizes[i] = optionIndexes[i]->Serialize(nullptr);
+  }
+  uint32_t hostSuffixTrieSize = hostSuffixTrie.Serialize(nullptr);
+  // Only built, and so only written, while the automaton is enabled
+  uint32_t fingerprintAutomatonSize = fingerprintAutomaton.Serialize(nullptr);
+  uint32_t exceptionFingerprintAutomatonSize =
+    exceptionFingerprintAutomaton.Serialize(nullptr);
+  uint32_t anchoredFilterIndexSize =
+    noFingerprintMatcher.getAnchoredFilterIndex().Serialize(nullptr);
+  uint32_t anchoredExceptionFilterIndexSize =
+    noFingerprintExceptionMatcher.getAnchoredFilterIndex().Serialize(nullptr);
 
   // Get the number of bytes that we'll need
   char sz[512];
   *totalSize += 1 + snprintf(sz, sizeof(sz),
-      "%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x",
+      "%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,"
+      "%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x",
       numFilters,
       numExceptionFilters, adjustedNumCosmeticFilters, adjustedNumHtmlFilters,
       numNoFingerprintFilters, numNoFingerprintExceptionFilters,
@@ -1542,11 +2760,17 @@ char * AdBlockClient::serialize(int *totalSize,
       numHostAnchoredFilters, numHostAnchoredExceptionFilters,
       bloomFilter ? bloomFilter->getByteBufferSize() : 0, exceptionBloomFilter
         ? exceptionBloomFilter->getByteBufferSize() : 0,
-        hostAnchoredHashSetSize, hostAnchoredExceptionHashSetSize,
-        noFingerprintDomainHashSetSize,
-        noFingerprintAntiDomainHashSetSize,
-        noFingerprintDomainExceptionHashSetSize,
-        noFingerprintAntiDomainExceptionHashSetSize);
+        hostAnchoredPostingsSize, hostAnchoredExceptionPostingsSize,
+        noFingerprintDomainPostingsSize,
+        noFingerprintAntiDomainPostingsSize,
+        noFingerprintDomainExceptionPostingsSize,
+        noFingerprintAntiDomainExceptionPostingsSize,
+        fingerprintPostingsSize, exceptionFingerprintPostingsSize,
+        optionIndexSizes[0], optionIndexSizes[1], optionIndexSizes[2],
+        optionIndexSizes[3], optionIndexSizes[4], optionIndexSizes[5],
+        optionIndexSizes[6], optionIndexSizes[7], hostSuffixTrieSize,
+        fingerprintAutomatonSize, exceptionFingerprintAutomatonSize,
+        anchoredFilterIndexSize, anchoredExceptionFilterIndexSize);
   *totalSize += serializeFilters(nullptr, 0, filters, numFilters) +
     serializeFilters(nullptr, 0, exceptionFilters, numExceptionFilters) +
     serializeFilters(nullptr, 0, cosmeticFilters, adjustedNumCosmeticFilters) +
@@ -1563,17 +2787,30 @@ char * AdBlockClient::serialize(int *totalSize,
     serializeFilters(nullptr, 0, noFingerprintDomainOnlyExceptionFilters,
         numNoFingerprintDomainOnlyExceptionFilters) +
     serializeFilters(nullptr, 0, noFingerprintAntiDomainOnlyExceptionFilters,
-        numNoFingerprintAntiDomainOnlyExceptionFilters);
+        numNoFingerprintAntiDomainOnlyExceptionFilters) +
+    serializeFilters(nullptr, 0, hostAnchoredFilters, numHostAnchoredFilters) +
+    serializeFilters(nullptr, 0, hostAnchoredExceptionFilters,
+        numHostAnchoredExceptionFilters);
 
   *totalSize += bloomFilter ? bloomFilter->getByteBufferSize() : 0;
   *totalSize += exceptionBloomFilter
     ? exceptionBloomFilter->getByteBufferSize() : 0;
-  *totalSize += hostAnchoredHashSetSize;
-  *totalSize += hostAnchoredExceptionHashSetSize;
-  *totalSize += noFingerprintDomainHashSetSize;
-  *totalSize += noFingerprintAntiDomainHashSetSize;
-  *totalSize += noFingerprintDomainExceptionHashSetSize;
-  *totalSize += noFingerprintAntiDomainExceptionHashSetSize;
+  *totalSize += hostAnchoredPostingsSize;
+  *totalSize += hostAnchoredExceptionPostingsSize;
+  *totalSize += noFingerprintDomainPostingsSize;
+  *totalSize += noFingerprintAntiDomainPostingsSize;
+  *totalSize += noFingerprintDomainExceptionPostingsSize;
+  *totalSize += noFingerprintAntiDomainExceptionPostingsSize;
+  *totalSize += fingerprintPostingsSize;
+  *totalSize += exceptionFingerprintPostingsSize;
+  for (int i = 0; i < kNumOptionIndexes; i++) {
+    *totalSize += optionIndexSizes[i];
+  }
+  *totalSize += hostSuffixTrieSize;
+  *totalSize += fingerprintAutomatonSize;
+  *totalSize += exceptionFingerprintAutomatonSize;
+  *totalSize += anchoredFilterIndexSize;
+  *totalSize += anchoredExceptionFilterIndexSize;
 
   // Allocate it
   int pos = 0;
@@ -1606,6 +2843,10 @@ char * AdBlockClient::serialize(int *totalSize,
   pos += serializeFilters(buffer + pos, *totalSize - pos,
       noFingerprintAntiDomainOnlyExceptionFilters,
       numNoFingerprintAntiDomainOnlyExceptionFilters);
+  pos += serializeFilters(buffer + pos, *totalSize - pos,
+      hostAnchoredFilters, numHostAnchoredFilters);
+  pos += serializeFilters(buffer + pos, *totalSize - pos,
+      hostAnchoredExceptionFilters, numHostAnchoredExceptionFilters);
 
   if (bloomFilter) {
     memcpy(buffer + pos, bloomFilter->getBuffer(),
@@ -1617,41 +2858,61 @@ char * AdBlockClient::serialize(int *totalSize,
         exceptionBloomFilter->getByteBufferSize());
     pos += exceptionBloomFilter->getByteBufferSize();
   }
-  if (hostAnchoredHashSet) {
-    memcpy(buffer + pos, hostAnchoredHashSetBuffer, hostAnchoredHashSetSize);
-    pos += hostAnchoredHashSetSize;
-    delete[] hostAnchoredHashSetBuffer;
-  }
-  if (hostAnchoredExceptionHashSet) {
-    memcpy(buffer + pos, hostAnchoredExceptionHashSetBuffer,
-        hostAnchoredExceptionHashSetSize);
-    pos += hostAnchoredExceptionHashSetSize;
-    delete[] hostAnchoredExceptionHashSetBuffer;
-  }
-  if (noFingerprintDomainHashSet) {
-    memcpy(buffer + pos, noFingerprintDomainHashSetBuffer,
-        noFingerprintDomainHashSetSize);
-    pos += noFingerprintDomainHashSetSize;
-    delete[] noFingerprintDomainHashSetBuffer;
-  }
-  if (noFingerprintAntiDomainHashSet) {
-    memcpy(buffer + pos, noFingerprintAntiDomainHashSetBuffer,
-        noFingerprintAntiDomainHashSetSize);
-    pos += noFingerprintAntiDomainHashSetSize;
-    delete[] noFingerprintAntiDomainHashSetBuffer;
-  }
-  if (noFingerprintDomainExceptionHashSet) {
-    memcpy(buffer + pos, noFingerprintDomainExceptionHashSetBuffer,
-        noFingerprintDomainExceptionHashSetSize);
-    pos += noFingerprintDomainExceptionHashSetSize;
-    delete[] noFingerprintDomainExceptionHashSetBuffer;
-  }
-  if (noFingerprintAntiDomainExceptionHashSet) {
-    memcpy(buffer + pos, noFingerprintAntiDomainExceptionHashSetBuffer,
-        noFingerprintAntiDomainExceptionHashSetSize);
-    pos += noFingerprintAntiDomainExceptionHashSetSize;
-    delete[] noFingerprintAntiDomainExceptionHashSetBuffer;
-  }
+  if (hostAnchoredPostings) {
+    memcpy(buffer + pos, hostAnchoredPostingsBuffer, hostAnchoredPostingsSize);
+    pos += hostAnchoredPostingsSize;
+    delete[] hostAnchoredPostingsBuffer;
+  }
+  if (hostAnchoredExceptionPostings) {
+    memcpy(buffer + pos, hostAnchoredExceptionPostingsBuffer,
+        hostAnchoredExceptionPostingsSize);
+    pos += hostAnchoredExceptionPostingsSize;
+    delete[] hostAnchoredExceptionPostingsBuffer;
+  }
+  if (noFingerprintDomainPostings) {
+    memcpy(buffer + pos, noFingerprintDomainPostingsBuffer,
+        noFingerprintDomainPostingsSize);
+    pos += noFingerprintDomainPostingsSize;
+    delete[] noFingerprintDomainPostingsBuffer;
+  }
+  if (noFingerprintAntiDomainPostings) {
+    memcpy(buffer + pos, noFingerprintAntiDomainPostingsBuffer,
+        noFingerprintAntiDomainPostingsSize);
+    pos += noFingerprintAntiDomainPostingsSize;
+    delete[] noFingerprintAntiDomainPostingsBuffer;
+  }
+  if (noFingerprintDomainExceptionPostings) {
+    memcpy(buffer + pos, noFingerprintDomainExceptionPostingsBuffer,
+        noFingerprintDomainExceptionPostingsSize);
+    pos += noFingerprintDomainExceptionPostingsSize;
+    delete[] noFingerprintDomainExceptionPostingsBuffer;
+  }
+  if (noFingerprintAntiDomainExceptionPostings) {
+    memcpy(buffer + pos, noFingerprintAntiDomainExceptionPostingsBuffer,
+        noFingerprintAntiDomainExceptionPostingsSize);
+    pos += noFingerprintAntiDomainExceptionPostingsSize;
+    delete[] noFingerprintAntiDomainExceptionPostingsBuffer;
+  }
+  if (fingerprintPostings) {
+    memcpy(buffer + pos, fingerprintPostingsBuffer, fingerprintPostingsSize);
+    pos += fingerprintPostingsSize;
+    delete[] fingerprintPostingsBuffer;
+  }
+  if (exceptionFingerprintPostings) {
+    memcpy(buffer + pos, exceptionFingerprintPostingsBuffer,
+        exceptionFingerprintPostingsSize);
+    pos += exceptionFingerprintPostingsSize;
+    delete[] exceptionFingerprintPostingsBuffer;
+  }
+  for (int i = 0; i < kNumOptionIndexes; i++) {
+    pos += optionIndexes[i]->Serialize(buffer + pos);
+  }
+  pos += hostSuffixTrie.Serialize(buffer + pos);
+  pos += fingerprintAutomaton.Serialize(buffer + pos);
+  pos += exceptionFingerprintAutomaton.Serialize(buffer + pos);
+  pos += noFingerprintMatcher.getAnchoredFilterIndex().Serialize(buffer + pos);
+  pos += noFingerprintExceptionMatcher.getAnchoredFilterIndex().Serialize(
+      buffer + pos);
 
   return buffer;
 }
@@ -1672,7 +2933,8 @@ int deserializeFilters(char *buffer, Filter *f, int numFilters) {
       f->data = nullptr;
     } else {
       f->data = buffer + pos;
-      pos += static_cast<int>(strlen(f->data));
+      f->dataLen = static_cast<int>(strlen(f->data));
+      pos += f->dataLen;
     }
     pos++;
 
@@ -1691,22 +2953,81 @@ int deserializeFilters(char *buffer, Filter *f, int numFilters) {
       pos += static_cast<int>(strlen(f->host));
     }
     pos++;
+
+    // Cosmetic and HTML filters keep their domains in a different format and
+    // are never matched against URLs.
+    if (!(f->filterType & (FTElementHiding | FTElementHidingException |
+        FTHTMLFiltering))) {
+      f->parseDomains(f->domainList);
+      f->compileRegex();
+      f->compileMatcher();
+    }
     f++;
   }
   return pos;
 }
 
+// Builds the fingerprint postings for an already loaded filter array. Only
+// needed for data files which were serialized without them.  Returns nullptr
+// if a filter has no fingerprint with the current bad fingerprint list, in
+// which case the list can only be checked linearly.
+HashSet<FingerprintPostings> * buildFingerprintPostings(Filter *filters,
+    int numFilters) {
+  HashSet<FingerprintPostings> *postings =
+    new HashSet<FingerprintPostings>(numFilters > 0 ? numFilters : 1, false);
+  char fingerprintBuffer[AdBlockClient::kFingerprintSize + 1];
+  for (int i = 0; i < numFilters; i++) {
+    if (!AdBlockClient::getFingerprint(fingerprintBuffer, filters[i])) {
+      delete postings;
+      return nullptr;
+    }
+    postings->Add(FingerprintPostings(fingerprintBuffer,
+          AdBlockClient::kFingerprintSize, i));
+  }
+  return postings;
+}
+
+// Builds the context domain postings of a no fingerprint domain only or anti
+// domain only list, for when its filter ids change.
+HashSet<FingerprintPostings> * buildDomainPostings(Filter *filters,
+    int numFilters) {
+  HashSet<FingerprintPostings> *postings =
+    new HashSet<FingerprintPostings>(numFilters > 0 ? numFilters : 1, false);
+  for (int i = 0; i < numFilters; i++) {
+    addFilterDomains(filters + i, postings, nullptr, 0, i);
+  }
+  return postings;
+}
+
 bool AdBlockClient::deserialize(char *buffer) {
+  // Page contexts built before refer to the old filter ids
+  filterGeneration++;
+  if (matchCache) {
+    matchCache->clear();
+  }
+  if (hostDecisionCache) {
+    hostDecisionCache->clear();
+    contextFiltersCache->clear();
+  }
+  // Filter ids are about to change
+  stopFilterHitCounting();
   deserializedBuffer = buffer;
   int bloomFilterSize = 0, exceptionBloomFilterSize = 0,
-      hostAnchoredHashSetSize = 0, hostAnchoredExceptionHashSetSize = 0,
-      noFingerprintDomainHashSetSize = 0,
-      noFingerprintAntiDomainHashSetSize = 0,
-      noFingerprintDomainExceptionHashSetSize = 0,
-      noFingerprintAntiDomainExceptionHashSetSize = 0;
+      hostAnchoredPostingsSize = 0, hostAnchoredExceptionPostingsSize = 0,
+      noFingerprintDomainPostingsSize = 0,
+      noFingerprintAntiDomainPostingsSize = 0,
+      noFingerprintDomainExceptionPostingsSize = 0,
+      noFingerprintAntiDomainExceptionPostingsSize = 0,
+      fingerprintPostingsSize = 0, exceptionFingerprintPostingsSize = 0;
+  int optionIndexSizes[8] = {};
+  int hostSuffixTrieSize = 0;
+  int fingerprintAutomatonSize = 0, exceptionFingerprintAutomatonSize = 0;
+  int anchoredFilterIndexSize = 0, anchoredExceptionFilterIndexSize = 0;
   int pos = 0;
+  // Older data files don't have the trailing sizes, those are left at 0.
   sscanf(buffer + pos,
-      "%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x",
+      "%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,"
+      "%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x,%x",
       &numFilters,
       &numExceptionFilters, &numCosmeticFilters, &numHtmlFilters,
       &numNoFingerprintFilters, &numNoFingerprintExceptionFilters,
@@ -1716,11 +3037,17 @@ bool AdBlockClient::deserialize(char *buffer) {
       &numNoFingerprintAntiDomainOnlyExceptionFilters,
       &numHostAnchoredFilters, &numHostAnchoredExceptionFilters,
       &bloomFilterSize, &exceptionBloomFilterSize,
-      &hostAnchoredHashSetSize, &hostAnchoredExceptionHashSetSize,
-      &noFingerprintDomainHashSetSize,
-      &noFingerprintAntiDomainHashSetSize,
-      &noFingerprintDomainExceptionHashSetSize,
-      &noFingerprintAntiDomainExceptionHashSetSize);
+      &hostAnchoredPostingsSize, &hostAnchoredExceptionPostingsSize,
+      &noFingerprintDomainPostingsSize,
+      &noFingerprintAntiDomainPostingsSize,
+      &noFingerprintDomainExceptionPostingsSize,
+      &noFingerprintAntiDomainExceptionPostingsSize,
+      &fingerprintPostingsSize, &exceptionFingerprintPostingsSize,
+      &optionIndexSizes[0], &optionIndexSizes[1], &optionIndexSizes[2],
+      &optionIndexSizes[3], &optionIndexSizes[4], &optionIndexSizes[5],
+      &optionIndexSizes[6], &optionIndexSizes[7], &hostSuffixTrieSize,
+      &fingerprintAutomatonSize, &exceptionFingerprintAutomatonSize,
+      &anchoredFilterIndexSize, &anchoredExceptionFilterIndexSize);
   pos += static_cast<int>(strlen(buffer + pos)) + 1;
 
   filters = new Filter[numFilters];
@@ -1737,6 +3064,8 @@ bool AdBlockClient::deserialize(char *buffer) {
     new Filter[numNoFingerprintDomainOnlyExceptionFilters];
   noFingerprintAntiDomainOnlyExceptionFilters =
     new Filter[numNoFingerprintAntiDomainOnlyExceptionFilters];
+  hostAnchoredFilters = new Filter[numHostAnchoredFilters];
+  hostAnchoredExceptionFilters = new Filter[numHostAnchoredExceptionFilters];
 
   pos += deserializeFilters(buffer + pos, filters, numFilters);
   pos += deserializeFilters(buffer + pos,
@@ -1761,51 +3090,336 @@ bool AdBlockClient::deserialize(char *buffer) {
   pos += deserializeFilters(buffer + pos,
       noFingerprintAntiDomainOnlyExceptionFilters,
       numNoFingerprintAntiDomainOnlyExceptionFilters);
+  pos += deserializeFilters(buffer + pos,
+      hostAnchoredFilters, numHostAnchoredFilters);
+  pos += deserializeFilters(buffer + pos,
+      hostAnchoredExceptionFilters, numHostAnchoredExceptionFilters);
 
   initBloomFilter(&bloomFilter, buffer + pos, bloomFilterSize);
   pos += bloomFilterSize;
   initBloomFilter(&exceptionBloomFilter,
       buffer + pos, exceptionBloomFilterSize);
   pos += exceptionBloomFilterSize;
-  if (!initHashSet(&hostAnchoredHashSet,
-        buffer + pos, hostAnchoredHashSetSize)) {
+  if (!initHashSet(&hostAnchoredPostings,
+        buffer + pos, hostAnchoredPostingsSize)) {
       return false;
   }
-  pos += hostAnchoredHashSetSize;
-  if (!initHashSet(&hostAnchoredExceptionHashSet,
-        buffer + pos, hostAnchoredExceptionHashSetSize)) {
+  pos += hostAnchoredPostingsSize;
+  if (!initHashSet(&hostAnchoredExceptionPostings,
+        buffer + pos, hostAnchoredExceptionPostingsSize)) {
       return false;
   }
-  pos += hostAnchoredExceptionHashSetSize;
+  pos += hostAnchoredExceptionPostingsSize;
 
 
-  if (!initHashSet(&noFingerprintDomainHashSet,
-        buffer + pos, noFingerprintDomainHashSetSize)) {
+  if (!initHashSet(&noFingerprintDomainPostings,
+        buffer + pos, noFingerprintDomainPostingsSize)) {
       return false;
   }
-  pos += noFingerprintDomainHashSetSize;
+  pos += noFingerprintDomainPostingsSize;
 
-  if (!initHashSet(&noFingerprintAntiDomainHashSet,
-        buffer + pos, noFingerprintAntiDomainHashSetSize)) {
+  if (!initHashSet(&noFingerprintAntiDomainPostings,
+        buffer + pos, noFingerprintAntiDomainPostingsSize)) {
       return false;
   }
-  pos += noFingerprintAntiDomainHashSetSize;
+  pos += noFingerprintAntiDomainPostingsSize;
 
-  if (!initHashSet(&noFingerprintDomainExceptionHashSet,
-        buffer + pos, noFingerprintDomainExceptionHashSetSize)) {
+  if (!initHashSet(&noFingerprintDomainExceptionPostings,
+        buffer + pos, noFingerprintDomainExceptionPostingsSize)) {
       return false;
   }
-  pos += noFingerprintDomainExceptionHashSetSize;
+  pos += noFingerprintDomainExceptionPostingsSize;
 
-  if (!initHashSet(&noFingerprintAntiDomainExceptionHashSet,
-        buffer + pos, noFingerprintAntiDomainExceptionHashSetSize)) {
+  if (!initHashSet(&noFingerprintAntiDomainExceptionPostings,
+        buffer + pos, noFingerprintAntiDomainExceptionPostingsSize)) {
       return false;
   }
-  pos += noFingerprintAntiDomainExceptionHashSetSize;
+  pos += noFingerprintAntiDomainExceptionPostingsSize;
+
+  if (!initHashSet(&fingerprintPostings,
+        buffer + pos, fingerprintPostingsSize)) {
+      return false;
+  }
+  pos += fingerprintPostingsSize;
+  if (!fingerprintPostings) {
+    fingerprintPostings = buildFingerprintPostings(filters, numFilters);
+  }
+
+  if (!initHashSet(&exceptionFingerprintPostings,
+        buffer + pos, exceptionFingerprintPostingsSize)) {
+      return false;
+  }
+  pos += exceptionFingerprintPostingsSize;
+  if (!exceptionFingerprintPostings) {
+    exceptionFingerprintPostings =
+      buildFingerprintPostings(exceptionFilters, numExceptionFilters);
+  }
+
+  // Same order as in serialize, data files without the indexes get them
+  // rebuilt from the filters.
+  FilterOptionIndex *optionIndexes[] = {
+    &filterOptionIndex,
+    &exceptionFilterOptionIndex,
+    &noFingerprintFilterOptionIndex,
+    &noFingerprintExceptionFilterOptionIndex,
+    &noFingerprintDomainOnlyFilterOptionIndex,
+    &noFingerprintAntiDomainOnlyFilterOptionIndex,
+    &noFingerprintDomainOnlyExceptionFilterOptionIndex,
+    &noFingerprintAntiDomainOnlyExceptionFilterOptionIndex,
+  };
+  const int kNumOptionIndexes =
+    sizeof(optionIndexes) / sizeof(optionIndexes[0]);
+  bool missingOptionIndex = false;
+  for (int i = 0; i < kNumOptionIndexes; i++) {
+    if (optionIndexSizes[i] <= 0 ||
+        optionIndexes[i]->Deserialize(buffer + pos, optionIndexSizes[i]) !=
+          static_cast<uint32_t>(optionIndexSizes[i])) {
+      missingOptionIndex = true;
+    }
+    pos += optionIndexSizes[i];
+  }
+  if (missingOptionIndex) {
+    buildFilterOptionIndexes();
+  }
+
+  // The trie isn't rebuilt for data files without it, those look up every
+  // suffix in the postings instead.
+  if (hostSuffixTrieSize <= 0 ||
+      hostSuffixTrie.Deserialize(buffer + pos, hostSuffixTrieSize) !=
+        static_cast<uint32_t>(hostSuffixTrieSize)) {
+    hostSuffixTrie.clear();
+  }
+  pos += hostSuffixTrieSize;
+
+  // The automatons are skipped unless they're enabled, and built when
+  // they're enabled but the data file doesn't have them.
+  if (fingerprintAutomatonEnabled) {
+    if (fingerprintAutomatonSize <= 0 ||
+        fingerprintAutomaton.Deserialize(buffer + pos,
+          fingerprintAutomatonSize, numFilters) !=
+          static_cast<uint32_t>(fingerprintAutomatonSize)) {
+      fingerprintAutomaton.build(filters, numFilters);
+    }
+    if (exceptionFingerprintAutomatonSize <= 0 ||
+        exceptionFingerprintAutomaton.Deserialize(
+          buffer + pos + fingerprintAutomatonSize,
+          exceptionFingerprintAutomatonSize, numExceptionFilters) !=
+          static_cast<uint32_t>(exceptionFingerprintAutomatonSize)) {
+      exceptionFingerprintAutomaton.build(exceptionFilters,
+          numExceptionFilters);
+    }
+  }
+  pos += fingerprintAutomatonSize + exceptionFingerprintAutomatonSize;
+
+  // Data files without the anchored filter indexes get them built
+  noFingerprintMatcher.build(noFingerprintFilters, numNoFingerprintFilters,
+      anchoredFilterIndexSize > 0 ? buffer + pos : nullptr,
+      anchoredFilterIndexSize);
+  pos += anchoredFilterIndexSize;
+  noFingerprintExceptionMatcher.build(noFingerprintExceptionFilters,
+      numNoFingerprintExceptionFilters,
+      anchoredExceptionFilterIndexSize > 0 ? buffer + pos : nullptr,
+      anchoredExceptionFilterIndexSize);
+  pos += anchoredExceptionFilterIndexSize;
 
   return true;
 }
 
+void AdBlockClient::getMatchedFilterLists(Filter ***lists,
+    int **listSizes) {
+  Filter **filterLists[kNumMatchedFilterLists] = {
+    &filters,
+    &exceptionFilters,
+    &noFingerprintFilters,
+    &noFingerprintExceptionFilters,
+    &noFingerprintDomainOnlyFilters,
+    &noFingerprintAntiDomainOnlyFilters,
+    &noFingerprintDomainOnlyExceptionFilters,
+    &noFingerprintAntiDomainOnlyExceptionFilters,
+  };
+  int *filterCounts[kNumMatchedFilterLists] = {
+    &numFilters,
+    &numExceptionFilters,
+    &numNoFingerprintFilters,
+    &numNoFingerprintExceptionFilters,
+    &numNoFingerprintDomainOnlyFilters,
+    &numNoFingerprintAntiDomainOnlyFilters,
+    &numNoFingerprintDomainOnlyExceptionFilters,
+    &numNoFingerprintAntiDomainOnlyExceptionFilters,
+  };
+  for (int i = 0; i < kNumMatchedFilterLists; i++) {
+    lists[i] = filterLists[i];
+    listSizes[i] = filterCounts[i];
+  }
+}
+
+void AdBlockClient::countFilterHit(const Filter *filters,
+    const Filter *filter) {
+  Filter **lists[kNumMatchedFilterLists];
+  int *listSizes[kNumMatchedFilterLists];
+  getMatchedFilterLists(lists, listSizes);
+  for (int i = 0; i < kNumMatchedFilterLists; i++) {
+    if (*lists[i] == filters) {
+      filterHitCounts[i].increment(static_cast<int>(filter - filters));
+      return;
+    }
+  }
+}
+
+void AdBlockClient::startFilterHitCounting() {
+  if (filterOrderFrozen) {
+    return;
+  }
+  stopFilterHitCounting();
+  Filter **lists[kNumMatchedFilterLists];
+  int *listSizes[kNumMatchedFilterLists];
+  getMatchedFilterLists(lists, listSizes);
+  filterHitCounts = new FilterHitCounts[kNumMatchedFilterLists];
+  for (int i = 0; i < kNumMatchedFilterLists; i++) {
+    filterHitCounts[i].start(*listSizes[i]);
+  }
+}
+
+void AdBlockClient::stopFilterHitCounting() {
+  if (filterHitCounts) {
+    delete[] filterHitCounts;
+    filterHitCounts = nullptr;
+  }
+}
+
+void AdBlockClient::reorderFilters() {
+  if (filterOrderFrozen || !filterHitCounts) {
+    return;
+  }
+  filterGeneration++;
+  Filter **lists[kNumMatchedFilterLists];
+  int *listSizes[kNumMatchedFilterLists];
+  getMatchedFilterLists(lists, listSizes);
+  for (int i = 0; i < kNumMatchedFilterLists; i++) {
+    const int count = *listSizes[i];
+    int *order = new int[count > 0 ? count : 1];
+    filterHitCounts[i].findOrder(*lists[i], order);
+    // Same as when parse() grows a list, the old array gives up its data
+    // to the new one.  Filters loaded from a data file keep pointing into
+    // its buffer.
+    Filter *newFilters = new Filter[count];
+    for (int j = 0; j < count; j++) {
+      Filter *filter = *lists[i] + order[j];
+      newFilters[j].swapData(filter);
+      newFilters[j].borrowed_data = filter->borrowed_data;
+    }
+    setFilterBorrowedMemory(*lists[i], count);
+    delete[] *lists[i];
+    *lists[i] = newFilters;
+    delete[] order;
+  }
+  stopFilterHitCounting();
+
+  // Everything which refers to filters by id
+  if (fingerprintPostings) {
+    delete fingerprintPostings;
+    fingerprintPostings = buildFingerprintPostings(filters, numFilters);
+  }
+  if (exceptionFingerprintPostings) {
+    delete exceptionFingerprintPostings;
+    exceptionFingerprintPostings =
+      buildFingerprintPostings(exceptionFilters, numExceptionFilters);
+  }
+  if (noFingerprintDomainPostings) {
+    delete noFingerprintDomainPostings;
+    noFingerprintDomainPostings =
+      buildDomainPostings(noFingerprintDomainOnlyFilters,
+          numNoFingerprintDomainOnlyFilters);
+  }
+  if (noFingerprintAntiDomainPostings) {
+    delete noFingerprintAntiDomainPostings;
+    noFingerprintAntiDomainPostings =
+      buildDomainPostings(noFingerprintAntiDomainOnlyFilters,
+          numNoFingerprintAntiDomainOnlyFilters);
+  }
+  if (noFingerprintDomainExceptionPostings) {
+    delete noFingerprintDomainExceptionPostings;
+    noFingerprintDomainExceptionPostings =
+      buildDomainPostings(noFingerprintDomainOnlyExceptionFilters,
+          numNoFingerprintDomainOnlyExceptionFilters);
+  }
+  if (noFingerprintAntiDomainExceptionPostings) {
+    delete noFingerprintAntiDomainExceptionPostings;
+    noFingerprintAntiDomainExceptionPostings =
+      buildDomainPostings(noFingerprintAntiDomainOnlyExceptionFilters,
+          numNoFingerprintAntiDomainOnlyExceptionFilters);
+  }
+  buildFilterOptionIndexes();
+  buildNoFingerprintMatchers();
+  if (fingerprintAutomatonEnabled) {
+    buildFingerprintAutomatons();
+  }
+  if (matchCache) {
+    matchCache->clear();
+  }
+}
+
+void AdBlockClient::setFilterOrderFrozen(bool frozen) {
+  filterOrderFrozen = frozen;
+  if (frozen) {
+    stopFilterHitCounting();
+  }
+}
+
+void AdBlockClient::enableMatchCache(size_t maxEntries, size_t maxBytes) {
+  disableMatchCache();
+  if (maxBytes && (!maxEntries ||
+        MatchCache::entriesForBytes(maxBytes) < maxEntries)) {
+    maxEntries = MatchCache::entriesForBytes(maxBytes);
+  }
+  matchCache = new MatchCache(maxEntries);
+}
+
+void AdBlockClient::disableMatchCache() {
+  if (matchCache) {
+    delete matchCache;
+    matchCache = nullptr;
+  }
+}
+
+void AdBlockClient::enableHostDecisionCache(size_t maxEntries,
+    size_t maxBytes) {
+  disableHostDecisionCache();
+  if (maxBytes && (!maxEntries ||
+        MatchCache::entriesForBytes(maxBytes) < maxEntries)) {
+    maxEntries = MatchCache::entriesForBytes(maxBytes);
+  }
+  hostDecisionCache = new MatchCache(maxEntries);
+  contextFiltersCache = new MatchCache(kContextFiltersCacheSize);
+}
+
+void AdBlockClient::disableHostDecisionCache() {
+  if (hostDecisionCache) {
+    delete hostDecisionCache;
+    hostDecisionCache = nullptr;
+    delete contextFiltersCache;
+    contextFiltersCache = nullptr;
+  }
+}
+
+void AdBlockClient::warmHostDecisionCache(const char * const *hosts,
+    size_t numHosts, FilterOption contextOption, const char *contextDomain) {
+  if (!hostDecisionCache) {
+    return;
+  }
+  const int contextDomainLen =
+    contextDomain ? static_cast<int>(strlen(contextDomain)) : 0;
+  std::string url;
+  for (size_t i = 0; i < numHosts; i++) {
+    url = "https://";
+    url += hosts[i];
+    url += "/";
+    MatchRequest request(url.c_str(), static_cast<int>(url.length()),
+        contextOption, contextDomain, contextDomainLen);
+    findCachedHostDecision(request);
+  }
+}
+
 void AdBlockClient::enableBadFingerprintDetection() {
   if (badFingerprintsHashSet) {
     return;
@@ -1817,11 +3431,3 @@ void AdBlockClient::enableBadFingerprintDetection() {
     badFingerprintsHashSet->Add(BadFingerprint(badFingerprints[i]));
   }
 }
-
-  uint64_t HashFn2Byte::operator()(const char *input, int len,
-      unsigned char lastCharCode, uint64_t lastHash) {
-    return (((uint64_t)input[1]) << 8) | input[0];  }
-
-  uint64_t HashFn2Byte::operator()(const char *input, int len) {
-    return (((uint64_t)input[1]) << 8) | input[0];
-  }
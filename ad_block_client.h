@@ -6,18 +6,48 @@
 #ifndef AD_BLOCK_CLIENT_H_
 #define AD_BLOCK_CLIENT_H_
 
+#include <atomic>
 #include <string>
 #include <set>
+#include <vector>
 #include "./filter.h"
+#include "./filter_option_index.h"
+#include "./filter_hit_counts.h"
+#include "./fingerprint_automaton.h"
+#include "./host_suffix_trie.h"
+#include "./no_fingerprint_matcher.h"
 
 class CosmeticFilter;
 class BloomFilter;
 class BadFingerprintsHashSet;
-class NoFingerprintDomain;
+class FingerprintPostings;
+class MatchCache;
+class MatchRequest;
+class PageContext;
 
 template<class T>
 class HashSet;
 
+// What is known about every URL of a host for one context domain and
+// context option, see AdBlockClient::enableHostDecisionCache.
+enum HostDecision : uint8_t {
+  // Depends on the rest of the URL, which has to be checked
+  HDCheckUrl = 0,
+  HDBlock,
+  HDAllow,
+};
+
+// Threading model:
+// parse(), deserialize(), clear() and enableBadFingerprintDetection() modify
+// the client and must not run concurrently with anything else.  Once a client
+// is fully parsed or deserialized it is in read-only matching mode:
+// matches() and findMatchingFilters() do not modify any filter data and only
+// update the matching stats with relaxed atomics, so a single client can be
+// shared by any number of threads without locking.  Bad fingerprint
+// detection is the exception, it records into a hash set while matching and
+// is only meant for the single threaded perf tool.  The optional match and
+// host decision caches lock one of their shards per lookup, and enabling or
+// disabling either of them must not run concurrently with matching.
 class AdBlockClient {
  public:
   AdBlockClient();
@@ -29,11 +59,52 @@ class AdBlockClient {
   bool matches(const char *input,
       FilterOption contextOption = FONoFilterOption,
       const char *contextDomain = nullptr);
+  // Same as above for a request which was already built, see
+  // match_request.h.
+  bool matches(const MatchRequest &request);
+  // Builds |pageContext| for the page at |pageUrl| on |contextDomain|, see
+  // page_context.h.  $document exception filters are checked against
+  // |pageUrl|, and none apply when it is null.
+  void initPageContext(const char *pageUrl, const char *contextDomain,
+      PageContext *pageContext);
+  // Same as matches() for a subrequest of the page which |pageContext| was
+  // built for.  Nothing is blocked on a page allowed by a $document
+  // exception filter.
+  bool matches(const char *input, FilterOption contextOption,
+      const PageContext &pageContext);
+  bool matches(const MatchRequest &request, const PageContext &pageContext);
+  // Checks |n| URLs which were all loaded by a page on |contextDomain| and
+  // sets |out[i]| to matches(urls[i], opts[i], contextDomain).  The URLs
+  // are grouped by host, so lookups which only depend on the context domain
+  // or on the host are done once per batch or once per host instead of
+  // once per URL, and repeats of a URL with the same option are only
+  // checked once.  |lens| may be null to measure the URLs with strlen, and
+  // |opts| may be null to check every URL with FONoFilterOption.  As with
+  // matches() and a context domain, $document exception filters aren't
+  // applied, use a PageContext for that.
+  void matchesBatch(const char **urls, const int *lens,
+      const FilterOption *opts, const char *contextDomain, bool *out,
+      size_t n);
   bool findMatchingFilters(const char *input,
       FilterOption contextOption,
       const char *contextDomain,
       Filter **matchingFilter,
       Filter **matchingExceptionFilter);
+  bool findMatchingFilters(const MatchRequest &request,
+      Filter **matchingFilter,
+      Filter **matchingExceptionFilter);
+  // Finds every block filter and every exception filter which matches the
+  // request, for working out which rules are responsible for a result.
+  // Only the filters which matches() would evaluate are evaluated.  Returns
+  // true if the request should be blocked.
+  bool findAllMatchingFilters(const char *input,
+      FilterOption contextOption,
+      const char *contextDomain,
+      std::vector<Filter *> *matchingFilters,
+      std::vector<Filter *> *matchingExceptionFilters);
+  bool findAllMatchingFilters(const MatchRequest &request,
+      std::vector<Filter *> *matchingFilters,
+      std::vector<Filter *> *matchingExceptionFilters);
   // Serializes a the parsed data and bloom filter data into a single buffer.
   // The returned buffer should be deleted.
   char * serialize(int *size,
@@ -44,6 +115,67 @@ class AdBlockClient {
   bool deserialize(char *buffer);
 
   void enableBadFingerprintDetection();
+  // Caches the results of matches(const char *, ...) for up to |maxEntries|
+  // URL, context option and context domain combinations, or fewer if they
+  // would use more than |maxBytes| of memory.  0 means no limit for either
+  // one but not both.  The cache is emptied by clear(), parse() and
+  // deserialize() since those change the filters.
+  void enableMatchCache(size_t maxEntries, size_t maxBytes = 0);
+  void disableMatchCache();
+  MatchCache * getMatchCache() {
+    return matchCache;
+  }
+  // Caches up to |maxEntries| host decisions, or fewer if they would use
+  // more than |maxBytes| of memory, like enableMatchCache().  A host
+  // decision is kept for each host, context domain and context option that
+  // matches() sees.  When a host only filter such as ||example.com^
+  // matches and no exception filter other than host only ones could accept
+  // the request, or when no block filter could accept it at all, every URL
+  // of the host is blocked or allowed the same way and matches() answers
+  // from the cache without looking at the rest of the URL.  Other hosts are
+  // cached as HDCheckUrl and checked URL by URL.
+  void enableHostDecisionCache(size_t maxEntries, size_t maxBytes = 0);
+  void disableHostDecisionCache();
+  MatchCache * getHostDecisionCache() {
+    return hostDecisionCache;
+  }
+  // Finds the host decision for each of the |numHosts| hosts on
+  // |contextDomain| with |contextOption| and adds them to the host decision
+  // cache, if it is enabled, so the first URLs of those hosts are answered
+  // from the cache too.
+  void warmHostDecisionCache(const char * const *hosts, size_t numHosts,
+      FilterOption contextOption = FONoFilterOption,
+      const char *contextDomain = nullptr);
+  // Works out the host decision for the host, context domain and context
+  // option of |request| without the cache.
+  HostDecision findHostDecision(const MatchRequest &request);
+  // Finds the fingerprints of a URL with one pass of an Aho-Corasick
+  // automaton over it instead of looking up every fingerprint sized window
+  // in the fingerprint postings.  The automatons are built for the current
+  // filters, rebuilt by parse() and reorderFilters(), written by
+  // serialize() and loaded by deserialize() while this is enabled.
+  void setFingerprintAutomatonEnabled(bool enabled);
+  bool isFingerprintAutomatonEnabled() const {
+    return fingerprintAutomatonEnabled;
+  }
+  // Counts how many times each filter matches from now on, until
+  // reorderFilters() is called or the filters are changed.
+  void startFilterHitCounting();
+  void stopFilterHitCounting();
+  // Moves the filters which matched most often since
+  // startFilterHitCounting() to the front of their lists so they are
+  // checked first, and stops counting.  serialize() writes the filters in
+  // their new order, so clients loading the data file start out with it.
+  // Like parse(), this can't be done while other threads are matching, and
+  // page contexts have to be built again afterwards.
+  void reorderFilters();
+  // While the order is frozen, filter hits aren't counted and
+  // reorderFilters() does nothing, for example so benchmarks always check
+  // the filters in the same order.
+  void setFilterOrderFrozen(bool frozen);
+  bool isFilterOrderFrozen() const {
+    return filterOrderFrozen;
+  }
   const char * getDeserializedBuffer() {
     return deserializedBuffer;
   }
@@ -61,6 +193,8 @@ class AdBlockClient {
   Filter *noFingerprintAntiDomainOnlyFilters;
   Filter *noFingerprintDomainOnlyExceptionFilters;
   Filter *noFingerprintAntiDomainOnlyExceptionFilters;
+  Filter *hostAnchoredFilters;
+  Filter *hostAnchoredExceptionFilters;
 
   int numFilters;
   int numCosmeticFilters;
@@ -77,55 +211,210 @@ class AdBlockClient {
 
   BloomFilter *bloomFilter;
   BloomFilter *exceptionBloomFilter;
-  HashSet<Filter> *hostAnchoredHashSet;
-  HashSet<Filter> *hostAnchoredExceptionHashSet;
-  HashSet<NoFingerprintDomain> *noFingerprintDomainHashSet;
-  HashSet<NoFingerprintDomain> *noFingerprintAntiDomainHashSet;
-  HashSet<NoFingerprintDomain> *noFingerprintDomainExceptionHashSet;
-  HashSet<NoFingerprintDomain> *noFingerprintAntiDomainExceptionHashSet;
+  // Host to filter id lookups for |hostAnchoredFilters| and
+  // |hostAnchoredExceptionFilters|, every filter for a host is kept even
+  // when they only differ by their options or path.
+  HashSet<FingerprintPostings> *hostAnchoredPostings;
+  HashSet<FingerprintPostings> *hostAnchoredExceptionPostings;
+  // Context domain to filter id lookups for the no fingerprint domain only
+  // and anti domain only lists.  A domain only filter is stored under each
+  // domain it applies to, and an anti domain only filter under each domain
+  // it excludes.
+  HashSet<FingerprintPostings> *noFingerprintDomainPostings;
+  HashSet<FingerprintPostings> *noFingerprintAntiDomainPostings;
+  HashSet<FingerprintPostings> *noFingerprintDomainExceptionPostings;
+  HashSet<FingerprintPostings> *noFingerprintAntiDomainExceptionPostings;
+  // Fingerprint to filter id lookups for |filters| and |exceptionFilters|
+  HashSet<FingerprintPostings> *fingerprintPostings;
+  HashSet<FingerprintPostings> *exceptionFingerprintPostings;
+  // The same lookups as automatons, only built while the fingerprint
+  // automaton is enabled.
+  FingerprintAutomaton fingerprintAutomaton;
+  FingerprintAutomaton exceptionFingerprintAutomaton;
+  // Candidate lookups for |noFingerprintFilters| and
+  // |noFingerprintExceptionFilters|, rebuilt whenever the lists change.
+  NoFingerprintMatcher noFingerprintMatcher;
+  NoFingerprintMatcher noFingerprintExceptionMatcher;
+  // Resource type and party indexes for each of the filter lists above,
+  // other than the host anchored ones which are only checked a host at a
+  // time.
+  FilterOptionIndex filterOptionIndex;
+  FilterOptionIndex exceptionFilterOptionIndex;
+  FilterOptionIndex noFingerprintFilterOptionIndex;
+  FilterOptionIndex noFingerprintExceptionFilterOptionIndex;
+  FilterOptionIndex noFingerprintDomainOnlyFilterOptionIndex;
+  FilterOptionIndex noFingerprintAntiDomainOnlyFilterOptionIndex;
+  FilterOptionIndex noFingerprintDomainOnlyExceptionFilterOptionIndex;
+  FilterOptionIndex noFingerprintAntiDomainOnlyExceptionFilterOptionIndex;
+  // Every host in the host anchored and no fingerprint domain postings.
+  // Lookups go through the postings for every suffix instead when it isn't
+  // built, which is the case for data files serialized without it.
+  HostSuffixTrie hostSuffixTrie;
 
   // Used only in the perf program to create a list of bad fingerprints
   BadFingerprintsHashSet *badFingerprintsHashSet;
 
-  // Stats kept for matching
-  unsigned int numFalsePositives;
-  unsigned int numExceptionFalsePositives;
-  unsigned int numBloomFilterSaves;
-  unsigned int numExceptionBloomFilterSaves;
-  unsigned int numHashSetSaves;
-  unsigned int numExceptionHashSetSaves;
+  // Stats kept for matching, these are updated with relaxed ordering since
+  // they are only informational and may be bumped from many threads.
+  std::atomic<unsigned int> numFalsePositives;
+  std::atomic<unsigned int> numExceptionFalsePositives;
+  std::atomic<unsigned int> numBloomFilterSaves;
+  std::atomic<unsigned int> numExceptionBloomFilterSaves;
+  std::atomic<unsigned int> numHashSetSaves;
+  std::atomic<unsigned int> numExceptionHashSetSaves;
+  // URLs answered by a cached host decision
+  std::atomic<unsigned int> numHostDecisionSaves;
 
   static const int kFingerprintSize;
 
  protected:
+  // Lookups which matchesBatch shares between URLs with the same host, see
+  // ad_block_client.cc
+  struct HostLookups;
+  // Fills in the context domain and the domain specific filter ids of
+  // |pageContext| but not whether a $document exception allows the page.
+  void initContextDomainFilters(const char *contextDomain,
+      PageContext *pageContext);
+  // Same as matches() but uses |pageContext| and uses and fills in
+  // |hostLookups| when they are given instead of looking the context domain
+  // and host up in the hash sets.
+  bool matches(const MatchRequest &request, const PageContext *pageContext,
+      HostLookups *hostLookups);
+  // Returns true if an exception filter matches the request, the arguments
+  // are the same as above.
+  bool matchesException(const MatchRequest &request,
+      const PageContext *pageContext, HostLookups *hostLookups);
+  // Returns the host decision for |request| from the host decision cache,
+  // finding and adding it if it isn't there yet.
+  HostDecision findCachedHostDecision(const MatchRequest &request);
+  // Returns true if a filter of the list whose options, and domain options
+  // for the lists which have them, accept the request may match it
+  // depending on more than its host.
+  bool hasUrlDependentFilters(const Filter *filter, int numFilters,
+      const FilterOptionIndex *optionIndex, const MatchRequest &request);
+  // Which lists other than the host indexed ones have a filter whose
+  // options accept the context option and context domain of |request|, as
+  // ContextFilters flags.  Kept in the context filters cache along with
+  // the host decisions, since it doesn't depend on the host.
+  enum ContextFilters : uint8_t {
+    CFBlock = 1,
+    CFException = 2,
+  };
+  uint8_t findContextFilters(const MatchRequest &request);
+  // Checks |input| with the match cache when it is enabled
+  bool matchesCached(const char *input, int inputLen,
+      FilterOption contextOption, const char *contextDomain,
+      int contextDomainLen, const PageContext *pageContext);
+
   // Determines if a passed in array of filter pointers matches for any of
-  // the input
-  bool hasMatchingFilters(Filter *filter, int numFilters, const char *input,
-      int inputLen, FilterOption contextOption, const char *contextDomain,
-      BloomFilter *inputBloomFilter, const char *inputHost, int inputHostLen,
+  // the input.  |optionIndex| is used to skip filters whose options can't
+  // accept the request context when it has been built for |filter|, and
+  // |matcher| to only try the filters which can match the input.
+  bool hasMatchingFilters(Filter *filter, int numFilters,
+      const FilterOptionIndex *optionIndex, const MatchRequest &request,
+      Filter **matchingFilter = nullptr,
+      const NoFingerprintMatcher *matcher = nullptr);
+  // Same as hasMatchingFilters but only checks the |numIds| filters in
+  // |ids|, whose domain options are already known to accept the request.
+  bool hasMatchingFilterIds(Filter *filter, int numFilters,
+      const int *ids, int numIds, const FilterOptionIndex *optionIndex,
+      const MatchRequest &request);
+  // Returns the offset of the first fingerprint in the input which belongs
+  // to at least one filter, or -1 if there is none.  |automaton| is used
+  // when it is built, then |postings|.  Without either this can only tell
+  // from the bloom filter whether there is one.
+  int findFirstFingerprint(const FingerprintAutomaton &automaton,
+      HashSet<FingerprintPostings> *postings, BloomFilter *bloomFilter,
+      const MatchRequest &request);
+  // Same as hasMatchingFilters but only evaluates the filters whose
+  // fingerprint occurs somewhere in the input, at or after
+  // |firstFingerprint|.
+  bool hasMatchingFingerprintFilters(Filter *filter, int numFilters,
+      const FingerprintAutomaton &automaton,
+      HashSet<FingerprintPostings> *postings,
+      const FilterOptionIndex *optionIndex, const MatchRequest &request,
+      Filter **matchingFilter = nullptr, int firstFingerprint = 0);
+  // Same as hasMatchingFilters for a no fingerprint domain only list, or an
+  // anti domain only list when |antiDomains| is true.  Only the filters in
+  // |postings| under the context domain are evaluated for a domain only
+  // list, and every filter other than those for an anti domain only list.
+  // Either way their domain options don't need to be checked again.
+  bool hasMatchingDomainFilters(Filter *filter, int numFilters,
+      HashSet<FingerprintPostings> *postings, uint8_t flag, bool antiDomains,
+      const FilterOptionIndex *optionIndex, const MatchRequest &request,
       Filter **matchingFilter = nullptr);
+  // Same as hasMatchingFilters and hasMatchingFingerprintFilters but adds
+  // every filter which matches to |found| instead of stopping at the first
+  // one.
+  void addMatchingFilters(Filter *filter, int numFilters,
+      const FilterOptionIndex *optionIndex, const MatchRequest &request,
+      std::vector<Filter *> *found,
+      const NoFingerprintMatcher *matcher = nullptr);
+  void addMatchingFingerprintFilters(Filter *filter, int numFilters,
+      const FingerprintAutomaton &automaton,
+      HashSet<FingerprintPostings> *postings, BloomFilter *bloomFilter,
+      const FilterOptionIndex *optionIndex, const MatchRequest &request,
+      std::vector<Filter *> *found);
+  void addMatchingDomainFilters(Filter *filter, int numFilters,
+      HashSet<FingerprintPostings> *postings, uint8_t flag, bool antiDomains,
+      const FilterOptionIndex *optionIndex, const MatchRequest &request,
+      std::vector<Filter *> *found);
+  // Adds the filters of |filter| stored in |postings| under the host of the
+  // request or one of its parent domains which match to |found|
+  void addMatchingHostAnchoredFilters(Filter *filter,
+      HashSet<FingerprintPostings> *postings, uint8_t flag,
+      const MatchRequest &request, std::vector<Filter *> *found);
+  // Rebuilds the option indexes for all of the filter lists which are
+  // matched against URLs.
+  void buildFilterOptionIndexes();
+  // Rebuilds both fingerprint automatons from the current filters
+  void buildFingerprintAutomatons();
+  // Rebuilds both no fingerprint matchers from the current filters
+  void buildNoFingerprintMatchers();
+  // Fills |lists| and |listSizes| with the filter lists which are matched
+  // against URLs and their sizes, in the same order as their option indexes
+  // in data files.
+  static const int kNumMatchedFilterLists = 8;
+  void getMatchedFilterLists(Filter ***lists, int **listSizes);
+  // Adds a hit for |filter| of the |filters| list when counting
+  void countFilterHit(const Filter *filters, const Filter *filter);
   void initBloomFilter(BloomFilter**, const char *buffer, int len);
   template<class T>
   bool initHashSet(HashSet<T>**, char *buffer, int len);
   char *deserializedBuffer;
+  MatchCache *matchCache;
+  MatchCache *hostDecisionCache;
+  // Results of findContextFilters while the host decision cache is enabled
+  static const size_t kContextFiltersCacheSize = 1024;
+  MatchCache *contextFiltersCache;
+  // One per list from getMatchedFilterLists while counting, else nullptr
+  FilterHitCounts *filterHitCounts;
+  bool filterOrderFrozen;
+  bool fingerprintAutomatonEnabled;
+  // Bumped whenever the filter lists or their order change, page contexts
+  // from an older generation are ignored by matches()
+  uint32_t filterGeneration;
 };
 
 extern std::set<std::string> unknownOptions;
 extern const char *separatorCharacters;
+// Parses a single rule into |f|.  The regular expression and the matcher of
+// the filter are only compiled when |compile| is set, passes which only
+// classify filters skip them.
 void parseFilter(const char *input, const char *end, Filter *f,
     BloomFilter *bloomFilter = nullptr,
     BloomFilter *exceptionBloomFilter = nullptr,
-    HashSet<Filter> *hostAnchoredHashSet = nullptr,
-    HashSet<Filter> *hostAnchoredExceptionHashSet = nullptr,
     HashSet<CosmeticFilter> *simpleCosmeticFilters = nullptr,
-    bool preserveRules = false);
+    bool preserveRules = false, bool compile = true);
 void parseFilter(const char *input, Filter *f,
     BloomFilter *bloomFilter = nullptr,
     BloomFilter *exceptionBloomFilter = nullptr,
-    HashSet<Filter> *hostAnchoredHashSet = nullptr,
-    HashSet<Filter> *hostAnchoredExceptionHashSet = nullptr,
     HashSet<CosmeticFilter> *simpleCosmeticFilters = nullptr,
-    bool preserveRules = false);
+    bool preserveRules = false, bool compile = true);
+// True for host anchored filters which can only match URLs whose host is
+// the filter's host or one of its subdomains, those are looked up by host.
+// Filters which would go to a domain specific list are left there.
+bool isHostIndexedFilter(Filter *f);
 bool isSeparatorChar(char c);
 int findFirstSeparatorChar(const char *input, const char *end);
 
@@ -7,9 +7,12 @@
 #include <node_buffer.h>
 #include <algorithm>
 #include <fstream>
+#include <string>
+#include <vector>
 #include "./bad_fingerprint.h"
 #include "./data_file_version.h"
 #include "./filter_list.h"
+#include "./match_cache.h"
 #include "./lists/regions.h"
 #include "./lists/malware.h"
 #include "./lists/default.h"
@@ -23,6 +26,7 @@ using v8::FunctionTemplate;
 using v8::Isolate;
 using v8::Local;
 using v8::MaybeLocal;
+using v8::Number;
 using v8::Int32;
 using v8::Object;
 using v8::Persistent;
@@ -105,8 +109,12 @@ void AdBlockClientWrap::Init(Local<Object> exports) {
   NODE_SET_PROTOTYPE_METHOD(tpl, "clear", AdBlockClientWrap::Clear);
   NODE_SET_PROTOTYPE_METHOD(tpl, "parse", AdBlockClientWrap::Parse);
   NODE_SET_PROTOTYPE_METHOD(tpl, "matches", AdBlockClientWrap::Matches);
+  NODE_SET_PROTOTYPE_METHOD(tpl, "matchesBatch",
+      AdBlockClientWrap::MatchesBatch);
   NODE_SET_PROTOTYPE_METHOD(tpl, "findMatchingFilters",
       AdBlockClientWrap::FindMatchingFilters);
+  NODE_SET_PROTOTYPE_METHOD(tpl, "findAllMatchingFilters",
+      AdBlockClientWrap::FindAllMatchingFilters);
   NODE_SET_PROTOTYPE_METHOD(tpl, "serialize", AdBlockClientWrap::Serialize);
   NODE_SET_PROTOTYPE_METHOD(tpl, "deserialize",
     AdBlockClientWrap::Deserialize);
@@ -118,6 +126,24 @@ void AdBlockClientWrap::Init(Local<Object> exports) {
     AdBlockClientWrap::GetFingerprint);
   NODE_SET_PROTOTYPE_METHOD(tpl, "getMatchingStats",
     AdBlockClientWrap::GetMatchingStats);
+  NODE_SET_PROTOTYPE_METHOD(tpl, "enableMatchCache",
+    AdBlockClientWrap::EnableMatchCache);
+  NODE_SET_PROTOTYPE_METHOD(tpl, "disableMatchCache",
+    AdBlockClientWrap::DisableMatchCache);
+  NODE_SET_PROTOTYPE_METHOD(tpl, "enableHostDecisionCache",
+    AdBlockClientWrap::EnableHostDecisionCache);
+  NODE_SET_PROTOTYPE_METHOD(tpl, "disableHostDecisionCache",
+    AdBlockClientWrap::DisableHostDecisionCache);
+  NODE_SET_PROTOTYPE_METHOD(tpl, "warmHostDecisionCache",
+    AdBlockClientWrap::WarmHostDecisionCache);
+  NODE_SET_PROTOTYPE_METHOD(tpl, "startFilterHitCounting",
+    AdBlockClientWrap::StartFilterHitCounting);
+  NODE_SET_PROTOTYPE_METHOD(tpl, "reorderFilters",
+    AdBlockClientWrap::ReorderFilters);
+  NODE_SET_PROTOTYPE_METHOD(tpl, "setFilterOrderFrozen",
+    AdBlockClientWrap::SetFilterOrderFrozen);
+  NODE_SET_PROTOTYPE_METHOD(tpl, "setFingerprintAutomatonEnabled",
+    AdBlockClientWrap::SetFingerprintAutomatonEnabled);
   NODE_SET_PROTOTYPE_METHOD(tpl, "enableBadFingerprintDetection",
     AdBlockClientWrap::EnableBadFingerprintDetection);
   NODE_SET_PROTOTYPE_METHOD(tpl, "generateBadFingerprintsHeader",
@@ -249,6 +275,51 @@ void AdBlockClientWrap::Matches(const FunctionCallbackInfo<Value>& args) {
   args.GetReturnValue().Set(Boolean::New(isolate, matches));
 }
 
+// Takes an array of URLs, a filter option or an array with one option per URL,
+// and the current page domain.  Returns an array of booleans.
+void AdBlockClientWrap::MatchesBatch(const FunctionCallbackInfo<Value>& args) {
+  Isolate* isolate = args.GetIsolate();
+  if (!args[0]->IsArray()) {
+    isolate->ThrowException(Exception::TypeError(
+      String::NewFromUtf8(isolate, "Wrong arguments")));
+    return;
+  }
+  Local<Array> urlArray = Local<Array>::Cast(args[0]);
+  const size_t n = urlArray->Length();
+  String::Utf8Value currentPageDomain(isolate, args[2]->ToString());
+  const char * currentPageDomainBuffer = *currentPageDomain;
+
+  std::vector<std::string> urls(n);
+  std::vector<const char *> urlBuffers(n);
+  std::vector<int> lens(n);
+  std::vector<FilterOption> filterOptions(n);
+  Local<Array> optionArray;
+  if (args[1]->IsArray()) {
+    optionArray = Local<Array>::Cast(args[1]);
+  }
+  for (size_t i = 0; i < n; i++) {
+    String::Utf8Value str(isolate, urlArray->Get(i)->ToString());
+    urls[i].assign(*str, str.length());
+    urlBuffers[i] = urls[i].c_str();
+    lens[i] = static_cast<int>(urls[i].length());
+    filterOptions[i] = static_cast<FilterOption>(optionArray.IsEmpty() ?
+      args[1]->Int32Value() : optionArray->Get(i)->Int32Value());
+  }
+
+  AdBlockClientWrap* obj =
+    ObjectWrap::Unwrap<AdBlockClientWrap>(args.Holder());
+  bool *matches = new bool[n];
+  obj->matchesBatch(urlBuffers.data(), lens.data(), filterOptions.data(),
+    currentPageDomainBuffer, matches, n);
+
+  Local<Array> result = Array::New(isolate, static_cast<int>(n));
+  for (size_t i = 0; i < n; i++) {
+    result->Set(i, Boolean::New(isolate, matches[i]));
+  }
+  delete[] matches;
+  args.GetReturnValue().Set(result);
+}
+
 void AdBlockClientWrap::FindMatchingFilters(
     const FunctionCallbackInfo<Value>& args) {
   Isolate* isolate = args.GetIsolate();
@@ -288,6 +359,53 @@ void AdBlockClientWrap::FindMatchingFilters(
   args.GetReturnValue().Set(foundData);
 }
 
+// Each filter is returned as an object with its data, and with its
+// original rule when the rules were kept while parsing.  The data of host
+// anchored filters isn't null terminated, so its length is always passed.
+static Local<Array> filtersToArray(Isolate *isolate,
+    const std::vector<Filter *> &filters) {
+  Local<Array> result = Array::New(isolate, static_cast<int>(filters.size()));
+  for (size_t i = 0; i < filters.size(); i++) {
+    Local<Object> filterData = Object::New(isolate);
+    filterData->Set(String::NewFromUtf8(isolate, "filter"),
+      String::NewFromUtf8(isolate, filters[i]->data,
+        v8::NewStringType::kNormal, filters[i]->dataLen).ToLocalChecked());
+    if (filters[i]->ruleDefinition != nullptr) {
+      filterData->Set(String::NewFromUtf8(isolate, "origRule"),
+        String::NewFromUtf8(isolate, filters[i]->ruleDefinition));
+    }
+    result->Set(i, filterData);
+  }
+  return result;
+}
+
+void AdBlockClientWrap::FindAllMatchingFilters(
+    const FunctionCallbackInfo<Value>& args) {
+  Isolate* isolate = args.GetIsolate();
+  String::Utf8Value str(isolate, args[0]->ToString());
+  const char * buffer = *str;
+  int32_t filterOption = static_cast<FilterOption>(args[1]->Int32Value());
+  String::Utf8Value currentPageDomain(isolate, args[2]->ToString());
+  const char * currentPageDomainBuffer = *currentPageDomain;
+
+  std::vector<Filter *> matchingFilters;
+  std::vector<Filter *> matchingExceptionFilters;
+  AdBlockClientWrap* obj =
+    ObjectWrap::Unwrap<AdBlockClientWrap>(args.Holder());
+  bool matches = obj->findAllMatchingFilters(buffer,
+    static_cast<FilterOption>(filterOption),
+    currentPageDomainBuffer, &matchingFilters, &matchingExceptionFilters);
+
+  Local<Object> foundData = Object::New(isolate);
+  foundData->Set(String::NewFromUtf8(isolate, "matches"),
+    Boolean::New(isolate, matches));
+  foundData->Set(String::NewFromUtf8(isolate, "matchingFilters"),
+    filtersToArray(isolate, matchingFilters));
+  foundData->Set(String::NewFromUtf8(isolate, "matchingExceptionFilters"),
+    filtersToArray(isolate, matchingExceptionFilters));
+  args.GetReturnValue().Set(foundData);
+}
+
 void AdBlockClientWrap::Serialize(const FunctionCallbackInfo<Value>& args) {
   Isolate* isolate = args.GetIsolate();
   AdBlockClientWrap* obj =
@@ -420,6 +538,12 @@ void AdBlockClientWrap::GetFilters(
         "noFingerprintAntiDomainOnlyExceptionFilters")) {
     filter = obj->noFingerprintAntiDomainOnlyExceptionFilters;
     numFilters = obj->numNoFingerprintAntiDomainOnlyExceptionFilters;
+  } else if (!strcmp(filterType, "hostAnchoredFilters")) {
+    filter = obj->hostAnchoredFilters;
+    numFilters = obj->numHostAnchoredFilters;
+  } else if (!strcmp(filterType, "hostAnchoredExceptionFilters")) {
+    filter = obj->hostAnchoredExceptionFilters;
+    numFilters = obj->numHostAnchoredExceptionFilters;
   }
 
   for (int i = 0; i < numFilters; i++) {
@@ -543,9 +667,130 @@ void AdBlockClientWrap::GetMatchingStats(
     Int32::New(isolate, obj->numHashSetSaves));
   stats->Set(String::NewFromUtf8(isolate, "numExceptionHashSetSaves"),
     Int32::New(isolate, obj->numExceptionHashSetSaves));
+  MatchCache *matchCache = obj->getMatchCache();
+  stats->Set(String::NewFromUtf8(isolate, "numMatchCacheHits"),
+    Number::New(isolate, matchCache ?
+      static_cast<double>(matchCache->getNumHits()) : 0));
+  stats->Set(String::NewFromUtf8(isolate, "numMatchCacheMisses"),
+    Number::New(isolate, matchCache ?
+      static_cast<double>(matchCache->getNumMisses()) : 0));
+  stats->Set(String::NewFromUtf8(isolate, "numMatchCacheEvictions"),
+    Number::New(isolate, matchCache ?
+      static_cast<double>(matchCache->getNumEvictions()) : 0));
+  stats->Set(String::NewFromUtf8(isolate, "numMatchCacheEntries"),
+    Number::New(isolate, matchCache ?
+      static_cast<double>(matchCache->getNumEntries()) : 0));
+  MatchCache *hostDecisionCache = obj->getHostDecisionCache();
+  stats->Set(String::NewFromUtf8(isolate, "numHostDecisionSaves"),
+    Int32::New(isolate, obj->numHostDecisionSaves));
+  stats->Set(String::NewFromUtf8(isolate, "numHostDecisionCacheHits"),
+    Number::New(isolate, hostDecisionCache ?
+      static_cast<double>(hostDecisionCache->getNumHits()) : 0));
+  stats->Set(String::NewFromUtf8(isolate, "numHostDecisionCacheMisses"),
+    Number::New(isolate, hostDecisionCache ?
+      static_cast<double>(hostDecisionCache->getNumMisses()) : 0));
+  stats->Set(String::NewFromUtf8(isolate, "numHostDecisionCacheEvictions"),
+    Number::New(isolate, hostDecisionCache ?
+      static_cast<double>(hostDecisionCache->getNumEvictions()) : 0));
+  stats->Set(String::NewFromUtf8(isolate, "numHostDecisionCacheEntries"),
+    Number::New(isolate, hostDecisionCache ?
+      static_cast<double>(hostDecisionCache->getNumEntries()) : 0));
   args.GetReturnValue().Set(stats);
 }
 
+void AdBlockClientWrap::EnableMatchCache(
+    const v8::FunctionCallbackInfo<v8::Value>& args) {
+  AdBlockClientWrap* obj =
+    ObjectWrap::Unwrap<AdBlockClientWrap>(args.Holder());
+  double maxEntries = args[0]->IsNumber() ? args[0]->NumberValue() : 0;
+  double maxBytes = args[1]->IsNumber() ? args[1]->NumberValue() : 0;
+  obj->enableMatchCache(maxEntries > 0 ? static_cast<size_t>(maxEntries) : 0,
+      maxBytes > 0 ? static_cast<size_t>(maxBytes) : 0);
+}
+
+void AdBlockClientWrap::DisableMatchCache(
+    const v8::FunctionCallbackInfo<v8::Value>& args) {
+  AdBlockClientWrap* obj =
+    ObjectWrap::Unwrap<AdBlockClientWrap>(args.Holder());
+  obj->disableMatchCache();
+}
+
+void AdBlockClientWrap::EnableHostDecisionCache(
+    const v8::FunctionCallbackInfo<v8::Value>& args) {
+  AdBlockClientWrap* obj =
+    ObjectWrap::Unwrap<AdBlockClientWrap>(args.Holder());
+  double maxEntries = args[0]->IsNumber() ? args[0]->NumberValue() : 0;
+  double maxBytes = args[1]->IsNumber() ? args[1]->NumberValue() : 0;
+  obj->enableHostDecisionCache(
+      maxEntries > 0 ? static_cast<size_t>(maxEntries) : 0,
+      maxBytes > 0 ? static_cast<size_t>(maxBytes) : 0);
+}
+
+void AdBlockClientWrap::DisableHostDecisionCache(
+    const v8::FunctionCallbackInfo<v8::Value>& args) {
+  AdBlockClientWrap* obj =
+    ObjectWrap::Unwrap<AdBlockClientWrap>(args.Holder());
+  obj->disableHostDecisionCache();
+}
+
+void AdBlockClientWrap::WarmHostDecisionCache(
+    const v8::FunctionCallbackInfo<v8::Value>& args) {
+  Isolate* isolate = args.GetIsolate();
+  if (!args[0]->IsArray()) {
+    isolate->ThrowException(Exception::TypeError(
+      String::NewFromUtf8(isolate, "Wrong arguments")));
+    return;
+  }
+  AdBlockClientWrap* obj =
+    ObjectWrap::Unwrap<AdBlockClientWrap>(args.Holder());
+  Local<Array> hostArray = Local<Array>::Cast(args[0]);
+  const size_t n = hostArray->Length();
+  std::vector<std::string> hosts(n);
+  std::vector<const char *> hostBuffers(n);
+  for (size_t i = 0; i < n; i++) {
+    String::Utf8Value str(isolate, hostArray->Get(i)->ToString());
+    hosts[i].assign(*str, str.length());
+    hostBuffers[i] = hosts[i].c_str();
+  }
+  FilterOption filterOption = args[1]->IsNumber() ?
+    static_cast<FilterOption>(args[1]->Int32Value()) : FONoFilterOption;
+  std::string contextDomain;
+  if (args[2]->IsString()) {
+    String::Utf8Value str(isolate, args[2]->ToString());
+    contextDomain.assign(*str, str.length());
+  }
+  obj->warmHostDecisionCache(hostBuffers.data(), n, filterOption,
+      args[2]->IsString() ? contextDomain.c_str() : nullptr);
+}
+
+void AdBlockClientWrap::StartFilterHitCounting(
+    const v8::FunctionCallbackInfo<v8::Value>& args) {
+  AdBlockClientWrap* obj =
+    ObjectWrap::Unwrap<AdBlockClientWrap>(args.Holder());
+  obj->startFilterHitCounting();
+}
+
+void AdBlockClientWrap::ReorderFilters(
+    const v8::FunctionCallbackInfo<v8::Value>& args) {
+  AdBlockClientWrap* obj =
+    ObjectWrap::Unwrap<AdBlockClientWrap>(args.Holder());
+  obj->reorderFilters();
+}
+
+void AdBlockClientWrap::SetFilterOrderFrozen(
+    const v8::FunctionCallbackInfo<v8::Value>& args) {
+  AdBlockClientWrap* obj =
+    ObjectWrap::Unwrap<AdBlockClientWrap>(args.Holder());
+  obj->setFilterOrderFrozen(args[0]->BooleanValue());
+}
+
+void AdBlockClientWrap::SetFingerprintAutomatonEnabled(
+    const v8::FunctionCallbackInfo<v8::Value>& args) {
+  AdBlockClientWrap* obj =
+    ObjectWrap::Unwrap<AdBlockClientWrap>(args.Holder());
+  obj->setFingerprintAutomatonEnabled(args[0]->BooleanValue());
+}
+
 void AdBlockClientWrap::EnableBadFingerprintDetection(
     const v8::FunctionCallbackInfo<v8::Value>& args) {
   AdBlockClientWrap* obj =
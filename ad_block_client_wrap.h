@@ -29,6 +29,7 @@ class AdBlockClientWrap : public AdBlockClient, public node::ObjectWrap {
   static void Clear(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void Parse(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void Matches(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void MatchesBatch(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void Serialize(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void Deserialize(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void Cleanup(const v8::FunctionCallbackInfo<v8::Value>& args);
@@ -36,6 +37,24 @@ class AdBlockClientWrap : public AdBlockClient, public node::ObjectWrap {
   static void GetMatchingStats(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void GetFilters(const v8::FunctionCallbackInfo<v8::Value>& args);
   static void GetFingerprint(const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void EnableMatchCache(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void DisableMatchCache(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void EnableHostDecisionCache(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void DisableHostDecisionCache(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void WarmHostDecisionCache(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void StartFilterHitCounting(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void ReorderFilters(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void SetFilterOrderFrozen(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void SetFingerprintAutomatonEnabled(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
   static void EnableBadFingerprintDetection(
       const v8::FunctionCallbackInfo<v8::Value>& args);
   static void GenerateBadFingerprintsHeader(
@@ -46,6 +65,8 @@ class AdBlockClientWrap : public AdBlockClient, public node::ObjectWrap {
       const v8::FunctionCallbackInfo<v8::Value>& args);
   static void FindMatchingFilters(
       const v8::FunctionCallbackInfo<v8::Value>& args);
+  static void FindAllMatchingFilters(
+      const v8::FunctionCallbackInfo<v8::Value>& args);
 
   static v8::Persistent<v8::Function> constructor;
 };
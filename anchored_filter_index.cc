@@ -0,0 +1,351 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "./anchored_filter_index.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+
+#include "./filter.h"
+#include "./match_request.h"
+#include "./serialization.h"
+#include "./url_lexer.h"
+
+// Bytes for each node in serialized data: first edge, number of edges and
+// ids offset.
+static const int kSerializedNodeSize = 12;
+
+AnchoredFilterIndex::Trie::Trie() :
+    nodes(nullptr),
+    numNodes(0),
+    edgeBytes(nullptr),
+    edgeNodes(nullptr),
+    numEdges(0),
+    ids(nullptr),
+    numIds(0) {
+}
+
+AnchoredFilterIndex::Trie::~Trie() {
+  clear();
+}
+
+void AnchoredFilterIndex::Trie::clear() {
+  if (nodes) {
+    delete[] nodes;
+    nodes = nullptr;
+  }
+  if (edgeBytes) {
+    delete[] edgeBytes;
+    edgeBytes = nullptr;
+  }
+  if (edgeNodes) {
+    delete[] edgeNodes;
+    edgeNodes = nullptr;
+  }
+  if (ids) {
+    delete[] ids;
+    ids = nullptr;
+  }
+  numNodes = 0;
+  numEdges = 0;
+  numIds = 0;
+}
+
+void AnchoredFilterIndex::Trie::build(
+    const std::map<std::string, std::vector<int> > &keys) {
+  clear();
+  std::vector<const std::map<std::string, std::vector<int> >::value_type *>
+    sortedKeys;
+  for (const auto &key : keys) {
+    sortedKeys.push_back(&key);
+  }
+
+  // Nodes are made breadth first, each for the range of keys which share
+  // its first |depth| bytes.  Keys are sorted by unsigned bytes, so a key
+  // ending at a node comes first in its range and the keys under each
+  // child follow each other.
+  struct Range {
+    int start;
+    int end;
+    int depth;
+  };
+  std::vector<Range> ranges(1, { 0, static_cast<int>(sortedKeys.size()), 0 });
+  std::vector<Node> newNodes;
+  std::vector<char> newEdgeBytes;
+  std::vector<int> newEdgeNodes;
+  std::vector<int> newIds;
+  for (size_t i = 0; i < ranges.size(); i++) {
+    int start = ranges[i].start;
+    const int end = ranges[i].end;
+    const size_t depth = ranges[i].depth;
+    Node node;
+    node.ids = -1;
+    if (start < end && sortedKeys[start]->first.size() == depth) {
+      const std::vector<int> &keyIds = sortedKeys[start]->second;
+      node.ids = static_cast<int>(newIds.size());
+      newIds.push_back(static_cast<int>(keyIds.size()));
+      newIds.insert(newIds.end(), keyIds.begin(), keyIds.end());
+      start++;
+    }
+    node.firstEdge = static_cast<int>(newEdgeBytes.size());
+    while (start < end) {
+      const char c = sortedKeys[start]->first[depth];
+      int childEnd = start + 1;
+      while (childEnd < end && sortedKeys[childEnd]->first[depth] == c) {
+        childEnd++;
+      }
+      newEdgeBytes.push_back(c);
+      newEdgeNodes.push_back(static_cast<int>(ranges.size()));
+      ranges.push_back({ start, childEnd, static_cast<int>(depth) + 1 });
+      start = childEnd;
+    }
+    node.numEdges = static_cast<int>(newEdgeBytes.size()) - node.firstEdge;
+    newNodes.push_back(node);
+  }
+
+  numNodes = static_cast<int>(newNodes.size());
+  nodes = new Node[numNodes];
+  std::copy(newNodes.begin(), newNodes.end(), nodes);
+  numEdges = static_cast<int>(newEdgeBytes.size());
+  edgeBytes = new char[numEdges > 0 ? numEdges : 1];
+  std::copy(newEdgeBytes.begin(), newEdgeBytes.end(), edgeBytes);
+  edgeNodes = new int[numEdges > 0 ? numEdges : 1];
+  std::copy(newEdgeNodes.begin(), newEdgeNodes.end(), edgeNodes);
+  numIds = static_cast<int>(newIds.size());
+  ids = new int[numIds > 0 ? numIds : 1];
+  std::copy(newIds.begin(), newIds.end(), ids);
+}
+
+void AnchoredFilterIndex::Trie::find(const char *input, int len,
+    bool reversed, uint64_t *candidates) const {
+  int nodeIndex = 0;
+  for (int i = 0; ; i++) {
+    const Node &node = nodes[nodeIndex];
+    if (node.ids != -1) {
+      const int *nodeIds = ids + node.ids + 1;
+      for (int j = 0; j < ids[node.ids]; j++) {
+        candidates[nodeIds[j] / 64] |= 1ULL << (nodeIds[j] % 64);
+      }
+    }
+    if (i == len || node.numEdges == 0) {
+      return;
+    }
+    const unsigned char c =
+      static_cast<unsigned char>(input[reversed ? len - 1 - i : i]);
+    int low = node.firstEdge;
+    int high = node.firstEdge + node.numEdges - 1;
+    while (low < high) {
+      const int mid = (low + high) / 2;
+      if (static_cast<unsigned char>(edgeBytes[mid]) < c) {
+        low = mid + 1;
+      } else {
+        high = mid;
+      }
+    }
+    if (static_cast<unsigned char>(edgeBytes[low]) != c) {
+      return;
+    }
+    nodeIndex = edgeNodes[low];
+  }
+}
+
+uint32_t AnchoredFilterIndex::Trie::Serialize(char *buffer) const {
+  char sz[32];
+  uint32_t totalSize = snprintf(sz, sizeof(sz), "%x,%x,%x", numNodes,
+      numEdges, numIds) + 1;
+  if (buffer) {
+    memcpy(buffer, sz, totalSize);
+  }
+
+  if (buffer) {
+    char *p = buffer + totalSize;
+    for (int i = 0; i < numNodes; i++) {
+      writeUint32(p, nodes[i].firstEdge);
+      writeUint32(p + 4, nodes[i].numEdges);
+      writeUint32(p + 8, nodes[i].ids);
+      p += kSerializedNodeSize;
+    }
+    memcpy(p, edgeBytes, numEdges);
+    p += numEdges;
+    for (int i = 0; i < numEdges; i++) {
+      writeUint32(p, edgeNodes[i]);
+      p += 4;
+    }
+    for (int i = 0; i < numIds; i++) {
+      writeUint32(p, ids[i]);
+      p += 4;
+    }
+  }
+  totalSize += numNodes * kSerializedNodeSize + numEdges * 5 + numIds * 4;
+  return totalSize;
+}
+
+uint32_t AnchoredFilterIndex::Trie::Deserialize(const char *buffer,
+    uint32_t bufferSize, int numFilters) {
+  clear();
+  const char *end = static_cast<const char *>(memchr(buffer, '\0',
+        bufferSize));
+  if (!end) {
+    return 0;
+  }
+  char *p;
+  const int newNumNodes = static_cast<int>(strtol(buffer, &p, 16));
+  if (*p != ',') {
+    return 0;
+  }
+  const int newNumEdges = static_cast<int>(strtol(p + 1, &p, 16));
+  if (*p != ',') {
+    return 0;
+  }
+  const int newNumIds = static_cast<int>(strtol(p + 1, &p, 16));
+  if (newNumNodes <= 0 || newNumEdges < 0 || newNumIds < 0) {
+    return 0;
+  }
+  const uint32_t consumed = static_cast<uint32_t>(end - buffer) + 1;
+  const uint32_t dataSize =
+    static_cast<uint32_t>(newNumNodes) * kSerializedNodeSize +
+    static_cast<uint32_t>(newNumEdges) * 5 +
+    static_cast<uint32_t>(newNumIds) * 4;
+  if (consumed + dataSize > bufferSize) {
+    return 0;
+  }
+
+  const char *q = buffer + consumed;
+  Node *newNodes = new Node[newNumNodes];
+  for (int i = 0; i < newNumNodes; i++) {
+    newNodes[i].firstEdge = static_cast<int>(readUint32(q));
+    newNodes[i].numEdges = static_cast<int>(readUint32(q + 4));
+    newNodes[i].ids = static_cast<int>(readUint32(q + 8));
+    q += kSerializedNodeSize;
+  }
+  char *newEdgeBytes = new char[newNumEdges > 0 ? newNumEdges : 1];
+  memcpy(newEdgeBytes, q, newNumEdges);
+  q += newNumEdges;
+  int *newEdgeNodes = new int[newNumEdges > 0 ? newNumEdges : 1];
+  for (int i = 0; i < newNumEdges; i++) {
+    newEdgeNodes[i] = static_cast<int>(readUint32(q));
+    q += 4;
+  }
+  int *newIds = new int[newNumIds > 0 ? newNumIds : 1];
+  for (int i = 0; i < newNumIds; i++) {
+    newIds[i] = static_cast<int>(readUint32(q));
+    q += 4;
+  }
+
+  // The edges of each node have to be in the array, sorted and lead to
+  // later nodes, and the ids of each node in the ids array and below
+  // |numFilters|.
+  bool valid = true;
+  for (int i = 0; i < newNumNodes && valid; i++) {
+    const Node &node = newNodes[i];
+    valid = node.firstEdge >= 0 && node.numEdges >= 0 &&
+      node.numEdges <= newNumEdges - node.firstEdge &&
+      node.ids >= -1 && node.ids < newNumIds;
+    for (int j = node.firstEdge; valid && j < node.firstEdge + node.numEdges;
+        j++) {
+      valid = newEdgeNodes[j] > i && newEdgeNodes[j] < newNumNodes &&
+        (j == node.firstEdge ||
+         static_cast<unsigned char>(newEdgeBytes[j - 1]) <
+         static_cast<unsigned char>(newEdgeBytes[j]));
+    }
+    if (valid && node.ids != -1) {
+      const int count = newIds[node.ids];
+      valid = count >= 0 && count < newNumIds - node.ids;
+      for (int j = 1; valid && j <= count; j++) {
+        valid = newIds[node.ids + j] >= 0 &&
+          newIds[node.ids + j] < numFilters;
+      }
+    }
+  }
+  if (!valid) {
+    delete[] newNodes;
+    delete[] newEdgeBytes;
+    delete[] newEdgeNodes;
+    delete[] newIds;
+    return 0;
+  }
+
+  nodes = newNodes;
+  numNodes = newNumNodes;
+  edgeBytes = newEdgeBytes;
+  edgeNodes = newEdgeNodes;
+  numEdges = newNumEdges;
+  ids = newIds;
+  numIds = newNumIds;
+  return consumed + dataSize;
+}
+
+AnchoredFilterIndex::AnchoredFilterIndex() {
+}
+
+AnchoredFilterIndex::~AnchoredFilterIndex() {
+}
+
+bool AnchoredFilterIndex::isIndexed(const Filter &filter) {
+  return filter.data && (filter.shape == FSLeftAnchored ||
+      filter.shape == FSRightAnchored || filter.shape == FSExact);
+}
+
+void AnchoredFilterIndex::clear() {
+  prefixes.clear();
+  suffixes.clear();
+}
+
+void AnchoredFilterIndex::build(const Filter *filters, int numFilters) {
+  // URLs are walked lowercased, so are the keys of match-case filters.  A
+  // filter matching the whole URL is a candidate when its data is a prefix.
+  std::map<std::string, std::vector<int> > prefixKeys;
+  std::map<std::string, std::vector<int> > suffixKeys;
+  for (int i = 0; i < numFilters; i++) {
+    const Filter &filter = filters[i];
+    if (!isIndexed(filter)) {
+      continue;
+    }
+    const int dataLen = filter.dataLen == -1 ?
+      static_cast<int>(strlen(filter.data)) : filter.dataLen;
+    std::string key(filter.data, dataLen);
+    lowercaseAscii(&key[0], dataLen, &key[0]);
+    if (filter.shape == FSRightAnchored) {
+      std::reverse(key.begin(), key.end());
+      suffixKeys[key].push_back(i);
+    } else {
+      prefixKeys[key].push_back(i);
+    }
+  }
+  prefixes.build(prefixKeys);
+  suffixes.build(suffixKeys);
+}
+
+void AnchoredFilterIndex::findCandidates(const MatchRequest &request,
+    uint64_t *candidates) const {
+  prefixes.find(request.input, request.inputLen, false, candidates);
+  suffixes.find(request.input, request.inputLen, true, candidates);
+}
+
+uint32_t AnchoredFilterIndex::Serialize(char *buffer) const {
+  if (!isBuilt()) {
+    return 0;
+  }
+  const uint32_t prefixesSize = prefixes.Serialize(buffer);
+  return prefixesSize +
+    suffixes.Serialize(buffer ? buffer + prefixesSize : nullptr);
+}
+
+uint32_t AnchoredFilterIndex::Deserialize(const char *buffer,
+    uint32_t bufferSize, int numFilters) {
+  clear();
+  const uint32_t prefixesSize = prefixes.Deserialize(buffer, bufferSize,
+      numFilters);
+  const uint32_t suffixesSize = prefixesSize == 0 ? 0 :
+    suffixes.Deserialize(buffer + prefixesSize, bufferSize - prefixesSize,
+        numFilters);
+  if (suffixesSize == 0) {
+    clear();
+    return 0;
+  }
+  return prefixesSize + suffixesSize;
+}
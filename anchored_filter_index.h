@@ -0,0 +1,101 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef ANCHORED_FILTER_INDEX_H_
+#define ANCHORED_FILTER_INDEX_H_
+
+#include <stdint.h>
+#include <map>
+#include <string>
+#include <vector>
+#include "./base.h"
+
+class Filter;
+class MatchRequest;
+
+// The left anchored filters of a list, like |https://ads., in a trie of
+// their data and the right anchored ones, like .swf|, in a trie of their
+// data read backwards.  Walking the start of a URL down the first trie and
+// its end down the second finds every anchored filter which matches it,
+// instead of comparing each of them with the URL.  The children of a node
+// are kept together sorted by byte, so a step is a binary search.
+class AnchoredFilterIndex {
+ public:
+  AnchoredFilterIndex();
+  ~AnchoredFilterIndex();
+
+  // Whether |filter| is looked up here rather than by its data anywhere in
+  // the URL
+  static bool isIndexed(const Filter &filter);
+
+  void clear();
+  // Builds the tries for the indexed filters of |filters|
+  void build(const Filter *filters, int numFilters);
+  bool isBuilt() const {
+    return prefixes.numNodes > 0;
+  }
+  int getNumNodes() const {
+    return prefixes.numNodes + suffixes.numNodes;
+  }
+
+  // Sets the bit in |candidates| of each indexed filter which matches the
+  // start or the end of the lowercased input of |request|
+  void findCandidates(const MatchRequest &request,
+      uint64_t *candidates) const;
+
+  // Serializes the index into |buffer| and returns the number of bytes
+  // used.  Passing nullptr only returns the size.
+  uint32_t Serialize(char *buffer) const;
+  // Loads an index written by Serialize for a list of |numFilters|
+  // filters and returns the number of bytes consumed, or 0 if the buffer
+  // doesn't hold a valid index.
+  uint32_t Deserialize(const char *buffer, uint32_t bufferSize,
+      int numFilters);
+
+ private:
+  AnchoredFilterIndex(const AnchoredFilterIndex &);
+  void operator=(const AnchoredFilterIndex &);
+
+  // Node 0 is the root.  The edges of a node are |numEdges| entries of
+  // |edgeBytes| and |edgeNodes| from |firstEdge|, and always lead to nodes
+  // after it.
+  struct Node {
+    int firstEdge;
+    int numEdges;
+    // Offset in |ids| of the count and filter ids, -1 for none
+    int ids;
+  };
+
+  struct Trie {
+    Trie();
+    ~Trie();
+    void clear();
+    void build(const std::map<std::string, std::vector<int> > &keys);
+    // Sets the bits of the ids of each node reached by reading |len| bytes
+    // of |input| forwards, or backwards from its end when |reversed|
+    void find(const char *input, int len, bool reversed,
+        uint64_t *candidates) const;
+    uint32_t Serialize(char *buffer) const;
+    uint32_t Deserialize(const char *buffer, uint32_t bufferSize,
+        int numFilters);
+
+    Node *nodes;
+    int numNodes;
+    char *edgeBytes;
+    int *edgeNodes;
+    int numEdges;
+    int *ids;
+    int numIds;
+
+   private:
+    Trie(const Trie &);
+    void operator=(const Trie &);
+  };
+
+  Trie prefixes;
+  Trie suffixes;
+};
+
+#endif  // ANCHORED_FILTER_INDEX_H_
@@ -12,6 +12,14 @@
 
 #include <stdint.h>
 
+// Hints that the memory at |p| is about to be read.  It is only a hint, so
+// it is fine to pass any address.
+#if defined(__GNUC__) || defined(__clang__)
+#define PREFETCH(p) __builtin_prefetch(p)
+#else
+#define PREFETCH(p)
+#endif
+
 #if defined(_MSC_VER) && _MSC_VER < 1900
 #include <stdarg.h>
 #include <stdio.h>
@@ -0,0 +1,60 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef BIGRAM_SIGNATURE_H_
+#define BIGRAM_SIGNATURE_H_
+
+#include <stdint.h>
+#include "./base.h"
+
+// A fixed size set of the 2 byte substrings of a string, with one bit for
+// each hashed bigram.  A filter keeps the signature of the bigrams every
+// matching URL has to contain and each URL check builds the signature of
+// the URL, so a filter can be ruled out with 2 ANDs before looking at its
+// options or data.
+class BigramSignature {
+ public:
+  static const int kBits = 128;
+
+  BigramSignature() {
+    clear();
+  }
+
+  void clear() {
+    words[0] = 0;
+    words[1] = 0;
+  }
+  // Adds the 2 bytes at |p|
+  void add(const char *p) {
+    const int bit = bitFor(p);
+    words[bit >> 6] |= 1ULL << (bit & 63);
+  }
+  // Adds every bigram of |len| bytes at |p|
+  void addAll(const char *p, int len) {
+    for (int i = 1; i < len; i++) {
+      add(p + i - 1);
+    }
+  }
+  // False only if some bigram of |other| is not in this signature
+  bool contains(const BigramSignature &other) const {
+    return !(other.words[0] & ~words[0]) && !(other.words[1] & ~words[1]);
+  }
+  bool empty() const {
+    return !words[0] && !words[1];
+  }
+
+  uint64_t words[kBits / 64];
+
+ private:
+  // The top 7 bits of a multiplicative hash of the 2 bytes
+  static int bitFor(const char *p) {
+    const uint32_t bigram = (static_cast<uint32_t>(
+          static_cast<unsigned char>(p[0])) << 8) |
+      static_cast<unsigned char>(p[1]);
+    return static_cast<int>((bigram * 2654435761U) >> 25);
+  }
+};
+
+#endif  // BIGRAM_SIGNATURE_H_
@@ -15,8 +15,38 @@
       "filter.h",
       "filter_list.cc",
       "filter_list.h",
-      "no_fingerprint_domain.cc",
-      "no_fingerprint_domain.h",
+      "filter_option_index.cc",
+      "filter_option_index.h",
+      "index_of_filter.cc",
+      "index_of_filter.h",
+      "match_cache.cc",
+      "match_cache.h",
+      "match_request.cc",
+      "match_request.h",
+      "page_context.cc",
+      "page_context.h",
+      "host_suffix_trie.cc",
+      "host_suffix_trie.h",
+      "filter_hit_counts.cc",
+      "filter_hit_counts.h",
+      "public_suffix_list.cc",
+      "public_suffix_list.h",
+      "public_suffix_list_data.h",
+      "url_lexer.cc",
+      "url_lexer.h",
+      "bigram_signature.h",
+      "fingerprint_automaton.cc",
+      "fingerprint_automaton.h",
+      "no_fingerprint_matcher.cc",
+      "no_fingerprint_matcher.h",
+      "regex_literals.cc",
+      "regex_literals.h",
+      "serialization.cc",
+      "serialization.h",
+      "anchored_filter_index.cc",
+      "anchored_filter_index.h",
+      "fingerprint_postings.cc",
+      "fingerprint_postings.h",
       "protocol.cc",
       "protocol.h",
       "./node_modules/bloom-filter-cpp/BloomFilter.cpp",
@@ -10,26 +10,24 @@
 #include <set>
 #include <string>
 
-#ifdef ENABLE_REGEX
-#include <regex> // NOLINT
-#endif
-
 #include "./filter.h"
 #include "hashFn.h"
 #include "./ad_block_client.h"
+#include "./index_of_filter.h"
+#include "./match_request.h"
+#include "./url_lexer.h"
 
 #include "BloomFilter.h"
 #include "hash_set.h"
 
 static HashFn h(19);
 
-const char * getUrlHost(const char *input, int *len);
-
 Filter::Filter() :
   borrowed_data(false),
   filterType(FTNoFilterType),
   filterOption(FONoFilterOption),
   antiFilterOption(FONoFilterOption),
+  minInputLen(0),
   ruleDefinition(nullptr),
   data(nullptr),
   dataLen(-1),
@@ -38,10 +36,23 @@ Filter::Filter() :
   hostLen(-1),
   domains(nullptr),
   antiDomains(nullptr),
-  domainsParsed(false) {
+  domainsParsed(false)
+#ifdef ENABLE_REGEX
+  , regex(nullptr)
+#endif
+  , shape(FSUnknown),
+  partEnds(nullptr) {
 }
 
 Filter::~Filter() {
+#ifdef ENABLE_REGEX
+  if (regex) {
+    delete regex;
+  }
+#endif
+  if (partEnds) {
+    delete[] partEnds;
+  }
   if (domains) {
     delete domains;
   }
@@ -68,13 +79,21 @@ Filter::Filter(const char * data, int dataLen, char *domainList,
                const char * host, int hostLen) :
       borrowed_data(true), filterType(FTNoFilterType),
       filterOption(FONoFilterOption),
-      antiFilterOption(FONoFilterOption), ruleDefinition(nullptr),
+      antiFilterOption(FONoFilterOption), minInputLen(0),
+      ruleDefinition(nullptr),
       data(const_cast<char*>(data)), dataLen(dataLen),
       domainList(domainList), host(const_cast<char*>(host)),
       hostLen(hostLen),
       domains(nullptr),
       antiDomains(nullptr),
-      domainsParsed(false) {
+      domainsParsed(false)
+#ifdef ENABLE_REGEX
+      , regex(nullptr)
+#endif
+      , shape(FSUnknown),
+      partEnds(nullptr) {
+    parseDomains(domainList);
+    compileRegex();
   }
 
 Filter::Filter(FilterType filterType, FilterOption filterOption,
@@ -84,13 +103,21 @@ Filter::Filter(FilterType filterType, FilterOption filterOption,
                int hostLen) :
       borrowed_data(true), filterType(filterType),
       filterOption(filterOption),
-      antiFilterOption(antiFilterOption), ruleDefinition(nullptr),
+      antiFilterOption(antiFilterOption), minInputLen(0),
+      ruleDefinition(nullptr),
       data(const_cast<char*>(data)), dataLen(dataLen),
       domainList(domainList), host(const_cast<char *>(host)),
       hostLen(hostLen),
       domains(nullptr),
       antiDomains(nullptr),
-      domainsParsed(false) {
+      domainsParsed(false)
+#ifdef ENABLE_REGEX
+      , regex(nullptr)
+#endif
+      , shape(FSUnknown),
+      partEnds(nullptr) {
+    parseDomains(domainList);
+    compileRegex();
   }
 
 Filter::Filter(const Filter &other) {
@@ -98,11 +125,17 @@ Filter::Filter(const Filter &other) {
   filterType = other.filterType;
   filterOption = other.filterOption;
   antiFilterOption = other.antiFilterOption;
+  minInputLen = 0;
   dataLen = other.dataLen;
   hostLen = other.hostLen;
   domainsParsed = false;
   domains = nullptr;
   antiDomains = nullptr;
+#ifdef ENABLE_REGEX
+  regex = nullptr;
+#endif
+  shape = FSUnknown;
+  partEnds = nullptr;
   if (other.dataLen == -1 && other.data) {
     dataLen = static_cast<int>(strlen(other.data));
   }
@@ -142,12 +175,21 @@ Filter::Filter(const Filter &other) {
       ruleDefinition = nullptr;
     }
   }
+
+  // The domain sets are not shared, so build our own from our domain list
+  if (other.domainsParsed) {
+    parseDomains(domainList);
+  }
+  compileRegex();
+  compileMatcher();
 }
 
 void Filter::swapData(Filter *other) {
   FilterType tempFilterType = filterType;
   FilterOption tempFilterOption = filterOption;
   FilterOption tempAntiFilterOption = antiFilterOption;
+  BigramSignature tempSignature = signature;
+  int tempMinInputLen = minInputLen;
   char *tempData = data;
   int tempDataLen = dataLen;
   char *tempRuleDefinition = ruleDefinition;
@@ -157,10 +199,17 @@ void Filter::swapData(Filter *other) {
   bool tempDomainsParsed = domainsParsed;
   HashSet<ContextDomain>* tempDomains = domains;
   HashSet<ContextDomain>* tempAntiDomains = antiDomains;
+#ifdef ENABLE_REGEX
+  std::regex *tempRegex = regex;
+#endif
+  FilterShape tempShape = shape;
+  int *tempPartEnds = partEnds;
 
   filterType = other->filterType;
   filterOption = other->filterOption;
   antiFilterOption = other->antiFilterOption;
+  signature = other->signature;
+  minInputLen = other->minInputLen;
   ruleDefinition = other->ruleDefinition;;
   data = other->data;
   dataLen = other->dataLen;
@@ -170,10 +219,17 @@ void Filter::swapData(Filter *other) {
   domainsParsed = other->domainsParsed;
   domains = other->domains;
   antiDomains = other->antiDomains;
+#ifdef ENABLE_REGEX
+  regex = other->regex;
+#endif
+  shape = other->shape;
+  partEnds = other->partEnds;
 
   other->filterType = tempFilterType;
   other->filterOption = tempFilterOption;
   other->antiFilterOption = tempAntiFilterOption;
+  other->signature = tempSignature;
+  other->minInputLen = tempMinInputLen;
   other->ruleDefinition = tempRuleDefinition;
   other->data = tempData;
   other->dataLen = tempDataLen;
@@ -183,6 +239,11 @@ void Filter::swapData(Filter *other) {
   other->domainsParsed = tempDomainsParsed;
   other->domains = tempDomains;
   other->antiDomains = tempAntiDomains;
+#ifdef ENABLE_REGEX
+  other->regex = tempRegex;
+#endif
+  other->shape = tempShape;
+  other->partEnds = tempPartEnds;
 }
 
 bool Filter::containsDomain(const char* domain, size_t domainLen,
@@ -200,8 +261,7 @@ bool Filter::containsDomain(const char* domain, size_t domainLen,
   return antiDomains->Exists(ContextDomain(domain, domainLen));
 }
 
-uint32_t Filter::getDomainCount(bool anti) {
-  parseDomains(domainList);
+uint32_t Filter::getDomainCount(bool anti) const {
   if (anti) {
     if (!antiDomains) {
       return 0;
@@ -294,6 +354,8 @@ void Filter::parseOption(const char *input, int len) {
     *pFilterOption = static_cast<FilterOption>(*pFilterOption | FOEmpty);
   } else if (!strncmp(pStart, "websocket", len)) {
     *pFilterOption = static_cast<FilterOption>(*pFilterOption | FOWebsocket);
+  } else if (!strncmp(pStart, "match-case", len)) {
+    *pFilterOption = static_cast<FilterOption>(*pFilterOption | FOMatchCase);
   } else if (!strncmp(pStart, "important", len)) {
     *pFilterOption = static_cast<FilterOption>(*pFilterOption | FOImportant);
   } else {
@@ -323,6 +385,7 @@ void Filter::parseOptions(const char *input) {
     len++;
   }
   parseOption(input + startOffset, len);
+  parseDomains(domainList);
 }
 
 bool endsWith(const char *input, const char *sub, int inputLen, int subLen) {
@@ -360,30 +423,26 @@ bool Filter::hasUnsupportedOptions() const {
   return (filterOption & FOUnsupportedSoSkipCheck) != 0;
 }
 
-bool Filter::contextDomainMatchesFilter(const char *contextDomain) {
+bool Filter::contextDomainMatchesFilter(const MatchRequest &request) const {
   // If there are no context domains, then this filter can still apply
   // to all domains.
   if (getDomainCount(false) == 0 && getDomainCount(true) == 0) {
     return true;
   }
 
-  const char *p = contextDomain;
-  // Start keeps track of the start of the last match
-  // We do this to avoid extraTLD checks for rules.
-  const char *start = contextDomain;
-  size_t contextDomainLen = strlen(contextDomain);
-  while (*p != '\0') {
-    if (*p == '.') {
-      if (containsDomain(start, contextDomainLen - (start - contextDomain), false)) {
-        return true;
-      }
-      if (containsDomain(start, contextDomainLen - (start - contextDomain), true)) {
-        return false;
-      }
-      // Set start to just past the period
-      start = p + 1;
+  // Check each suffix from the longest down, but never the TLD on its own
+  // to avoid extraTLD checks for rules.
+  const char *contextDomain = request.contextDomain;
+  for (int i = 0; i < request.numContextDomainLabels - 1; i++) {
+    const int offset = request.contextDomainLabels[i];
+    const char *start = contextDomain + offset;
+    const size_t len = request.contextDomainLen - offset;
+    if (containsDomain(start, len, false)) {
+      return true;
+    }
+    if (containsDomain(start, len, true)) {
+      return false;
     }
-    p++;
   }
 
   // No exact match, if there are only anti domain filters, then this
@@ -404,7 +463,29 @@ bool Filter::contextDomainMatchesFilter(const char *contextDomain) {
 // By specifying context params, you can filter out the number of rules
 // which are considered.
 bool Filter::matchesOptions(const char *input, FilterOption context,
-    const char *contextDomain) {
+    const char *contextDomain) const {
+  MatchRequest request(input, static_cast<int>(strlen(input)), context,
+      contextDomain, nullptr, nullptr, 0);
+  return matchesOptions(request);
+}
+
+bool Filter::matchesOptions(const MatchRequest &request,
+    bool checkContextDomain) const {
+  if (!matchesContextOption(request.contextOption)) {
+    return false;
+  }
+
+  // Domain options check
+  if (checkContextDomain && domainList && request.contextDomain) {
+    if (!contextDomainMatchesFilter(request)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool Filter::matchesContextOption(FilterOption context) const {
   if (hasUnsupportedOptions()) {
     return false;
   }
@@ -418,7 +499,7 @@ bool Filter::matchesOptions(const char *input, FilterOption context,
   // blocking a the HTTP level, don't block here because we don't have enough
   // information
   if (context != FONoFilterOption) {
-    if ((filterOption & ~FOThirdParty) != FONoFilterOption
+    if ((filterOption & ~(FOThirdParty | FOMatchCase)) != FONoFilterOption
         && !(filterOption & FOResourcesOnly & context)) {
       return false;
     }
@@ -439,13 +520,6 @@ bool Filter::matchesOptions(const char *input, FilterOption context,
     }
   }
 
-  // Domain options check
-  if (domainList && contextDomain) {
-    if (!contextDomainMatchesFilter(contextDomain)) {
-      return false;
-    }
-  }
-
   // If we're in the context of third-party site, then consider
   // third-party option checks
   if (context & (FOThirdParty | FONotThirdParty)) {
@@ -463,169 +537,249 @@ bool Filter::matchesOptions(const char *input, FilterOption context,
 }
 
 
-const char * getNextPos(const char *input, char separator, const char *end) {
-  const char *p = input;
-  while (p != end && *p != '\0' && *p != separator) {
-    p++;
-  }
-  return p;
+bool Filter::matches(const char *input, FilterOption contextOption,
+    const char *contextDomain, BloomFilter *inputBloomFilter,
+    const char *inputHost, int inputHostLen) const {
+  return matches(input, static_cast<int>(strlen(input)), contextOption,
+      contextDomain, inputBloomFilter, inputHost, inputHostLen);
+}
+
+bool Filter::matches(const char *input, int inputLen,
+    FilterOption contextOption, const char *contextDomain,
+    BloomFilter *inputBloomFilter, const char *inputHost,
+    int inputHostLen) const {
+  MatchRequest request(input, inputLen, contextOption, contextDomain,
+      inputBloomFilter, inputHost, inputHostLen);
+  return matches(request);
 }
 
-/**
- * Similar to str1.indexOf(filter, startingPos) but with
- * extra consideration to some ABP filter rules like ^.
- */
-int indexOfFilter(const char* input, int inputLen,
-                  const char* filterBegin, const char *filterEnd) {
-  const int filterLen = filterEnd - filterBegin;
-  if (1 == filterLen && '^' == *filterBegin) return -1;
-  if (filterLen > inputLen) {
-    return -1;
+// Checks the bigrams of a part of the data which the input has to contain
+// for the part to match.
+static bool mayContainPartBigrams(const MatchRequest &request,
+    const char *part, int partLen) {
+  for (int i = 1; i < partLen - 1; i++) {
+    if (!isSeparatorChar(part[i - 1]) && !isSeparatorChar(part[i]) &&
+        !request.mayContainBigram(part + i - 1)) {
+      return false;
+    }
   }
+  return true;
+}
 
-  for (int i = 0; i < inputLen; ++i) {
-    bool match = true;
-    for (int j = 0; j < filterLen; ++j) {
-      const char inputChar = input[i+j];
-      const char filterChar = filterBegin[j];
+bool Filter::matchesHost(const MatchRequest &request) const {
+  int hostLen = 0;
+  if (host) {
+    hostLen = this->hostLen == -1 ?
+      static_cast<int>(strlen(host)) : this->hostLen;
+  }
 
-      if (filterChar != inputChar) {
-        // ^abc^ matches both /abc/ and /abc
-        if ('^' == filterChar &&
-            (isSeparatorChar(inputChar) || '\0' == inputChar)) {
-          continue;
-        }
-        if ('\0' == inputChar) {
-          return -1;
-        }
-        match = false;
-        break;
+  if (request.hasBigramPrefilter()) {
+    for (int i = 1; i < hostLen; i++) {
+      if (!request.mayContainBigram(host + i - 1)) {
+        return false;
       }
     }
-    if (match) {
-      return i;
-    }
   }
-  return -1;
-}
 
-bool Filter::matches(const char *input, FilterOption contextOption,
-    const char *contextDomain, BloomFilter *inputBloomFilter,
-    const char *inputHost, int inputHostLen) {
-  return matches(input, static_cast<int>(strlen(input)), contextOption,
-      contextDomain, inputBloomFilter, inputHost, inputHostLen);
+  return !isThirdPartyHost(host, hostLen, request.host, request.hostLen);
 }
 
-bool Filter::matches(const char *input, int inputLen,
-    FilterOption contextOption, const char *contextDomain,
-    BloomFilter *inputBloomFilter, const char *inputHost, int inputHostLen) {
-  if (!matchesOptions(input, contextOption, contextDomain)) {
+template<bool kHostAnchored, bool kHasSeparators>
+bool Filter::matchesLiteral(const MatchRequest &request, int dataLen) const {
+  if (kHostAnchored && !matchesHost(request)) {
     return false;
   }
-
-  if (!data) {
+  if (dataLen == 0) {
+    return true;
+  }
+  // The bigrams of the input are lowercase, match-case data may not be
+  const bool matchCase = (filterOption & FOMatchCase) != 0;
+  if (request.hasBigramPrefilter() && !matchCase &&
+      !mayContainPartBigrams(request, data, dataLen)) {
     return false;
   }
-
-  // We lazily figure out the dataLen only once
-  if (dataLen == -1) {
-    dataLen = static_cast<int>(strlen(data));
+  const char *input = matchCase ? request.originalInput : request.input;
+  if (kHasSeparators) {
+    return indexOfFilter(input, request.inputLen, data,
+        data + dataLen, request.separators, 0) != -1;
   }
+  return indexOfLiteral(input, request.inputLen, data, dataLen) != -1;
+}
 
-  // Check for a regex match
-  if (filterType & FTRegex) {
-#ifdef ENABLE_REGEX
-    std::smatch m;
-    std::regex e(data, std::regex_constants::extended);
-    return std::regex_search(std::string(input), m, e);
-#else
+// Each part has to be found after the end of the previous one.  Filters
+// which weren't compiled find where their parts end as they go.
+template<bool kHostAnchored>
+bool Filter::matchesWildcard(const MatchRequest &request, int dataLen) const {
+  if (kHostAnchored && !matchesHost(request)) {
     return false;
-#endif
   }
+  const bool matchCase = (filterOption & FOMatchCase) != 0;
+  const char *input = matchCase ? request.originalInput : request.input;
+  const int inputLen = request.inputLen;
+  const bool hasBigramPrefilter = request.hasBigramPrefilter() && !matchCase;
+  int partStart = 0;
+  int index = 0;
+  for (int i = 0; ; i++) {
+    int partEnd;
+    if (partEnds) {
+      partEnd = partEnds[i];
+    } else {
+      const char *star = static_cast<const char *>(memchr(data + partStart,
+            '*', dataLen - partStart));
+      partEnd = star ? static_cast<int>(star - data) : dataLen;
+    }
+    const int partLen = partEnd - partStart;
+    const bool lastPart = partEnd == dataLen;
+    // A trailing '*' matches whatever is left
+    if (lastPart && partLen == 0) {
+      return true;
+    }
 
-  // Check for both left and right anchored
-  if ((filterType & FTLeftAnchored) && (filterType & FTRightAnchored)) {
-    return !strcmp(data, input);
-  }
+    if (hasBigramPrefilter &&
+        !mayContainPartBigrams(request, data + partStart, partLen)) {
+      return false;
+    }
 
-  // Check for right anchored
-  if (filterType & FTRightAnchored) {
-    if (dataLen > inputLen) {
+    int newIndex = indexOfFilter(input + index, inputLen - index,
+        data + partStart, data + partEnd, request.separators, index);
+    if (newIndex == -1) {
       return false;
     }
+    newIndex += index;
+    if (lastPart || newIndex >= inputLen) {
+      return true;
+    }
+    index = newIndex + partLen;
+    partStart = partEnd + 1;
+  }
+}
 
-    return !strcmp(input + (inputLen - dataLen), data);
+bool Filter::matches(const MatchRequest &request,
+    bool checkContextDomain) const {
+  if (request.inputLen < minInputLen ||
+      !request.bigramSignature.contains(signature)) {
+    return false;
   }
 
-  // Check for left anchored
-  if (filterType & FTLeftAnchored) {
-    return !strncmp(data, input, dataLen);
+  if (!matchesOptions(request, checkContextDomain)) {
+    return false;
   }
 
-  // Check for domain name anchored
-  if (filterType & FTHostAnchored) {
-    int currentHostLen = inputHostLen;
-    const char *currentHost = inputHost;
-    if (!currentHostLen) {
-      currentHost = getUrlHost(input, &currentHostLen);
-    }
-    int hostLen = 0;
-    if (host) {
-      hostLen = this->hostLen == -1 ?
-        static_cast<int>(strlen(host)) : this->hostLen;
-    }
+  if (!data) {
+    return false;
+  }
 
-    if (inputBloomFilter) {
-      for (int i = 1; i < hostLen; i++) {
-        if (!inputBloomFilter->exists(host + i - 1, 2)) {
-          return false;
-        }
-      }
-    }
+  // dataLen is filled in at parse and deserialize time, only filters which
+  // were built by hand can still be missing it.
+  const int dataLen = this->dataLen == -1 ?
+    static_cast<int>(strlen(data)) : this->dataLen;
+  const char *input = filterOption & FOMatchCase ? request.originalInput :
+    request.input;
+  const int inputLen = request.inputLen;
 
-    if (isThirdPartyHost(host, hostLen, currentHost, currentHostLen)) {
+  switch (shape != FSUnknown ? shape :
+      findShape(filterType, data, dataLen)) {
+    case FSRegex:
+#ifdef ENABLE_REGEX
+      return regex && std::regex_search(input, input + inputLen, *regex);
+#else
       return false;
-    }
+#endif
+    case FSExact:
+      return dataLen == inputLen && !memcmp(data, input, dataLen);
+    case FSLeftAnchored:
+      return dataLen <= inputLen && !memcmp(data, input, dataLen);
+    case FSRightAnchored:
+      return dataLen <= inputLen &&
+        !memcmp(input + (inputLen - dataLen), data, dataLen);
+    case FSLiteral:
+      return matchesLiteral<false, false>(request, dataLen);
+    case FSSeparatorLiteral:
+      return matchesLiteral<false, true>(request, dataLen);
+    case FSHostAnchoredLiteral:
+      return matchesLiteral<true, false>(request, dataLen);
+    case FSHostAnchoredSeparatorLiteral:
+      return matchesLiteral<true, true>(request, dataLen);
+    case FSWildcard:
+      return matchesWildcard<false>(request, dataLen);
+    case FSHostAnchoredWildcard:
+      return matchesWildcard<true>(request, dataLen);
+    case FSUnknown:
+      break;
   }
+  return false;
+}
 
-  // Wildcard match comparison
-  const char *filterPartStart = data;
-  const char *filterPartEnd = getNextPos(data, '*', data + dataLen);
-  int index = 0;
-  while (filterPartStart != filterPartEnd || *filterPartStart == '*') {
-    int filterPartLen = static_cast<int>(filterPartEnd - filterPartStart);
-
-    if (inputBloomFilter) {
-      for (int i = 1; i < filterPartLen && filterPartEnd -
-          filterPartStart - i >= 2; i++) {
-        if (!isSeparatorChar(*(filterPartStart + i - 1)) &&
-            !isSeparatorChar(*(filterPartStart + i)) &&
-            !inputBloomFilter->exists(filterPartStart + i - 1, 2)) {
-          return false;
-        }
-      }
-    }
-
-    int newIndex = indexOfFilter(input + index, inputLen - index,
-        filterPartStart, filterPartEnd);
-    if (newIndex == -1) {
-      return false;
-    }
-    newIndex += index;
+FilterShape Filter::findShape(FilterType filterType, const char *data,
+    int dataLen) {
+  if (filterType & FTRegex) {
+    return FSRegex;
+  }
+  if ((filterType & FTLeftAnchored) && (filterType & FTRightAnchored)) {
+    return FSExact;
+  }
+  if (filterType & FTRightAnchored) {
+    return FSRightAnchored;
+  }
+  if (filterType & FTLeftAnchored) {
+    return FSLeftAnchored;
+  }
+  const bool hostAnchored = (filterType & FTHostAnchored) != 0;
+  if (memchr(data, '*', dataLen)) {
+    return hostAnchored ? FSHostAnchoredWildcard : FSWildcard;
+  }
+  if (memchr(data, '^', dataLen)) {
+    return hostAnchored ? FSHostAnchoredSeparatorLiteral : FSSeparatorLiteral;
+  }
+  return hostAnchored ? FSHostAnchoredLiteral : FSLiteral;
+}
 
-    if (*filterPartEnd == '\0' || filterPartEnd == data + dataLen) {
-      break;
+void Filter::compileMatcher() {
+  if (partEnds) {
+    delete[] partEnds;
+    partEnds = nullptr;
+  }
+  signature.clear();
+  minInputLen = 0;
+  // Cosmetic and HTML filters are never matched against URLs
+  if (!data || (filterType & (FTElementHiding | FTElementHidingException |
+          FTHTMLFiltering))) {
+    shape = FSUnknown;
+    return;
+  }
+  const int len = dataLen == -1 ? static_cast<int>(strlen(data)) : dataLen;
+  shape = findShape(filterType, data, len);
+  if (shape != FSRegex) {
+    // Every byte other than '*' and '^' has to occur in the URL as is, '^'
+    // can match the end of the URL.
+    for (int i = 0; i < len; i++) {
+      if (data[i] == '*' || data[i] == '^') {
+        continue;
+      }
+      minInputLen++;
+      if (i > 0 && data[i - 1] != '*' && data[i - 1] != '^') {
+        // Requests only have the bigrams of their lowercased input
+        const char bigram[2] = { lowercaseAsciiChar(data[i - 1]),
+          lowercaseAsciiChar(data[i]) };
+        signature.add(bigram);
+      }
     }
-    const char *temp = getNextPos(filterPartEnd + 1, '*', data + dataLen);
-    filterPartStart = filterPartEnd + 1;
-    filterPartEnd = temp;
-    index = newIndex + filterPartLen;
-    if (*(input + newIndex) == '\0') {
-      break;
+  }
+  if (shape != FSWildcard && shape != FSHostAnchoredWildcard) {
+    return;
+  }
+  int numParts = 1;
+  for (int i = 0; i < len; i++) {
+    numParts += data[i] == '*';
+  }
+  partEnds = new int[numParts];
+  int part = 0;
+  for (int i = 0; i < len; i++) {
+    if (data[i] == '*') {
+      partEnds[part++] = i;
     }
   }
-
-  return true;
+  partEnds[part] = len;
 }
 
 void Filter::parseDomains(const char* domainList) {
@@ -661,6 +815,22 @@ void Filter::parseDomains(const char* domainList) {
   domainsParsed = true;
 }
 
+void Filter::compileRegex() {
+#ifdef ENABLE_REGEX
+  if (!(filterType & FTRegex) || !data || regex) {
+    return;
+  }
+  const int len = dataLen == -1 ? static_cast<int>(strlen(data)) : dataLen;
+  try {
+    regex = new std::regex(data, data + len, std::regex_constants::extended |
+        std::regex_constants::icase | std::regex_constants::optimize);
+  } catch (const std::regex_error &) {
+    // Invalid expressions never match
+    regex = nullptr;
+  }
+#endif
+}
+
 uint64_t Filter::hash() const {
   if (!host && !data) {
     return 0;
@@ -760,6 +930,15 @@ uint32_t Filter::Deserialize(char *buffer, uint32_t bufferSize) {
     delete antiDomains;
     antiDomains = nullptr;
   }
+#ifdef ENABLE_REGEX
+  if (regex) {
+    delete regex;
+    regex = nullptr;
+  }
+#endif
+  parseDomains(domainList);
+  compileRegex();
+  compileMatcher();
 
   return consumed;
 }
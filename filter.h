@@ -8,10 +8,15 @@
 
 #include <stdint.h>
 #include <string.h>
+#ifdef ENABLE_REGEX
+#include <regex>  // NOLINT
+#endif
 #include "./base.h"
+#include "./bigram_signature.h"
 #include "./context_domain.h"
 
 class BloomFilter;
+class MatchRequest;
 template <typename T> class HashSet;
 
 enum FilterType {
@@ -72,6 +77,9 @@ enum FilterOption {
   FOWebsocket = 0200000000,
   // important means to ignore all exception filters (those prefixed with @@).
   FOImportant = 0400000000,
+  // match-case means the data is compared with the URL as is, every other
+  // filter ignores the case of ASCII letters.
+  FOMatchCase = 01000000000,
 
   FOUnknown = 04000000000,
   FOResourcesOnly = FOScript|FOImage|FOStylesheet|FOObject|FOXmlHttpRequest|
@@ -81,6 +89,28 @@ enum FilterOption {
   FOUnsupportedButIgnore = FORedirect|FOImportant
 };
 
+// How the data of a filter is compared with a URL, picked from the filter
+// type and the data by Filter::compileMatcher so matching doesn't have to
+// work it out again for every URL.
+enum FilterShape : uint8_t {
+  // Not picked, e.g. for filters built by hand, matches() works it out
+  FSUnknown = 0,
+  FSRegex,
+  // Left and right anchored, the whole URL
+  FSExact,
+  FSLeftAnchored,
+  FSRightAnchored,
+  // A single part anywhere in the URL, without and with '^'
+  FSLiteral,
+  FSSeparatorLiteral,
+  // The same after checking the host of a host anchored filter
+  FSHostAnchoredLiteral,
+  FSHostAnchoredSeparatorLiteral,
+  // Parts separated by '*' which have to occur in order
+  FSWildcard,
+  FSHostAnchoredWildcard,
+};
+
 class Filter {
 friend class AdBlockClient;
  public:
@@ -102,24 +132,35 @@ friend class AdBlockClient;
 
   // Checks to see if any filter matches the input but does not match
   // any exception rule You may want to call the first overload to be
-  // slighly more efficient
+  // slighly more efficient.
+  // Matching never modifies the filter, so a fully parsed or deserialized
+  // filter can be matched from several threads at once.
+  // |checkContextDomain| can be false when the domain options are already
+  // known to accept the request's context domain.
+  bool matches(const MatchRequest &request,
+      bool checkContextDomain = true) const;
   bool matches(const char *input, int inputLen,
       FilterOption contextOption = FONoFilterOption,
       const char *contextDomain = nullptr,
       BloomFilter *inputBloomFilter = nullptr,
-      const char *inputHost = nullptr, int inputHostLen = 0);
+      const char *inputHost = nullptr, int inputHostLen = 0) const;
   bool matches(const char *input, FilterOption contextOption = FONoFilterOption,
       const char *contextDomain = nullptr,
       BloomFilter *inputBloomFilter = nullptr,
-      const char *inputHost = nullptr, int inputHostLen = 0);
+      const char *inputHost = nullptr, int inputHostLen = 0) const;
 
   // Nothing needs to be updated when a filter is added multiple times
   void Update(const Filter &) {}
   bool hasUnsupportedOptions() const;
 
   // Checks to see if the filter options match for the passed in data
+  bool matchesOptions(const MatchRequest &request,
+      bool checkContextDomain = true) const;
   bool matchesOptions(const char *input, FilterOption contextOption,
-      const char *contextDomain = nullptr);
+      const char *contextDomain = nullptr) const;
+  // The part of matchesOptions which only depends on the context option,
+  // which is the resource type and party of the request.
+  bool matchesContextOption(FilterOption context) const;
 
   void parseOptions(const char *input);
 
@@ -135,7 +176,23 @@ friend class AdBlockClient;
   bool isDomainOnlyFilter();
   // Returns true if the filter is composed of only anti-domains and no domains
   bool isAntiDomainOnlyFilter();
-  uint32_t getDomainCount(bool anti = false);
+  uint32_t getDomainCount(bool anti = false) const;
+
+  // Fills |domains| and |antiDomains| sets. This is done when the filter is
+  // parsed or deserialized so that matching never needs to.
+  void parseDomains(const char *domainList);
+
+  // Compiles the data of an FTRegex filter so that matching doesn't need to.
+  // Like parseDomains, this is done when the filter is parsed or
+  // deserialized.  Does nothing when regex support is not enabled.
+  void compileRegex();
+  // Picks the shape of the filter, finds its bigram signature and minimum
+  // input length, and for wildcard filters finds where each part ends.
+  // Like compileRegex, this is done when the filter is parsed, copied or
+  // deserialized, and has to be done again if the type or the data change.
+  void compileMatcher();
+  static FilterShape findShape(FilterType filterType, const char *data,
+      int dataLen);
 
   uint64_t hash() const;
   uint64_t GetHash() const {
@@ -183,6 +240,12 @@ friend class AdBlockClient;
   FilterType filterType;
   FilterOption filterOption;
   FilterOption antiFilterOption;
+  // Bigrams which every URL the filter matches has to contain, and the
+  // fewest bytes such a URL can have.  Filled in by compileMatcher and kept
+  // next to the options so that most filters are ruled out without reading
+  // anything else.  Empty and 0 for filters which weren't compiled.
+  BigramSignature signature;
+  int minInputLen;
 
   // The text of the filter list rule, as it appeared before being parsed.
   char *ruleDefinition;
@@ -195,11 +258,24 @@ friend class AdBlockClient;
   HashSet<ContextDomain>* domains;
   HashSet<ContextDomain>* antiDomains;
   bool domainsParsed;
+#ifdef ENABLE_REGEX
+  // Only set for FTRegex filters, nullptr if the expression is invalid.
+  std::regex *regex;
+#endif
+  FilterShape shape;
+  // For wildcard shapes, the offset in |data| where each part ends, which
+  // is |dataLen| for the last part.  nullptr for other shapes.
+  int *partEnds;
 
  protected:
-  // Fills |domains| and |antiDomains| sets
-  void parseDomains(const char *domainList);
-  bool contextDomainMatchesFilter(const char *contextDomain);
+  bool contextDomainMatchesFilter(const MatchRequest &request) const;
+  // Checks the host of a host anchored filter
+  bool matchesHost(const MatchRequest &request) const;
+  // Matchers for the shapes which search the URL for the data
+  template<bool kHostAnchored, bool kHasSeparators>
+  bool matchesLiteral(const MatchRequest &request, int dataLen) const;
+  template<bool kHostAnchored>
+  bool matchesWildcard(const MatchRequest &request, int dataLen) const;
 
   // Parses a single option
   void parseOption(const char *input, int len);
@@ -0,0 +1,76 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "./filter_hit_counts.h"
+
+#include <algorithm>
+
+FilterHitCounts::FilterHitCounts() :
+    counts(nullptr),
+    numFilters(0) {
+}
+
+FilterHitCounts::~FilterHitCounts() {
+  clear();
+}
+
+void FilterHitCounts::clear() {
+  if (counts) {
+    delete[] counts;
+    counts = nullptr;
+  }
+  numFilters = 0;
+}
+
+void FilterHitCounts::start(int numFilters) {
+  clear();
+  this->numFilters = numFilters;
+  counts = new std::atomic<unsigned int>[numFilters > 0 ? numFilters : 1]();
+}
+
+// Regular expressions cost the most, otherwise each part between wildcards
+// is searched for separately and domain options need a lookup.
+int FilterHitCounts::filterCost(const Filter &filter) {
+  if (filter.filterType & FTRegex) {
+    return 100;
+  }
+  int cost = 1;
+  for (int i = 0; i < filter.dataLen; i++) {
+    if (filter.data[i] == '*') {
+      cost++;
+    }
+  }
+  if (filter.domainList) {
+    cost++;
+  }
+  return cost;
+}
+
+void FilterHitCounts::findOrder(const Filter *filters, int *order) const {
+  struct Key {
+    unsigned int hits;
+    int cost;
+    int id;
+  };
+  Key *keys = new Key[numFilters > 0 ? numFilters : 1];
+  for (int i = 0; i < numFilters; i++) {
+    keys[i].hits = get(i);
+    keys[i].cost = keys[i].hits ? filterCost(filters[i]) : 0;
+    keys[i].id = i;
+  }
+  std::sort(keys, keys + numFilters, [](const Key &lhs, const Key &rhs) {
+    if (lhs.hits != rhs.hits) {
+      return lhs.hits > rhs.hits;
+    }
+    if (lhs.cost != rhs.cost) {
+      return lhs.cost < rhs.cost;
+    }
+    return lhs.id < rhs.id;
+  });
+  for (int i = 0; i < numFilters; i++) {
+    order[i] = keys[i].id;
+  }
+  delete[] keys;
+}
@@ -0,0 +1,56 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef FILTER_HIT_COUNTS_H_
+#define FILTER_HIT_COUNTS_H_
+
+#include <atomic>
+#include "./base.h"
+#include "./filter.h"
+
+// How many times each filter of a filter array matched a request, used to
+// move the filters which match most often to the front of the array so
+// matching finds them sooner.  Counts are only kept while counting has been
+// started, and are updated with relaxed ordering since several threads may
+// be matching at once.
+class FilterHitCounts {
+ public:
+  FilterHitCounts();
+  ~FilterHitCounts();
+
+  // Stops counting
+  void clear();
+  // Starts counting from 0 for an array of |numFilters| filters
+  void start(int numFilters);
+  bool isCounting() const {
+    return counts != nullptr;
+  }
+  void increment(int filterId) {
+    if (counts && filterId < numFilters) {
+      counts[filterId].fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+  unsigned int get(int filterId) const {
+    return counts && filterId < numFilters ?
+      counts[filterId].load(std::memory_order_relaxed) : 0;
+  }
+  // Fills |order| with the ids of |filters| from the one to check first to
+  // the one to check last: the most hits first, cheaper filters first
+  // between filters with as many hits, and the current order for filters
+  // which never matched.
+  void findOrder(const Filter *filters, int *order) const;
+
+  // Rough relative cost of checking a filter which matches
+  static int filterCost(const Filter &filter);
+
+ private:
+  FilterHitCounts(const FilterHitCounts &);
+  void operator=(const FilterHitCounts &);
+
+  std::atomic<unsigned int> *counts;
+  int numFilters;
+};
+
+#endif  // FILTER_HIT_COUNTS_H_
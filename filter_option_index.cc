@@ -0,0 +1,201 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "./filter_option_index.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "./serialization.h"
+
+FilterOptionIndex::FilterOptionIndex() :
+    numFilters(0),
+    numWords(0),
+    numBitmaps(0),
+    bits(nullptr) {
+  memset(contextBitmaps, 0, sizeof(contextBitmaps));
+}
+
+FilterOptionIndex::~FilterOptionIndex() {
+  clear();
+}
+
+void FilterOptionIndex::clear() {
+  if (bits) {
+    delete[] bits;
+    bits = nullptr;
+  }
+  numFilters = 0;
+  numWords = 0;
+  numBitmaps = 0;
+}
+
+// Contexts are numbered by resource type, 0 being no resource type and 1 the
+// lowest bit of FOResourcesOnly, and then by party.
+int FilterOptionIndex::contextIndex(FilterOption contextOption) {
+  const unsigned int partyBits =
+    contextOption & (FOThirdParty | FONotThirdParty);
+  int party;
+  if (!partyBits) {
+    party = 0;
+  } else if (partyBits == FOThirdParty) {
+    party = 1;
+  } else if (partyBits == FONotThirdParty) {
+    party = 2;
+  } else {
+    return -1;
+  }
+  if (contextOption & ~(FOResourcesOnly | FOThirdParty | FONotThirdParty)) {
+    return -1;
+  }
+
+  const unsigned int resource = contextOption & FOResourcesOnly;
+  if (resource & (resource - 1)) {
+    return -1;
+  }
+  int resourceType = 0;
+  if (resource) {
+    resourceType = 1;
+    for (unsigned int bit = 1; bit < resource; bit <<= 1) {
+      if (bit & FOResourcesOnly) {
+        resourceType++;
+      }
+    }
+  }
+  return resourceType * 3 + party;
+}
+
+FilterOption FilterOptionIndex::contextOptionForIndex(int index) {
+  const int partyBits[] = { 0, FOThirdParty, FONotThirdParty };
+  int resourceType = index / 3;
+  unsigned int resource = 0;
+  for (unsigned int bit = 1; resourceType > 0; bit <<= 1) {
+    if (bit & FOResourcesOnly) {
+      resource = bit;
+      resourceType--;
+    }
+  }
+  return static_cast<FilterOption>(resource | partyBits[index % 3]);
+}
+
+void FilterOptionIndex::build(const Filter *filters, int numFilters) {
+  clear();
+  this->numFilters = numFilters;
+  numWords = (numFilters + 63) / 64;
+  bits = new uint64_t[kNumContexts * numWords];
+
+  for (int i = 0; i < kNumContexts; i++) {
+    const FilterOption context = contextOptionForIndex(i);
+    uint64_t *bitmap = bits + numBitmaps * numWords;
+    memset(bitmap, 0, numWords * sizeof(uint64_t));
+    for (int j = 0; j < numFilters; j++) {
+      if (filters[j].matchesContextOption(context)) {
+        bitmap[j / 64] |= static_cast<uint64_t>(1) << (j % 64);
+      }
+    }
+
+    // Most contexts accept exactly the same filters as another one
+    int existing = 0;
+    while (existing < numBitmaps && memcmp(bits + existing * numWords,
+          bitmap, numWords * sizeof(uint64_t))) {
+      existing++;
+    }
+    contextBitmaps[i] = existing;
+    if (existing == numBitmaps) {
+      numBitmaps++;
+    }
+  }
+}
+
+const uint64_t * FilterOptionIndex::find(FilterOption contextOption,
+    int numFilters) const {
+  if (!bits || numFilters != this->numFilters) {
+    return nullptr;
+  }
+  const int index = contextIndex(contextOption);
+  if (index == -1) {
+    return nullptr;
+  }
+  return bits + contextBitmaps[index] * numWords;
+}
+
+uint32_t FilterOptionIndex::Serialize(char *buffer) const {
+  if (!bits) {
+    return 0;
+  }
+  uint32_t totalSize = 0;
+  char sz[32];
+  uint32_t size = snprintf(sz, sizeof(sz), "%x,%x", numFilters, numBitmaps);
+  if (buffer) {
+    memcpy(buffer + totalSize, sz, size);
+  }
+  totalSize += size;
+  for (int i = 0; i < kNumContexts; i++) {
+    size = snprintf(sz, sizeof(sz), ",%x", contextBitmaps[i]);
+    if (buffer) {
+      memcpy(buffer + totalSize, sz, size);
+    }
+    totalSize += size;
+  }
+  if (buffer) {
+    buffer[totalSize] = '\0';
+  }
+  totalSize += 1;
+
+  const int numWordsTotal = numBitmaps * numWords;
+  if (buffer) {
+    for (int i = 0; i < numWordsTotal; i++) {
+      writeUint64(buffer + totalSize + i * 8, bits[i]);
+    }
+  }
+  totalSize += numWordsTotal * 8;
+  return totalSize;
+}
+
+uint32_t FilterOptionIndex::Deserialize(const char *buffer,
+    uint32_t bufferSize) {
+  clear();
+  const char *end = static_cast<const char *>(memchr(buffer, '\0',
+        bufferSize));
+  if (!end) {
+    return 0;
+  }
+  char *p;
+  int newNumFilters = static_cast<int>(strtol(buffer, &p, 16));
+  int newNumBitmaps = 0;
+  if (*p == ',') {
+    newNumBitmaps = static_cast<int>(strtol(p + 1, &p, 16));
+  }
+  if (newNumFilters < 0 || newNumBitmaps <= 0 ||
+      newNumBitmaps > kNumContexts) {
+    return 0;
+  }
+  for (int i = 0; i < kNumContexts; i++) {
+    if (*p != ',') {
+      return 0;
+    }
+    contextBitmaps[i] = static_cast<int>(strtol(p + 1, &p, 16));
+    if (contextBitmaps[i] < 0 || contextBitmaps[i] >= newNumBitmaps) {
+      return 0;
+    }
+  }
+  uint32_t consumed = static_cast<uint32_t>(end - buffer) + 1;
+
+  const int newNumWords = (newNumFilters + 63) / 64;
+  const uint32_t numBytes = newNumBitmaps * newNumWords * 8;
+  if (consumed + numBytes > bufferSize) {
+    return 0;
+  }
+  numFilters = newNumFilters;
+  numWords = newNumWords;
+  numBitmaps = newNumBitmaps;
+  bits = new uint64_t[numBitmaps * numWords];
+  for (int i = 0; i < numBitmaps * numWords; i++) {
+    bits[i] = readUint64(buffer + consumed + i * 8);
+  }
+  consumed += numBytes;
+  return consumed;
+}
@@ -0,0 +1,73 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef FILTER_OPTION_INDEX_H_
+#define FILTER_OPTION_INDEX_H_
+
+#include "./base.h"
+#include "./filter.h"
+
+// Index over a filter array of which filters can accept a request based only
+// on its resource type and party, for example a $script filter can never
+// accept an image request.  Every request context with at most one resource
+// type and at most one of FOThirdParty and FONotThirdParty has a bitmap with
+// a bit set for each filter whose options accept it, so matching can skip
+// the rest without visiting them.  Contexts which share a bitmap only store
+// it once.
+class FilterOptionIndex {
+ public:
+  FilterOptionIndex();
+  ~FilterOptionIndex();
+
+  void clear();
+  // Rebuilds the index for the passed in filters
+  void build(const Filter *filters, int numFilters);
+  // Returns the bitmap of filters which can accept |contextOption|, or
+  // nullptr if there is no index for |numFilters| filters or for that
+  // context, in which case every filter needs to be checked.
+  const uint64_t * find(FilterOption contextOption, int numFilters) const;
+
+  // Serializes the index into |buffer| and returns the number of bytes
+  // used.  Passing nullptr only returns the size.
+  uint32_t Serialize(char *buffer) const;
+  // Loads an index written by Serialize and returns the number of bytes
+  // consumed, or 0 if the buffer doesn't hold a valid index.
+  uint32_t Deserialize(const char *buffer, uint32_t bufferSize);
+
+  // One context per resource type in FOResourcesOnly plus one without a
+  // resource type, each without a party, third-party and first-party.
+  static const int kNumResourceTypes = 16;
+  static const int kNumContexts = kNumResourceTypes * 3;
+
+ private:
+  FilterOptionIndex(const FilterOptionIndex &);
+  void operator=(const FilterOptionIndex &);
+
+  static int contextIndex(FilterOption contextOption);
+  static FilterOption contextOptionForIndex(int index);
+
+  int numFilters;
+  int numWords;
+  int numBitmaps;
+  // Which of the bitmaps in |bits| each context uses
+  int contextBitmaps[kNumContexts];
+  uint64_t *bits;
+};
+
+// Returns the index of the lowest set bit of a non zero |word|
+inline int lowestSetBit(uint64_t word) {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_ctzll(word);
+#else
+  int index = 0;
+  while (!(word & 1)) {
+    word >>= 1;
+    index++;
+  }
+  return index;
+#endif
+}
+
+#endif  // FILTER_OPTION_INDEX_H_
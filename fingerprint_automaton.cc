@@ -0,0 +1,354 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "./fingerprint_automaton.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "./ad_block_client.h"
+#include "./filter.h"
+#include "./serialization.h"
+
+// Bytes for each state in serialized data: base, check, fail and ids
+static const int kSerializedNodeSize = 16;
+
+FingerprintAutomaton::FingerprintAutomaton() :
+    numCodes(0),
+    nodes(nullptr),
+    numSlots(0),
+    numStates(0),
+    ids(nullptr),
+    numIds(0) {
+  memset(codes, 0, sizeof(codes));
+}
+
+FingerprintAutomaton::~FingerprintAutomaton() {
+  clear();
+}
+
+void FingerprintAutomaton::clear() {
+  if (nodes) {
+    delete[] nodes;
+    nodes = nullptr;
+  }
+  if (ids) {
+    delete[] ids;
+    ids = nullptr;
+  }
+  memset(codes, 0, sizeof(codes));
+  numCodes = 0;
+  numSlots = 0;
+  numStates = 0;
+  numIds = 0;
+}
+
+bool FingerprintAutomaton::build(const Filter *filters, int numFilters) {
+  clear();
+  // Ordered so the same filters always build the same automaton
+  std::map<std::string, std::vector<int> > fingerprints;
+  char fingerprintBuffer[AdBlockClient::kFingerprintSize + 1];
+  for (int i = 0; i < numFilters; i++) {
+    if (!AdBlockClient::getFingerprint(fingerprintBuffer, filters[i])) {
+      return false;
+    }
+    fingerprints[fingerprintBuffer].push_back(i);
+  }
+  build(fingerprints);
+  return true;
+}
+
+void FingerprintAutomaton::build(
+    const std::map<std::string, std::vector<int> > &keys) {
+  clear();
+  for (auto it = keys.begin(); it != keys.end(); ++it) {
+    for (size_t i = 0; i < it->first.size(); i++) {
+      codes[static_cast<unsigned char>(it->first[i])] = 1;
+    }
+  }
+  for (int c = 0; c < 256; c++) {
+    if (codes[c]) {
+      codes[c] = static_cast<uint8_t>(++numCodes);
+    }
+  }
+
+  // Build the trie first, children by code and the offset of the filter
+  // ids of the states ending a fingerprint.
+  std::vector<std::map<int, int> > children(1);
+  std::vector<int> trieIds(1, -1);
+  std::vector<int> newIds;
+  for (auto it = keys.begin(); it != keys.end(); ++it) {
+    int state = 0;
+    for (size_t i = 0; i < it->first.size(); i++) {
+      const int code = codes[static_cast<unsigned char>(it->first[i])];
+      auto child = children[state].find(code);
+      if (child != children[state].end()) {
+        state = child->second;
+        continue;
+      }
+      children[state][code] = static_cast<int>(children.size());
+      state = static_cast<int>(children.size());
+      children.push_back(std::map<int, int>());
+      trieIds.push_back(-1);
+    }
+    trieIds[state] = static_cast<int>(newIds.size());
+    newIds.push_back(static_cast<int>(it->second.size()));
+    newIds.insert(newIds.end(), it->second.begin(), it->second.end());
+  }
+
+  // Place the states breadth first, each one at the first base where all
+  // of its children fit into free slots.
+  const int numTrieStates = static_cast<int>(children.size());
+  std::vector<int> slots(numTrieStates);
+  std::vector<int> order(1, 0);
+  std::vector<Node> newNodes(1);
+  newNodes[0].check = -1;
+  int firstFree = 1;
+  for (size_t i = 0; i < order.size(); i++) {
+    const int state = order[i];
+    const std::map<int, int> &stateChildren = children[state];
+    Node &placed = newNodes[slots[state]];
+    placed.base = 0;
+    placed.fail = 0;
+    placed.ids = trieIds[state];
+    if (stateChildren.empty()) {
+      continue;
+    }
+    const int firstCode = stateChildren.begin()->first;
+    int base = firstFree > firstCode ? firstFree - firstCode : 1;
+    while (true) {
+      bool fits = true;
+      for (auto it = stateChildren.begin(); it != stateChildren.end(); ++it) {
+        const int slot = base + it->first;
+        if (slot < static_cast<int>(newNodes.size()) &&
+            newNodes[slot].check != -1) {
+          fits = false;
+          break;
+        }
+      }
+      if (fits) {
+        break;
+      }
+      base++;
+    }
+    const int needed = base + numCodes + 1;
+    if (needed > static_cast<int>(newNodes.size())) {
+      Node freeNode;
+      freeNode.base = 0;
+      freeNode.check = -1;
+      freeNode.fail = 0;
+      freeNode.ids = -1;
+      newNodes.resize(needed, freeNode);
+    }
+    newNodes[slots[state]].base = base;
+    for (auto it = stateChildren.begin(); it != stateChildren.end(); ++it) {
+      slots[it->second] = base + it->first;
+      newNodes[base + it->first].check = slots[state];
+      order.push_back(it->second);
+    }
+    while (firstFree < static_cast<int>(newNodes.size()) &&
+        newNodes[firstFree].check != -1) {
+      firstFree++;
+    }
+  }
+
+  // Fail links, also breadth first so the fail state of each parent is
+  // known before its children.
+  for (size_t i = 0; i < order.size(); i++) {
+    const int state = order[i];
+    for (auto it = children[state].begin(); it != children[state].end();
+        ++it) {
+      int fail = newNodes[slots[state]].fail;
+      int target = 0;
+      if (state != 0) {
+        while (true) {
+          const int slot = newNodes[fail].base + it->first;
+          if (newNodes[slot].check == fail) {
+            target = slot;
+            break;
+          }
+          if (fail == 0) {
+            break;
+          }
+          fail = newNodes[fail].fail;
+        }
+      }
+      newNodes[slots[it->second]].fail = target;
+    }
+  }
+
+  // A key which ends in the fail state of a state ends there too.  The fail
+  // states are shallower so theirs are merged first.
+  for (size_t i = 1; i < order.size(); i++) {
+    Node &node = newNodes[slots[order[i]]];
+    const int failIds = newNodes[node.fail].ids;
+    if (failIds == -1) {
+      continue;
+    }
+    if (node.ids == -1) {
+      node.ids = failIds;
+      continue;
+    }
+    const int count = newIds[node.ids];
+    const int failCount = newIds[failIds];
+    std::vector<int> merged(newIds.begin() + node.ids + 1,
+        newIds.begin() + node.ids + 1 + count);
+    merged.insert(merged.end(), newIds.begin() + failIds + 1,
+        newIds.begin() + failIds + 1 + failCount);
+    node.ids = static_cast<int>(newIds.size());
+    newIds.push_back(count + failCount);
+    newIds.insert(newIds.end(), merged.begin(), merged.end());
+  }
+
+  numSlots = static_cast<int>(newNodes.size());
+  numStates = numTrieStates;
+  nodes = new Node[numSlots];
+  memcpy(nodes, newNodes.data(), numSlots * sizeof(Node));
+  numIds = static_cast<int>(newIds.size());
+  ids = new int[numIds > 0 ? numIds : 1];
+  if (numIds > 0) {
+    memcpy(ids, newIds.data(), numIds * sizeof(int));
+  }
+}
+
+uint32_t FingerprintAutomaton::Serialize(char *buffer) const {
+  if (!isBuilt()) {
+    return 0;
+  }
+  char sz[32];
+  uint32_t totalSize = snprintf(sz, sizeof(sz), "%x,%x,%x", numSlots,
+      numStates, numIds) + 1;
+  if (buffer) {
+    memcpy(buffer, sz, totalSize);
+  }
+
+  if (buffer) {
+    char *p = buffer + totalSize;
+    memcpy(p, codes, sizeof(codes));
+    p += sizeof(codes);
+    for (int i = 0; i < numSlots; i++) {
+      writeUint32(p, nodes[i].base);
+      writeUint32(p + 4, nodes[i].check);
+      writeUint32(p + 8, nodes[i].fail);
+      writeUint32(p + 12, nodes[i].ids);
+      p += kSerializedNodeSize;
+    }
+    for (int i = 0; i < numIds; i++) {
+      writeUint32(p, ids[i]);
+      p += 4;
+    }
+  }
+  totalSize += sizeof(codes) + numSlots * kSerializedNodeSize + numIds * 4;
+  return totalSize;
+}
+
+uint32_t FingerprintAutomaton::Deserialize(const char *buffer,
+    uint32_t bufferSize, int numFilters) {
+  clear();
+  const char *end = static_cast<const char *>(memchr(buffer, '\0',
+        bufferSize));
+  if (!end) {
+    return 0;
+  }
+  char *p;
+  const int newNumSlots = static_cast<int>(strtol(buffer, &p, 16));
+  if (*p != ',') {
+    return 0;
+  }
+  const int newNumStates = static_cast<int>(strtol(p + 1, &p, 16));
+  if (*p != ',') {
+    return 0;
+  }
+  const int newNumIds = static_cast<int>(strtol(p + 1, &p, 16));
+  if (newNumSlots <= 0 || newNumStates <= 0 || newNumIds < 0) {
+    return 0;
+  }
+  const uint32_t consumed = static_cast<uint32_t>(end - buffer) + 1;
+  const uint32_t dataSize = sizeof(codes) +
+    static_cast<uint32_t>(newNumSlots) * kSerializedNodeSize +
+    static_cast<uint32_t>(newNumIds) * 4;
+  if (consumed + dataSize > bufferSize) {
+    return 0;
+  }
+
+  const char *q = buffer + consumed;
+  memcpy(codes, q, sizeof(codes));
+  q += sizeof(codes);
+  for (int c = 0; c < 256; c++) {
+    if (codes[c] > numCodes) {
+      numCodes = codes[c];
+    }
+  }
+
+  int *newIds = new int[newNumIds > 0 ? newNumIds : 1];
+  for (int i = 0; i < newNumIds; i++) {
+    newIds[i] = static_cast<int>(readUint32(q + newNumSlots *
+          kSerializedNodeSize + i * 4));
+  }
+
+  // Every slot reached from a state has to be in the array, and the ids of
+  // each state in the ids array and below |numFilters|.
+  Node *newNodes = new Node[newNumSlots];
+  bool valid = true;
+  for (int i = 0; i < newNumSlots && valid; i++) {
+    Node &node = newNodes[i];
+    node.base = static_cast<int>(readUint32(q));
+    node.check = static_cast<int>(readUint32(q + 4));
+    node.fail = static_cast<int>(readUint32(q + 8));
+    node.ids = static_cast<int>(readUint32(q + 12));
+    q += kSerializedNodeSize;
+    valid = node.base >= 0 && node.base <= newNumSlots - numCodes - 1 &&
+      node.check >= -1 && node.check < newNumSlots &&
+      node.fail >= 0 && node.fail < newNumSlots && node.ids >= -1 &&
+      node.ids < newNumIds;
+    if (valid && node.ids != -1) {
+      const int count = newIds[node.ids];
+      valid = count >= 0 && count < newNumIds - node.ids;
+      for (int j = 1; valid && j <= count; j++) {
+        valid = newIds[node.ids + j] >= 0 &&
+          newIds[node.ids + j] < numFilters;
+      }
+    }
+  }
+  // Each fail link has to go to a shallower state so next() always gets
+  // back to the root.
+  if (valid) {
+    std::vector<int> depths(newNumSlots, -1);
+    std::vector<int> reached(1, 0);
+    depths[0] = 0;
+    for (size_t i = 0; i < reached.size(); i++) {
+      const int state = reached[i];
+      for (int code = 1; code <= numCodes; code++) {
+        const int slot = newNodes[state].base + code;
+        if (newNodes[slot].check == state && depths[slot] == -1) {
+          depths[slot] = depths[state] + 1;
+          reached.push_back(slot);
+        }
+      }
+    }
+    valid = static_cast<int>(reached.size()) == newNumStates;
+    for (size_t i = 1; i < reached.size() && valid; i++) {
+      valid = depths[newNodes[reached[i]].fail] != -1 &&
+        depths[newNodes[reached[i]].fail] < depths[reached[i]];
+    }
+  }
+  if (!valid) {
+    delete[] newNodes;
+    delete[] newIds;
+    clear();
+    return 0;
+  }
+
+  nodes = newNodes;
+  numSlots = newNumSlots;
+  numStates = newNumStates;
+  ids = newIds;
+  numIds = newNumIds;
+  return consumed + dataSize;
+}
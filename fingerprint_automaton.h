@@ -0,0 +1,112 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef FINGERPRINT_AUTOMATON_H_
+#define FINGERPRINT_AUTOMATON_H_
+
+#include <stdint.h>
+#include <map>
+#include <string>
+#include <vector>
+#include "./base.h"
+
+class Filter;
+
+// Aho-Corasick automaton over the fingerprints of a filter list, kept as a
+// double array.  A single pass over a URL finds every fingerprint which
+// occurs in it, without hashing each fingerprint sized window and without
+// the false positives of the bloom filter.  The state which ends a
+// fingerprint holds the ids of the filters using it, like its
+// FingerprintPostings.  It can also be built for keys of any length, then a
+// state holds the ids of the keys ending in its fail states as well so no
+// output links are needed.  Fingerprints all have the same length, so a
+// state only ever ends its own.
+class FingerprintAutomaton {
+ public:
+  static const int kRootState = 0;
+
+  FingerprintAutomaton();
+  ~FingerprintAutomaton();
+
+  void clear();
+  // Builds the automaton for the fingerprints of |filters|.  Returns false
+  // and leaves it empty if a filter has no fingerprint, in which case the
+  // list can only be checked linearly.
+  bool build(const Filter *filters, int numFilters);
+  // Builds the automaton for |keys|, each with the ids it ends
+  void build(const std::map<std::string, std::vector<int> > &keys);
+  bool isBuilt() const {
+    return numSlots > 0;
+  }
+  int getNumStates() const {
+    return numStates;
+  }
+
+  // Returns the state after reading |c| in |state|
+  int next(int state, char c) const {
+    const int code = codes[static_cast<unsigned char>(c)];
+    if (!code) {
+      return kRootState;
+    }
+    while (true) {
+      const Node &node = nodes[state];
+      const int child = node.base + code;
+      if (nodes[child].check == state) {
+        return child;
+      }
+      if (state == kRootState) {
+        return kRootState;
+      }
+      state = node.fail;
+    }
+  }
+  // Returns the ids of the filters whose fingerprint ends in |state| and
+  // sets |numIds|, or returns nullptr if no fingerprint ends there.  States
+  // which share their ids return the same pointer.
+  const int * filterIds(int state, int *numIds) const {
+    const int offset = nodes[state].ids;
+    if (offset == -1) {
+      *numIds = 0;
+      return nullptr;
+    }
+    *numIds = ids[offset];
+    return ids + offset + 1;
+  }
+
+  // Serializes the automaton into |buffer| and returns the number of bytes
+  // used.  Passing nullptr only returns the size.
+  uint32_t Serialize(char *buffer) const;
+  // Loads an automaton written by Serialize for a list of |numFilters|
+  // filters and returns the number of bytes consumed, or 0 if the buffer
+  // doesn't hold a valid automaton.
+  uint32_t Deserialize(const char *buffer, uint32_t bufferSize,
+      int numFilters);
+
+ private:
+  FingerprintAutomaton(const FingerprintAutomaton &);
+  void operator=(const FingerprintAutomaton &);
+
+  // The fields of a state are kept together so each step reads one cache
+  // line.  A slot belongs to the state |check| when |check| is that state's
+  // child, and its children are at |base| plus the code of each byte.
+  struct Node {
+    int base;
+    int check;
+    int fail;
+    // Offset in |ids| of the count and filter ids, -1 for none
+    int ids;
+  };
+
+  // Code of each byte which occurs in a fingerprint, 0 for the others
+  uint8_t codes[256];
+  int numCodes;
+  Node *nodes;
+  int numSlots;
+  int numStates;
+  int *ids;
+  int numIds;
+};
+
+#endif  // FINGERPRINT_AUTOMATON_H_
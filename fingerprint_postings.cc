@@ -0,0 +1,166 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "./fingerprint_postings.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hashFn.h"
+
+static HashFn h(19);
+
+FingerprintPostings::FingerprintPostings() :
+    filterIds(nullptr),
+    numFilterIds(0),
+    borrowed_data(false),
+    data(nullptr),
+    dataLen(0),
+    filterIdsCapacity(0) {
+}
+
+FingerprintPostings::FingerprintPostings(const FingerprintPostings &other) :
+    filterIds(nullptr),
+    numFilterIds(0),
+    borrowed_data(false),
+    data(nullptr),
+    dataLen(other.dataLen),
+    filterIdsCapacity(0) {
+  // Lookup and add items usually point into a temporary buffer, so stored
+  // items always keep their own copy of the fingerprint.
+  if (other.data) {
+    data = new char[dataLen];
+    memcpy(data, other.data, dataLen);
+  }
+  reserve(other.numFilterIds);
+  if (other.numFilterIds) {
+    memcpy(filterIds, other.filterIds, other.numFilterIds * sizeof(int));
+  }
+  numFilterIds = other.numFilterIds;
+}
+
+FingerprintPostings::FingerprintPostings(const char *data, int dataLen,
+    int filterId) :
+    filterIds(nullptr),
+    numFilterIds(0),
+    borrowed_data(true),
+    data(const_cast<char*>(data)),
+    dataLen(dataLen),
+    filterIdsCapacity(0) {
+  if (filterId != -1) {
+    reserve(1);
+    filterIds[numFilterIds++] = filterId;
+  }
+}
+
+FingerprintPostings::~FingerprintPostings() {
+  if (filterIds) {
+    delete[] filterIds;
+  }
+  if (!borrowed_data && data) {
+    delete[] data;
+  }
+}
+
+void FingerprintPostings::reserve(int capacity) {
+  if (capacity <= filterIdsCapacity) {
+    return;
+  }
+  int *newFilterIds = new int[capacity];
+  if (filterIds) {
+    memcpy(newFilterIds, filterIds, numFilterIds * sizeof(int));
+    delete[] filterIds;
+  }
+  filterIds = newFilterIds;
+  filterIdsCapacity = capacity;
+}
+
+void FingerprintPostings::Update(const FingerprintPostings &other) {
+  if (numFilterIds + other.numFilterIds > filterIdsCapacity) {
+    int capacity = filterIdsCapacity * 2;
+    if (capacity < numFilterIds + other.numFilterIds) {
+      capacity = numFilterIds + other.numFilterIds;
+    }
+    reserve(capacity);
+  }
+  if (other.numFilterIds) {
+    memcpy(filterIds + numFilterIds, other.filterIds,
+        other.numFilterIds * sizeof(int));
+    numFilterIds += other.numFilterIds;
+  }
+}
+
+uint64_t FingerprintPostings::hash() const {
+  if (!data) {
+    return 0;
+  }
+  return h(data, dataLen);
+}
+
+uint32_t FingerprintPostings::Serialize(char *buffer) {
+  uint32_t totalSize = 0;
+  char sz[64];
+  uint32_t headerSize = 1 + snprintf(sz, sizeof(sz),
+      "%x,%x", dataLen, numFilterIds);
+  if (buffer) {
+    memcpy(buffer + totalSize, sz, headerSize);
+  }
+  totalSize += headerSize;
+  if (buffer) {
+    memcpy(buffer + totalSize, data, dataLen);
+  }
+  totalSize += dataLen;
+
+  for (int i = 0; i < numFilterIds; i++) {
+    uint32_t idSize = snprintf(sz, sizeof(sz), i == 0 ? "%x" : ",%x",
+        filterIds[i]);
+    if (buffer) {
+      memcpy(buffer + totalSize, sz, idSize);
+    }
+    totalSize += idSize;
+  }
+  // Extra null termination
+  if (buffer) {
+    buffer[totalSize] = '\0';
+  }
+  totalSize += 1;
+
+  return totalSize;
+}
+
+uint32_t FingerprintPostings::Deserialize(char *buffer, uint32_t bufferSize) {
+  dataLen = 0;
+  int count = 0;
+  sscanf(buffer, "%x,%x", &dataLen, &count);
+  uint32_t consumed = static_cast<uint32_t>(strlen(buffer)) + 1;
+  if (consumed + dataLen >= bufferSize) {
+    return 0;
+  }
+  data = buffer + consumed;
+  consumed += dataLen;
+  borrowed_data = true;
+
+  numFilterIds = 0;
+  reserve(count);
+  char *p = buffer + consumed;
+  while (numFilterIds < count) {
+    char *end;
+    filterIds[numFilterIds++] = static_cast<int>(strtol(p, &end, 16));
+    if (end == p) {
+      return 0;
+    }
+    p = *end == ',' ? end + 1 : end;
+  }
+  consumed += static_cast<uint32_t>(strlen(buffer + consumed)) + 1;
+  return consumed;
+}
+
+bool FingerprintPostings::operator==(const FingerprintPostings &rhs) const {
+  if (dataLen != rhs.dataLen) {
+    return false;
+  }
+  return !memcmp(data, rhs.data, dataLen);
+}
@@ -0,0 +1,54 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef FINGERPRINT_POSTINGS_H_
+#define FINGERPRINT_POSTINGS_H_
+
+#include "./base.h"
+
+// Hash set item which maps a filter fingerprint to the ids of every filter
+// using it.  A filter id is the index of the filter in its filter array.
+// When the bloom filter reports a fingerprint hit, this lets us evaluate only
+// the filters whose fingerprint actually occurs in the input.  The host
+// anchored filters are kept the same way with their host as the key.
+class FingerprintPostings {
+ public:
+  FingerprintPostings();
+  FingerprintPostings(const FingerprintPostings &other);
+  // Used for lookups, and when adding a single filter id for a fingerprint
+  FingerprintPostings(const char *data, int dataLen, int filterId = -1);
+  ~FingerprintPostings();
+
+  uint64_t hash() const;
+  uint64_t GetHash() const {
+    return hash();
+  }
+
+  uint32_t Serialize(char *buffer);
+  uint32_t Deserialize(char *buffer, uint32_t bufferSize);
+  // Adding a fingerprint which already exists appends the other filter ids
+  void Update(const FingerprintPostings &other);
+
+  bool operator==(const FingerprintPostings &rhs) const;
+  bool operator!=(const FingerprintPostings &rhs) const {
+    return !(*this == rhs);
+  }
+
+  int *filterIds;
+  int numFilterIds;
+
+ private:
+  void reserve(int capacity);
+
+  // Holds true if the data should not free memory because for example it
+  // was loaded from a large buffer somewhere else via the serialize and
+  // deserialize functions.
+  bool borrowed_data;
+  char *data;
+  int dataLen;
+  int filterIdsCapacity;
+};
+
+#endif  // FINGERPRINT_POSTINGS_H_
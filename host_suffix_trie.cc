@@ -0,0 +1,293 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "./host_suffix_trie.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "./serialization.h"
+
+static const uint32_t kFnvOffset = 2166136261U;
+static const uint32_t kFnvPrime = 16777619U;
+// Bytes for each node in serialized data: parent, label offset, label
+// length and flags.
+static const int kSerializedNodeSize = 13;
+
+HostSuffixTrie::HostSuffixTrie() :
+    nodes(nullptr),
+    numNodes(0),
+    nodeCapacity(0),
+    labels(nullptr),
+    labelsLen(0),
+    labelsCapacity(0),
+    slots(nullptr),
+    slotMask(0) {
+}
+
+HostSuffixTrie::~HostSuffixTrie() {
+  clear();
+}
+
+void HostSuffixTrie::clear() {
+  if (nodes) {
+    delete[] nodes;
+    nodes = nullptr;
+  }
+  if (labels) {
+    delete[] labels;
+    labels = nullptr;
+  }
+  if (slots) {
+    delete[] slots;
+    slots = nullptr;
+  }
+  numNodes = 0;
+  nodeCapacity = 0;
+  labelsLen = 0;
+  labelsCapacity = 0;
+  slotMask = 0;
+}
+
+void HostSuffixTrie::init() {
+  clear();
+  nodeCapacity = 1024;
+  nodes = new Node[nodeCapacity];
+  labelsCapacity = 8192;
+  labels = new char[labelsCapacity];
+  Node &root = nodes[numNodes++];
+  root.parent = -1;
+  root.labelOffset = 0;
+  root.labelLen = 0;
+  root.flags = 0;
+  initSlots(nodeCapacity);
+}
+
+uint32_t HostSuffixTrie::labelHash(const char *label, int labelLen) {
+  uint32_t h = kFnvOffset;
+  for (int i = labelLen - 1; i >= 0; i--) {
+    h = (h ^ static_cast<unsigned char>(label[i])) * kFnvPrime;
+  }
+  return h;
+}
+
+void HostSuffixTrie::initSlots(int capacity) {
+  if (slots) {
+    delete[] slots;
+  }
+  // Kept at most half full so probe sequences stay short
+  int numSlots = 1;
+  while (numSlots < capacity * 2) {
+    numSlots <<= 1;
+  }
+  slots = new int[numSlots];
+  memset(slots, 0, numSlots * sizeof(int));
+  slotMask = numSlots - 1;
+  for (int i = 1; i < numNodes; i++) {
+    insertSlot(i, labelHash(labels + nodes[i].labelOffset,
+          nodes[i].labelLen));
+  }
+}
+
+void HostSuffixTrie::insertSlot(int node, uint32_t hash) {
+  int slot = slotHash(nodes[node].parent, hash) & slotMask;
+  while (slots[slot]) {
+    slot = (slot + 1) & slotMask;
+  }
+  slots[slot] = node;
+}
+
+int HostSuffixTrie::findChild(int parent, const char *label, int labelLen,
+    uint32_t hash) const {
+  int slot = slotHash(parent, hash) & slotMask;
+  while (slots[slot]) {
+    const Node &node = nodes[slots[slot]];
+    if (node.parent == parent && node.labelLen == labelLen &&
+        (!labelLen || !memcmp(labels + node.labelOffset, label, labelLen))) {
+      return slots[slot];
+    }
+    slot = (slot + 1) & slotMask;
+  }
+  return -1;
+}
+
+int HostSuffixTrie::addChild(int parent, const char *label, int labelLen,
+    uint32_t hash) {
+  if (numNodes == nodeCapacity) {
+    Node *newNodes = new Node[nodeCapacity * 2];
+    memcpy(newNodes, nodes, numNodes * sizeof(Node));
+    delete[] nodes;
+    nodes = newNodes;
+    nodeCapacity *= 2;
+  }
+  if (labelsLen + labelLen > labelsCapacity) {
+    while (labelsLen + labelLen > labelsCapacity) {
+      labelsCapacity *= 2;
+    }
+    char *newLabels = new char[labelsCapacity];
+    memcpy(newLabels, labels, labelsLen);
+    delete[] labels;
+    labels = newLabels;
+  }
+  Node &node = nodes[numNodes];
+  node.parent = parent;
+  node.labelOffset = labelsLen;
+  node.labelLen = labelLen;
+  node.flags = 0;
+  if (labelLen) {
+    memcpy(labels + labelsLen, label, labelLen);
+  }
+  labelsLen += labelLen;
+  numNodes++;
+  if (numNodes * 2 > slotMask + 1) {
+    initSlots(nodeCapacity);
+  } else {
+    insertSlot(numNodes - 1, hash);
+  }
+  return numNodes - 1;
+}
+
+void HostSuffixTrie::add(const char *host, int hostLen, uint8_t flag) {
+  if (!isBuilt() || hostLen < 0) {
+    return;
+  }
+  int node = 0;
+  int labelEnd = hostLen;
+  uint32_t hash = kFnvOffset;
+  for (int i = hostLen - 1; i >= -1; i--) {
+    if (i >= 0 && host[i] != '.') {
+      hash = (hash ^ static_cast<unsigned char>(host[i])) * kFnvPrime;
+      continue;
+    }
+    const char *label = host + i + 1;
+    const int labelLen = labelEnd - i - 1;
+    int child = findChild(node, label, labelLen, hash);
+    if (child == -1) {
+      child = addChild(node, label, labelLen, hash);
+    }
+    node = child;
+    labelEnd = i;
+    hash = kFnvOffset;
+  }
+  nodes[node].flags |= flag;
+}
+
+uint8_t HostSuffixTrie::findSuffixes(const char *host, int hostLen,
+    uint8_t mask, int *suffixStarts, int maxSuffixes,
+    int *numSuffixes) const {
+  if (numSuffixes) {
+    *numSuffixes = 0;
+  }
+  if (!isBuilt() || hostLen < 0) {
+    return 0;
+  }
+  uint8_t found = 0;
+  int node = 0;
+  int labelEnd = hostLen;
+  uint32_t hash = kFnvOffset;
+  for (int i = hostLen - 1; i >= -1; i--) {
+    if (i >= 0 && host[i] != '.') {
+      hash = (hash ^ static_cast<unsigned char>(host[i])) * kFnvPrime;
+      continue;
+    }
+    const int start = i + 1;
+    const bool isTld = node == 0;
+    node = findChild(node, host + start, labelEnd - start, hash);
+    if (node == -1) {
+      break;
+    }
+    const uint8_t flags = nodes[node].flags & mask;
+    if (flags && (!isTld || start == 0)) {
+      found |= flags;
+      if (suffixStarts && *numSuffixes < maxSuffixes) {
+        suffixStarts[(*numSuffixes)++] = start;
+      }
+    }
+    labelEnd = i;
+    hash = kFnvOffset;
+  }
+  return found;
+}
+
+uint32_t HostSuffixTrie::Serialize(char *buffer) const {
+  if (!isBuilt()) {
+    return 0;
+  }
+  char sz[32];
+  uint32_t totalSize = snprintf(sz, sizeof(sz), "%x,%x", numNodes,
+      labelsLen) + 1;
+  if (buffer) {
+    memcpy(buffer, sz, totalSize);
+  }
+
+  if (buffer) {
+    char *p = buffer + totalSize;
+    for (int i = 0; i < numNodes; i++) {
+      writeUint32(p, nodes[i].parent);
+      writeUint32(p + 4, nodes[i].labelOffset);
+      writeUint32(p + 8, nodes[i].labelLen);
+      p[12] = static_cast<char>(nodes[i].flags);
+      p += kSerializedNodeSize;
+    }
+    memcpy(p, labels, labelsLen);
+  }
+  totalSize += numNodes * kSerializedNodeSize + labelsLen;
+  return totalSize;
+}
+
+uint32_t HostSuffixTrie::Deserialize(const char *buffer,
+    uint32_t bufferSize) {
+  clear();
+  const char *end = static_cast<const char *>(memchr(buffer, '\0',
+        bufferSize));
+  if (!end) {
+    return 0;
+  }
+  char *p;
+  const int newNumNodes = static_cast<int>(strtol(buffer, &p, 16));
+  if (*p != ',') {
+    return 0;
+  }
+  const int newLabelsLen = static_cast<int>(strtol(p + 1, &p, 16));
+  if (newNumNodes <= 0 || newLabelsLen < 0) {
+    return 0;
+  }
+  const uint32_t consumed = static_cast<uint32_t>(end - buffer) + 1;
+  const uint32_t dataSize =
+    static_cast<uint32_t>(newNumNodes) * kSerializedNodeSize + newLabelsLen;
+  if (consumed + dataSize > bufferSize) {
+    return 0;
+  }
+
+  Node *newNodes = new Node[newNumNodes];
+  const char *q = buffer + consumed;
+  for (int i = 0; i < newNumNodes; i++) {
+    Node &node = newNodes[i];
+    node.parent = static_cast<int>(readUint32(q));
+    node.labelOffset = static_cast<int>(readUint32(q + 4));
+    node.labelLen = static_cast<int>(readUint32(q + 8));
+    node.flags = static_cast<uint8_t>(q[12]);
+    q += kSerializedNodeSize;
+    // Parents always come before their children
+    const bool validParent = i == 0 ? node.parent == -1 :
+      node.parent >= 0 && node.parent < i;
+    if (!validParent || node.labelOffset < 0 || node.labelLen < 0 ||
+        node.labelOffset > newLabelsLen - node.labelLen) {
+      delete[] newNodes;
+      return 0;
+    }
+  }
+
+  nodes = newNodes;
+  numNodes = newNumNodes;
+  nodeCapacity = newNumNodes;
+  labelsCapacity = newLabelsLen > 0 ? newLabelsLen : 1;
+  labels = new char[labelsCapacity];
+  memcpy(labels, q, newLabelsLen);
+  labelsLen = newLabelsLen;
+  initSlots(nodeCapacity);
+  return consumed + dataSize;
+}
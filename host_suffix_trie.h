@@ -0,0 +1,101 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef HOST_SUFFIX_TRIE_H_
+#define HOST_SUFFIX_TRIE_H_
+
+#include <stdint.h>
+#include "./base.h"
+
+// The hosts stored in the host anchored and no fingerprint domain postings
+// as a trie of labels read from the right, so "ads.example.com" is the node
+// "ads" under "example" under "com".  Each node has a flag for each of the
+// postings which holds that exact host.  Finding the stored hosts which are
+// suffixes of a host is then a single right to left pass over it which ends
+// at the first label without a node, instead of hashing and looking up each
+// suffix in each of the postings.
+class HostSuffixTrie {
+ public:
+  // Which postings a host was added for
+  enum {
+    kHostAnchored = 1,
+    kHostAnchoredException = 1 << 1,
+    kNoFingerprintDomain = 1 << 2,
+    kNoFingerprintAntiDomain = 1 << 3,
+    kNoFingerprintDomainException = 1 << 4,
+    kNoFingerprintAntiDomainException = 1 << 5,
+  };
+
+  HostSuffixTrie();
+  ~HostSuffixTrie();
+
+  void clear();
+  // Starts an empty trie which hosts can be added to.  A trie which isn't
+  // built can't be used for lookups since it doesn't know which hosts were
+  // stored before it.
+  void init();
+  bool isBuilt() const {
+    return numNodes > 0;
+  }
+  void add(const char *host, int hostLen, uint8_t flag);
+  // Returns the flags in |mask| of the stored hosts which are suffixes of
+  // |host| starting at a label, other than the TLD on its own unless it is
+  // the whole host.  When |suffixStarts| is given, it is filled with the
+  // offset in |host| of up to |maxSuffixes| of those hosts, from the
+  // shortest to the longest, and |numSuffixes| is set to how many there are.
+  uint8_t findSuffixes(const char *host, int hostLen, uint8_t mask,
+      int *suffixStarts = nullptr, int maxSuffixes = 0,
+      int *numSuffixes = nullptr) const;
+  int getNumNodes() const {
+    return numNodes;
+  }
+
+  // Serializes the trie into |buffer| and returns the number of bytes used.
+  // Passing nullptr only returns the size.
+  uint32_t Serialize(char *buffer) const;
+  // Loads a trie written by Serialize and returns the number of bytes
+  // consumed, or 0 if the buffer doesn't hold a valid trie.
+  uint32_t Deserialize(const char *buffer, uint32_t bufferSize);
+
+ private:
+  HostSuffixTrie(const HostSuffixTrie &);
+  void operator=(const HostSuffixTrie &);
+
+  // Node 0 is the root, every other node is the label at |labelOffset| in
+  // |labels| under |parent|.
+  struct Node {
+    int parent;
+    int labelOffset;
+    int labelLen;
+    uint8_t flags;
+  };
+
+  // Labels are hashed from their last character to their first one, the
+  // order they are read in.
+  static uint32_t labelHash(const char *label, int labelLen);
+  static uint32_t slotHash(int parent, uint32_t labelHash) {
+    uint32_t h = labelHash ^ (static_cast<uint32_t>(parent) * 0x9e3779b1);
+    return h ^ (h >> 16);
+  }
+  int findChild(int parent, const char *label, int labelLen,
+      uint32_t hash) const;
+  int addChild(int parent, const char *label, int labelLen, uint32_t hash);
+  void insertSlot(int node, uint32_t hash);
+  // Sizes |slots| for |capacity| nodes and inserts the existing ones
+  void initSlots(int capacity);
+
+  Node *nodes;
+  int numNodes;
+  int nodeCapacity;
+  char *labels;
+  int labelsLen;
+  int labelsCapacity;
+  // Open addressed table of the non root nodes by parent and label, 0 is
+  // an empty slot.
+  int *slots;
+  int slotMask;
+};
+
+#endif  // HOST_SUFFIX_TRIE_H_
@@ -0,0 +1,295 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "./index_of_filter.h"
+
+#include <string.h>
+#include "./ad_block_client.h"
+#include "./url_lexer.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define HAS_SSE2
+#include <emmintrin.h>
+#endif
+
+// AVX2 is only used when the CPU reports it, which needs the GCC and clang
+// target attribute and CPU detection builtins.
+#if defined(HAS_SSE2) && (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define HAS_AVX2_DISPATCH
+#include <immintrin.h>
+#endif
+
+int indexOfFilterScalar(const char *input, int inputLen,
+    const char *filterBegin, const char *filterEnd) {
+  const int filterLen = static_cast<int>(filterEnd - filterBegin);
+  if (1 == filterLen && '^' == *filterBegin) return -1;
+  if (filterLen > inputLen) {
+    return -1;
+  }
+
+  for (int i = 0; i < inputLen; ++i) {
+    bool match = true;
+    for (int j = 0; j < filterLen; ++j) {
+      const char filterChar = filterBegin[j];
+      if (i + j >= inputLen) {
+        // ^abc^ matches both /abc/ and /abc
+        if ('^' == filterChar) {
+          continue;
+        }
+        return -1;
+      }
+      const char inputChar = input[i+j];
+
+      if (filterChar != inputChar) {
+        if ('^' == filterChar && isSeparatorChar(inputChar)) {
+          continue;
+        }
+        match = false;
+        break;
+      }
+    }
+    if (match) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+#ifdef HAS_SSE2
+static inline int countTrailingZeros(unsigned int mask) {
+#if defined(_MSC_VER) && !defined(__clang__)
+  unsigned long index;  // NOLINT
+  _BitScanForward(&index, mask);
+  return static_cast<int>(index);
+#else
+  return __builtin_ctz(mask);
+#endif
+}
+#endif
+
+// Each of these returns the first position in [p, last) where |c0| is
+// followed by |c1|, or nullptr.  |last| is one before the end of the input
+// so that the byte after any position scanned can always be read.
+typedef const char * (*FindPairFn)(const char *p, const char *last,
+    char c0, char c1);
+
+static const char * findPairScalar(const char *p, const char *last,
+    char c0, char c1) {
+  while (p < last) {
+    p = static_cast<const char *>(memchr(p, c0, last - p));
+    if (!p) {
+      return nullptr;
+    }
+    if (p[1] == c1) {
+      return p;
+    }
+    p++;
+  }
+  return nullptr;
+}
+
+#ifdef HAS_SSE2
+static const char * findPairSSE2(const char *p, const char *last,
+    char c0, char c1) {
+  const __m128i first = _mm_set1_epi8(c0);
+  const __m128i second = _mm_set1_epi8(c1);
+  while (last - p >= 16) {
+    const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+    const __m128i b =
+      _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + 1));
+    const unsigned int mask = _mm_movemask_epi8(_mm_and_si128(
+          _mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, second)));
+    if (mask) {
+      return p + countTrailingZeros(mask);
+    }
+    p += 16;
+  }
+  return findPairScalar(p, last, c0, c1);
+}
+#endif
+
+#ifdef HAS_AVX2_DISPATCH
+__attribute__((target("avx2")))
+static const char * findPairAVX2(const char *p, const char *last,
+    char c0, char c1) {
+  const __m256i first = _mm256_set1_epi8(c0);
+  const __m256i second = _mm256_set1_epi8(c1);
+  while (last - p >= 32) {
+    const __m256i a =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+    const __m256i b =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + 1));
+    const unsigned int mask = _mm256_movemask_epi8(_mm256_and_si256(
+          _mm256_cmpeq_epi8(a, first), _mm256_cmpeq_epi8(b, second)));
+    if (mask) {
+      return p + countTrailingZeros(mask);
+    }
+    p += 32;
+  }
+  return findPairSSE2(p, last, c0, c1);
+}
+#endif
+
+static FindPairFn chooseFindPair() {
+#ifdef HAS_AVX2_DISPATCH
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    return findPairAVX2;
+  }
+#endif
+#ifdef HAS_SSE2
+  return findPairSSE2;
+#else
+  return findPairScalar;
+#endif
+}
+
+static const char * findPair(const char *p, const char *last, char c0,
+    char c1) {
+  // Set on first use, so calls made while other files are still running
+  // their static initializers don't find it unset.
+  static const FindPairFn impl = chooseFindPair();
+  return impl(p, last, c0, c1);
+}
+
+// Tests whether an input byte is a separator with the separator table
+struct SeparatorTable {
+  bool operator()(const char *input, int i) const {
+    return isSeparatorChar(input[i]);
+  }
+};
+
+// Tests whether an input byte is a separator with the bitmap of the URL the
+// input is part of.
+struct SeparatorBits {
+  SeparatorBits(const SeparatorBitmap &bitmap, int offset) :
+      bitmap(bitmap), offset(offset) {
+  }
+  // The input is only taken to match SeparatorTable, the bitmap has it all
+  bool operator()(const char *, int i) const {
+    return bitmap.isSeparatorAt(offset + i);
+  }
+  const SeparatorBitmap &bitmap;
+  int offset;
+};
+
+// Compares the filter at position |i| of the input.  Returns 1 for a match
+// and 0 for a mismatch.  Returns -1 if the filter runs past the end of the
+// input on a byte other than '^', since no later position can match then
+// either.
+template<typename IsSeparator>
+static int matchesAt(const char *input, int inputLen, int i,
+    const char *filterBegin, int filterLen, const IsSeparator &isSeparator) {
+  for (int j = 0; j < filterLen; ++j) {
+    const char filterChar = filterBegin[j];
+    if (i + j >= inputLen) {
+      if ('^' == filterChar) {
+        continue;
+      }
+      return -1;
+    }
+    if (filterChar != input[i + j] &&
+        ('^' != filterChar || !isSeparator(input, i + j))) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+template<typename IsSeparator>
+static int indexOfFilter(const char *input, int inputLen,
+    const char *filterBegin, const char *filterEnd,
+    const IsSeparator &isSeparator) {
+  const int filterLen = static_cast<int>(filterEnd - filterBegin);
+  if (1 == filterLen && '^' == *filterBegin) return -1;
+  if (filterLen > inputLen) {
+    return -1;
+  }
+
+  // Every filter byte other than '^' has to occur in the input as is, so
+  // only positions where the first of those does are worth comparing.
+  int anchor = 0;
+  while (anchor < filterLen && '^' == filterBegin[anchor]) {
+    anchor++;
+  }
+  if (anchor == filterLen) {
+    return indexOfFilterScalar(input, inputLen, filterBegin, filterEnd);
+  }
+  const bool scanPair = anchor + 1 < filterLen &&
+    '^' != filterBegin[anchor + 1];
+  const char c0 = filterBegin[anchor];
+  const char c1 = scanPair ? filterBegin[anchor + 1] : '\0';
+
+  const char *end = input + inputLen;
+  const char *p = input + anchor;
+  while (p < end) {
+    const char *candidate = scanPair ? findPair(p, end - 1, c0, c1) :
+      static_cast<const char *>(memchr(p, c0, end - p));
+    if (!candidate) {
+      return -1;
+    }
+    const int i = static_cast<int>(candidate - input) - anchor;
+    const int result = matchesAt(input, inputLen, i, filterBegin, filterLen,
+        isSeparator);
+    if (result == 1) {
+      return i;
+    }
+    if (result == -1) {
+      return -1;
+    }
+    p = candidate + 1;
+  }
+  return -1;
+}
+
+int indexOfFilter(const char *input, int inputLen,
+    const char *filterBegin, const char *filterEnd) {
+  return indexOfFilter(input, inputLen, filterBegin, filterEnd,
+      SeparatorTable());
+}
+
+int indexOfFilter(const char *input, int inputLen,
+    const char *filterBegin, const char *filterEnd,
+    const SeparatorBitmap &separators, int separatorsOffset) {
+  if (!separators.covers(separatorsOffset + inputLen)) {
+    return indexOfFilter(input, inputLen, filterBegin, filterEnd,
+        SeparatorTable());
+  }
+  return indexOfFilter(input, inputLen, filterBegin, filterEnd,
+      SeparatorBits(separators, separatorsOffset));
+}
+
+int indexOfLiteral(const char *input, int inputLen,
+    const char *literal, int literalLen) {
+  if (literalLen > inputLen || inputLen == 0) {
+    return -1;
+  }
+  if (literalLen <= 1) {
+    if (literalLen == 0) {
+      return 0;
+    }
+    const char *p = static_cast<const char *>(memchr(input, *literal,
+          inputLen));
+    return p ? static_cast<int>(p - input) : -1;
+  }
+
+  // Only positions where the whole literal fits are scanned, the byte after
+  // each of them is always in the input.
+  const char *last = input + inputLen - literalLen + 1;
+  const char *p = input;
+  while (p < last) {
+    const char *candidate = findPair(p, last, literal[0], literal[1]);
+    if (!candidate) {
+      return -1;
+    }
+    if (!memcmp(candidate + 2, literal + 2, literalLen - 2)) {
+      return static_cast<int>(candidate - input);
+    }
+    p = candidate + 1;
+  }
+  return -1;
+}
@@ -0,0 +1,40 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef INDEX_OF_FILTER_H_
+#define INDEX_OF_FILTER_H_
+
+class SeparatorBitmap;
+
+// Similar to str1.indexOf(filter, startingPos) but with extra consideration
+// to some ABP filter rules like ^, which matches any separator character and
+// also matches past the end of the input.  Returns the offset of the first
+// match in |input|, or -1 if there is none.
+// Never reads past |inputLen|, the input doesn't need to be NUL terminated.
+//
+// Candidate positions are found by scanning for the first byte, or pair of
+// bytes, of the filter which has to occur as is.  The scan uses AVX2 when the
+// CPU supports it, SSE2 otherwise on x86, and memchr everywhere else.
+int indexOfFilter(const char *input, int inputLen,
+    const char *filterBegin, const char *filterEnd);
+
+// Same as above, matching '^' with bit tests in |separators|, the bitmap of
+// a URL which starts |separatorsOffset| bytes before |input|.  The
+// separator table is used instead when the bitmap doesn't cover the input.
+int indexOfFilter(const char *input, int inputLen,
+    const char *filterBegin, const char *filterEnd,
+    const SeparatorBitmap &separators, int separatorsOffset);
+
+// Same as indexOfFilter, comparing the filter at every input position.  This
+// is the reference behavior the scanning versions have to agree with.
+int indexOfFilterScalar(const char *input, int inputLen,
+    const char *filterBegin, const char *filterEnd);
+
+// Same as indexOfFilter for a filter without any '^', which only has to be
+// compared where it fits in the input and can be compared with memcmp.
+int indexOfLiteral(const char *input, int inputLen,
+    const char *literal, int literalLen);
+
+#endif  // INDEX_OF_FILTER_H_
@@ -0,0 +1,320 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "./match_cache.h"
+
+#include <random>
+
+namespace {
+
+inline uint64_t rotateLeft(uint64_t x, int b) {
+  return (x << b) | (x >> (64 - b));
+}
+
+// SipHash-2-4 fed a few bytes at a time
+class SipHasher {
+ public:
+  SipHasher(uint64_t k0, uint64_t k1) :
+      v0(k0 ^ 0x736f6d6570736575ULL),
+      v1(k1 ^ 0x646f72616e646f6dULL),
+      v2(k0 ^ 0x6c7967656e657261ULL),
+      v3(k1 ^ 0x7465646279746573ULL),
+      tail(0),
+      length(0) {
+  }
+
+  void add(unsigned char byte) {
+    tail |= static_cast<uint64_t>(byte) << (8 * (length % 8));
+    length++;
+    if (length % 8 == 0) {
+      compress(tail);
+      tail = 0;
+    }
+  }
+
+  uint64_t finish() {
+    compress(tail | (length << 56));
+    v2 ^= 0xff;
+    for (int i = 0; i < 4; i++) {
+      round();
+    }
+    return v0 ^ v1 ^ v2 ^ v3;
+  }
+
+ private:
+  void round() {
+    v0 += v1;
+    v1 = rotateLeft(v1, 13);
+    v1 ^= v0;
+    v0 = rotateLeft(v0, 32);
+    v2 += v3;
+    v3 = rotateLeft(v3, 16);
+    v3 ^= v2;
+    v0 += v3;
+    v3 = rotateLeft(v3, 21);
+    v3 ^= v0;
+    v2 += v1;
+    v1 = rotateLeft(v1, 17);
+    v1 ^= v2;
+    v2 = rotateLeft(v2, 32);
+  }
+
+  void compress(uint64_t m) {
+    v3 ^= m;
+    round();
+    round();
+    v0 ^= m;
+  }
+
+  uint64_t v0, v1, v2, v3;
+  // Bytes added since the last full word
+  uint64_t tail;
+  uint64_t length;
+};
+
+}  // namespace
+
+MatchCache::Shard::Shard() :
+    entries(nullptr),
+    buckets(nullptr),
+    capacity(0),
+    bucketMask(0),
+    numEntries(0),
+    head(-1),
+    tail(-1),
+    numHits(0),
+    numMisses(0),
+    numEvictions(0) {
+}
+
+MatchCache::Shard::~Shard() {
+  if (entries) {
+    delete[] entries;
+  }
+  if (buckets) {
+    delete[] buckets;
+  }
+}
+
+void MatchCache::Shard::init(int capacity) {
+  this->capacity = capacity;
+  entries = new Entry[capacity];
+  // At least twice as many buckets as entries so the chains stay short
+  int numBuckets = 1;
+  while (numBuckets < capacity * 2) {
+    numBuckets <<= 1;
+  }
+  buckets = new int[numBuckets];
+  bucketMask = numBuckets - 1;
+  clear();
+}
+
+void MatchCache::Shard::clear() {
+  for (int i = 0; i <= bucketMask; i++) {
+    buckets[i] = -1;
+  }
+  numEntries = 0;
+  head = -1;
+  tail = -1;
+}
+
+int MatchCache::Shard::findEntry(uint64_t key) const {
+  int index = buckets[key & bucketMask];
+  while (index != -1 && entries[index].key != key) {
+    index = entries[index].bucketNext;
+  }
+  return index;
+}
+
+void MatchCache::Shard::unlink(int index) {
+  Entry &entry = entries[index];
+  if (entry.prev != -1) {
+    entries[entry.prev].next = entry.next;
+  } else {
+    head = entry.next;
+  }
+  if (entry.next != -1) {
+    entries[entry.next].prev = entry.prev;
+  } else {
+    tail = entry.prev;
+  }
+}
+
+void MatchCache::Shard::pushFront(int index) {
+  Entry &entry = entries[index];
+  entry.prev = -1;
+  entry.next = head;
+  if (head != -1) {
+    entries[head].prev = index;
+  }
+  head = index;
+  if (tail == -1) {
+    tail = index;
+  }
+}
+
+void MatchCache::Shard::removeFromBucket(int index) {
+  int *link = &buckets[entries[index].key & bucketMask];
+  while (*link != index) {
+    link = &entries[*link].bucketNext;
+  }
+  *link = entries[index].bucketNext;
+}
+
+MatchCache::MatchCache(size_t maxEntries) :
+    shards(nullptr),
+    numShards(0),
+    maxEntries(maxEntries ? maxEntries : 1) {
+  std::random_device random;
+  for (int i = 0; i < 2; i++) {
+    hashKey[i] = static_cast<uint64_t>(random()) << 32 ^ random();
+  }
+  numShards = this->maxEntries < kMaxShards ?
+    static_cast<int>(this->maxEntries) : kMaxShards;
+  shards = new Shard[numShards];
+  // Spread the entries over the shards without going over |maxEntries|
+  for (int i = 0; i < numShards; i++) {
+    shards[i].init(static_cast<int>(this->maxEntries / numShards +
+          (static_cast<size_t>(i) < this->maxEntries % numShards ? 1 : 0)));
+  }
+}
+
+MatchCache::~MatchCache() {
+  if (shards) {
+    delete[] shards;
+  }
+}
+
+size_t MatchCache::entriesForBytes(size_t maxBytes) {
+  // Each entry uses up to 2 buckets as well
+  return maxBytes / (sizeof(Entry) + 2 * sizeof(int));
+}
+
+// SipHash over the length of the input and all three parts, so that moving
+// bytes between them changes the key.
+uint64_t MatchCache::hash(const char *input, int inputLen,
+    FilterOption contextOption, const char *contextDomain,
+    int contextDomainLen) const {
+  SipHasher hasher(hashKey[0], hashKey[1]);
+  for (int i = 0; i < 4; i++) {
+    hasher.add(static_cast<unsigned char>(
+          static_cast<uint32_t>(inputLen) >> (i * 8)));
+  }
+  for (int i = 0; i < inputLen; i++) {
+    hasher.add(static_cast<unsigned char>(input[i]));
+  }
+  for (int i = 0; i < 4; i++) {
+    hasher.add(static_cast<unsigned char>(
+          static_cast<uint32_t>(contextOption) >> (i * 8)));
+  }
+  hasher.add(contextDomain ? 1 : 0);
+  for (int i = 0; i < contextDomainLen; i++) {
+    hasher.add(static_cast<unsigned char>(contextDomain[i]));
+  }
+  return hasher.finish();
+}
+
+bool MatchCache::find(uint64_t key, bool *matches) {
+  uint8_t value;
+  if (!findValue(key, &value)) {
+    return false;
+  }
+  *matches = value != 0;
+  return true;
+}
+
+void MatchCache::add(uint64_t key, bool matches) {
+  addValue(key, matches ? 1 : 0);
+}
+
+bool MatchCache::findValue(uint64_t key, uint8_t *value) {
+  Shard &shard = shardFor(key);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  int index = shard.findEntry(key);
+  if (index == -1) {
+    shard.numMisses++;
+    return false;
+  }
+  shard.numHits++;
+  if (shard.head != index) {
+    shard.unlink(index);
+    shard.pushFront(index);
+  }
+  *value = shard.entries[index].value;
+  return true;
+}
+
+void MatchCache::addValue(uint64_t key, uint8_t value) {
+  Shard &shard = shardFor(key);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  int index = shard.findEntry(key);
+  if (index != -1) {
+    // Another thread added it in the meantime
+    shard.entries[index].value = value;
+    return;
+  }
+  if (shard.numEntries < shard.capacity) {
+    index = shard.numEntries++;
+  } else {
+    index = shard.tail;
+    shard.unlink(index);
+    shard.removeFromBucket(index);
+    shard.numEvictions++;
+  }
+  Entry &entry = shard.entries[index];
+  entry.key = key;
+  entry.value = value;
+  int *bucket = &shard.buckets[key & shard.bucketMask];
+  entry.bucketNext = *bucket;
+  *bucket = index;
+  shard.pushFront(index);
+}
+
+void MatchCache::clear() {
+  for (int i = 0; i < numShards; i++) {
+    std::lock_guard<std::mutex> lock(shards[i].mutex);
+    shards[i].clear();
+  }
+}
+
+size_t MatchCache::getMaxEntries() const {
+  return maxEntries;
+}
+
+size_t MatchCache::getNumEntries() {
+  size_t total = 0;
+  for (int i = 0; i < numShards; i++) {
+    std::lock_guard<std::mutex> lock(shards[i].mutex);
+    total += shards[i].numEntries;
+  }
+  return total;
+}
+
+uint64_t MatchCache::getNumHits() {
+  uint64_t total = 0;
+  for (int i = 0; i < numShards; i++) {
+    std::lock_guard<std::mutex> lock(shards[i].mutex);
+    total += shards[i].numHits;
+  }
+  return total;
+}
+
+uint64_t MatchCache::getNumMisses() {
+  uint64_t total = 0;
+  for (int i = 0; i < numShards; i++) {
+    std::lock_guard<std::mutex> lock(shards[i].mutex);
+    total += shards[i].numMisses;
+  }
+  return total;
+}
+
+uint64_t MatchCache::getNumEvictions() {
+  uint64_t total = 0;
+  for (int i = 0; i < numShards; i++) {
+    std::lock_guard<std::mutex> lock(shards[i].mutex);
+    total += shards[i].numEvictions;
+  }
+  return total;
+}
@@ -0,0 +1,104 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef MATCH_CACHE_H_
+#define MATCH_CACHE_H_
+
+#include <stddef.h>
+#include <mutex>  // NOLINT
+#include "./base.h"
+#include "./filter.h"
+
+// Bounded least recently used cache of matches() results, keyed by a 64 bit
+// hash of the URL, the context option and the context domain.  The hash is
+// SipHash with a random key for each cache, so pages can't pick a URL whose
+// key collides with the key of another request and get its result.  It is
+// split
+// into shards which each have their own lock, so threads checking different
+// URLs rarely wait on each other.  All of the memory is allocated up front,
+// lookups and inserts never allocate.  The same cache keyed by host instead
+// of URL holds host decisions, which are small values instead of booleans.
+class MatchCache {
+ public:
+  // Holds at most |maxEntries| results
+  explicit MatchCache(size_t maxEntries);
+  ~MatchCache();
+
+  // Returns the number of entries which fit in |maxBytes| of memory
+  static size_t entriesForBytes(size_t maxBytes);
+  // Returns the key of a request in this cache
+  uint64_t hash(const char *input, int inputLen,
+      FilterOption contextOption, const char *contextDomain,
+      int contextDomainLen) const;
+
+  // Sets |matches| to the cached result and returns true if there is one
+  bool find(uint64_t key, bool *matches);
+  // Adds or updates a result, evicting the least recently used entry of
+  // the shard if it is full.
+  void add(uint64_t key, bool matches);
+  // Same as find and add for values other than booleans
+  bool findValue(uint64_t key, uint8_t *value);
+  void addValue(uint64_t key, uint8_t value);
+  // Drops every entry, the stats are kept.
+  void clear();
+
+  size_t getMaxEntries() const;
+  size_t getNumEntries();
+  uint64_t getNumHits();
+  uint64_t getNumMisses();
+  uint64_t getNumEvictions();
+
+  static const int kMaxShards = 16;
+
+ private:
+  MatchCache(const MatchCache &);
+  void operator=(const MatchCache &);
+
+  struct Entry {
+    uint64_t key;
+    // Least recently used list
+    int prev;
+    int next;
+    // Next entry in the same bucket
+    int bucketNext;
+    uint8_t value;
+  };
+
+  struct Shard {
+    Shard();
+    ~Shard();
+    void init(int capacity);
+    void clear();
+    int findEntry(uint64_t key) const;
+    void unlink(int index);
+    void pushFront(int index);
+    void removeFromBucket(int index);
+
+    std::mutex mutex;
+    Entry *entries;
+    int *buckets;
+    int capacity;
+    int bucketMask;
+    int numEntries;
+    // Most and least recently used entries
+    int head;
+    int tail;
+    uint64_t numHits;
+    uint64_t numMisses;
+    uint64_t numEvictions;
+  };
+
+  Shard & shardFor(uint64_t key) {
+    return shards[(key >> 56) % numShards];
+  }
+
+  Shard *shards;
+  int numShards;
+  size_t maxEntries;
+  // SipHash key
+  uint64_t hashKey[2];
+};
+
+#endif  // MATCH_CACHE_H_
@@ -0,0 +1,175 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "./match_request.h"
+
+#include <string.h>
+#include "./ad_block_client.h"
+#include "./public_suffix_list.h"
+
+#include "BloomFilter.h"
+
+const char * getUrlHost(const char *input, int inputLen, int *len) {
+  const char *end = input + inputLen;
+  const char *p = input;
+  while (p != end && *p != ':') {
+    p++;
+  }
+  if (p != end) {
+    p++;
+    while (p != end && *p == '/') {
+      p++;
+    }
+  }
+  *len = findFirstSeparatorChar(p, end);
+  return p;
+}
+
+// Fills |labels| with the offset of each label of |domain| and returns how
+// many there are.  Labels are found from the right so that if there are too
+// many, the ones closest to the TLD are the ones kept.
+static int findDomainLabels(const char *domain, int domainLen, int *labels) {
+  const int kMax = MatchRequest::kMaxDomainLabels;
+  int count = 0;
+  for (int i = domainLen - 1; i >= 0 && count < kMax - 1; i--) {
+    if (domain[i] == '.') {
+      labels[kMax - 1 - count] = i + 1;
+      count++;
+    }
+  }
+  labels[kMax - 1 - count] = 0;
+  count++;
+  memmove(labels, labels + kMax - count, count * sizeof(int));
+  return count;
+}
+
+const char * MatchRequest::lowercase(const char *s, int len, char *buffer,
+    int bufferLen, char **allocated) {
+  char *out = buffer;
+  if (len > bufferLen) {
+    *allocated = new char[len];
+    out = *allocated;
+  }
+  if (lowercaseAscii(s, len, out)) {
+    return out;
+  }
+  if (*allocated) {
+    delete[] *allocated;
+    *allocated = nullptr;
+  }
+  return s;
+}
+
+MatchRequest::MatchRequest(const char *input, int inputLen,
+    FilterOption contextOption, const char *contextDomain,
+    int contextDomainLen) :
+    input(input),
+    originalInput(input),
+    inputLen(inputLen),
+    host(nullptr),
+    hostLen(0),
+    contextDomain(contextDomain),
+    contextDomainLen(contextDomain ? contextDomainLen : 0),
+    contextOption(contextOption),
+    thirdParty(false),
+    blockableProtocol(false),
+    inputBloomFilter(nullptr),
+    numHostLabels(0),
+    numContextDomainLabels(0),
+    hasBigrams(true),
+    allocatedInput(nullptr),
+    allocatedHost(nullptr) {
+  this->input = lowercase(originalInput, inputLen, inputBuffer,
+      kInlineInputLen, &allocatedInput);
+  input = this->input;
+  blockableProtocol = lexUrl(input, inputLen, &separators, &host, &hostLen);
+  numHostLabels = findDomainLabels(host, hostLen, hostLabels);
+  numContextDomainLabels = findDomainLabels(contextDomain,
+      this->contextDomainLen, contextDomainLabels);
+
+  if (contextDomain) {
+    thirdParty = isThirdPartyDomain(contextDomain, this->contextDomainLen,
+        host, hostLen);
+    this->contextOption = static_cast<FilterOption>(contextOption |
+        (thirdParty ? FOThirdParty : FONotThirdParty));
+  }
+
+  // Optimization for the manual filter checks which are needed.
+  // Avoid having to check individual filters if the filter parts are not
+  // found inside the input bigrams.
+  memset(bigrams, 0, sizeof(bigrams));
+  for (int i = 1; i < inputLen; i++) {
+    const int bit = bigramBit(input + i - 1);
+    bigrams[bit >> 3] |= 1 << (bit & 7);
+    bigramSignature.add(input + i - 1);
+  }
+}
+
+MatchRequest::MatchRequest(const char *input, int inputLen,
+    FilterOption contextOption, const char *contextDomain,
+    BloomFilter *inputBloomFilter, const char *inputHost, int inputHostLen) :
+    input(input),
+    originalInput(input),
+    inputLen(inputLen),
+    host(inputHost),
+    hostLen(inputHostLen),
+    contextDomain(contextDomain),
+    contextDomainLen(0),
+    contextOption(contextOption),
+    thirdParty(false),
+    blockableProtocol(false),
+    inputBloomFilter(inputBloomFilter),
+    numHostLabels(0),
+    numContextDomainLabels(0),
+    hasBigrams(false),
+    allocatedInput(nullptr),
+    allocatedHost(nullptr) {
+  this->input = lowercase(originalInput, inputLen, inputBuffer,
+      kInlineInputLen, &allocatedInput);
+  input = this->input;
+  // The bloom filter was built from the input as it was passed in, so it
+  // can't be used for the lowercased one.
+  if (input != originalInput) {
+    this->inputBloomFilter = nullptr;
+  }
+  if (hostLen) {
+    host = lowercase(inputHost, hostLen, hostBuffer, kInlineHostLen,
+        &allocatedHost);
+  }
+  const char *lexedHost;
+  int lexedHostLen;
+  blockableProtocol = lexUrl(input, inputLen, &separators, &lexedHost,
+      &lexedHostLen);
+  if (!hostLen) {
+    host = lexedHost;
+    hostLen = lexedHostLen;
+  }
+  numHostLabels = findDomainLabels(host, hostLen, hostLabels);
+  // The host passed in is matched by host anchored filters too, so its
+  // bigrams are added in case it isn't part of the input.
+  bigramSignature.addAll(input, inputLen);
+  if (host != lexedHost) {
+    bigramSignature.addAll(host, hostLen);
+  }
+  if (contextDomain) {
+    contextDomainLen = static_cast<int>(strlen(contextDomain));
+  }
+  numContextDomainLabels = findDomainLabels(contextDomain, contextDomainLen,
+      contextDomainLabels);
+  thirdParty = (contextOption & FOThirdParty) != 0;
+}
+
+MatchRequest::~MatchRequest() {
+  if (allocatedInput) {
+    delete[] allocatedInput;
+  }
+  if (allocatedHost) {
+    delete[] allocatedHost;
+  }
+}
+
+bool MatchRequest::bloomFilterContains(const char *p) const {
+  return inputBloomFilter->exists(p, 2);
+}
@@ -0,0 +1,127 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef MATCH_REQUEST_H_
+#define MATCH_REQUEST_H_
+
+#include "./base.h"
+#include "./bigram_signature.h"
+#include "./filter.h"
+#include "./url_lexer.h"
+
+class BloomFilter;
+
+// Everything about a single URL check which doesn't depend on the filter
+// being evaluated.  It is built once per URL and passed to every matching
+// stage so that no stage has to measure, scan, lowercase or split the URL or
+// the context domain again.  Neither string needs to be NUL terminated.
+class MatchRequest {
+ public:
+  // Builds a request for |input| loaded by a page on |contextDomain|.
+  // FOThirdParty or FONotThirdParty is added to |contextOption| when there is
+  // a context domain, depending on whether the host and the context domain
+  // have the same registrable domain in the public suffix list, and the
+  // bigram prefilter and signature are built.
+  MatchRequest(const char *input, int inputLen,
+      FilterOption contextOption = FONoFilterOption,
+      const char *contextDomain = nullptr, int contextDomainLen = 0);
+  // Used by the Filter::matches overloads which are handed the parts of a
+  // request separately.  |contextOption| is taken as is, |inputBloomFilter|
+  // is borrowed and used instead of the bigram prefilter, and the host is
+  // only found when |inputHostLen| is 0.
+  MatchRequest(const char *input, int inputLen, FilterOption contextOption,
+      const char *contextDomain, BloomFilter *inputBloomFilter,
+      const char *inputHost, int inputHostLen);
+  ~MatchRequest();
+
+  // Most hosts have a handful of labels, and a valid DNS name can't have
+  // more than 127.
+  static const int kMaxDomainLabels = 128;
+  // Size of the bigram prefilter, a URL has about a hundred bigrams.
+  static const int kBigramBits = 8192;
+  // Longest input and host which are lowercased without allocating.  About
+  // 99% of URLs fit, longer ones with uppercase letters are copied to the
+  // heap instead so that a request stays small enough for the stack.
+  static const int kInlineInputLen = 1024;
+  static const int kInlineHostLen = 256;
+
+  // Returns false only if the 2 characters at |p| don't occur next to each
+  // other anywhere in the input.
+  bool mayContainBigram(const char *p) const {
+    if (inputBloomFilter) {
+      return bloomFilterContains(p);
+    }
+    const int bit = bigramBit(p);
+    return !hasBigrams || (bigrams[bit >> 3] & (1 << (bit & 7)));
+  }
+  bool hasBigramPrefilter() const {
+    return hasBigrams || inputBloomFilter;
+  }
+
+  // The input with its ASCII letters lowercased, which is what filters are
+  // matched against since their data is lowercased when they're parsed.
+  // The separators and the host are found in it too.
+  const char *input;
+  // The input as it was passed in, for $match-case filters
+  const char *originalInput;
+  int inputLen;
+  const char *host;
+  int hostLen;
+  const char *contextDomain;
+  int contextDomainLen;
+  FilterOption contextOption;
+  bool thirdParty;
+  // Whether the URL uses a protocol filters apply to, see
+  // isBlockableProtocol().
+  bool blockableProtocol;
+  // Where the separators of the input are, for '^' in filters
+  SeparatorBitmap separators;
+  // Every bigram of the input, compared with Filter::signature
+  BigramSignature bigramSignature;
+
+  // Only set for requests built from separate parts, see above.
+  BloomFilter *inputBloomFilter;
+
+  // Offsets of the first character of each label of the host and the
+  // context domain, from left to right.  The first offset is always 0.  If
+  // there are more labels than fit, the leftmost ones other than the first
+  // are dropped.
+  int hostLabels[kMaxDomainLabels];
+  int numHostLabels;
+  int contextDomainLabels[kMaxDomainLabels];
+  int numContextDomainLabels;
+
+ private:
+  MatchRequest(const MatchRequest &);
+  void operator=(const MatchRequest &);
+
+  static int bigramBit(const char *p) {
+    return ((static_cast<unsigned char>(p[0]) << 5) ^
+        static_cast<unsigned char>(p[1])) & (kBigramBits - 1);
+  }
+  bool bloomFilterContains(const char *p) const;
+  // Returns |s| with its ASCII letters lowercased, in |buffer| if it fits
+  // in |bufferLen| bytes or else in |*allocated|.  |s| itself is returned
+  // when it has no uppercase letters.
+  static const char * lowercase(const char *s, int len, char *buffer,
+      int bufferLen, char **allocated);
+
+  // Every 2 byte substring of the input, used to quickly rule out filters
+  // with parts that can't occur in the input.  Kept inline so that building
+  // a request never allocates.
+  bool hasBigrams;
+  unsigned char bigrams[kBigramBits / 8];
+  // Lowercased copies of the input and of a host passed in separately,
+  // inline for the same reason.
+  char inputBuffer[kInlineInputLen];
+  char hostBuffer[kInlineHostLen];
+  char *allocatedInput;
+  char *allocatedHost;
+};
+
+// Finds the host within the passed in URL and returns its length
+const char * getUrlHost(const char *input, int inputLen, int *len);
+
+#endif  // MATCH_REQUEST_H_
@@ -0,0 +1,121 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "./no_fingerprint_matcher.h"
+
+#include <string.h>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "./filter.h"
+#include "./match_request.h"
+#include "./url_lexer.h"
+
+// Finds the longest run of |data| without '*' or '^', or returns false if
+// there is none.
+static bool findKey(const char *data, int dataLen, int *keyStart,
+    int *keyLen) {
+  *keyLen = 0;
+  int runStart = 0;
+  for (int i = 0; i <= dataLen; i++) {
+    if (i < dataLen && data[i] != '*' && data[i] != '^') {
+      continue;
+    }
+    if (i - runStart > *keyLen) {
+      *keyStart = runStart;
+      *keyLen = i - runStart;
+    }
+    runStart = i + 1;
+  }
+  return *keyLen > 0;
+}
+
+NoFingerprintMatcher::NoFingerprintMatcher() :
+    numFilters(0),
+    numKeys(0),
+    alwaysCandidates(nullptr) {
+}
+
+NoFingerprintMatcher::~NoFingerprintMatcher() {
+  clear();
+}
+
+void NoFingerprintMatcher::clear() {
+  automaton.clear();
+  anchoredFilterIndex.clear();
+  if (alwaysCandidates) {
+    delete[] alwaysCandidates;
+    alwaysCandidates = nullptr;
+  }
+  numFilters = 0;
+  numKeys = 0;
+}
+
+void NoFingerprintMatcher::build(const Filter *filters, int numFilters,
+    const char *anchoredIndexBuffer, uint32_t anchoredIndexSize) {
+  clear();
+  if (numFilters > kMaxFilters) {
+    return;
+  }
+  const int numWords = (numFilters + 63) / 64 + 1;
+  alwaysCandidates = new uint64_t[numWords];
+  memset(alwaysCandidates, 0, sizeof(uint64_t) * numWords);
+
+  // URLs are searched lowercased, so are the keys of match-case filters
+  std::map<std::string, std::vector<int> > keys;
+  for (int i = 0; i < numFilters; i++) {
+    const Filter &filter = filters[i];
+    if (AnchoredFilterIndex::isIndexed(filter)) {
+      continue;
+    }
+    const int dataLen = !filter.data ? 0 : filter.dataLen == -1 ?
+      static_cast<int>(strlen(filter.data)) : filter.dataLen;
+    int keyStart, keyLen;
+    if ((filter.filterType & FTRegex) ||
+        !findKey(filter.data, dataLen, &keyStart, &keyLen)) {
+      alwaysCandidates[i / 64] |= 1ULL << (i % 64);
+      continue;
+    }
+    std::string key(filter.data + keyStart, keyLen);
+    lowercaseAscii(&key[0], keyLen, &key[0]);
+    keys[key].push_back(i);
+  }
+  automaton.build(keys);
+  if (!anchoredIndexBuffer || anchoredIndexSize == 0 ||
+      anchoredFilterIndex.Deserialize(anchoredIndexBuffer, anchoredIndexSize,
+        numFilters) != anchoredIndexSize) {
+    anchoredFilterIndex.build(filters, numFilters);
+  }
+  this->numFilters = numFilters;
+  numKeys = static_cast<int>(keys.size());
+}
+
+bool NoFingerprintMatcher::findCandidates(const MatchRequest &request,
+    int numFilters, uint64_t *candidates) const {
+  if (!isBuilt() || numFilters != this->numFilters) {
+    return false;
+  }
+  const int numWords = (numFilters + 63) / 64;
+  memcpy(candidates, alwaysCandidates, sizeof(uint64_t) * numWords);
+  anchoredFilterIndex.findCandidates(request, candidates);
+  // The same ids are often reached again, like the keys ending in the
+  // fail state of the one before.
+  const int *lastIds = nullptr;
+  int state = FingerprintAutomaton::kRootState;
+  for (int i = 0; i < request.inputLen; i++) {
+    state = automaton.next(state, request.input[i]);
+    int numIds;
+    const int *ids = automaton.filterIds(state, &numIds);
+    if (!ids || ids == lastIds) {
+      continue;
+    }
+    lastIds = ids;
+    for (int j = 0; j < numIds; j++) {
+      candidates[ids[j] / 64] |= 1ULL << (ids[j] % 64);
+    }
+  }
+  return true;
+}
@@ -0,0 +1,71 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef NO_FINGERPRINT_MATCHER_H_
+#define NO_FINGERPRINT_MATCHER_H_
+
+#include <stdint.h>
+#include "./anchored_filter_index.h"
+#include "./base.h"
+#include "./fingerprint_automaton.h"
+
+class Filter;
+class MatchRequest;
+
+// Finds the filters of a list without fingerprints which can match a URL in
+// a single pass over it, instead of trying each of them.  Every filter is
+// keyed by the longest run of its data without '*' or '^', which any URL it
+// matches contains, and a FingerprintAutomaton over the keys finds all of
+// them at once.  Left and right anchored filters are found by the start and
+// the end of the URL in an AnchoredFilterIndex instead.  Filters without a
+// key, like regular expressions, are always candidates.  The candidates
+// still have to be matched, but only those are, in list order.
+class NoFingerprintMatcher {
+ public:
+  // Longer lists are checked one filter at a time so that the candidates
+  // of a request fit in a bitmap on the stack.
+  static const int kMaxFilters = 4096;
+  static const int kMaxWords = kMaxFilters / 64;
+
+  NoFingerprintMatcher();
+  ~NoFingerprintMatcher();
+
+  void clear();
+  // Rebuilds the matcher for the passed in filters, or leaves it empty when
+  // there are more than kMaxFilters.  The anchored filter index is loaded
+  // from |anchoredIndexBuffer| instead of built when it holds one serialized
+  // for the same filters.
+  void build(const Filter *filters, int numFilters,
+      const char *anchoredIndexBuffer = nullptr,
+      uint32_t anchoredIndexSize = 0);
+  bool isBuilt() const {
+    return alwaysCandidates != nullptr;
+  }
+  int getNumKeys() const {
+    return numKeys;
+  }
+  const AnchoredFilterIndex & getAnchoredFilterIndex() const {
+    return anchoredFilterIndex;
+  }
+
+  // Fills |candidates| with a bit for each filter which can match
+  // |request|.  Returns false and leaves it alone if the matcher wasn't
+  // built for |numFilters| filters.
+  bool findCandidates(const MatchRequest &request, int numFilters,
+      uint64_t *candidates) const;
+
+ private:
+  NoFingerprintMatcher(const NoFingerprintMatcher &);
+  void operator=(const NoFingerprintMatcher &);
+
+  FingerprintAutomaton automaton;
+  AnchoredFilterIndex anchoredFilterIndex;
+  int numFilters;
+  int numKeys;
+  // The filters without a key
+  uint64_t *alwaysCandidates;
+};
+
+#endif  // NO_FINGERPRINT_MATCHER_H_
@@ -0,0 +1,48 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "./page_context.h"
+
+PageContext::FilterIds::FilterIds() :
+    ids(nullptr),
+    numIds(0) {
+}
+
+PageContext::FilterIds::~FilterIds() {
+  clear();
+}
+
+void PageContext::FilterIds::clear() {
+  if (ids) {
+    delete[] ids;
+    ids = nullptr;
+  }
+  numIds = 0;
+}
+
+PageContext::PageContext() :
+    contextDomain(nullptr),
+    contextDomainLen(0),
+    documentException(false),
+    generation(0) {
+}
+
+PageContext::~PageContext() {
+  clear();
+}
+
+void PageContext::clear() {
+  if (contextDomain) {
+    delete[] contextDomain;
+    contextDomain = nullptr;
+  }
+  contextDomainLen = 0;
+  domainOnlyFilters.clear();
+  antiDomainOnlyFilters.clear();
+  domainOnlyExceptionFilters.clear();
+  antiDomainOnlyExceptionFilters.clear();
+  documentException = false;
+  generation = 0;
+}
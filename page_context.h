@@ -0,0 +1,67 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef PAGE_CONTEXT_H_
+#define PAGE_CONTEXT_H_
+
+#include <stdint.h>
+#include "./base.h"
+
+// Everything about a page which doesn't depend on the URL being checked.
+// It is built once per document by AdBlockClient::initPageContext and then
+// passed to matches() for each of the page's subrequests, so the context
+// domain lookups of the domain specific filter lists and the page level
+// exception check are done once per page instead of once per subrequest.
+// A page context refers to the filters of the client which built it, so it
+// has to be built again after parse(), deserialize(), reorderFilters() or
+// clear().  Until then matches() ignores it and checks the subrequests as
+// if only its context domain had been given.
+class PageContext {
+ public:
+  PageContext();
+  ~PageContext();
+
+  void clear();
+  const char * getContextDomain() const {
+    return contextDomain;
+  }
+  int getContextDomainLen() const {
+    return contextDomainLen;
+  }
+  // True if a $document exception filter allows the page itself, in which
+  // case nothing on it is blocked.
+  bool isDocumentException() const {
+    return documentException;
+  }
+
+ private:
+  PageContext(const PageContext &);
+  void operator=(const PageContext &);
+  friend class AdBlockClient;
+
+  // The ids of the filters in a domain specific list whose domain options
+  // accept the page's domain, found with the list's context domain
+  // postings.
+  struct FilterIds {
+    FilterIds();
+    ~FilterIds();
+    void clear();
+
+    int *ids;
+    int numIds;
+  };
+
+  char *contextDomain;
+  int contextDomainLen;
+  FilterIds domainOnlyFilters;
+  FilterIds antiDomainOnlyFilters;
+  FilterIds domainOnlyExceptionFilters;
+  FilterIds antiDomainOnlyExceptionFilters;
+  bool documentException;
+  // The filter generation of the client when the context was built
+  uint32_t generation;
+};
+
+#endif  // PAGE_CONTEXT_H_
@@ -14,6 +14,8 @@
 #include <iterator>
 #include "./ad_block_client.h"
 #include "./bad_fingerprint.h"
+#include "./match_cache.h"
+#include "./page_context.h"
 
 using std::string;
 using std::cout;
@@ -64,6 +66,103 @@ void doSiteList(AdBlockClient *pClient, bool outputPerf) {
     cout << "Bloom filter saves: " << client.numBloomFilterSaves
       << ", exception bloom filter saves: "
       << client.numExceptionBloomFilterSaves << endl;
+
+    // Same URLs checked in batches, about the number of subresources a
+    // page loads.
+    const size_t kBatchSize = 64;
+    std::vector<const char *> urls;
+    for (const std::string &site : sites) {
+      urls.push_back(site.c_str());
+    }
+    bool out[kBatchSize];
+    int numBatchBlocks = 0;
+    const clock_t batchBeginTime = clock();
+    for (size_t i = 0; i < urls.size(); i += kBatchSize) {
+      size_t n = std::min(kBatchSize, urls.size() - i);
+      client.matchesBatch(&urls[i], nullptr, nullptr, currentPageDomain,
+          out, n);
+      numBatchBlocks += std::count(out, out + n, true);
+    }
+    cout << "Batch time: " << float(clock() - batchBeginTime)
+      / CLOCKS_PER_SEC << "s" << endl;
+    cout << "num batch blocks: " << numBatchBlocks << endl;
+
+    // Same URLs checked with a page context built once
+    PageContext pageContext;
+    client.initPageContext("https://brianbondy.com/", currentPageDomain,
+        &pageContext);
+    int numPageContextBlocks = 0;
+    const clock_t pageContextBeginTime = clock();
+    for (const std::string &site : sites) {
+      numPageContextBlocks += client.matches(site.c_str(), FONoFilterOption,
+          pageContext);
+    }
+    cout << "Page context time: " << float(clock() - pageContextBeginTime)
+      / CLOCKS_PER_SEC << "s" << endl;
+    cout << "num page context blocks: " << numPageContextBlocks << endl;
+
+    // Same URLs checked twice with the match cache, the second pass only
+    // has repeats.
+    client.enableMatchCache(sites.size());
+    int numCachedBlocks = 0;
+    const clock_t cachedBeginTime = clock();
+    for (int pass = 0; pass < 2; pass++) {
+      for (const std::string &site : sites) {
+        numCachedBlocks += client.matches(site.c_str(), FONoFilterOption,
+            currentPageDomain);
+      }
+    }
+    cout << "Cached time (2 passes): " << float(clock() - cachedBeginTime)
+      / CLOCKS_PER_SEC << "s" << endl;
+    cout << "num cached blocks: " << numCachedBlocks / 2
+      << ", cache hits: " << client.getMatchCache()->getNumHits()
+      << ", misses: " << client.getMatchCache()->getNumMisses() << endl;
+    client.disableMatchCache();
+
+    // Same URLs checked with host decisions, URLs of hosts which only host
+    // only filters could apply to are answered by their host.
+    client.enableHostDecisionCache(sites.size());
+    int numHostDecisionBlocks = 0;
+    const clock_t hostDecisionBeginTime = clock();
+    for (const std::string &site : sites) {
+      numHostDecisionBlocks += client.matches(site.c_str(), FONoFilterOption,
+          currentPageDomain);
+    }
+    cout << "Host decision time: " << float(clock() - hostDecisionBeginTime)
+      / CLOCKS_PER_SEC << "s" << endl;
+    cout << "num host decision blocks: " << numHostDecisionBlocks
+      << ", host decision saves: " << client.numHostDecisionSaves << endl;
+    client.disableHostDecisionCache();
+
+    // Same URLs checked while also finding the filters which match
+    int numFoundBlocks = 0;
+    const clock_t findBeginTime = clock();
+    for (const std::string &site : sites) {
+      Filter *matchingFilter, *matchingExceptionFilter;
+      numFoundBlocks += client.findMatchingFilters(site.c_str(),
+          FONoFilterOption, currentPageDomain, &matchingFilter,
+          &matchingExceptionFilter);
+    }
+    cout << "Find matching filters time: "
+      << float(clock() - findBeginTime) / CLOCKS_PER_SEC << "s" << endl;
+    cout << "num found blocks: " << numFoundBlocks << endl;
+
+    // Same URLs checked again after moving the filters which matched them
+    // to the front of their lists.
+    client.startFilterHitCounting();
+    for (const std::string &site : sites) {
+      client.matches(site.c_str(), FONoFilterOption, currentPageDomain);
+    }
+    client.reorderFilters();
+    int numReorderedBlocks = 0;
+    const clock_t reorderedBeginTime = clock();
+    for (const std::string &site : sites) {
+      numReorderedBlocks += client.matches(site.c_str(), FONoFilterOption,
+          currentPageDomain);
+    }
+    cout << "Reordered time: " << float(clock() - reorderedBeginTime)
+      / CLOCKS_PER_SEC << "s" << endl;
+    cout << "num reordered blocks: " << numReorderedBlocks << endl;
   }
 }
 
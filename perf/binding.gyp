@@ -16,8 +16,38 @@
       "../filter.h",
       "../filter_list.cc",
       "../filter_list.h",
-      "../no_fingerprint_domain.cc",
-      "../no_fingerprint_domain.h",
+      "../filter_option_index.cc",
+      "../filter_option_index.h",
+      "../index_of_filter.cc",
+      "../index_of_filter.h",
+      "../match_cache.cc",
+      "../match_cache.h",
+      "../match_request.cc",
+      "../match_request.h",
+      "../page_context.cc",
+      "../page_context.h",
+      "../host_suffix_trie.cc",
+      "../host_suffix_trie.h",
+      "../filter_hit_counts.cc",
+      "../filter_hit_counts.h",
+      "../public_suffix_list.cc",
+      "../public_suffix_list.h",
+      "../public_suffix_list_data.h",
+      "../url_lexer.cc",
+      "../url_lexer.h",
+      "../bigram_signature.h",
+      "../fingerprint_automaton.cc",
+      "../fingerprint_automaton.h",
+      "../no_fingerprint_matcher.cc",
+      "../no_fingerprint_matcher.h",
+      "../regex_literals.cc",
+      "../regex_literals.h",
+      "../serialization.cc",
+      "../serialization.h",
+      "../anchored_filter_index.cc",
+      "../anchored_filter_index.h",
+      "../fingerprint_postings.cc",
+      "../fingerprint_postings.h",
       "../node_modules/bloom-filter-cpp/BloomFilter.cpp",
       "../node_modules/bloom-filter-cpp/BloomFilter.h",
       "../node_modules/bloom-filter-cpp/hashFn.cpp",
@@ -49,5 +79,483 @@
     "cflags": [
       "-std=c++11"
     ]
+  }, {
+    "target_name": "perf-threads",
+    "type": "executable",
+    "sources": [
+      "../perf_threads.cc",
+      "../protocol.cc",
+      "../protocol.h",
+      "../ad_block_client.cc",
+      "../ad_block_client.h",
+      "../context_domain.cc",
+      "../context_domain.h",
+      "../cosmetic_filter.cc",
+      "../cosmetic_filter.h",
+      "../filter.cc",
+      "../filter.h",
+      "../filter_list.cc",
+      "../filter_list.h",
+      "../filter_option_index.cc",
+      "../filter_option_index.h",
+      "../index_of_filter.cc",
+      "../index_of_filter.h",
+      "../match_cache.cc",
+      "../match_cache.h",
+      "../match_request.cc",
+      "../match_request.h",
+      "../page_context.cc",
+      "../page_context.h",
+      "../host_suffix_trie.cc",
+      "../host_suffix_trie.h",
+      "../filter_hit_counts.cc",
+      "../filter_hit_counts.h",
+      "../public_suffix_list.cc",
+      "../public_suffix_list.h",
+      "../public_suffix_list_data.h",
+      "../url_lexer.cc",
+      "../url_lexer.h",
+      "../bigram_signature.h",
+      "../fingerprint_automaton.cc",
+      "../fingerprint_automaton.h",
+      "../no_fingerprint_matcher.cc",
+      "../no_fingerprint_matcher.h",
+      "../regex_literals.cc",
+      "../regex_literals.h",
+      "../serialization.cc",
+      "../serialization.h",
+      "../anchored_filter_index.cc",
+      "../anchored_filter_index.h",
+      "../fingerprint_postings.cc",
+      "../fingerprint_postings.h",
+      "../node_modules/bloom-filter-cpp/BloomFilter.cpp",
+      "../node_modules/bloom-filter-cpp/BloomFilter.h",
+      "../node_modules/bloom-filter-cpp/hashFn.cpp",
+      "../node_modules/bloom-filter-cpp/hashFn.h",
+      "../node_modules/hashset-cpp/hash_set.cc",
+      "../node_modules/hashset-cpp/hash_set.h"
+    ],
+    "include_dirs": [
+      "..",
+      '../node_modules/bloom-filter-cpp',
+      '../node_modules/hashset-cpp'
+    ],
+    "conditions": [
+      ['OS=="win"', {
+        }, {
+          'cflags_cc': [ '-fexceptions' ]
+        }
+      ]
+    ],
+    "xcode_settings": {
+      "OTHER_CFLAGS": [ "-ObjC" ],
+      "OTHER_CPLUSPLUSFLAGS" : ["-std=c++11","-stdlib=libc++", "-v"],
+      "OTHER_LDFLAGS": ["-stdlib=libc++"],
+      "MACOSX_DEPLOYMENT_TARGET": "10.9",
+      "GCC_ENABLE_CPP_EXCEPTIONS": "YES",
+      "ARCHS": ["x86_64"],
+    },
+    "cflags": [
+      "-std=c++11",
+      "-pthread"
+    ],
+    "ldflags": [
+      "-pthread"
+    ]
+  }, {
+    "target_name": "perf-index-of-filter",
+    "type": "executable",
+    "sources": [
+      "../perf_index_of_filter.cc",
+      "../protocol.cc",
+      "../protocol.h",
+      "../ad_block_client.cc",
+      "../ad_block_client.h",
+      "../context_domain.cc",
+      "../context_domain.h",
+      "../cosmetic_filter.cc",
+      "../cosmetic_filter.h",
+      "../filter.cc",
+      "../filter.h",
+      "../filter_list.cc",
+      "../filter_list.h",
+      "../filter_option_index.cc",
+      "../filter_option_index.h",
+      "../index_of_filter.cc",
+      "../index_of_filter.h",
+      "../match_cache.cc",
+      "../match_cache.h",
+      "../match_request.cc",
+      "../match_request.h",
+      "../page_context.cc",
+      "../page_context.h",
+      "../host_suffix_trie.cc",
+      "../host_suffix_trie.h",
+      "../filter_hit_counts.cc",
+      "../filter_hit_counts.h",
+      "../public_suffix_list.cc",
+      "../public_suffix_list.h",
+      "../public_suffix_list_data.h",
+      "../url_lexer.cc",
+      "../url_lexer.h",
+      "../bigram_signature.h",
+      "../fingerprint_automaton.cc",
+      "../fingerprint_automaton.h",
+      "../no_fingerprint_matcher.cc",
+      "../no_fingerprint_matcher.h",
+      "../regex_literals.cc",
+      "../regex_literals.h",
+      "../serialization.cc",
+      "../serialization.h",
+      "../anchored_filter_index.cc",
+      "../anchored_filter_index.h",
+      "../fingerprint_postings.cc",
+      "../fingerprint_postings.h",
+      "../node_modules/bloom-filter-cpp/BloomFilter.cpp",
+      "../node_modules/bloom-filter-cpp/BloomFilter.h",
+      "../node_modules/bloom-filter-cpp/hashFn.cpp",
+      "../node_modules/bloom-filter-cpp/hashFn.h",
+      "../node_modules/hashset-cpp/hash_set.cc",
+      "../node_modules/hashset-cpp/hash_set.h"
+    ],
+    "include_dirs": [
+      "..",
+      '../node_modules/bloom-filter-cpp',
+      '../node_modules/hashset-cpp'
+    ],
+    "conditions": [
+      ['OS=="win"', {
+        }, {
+          'cflags_cc': [ '-fexceptions' ]
+        }
+      ]
+    ],
+    "xcode_settings": {
+      "OTHER_CFLAGS": [ "-ObjC" ],
+      "OTHER_CPLUSPLUSFLAGS" : ["-std=c++11","-stdlib=libc++", "-v"],
+      "OTHER_LDFLAGS": ["-stdlib=libc++"],
+      "MACOSX_DEPLOYMENT_TARGET": "10.9",
+      "GCC_ENABLE_CPP_EXCEPTIONS": "YES",
+      "ARCHS": ["x86_64"],
+    },
+    "cflags": [
+      "-std=c++11"
+    ]
+  }, {
+    "target_name": "perf-public-suffix-list",
+    "type": "executable",
+    "sources": [
+      "../perf_public_suffix_list.cc",
+      "../protocol.cc",
+      "../protocol.h",
+      "../ad_block_client.cc",
+      "../ad_block_client.h",
+      "../context_domain.cc",
+      "../context_domain.h",
+      "../cosmetic_filter.cc",
+      "../cosmetic_filter.h",
+      "../filter.cc",
+      "../filter.h",
+      "../filter_list.cc",
+      "../filter_list.h",
+      "../filter_option_index.cc",
+      "../filter_option_index.h",
+      "../index_of_filter.cc",
+      "../index_of_filter.h",
+      "../match_cache.cc",
+      "../match_cache.h",
+      "../match_request.cc",
+      "../match_request.h",
+      "../page_context.cc",
+      "../page_context.h",
+      "../host_suffix_trie.cc",
+      "../host_suffix_trie.h",
+      "../filter_hit_counts.cc",
+      "../filter_hit_counts.h",
+      "../public_suffix_list.cc",
+      "../public_suffix_list.h",
+      "../public_suffix_list_data.h",
+      "../url_lexer.cc",
+      "../url_lexer.h",
+      "../bigram_signature.h",
+      "../fingerprint_automaton.cc",
+      "../fingerprint_automaton.h",
+      "../no_fingerprint_matcher.cc",
+      "../no_fingerprint_matcher.h",
+      "../regex_literals.cc",
+      "../regex_literals.h",
+      "../serialization.cc",
+      "../serialization.h",
+      "../anchored_filter_index.cc",
+      "../anchored_filter_index.h",
+      "../fingerprint_postings.cc",
+      "../fingerprint_postings.h",
+      "../node_modules/bloom-filter-cpp/BloomFilter.cpp",
+      "../node_modules/bloom-filter-cpp/BloomFilter.h",
+      "../node_modules/bloom-filter-cpp/hashFn.cpp",
+      "../node_modules/bloom-filter-cpp/hashFn.h",
+      "../node_modules/hashset-cpp/hash_set.cc",
+      "../node_modules/hashset-cpp/hash_set.h"
+    ],
+    "include_dirs": [
+      "..",
+      '../node_modules/bloom-filter-cpp',
+      '../node_modules/hashset-cpp'
+    ],
+    "conditions": [
+      ['OS=="win"', {
+        }, {
+          'cflags_cc': [ '-fexceptions' ]
+        }
+      ]
+    ],
+    "xcode_settings": {
+      "OTHER_CFLAGS": [ "-ObjC" ],
+      "OTHER_CPLUSPLUSFLAGS" : ["-std=c++11","-stdlib=libc++", "-v"],
+      "OTHER_LDFLAGS": ["-stdlib=libc++"],
+      "MACOSX_DEPLOYMENT_TARGET": "10.9",
+      "GCC_ENABLE_CPP_EXCEPTIONS": "YES",
+      "ARCHS": ["x86_64"],
+    },
+    "cflags": [
+      "-std=c++11"
+    ]
+  }, {
+    "target_name": "perf-url-lexer",
+    "type": "executable",
+    "sources": [
+      "../perf_url_lexer.cc",
+      "../protocol.cc",
+      "../protocol.h",
+      "../ad_block_client.cc",
+      "../ad_block_client.h",
+      "../context_domain.cc",
+      "../context_domain.h",
+      "../cosmetic_filter.cc",
+      "../cosmetic_filter.h",
+      "../filter.cc",
+      "../filter.h",
+      "../filter_list.cc",
+      "../filter_list.h",
+      "../filter_option_index.cc",
+      "../filter_option_index.h",
+      "../index_of_filter.cc",
+      "../index_of_filter.h",
+      "../match_cache.cc",
+      "../match_cache.h",
+      "../match_request.cc",
+      "../match_request.h",
+      "../page_context.cc",
+      "../page_context.h",
+      "../host_suffix_trie.cc",
+      "../host_suffix_trie.h",
+      "../filter_hit_counts.cc",
+      "../filter_hit_counts.h",
+      "../public_suffix_list.cc",
+      "../public_suffix_list.h",
+      "../public_suffix_list_data.h",
+      "../url_lexer.cc",
+      "../url_lexer.h",
+      "../bigram_signature.h",
+      "../fingerprint_automaton.cc",
+      "../fingerprint_automaton.h",
+      "../no_fingerprint_matcher.cc",
+      "../no_fingerprint_matcher.h",
+      "../regex_literals.cc",
+      "../regex_literals.h",
+      "../serialization.cc",
+      "../serialization.h",
+      "../anchored_filter_index.cc",
+      "../anchored_filter_index.h",
+      "../fingerprint_postings.cc",
+      "../fingerprint_postings.h",
+      "../node_modules/bloom-filter-cpp/BloomFilter.cpp",
+      "../node_modules/bloom-filter-cpp/BloomFilter.h",
+      "../node_modules/bloom-filter-cpp/hashFn.cpp",
+      "../node_modules/bloom-filter-cpp/hashFn.h",
+      "../node_modules/hashset-cpp/hash_set.cc",
+      "../node_modules/hashset-cpp/hash_set.h"
+    ],
+    "include_dirs": [
+      "..",
+      '../node_modules/bloom-filter-cpp',
+      '../node_modules/hashset-cpp'
+    ],
+    "conditions": [
+      ['OS=="win"', {
+        }, {
+          'cflags_cc': [ '-fexceptions' ]
+        }
+      ]
+    ],
+    "xcode_settings": {
+      "OTHER_CFLAGS": [ "-ObjC" ],
+      "OTHER_CPLUSPLUSFLAGS" : ["-std=c++11","-stdlib=libc++", "-v"],
+      "OTHER_LDFLAGS": ["-stdlib=libc++"],
+      "MACOSX_DEPLOYMENT_TARGET": "10.9",
+      "GCC_ENABLE_CPP_EXCEPTIONS": "YES",
+      "ARCHS": ["x86_64"],
+    },
+    "cflags": [
+      "-std=c++11"
+    ]
+  }, {
+    "target_name": "perf-matches-batch",
+    "type": "executable",
+    "sources": [
+      "../perf_matches_batch.cc",
+      "../protocol.cc",
+      "../protocol.h",
+      "../ad_block_client.cc",
+      "../ad_block_client.h",
+      "../context_domain.cc",
+      "../context_domain.h",
+      "../cosmetic_filter.cc",
+      "../cosmetic_filter.h",
+      "../filter.cc",
+      "../filter.h",
+      "../filter_list.cc",
+      "../filter_list.h",
+      "../filter_option_index.cc",
+      "../filter_option_index.h",
+      "../index_of_filter.cc",
+      "../index_of_filter.h",
+      "../match_cache.cc",
+      "../match_cache.h",
+      "../match_request.cc",
+      "../match_request.h",
+      "../page_context.cc",
+      "../page_context.h",
+      "../host_suffix_trie.cc",
+      "../host_suffix_trie.h",
+      "../filter_hit_counts.cc",
+      "../filter_hit_counts.h",
+      "../public_suffix_list.cc",
+      "../public_suffix_list.h",
+      "../public_suffix_list_data.h",
+      "../url_lexer.cc",
+      "../url_lexer.h",
+      "../bigram_signature.h",
+      "../fingerprint_automaton.cc",
+      "../fingerprint_automaton.h",
+      "../no_fingerprint_matcher.cc",
+      "../no_fingerprint_matcher.h",
+      "../regex_literals.cc",
+      "../regex_literals.h",
+      "../serialization.cc",
+      "../serialization.h",
+      "../anchored_filter_index.cc",
+      "../anchored_filter_index.h",
+      "../fingerprint_postings.cc",
+      "../fingerprint_postings.h",
+      "../node_modules/bloom-filter-cpp/BloomFilter.cpp",
+      "../node_modules/bloom-filter-cpp/BloomFilter.h",
+      "../node_modules/bloom-filter-cpp/hashFn.cpp",
+      "../node_modules/bloom-filter-cpp/hashFn.h",
+      "../node_modules/hashset-cpp/hash_set.cc",
+      "../node_modules/hashset-cpp/hash_set.h"
+    ],
+    "include_dirs": [
+      "..",
+      '../node_modules/bloom-filter-cpp',
+      '../node_modules/hashset-cpp'
+    ],
+    "conditions": [
+      ['OS=="win"', {
+        }, {
+          'cflags_cc': [ '-fexceptions' ]
+        }
+      ]
+    ],
+    "xcode_settings": {
+      "OTHER_CFLAGS": [ "-ObjC" ],
+      "OTHER_CPLUSPLUSFLAGS" : ["-std=c++11","-stdlib=libc++", "-v"],
+      "OTHER_LDFLAGS": ["-stdlib=libc++"],
+      "MACOSX_DEPLOYMENT_TARGET": "10.9",
+      "GCC_ENABLE_CPP_EXCEPTIONS": "YES",
+      "ARCHS": ["x86_64"],
+    },
+    "cflags": [
+      "-std=c++11"
+    ]
+  }, {
+    "target_name": "perf-fingerprint-automaton",
+    "type": "executable",
+    "sources": [
+      "../perf_fingerprint_automaton.cc",
+      "../protocol.cc",
+      "../protocol.h",
+      "../ad_block_client.cc",
+      "../ad_block_client.h",
+      "../context_domain.cc",
+      "../context_domain.h",
+      "../cosmetic_filter.cc",
+      "../cosmetic_filter.h",
+      "../filter.cc",
+      "../filter.h",
+      "../filter_list.cc",
+      "../filter_list.h",
+      "../filter_option_index.cc",
+      "../filter_option_index.h",
+      "../index_of_filter.cc",
+      "../index_of_filter.h",
+      "../match_cache.cc",
+      "../match_cache.h",
+      "../match_request.cc",
+      "../match_request.h",
+      "../page_context.cc",
+      "../page_context.h",
+      "../host_suffix_trie.cc",
+      "../host_suffix_trie.h",
+      "../filter_hit_counts.cc",
+      "../filter_hit_counts.h",
+      "../public_suffix_list.cc",
+      "../public_suffix_list.h",
+      "../public_suffix_list_data.h",
+      "../url_lexer.cc",
+      "../url_lexer.h",
+      "../bigram_signature.h",
+      "../fingerprint_automaton.cc",
+      "../fingerprint_automaton.h",
+      "../no_fingerprint_matcher.cc",
+      "../no_fingerprint_matcher.h",
+      "../regex_literals.cc",
+      "../regex_literals.h",
+      "../serialization.cc",
+      "../serialization.h",
+      "../anchored_filter_index.cc",
+      "../anchored_filter_index.h",
+      "../fingerprint_postings.cc",
+      "../fingerprint_postings.h",
+      "../node_modules/bloom-filter-cpp/BloomFilter.cpp",
+      "../node_modules/bloom-filter-cpp/BloomFilter.h",
+      "../node_modules/bloom-filter-cpp/hashFn.cpp",
+      "../node_modules/bloom-filter-cpp/hashFn.h",
+      "../node_modules/hashset-cpp/hash_set.cc",
+      "../node_modules/hashset-cpp/hash_set.h"
+    ],
+    "include_dirs": [
+      "..",
+      '../node_modules/bloom-filter-cpp',
+      '../node_modules/hashset-cpp'
+    ],
+    "conditions": [
+      ['OS=="win"', {
+        }, {
+          'cflags_cc': [ '-fexceptions' ]
+        }
+      ]
+    ],
+    "xcode_settings": {
+      "OTHER_CFLAGS": [ "-ObjC" ],
+      "OTHER_CPLUSPLUSFLAGS" : ["-std=c++11","-stdlib=libc++", "-v"],
+      "OTHER_LDFLAGS": ["-stdlib=libc++"],
+      "MACOSX_DEPLOYMENT_TARGET": "10.9",
+      "GCC_ENABLE_CPP_EXCEPTIONS": "YES",
+      "ARCHS": ["x86_64"],
+    },
+    "cflags": [
+      "-std=c++11"
+    ]
   }]
 }
@@ -0,0 +1,159 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+// Measures the fingerprint automaton against the bloom filter and the
+// fingerprint postings as the pre-check of the fingerprint filters, and
+// matching the site list URLs with and without it.
+
+#include <cerrno>
+#include <chrono>  // NOLINT
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "./ad_block_client.h"
+#include "./fingerprint_automaton.h"
+#include "./fingerprint_postings.h"
+#include "BloomFilter.h"
+#include "hash_set.h"
+
+using std::string;
+using std::cout;
+using std::endl;
+
+string getFileContents(const char *filename) {
+  std::ifstream in(filename, std::ios::in);
+  if (in) {
+    std::ostringstream contents;
+    contents << in.rdbuf();
+    in.close();
+    return(contents.str());
+  }
+  throw(errno);
+}
+
+// Returns the time taken and counts the URLs |check| finds a fingerprint
+// in with |numHits|.
+template<typename CheckFn>
+double timeChecks(CheckFn check, const std::vector<string> &urls,
+    int passes, int *numHits) {
+  *numHits = 0;
+  const auto beginTime = std::chrono::steady_clock::now();
+  for (int pass = 0; pass < passes; pass++) {
+    for (const string &url : urls) {
+      *numHits += check(url.c_str(), static_cast<int>(url.length()));
+    }
+  }
+  *numHits /= passes;
+  return std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - beginTime).count();
+}
+
+// Returns the time taken to match every URL and counts the blocks
+double timeMatching(AdBlockClient *client, const std::vector<string> &urls,
+    int passes, int *numBlocks) {
+  *numBlocks = 0;
+  const auto beginTime = std::chrono::steady_clock::now();
+  for (int pass = 0; pass < passes; pass++) {
+    for (const string &url : urls) {
+      *numBlocks += client->matches(url.c_str(), FONoFilterOption,
+          "brianbondy.com");
+    }
+  }
+  *numBlocks /= passes;
+  return std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - beginTime).count();
+}
+
+int main(int argc, char**argv) {
+  std::string && easyListTxt =
+    getFileContents("./test/data/easylist.txt");
+  std::string && easyPrivacyTxt =
+    getFileContents("./test/data/easyprivacy.txt");
+  std::string && siteList = getFileContents("./test/data/sitelist.txt");
+  std::stringstream ss(siteList);
+  std::istream_iterator<string> begin(ss);
+  std::istream_iterator<string> end;
+  std::vector<string> urls(begin, end);
+
+  AdBlockClient client;
+  client.setFilterOrderFrozen(true);
+  client.parse(easyListTxt.c_str());
+  client.parse(easyPrivacyTxt.c_str());
+
+  const auto buildBeginTime = std::chrono::steady_clock::now();
+  client.setFingerprintAutomatonEnabled(true);
+  const double buildTime = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - buildBeginTime).count();
+  const FingerprintAutomaton &automaton = client.fingerprintAutomaton;
+  if (!automaton.isBuilt() || !client.bloomFilter ||
+      !client.fingerprintPostings) {
+    cout << "The filters have no fingerprint pre-check" << endl;
+    return 1;
+  }
+  cout << "Automaton states: " << automaton.getNumStates()
+    << ", build time: " << buildTime << "s" << endl;
+
+  const int kNumPasses = 20;
+  const int kFingerprintSize = AdBlockClient::kFingerprintSize;
+  cout << "Checking " << urls.size() << " URLs " << kNumPasses << " times"
+    << endl;
+  int bloomHits, postingsHits, automatonHits;
+  BloomFilter *bloomFilter = client.bloomFilter;
+  const double bloomTime = timeChecks(
+      [bloomFilter, kFingerprintSize](const char *url, int urlLen) {
+      return bloomFilter->substringExists(url, urlLen, kFingerprintSize);
+    }, urls, kNumPasses, &bloomHits);
+  HashSet<FingerprintPostings> *postings = client.fingerprintPostings;
+  const double postingsTime = timeChecks(
+      [postings, kFingerprintSize](const char *url, int urlLen) {
+      for (int i = 0; i + kFingerprintSize <= urlLen; i++) {
+        if (postings->Find(FingerprintPostings(url + i, kFingerprintSize))) {
+          return true;
+        }
+      }
+      return false;
+    }, urls, kNumPasses, &postingsHits);
+  const double automatonTime = timeChecks(
+      [&automaton](const char *url, int urlLen) {
+      int state = FingerprintAutomaton::kRootState;
+      for (int i = 0; i < urlLen; i++) {
+        state = automaton.next(state, url[i]);
+        int numIds;
+        if (automaton.filterIds(state, &numIds)) {
+          return true;
+        }
+      }
+      return false;
+    }, urls, kNumPasses, &automatonHits);
+
+  // The bloom filter has no false negatives, every URL it flags which
+  // has no fingerprint is a false positive.
+  cout << "Bloom filter time: " << bloomTime << "s, URLs flagged: "
+    << bloomHits << ", false positives: " << bloomHits - automatonHits
+    << endl;
+  cout << "Postings time: " << postingsTime << "s, URLs flagged: "
+    << postingsHits << endl;
+  cout << "Automaton time: " << automatonTime << "s, URLs flagged: "
+    << automatonHits << endl;
+
+  int numBlocks, numAutomatonBlocks;
+  client.setFingerprintAutomatonEnabled(false);
+  const double matchTime = timeMatching(&client, urls, kNumPasses,
+      &numBlocks);
+  client.setFingerprintAutomatonEnabled(true);
+  const double automatonMatchTime = timeMatching(&client, urls, kNumPasses,
+      &numAutomatonBlocks);
+  cout << "Matching time without the automaton: " << matchTime
+    << "s, with it: " << automatonMatchTime << "s, num blocks: "
+    << numAutomatonBlocks << endl;
+  if (postingsHits != automatonHits || numBlocks != numAutomatonBlocks) {
+    cout << "Results differ from the fingerprint postings" << endl;
+    return 1;
+  }
+  return 0;
+}
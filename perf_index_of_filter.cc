@@ -0,0 +1,104 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+// Measures indexOfFilter against the scalar reference version by searching
+// the wildcard parts of the easylist filters in the site list URLs.
+
+#include <cerrno>
+#include <chrono>  // NOLINT
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "./ad_block_client.h"
+#include "./index_of_filter.h"
+
+using std::string;
+using std::cout;
+using std::endl;
+
+string getFileContents(const char *filename) {
+  std::ifstream in(filename, std::ios::in);
+  if (in) {
+    std::ostringstream contents;
+    contents << in.rdbuf();
+    in.close();
+    return(contents.str());
+  }
+  throw(errno);
+}
+
+typedef int (*IndexOfFilterFn)(const char *input, int inputLen,
+    const char *filterBegin, const char *filterEnd);
+
+// Returns the time taken and adds the sum of all results to |checksum| so
+// the calls can't be optimized away.
+double timeSearches(IndexOfFilterFn fn, const std::vector<string> &parts,
+    const std::vector<string> &urls, int64_t *checksum) {
+  const auto beginTime = std::chrono::steady_clock::now();
+  for (const string &url : urls) {
+    for (const string &part : parts) {
+      *checksum += fn(url.c_str(), static_cast<int>(url.length()),
+          part.c_str(), part.c_str() + part.length());
+    }
+  }
+  return std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - beginTime).count();
+}
+
+int main(int argc, char**argv) {
+  std::string && easyListTxt =
+    getFileContents("./test/data/easylist.txt");
+  std::string && siteList = getFileContents("./test/data/sitelist.txt");
+
+  // The parts of each filter between wildcards, which is what matching
+  // passes to indexOfFilter.
+  std::vector<string> parts;
+  std::stringstream lines(easyListTxt);
+  string line;
+  while (std::getline(lines, line)) {
+    Filter f;
+    parseFilter(line.c_str(), &f);
+    if (f.filterType & (FTElementHiding | FTElementHidingException |
+          FTHTMLFiltering | FTComment | FTEmpty | FTHostOnly | FTRegex) ||
+        !f.data || f.dataLen <= 0) {
+      continue;
+    }
+    std::stringstream filterParts(string(f.data, f.dataLen));
+    string part;
+    while (std::getline(filterParts, part, '*')) {
+      if (!part.empty()) {
+        parts.push_back(part);
+      }
+    }
+  }
+
+  std::stringstream ss(siteList);
+  std::istream_iterator<string> begin(ss);
+  std::istream_iterator<string> end;
+  std::vector<string> urls(begin, end);
+  const size_t kNumUrls = 1000;
+  if (urls.size() > kNumUrls) {
+    urls.resize(kNumUrls);
+  }
+
+  cout << "Searching " << parts.size() << " filter parts in "
+    << urls.size() << " URLs" << endl;
+  int64_t scalarChecksum = 0;
+  int64_t checksum = 0;
+  double scalarTime = timeSearches(indexOfFilterScalar, parts, urls,
+      &scalarChecksum);
+  double time = timeSearches(indexOfFilter, parts, urls, &checksum);
+  cout << "Scalar time: " << scalarTime << "s" << endl;
+  cout << "Time: " << time << "s" << endl;
+  cout << "Speedup: " << scalarTime / time << "x" << endl;
+  if (checksum != scalarChecksum) {
+    cout << "Results differ from the scalar version" << endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,125 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+// Measures matchesBatch against calling matches() for each URL, over the
+// site list URLs in their own order and grouped by host into pages, which
+// is closer to what a page loads.
+
+#include <cerrno>
+#include <algorithm>
+#include <chrono>  // NOLINT
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "./ad_block_client.h"
+#include "./match_request.h"
+
+using std::string;
+using std::cout;
+using std::endl;
+
+string getFileContents(const char *filename) {
+  std::ifstream in(filename, std::ios::in);
+  if (in) {
+    std::ostringstream contents;
+    contents << in.rdbuf();
+    in.close();
+    return(contents.str());
+  }
+  throw(errno);
+}
+
+static string getHost(const string &url) {
+  int hostLen;
+  const char *host = getUrlHost(url.c_str(), static_cast<int>(url.length()),
+      &hostLen);
+  return string(host, hostLen);
+}
+
+// Times checking |urls| in batches of |batchSize|, one matches() call per URL
+// or one matchesBatch() call per batch, and sets |out| to the results.
+static double timeMatching(AdBlockClient *client,
+    const std::vector<const char *> &urls, size_t batchSize, bool batch,
+    const char *contextDomain, int passes, std::vector<char> *out) {
+  bool *batchOut = new bool[batchSize];
+  out->assign(urls.size(), 0);
+  const auto beginTime = std::chrono::steady_clock::now();
+  for (int pass = 0; pass < passes; pass++) {
+    for (size_t i = 0; i < urls.size(); i += batchSize) {
+      const size_t n = std::min(batchSize, urls.size() - i);
+      if (batch) {
+        client->matchesBatch(const_cast<const char **>(&urls[i]), nullptr,
+            nullptr, contextDomain, batchOut, n);
+      } else {
+        for (size_t j = 0; j < n; j++) {
+          batchOut[j] = client->matches(urls[i + j], FONoFilterOption,
+              contextDomain);
+        }
+      }
+      std::copy(batchOut, batchOut + n, out->begin() + i);
+    }
+  }
+  delete[] batchOut;
+  return std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - beginTime).count();
+}
+
+// Returns false if the batch results differ from the per URL ones
+static bool compareBatches(AdBlockClient *client, const char *name,
+    const std::vector<const char *> &urls, size_t batchSize,
+    const char *contextDomain, int passes) {
+  std::vector<char> expected;
+  std::vector<char> found;
+  double time = timeMatching(client, urls, batchSize, false, contextDomain,
+      passes, &expected);
+  double batchTime = timeMatching(client, urls, batchSize, true,
+      contextDomain, passes, &found);
+  cout << name << ": matches() time: " << time << "s, matchesBatch() time: "
+    << batchTime << "s, speedup: " << time / batchTime << "x" << endl;
+  return found == expected;
+}
+
+int main(int argc, char**argv) {
+  std::string && easyListTxt =
+    getFileContents("./test/data/easylist.txt");
+  std::string && siteList = getFileContents("./test/data/sitelist.txt");
+  std::stringstream ss(siteList);
+  std::istream_iterator<string> begin(ss);
+  std::istream_iterator<string> end;
+  std::vector<string> sites(begin, end);
+
+  AdBlockClient client;
+  client.parse(easyListTxt.c_str());
+
+  // The site list order rarely repeats a host within a batch, grouping it by
+  // host gives batches with a few hosts and many URLs each like most pages.
+  std::vector<const char *> urls;
+  for (const string &site : sites) {
+    urls.push_back(site.c_str());
+  }
+  std::vector<const char *> pageUrls(urls);
+  std::stable_sort(pageUrls.begin(), pageUrls.end(),
+      [](const char *lhs, const char *rhs) {
+      return getHost(lhs) < getHost(rhs);
+    });
+
+  const size_t kBatchSize = 64;
+  const int kNumPasses = 5;
+  const char *contextDomain = "brianbondy.com";
+  cout << "Checking " << urls.size() << " URLs in batches of " << kBatchSize
+    << " " << kNumPasses << " times" << endl;
+  bool same = compareBatches(&client, "Site list order", urls, kBatchSize,
+      contextDomain, kNumPasses);
+  same = compareBatches(&client, "Grouped into pages", pageUrls, kBatchSize,
+      contextDomain, kNumPasses) && same;
+  if (!same) {
+    cout << "Batch results differ from matches()" << endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,70 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+// Measures the registrable domain lookups made for every request to decide
+// whether it is third party, using the hosts of the site list URLs.
+
+#include <cerrno>
+#include <chrono>  // NOLINT
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "./match_request.h"
+#include "./public_suffix_list.h"
+
+using std::string;
+using std::cout;
+using std::endl;
+
+string getFileContents(const char *filename) {
+  std::ifstream in(filename, std::ios::in);
+  if (in) {
+    std::ostringstream contents;
+    contents << in.rdbuf();
+    in.close();
+    return(contents.str());
+  }
+  throw(errno);
+}
+
+int main(int argc, char**argv) {
+  std::string && siteList = getFileContents("./test/data/sitelist.txt");
+  std::stringstream ss(siteList);
+  std::istream_iterator<string> begin(ss);
+  std::istream_iterator<string> end;
+  std::vector<string> hosts;
+  for (auto it = begin; it != end; ++it) {
+    int hostLen;
+    const char *host = getUrlHost(it->c_str(),
+        static_cast<int>(it->length()), &hostLen);
+    if (hostLen) {
+      hosts.push_back(string(host, hostLen));
+    }
+  }
+
+  const int kNumPasses = 20;
+  int64_t checksum = 0;
+  const auto beginTime = std::chrono::steady_clock::now();
+  for (int pass = 0; pass < kNumPasses; pass++) {
+    for (const string &host : hosts) {
+      int len;
+      getRegistrableDomain(host.c_str(), static_cast<int>(host.length()),
+          &len);
+      checksum += len;
+    }
+  }
+  const double time = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - beginTime).count();
+  const double numLookups = static_cast<double>(hosts.size()) * kNumPasses;
+  cout << "Looked up " << hosts.size() << " hosts " << kNumPasses
+    << " times" << endl;
+  cout << "Time: " << time << "s" << endl;
+  cout << "Per lookup: " << time * 1e9 / numLookups << "ns" << endl;
+  cout << "Checksum: " << checksum << endl;
+  return 0;
+}
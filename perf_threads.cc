@@ -0,0 +1,139 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+// Measures matching throughput of a single AdBlockClient shared by a growing
+// number of threads.  Each thread sweeps the whole site list, so with no
+// contention the total throughput should grow linearly with the thread count.
+
+#include <stdlib.h>
+#include <cerrno>
+#include <chrono>  // NOLINT
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <thread>  // NOLINT
+#include <vector>
+#include "./ad_block_client.h"
+
+using std::string;
+using std::cout;
+using std::endl;
+
+string getFileContents(const char *filename) {
+  std::ifstream in(filename, std::ios::in);
+  if (in) {
+    std::ostringstream contents;
+    contents << in.rdbuf();
+    in.close();
+    return(contents.str());
+  }
+  throw(errno);
+}
+
+// Sweeps the site list |numSweeps| times and returns the number of blocks
+// seen in the last sweep.
+int sweepSiteList(AdBlockClient *client, const std::vector<string> &sites,
+    const char *currentPageDomain, int numSweeps) {
+  int numBlocks = 0;
+  for (int i = 0; i < numSweeps; i++) {
+    numBlocks = 0;
+    for (const string &url : sites) {
+      if (client->matches(url.c_str(), FONoFilterOption, currentPageDomain)) {
+        ++numBlocks;
+      }
+    }
+  }
+  return numBlocks;
+}
+
+int main(int argc, char**argv) {
+  std::string && easyListTxt =
+    getFileContents("./test/data/easylist.txt");
+  std::string && easyPrivacyTxt =
+    getFileContents("./test/data/easyprivacy.txt");
+  std::string && braveUnblockTxt =
+    getFileContents("./test/data/brave-unbreak.txt");
+  std::string && ublockUnblockTxt =
+    getFileContents("./test/data/ublock-unbreak.txt");
+  std::string && siteList = getFileContents("./test/data/sitelist.txt");
+  std::stringstream ss(siteList);
+  std::istream_iterator<std::string> begin(ss);
+  std::istream_iterator<std::string> end;
+  std::vector<std::string> sites(begin, end);
+
+  int maxThreads = static_cast<int>(std::thread::hardware_concurrency());
+  if (argc > 1) {
+    maxThreads = atoi(argv[1]);
+  }
+  if (maxThreads < 1) {
+    maxThreads = 1;
+  }
+  const int numSweeps = argc > 2 ? atoi(argv[2]) : 3;
+
+  // This is the site who's URLs are being checked, not the domain of
+  // the URL being checked.
+  const char *currentPageDomain = "brianbondy.com";
+
+  // A single client shared by every thread
+  AdBlockClient client;
+  client.parse(easyListTxt.c_str());
+  client.parse(easyPrivacyTxt.c_str());
+  client.parse(ublockUnblockTxt.c_str());
+  client.parse(braveUnblockTxt.c_str());
+
+  const int expectedBlocks =
+    sweepSiteList(&client, sites, currentPageDomain, 1);
+  cout << "URLs per sweep: " << sites.size()
+    << ", blocks per sweep: " << expectedBlocks << endl;
+
+  // Powers of 2 up to, and always including, the max thread count
+  std::vector<int> threadCounts;
+  for (int numThreads = 1; numThreads < maxThreads; numThreads *= 2) {
+    threadCounts.push_back(numThreads);
+  }
+  threadCounts.push_back(maxThreads);
+
+  double singleThreadRate = 0;
+  for (int numThreads : threadCounts) {
+    std::vector<int> blocks(numThreads, 0);
+    std::vector<std::thread> threads;
+    auto beginTime = std::chrono::steady_clock::now();
+    for (int i = 0; i < numThreads; i++) {
+      threads.push_back(std::thread([&client, &sites, &blocks,
+          currentPageDomain, numSweeps, i]() {
+        blocks[i] =
+          sweepSiteList(&client, sites, currentPageDomain, numSweeps);
+      }));
+    }
+    for (std::thread &t : threads) {
+      t.join();
+    }
+    std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - beginTime;
+
+    for (int i = 0; i < numThreads; i++) {
+      if (blocks[i] != expectedBlocks) {
+        cout << "Thread " << i << " saw " << blocks[i]
+          << " blocks, expected " << expectedBlocks << endl;
+        return 1;
+      }
+    }
+
+    double rate = static_cast<double>(sites.size()) * numSweeps
+      * numThreads / elapsed.count();
+    if (numThreads == 1) {
+      singleThreadRate = rate;
+    }
+    cout << "Threads: " << numThreads
+      << ", time: " << elapsed.count() << "s"
+      << ", matches/s: " << static_cast<int64_t>(rate)
+      << ", speedup: " << rate / singleThreadRate
+      << ", efficiency: " << rate / singleThreadRate / numThreads << endl;
+  }
+
+  return 0;
+}
@@ -0,0 +1,93 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+// Measures lexUrl against checking the protocol, finding the host and
+// finding the separators one byte at a time, over the site list URLs.
+
+#include <cerrno>
+#include <chrono>  // NOLINT
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "./match_request.h"
+#include "./protocol.h"
+#include "./url_lexer.h"
+
+using std::string;
+using std::cout;
+using std::endl;
+
+string getFileContents(const char *filename) {
+  std::ifstream in(filename, std::ios::in);
+  if (in) {
+    std::ostringstream contents;
+    contents << in.rdbuf();
+    in.close();
+    return(contents.str());
+  }
+  throw(errno);
+}
+
+static void lexUrlScalar(const char *url, int urlLen,
+    SeparatorBitmap *separators, const char **host, int *hostLen,
+    bool *blockable) {
+  *blockable = isBlockableProtocol(url, urlLen);
+  *host = getUrlHost(url, urlLen, hostLen);
+  findSeparatorsScalar(url, urlLen, separators);
+}
+
+// Returns the time taken and adds up the results in |checksum| so the calls
+// can't be optimized away.
+template<typename LexFn>
+double timeLexing(LexFn lex, const std::vector<string> &urls, int passes,
+    int64_t *checksum) {
+  SeparatorBitmap separators;
+  const auto beginTime = std::chrono::steady_clock::now();
+  for (int pass = 0; pass < passes; pass++) {
+    for (const string &url : urls) {
+      const char *host;
+      int hostLen;
+      bool blockable;
+      lex(url.c_str(), static_cast<int>(url.length()), &separators, &host,
+          &hostLen, &blockable);
+      *checksum += hostLen + blockable +
+        separators.findNext(0, separators.len);
+    }
+  }
+  return std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - beginTime).count();
+}
+
+int main(int argc, char**argv) {
+  std::string && siteList = getFileContents("./test/data/sitelist.txt");
+  std::stringstream ss(siteList);
+  std::istream_iterator<string> begin(ss);
+  std::istream_iterator<string> end;
+  std::vector<string> urls(begin, end);
+
+  const int kNumPasses = 20;
+  cout << "Lexing " << urls.size() << " URLs " << kNumPasses << " times"
+    << endl;
+  int64_t scalarChecksum = 0;
+  int64_t checksum = 0;
+  double scalarTime = timeLexing(lexUrlScalar, urls, kNumPasses,
+      &scalarChecksum);
+  double time = timeLexing([](const char *url, int urlLen,
+        SeparatorBitmap *separators, const char **host, int *hostLen,
+        bool *blockable) {
+      *blockable = lexUrl(url, urlLen, separators, host, hostLen);
+    }, urls, kNumPasses, &checksum);
+  cout << "Scalar time: " << scalarTime << "s" << endl;
+  cout << "Time: " << time << "s" << endl;
+  cout << "Speedup: " << scalarTime / time << "x" << endl;
+  if (checksum != scalarChecksum) {
+    cout << "Results differ from the scalar version" << endl;
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,162 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "./public_suffix_list.h"
+
+#include <stdint.h>
+#include "./public_suffix_list_data.h"
+
+// Node flags written by scripts/generatePublicSuffixList.js
+static const uint8_t kRule = 1;
+static const uint8_t kWildcard = 2;
+static const uint8_t kException = 4;
+
+static inline char toLowerAscii(char c) {
+  return c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c;
+}
+
+// Drops a trailing '.' since "example.com." is the same host as
+// "example.com".
+static inline int trimHostLen(const char *host, int hostLen) {
+  return hostLen > 0 && host[hostLen - 1] == '.' ? hostLen - 1 : hostLen;
+}
+
+static bool isIPAddress(const char *host, int hostLen) {
+  if (hostLen == 0) {
+    return false;
+  }
+  if (host[0] == '[') {
+    return true;
+  }
+  for (int i = 0; i < hostLen; i++) {
+    if ((host[i] < '0' || host[i] > '9') && host[i] != '.') {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Returns where the label which ends just before |end| starts
+static inline int findLabelStart(const char *host, int end) {
+  int start = end;
+  while (start > 0 && host[start - 1] != '.') {
+    start--;
+  }
+  return start;
+}
+
+// Returns the node the edge starting at |edge| leads to
+static inline const uint8_t * edgeTarget(const uint8_t *edge) {
+  const uint8_t *offset = edge + 1 + edge[0];
+  return kPublicSuffixListDafsa +
+    ((offset[0] << 16) | (offset[1] << 8) | offset[2]);
+}
+
+int getPublicSuffixLen(const char *host, int hostLen) {
+  hostLen = trimHostLen(host, hostLen);
+  if (hostLen == 0) {
+    return 0;
+  }
+  // The default rule makes the last label a public suffix
+  int suffixLen = hostLen - findLabelStart(host, hostLen);
+
+  // |pos| is where the part of the host read so far starts, it is read
+  // backwards so the node for "ku.oc" is reached after reading "co.uk".
+  const uint8_t *node = kPublicSuffixListDafsa;
+  int pos = hostLen;
+  while (true) {
+    if (pos < hostLen && (pos == 0 || host[pos - 1] == '.')) {
+      const uint8_t flags = node[0];
+      if (flags & kException) {
+        // The exception is a registrable domain, so its first label isn't
+        // part of the public suffix.
+        int dot = pos;
+        while (host[dot] != '.') {
+          dot++;
+        }
+        return hostLen - dot - 1;
+      }
+      if ((flags & kRule) && hostLen - pos > suffixLen) {
+        suffixLen = hostLen - pos;
+      }
+      if ((flags & kWildcard) && pos > 0) {
+        const int wildcardLen = hostLen - findLabelStart(host, pos - 1);
+        if (wildcardLen > suffixLen) {
+          suffixLen = wildcardLen;
+        }
+      }
+    }
+    if (pos == 0) {
+      break;
+    }
+
+    const char c = toLowerAscii(host[pos - 1]);
+    const uint8_t *edge = node + 2;
+    const uint8_t *next = nullptr;
+    for (int i = 0; i < node[1]; i++) {
+      if (edge[1] == static_cast<uint8_t>(c)) {
+        next = edge;
+        break;
+      }
+      if (edge[1] > static_cast<uint8_t>(c)) {
+        break;
+      }
+      edge += 1 + edge[0] + 3;
+    }
+    if (!next) {
+      break;
+    }
+    const int labelLen = next[0];
+    if (labelLen > pos) {
+      break;
+    }
+    int i = 1;
+    while (i < labelLen &&
+        static_cast<uint8_t>(toLowerAscii(host[pos - 1 - i])) == next[1 + i]) {
+      i++;
+    }
+    if (i < labelLen) {
+      break;
+    }
+    pos -= labelLen;
+    node = edgeTarget(next);
+  }
+  return suffixLen;
+}
+
+const char * getRegistrableDomain(const char *host, int hostLen,
+    int *registrableDomainLen) {
+  const int trimmedLen = trimHostLen(host, hostLen);
+  if (isIPAddress(host, trimmedLen)) {
+    *registrableDomainLen = trimmedLen;
+    return host;
+  }
+  const int suffixLen = getPublicSuffixLen(host, trimmedLen);
+  if (suffixLen >= trimmedLen - 1) {
+    *registrableDomainLen = trimmedLen;
+    return host;
+  }
+  const int start = findLabelStart(host, trimmedLen - suffixLen - 1);
+  *registrableDomainLen = trimmedLen - start;
+  return host + start;
+}
+
+bool isThirdPartyDomain(const char *contextDomain, int contextDomainLen,
+    const char *host, int hostLen) {
+  int contextLen;
+  const char *context = getRegistrableDomain(contextDomain, contextDomainLen,
+      &contextLen);
+  int len;
+  const char *registrableDomain = getRegistrableDomain(host, hostLen, &len);
+  if (contextLen != len) {
+    return true;
+  }
+  for (int i = 0; i < len; i++) {
+    if (toLowerAscii(context[i]) != toLowerAscii(registrableDomain[i])) {
+      return true;
+    }
+  }
+  return false;
+}
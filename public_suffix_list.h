@@ -0,0 +1,33 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef PUBLIC_SUFFIX_LIST_H_
+#define PUBLIC_SUFFIX_LIST_H_
+
+#include "./base.h"
+
+// Lookups in the public suffix list built into public_suffix_list_data.h by
+// scripts/generatePublicSuffixList.js.  Hosts are compared without regard
+// to ASCII case and a trailing '.' is ignored, internationalized hosts have
+// to be in punycode.  None of the lookups allocate.
+
+// Returns the length of the public suffix at the end of |host|, e.g. 5 for
+// "www.example.co.uk".  Hosts whose TLD isn't in the list have their last
+// label as the public suffix.
+int getPublicSuffixLen(const char *host, int hostLen);
+
+// Returns where the registrable domain (the public suffix and the label
+// before it) starts in |host| and sets |registrableDomainLen| to its length,
+// e.g. "example.co.uk" for "www.example.co.uk".  The whole host is returned
+// for IP addresses and for hosts which are public suffixes themselves.
+const char * getRegistrableDomain(const char *host, int hostLen,
+    int *registrableDomainLen);
+
+// True if a request for |host| from a page on |contextDomain| is third
+// party, which is when their registrable domains differ.
+bool isThirdPartyDomain(const char *contextDomain, int contextDomainLen,
+    const char *host, int hostLen);
+
+#endif  // PUBLIC_SUFFIX_LIST_H_
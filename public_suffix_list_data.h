@@ -0,0 +1,7517 @@
+#pragma once
+/**
+  *
+  * Auto generated by scripts/generatePublicSuffixList.js from
+  * public_suffix_list.dat, 9506 rules.
+  */
+static const uint8_t kPublicSuffixListDafsa[] = {
+  0x00, 0x1a, 0x01, 0x61, 0x00, 0x00, 0x84, 0x01, 0x62, 0x00, 0x01, 0x3f,
+  0x01, 0x63, 0x00, 0x01, 0xa4, 0x01, 0x64, 0x00, 0x02, 0x13, 0x01, 0x65,
+  0x00, 0x02, 0x9b, 0x01, 0x66, 0x00, 0x03, 0x41, 0x01, 0x67, 0x00, 0x03,
+  0xaa, 0x01, 0x68, 0x00, 0x04, 0x28, 0x01, 0x69, 0x00, 0x04, 0x8e, 0x01,
+  0x6a, 0x00, 0x05, 0x0e, 0x01, 0x6b, 0x00, 0x05, 0x4e, 0x01, 0x6c, 0x00,
+  0x05, 0xb5, 0x01, 0x6d, 0x00, 0x06, 0x2b, 0x01, 0x6e, 0x00, 0x06, 0xa5,
+  0x01, 0x6f, 0x00, 0x07, 0x10, 0x01, 0x70, 0x00, 0x07, 0x85, 0x01, 0x71,
+  0x00, 0x07, 0xda, 0x01, 0x72, 0x00, 0x07, 0xf5, 0x01, 0x73, 0x00, 0x08,
+  0x52, 0x01, 0x74, 0x00, 0x08, 0xce, 0x01, 0x75, 0x00, 0x09, 0x50, 0x01,
+  0x76, 0x00, 0x09, 0x9e, 0x01, 0x77, 0x00, 0x09, 0xda, 0x01, 0x78, 0x00,
+  0x0a, 0x18, 0x01, 0x79, 0x00, 0x0a, 0x4e, 0x01, 0x7a, 0x00, 0x0a, 0xc5,
+  0x00, 0x21, 0x01, 0x30, 0x00, 0x0b, 0x10, 0x01, 0x31, 0x00, 0x0b, 0x32,
+  0x01, 0x32, 0x00, 0x0b, 0x52, 0x01, 0x33, 0x00, 0x0b, 0x6a, 0x09, 0x34,
+  0x78, 0x31, 0x64, 0x37, 0x37, 0x78, 0x72, 0x63, 0x00, 0x0b, 0x7d, 0x01,
+  0x36, 0x00, 0x0b, 0x84, 0x05, 0x38, 0x38, 0x33, 0x78, 0x6e, 0x00, 0x0b,
+  0xad, 0x05, 0x39, 0x64, 0x32, 0x63, 0x32, 0x00, 0x0b, 0xb4, 0x01, 0x61,
+  0x00, 0x0b, 0xbb, 0x01, 0x62, 0x00, 0x0b, 0xc7, 0x01, 0x63, 0x00, 0x0b,
+  0xea, 0x01, 0x64, 0x00, 0x0c, 0x02, 0x01, 0x65, 0x00, 0x0c, 0x1d, 0x01,
+  0x66, 0x00, 0x0c, 0x24, 0x01, 0x67, 0x00, 0x0c, 0x30, 0x02, 0x68, 0x73,
+  0x00, 0x0c, 0x43, 0x01, 0x69, 0x00, 0x0c, 0x4a, 0x01, 0x6a, 0x00, 0x0c,
+  0x68, 0x01, 0x6b, 0x00, 0x0c, 0x6f, 0x01, 0x6c, 0x00, 0x0c, 0x85, 0x01,
+  0x6d, 0x00, 0x0c, 0x9a, 0x01, 0x6e, 0x00, 0x0c, 0xb6, 0x01, 0x70, 0x00,
+  0x0c, 0xd1, 0x01, 0x71, 0x00, 0x0c, 0xf0, 0x01, 0x72, 0x00, 0x0c, 0xf7,
+  0x01, 0x73, 0x00, 0x0d, 0x12, 0x01, 0x74, 0x00, 0x0d, 0x24, 0x01, 0x75,
+  0x00, 0x0d, 0x3c, 0x01, 0x76, 0x00, 0x0d, 0x43, 0x03, 0x77, 0x61, 0x6e,
+  0x00, 0x0d, 0x59, 0x01, 0x78, 0x00, 0x0d, 0x60, 0x02, 0x79, 0x6f, 0x00,
+  0x0d, 0x6e, 0x01, 0x7a, 0x00, 0x0d, 0x75, 0x00, 0x10, 0x06, 0x30, 0x30,
+  0x61, 0x76, 0x65, 0x35, 0x00, 0x0d, 0x81, 0x01, 0x31, 0x00, 0x0d, 0x8a,
+  0x02, 0x32, 0x78, 0x00, 0x0d, 0xa3, 0x01, 0x33, 0x00, 0x0d, 0xaa, 0x01,
+  0x34, 0x00, 0x0d, 0xb8, 0x05, 0x38, 0x38, 0x75, 0x76, 0x6f, 0x00, 0x0d,
+  0xc5, 0x01, 0x61, 0x00, 0x0d, 0xcc, 0x01, 0x62, 0x00, 0x0d, 0xf0, 0x01,
+  0x63, 0x00, 0x0d, 0xfc, 0x01, 0x64, 0x00, 0x0e, 0x08, 0x01, 0x67, 0x00,
+  0x0e, 0x15, 0x01, 0x6c, 0x00, 0x0e, 0x17, 0x01, 0x73, 0x00, 0x0e, 0x23,
+  0x05, 0x74, 0x63, 0x2d, 0x72, 0x65, 0x00, 0x0e, 0x2a, 0x01, 0x75, 0x00,
+  0x0e, 0x3b, 0x06, 0x77, 0x70, 0x2d, 0x67, 0x6e, 0x75, 0x00, 0x0e, 0x2a,
+  0x00, 0x14, 0x01, 0x31, 0x00, 0x0e, 0x48, 0x06, 0x32, 0x65, 0x39, 0x63,
+  0x32, 0x63, 0x00, 0x0e, 0x55, 0x01, 0x34, 0x00, 0x0e, 0x5c, 0x01, 0x38,
+  0x00, 0x0e, 0x82, 0x03, 0x39, 0x6a, 0x72, 0x00, 0x0e, 0x93, 0x01, 0x61,
+  0x00, 0x0e, 0x9f, 0x01, 0x62, 0x00, 0x0e, 0xb2, 0x01, 0x63, 0x00, 0x0e,
+  0xd1, 0x01, 0x65, 0x00, 0x0e, 0xe9, 0x01, 0x66, 0x00, 0x0e, 0xff, 0x01,
+  0x69, 0x00, 0x0f, 0x06, 0x01, 0x6c, 0x00, 0x0f, 0x1c, 0x01, 0x6d, 0x00,
+  0x0f, 0x28, 0x01, 0x6e, 0x00, 0x0f, 0x38, 0x03, 0x72, 0x65, 0x6c, 0x00,
+  0x0f, 0x49, 0x01, 0x73, 0x00, 0x0e, 0x23, 0x01, 0x74, 0x00, 0x0f, 0x50,
+  0x01, 0x76, 0x00, 0x0f, 0x61, 0x01, 0x77, 0x00, 0x0f, 0x68, 0x01, 0x79,
+  0x00, 0x0f, 0x6f, 0x00, 0x17, 0x02, 0x32, 0x75, 0x00, 0x0f, 0x76, 0x01,
+  0x33, 0x00, 0x0f, 0x7e, 0x01, 0x35, 0x00, 0x0f, 0x8b, 0x05, 0x36, 0x39,
+  0x37, 0x75, 0x74, 0x00, 0x0f, 0x92, 0x03, 0x37, 0x35, 0x79, 0x00, 0x0f,
+  0x99, 0x07, 0x39, 0x63, 0x74, 0x64, 0x76, 0x6b, 0x63, 0x00, 0x0f, 0xa0,
+  0x01, 0x61, 0x00, 0x0f, 0xa7, 0x01, 0x62, 0x00, 0x0f, 0xc0, 0x01, 0x63,
+  0x00, 0x0f, 0xc8, 0x01, 0x65, 0x00, 0x0f, 0xe2, 0x01, 0x66, 0x00, 0x0f,
+  0xfa, 0x01, 0x67, 0x00, 0x10, 0x01, 0x01, 0x68, 0x00, 0x10, 0x08, 0x01,
+  0x69, 0x00, 0x10, 0x1a, 0x01, 0x6c, 0x00, 0x10, 0x35, 0x01, 0x6d, 0x00,
+  0x10, 0x46, 0x01, 0x6e, 0x00, 0x10, 0x4d, 0x01, 0x6f, 0x00, 0x10, 0x5e,
+  0x01, 0x72, 0x00, 0x10, 0x6a, 0x01, 0x73, 0x00, 0x10, 0x86, 0x01, 0x74,
+  0x00, 0x10, 0x92, 0x04, 0x75, 0x6f, 0x6c, 0x63, 0x00, 0x10, 0xa6, 0x04,
+  0x7a, 0x61, 0x35, 0x63, 0x00, 0x10, 0xad, 0x00, 0x1c, 0x01, 0x31, 0x00,
+  0x10, 0xb5, 0x09, 0x32, 0x61, 0x36, 0x61, 0x31, 0x62, 0x36, 0x62, 0x31,
+  0x00, 0x10, 0xce, 0x08, 0x33, 0x6d, 0x61, 0x30, 0x65, 0x31, 0x63, 0x76,
+  0x00, 0x0d, 0xc5, 0x05, 0x34, 0x31, 0x38, 0x74, 0x78, 0x00, 0x10, 0xd5,
+  0x06, 0x37, 0x30, 0x37, 0x62, 0x30, 0x65, 0x00, 0x10, 0xdc, 0x01, 0x61,
+  0x00, 0x10, 0xe3, 0x01, 0x62, 0x00, 0x10, 0xef, 0x01, 0x63, 0x00, 0x11,
+  0x03, 0x01, 0x64, 0x00, 0x11, 0x29, 0x01, 0x65, 0x00, 0x11, 0x46, 0x01,
+  0x66, 0x00, 0x11, 0x62, 0x01, 0x67, 0x00, 0x11, 0x6e, 0x01, 0x69, 0x00,
+  0x11, 0x8f, 0x01, 0x6a, 0x00, 0x11, 0xa0, 0x01, 0x6b, 0x00, 0x11, 0xa7,
+  0x01, 0x6c, 0x00, 0x11, 0xb3, 0x01, 0x6d, 0x00, 0x11, 0xe9, 0x01, 0x6e,
+  0x00, 0x12, 0x09, 0x01, 0x6f, 0x00, 0x12, 0x22, 0x01, 0x70, 0x00, 0x12,
+  0x29, 0x01, 0x72, 0x00, 0x12, 0x3a, 0x01, 0x73, 0x00, 0x12, 0x67, 0x01,
+  0x74, 0x00, 0x12, 0x87, 0x01, 0x75, 0x00, 0x12, 0xaa, 0x01, 0x76, 0x00,
+  0x12, 0xb7, 0x01, 0x77, 0x00, 0x12, 0xd5, 0x01, 0x78, 0x00, 0x12, 0xe2,
+  0x01, 0x79, 0x00, 0x12, 0xe9, 0x00, 0x12, 0x06, 0x30, 0x66, 0x33, 0x72,
+  0x6b, 0x63, 0x00, 0x12, 0xf0, 0x03, 0x31, 0x39, 0x38, 0x00, 0x12, 0xf7,
+  0x03, 0x32, 0x38, 0x30, 0x00, 0x12, 0xf7, 0x01, 0x37, 0x00, 0x12, 0xff,
+  0x01, 0x61, 0x00, 0x0e, 0x23, 0x01, 0x62, 0x00, 0x13, 0x07, 0x01, 0x63,
+  0x00, 0x13, 0x15, 0x01, 0x65, 0x00, 0x13, 0x2c, 0x01, 0x67, 0x00, 0x0e,
+  0x15, 0x01, 0x69, 0x00, 0x13, 0x33, 0x01, 0x6c, 0x00, 0x13, 0x3a, 0x01,
+  0x6e, 0x00, 0x13, 0x46, 0x01, 0x6f, 0x00, 0x13, 0x4d, 0x01, 0x70, 0x00,
+  0x13, 0x54, 0x01, 0x72, 0x00, 0x13, 0x5b, 0x01, 0x74, 0x00, 0x13, 0x62,
+  0x05, 0x76, 0x64, 0x37, 0x63, 0x6b, 0x00, 0x13, 0x6e, 0x01, 0x77, 0x00,
+  0x13, 0x75, 0x00, 0x17, 0x01, 0x32, 0x00, 0x13, 0x7c, 0x01, 0x33, 0x00,
+  0x13, 0x8c, 0x04, 0x34, 0x35, 0x35, 0x73, 0x00, 0x13, 0xa3, 0x04, 0x35,
+  0x6d, 0x7a, 0x74, 0x00, 0x13, 0xaa, 0x04, 0x36, 0x39, 0x76, 0x71, 0x00,
+  0x13, 0xb1, 0x01, 0x37, 0x00, 0x13, 0xb8, 0x01, 0x61, 0x00, 0x13, 0xc8,
+  0x01, 0x62, 0x00, 0x13, 0xd4, 0x01, 0x63, 0x00, 0x13, 0xdb, 0x01, 0x65,
+  0x00, 0x13, 0xeb, 0x01, 0x67, 0x00, 0x13, 0xf7, 0x01, 0x69, 0x00, 0x13,
+  0xfe, 0x01, 0x6b, 0x00, 0x14, 0x0a, 0x01, 0x6d, 0x00, 0x14, 0x11, 0x01,
+  0x6e, 0x00, 0x14, 0x1d, 0x01, 0x6f, 0x00, 0x14, 0x38, 0x01, 0x70, 0x00,
+  0x14, 0x4a, 0x01, 0x72, 0x00, 0x14, 0x4c, 0x01, 0x73, 0x00, 0x14, 0x6b,
+  0x01, 0x74, 0x00, 0x0e, 0x15, 0x01, 0x75, 0x00, 0x14, 0x80, 0x01, 0x76,
+  0x00, 0x14, 0x87, 0x01, 0x77, 0x00, 0x14, 0x93, 0x00, 0x10, 0x08, 0x30,
+  0x65, 0x65, 0x35, 0x61, 0x33, 0x6c, 0x64, 0x00, 0x14, 0x9a, 0x09, 0x34,
+  0x77, 0x63, 0x33, 0x6f, 0x2d, 0x2d, 0x6e, 0x78, 0x00, 0x14, 0xa3, 0x01,
+  0x38, 0x00, 0x14, 0xaa, 0x01, 0x62, 0x00, 0x14, 0xb9, 0x01, 0x63, 0x00,
+  0x14, 0xc5, 0x05, 0x64, 0x30, 0x73, 0x62, 0x67, 0x00, 0x14, 0xed, 0x01,
+  0x66, 0x00, 0x14, 0xf4, 0x01, 0x67, 0x00, 0x15, 0x02, 0x01, 0x6b, 0x00,
+  0x14, 0x4a, 0x01, 0x6d, 0x00, 0x15, 0x09, 0x01, 0x6f, 0x00, 0x15, 0x10,
+  0x01, 0x70, 0x00, 0x15, 0x17, 0x01, 0x73, 0x00, 0x15, 0x1e, 0x01, 0x74,
+  0x00, 0x15, 0x2f, 0x02, 0x76, 0x6f, 0x00, 0x15, 0x52, 0x01, 0x7a, 0x00,
+  0x15, 0x5e, 0x00, 0x18, 0x03, 0x33, 0x74, 0x75, 0x00, 0x15, 0x65, 0x01,
+  0x37, 0x00, 0x15, 0x6c, 0x01, 0x61, 0x00, 0x15, 0x75, 0x01, 0x62, 0x00,
+  0x15, 0x92, 0x01, 0x63, 0x00, 0x15, 0xab, 0x01, 0x64, 0x00, 0x15, 0xbc,
+  0x01, 0x65, 0x00, 0x15, 0xc8, 0x01, 0x66, 0x00, 0x15, 0xd5, 0x01, 0x67,
+  0x00, 0x15, 0xe1, 0x01, 0x68, 0x00, 0x15, 0xe8, 0x02, 0x6a, 0x75, 0x00,
+  0x15, 0xf4, 0x01, 0x6b, 0x00, 0x15, 0xfb, 0x01, 0x6c, 0x00, 0x16, 0x1d,
+  0x01, 0x6d, 0x00, 0x16, 0x33, 0x01, 0x6e, 0x00, 0x16, 0x3a, 0x01, 0x6f,
+  0x00, 0x12, 0x22, 0x03, 0x72, 0x61, 0x72, 0x00, 0x16, 0x53, 0x01, 0x73,
+  0x00, 0x16, 0x5a, 0x01, 0x74, 0x00, 0x16, 0x66, 0x01, 0x75, 0x00, 0x16,
+  0x7b, 0x01, 0x76, 0x00, 0x16, 0x82, 0x01, 0x77, 0x00, 0x16, 0x89, 0x02,
+  0x78, 0x61, 0x00, 0x16, 0x90, 0x01, 0x79, 0x00, 0x16, 0x9c, 0x00, 0x09,
+  0x05, 0x36, 0x70, 0x71, 0x67, 0x7a, 0x00, 0x0d, 0x81, 0x08, 0x38, 0x64,
+  0x61, 0x31, 0x74, 0x61, 0x62, 0x62, 0x00, 0x16, 0xa3, 0x01, 0x62, 0x00,
+  0x16, 0xaa, 0x01, 0x64, 0x00, 0x0e, 0x15, 0x01, 0x66, 0x00, 0x16, 0xb1,
+  0x01, 0x6e, 0x00, 0x16, 0xb8, 0x01, 0x73, 0x00, 0x0e, 0x15, 0x01, 0x74,
+  0x00, 0x16, 0xbf, 0x07, 0x79, 0x71, 0x78, 0x39, 0x34, 0x71, 0x69, 0x00,
+  0x16, 0xc6, 0x00, 0x12, 0x04, 0x38, 0x75, 0x78, 0x70, 0x00, 0x10, 0xdc,
+  0x05, 0x39, 0x32, 0x34, 0x74, 0x63, 0x00, 0x16, 0xcd, 0x03, 0x61, 0x72,
+  0x66, 0x00, 0x16, 0xd4, 0x01, 0x63, 0x00, 0x16, 0xdb, 0x01, 0x64, 0x00,
+  0x16, 0xfb, 0x01, 0x65, 0x00, 0x17, 0x07, 0x01, 0x66, 0x00, 0x14, 0x4a,
+  0x01, 0x68, 0x00, 0x17, 0x14, 0x01, 0x69, 0x00, 0x17, 0x20, 0x01, 0x6c,
+  0x00, 0x17, 0x2d, 0x01, 0x6d, 0x00, 0x17, 0x43, 0x01, 0x6e, 0x00, 0x17,
+  0x4a, 0x01, 0x6f, 0x00, 0x17, 0x57, 0x01, 0x70, 0x00, 0x17, 0x5e, 0x03,
+  0x72, 0x6f, 0x77, 0x00, 0x17, 0x65, 0x01, 0x73, 0x00, 0x17, 0x6e, 0x01,
+  0x74, 0x00, 0x0e, 0x15, 0x01, 0x75, 0x00, 0x17, 0x75, 0x00, 0x14, 0x03,
+  0x30, 0x34, 0x73, 0x00, 0x17, 0x7c, 0x01, 0x61, 0x00, 0x17, 0x84, 0x01,
+  0x63, 0x00, 0x17, 0xb6, 0x01, 0x64, 0x00, 0x17, 0xbd, 0x01, 0x65, 0x00,
+  0x17, 0xc4, 0x01, 0x66, 0x00, 0x17, 0xdb, 0x01, 0x67, 0x00, 0x17, 0xed,
+  0x01, 0x68, 0x00, 0x17, 0xf4, 0x01, 0x69, 0x00, 0x18, 0x00, 0x01, 0x6c,
+  0x00, 0x18, 0x16, 0x01, 0x6d, 0x00, 0x18, 0x31, 0x01, 0x6e, 0x00, 0x18,
+  0x38, 0x01, 0x6f, 0x00, 0x18, 0x44, 0x01, 0x70, 0x00, 0x18, 0x64, 0x01,
+  0x72, 0x00, 0x18, 0x70, 0x01, 0x73, 0x00, 0x0e, 0x23, 0x01, 0x74, 0x00,
+  0x18, 0x81, 0x04, 0x75, 0x62, 0x6e, 0x61, 0x00, 0x18, 0x88, 0x08, 0x78,
+  0x33, 0x62, 0x36, 0x38, 0x39, 0x71, 0x71, 0x00, 0x18, 0x8f, 0x05, 0x79,
+  0x63, 0x35, 0x72, 0x62, 0x00, 0x18, 0x96, 0x00, 0x16, 0x05, 0x30, 0x30,
+  0x74, 0x73, 0x62, 0x00, 0x10, 0xdc, 0x01, 0x31, 0x00, 0x18, 0x9d, 0x05,
+  0x39, 0x38, 0x31, 0x72, 0x76, 0x00, 0x18, 0xa6, 0x01, 0x61, 0x00, 0x18,
+  0xad, 0x01, 0x62, 0x00, 0x18, 0xcd, 0x01, 0x63, 0x00, 0x18, 0xd9, 0x01,
+  0x64, 0x00, 0x0e, 0x23, 0x01, 0x66, 0x00, 0x18, 0xe0, 0x01, 0x67, 0x00,
+  0x18, 0xec, 0x01, 0x68, 0x00, 0x0e, 0x15, 0x01, 0x69, 0x00, 0x18, 0xfa,
+  0x01, 0x6a, 0x00, 0x14, 0x4a, 0x01, 0x6b, 0x00, 0x19, 0x0d, 0x01, 0x6c,
+  0x00, 0x19, 0x14, 0x01, 0x6d, 0x00, 0x14, 0x4a, 0x01, 0x6f, 0x00, 0x19,
+  0x20, 0x01, 0x70, 0x00, 0x19, 0x40, 0x03, 0x72, 0x61, 0x66, 0x00, 0x19,
+  0x47, 0x01, 0x73, 0x00, 0x0e, 0x15, 0x01, 0x74, 0x00, 0x19, 0x54, 0x01,
+  0x75, 0x00, 0x19, 0x5b, 0x01, 0x7a, 0x00, 0x19, 0x6a, 0x00, 0x14, 0x05,
+  0x33, 0x31, 0x35, 0x72, 0x6d, 0x00, 0x10, 0xce, 0x01, 0x61, 0x00, 0x19,
+  0x71, 0x01, 0x62, 0x00, 0x19, 0xbc, 0x01, 0x63, 0x00, 0x19, 0xc8, 0x01,
+  0x64, 0x00, 0x19, 0xd4, 0x01, 0x65, 0x00, 0x19, 0xe0, 0x01, 0x67, 0x00,
+  0x1a, 0x1f, 0x01, 0x68, 0x00, 0x1a, 0x2c, 0x01, 0x69, 0x00, 0x1a, 0x33,
+  0x01, 0x6b, 0x00, 0x1a, 0x67, 0x01, 0x6c, 0x00, 0x1a, 0x6e, 0x01, 0x6d,
+  0x00, 0x1a, 0x7b, 0x01, 0x6f, 0x00, 0x1a, 0x82, 0x01, 0x70, 0x00, 0x1a,
+  0xb6, 0x01, 0x72, 0x00, 0x1a, 0xc2, 0x01, 0x73, 0x00, 0x1a, 0xcf, 0x01,
+  0x74, 0x00, 0x1a, 0xd6, 0x01, 0x75, 0x00, 0x1a, 0xe2, 0x01, 0x76, 0x00,
+  0x1a, 0xfd, 0x02, 0x77, 0x6f, 0x00, 0x1b, 0x04, 0x00, 0x15, 0x07, 0x37,
+  0x36, 0x69, 0x34, 0x6f, 0x72, 0x66, 0x00, 0x1b, 0x10, 0x01, 0x61, 0x00,
+  0x1b, 0x17, 0x01, 0x62, 0x00, 0x1b, 0x24, 0x01, 0x63, 0x00, 0x1b, 0x3a,
+  0x01, 0x64, 0x00, 0x1b, 0x5b, 0x01, 0x65, 0x00, 0x1b, 0x76, 0x01, 0x66,
+  0x00, 0x1b, 0x8b, 0x01, 0x67, 0x00, 0x1b, 0x93, 0x04, 0x68, 0x77, 0x73,
+  0x6f, 0x00, 0x1b, 0x9f, 0x01, 0x69, 0x00, 0x1b, 0xa6, 0x01, 0x6a, 0x00,
+  0x1b, 0xc7, 0x02, 0x6c, 0x6c, 0x00, 0x1b, 0xce, 0x01, 0x6d, 0x00, 0x1b,
+  0xda, 0x01, 0x6e, 0x00, 0x1b, 0xf5, 0x01, 0x6f, 0x00, 0x1c, 0x0b, 0x01,
+  0x72, 0x00, 0x1c, 0x2b, 0x01, 0x73, 0x00, 0x1c, 0x3c, 0x01, 0x74, 0x00,
+  0x1c, 0x43, 0x01, 0x76, 0x00, 0x1c, 0x59, 0x01, 0x78, 0x00, 0x1c, 0x65,
+  0x01, 0x79, 0x00, 0x1c, 0x6c, 0x00, 0x0f, 0x01, 0x61, 0x00, 0x1c, 0x73,
+  0x01, 0x65, 0x00, 0x1c, 0x89, 0x01, 0x67, 0x00, 0x1c, 0x90, 0x01, 0x69,
+  0x00, 0x1c, 0x97, 0x01, 0x6a, 0x00, 0x1c, 0xa8, 0x01, 0x6b, 0x00, 0x1c,
+  0xaf, 0x01, 0x6c, 0x00, 0x1c, 0xb6, 0x01, 0x6d, 0x00, 0x1c, 0xc2, 0x01,
+  0x6e, 0x00, 0x1c, 0xd3, 0x01, 0x6f, 0x00, 0x1c, 0xda, 0x02, 0x70, 0x61,
+  0x00, 0x1c, 0xf6, 0x02, 0x72, 0x61, 0x00, 0x1c, 0xfd, 0x01, 0x75, 0x00,
+  0x1d, 0x09, 0x02, 0x76, 0x73, 0x00, 0x1d, 0x1c, 0x06, 0x78, 0x65, 0x63,
+  0x65, 0x34, 0x69, 0x00, 0x1d, 0x23, 0x00, 0x05, 0x01, 0x61, 0x00, 0x1d,
+  0x2b, 0x01, 0x67, 0x00, 0x0e, 0x15, 0x01, 0x69, 0x00, 0x12, 0xe9, 0x01,
+  0x6d, 0x00, 0x0e, 0x15, 0x01, 0x73, 0x00, 0x1d, 0x34, 0x00, 0x12, 0x01,
+  0x61, 0x00, 0x1d, 0x3b, 0x01, 0x62, 0x00, 0x1d, 0x68, 0x01, 0x63, 0x00,
+  0x1d, 0x6f, 0x01, 0x65, 0x00, 0x1d, 0x76, 0x01, 0x66, 0x00, 0x1d, 0xda,
+  0x01, 0x67, 0x00, 0x1d, 0xec, 0x01, 0x68, 0x00, 0x1d, 0xf3, 0x01, 0x69,
+  0x00, 0x1d, 0xff, 0x01, 0x6b, 0x00, 0x1e, 0x15, 0x01, 0x6c, 0x00, 0x0e,
+  0x23, 0x01, 0x6d, 0x00, 0x1e, 0x21, 0x01, 0x6e, 0x00, 0x1e, 0x28, 0x01,
+  0x6f, 0x00, 0x1e, 0x2f, 0x01, 0x70, 0x00, 0x1e, 0x41, 0x01, 0x73, 0x00,
+  0x0e, 0x15, 0x01, 0x74, 0x00, 0x1e, 0x48, 0x02, 0x75, 0x62, 0x00, 0x1e,
+  0x59, 0x01, 0x76, 0x00, 0x1e, 0x60, 0x00, 0x17, 0x02, 0x38, 0x73, 0x00,
+  0x1e, 0x67, 0x02, 0x39, 0x7a, 0x00, 0x1e, 0x67, 0x01, 0x61, 0x00, 0x1e,
+  0x6e, 0x01, 0x62, 0x00, 0x1e, 0x94, 0x01, 0x63, 0x00, 0x1e, 0xaf, 0x01,
+  0x64, 0x00, 0x1e, 0xbb, 0x01, 0x65, 0x00, 0x1e, 0xe2, 0x01, 0x67, 0x00,
+  0x1f, 0x38, 0x06, 0x68, 0x35, 0x63, 0x38, 0x32, 0x32, 0x00, 0x1e, 0x67,
+  0x01, 0x69, 0x00, 0x1f, 0x41, 0x01, 0x6b, 0x00, 0x1f, 0x5c, 0x01, 0x6c,
+  0x00, 0x1f, 0x6f, 0x01, 0x6d, 0x00, 0x1f, 0x92, 0x01, 0x6e, 0x00, 0x1f,
+  0xac, 0x01, 0x6f, 0x00, 0x1f, 0xc4, 0x01, 0x70, 0x00, 0x1f, 0xe1, 0x01,
+  0x72, 0x00, 0x1f, 0xf2, 0x01, 0x73, 0x00, 0x20, 0x18, 0x01, 0x74, 0x00,
+  0x20, 0x2e, 0x01, 0x75, 0x00, 0x20, 0x4f, 0x01, 0x76, 0x00, 0x16, 0x7b,
+  0x01, 0x77, 0x00, 0x20, 0x7e, 0x01, 0x79, 0x00, 0x20, 0x95, 0x00, 0x18,
+  0x02, 0x30, 0x73, 0x00, 0x0f, 0x76, 0x01, 0x61, 0x00, 0x20, 0xa6, 0x01,
+  0x62, 0x00, 0x20, 0xd0, 0x01, 0x63, 0x00, 0x20, 0xe1, 0x03, 0x64, 0x69,
+  0x6d, 0x00, 0x20, 0xed, 0x01, 0x65, 0x00, 0x20, 0xf4, 0x01, 0x66, 0x00,
+  0x21, 0x29, 0x01, 0x67, 0x00, 0x21, 0x37, 0x01, 0x68, 0x00, 0x21, 0x3e,
+  0x01, 0x69, 0x00, 0x21, 0x45, 0x03, 0x6a, 0x65, 0x33, 0x00, 0x21, 0x65,
+  0x01, 0x6b, 0x00, 0x21, 0x6d, 0x01, 0x6c, 0x00, 0x21, 0x74, 0x01, 0x6d,
+  0x00, 0x21, 0x80, 0x01, 0x6e, 0x00, 0x21, 0x87, 0x01, 0x6f, 0x00, 0x21,
+  0xa3, 0x01, 0x70, 0x00, 0x21, 0xd0, 0x01, 0x72, 0x00, 0x21, 0xd7, 0x01,
+  0x73, 0x00, 0x21, 0xe9, 0x01, 0x74, 0x00, 0x22, 0x09, 0x03, 0x75, 0x6f,
+  0x67, 0x00, 0x22, 0x1f, 0x01, 0x78, 0x00, 0x22, 0x26, 0x01, 0x79, 0x00,
+  0x22, 0x2d, 0x02, 0x7a, 0x74, 0x00, 0x1c, 0x89, 0x00, 0x0f, 0x01, 0x32,
+  0x00, 0x22, 0x34, 0x01, 0x61, 0x00, 0x22, 0x42, 0x01, 0x63, 0x00, 0x22,
+  0x4e, 0x01, 0x64, 0x00, 0x22, 0x5a, 0x01, 0x65, 0x00, 0x22, 0x66, 0x01,
+  0x67, 0x00, 0x22, 0x6d, 0x01, 0x68, 0x00, 0x22, 0x74, 0x01, 0x6c, 0x00,
+  0x22, 0x85, 0x01, 0x6d, 0x00, 0x22, 0x8c, 0x01, 0x6e, 0x00, 0x22, 0x93,
+  0x01, 0x6f, 0x00, 0x22, 0xa0, 0x01, 0x72, 0x00, 0x22, 0xad, 0x01, 0x73,
+  0x00, 0x22, 0xc3, 0x01, 0x76, 0x00, 0x22, 0xcf, 0x02, 0x79, 0x6b, 0x00,
+  0x22, 0xd6, 0x00, 0x0b, 0x01, 0x62, 0x00, 0x0e, 0x15, 0x01, 0x63, 0x00,
+  0x22, 0xdd, 0x02, 0x65, 0x64, 0x00, 0x22, 0xe4, 0x01, 0x69, 0x00, 0x21,
+  0x6d, 0x01, 0x6c, 0x00, 0x22, 0xeb, 0x01, 0x6d, 0x00, 0x22, 0xf2, 0x01,
+  0x6f, 0x00, 0x22, 0xf9, 0x01, 0x72, 0x00, 0x16, 0x7b, 0x01, 0x73, 0x00,
+  0x23, 0x05, 0x01, 0x74, 0x00, 0x23, 0x0c, 0x03, 0x75, 0x71, 0x68, 0x00,
+  0x23, 0x27, 0x00, 0x0c, 0x01, 0x61, 0x00, 0x23, 0x2e, 0x01, 0x62, 0x00,
+  0x23, 0x3f, 0x01, 0x63, 0x00, 0x23, 0x46, 0x01, 0x65, 0x00, 0x23, 0x52,
+  0x01, 0x67, 0x00, 0x0e, 0x15, 0x01, 0x6b, 0x00, 0x23, 0x66, 0x01, 0x6d,
+  0x00, 0x23, 0x6d, 0x01, 0x6f, 0x00, 0x23, 0x79, 0x01, 0x70, 0x00, 0x23,
+  0x8f, 0x01, 0x72, 0x00, 0x23, 0x96, 0x01, 0x74, 0x00, 0x23, 0xa2, 0x01,
+  0x7a, 0x00, 0x23, 0xa9, 0x00, 0x0a, 0x01, 0x61, 0x00, 0x23, 0xb0, 0x01,
+  0x63, 0x00, 0x23, 0xbc, 0x01, 0x65, 0x00, 0x23, 0xc3, 0x03, 0x69, 0x6c,
+  0x66, 0x00, 0x23, 0xda, 0x01, 0x6a, 0x00, 0x16, 0x7b, 0x01, 0x6d, 0x00,
+  0x23, 0xe1, 0x01, 0x6f, 0x00, 0x23, 0xf6, 0x01, 0x72, 0x00, 0x10, 0xad,
+  0x01, 0x73, 0x00, 0x18, 0x81, 0x01, 0x78, 0x00, 0x24, 0x07, 0x00, 0x16,
+  0x03, 0x34, 0x70, 0x75, 0x00, 0x24, 0x14, 0x04, 0x37, 0x72, 0x72, 0x30,
+  0x00, 0x10, 0xdc, 0x01, 0x61, 0x00, 0x24, 0x1b, 0x01, 0x62, 0x00, 0x24,
+  0x40, 0x01, 0x63, 0x00, 0x24, 0x51, 0x01, 0x64, 0x00, 0x24, 0x62, 0x01,
+  0x65, 0x00, 0x24, 0x70, 0x01, 0x67, 0x00, 0x24, 0x8b, 0x01, 0x68, 0x00,
+  0x24, 0xa3, 0x01, 0x69, 0x00, 0x1e, 0x60, 0x01, 0x6b, 0x00, 0x24, 0xaf,
+  0x01, 0x6c, 0x00, 0x24, 0xbb, 0x01, 0x6d, 0x00, 0x24, 0xd9, 0x01, 0x6e,
+  0x00, 0x24, 0xee, 0x01, 0x6f, 0x00, 0x0d, 0xfc, 0x01, 0x70, 0x00, 0x24,
+  0xfa, 0x01, 0x72, 0x00, 0x25, 0x01, 0x01, 0x73, 0x00, 0x25, 0x1c, 0x01,
+  0x74, 0x00, 0x25, 0x28, 0x01, 0x75, 0x00, 0x25, 0x43, 0x03, 0x76, 0x61,
+  0x6e, 0x00, 0x25, 0x4f, 0x01, 0x78, 0x00, 0x25, 0x56, 0x00, 0x0e, 0x01,
+  0x61, 0x00, 0x25, 0x5d, 0x01, 0x62, 0x00, 0x25, 0x64, 0x01, 0x63, 0x00,
+  0x25, 0x6b, 0x01, 0x64, 0x00, 0x25, 0x72, 0x02, 0x69, 0x62, 0x00, 0x25,
+  0x79, 0x01, 0x6b, 0x00, 0x25, 0x85, 0x01, 0x6d, 0x00, 0x25, 0x8c, 0x01,
+  0x6e, 0x00, 0x25, 0x93, 0x02, 0x72, 0x61, 0x00, 0x25, 0x9f, 0x01, 0x73,
+  0x00, 0x25, 0xa6, 0x01, 0x74, 0x00, 0x25, 0xad, 0x01, 0x75, 0x00, 0x25,
+  0xb4, 0x02, 0x79, 0x78, 0x00, 0x25, 0xc0, 0x01, 0x7a, 0x00, 0x25, 0xc7,
+  0x00, 0x04, 0x04, 0x30, 0x74, 0x72, 0x6b, 0x00, 0x25, 0xce, 0x03, 0x32,
+  0x37, 0x71, 0x00, 0x25, 0xd5, 0x03, 0x65, 0x39, 0x65, 0x00, 0x10, 0xad,
+  0x06, 0x6e, 0x62, 0x62, 0x30, 0x63, 0x37, 0x00, 0x25, 0xdc, 0x00, 0x04,
+  0x02, 0x32, 0x6f, 0x00, 0x25, 0xe3, 0x06, 0x61, 0x70, 0x67, 0x36, 0x71,
+  0x70, 0x00, 0x25, 0xeb, 0x01, 0x68, 0x00, 0x25, 0xf2, 0x05, 0x72, 0x64,
+  0x63, 0x65, 0x71, 0x00, 0x25, 0xe3, 0x00, 0x03, 0x03, 0x38, 0x75, 0x67,
+  0x00, 0x1d, 0x23, 0x06, 0x65, 0x79, 0x68, 0x33, 0x6c, 0x61, 0x00, 0x14,
+  0x9a, 0x01, 0x71, 0x00, 0x25, 0xf9, 0x00, 0x02, 0x04, 0x32, 0x77, 0x71,
+  0x71, 0x00, 0x26, 0x01, 0x05, 0x36, 0x30, 0x61, 0x30, 0x79, 0x00, 0x26,
+  0x08, 0x00, 0x01, 0x01, 0x6b, 0x00, 0x26, 0x0f, 0x00, 0x06, 0x01, 0x31,
+  0x00, 0x26, 0x18, 0x04, 0x32, 0x79, 0x71, 0x79, 0x00, 0x0b, 0xad, 0x04,
+  0x35, 0x62, 0x30, 0x36, 0x00, 0x16, 0xc6, 0x02, 0x61, 0x78, 0x00, 0x26,
+  0x1f, 0x03, 0x65, 0x63, 0x37, 0x00, 0x26, 0x1f, 0x01, 0x6c, 0x00, 0x26,
+  0x26, 0x00, 0x01, 0x01, 0x6e, 0x00, 0x26, 0x0f, 0x00, 0x01, 0x01, 0x34,
+  0x00, 0x26, 0x0f, 0x00, 0x02, 0x01, 0x61, 0x00, 0x0e, 0x15, 0x01, 0x69,
+  0x00, 0x16, 0x7b, 0x01, 0x06, 0x01, 0x2e, 0x00, 0x26, 0x2e, 0x03, 0x61,
+  0x62, 0x69, 0x00, 0x26, 0x53, 0x01, 0x63, 0x00, 0x0e, 0x15, 0x02, 0x69,
+  0x68, 0x00, 0x26, 0x5a, 0x01, 0x6d, 0x00, 0x0e, 0x15, 0x01, 0x6e, 0x00,
+  0x0e, 0x15, 0x01, 0x04, 0x01, 0x2e, 0x00, 0x26, 0x61, 0x01, 0x69, 0x00,
+  0x26, 0xac, 0x03, 0x6e, 0x61, 0x69, 0x00, 0x26, 0xbd, 0x01, 0x73, 0x00,
+  0x0e, 0x15, 0x00, 0x05, 0x01, 0x61, 0x00, 0x26, 0xc4, 0x01, 0x6e, 0x00,
+  0x26, 0xcb, 0x01, 0x6f, 0x00, 0x12, 0x22, 0x01, 0x73, 0x00, 0x26, 0xd7,
+  0x01, 0x74, 0x00, 0x26, 0xde, 0x00, 0x01, 0x01, 0x67, 0x00, 0x0e, 0x15,
+  0x00, 0x02, 0x01, 0x63, 0x00, 0x0e, 0x15, 0x01, 0x6f, 0x00, 0x15, 0x5e,
+  0x01, 0x03, 0x01, 0x65, 0x00, 0x26, 0xe5, 0x03, 0x6e, 0x61, 0x72, 0x00,
+  0x26, 0xec, 0x01, 0x6f, 0x00, 0x26, 0xf3, 0x00, 0x01, 0x01, 0x6b, 0x00,
+  0x26, 0xfa, 0x00, 0x05, 0x01, 0x63, 0x00, 0x27, 0x01, 0x03, 0x64, 0x65,
+  0x6d, 0x00, 0x27, 0x08, 0x01, 0x68, 0x00, 0x27, 0x0f, 0x01, 0x6b, 0x00,
+  0x27, 0x16, 0x02, 0x73, 0x61, 0x00, 0x27, 0x1d, 0x00, 0x01, 0x01, 0x6e,
+  0x00, 0x27, 0x25, 0x00, 0x04, 0x01, 0x61, 0x00, 0x27, 0x2c, 0x01, 0x64,
+  0x00, 0x27, 0x33, 0x01, 0x65, 0x00, 0x27, 0x3a, 0x01, 0x75, 0x00, 0x27,
+  0x41, 0x01, 0x03, 0x01, 0x2e, 0x00, 0x27, 0x48, 0x04, 0x69, 0x72, 0x67,
+  0x6e, 0x00, 0x27, 0x72, 0x02, 0x6c, 0x65, 0x00, 0x27, 0x79, 0x01, 0x04,
+  0x01, 0x2e, 0x00, 0x27, 0x8b, 0x02, 0x61, 0x68, 0x00, 0x27, 0xab, 0x06,
+  0x65, 0x30, 0x30, 0x73, 0x66, 0x37, 0x00, 0x12, 0xff, 0x01, 0x6d, 0x00,
+  0x0e, 0x15, 0x01, 0x05, 0x01, 0x2e, 0x00, 0x27, 0xb2, 0x01, 0x61, 0x00,
+  0x27, 0xf5, 0x01, 0x69, 0x00, 0x27, 0x0f, 0x01, 0x6f, 0x00, 0x27, 0xfc,
+  0x01, 0x74, 0x00, 0x28, 0x04, 0x01, 0x05, 0x01, 0x2e, 0x00, 0x28, 0x0b,
+  0x01, 0x63, 0x00, 0x0e, 0x15, 0x04, 0x67, 0x37, 0x68, 0x79, 0x00, 0x25,
+  0xdc, 0x02, 0x72, 0x61, 0x00, 0x28, 0x35, 0x01, 0x73, 0x00, 0x0e, 0x15,
+  0x01, 0x01, 0x01, 0x2e, 0x00, 0x28, 0x3c, 0x00, 0x05, 0x01, 0x61, 0x00,
+  0x28, 0x66, 0x01, 0x65, 0x00, 0x28, 0x6d, 0x01, 0x66, 0x00, 0x28, 0x74,
+  0x01, 0x6e, 0x00, 0x28, 0x7b, 0x01, 0x75, 0x00, 0x28, 0x8b, 0x01, 0x03,
+  0x01, 0x2e, 0x00, 0x28, 0x97, 0x02, 0x61, 0x63, 0x00, 0x28, 0xc1, 0x01,
+  0x69, 0x00, 0x27, 0xf5, 0x00, 0x04, 0x01, 0x61, 0x00, 0x1e, 0x60, 0x03,
+  0x65, 0x6c, 0x68, 0x00, 0x28, 0xce, 0x01, 0x6c, 0x00, 0x28, 0xd5, 0x01,
+  0x6f, 0x00, 0x28, 0xdc, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x28, 0xe3, 0x01,
+  0x04, 0x01, 0x61, 0x00, 0x16, 0xb8, 0x01, 0x62, 0x00, 0x15, 0x5e, 0x01,
+  0x65, 0x00, 0x16, 0x7b, 0x01, 0x69, 0x00, 0x27, 0xf5, 0x00, 0x01, 0x01,
+  0x69, 0x00, 0x29, 0x58, 0x00, 0x02, 0x01, 0x61, 0x00, 0x0e, 0x15, 0x03,
+  0x69, 0x61, 0x63, 0x00, 0x29, 0x5f, 0x00, 0x01, 0x01, 0x67, 0x00, 0x29,
+  0x66, 0x00, 0x02, 0x01, 0x2e, 0x00, 0x29, 0x6d, 0x01, 0x7a, 0x00, 0x29,
+  0xae, 0x00, 0x01, 0x03, 0x61, 0x39, 0x69, 0x00, 0x25, 0xdc, 0x00, 0x03,
+  0x04, 0x32, 0x35, 0x71, 0x68, 0x00, 0x29, 0xb5, 0x04, 0x36, 0x38, 0x71,
+  0x75, 0x00, 0x23, 0x27, 0x03, 0x65, 0x32, 0x6b, 0x00, 0x29, 0xbc, 0x00,
+  0x01, 0x01, 0x74, 0x00, 0x1d, 0x23, 0x00, 0x02, 0x02, 0x62, 0x32, 0x00,
+  0x29, 0xc3, 0x02, 0x6a, 0x63, 0x00, 0x29, 0xcb, 0x00, 0x02, 0x01, 0x36,
+  0x00, 0x29, 0xd2, 0x02, 0x39, 0x36, 0x00, 0x0f, 0x76, 0x00, 0x01, 0x01,
+  0x72, 0x00, 0x26, 0x0f, 0x00, 0x06, 0x05, 0x30, 0x64, 0x63, 0x34, 0x78,
+  0x00, 0x1d, 0x23, 0x01, 0x63, 0x00, 0x0e, 0x15, 0x01, 0x68, 0x00, 0x29,
+  0xdf, 0x01, 0x6e, 0x00, 0x0e, 0x15, 0x01, 0x72, 0x00, 0x26, 0xd7, 0x01,
+  0x74, 0x00, 0x0e, 0x15, 0x01, 0x02, 0x01, 0x2e, 0x00, 0x29, 0xe6, 0x01,
+  0x61, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x01, 0x6a, 0x00, 0x0e, 0x15, 0x01,
+  0x73, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x02, 0x68, 0x65, 0x00, 0x14, 0x93,
+  0x01, 0x6d, 0x00, 0x2a, 0x10, 0x01, 0x00, 0x01, 0x02, 0x01, 0x2e, 0x00,
+  0x2a, 0x17, 0x01, 0x6d, 0x00, 0x0e, 0x15, 0x01, 0x01, 0x01, 0x2e, 0x00,
+  0x2a, 0x17, 0x00, 0x01, 0x0b, 0x74, 0x61, 0x72, 0x65, 0x62, 0x73, 0x6e,
+  0x65, 0x67, 0x6d, 0x72, 0x00, 0x2a, 0x32, 0x00, 0x02, 0x02, 0x6c, 0x63,
+  0x00, 0x2a, 0x39, 0x01, 0x70, 0x00, 0x2a, 0x45, 0x00, 0x02, 0x02, 0x31,
+  0x71, 0x00, 0x18, 0x96, 0x01, 0x68, 0x00, 0x26, 0x26, 0x00, 0x01, 0x01,
+  0x7a, 0x00, 0x16, 0xcd, 0x00, 0x04, 0x04, 0x34, 0x75, 0x62, 0x31, 0x00,
+  0x2a, 0x4c, 0x02, 0x61, 0x31, 0x00, 0x0f, 0xa0, 0x04, 0x62, 0x79, 0x6a,
+  0x39, 0x00, 0x26, 0x1f, 0x0a, 0x65, 0x72, 0x64, 0x35, 0x61, 0x39, 0x62,
+  0x31, 0x6b, 0x63, 0x00, 0x2a, 0x53, 0x00, 0x02, 0x04, 0x34, 0x78, 0x78,
+  0x32, 0x00, 0x12, 0xf0, 0x03, 0x63, 0x39, 0x6a, 0x00, 0x2a, 0x5a, 0x00,
+  0x02, 0x01, 0x62, 0x00, 0x2a, 0x63, 0x01, 0x63, 0x00, 0x2a, 0x74, 0x01,
+  0x02, 0x01, 0x2e, 0x00, 0x2a, 0x85, 0x08, 0x33, 0x61, 0x30, 0x39, 0x2d,
+  0x2d, 0x6e, 0x78, 0x00, 0x2a, 0xaa, 0x00, 0x05, 0x01, 0x61, 0x00, 0x0e,
+  0x15, 0x01, 0x62, 0x00, 0x0e, 0x15, 0x01, 0x63, 0x00, 0x2a, 0x10, 0x05,
+  0x66, 0x37, 0x36, 0x61, 0x30, 0x00, 0x2a, 0xb1, 0x01, 0x73, 0x00, 0x21,
+  0x6d, 0x01, 0x03, 0x01, 0x2e, 0x00, 0x2a, 0xbc, 0x07, 0x30, 0x61, 0x74,
+  0x66, 0x37, 0x62, 0x34, 0x00, 0x13, 0xaa, 0x02, 0x61, 0x31, 0x00, 0x2a,
+  0xfa, 0x01, 0x04, 0x01, 0x2e, 0x00, 0x2b, 0x01, 0x01, 0x62, 0x00, 0x2b,
+  0x3f, 0x01, 0x6e, 0x00, 0x0e, 0x15, 0x01, 0x73, 0x00, 0x2b, 0x46, 0x00,
+  0x01, 0x01, 0x64, 0x00, 0x21, 0x6d, 0x00, 0x04, 0x01, 0x6c, 0x00, 0x2b,
+  0x4d, 0x01, 0x6e, 0x00, 0x2b, 0x60, 0x01, 0x73, 0x00, 0x2b, 0x73, 0x01,
+  0x74, 0x00, 0x2b, 0x7a, 0x01, 0x02, 0x01, 0x2e, 0x00, 0x2b, 0x81, 0x01,
+  0x6c, 0x00, 0x0e, 0x15, 0x01, 0x02, 0x01, 0x2e, 0x00, 0x2b, 0xa6, 0x05,
+  0x70, 0x31, 0x61, 0x6b, 0x63, 0x00, 0x26, 0x1f, 0x01, 0x03, 0x01, 0x2e,
+  0x00, 0x2b, 0xb2, 0x01, 0x69, 0x00, 0x0e, 0x15, 0x01, 0x70, 0x00, 0x0e,
+  0x15, 0x00, 0x01, 0x01, 0x63, 0x00, 0x16, 0xd4, 0x01, 0x03, 0x01, 0x2e,
+  0x00, 0x2b, 0xbe, 0x01, 0x73, 0x00, 0x0e, 0x15, 0x01, 0x77, 0x00, 0x0e,
+  0x15, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x2b, 0xca, 0x00, 0x01, 0x01, 0x70,
+  0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x6e, 0x00, 0x0e, 0x15, 0x00, 0x01,
+  0x02, 0x72, 0x7a, 0x00, 0x2b, 0xef, 0x00, 0x02, 0x02, 0x31, 0x77, 0x00,
+  0x0f, 0x99, 0x01, 0x63, 0x00, 0x2b, 0xf6, 0x00, 0x01, 0x01, 0x78, 0x00,
+  0x2c, 0x08, 0x00, 0x01, 0x01, 0x6f, 0x00, 0x26, 0x0f, 0x00, 0x01, 0x01,
+  0x72, 0x00, 0x15, 0x65, 0x00, 0x01, 0x01, 0x65, 0x00, 0x26, 0x0f, 0x01,
+  0x04, 0x01, 0x2e, 0x00, 0x2c, 0x10, 0x01, 0x64, 0x00, 0x0e, 0x15, 0x01,
+  0x65, 0x00, 0x1d, 0x1c, 0x04, 0x6f, 0x6c, 0x6e, 0x77, 0x00, 0x2c, 0x17,
+  0x02, 0x01, 0x02, 0x32, 0x62, 0x00, 0x25, 0xdc, 0x01, 0x02, 0x01, 0x2e,
+  0x00, 0x2c, 0x1e, 0x0f, 0x67, 0x39, 0x61, 0x32, 0x67, 0x32, 0x62, 0x30,
+  0x61, 0x65, 0x30, 0x63, 0x68, 0x63, 0x6c, 0x00, 0x2b, 0xef, 0x00, 0x04,
+  0x01, 0x6d, 0x00, 0x2c, 0x25, 0x01, 0x72, 0x00, 0x2c, 0x2d, 0x02, 0x73,
+  0x6f, 0x00, 0x2c, 0x34, 0x02, 0x74, 0x69, 0x00, 0x2c, 0x3b, 0x00, 0x01,
+  0x01, 0x63, 0x00, 0x0e, 0x15, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x2c, 0x42,
+  0x00, 0x03, 0x02, 0x64, 0x33, 0x00, 0x0d, 0xa3, 0x01, 0x70, 0x00, 0x0e,
+  0x15, 0x01, 0x74, 0x00, 0x0e, 0x15, 0x01, 0x05, 0x01, 0x2e, 0x00, 0x2c,
+  0x4e, 0x01, 0x62, 0x00, 0x0e, 0x15, 0x01, 0x6f, 0x00, 0x2c, 0x94, 0x01,
+  0x70, 0x00, 0x0e, 0x15, 0x01, 0x72, 0x00, 0x2c, 0x9b, 0x00, 0x03, 0x01,
+  0x69, 0x00, 0x25, 0xc7, 0x01, 0x6f, 0x00, 0x0c, 0x1d, 0x01, 0x72, 0x00,
+  0x2c, 0xa2, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x2c, 0xa9, 0x00, 0x03, 0x01,
+  0x61, 0x00, 0x2c, 0xbf, 0x01, 0x6f, 0x00, 0x15, 0x5e, 0x01, 0x75, 0x00,
+  0x16, 0x9c, 0x00, 0x02, 0x01, 0x6f, 0x00, 0x16, 0x9c, 0x01, 0x72, 0x00,
+  0x0f, 0x68, 0x00, 0x04, 0x01, 0x61, 0x00, 0x2c, 0xcb, 0x07, 0x65, 0x66,
+  0x35, 0x30, 0x36, 0x77, 0x34, 0x00, 0x2a, 0x53, 0x01, 0x6b, 0x00, 0x2c,
+  0xd8, 0x01, 0x6f, 0x00, 0x16, 0x9c, 0x01, 0x02, 0x01, 0x2e, 0x00, 0x2c,
+  0xe9, 0x01, 0x6d, 0x00, 0x2d, 0x0e, 0x01, 0x03, 0x01, 0x2e, 0x00, 0x2d,
+  0x16, 0x04, 0x65, 0x78, 0x63, 0x77, 0x00, 0x29, 0xc3, 0x01, 0x6c, 0x00,
+  0x0e, 0x15, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x2d, 0x1d, 0x00, 0x01, 0x02,
+  0x62, 0x67, 0x00, 0x0b, 0xad, 0x00, 0x03, 0x03, 0x35, 0x33, 0x77, 0x00,
+  0x2d, 0xb6, 0x04, 0x37, 0x61, 0x31, 0x68, 0x00, 0x25, 0xf2, 0x04, 0x74,
+  0x61, 0x33, 0x6b, 0x00, 0x12, 0xf0, 0x00, 0x01, 0x01, 0x69, 0x00, 0x26,
+  0x0f, 0x00, 0x01, 0x01, 0x68, 0x00, 0x26, 0x0f, 0x00, 0x01, 0x01, 0x33,
+  0x00, 0x26, 0x0f, 0x01, 0x02, 0x01, 0x2e, 0x00, 0x2d, 0xbd, 0x01, 0x30,
+  0x00, 0x25, 0xce, 0x01, 0x03, 0x01, 0x2e, 0x00, 0x2d, 0xe2, 0x03, 0x6f,
+  0x72, 0x74, 0x00, 0x29, 0x5f, 0x02, 0x75, 0x74, 0x00, 0x2e, 0x30, 0x00,
+  0x05, 0x0a, 0x30, 0x6b, 0x72, 0x62, 0x64, 0x34, 0x2d, 0x2d, 0x6e, 0x78,
+  0x00, 0x2e, 0x37, 0x01, 0x61, 0x00, 0x2e, 0x3e, 0x01, 0x69, 0x00, 0x2e,
+  0x51, 0x01, 0x6e, 0x00, 0x2e, 0x58, 0x03, 0x72, 0x6f, 0x66, 0x00, 0x2e,
+  0x67, 0x01, 0x05, 0x01, 0x2e, 0x00, 0x2e, 0x6e, 0x03, 0x61, 0x72, 0x74,
+  0x00, 0x2e, 0xfb, 0x01, 0x69, 0x00, 0x2f, 0x04, 0x01, 0x6e, 0x00, 0x17,
+  0xbd, 0x01, 0x6f, 0x00, 0x0b, 0xad, 0x01, 0x05, 0x01, 0x2e, 0x00, 0x2f,
+  0x12, 0x01, 0x65, 0x00, 0x2a, 0x10, 0x02, 0x66, 0x66, 0x00, 0x2f, 0x47,
+  0x01, 0x67, 0x00, 0x0c, 0x1d, 0x01, 0x72, 0x00, 0x2f, 0x4e, 0x00, 0x02,
+  0x01, 0x61, 0x00, 0x2f, 0x5a, 0x01, 0x69, 0x00, 0x26, 0xde, 0x01, 0x06,
+  0x01, 0x2e, 0x00, 0x2f, 0x66, 0x01, 0x61, 0x00, 0x2f, 0x86, 0x01, 0x65,
+  0x00, 0x2f, 0xa2, 0x02, 0x6e, 0x61, 0x00, 0x2f, 0xa9, 0x01, 0x72, 0x00,
+  0x2f, 0xb6, 0x01, 0x75, 0x00, 0x0c, 0x1d, 0x01, 0x03, 0x01, 0x2e, 0x00,
+  0x2f, 0xbd, 0x01, 0x74, 0x00, 0x2f, 0xce, 0x01, 0x76, 0x00, 0x2f, 0xd5,
+  0x01, 0x01, 0x01, 0x2e, 0x00, 0x2f, 0xe1, 0x01, 0x02, 0x01, 0x2e, 0x00,
+  0x2f, 0xf7, 0x01, 0x69, 0x00, 0x30, 0x12, 0x00, 0x0a, 0x01, 0x61, 0x00,
+  0x30, 0x23, 0x01, 0x62, 0x00, 0x30, 0x30, 0x01, 0x63, 0x00, 0x30, 0x3c,
+  0x01, 0x64, 0x00, 0x30, 0x48, 0x01, 0x67, 0x00, 0x30, 0x4f, 0x01, 0x69,
+  0x00, 0x30, 0x56, 0x01, 0x6c, 0x00, 0x30, 0x62, 0x01, 0x70, 0x00, 0x30,
+  0x72, 0x01, 0x75, 0x00, 0x20, 0xed, 0x03, 0x79, 0x74, 0x73, 0x00, 0x30,
+  0x79, 0x01, 0x06, 0x01, 0x2e, 0x00, 0x30, 0x80, 0x01, 0x61, 0x00, 0x30,
+  0xec, 0x01, 0x65, 0x00, 0x12, 0x22, 0x01, 0x69, 0x00, 0x30, 0xf8, 0x01,
+  0x6f, 0x00, 0x31, 0x05, 0x01, 0x77, 0x00, 0x0e, 0x15, 0x01, 0x04, 0x01,
+  0x67, 0x00, 0x31, 0x0c, 0x01, 0x69, 0x00, 0x31, 0x13, 0x01, 0x6f, 0x00,
+  0x31, 0x21, 0x04, 0x72, 0x75, 0x6f, 0x62, 0x00, 0x31, 0x40, 0x00, 0x01,
+  0x01, 0x6d, 0x00, 0x0e, 0x15, 0x01, 0x03, 0x01, 0x2e, 0x00, 0x31, 0x47,
+  0x01, 0x69, 0x00, 0x31, 0x67, 0x01, 0x79, 0x00, 0x31, 0x6e, 0x01, 0x08,
+  0x01, 0x2e, 0x00, 0x31, 0x75, 0x01, 0x61, 0x00, 0x31, 0x86, 0x01, 0x62,
+  0x00, 0x0f, 0xfa, 0x01, 0x65, 0x00, 0x21, 0x6d, 0x01, 0x69, 0x00, 0x16,
+  0x9c, 0x03, 0x6f, 0x74, 0x73, 0x00, 0x31, 0x97, 0x02, 0x74, 0x61, 0x00,
+  0x31, 0x9e, 0x01, 0x75, 0x00, 0x31, 0xa5, 0x01, 0x06, 0x01, 0x2e, 0x00,
+  0x31, 0xbb, 0x01, 0x61, 0x00, 0x32, 0x35, 0x01, 0x69, 0x00, 0x32, 0x46,
+  0x01, 0x6e, 0x00, 0x32, 0x52, 0x01, 0x72, 0x00, 0x32, 0x5a, 0x01, 0x75,
+  0x00, 0x32, 0x5a, 0x00, 0x06, 0x01, 0x61, 0x00, 0x32, 0x61, 0x02, 0x69,
+  0x73, 0x00, 0x32, 0x6e, 0x01, 0x6f, 0x00, 0x27, 0xf5, 0x01, 0x72, 0x00,
+  0x26, 0xd7, 0x01, 0x74, 0x00, 0x32, 0x7b, 0x03, 0x75, 0x74, 0x69, 0x00,
+  0x32, 0x88, 0x00, 0x02, 0x01, 0x6c, 0x00, 0x15, 0x5e, 0x02, 0x71, 0x69,
+  0x00, 0x32, 0x8f, 0x01, 0x05, 0x01, 0x2e, 0x00, 0x32, 0x9b, 0x01, 0x61,
+  0x00, 0x27, 0x0f, 0x04, 0x65, 0x33, 0x67, 0x65, 0x00, 0x2a, 0x5a, 0x01,
+  0x69, 0x00, 0x32, 0xdf, 0x01, 0x6f, 0x00, 0x26, 0xde, 0x00, 0x02, 0x02,
+  0x6b, 0x63, 0x00, 0x16, 0xc6, 0x01, 0x72, 0x00, 0x0e, 0x15, 0x00, 0x01,
+  0x01, 0x75, 0x00, 0x26, 0xde, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x32, 0xf4,
+  0x00, 0x01, 0x01, 0x67, 0x00, 0x26, 0x0f, 0x00, 0x01, 0x02, 0x78, 0x69,
+  0x00, 0x33, 0x14, 0x00, 0x01, 0x02, 0x76, 0x71, 0x00, 0x0b, 0xad, 0x01,
+  0x02, 0x01, 0x2e, 0x00, 0x2c, 0x1e, 0x03, 0x77, 0x61, 0x39, 0x00, 0x1d,
+  0x23, 0x01, 0x03, 0x01, 0x2e, 0x00, 0x2d, 0x16, 0x07, 0x61, 0x31, 0x70,
+  0x2d, 0x2d, 0x6e, 0x78, 0x00, 0x33, 0x1b, 0x01, 0x6e, 0x00, 0x27, 0x0f,
+  0x00, 0x01, 0x01, 0x61, 0x00, 0x33, 0x22, 0x00, 0x01, 0x01, 0x61, 0x00,
+  0x12, 0x22, 0x00, 0x02, 0x01, 0x61, 0x00, 0x33, 0x29, 0x01, 0x6f, 0x00,
+  0x0c, 0x1d, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x33, 0x30, 0x00, 0x01, 0x01,
+  0x72, 0x00, 0x0f, 0x68, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x33, 0x5b, 0x00,
+  0x01, 0x01, 0x75, 0x00, 0x27, 0x0f, 0x01, 0x02, 0x01, 0x2e, 0x00, 0x20,
+  0xed, 0x01, 0x77, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x61, 0x00, 0x25,
+  0xdc, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x33, 0x6c, 0x00, 0x02, 0x02, 0x34,
+  0x77, 0x00, 0x2c, 0x08, 0x04, 0x38, 0x7a, 0x72, 0x66, 0x00, 0x18, 0x8f,
+  0x00, 0x02, 0x04, 0x34, 0x34, 0x73, 0x64, 0x00, 0x10, 0xdc, 0x09, 0x39,
+  0x31, 0x77, 0x36, 0x6a, 0x2d, 0x2d, 0x6e, 0x78, 0x00, 0x33, 0x78, 0x00,
+  0x01, 0x01, 0x65, 0x00, 0x33, 0x7f, 0x00, 0x01, 0x01, 0x35, 0x00, 0x26,
+  0x0f, 0x00, 0x01, 0x01, 0x68, 0x00, 0x0d, 0xc5, 0x00, 0x02, 0x03, 0x38,
+  0x61, 0x34, 0x00, 0x33, 0x86, 0x03, 0x72, 0x62, 0x32, 0x00, 0x2b, 0xef,
+  0x01, 0x02, 0x01, 0x2e, 0x00, 0x33, 0x93, 0x01, 0x76, 0x00, 0x1e, 0x60,
+  0x01, 0x01, 0x01, 0x2e, 0x00, 0x33, 0xa9, 0x01, 0x02, 0x01, 0x62, 0x00,
+  0x0e, 0x15, 0x05, 0x7a, 0x61, 0x39, 0x61, 0x30, 0x00, 0x25, 0xeb, 0x01,
+  0x02, 0x01, 0x2e, 0x00, 0x34, 0x5f, 0x01, 0x61, 0x00, 0x0e, 0x15, 0x01,
+  0x01, 0x01, 0x2e, 0x00, 0x34, 0x8e, 0x00, 0x02, 0x01, 0x61, 0x00, 0x0e,
+  0x15, 0x01, 0x76, 0x00, 0x0e, 0x15, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x34,
+  0xb3, 0x01, 0x02, 0x01, 0x2e, 0x00, 0x34, 0xe7, 0x01, 0x70, 0x00, 0x35,
+  0x0c, 0x01, 0x05, 0x01, 0x2e, 0x00, 0x35, 0x13, 0x01, 0x61, 0x00, 0x35,
+  0x51, 0x01, 0x69, 0x00, 0x35, 0x58, 0x01, 0x6f, 0x00, 0x35, 0x93, 0x01,
+  0x75, 0x00, 0x35, 0x9a, 0x00, 0x03, 0x01, 0x64, 0x00, 0x0e, 0x15, 0x01,
+  0x6c, 0x00, 0x15, 0x5e, 0x02, 0x6f, 0x67, 0x00, 0x35, 0xaa, 0x02, 0x00,
+  0x00, 0x04, 0x06, 0x32, 0x6e, 0x30, 0x38, 0x34, 0x71, 0x00, 0x35, 0xb1,
+  0x04, 0x65, 0x62, 0x6d, 0x6f, 0x00, 0x35, 0xb8, 0x01, 0x6f, 0x00, 0x35,
+  0xbf, 0x02, 0x75, 0x62, 0x00, 0x35, 0xc6, 0x01, 0x02, 0x01, 0x2e, 0x00,
+  0x35, 0xd2, 0x0a, 0x67, 0x62, 0x36, 0x33, 0x39, 0x6a, 0x34, 0x33, 0x75,
+  0x73, 0x00, 0x13, 0xaa, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x35, 0xfc, 0x01,
+  0x02, 0x01, 0x2e, 0x00, 0x28, 0xce, 0x01, 0x61, 0x00, 0x36, 0x21, 0x00,
+  0x01, 0x01, 0x73, 0x00, 0x25, 0xe3, 0x00, 0x01, 0x03, 0x32, 0x63, 0x6b,
+  0x00, 0x29, 0xb5, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x36, 0x28, 0x00, 0x02,
+  0x02, 0x38, 0x79, 0x00, 0x36, 0x51, 0x03, 0x61, 0x37, 0x6d, 0x00, 0x13,
+  0x6e, 0x01, 0x02, 0x01, 0x2e, 0x00, 0x2a, 0x17, 0x01, 0x6d, 0x00, 0x0c,
+  0x1d, 0x01, 0x07, 0x01, 0x2e, 0x00, 0x36, 0x59, 0x01, 0x61, 0x00, 0x2f,
+  0x47, 0x01, 0x65, 0x00, 0x16, 0x7b, 0x02, 0x69, 0x72, 0x00, 0x36, 0xa2,
+  0x01, 0x72, 0x00, 0x36, 0xa9, 0x01, 0x73, 0x00, 0x17, 0x57, 0x03, 0x74,
+  0x61, 0x77, 0x00, 0x35, 0x93, 0x00, 0x01, 0x01, 0x70, 0x00, 0x26, 0x0f,
+  0x00, 0x02, 0x03, 0x32, 0x6c, 0x70, 0x00, 0x1d, 0x23, 0x01, 0x6b, 0x00,
+  0x0e, 0x15, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x36, 0xb5, 0x01, 0x01, 0x01,
+  0x61, 0x00, 0x33, 0x22, 0x00, 0x01, 0x01, 0x63, 0x00, 0x36, 0xd0, 0x01,
+  0x01, 0x01, 0x2e, 0x00, 0x36, 0xd7, 0x01, 0x03, 0x01, 0x2e, 0x00, 0x37,
+  0x01, 0x01, 0x61, 0x00, 0x37, 0x2c, 0x01, 0x69, 0x00, 0x37, 0x38, 0x01,
+  0x05, 0x01, 0x2e, 0x00, 0x37, 0x49, 0x03, 0x69, 0x61, 0x66, 0x00, 0x2e,
+  0xfb, 0x04, 0x6c, 0x61, 0x65, 0x68, 0x00, 0x37, 0x75, 0x03, 0x6f, 0x72,
+  0x78, 0x00, 0x29, 0xdf, 0x02, 0x72, 0x61, 0x00, 0x37, 0x7e, 0x01, 0x01,
+  0x06, 0x2e, 0x6c, 0x6f, 0x70, 0x64, 0x72, 0x00, 0x22, 0x26, 0x00, 0x01,
+  0x01, 0x62, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x70, 0x00, 0x0b, 0x7d,
+  0x00, 0x01, 0x03, 0x61, 0x30, 0x6f, 0x00, 0x10, 0xce, 0x01, 0x05, 0x01,
+  0x2e, 0x00, 0x37, 0x8a, 0x01, 0x31, 0x00, 0x14, 0xed, 0x01, 0x62, 0x00,
+  0x37, 0xa5, 0x02, 0x64, 0x6e, 0x00, 0x37, 0xac, 0x02, 0x74, 0x6e, 0x00,
+  0x37, 0xb3, 0x01, 0x04, 0x01, 0x2e, 0x00, 0x37, 0xba, 0x04, 0x61, 0x68,
+  0x64, 0x75, 0x00, 0x37, 0xd5, 0x01, 0x6f, 0x00, 0x37, 0xdc, 0x01, 0x73,
+  0x00, 0x0e, 0x15, 0x01, 0x03, 0x01, 0x2e, 0x00, 0x37, 0xe3, 0x01, 0x63,
+  0x00, 0x38, 0x2f, 0x01, 0x74, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x01, 0x64,
+  0x00, 0x35, 0x0c, 0x01, 0x75, 0x00, 0x26, 0xd7, 0x00, 0x02, 0x02, 0x62,
+  0x68, 0x00, 0x16, 0xcd, 0x01, 0x70, 0x00, 0x38, 0x36, 0x01, 0x02, 0x01,
+  0x2e, 0x00, 0x38, 0x3d, 0x01, 0x6f, 0x00, 0x38, 0x94, 0x01, 0x01, 0x01,
+  0x2e, 0x00, 0x38, 0x9b, 0x00, 0x02, 0x01, 0x63, 0x00, 0x38, 0xb6, 0x01,
+  0x73, 0x00, 0x38, 0xc2, 0x00, 0x01, 0x01, 0x6f, 0x00, 0x38, 0xd2, 0x01,
+  0x06, 0x01, 0x2e, 0x00, 0x38, 0xd9, 0x03, 0x62, 0x34, 0x67, 0x00, 0x2b,
+  0xef, 0x01, 0x69, 0x00, 0x38, 0xfe, 0x01, 0x6e, 0x00, 0x39, 0x05, 0x01,
+  0x73, 0x00, 0x0e, 0x15, 0x01, 0x75, 0x00, 0x39, 0x0e, 0x01, 0x03, 0x01,
+  0x2e, 0x00, 0x39, 0x15, 0x04, 0x64, 0x72, 0x61, 0x68, 0x00, 0x15, 0x10,
+  0x03, 0x69, 0x61, 0x6d, 0x00, 0x39, 0x21, 0x00, 0x01, 0x01, 0x61, 0x00,
+  0x39, 0x28, 0x01, 0x04, 0x01, 0x2e, 0x00, 0x39, 0x2f, 0x04, 0x61, 0x69,
+  0x72, 0x70, 0x00, 0x2b, 0x7a, 0x01, 0x69, 0x00, 0x39, 0x63, 0x01, 0x72,
+  0x00, 0x1d, 0x34, 0x00, 0x01, 0x01, 0x72, 0x00, 0x39, 0x74, 0x01, 0x02,
+  0x01, 0x2e, 0x00, 0x39, 0x7b, 0x01, 0x65, 0x00, 0x1e, 0x60, 0x00, 0x03,
+  0x03, 0x61, 0x72, 0x65, 0x00, 0x39, 0x91, 0x01, 0x69, 0x00, 0x39, 0x98,
+  0x03, 0x72, 0x61, 0x68, 0x00, 0x15, 0x5e, 0x00, 0x01, 0x01, 0x74, 0x00,
+  0x0e, 0x15, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x39, 0xa5, 0x00, 0x01, 0x01,
+  0x69, 0x00, 0x35, 0x0c, 0x00, 0x02, 0x01, 0x72, 0x00, 0x0f, 0x68, 0x01,
+  0x74, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x66, 0x00, 0x0e, 0x15, 0x00,
+  0x01, 0x01, 0x67, 0x00, 0x2a, 0xfa, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x39,
+  0xc0, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x39, 0xfe, 0x00, 0x01, 0x01, 0x6a,
+  0x00, 0x0e, 0x15, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x3a, 0x2d, 0x00, 0x01,
+  0x01, 0x74, 0x00, 0x26, 0x0f, 0x00, 0x01, 0x01, 0x66, 0x00, 0x26, 0x0f,
+  0x00, 0x01, 0x01, 0x65, 0x00, 0x26, 0xde, 0x02, 0x05, 0x04, 0x2e, 0x77,
+  0x77, 0x77, 0x00, 0x3a, 0x66, 0x01, 0x61, 0x00, 0x3a, 0x68, 0x03, 0x65,
+  0x62, 0x64, 0x00, 0x3a, 0x76, 0x01, 0x69, 0x00, 0x3a, 0x7d, 0x01, 0x72,
+  0x00, 0x3a, 0x84, 0x01, 0x02, 0x01, 0x2e, 0x00, 0x3a, 0x8b, 0x01, 0x74,
+  0x00, 0x0e, 0x15, 0x00, 0x02, 0x01, 0x65, 0x00, 0x27, 0x0f, 0x02, 0x73,
+  0x61, 0x00, 0x3a, 0xb0, 0x01, 0x02, 0x01, 0x2e, 0x00, 0x3a, 0xb7, 0x01,
+  0x6e, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x02, 0x74, 0x73, 0x00, 0x17, 0x57,
+  0x01, 0x76, 0x00, 0x3b, 0x02, 0x01, 0x04, 0x01, 0x2e, 0x00, 0x3b, 0x09,
+  0x01, 0x61, 0x00, 0x16, 0x7b, 0x01, 0x63, 0x00, 0x1e, 0x60, 0x01, 0x69,
+  0x00, 0x27, 0x0f, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x3b, 0x4c, 0x00, 0x02,
+  0x02, 0x61, 0x62, 0x00, 0x3b, 0x71, 0x01, 0x69, 0x00, 0x3b, 0x8d, 0x00,
+  0x01, 0x01, 0x6f, 0x00, 0x15, 0x5e, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x3b,
+  0x99, 0x01, 0x01, 0x03, 0x74, 0x65, 0x6e, 0x00, 0x3b, 0xd7, 0x01, 0x01,
+  0x01, 0x2e, 0x00, 0x2d, 0x16, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x3b, 0xe4,
+  0x00, 0x01, 0x02, 0x72, 0x34, 0x00, 0x3c, 0x3a, 0x01, 0x09, 0x01, 0x2e,
+  0x00, 0x3c, 0x41, 0x01, 0x62, 0x00, 0x3c, 0x61, 0x01, 0x63, 0x00, 0x0e,
+  0x15, 0x01, 0x65, 0x00, 0x1e, 0x60, 0x01, 0x67, 0x00, 0x3c, 0x68, 0x01,
+  0x69, 0x00, 0x3c, 0x6f, 0x01, 0x6e, 0x00, 0x3c, 0x83, 0x01, 0x74, 0x00,
+  0x3c, 0x92, 0x04, 0x75, 0x74, 0x75, 0x6d, 0x00, 0x3c, 0xa3, 0x01, 0x01,
+  0x01, 0x2e, 0x00, 0x3c, 0xb1, 0x00, 0x01, 0x01, 0x69, 0x00, 0x26, 0xde,
+  0x00, 0x04, 0x02, 0x64, 0x61, 0x00, 0x3c, 0xcc, 0x01, 0x6e, 0x00, 0x3c,
+  0xd3, 0x01, 0x74, 0x00, 0x3c, 0xe2, 0x01, 0x76, 0x00, 0x3c, 0xee, 0x00,
+  0x03, 0x02, 0x38, 0x66, 0x00, 0x3c, 0xf5, 0x01, 0x61, 0x00, 0x0e, 0x15,
+  0x01, 0x6e, 0x00, 0x0e, 0x15, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x3d, 0x03,
+  0x00, 0x02, 0x01, 0x64, 0x00, 0x0e, 0x15, 0x01, 0x6f, 0x00, 0x0f, 0x68,
+  0x01, 0x04, 0x01, 0x2e, 0x00, 0x3d, 0x28, 0x01, 0x61, 0x00, 0x3d, 0x53,
+  0x01, 0x6d, 0x00, 0x0e, 0x15, 0x01, 0x72, 0x00, 0x0e, 0x15, 0x00, 0x04,
+  0x01, 0x61, 0x00, 0x3d, 0x5f, 0x01, 0x65, 0x00, 0x3d, 0x70, 0x06, 0x69,
+  0x68, 0x6d, 0x61, 0x69, 0x6c, 0x00, 0x3d, 0x7c, 0x01, 0x6a, 0x00, 0x0e,
+  0x15, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x3d, 0x83, 0x01, 0x02, 0x01, 0x2e,
+  0x00, 0x3d, 0xa3, 0x01, 0x6f, 0x00, 0x0e, 0x15, 0x00, 0x06, 0x01, 0x61,
+  0x00, 0x0e, 0x15, 0x01, 0x62, 0x00, 0x3d, 0xe0, 0x01, 0x6c, 0x00, 0x3d,
+  0xe7, 0x01, 0x6f, 0x00, 0x3d, 0xef, 0x01, 0x72, 0x00, 0x3d, 0xfb, 0x01,
+  0x75, 0x00, 0x0e, 0x15, 0x01, 0x02, 0x01, 0x2e, 0x00, 0x3e, 0x02, 0x01,
+  0x6c, 0x00, 0x0e, 0x15, 0x00, 0x03, 0x01, 0x61, 0x00, 0x27, 0x0f, 0x01,
+  0x66, 0x00, 0x0e, 0x15, 0x01, 0x73, 0x00, 0x0e, 0x15, 0x01, 0x01, 0x01,
+  0x2e, 0x00, 0x2c, 0x1e, 0x00, 0x01, 0x01, 0x74, 0x00, 0x39, 0x21, 0x00,
+  0x01, 0x01, 0x36, 0x00, 0x26, 0x0f, 0x00, 0x01, 0x01, 0x35, 0x00, 0x0b,
+  0xb4, 0x00, 0x01, 0x03, 0x71, 0x74, 0x78, 0x00, 0x33, 0x14, 0x00, 0x01,
+  0x01, 0x6a, 0x00, 0x26, 0x0f, 0x01, 0x06, 0x01, 0x2e, 0x00, 0x3e, 0x7d,
+  0x01, 0x63, 0x00, 0x3e, 0x9d, 0x01, 0x64, 0x00, 0x3e, 0xa4, 0x01, 0x65,
+  0x00, 0x3e, 0xad, 0x01, 0x66, 0x00, 0x3e, 0xb9, 0x01, 0x78, 0x00, 0x26,
+  0x1f, 0x01, 0x02, 0x01, 0x2e, 0x00, 0x2a, 0x17, 0x01, 0x69, 0x00, 0x0e,
+  0x15, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x3e, 0xc0, 0x01, 0x02, 0x01, 0x2e,
+  0x00, 0x3e, 0xd6, 0x01, 0x69, 0x00, 0x0e, 0x15, 0x01, 0x01, 0x08, 0x76,
+  0x75, 0x39, 0x36, 0x64, 0x38, 0x73, 0x79, 0x00, 0x0e, 0x55, 0x01, 0x03,
+  0x01, 0x2e, 0x00, 0x3e, 0xf7, 0x01, 0x6b, 0x00, 0x0e, 0x15, 0x03, 0x72,
+  0x62, 0x67, 0x00, 0x0b, 0xb4, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x3f, 0x17,
+  0x00, 0x02, 0x01, 0x69, 0x00, 0x16, 0x9c, 0x01, 0x6f, 0x00, 0x3f, 0x51,
+  0x01, 0x06, 0x01, 0x2e, 0x00, 0x3f, 0x5a, 0x01, 0x62, 0x00, 0x0e, 0x15,
+  0x01, 0x63, 0x00, 0x3f, 0x7f, 0x01, 0x6d, 0x00, 0x0e, 0x15, 0x01, 0x6f,
+  0x00, 0x1d, 0x1c, 0x01, 0x74, 0x00, 0x3f, 0x8b, 0x01, 0x01, 0x01, 0x2e,
+  0x00, 0x3f, 0x92, 0x01, 0x02, 0x02, 0x2e, 0x6a, 0x00, 0x3f, 0x9e, 0x01,
+  0x65, 0x00, 0x3f, 0xa5, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x3f, 0xac, 0x00,
+  0x02, 0x04, 0x65, 0x73, 0x75, 0x6d, 0x00, 0x3f, 0xd1, 0x01, 0x72, 0x00,
+  0x3f, 0xd8, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x3f, 0xdf, 0x00, 0x0c, 0x02,
+  0x62, 0x72, 0x00, 0x37, 0xa5, 0x05, 0x63, 0x69, 0x6c, 0x62, 0x75, 0x00,
+  0x40, 0x13, 0x01, 0x66, 0x00, 0x0e, 0x15, 0x05, 0x67, 0x72, 0x6f, 0x6d,
+  0x70, 0x00, 0x16, 0xb8, 0x02, 0x68, 0x6b, 0x00, 0x40, 0x1a, 0x04, 0x69,
+  0x64, 0x72, 0x61, 0x00, 0x38, 0x2f, 0x01, 0x6d, 0x00, 0x0e, 0x15, 0x01,
+  0x6f, 0x00, 0x26, 0xde, 0x01, 0x73, 0x00, 0x40, 0x21, 0x01, 0x75, 0x00,
+  0x40, 0x28, 0x01, 0x76, 0x00, 0x40, 0x35, 0x01, 0x79, 0x00, 0x40, 0x3c,
+  0x01, 0x02, 0x01, 0x2e, 0x00, 0x40, 0x43, 0x01, 0x63, 0x00, 0x0e, 0x15,
+  0x01, 0x02, 0x01, 0x2e, 0x00, 0x40, 0x63, 0x01, 0x62, 0x00, 0x0e, 0x15,
+  0x00, 0x02, 0x01, 0x67, 0x00, 0x40, 0xd3, 0x01, 0x6b, 0x00, 0x26, 0xd7,
+  0x00, 0x0b, 0x02, 0x64, 0x72, 0x00, 0x40, 0xdc, 0x01, 0x65, 0x00, 0x31,
+  0x67, 0x01, 0x66, 0x00, 0x40, 0xe3, 0x04, 0x67, 0x61, 0x77, 0x73, 0x00,
+  0x40, 0xea, 0x02, 0x68, 0x63, 0x00, 0x40, 0xf1, 0x01, 0x69, 0x00, 0x40,
+  0xf8, 0x01, 0x6d, 0x00, 0x0e, 0x15, 0x01, 0x70, 0x00, 0x41, 0x08, 0x01,
+  0x72, 0x00, 0x41, 0x0f, 0x02, 0x73, 0x69, 0x00, 0x29, 0xdf, 0x01, 0x76,
+  0x00, 0x25, 0x56, 0x01, 0x02, 0x01, 0x2e, 0x00, 0x41, 0x16, 0x02, 0x69,
+  0x73, 0x00, 0x41, 0x36, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x41, 0x43, 0x01,
+  0x09, 0x01, 0x2e, 0x00, 0x41, 0x68, 0x06, 0x65, 0x6c, 0x6b, 0x6e, 0x69,
+  0x76, 0x00, 0x41, 0xce, 0x01, 0x67, 0x00, 0x41, 0xd5, 0x01, 0x6b, 0x00,
+  0x27, 0x0f, 0x01, 0x6c, 0x00, 0x41, 0xdc, 0x01, 0x70, 0x00, 0x0e, 0x15,
+  0x01, 0x76, 0x00, 0x0e, 0x15, 0x01, 0x77, 0x00, 0x0e, 0x15, 0x01, 0x78,
+  0x00, 0x0e, 0x15, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x41, 0xe3, 0x00, 0x02,
+  0x01, 0x65, 0x00, 0x41, 0xf9, 0x02, 0x6f, 0x63, 0x00, 0x42, 0x00, 0x01,
+  0x01, 0x01, 0x2e, 0x00, 0x42, 0x07, 0x00, 0x0a, 0x01, 0x64, 0x00, 0x42,
+  0x1d, 0x01, 0x69, 0x00, 0x42, 0x24, 0x01, 0x6b, 0x00, 0x27, 0x25, 0x01,
+  0x6c, 0x00, 0x1c, 0x65, 0x01, 0x6d, 0x00, 0x42, 0x3c, 0x01, 0x6e, 0x00,
+  0x42, 0x43, 0x01, 0x70, 0x00, 0x42, 0x4a, 0x01, 0x73, 0x00, 0x42, 0x56,
+  0x01, 0x74, 0x00, 0x42, 0x69, 0x01, 0x7a, 0x00, 0x42, 0x75, 0x01, 0x02,
+  0x01, 0x2e, 0x00, 0x42, 0x7c, 0x01, 0x6b, 0x00, 0x0e, 0x15, 0x00, 0x02,
+  0x01, 0x65, 0x00, 0x42, 0x97, 0x02, 0x6f, 0x70, 0x00, 0x42, 0xa3, 0x01,
+  0x01, 0x01, 0x2e, 0x00, 0x42, 0xab, 0x01, 0x02, 0x01, 0x2e, 0x00, 0x42,
+  0xcb, 0x01, 0x6d, 0x00, 0x0e, 0x15, 0x00, 0x05, 0x01, 0x66, 0x00, 0x0e,
+  0x15, 0x01, 0x72, 0x00, 0x42, 0xfa, 0x01, 0x73, 0x00, 0x43, 0x01, 0x01,
+  0x78, 0x00, 0x43, 0x08, 0x01, 0x79, 0x00, 0x0e, 0x15, 0x01, 0x01, 0x01,
+  0x2e, 0x00, 0x43, 0x0f, 0x00, 0x02, 0x01, 0x72, 0x00, 0x0f, 0xfa, 0x01,
+  0x74, 0x00, 0x43, 0x43, 0x00, 0x01, 0x01, 0x79, 0x00, 0x26, 0x0f, 0x01,
+  0x02, 0x01, 0x2e, 0x00, 0x43, 0x4a, 0x02, 0x62, 0x6f, 0x00, 0x43, 0x6a,
+  0x01, 0x04, 0x01, 0x2e, 0x00, 0x43, 0x71, 0x01, 0x68, 0x00, 0x0e, 0x15,
+  0x01, 0x69, 0x00, 0x43, 0xb8, 0x01, 0x6f, 0x00, 0x43, 0xbf, 0x01, 0x06,
+  0x01, 0x2e, 0x00, 0x43, 0xc6, 0x01, 0x61, 0x00, 0x0e, 0x15, 0x01, 0x65,
+  0x00, 0x0e, 0x15, 0x01, 0x69, 0x00, 0x0f, 0x6f, 0x02, 0x6d, 0x61, 0x00,
+  0x44, 0x12, 0x01, 0x73, 0x00, 0x44, 0x19, 0x01, 0x04, 0x01, 0x2e, 0x00,
+  0x44, 0x26, 0x03, 0x61, 0x67, 0x6f, 0x00, 0x37, 0xd5, 0x01, 0x69, 0x00,
+  0x16, 0x9c, 0x04, 0x7a, 0x64, 0x37, 0x61, 0x00, 0x25, 0xeb, 0x00, 0x03,
+  0x01, 0x63, 0x00, 0x0e, 0x15, 0x01, 0x64, 0x00, 0x44, 0x50, 0x05, 0x6d,
+  0x6f, 0x72, 0x61, 0x66, 0x00, 0x26, 0x53, 0x01, 0x01, 0x02, 0x6e, 0x69,
+  0x00, 0x44, 0x5c, 0x00, 0x02, 0x01, 0x65, 0x00, 0x26, 0xde, 0x01, 0x6e,
+  0x00, 0x44, 0x63, 0x00, 0x01, 0x01, 0x68, 0x00, 0x35, 0x51, 0x01, 0x06,
+  0x01, 0x2e, 0x00, 0x44, 0x6f, 0x01, 0x62, 0x00, 0x0e, 0x15, 0x01, 0x64,
+  0x00, 0x44, 0xe5, 0x01, 0x6a, 0x00, 0x0e, 0x15, 0x01, 0x72, 0x00, 0x0e,
+  0x15, 0x02, 0x73, 0x79, 0x00, 0x44, 0xf1, 0x01, 0x01, 0x01, 0x2e, 0x00,
+  0x44, 0xf8, 0x00, 0x02, 0x01, 0x61, 0x00, 0x0c, 0x1d, 0x01, 0x6f, 0x00,
+  0x0e, 0x15, 0x01, 0x05, 0x01, 0x2e, 0x00, 0x2a, 0x17, 0x01, 0x67, 0x00,
+  0x0e, 0x15, 0x01, 0x69, 0x00, 0x26, 0xde, 0x01, 0x6d, 0x00, 0x2a, 0x10,
+  0x01, 0x6f, 0x00, 0x13, 0x4d, 0x01, 0x04, 0x01, 0x2e, 0x00, 0x45, 0x22,
+  0x01, 0x61, 0x00, 0x45, 0x93, 0x01, 0x69, 0x00, 0x45, 0x9a, 0x01, 0x75,
+  0x00, 0x0e, 0x15, 0x00, 0x06, 0x01, 0x62, 0x00, 0x0e, 0x15, 0x01, 0x66,
+  0x00, 0x0e, 0x15, 0x01, 0x67, 0x00, 0x0e, 0x15, 0x01, 0x68, 0x00, 0x45,
+  0xa6, 0x01, 0x6f, 0x00, 0x0e, 0x15, 0x01, 0x74, 0x00, 0x45, 0xad, 0x01,
+  0x03, 0x01, 0x2e, 0x00, 0x45, 0xb4, 0x01, 0x65, 0x00, 0x45, 0xe9, 0x01,
+  0x70, 0x00, 0x45, 0xfa, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x46, 0x01, 0x01,
+  0x04, 0x01, 0x2e, 0x00, 0x46, 0x26, 0x01, 0x6f, 0x00, 0x46, 0x5f, 0x01,
+  0x74, 0x00, 0x46, 0x75, 0x01, 0x75, 0x00, 0x26, 0xd7, 0x00, 0x02, 0x01,
+  0x69, 0x00, 0x27, 0xf5, 0x01, 0x6c, 0x00, 0x27, 0x33, 0x00, 0x01, 0x01,
+  0x61, 0x00, 0x27, 0x0f, 0x00, 0x01, 0x01, 0x6b, 0x00, 0x46, 0x7c, 0x00,
+  0x04, 0x01, 0x65, 0x00, 0x46, 0x83, 0x01, 0x67, 0x00, 0x0e, 0x15, 0x01,
+  0x6d, 0x00, 0x0e, 0x15, 0x01, 0x73, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01,
+  0x65, 0x00, 0x16, 0xb8, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x46, 0x8a, 0x00,
+  0x03, 0x01, 0x72, 0x00, 0x46, 0xaf, 0x01, 0x76, 0x00, 0x0e, 0x15, 0x01,
+  0x7a, 0x00, 0x0e, 0x15, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x46, 0xb7, 0x01,
+  0x01, 0x01, 0x2e, 0x00, 0x47, 0x31, 0x00, 0x02, 0x01, 0x65, 0x00, 0x21,
+  0x6d, 0x01, 0x6c, 0x00, 0x0e, 0x15, 0x01, 0x03, 0x01, 0x2e, 0x00, 0x47,
+  0x51, 0x01, 0x61, 0x00, 0x0f, 0xfa, 0x01, 0x6a, 0x00, 0x0e, 0x15, 0x02,
+  0x01, 0x01, 0x64, 0x00, 0x0e, 0x15, 0x00, 0x05, 0x01, 0x67, 0x00, 0x0e,
+  0x15, 0x01, 0x68, 0x00, 0x47, 0x58, 0x02, 0x6c, 0x6e, 0x00, 0x37, 0xa5,
+  0x01, 0x6f, 0x00, 0x0f, 0xfa, 0x01, 0x74, 0x00, 0x47, 0x64, 0x01, 0x01,
+  0x01, 0x2e, 0x00, 0x47, 0x6b, 0x00, 0x02, 0x01, 0x61, 0x00, 0x0e, 0x15,
+  0x01, 0x68, 0x00, 0x27, 0x0f, 0x00, 0x03, 0x01, 0x65, 0x00, 0x47, 0xc2,
+  0x01, 0x6c, 0x00, 0x47, 0xc9, 0x03, 0x6f, 0x72, 0x67, 0x00, 0x47, 0xd0,
+  0x00, 0x01, 0x01, 0x72, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x02, 0x62, 0x67,
+  0x00, 0x33, 0x14, 0x01, 0x01, 0x03, 0x33, 0x61, 0x39, 0x00, 0x1b, 0x10,
+  0x00, 0x01, 0x01, 0x65, 0x00, 0x0e, 0x15, 0x01, 0x08, 0x01, 0x2e, 0x00,
+  0x47, 0xea, 0x01, 0x34, 0x00, 0x33, 0x86, 0x01, 0x62, 0x00, 0x0e, 0x15,
+  0x01, 0x63, 0x00, 0x0e, 0x15, 0x03, 0x65, 0x79, 0x64, 0x00, 0x48, 0x1e,
+  0x01, 0x6c, 0x00, 0x48, 0x25, 0x01, 0x74, 0x00, 0x48, 0x2c, 0x02, 0x75,
+  0x67, 0x00, 0x48, 0x38, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x48, 0x3f, 0x01,
+  0x01, 0x01, 0x2e, 0x00, 0x48, 0xb5, 0x02, 0x11, 0x01, 0x62, 0x00, 0x43,
+  0xb8, 0x01, 0x63, 0x00, 0x48, 0xd5, 0x01, 0x64, 0x00, 0x30, 0x48, 0x01,
+  0x65, 0x00, 0x48, 0xdc, 0x03, 0x67, 0x6e, 0x69, 0x00, 0x48, 0xed, 0x01,
+  0x68, 0x00, 0x48, 0xfb, 0x01, 0x69, 0x00, 0x49, 0x0c, 0x01, 0x6b, 0x00,
+  0x49, 0x14, 0x01, 0x6c, 0x00, 0x49, 0x20, 0x01, 0x6d, 0x00, 0x29, 0x5f,
+  0x01, 0x6e, 0x00, 0x25, 0x56, 0x03, 0x70, 0x69, 0x6e, 0x00, 0x47, 0x51,
+  0x01, 0x74, 0x00, 0x49, 0x2f, 0x01, 0x76, 0x00, 0x49, 0x4a, 0x07, 0x77,
+  0x75, 0x6c, 0x6b, 0x73, 0x72, 0x65, 0x00, 0x49, 0x58, 0x02, 0x79, 0x77,
+  0x00, 0x29, 0x5f, 0x03, 0x7a, 0x69, 0x66, 0x00, 0x0f, 0x68, 0x01, 0x03,
+  0x01, 0x2e, 0x00, 0x49, 0x5f, 0x02, 0x61, 0x76, 0x00, 0x2a, 0xb1, 0x01,
+  0x73, 0x00, 0x0e, 0x15, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x49, 0xae, 0x01,
+  0x02, 0x01, 0x2e, 0x00, 0x49, 0xce, 0x01, 0x75, 0x00, 0x1d, 0x1c, 0x01,
+  0x04, 0x01, 0x2e, 0x00, 0x49, 0xe5, 0x01, 0x61, 0x00, 0x4a, 0x0f, 0x01,
+  0x65, 0x00, 0x35, 0x51, 0x01, 0x6c, 0x00, 0x16, 0x9c, 0x01, 0x02, 0x01,
+  0x2e, 0x00, 0x4a, 0x1b, 0x01, 0x63, 0x00, 0x4a, 0x66, 0x01, 0x01, 0x01,
+  0x2e, 0x00, 0x4a, 0x6d, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x38, 0xd9, 0x00,
+  0x03, 0x01, 0x68, 0x00, 0x4a, 0x79, 0x02, 0x6f, 0x64, 0x00, 0x49, 0x0c,
+  0x01, 0x74, 0x00, 0x4a, 0x80, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x4a, 0x8c,
+  0x01, 0x03, 0x01, 0x2e, 0x00, 0x4a, 0xc5, 0x01, 0x66, 0x00, 0x0e, 0x15,
+  0x01, 0x6d, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x61, 0x00, 0x1e, 0x60,
+  0x00, 0x01, 0x01, 0x64, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x71, 0x00,
+  0x4b, 0x1e, 0x01, 0x06, 0x01, 0x2e, 0x00, 0x2c, 0x1e, 0x07, 0x62, 0x69,
+  0x72, 0x61, 0x70, 0x70, 0x6e, 0x00, 0x15, 0x5e, 0x01, 0x67, 0x00, 0x4b,
+  0x25, 0x01, 0x6c, 0x00, 0x4b, 0x2c, 0x01, 0x6d, 0x00, 0x4b, 0x33, 0x01,
+  0x73, 0x00, 0x0e, 0x15, 0x01, 0x05, 0x01, 0x2e, 0x00, 0x4b, 0x3c, 0x01,
+  0x63, 0x00, 0x0e, 0x15, 0x01, 0x6f, 0x00, 0x16, 0xb8, 0x01, 0x73, 0x00,
+  0x0e, 0x15, 0x01, 0x75, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x01, 0x69, 0x00,
+  0x4b, 0x5c, 0x01, 0x6f, 0x00, 0x1e, 0x60, 0x00, 0x07, 0x01, 0x61, 0x00,
+  0x0e, 0x15, 0x01, 0x64, 0x00, 0x0e, 0x15, 0x01, 0x69, 0x00, 0x35, 0x0c,
+  0x01, 0x6c, 0x00, 0x0e, 0x15, 0x01, 0x6e, 0x00, 0x4b, 0x6d, 0x03, 0x6f,
+  0x6f, 0x67, 0x00, 0x4b, 0x7d, 0x01, 0x72, 0x00, 0x42, 0x43, 0x01, 0x0f,
+  0x01, 0x2e, 0x00, 0x4b, 0x84, 0x06, 0x63, 0x69, 0x76, 0x72, 0x65, 0x73,
+  0x00, 0x4b, 0xa0, 0x01, 0x64, 0x00, 0x4b, 0xa9, 0x01, 0x68, 0x00, 0x4b,
+  0xb7, 0x01, 0x69, 0x00, 0x4b, 0xc3, 0x02, 0x6a, 0x61, 0x00, 0x4b, 0xdd,
+  0x01, 0x6c, 0x00, 0x4b, 0xe4, 0x01, 0x6d, 0x00, 0x4c, 0x00, 0x01, 0x6e,
+  0x00, 0x4c, 0x11, 0x01, 0x6f, 0x00, 0x38, 0xd2, 0x01, 0x70, 0x00, 0x4c,
+  0x18, 0x01, 0x72, 0x00, 0x4c, 0x1f, 0x01, 0x73, 0x00, 0x4c, 0x2c, 0x04,
+  0x74, 0x61, 0x69, 0x63, 0x00, 0x4c, 0x38, 0x01, 0x76, 0x00, 0x4c, 0x3f,
+  0x01, 0x01, 0x03, 0x6e, 0x69, 0x64, 0x00, 0x4c, 0x46, 0x01, 0x05, 0x01,
+  0x2e, 0x00, 0x4c, 0x4d, 0x01, 0x61, 0x00, 0x4c, 0x71, 0x01, 0x6e, 0x00,
+  0x4c, 0x78, 0x01, 0x72, 0x00, 0x4c, 0x7f, 0x01, 0x74, 0x00, 0x4c, 0x86,
+  0x00, 0x03, 0x01, 0x63, 0x00, 0x4c, 0x8d, 0x03, 0x68, 0x78, 0x64, 0x00,
+  0x25, 0xe3, 0x01, 0x72, 0x00, 0x2c, 0xa2, 0x01, 0x06, 0x01, 0x2e, 0x00,
+  0x4c, 0x9a, 0x01, 0x61, 0x00, 0x4c, 0xc4, 0x01, 0x65, 0x00, 0x4c, 0xd0,
+  0x04, 0x6c, 0x61, 0x68, 0x73, 0x00, 0x4c, 0xde, 0x01, 0x6d, 0x00, 0x0e,
+  0x15, 0x01, 0x6f, 0x00, 0x46, 0x7c, 0x01, 0x04, 0x01, 0x2e, 0x00, 0x4c,
+  0xe5, 0x01, 0x62, 0x00, 0x0e, 0x15, 0x05, 0x65, 0x74, 0x73, 0x79, 0x73,
+  0x00, 0x4d, 0x0e, 0x01, 0x69, 0x00, 0x4d, 0x1e, 0x00, 0x04, 0x01, 0x61,
+  0x00, 0x4d, 0x25, 0x03, 0x65, 0x67, 0x61, 0x00, 0x4d, 0x36, 0x01, 0x69,
+  0x00, 0x4d, 0x3d, 0x01, 0x6f, 0x00, 0x4d, 0x49, 0x00, 0x05, 0x01, 0x64,
+  0x00, 0x4d, 0x56, 0x01, 0x67, 0x00, 0x4d, 0x5d, 0x03, 0x6c, 0x65, 0x75,
+  0x00, 0x27, 0xf5, 0x01, 0x70, 0x00, 0x4d, 0x64, 0x01, 0x74, 0x00, 0x4d,
+  0x6b, 0x01, 0x03, 0x01, 0x2e, 0x00, 0x4d, 0x79, 0x01, 0x69, 0x00, 0x4d,
+  0x9e, 0x01, 0x75, 0x00, 0x0e, 0x15, 0x01, 0x07, 0x01, 0x2e, 0x00, 0x4d,
+  0xb3, 0x01, 0x61, 0x00, 0x4d, 0xee, 0x01, 0x63, 0x00, 0x0e, 0x15, 0x01,
+  0x65, 0x00, 0x4e, 0x00, 0x02, 0x6f, 0x74, 0x00, 0x4e, 0x29, 0x01, 0x70,
+  0x00, 0x16, 0xb8, 0x01, 0x75, 0x00, 0x46, 0x7c, 0x01, 0x04, 0x01, 0x2e,
+  0x00, 0x4e, 0x39, 0x01, 0x61, 0x00, 0x43, 0xbf, 0x01, 0x65, 0x00, 0x4e,
+  0x63, 0x01, 0x69, 0x00, 0x4e, 0x75, 0x00, 0x06, 0x01, 0x61, 0x00, 0x4e,
+  0x7c, 0x02, 0x65, 0x6b, 0x00, 0x4e, 0x88, 0x01, 0x66, 0x00, 0x4c, 0x3f,
+  0x01, 0x68, 0x00, 0x4e, 0x94, 0x01, 0x6e, 0x00, 0x4e, 0xa0, 0x01, 0x72,
+  0x00, 0x4c, 0x7f, 0x01, 0x08, 0x01, 0x2e, 0x00, 0x4e, 0xad, 0x02, 0x61,
+  0x68, 0x00, 0x4f, 0x1a, 0x01, 0x62, 0x00, 0x2e, 0x67, 0x01, 0x63, 0x00,
+  0x46, 0x75, 0x01, 0x65, 0x00, 0x4f, 0x21, 0x04, 0x69, 0x6e, 0x65, 0x73,
+  0x00, 0x4f, 0x2d, 0x01, 0x6c, 0x00, 0x0f, 0x68, 0x02, 0x78, 0x65, 0x00,
+  0x4f, 0x34, 0x01, 0x04, 0x01, 0x2e, 0x00, 0x4f, 0x40, 0x01, 0x61, 0x00,
+  0x0e, 0x15, 0x01, 0x65, 0x00, 0x4f, 0x6f, 0x02, 0x6f, 0x64, 0x00, 0x4f,
+  0x7b, 0x00, 0x03, 0x01, 0x61, 0x00, 0x4f, 0x82, 0x01, 0x63, 0x00, 0x13,
+  0x33, 0x01, 0x6f, 0x00, 0x16, 0x7b, 0x01, 0x08, 0x01, 0x2e, 0x00, 0x4f,
+  0x89, 0x01, 0x63, 0x00, 0x0e, 0x15, 0x01, 0x65, 0x00, 0x35, 0x93, 0x01,
+  0x68, 0x00, 0x0f, 0xfa, 0x01, 0x69, 0x00, 0x16, 0x9c, 0x01, 0x6c, 0x00,
+  0x4f, 0xd3, 0x01, 0x6d, 0x00, 0x4f, 0xdc, 0x01, 0x72, 0x00, 0x4f, 0xe3,
+  0x01, 0x03, 0x01, 0x2e, 0x00, 0x2a, 0x17, 0x01, 0x62, 0x00, 0x0e, 0x15,
+  0x01, 0x67, 0x00, 0x26, 0xde, 0x00, 0x02, 0x01, 0x61, 0x00, 0x4f, 0xea,
+  0x01, 0x65, 0x00, 0x4f, 0xf1, 0x00, 0x01, 0x01, 0x68, 0x00, 0x4f, 0xff,
+  0x01, 0x0a, 0x01, 0x2e, 0x00, 0x50, 0x06, 0x01, 0x62, 0x00, 0x0e, 0x15,
+  0x01, 0x65, 0x00, 0x12, 0x22, 0x01, 0x67, 0x00, 0x50, 0x30, 0x01, 0x69,
+  0x00, 0x1e, 0x60, 0x01, 0x6b, 0x00, 0x50, 0x37, 0x01, 0x6e, 0x00, 0x50,
+  0x43, 0x01, 0x70, 0x00, 0x0e, 0x15, 0x02, 0x74, 0x63, 0x00, 0x29, 0xae,
+  0x01, 0x76, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x01, 0x69, 0x00, 0x0c, 0x1d,
+  0x03, 0x6f, 0x73, 0x6f, 0x00, 0x50, 0x4a, 0x01, 0x01, 0x01, 0x2e, 0x00,
+  0x50, 0x51, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x50, 0x80, 0x01, 0x06, 0x01,
+  0x2e, 0x00, 0x50, 0xb0, 0x01, 0x64, 0x00, 0x51, 0x1b, 0x01, 0x65, 0x00,
+  0x1d, 0x1c, 0x01, 0x66, 0x00, 0x0e, 0x15, 0x01, 0x6d, 0x00, 0x0e, 0x15,
+  0x01, 0x75, 0x00, 0x51, 0x22, 0x00, 0x01, 0x02, 0x61, 0x33, 0x00, 0x25,
+  0xdc, 0x00, 0x01, 0x01, 0x68, 0x00, 0x0e, 0x15, 0x01, 0x02, 0x01, 0x2e,
+  0x00, 0x4a, 0x6d, 0x01, 0x75, 0x00, 0x51, 0x29, 0x01, 0x01, 0x01, 0x2e,
+  0x00, 0x51, 0x30, 0x00, 0x05, 0x01, 0x61, 0x00, 0x51, 0x46, 0x01, 0x65,
+  0x00, 0x51, 0x5e, 0x01, 0x69, 0x00, 0x51, 0x6f, 0x02, 0x6f, 0x70, 0x00,
+  0x37, 0xa5, 0x01, 0x75, 0x00, 0x51, 0x82, 0x00, 0x08, 0x01, 0x62, 0x00,
+  0x0e, 0x15, 0x02, 0x63, 0x73, 0x00, 0x51, 0x8a, 0x01, 0x64, 0x00, 0x0e,
+  0x15, 0x01, 0x67, 0x00, 0x0e, 0x15, 0x01, 0x68, 0x00, 0x0e, 0x15, 0x01,
+  0x6a, 0x00, 0x0e, 0x15, 0x03, 0x6f, 0x66, 0x65, 0x00, 0x51, 0x91, 0x01,
+  0x70, 0x00, 0x51, 0x98, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x51, 0xa5, 0x00,
+  0x03, 0x01, 0x61, 0x00, 0x51, 0xd7, 0x01, 0x65, 0x00, 0x2c, 0x34, 0x02,
+  0x6f, 0x70, 0x00, 0x51, 0xde, 0x01, 0x06, 0x01, 0x2e, 0x00, 0x51, 0xf1,
+  0x01, 0x61, 0x00, 0x52, 0x20, 0x01, 0x65, 0x00, 0x52, 0x2c, 0x01, 0x69,
+  0x00, 0x52, 0x3d, 0x01, 0x6f, 0x00, 0x52, 0x49, 0x01, 0x75, 0x00, 0x52,
+  0x55, 0x01, 0x04, 0x01, 0x2e, 0x00, 0x52, 0x5c, 0x01, 0x61, 0x00, 0x52,
+  0x9a, 0x01, 0x6e, 0x00, 0x0e, 0x15, 0x01, 0x6f, 0x00, 0x52, 0xa1, 0x00,
+  0x01, 0x01, 0x6e, 0x00, 0x52, 0xae, 0x00, 0x01, 0x01, 0x65, 0x00, 0x0f,
+  0x6f, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x52, 0xb5, 0x00, 0x02, 0x03, 0x35,
+  0x74, 0x65, 0x00, 0x25, 0xce, 0x01, 0x79, 0x00, 0x52, 0xbc, 0x01, 0x02,
+  0x01, 0x2e, 0x00, 0x52, 0xc4, 0x01, 0x74, 0x00, 0x2a, 0x10, 0x01, 0x02,
+  0x01, 0x2e, 0x00, 0x53, 0x13, 0x01, 0x69, 0x00, 0x0e, 0x15, 0x00, 0x02,
+  0x01, 0x65, 0x00, 0x53, 0x33, 0x01, 0x69, 0x00, 0x53, 0x44, 0x01, 0x01,
+  0x01, 0x2e, 0x00, 0x53, 0x4b, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x53, 0x77,
+  0x01, 0x03, 0x01, 0x2e, 0x00, 0x53, 0x9c, 0x01, 0x6f, 0x00, 0x27, 0x0f,
+  0x01, 0x73, 0x00, 0x4c, 0x11, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x54, 0x02,
+  0x01, 0x01, 0x01, 0x2e, 0x00, 0x54, 0x0e, 0x01, 0x02, 0x01, 0x2e, 0x00,
+  0x54, 0x33, 0x02, 0x65, 0x6d, 0x00, 0x2a, 0x45, 0x00, 0x02, 0x02, 0x67,
+  0x67, 0x00, 0x54, 0x52, 0x01, 0x79, 0x00, 0x54, 0x59, 0x01, 0x04, 0x01,
+  0x2e, 0x00, 0x54, 0x60, 0x01, 0x6d, 0x00, 0x54, 0xdc, 0x01, 0x70, 0x00,
+  0x0e, 0x15, 0x01, 0x75, 0x00, 0x0c, 0x1d, 0x01, 0x02, 0x01, 0x2e, 0x00,
+  0x54, 0xe3, 0x01, 0x74, 0x00, 0x55, 0x31, 0x01, 0x01, 0x01, 0x2e, 0x00,
+  0x55, 0x3d, 0x00, 0x01, 0x01, 0x75, 0x00, 0x55, 0x62, 0x01, 0x01, 0x01,
+  0x2e, 0x00, 0x55, 0x69, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x55, 0x84, 0x01,
+  0x01, 0x01, 0x2e, 0x00, 0x55, 0xdb, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x56,
+  0x0a, 0x00, 0x02, 0x01, 0x67, 0x00, 0x0e, 0x15, 0x01, 0x6d, 0x00, 0x0e,
+  0x15, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x56, 0x3e, 0x01, 0x05, 0x01, 0x2e,
+  0x00, 0x56, 0x59, 0x01, 0x64, 0x00, 0x0e, 0x15, 0x01, 0x67, 0x00, 0x21,
+  0x6d, 0x01, 0x69, 0x00, 0x0e, 0x15, 0x01, 0x77, 0x00, 0x56, 0x74, 0x00,
+  0x01, 0x01, 0x76, 0x00, 0x26, 0x0f, 0x01, 0x03, 0x01, 0x2e, 0x00, 0x2b,
+  0x46, 0x01, 0x68, 0x00, 0x27, 0x0f, 0x01, 0x6c, 0x00, 0x0e, 0x15, 0x01,
+  0x01, 0x01, 0x2e, 0x00, 0x56, 0x7b, 0x01, 0x02, 0x01, 0x2e, 0x00, 0x56,
+  0x87, 0x01, 0x63, 0x00, 0x0f, 0x68, 0x00, 0x03, 0x04, 0x69, 0x76, 0x65,
+  0x72, 0x00, 0x2e, 0xfb, 0x01, 0x6e, 0x00, 0x0e, 0x15, 0x01, 0x73, 0x00,
+  0x0e, 0x15, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x56, 0x9d, 0x01, 0x02, 0x01,
+  0x2e, 0x00, 0x56, 0xc2, 0x01, 0x62, 0x00, 0x0e, 0x15, 0x00, 0x04, 0x01,
+  0x63, 0x00, 0x56, 0xf1, 0x01, 0x68, 0x00, 0x35, 0x93, 0x01, 0x6e, 0x00,
+  0x0e, 0x15, 0x01, 0x77, 0x00, 0x0e, 0x15, 0x01, 0x01, 0x01, 0x2e, 0x00,
+  0x56, 0xf8, 0x01, 0x02, 0x01, 0x2e, 0x00, 0x57, 0x20, 0x01, 0x6e, 0x00,
+  0x0e, 0x15, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x57, 0x45, 0x01, 0x01, 0x01,
+  0x2e, 0x00, 0x57, 0x7e, 0x01, 0x02, 0x01, 0x2e, 0x00, 0x57, 0x99, 0x01,
+  0x74, 0x00, 0x0e, 0x15, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x57, 0xbe, 0x00,
+  0x04, 0x01, 0x64, 0x00, 0x57, 0xcf, 0x02, 0x6d, 0x61, 0x00, 0x57, 0xdb,
+  0x01, 0x72, 0x00, 0x3f, 0xd8, 0x01, 0x73, 0x00, 0x0e, 0x15, 0x00, 0x01,
+  0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x03, 0x01, 0x2e, 0x00, 0x57, 0xe2,
+  0x01, 0x67, 0x00, 0x0e, 0x15, 0x05, 0x6d, 0x61, 0x32, 0x69, 0x62, 0x00,
+  0x57, 0xfd, 0x00, 0x03, 0x01, 0x62, 0x00, 0x58, 0x04, 0x01, 0x66, 0x00,
+  0x0e, 0x15, 0x01, 0x72, 0x00, 0x58, 0x0b, 0x00, 0x02, 0x02, 0x61, 0x6d,
+  0x00, 0x58, 0x12, 0x01, 0x78, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x6e,
+  0x00, 0x58, 0x1e, 0x00, 0x07, 0x01, 0x64, 0x00, 0x58, 0x25, 0x01, 0x67,
+  0x00, 0x0e, 0x15, 0x01, 0x6c, 0x00, 0x0f, 0x68, 0x01, 0x70, 0x00, 0x58,
+  0x32, 0x01, 0x72, 0x00, 0x46, 0x7c, 0x01, 0x73, 0x00, 0x40, 0x21, 0x01,
+  0x77, 0x00, 0x58, 0x39, 0x01, 0x03, 0x01, 0x2e, 0x00, 0x58, 0x41, 0x01,
+  0x61, 0x00, 0x15, 0x5e, 0x01, 0x67, 0x00, 0x58, 0x64, 0x01, 0x03, 0x01,
+  0x2e, 0x00, 0x58, 0x6b, 0x01, 0x61, 0x00, 0x58, 0x9f, 0x01, 0x6e, 0x00,
+  0x58, 0xa8, 0x00, 0x02, 0x03, 0x64, 0x61, 0x64, 0x00, 0x58, 0xaf, 0x01,
+  0x75, 0x00, 0x26, 0xc4, 0x00, 0x04, 0x02, 0x6b, 0x63, 0x00, 0x32, 0x5a,
+  0x02, 0x6c, 0x74, 0x00, 0x58, 0xb6, 0x01, 0x6e, 0x00, 0x58, 0xbd, 0x04,
+  0x73, 0x6e, 0x69, 0x6b, 0x00, 0x58, 0xd0, 0x01, 0x03, 0x01, 0x2e, 0x00,
+  0x58, 0xd7, 0x08, 0x6f, 0x6c, 0x6f, 0x6e, 0x68, 0x63, 0x65, 0x74, 0x00,
+  0x58, 0xfc, 0x01, 0x72, 0x00, 0x59, 0x03, 0x00, 0x01, 0x06, 0x70, 0x61,
+  0x72, 0x67, 0x6f, 0x74, 0x00, 0x59, 0x0a, 0x01, 0x02, 0x01, 0x2e, 0x00,
+  0x56, 0x87, 0x01, 0x73, 0x00, 0x0e, 0x15, 0x01, 0x05, 0x01, 0x2e, 0x00,
+  0x59, 0x11, 0x01, 0x66, 0x00, 0x0e, 0x15, 0x04, 0x69, 0x6d, 0x61, 0x66,
+  0x00, 0x59, 0x3b, 0x01, 0x6c, 0x00, 0x59, 0x42, 0x01, 0x70, 0x00, 0x59,
+  0x4e, 0x01, 0x03, 0x01, 0x2e, 0x00, 0x59, 0x55, 0x05, 0x65, 0x64, 0x61,
+  0x63, 0x61, 0x00, 0x59, 0x7f, 0x01, 0x72, 0x00, 0x26, 0xd7, 0x00, 0x02,
+  0x01, 0x61, 0x00, 0x59, 0x88, 0x01, 0x6f, 0x00, 0x27, 0x0f, 0x01, 0x01,
+  0x01, 0x2e, 0x00, 0x59, 0x95, 0x00, 0x05, 0x01, 0x65, 0x00, 0x59, 0xba,
+  0x01, 0x6c, 0x00, 0x59, 0xd1, 0x01, 0x6f, 0x00, 0x59, 0xd8, 0x01, 0x74,
+  0x00, 0x59, 0xe2, 0x01, 0x75, 0x00, 0x59, 0xe9, 0x01, 0x02, 0x01, 0x2e,
+  0x00, 0x32, 0xf4, 0x01, 0x70, 0x00, 0x17, 0xbd, 0x00, 0x05, 0x01, 0x65,
+  0x00, 0x59, 0xf0, 0x01, 0x69, 0x00, 0x59, 0xf7, 0x01, 0x6c, 0x00, 0x5a,
+  0x14, 0x01, 0x72, 0x00, 0x5a, 0x1b, 0x01, 0x75, 0x00, 0x5a, 0x29, 0x01,
+  0x02, 0x01, 0x2e, 0x00, 0x5a, 0x30, 0x01, 0x62, 0x00, 0x5a, 0x50, 0x01,
+  0x01, 0x01, 0x64, 0x00, 0x5a, 0x57, 0x00, 0x01, 0x01, 0x65, 0x00, 0x27,
+  0x0f, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x5a, 0x5e, 0x01, 0x01, 0x01, 0x2e,
+  0x00, 0x5a, 0x92, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x5a, 0xb7, 0x01, 0x01,
+  0x01, 0x2e, 0x00, 0x5a, 0xdc, 0x01, 0x02, 0x01, 0x2e, 0x00, 0x5b, 0x06,
+  0x01, 0x67, 0x00, 0x0e, 0x15, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x5b, 0x49,
+  0x01, 0x01, 0x01, 0x2e, 0x00, 0x5b, 0x6e, 0x01, 0x02, 0x01, 0x2e, 0x00,
+  0x5b, 0x93, 0x01, 0x61, 0x00, 0x5b, 0xcb, 0x00, 0x01, 0x01, 0x77, 0x00,
+  0x20, 0xed, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x5b, 0xd5, 0x01, 0x01, 0x01,
+  0x2e, 0x00, 0x5b, 0xe6, 0x01, 0x02, 0x01, 0x2e, 0x00, 0x5c, 0x0b, 0x01,
+  0x72, 0x00, 0x5c, 0x21, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x5c, 0x28, 0x00,
+  0x01, 0x01, 0x75, 0x00, 0x15, 0x5e, 0x00, 0x01, 0x01, 0x39, 0x00, 0x26,
+  0x0f, 0x00, 0x01, 0x01, 0x6a, 0x00, 0x16, 0xcd, 0x00, 0x01, 0x01, 0x61,
+  0x00, 0x1d, 0x23, 0x00, 0x01, 0x02, 0x61, 0x30, 0x00, 0x26, 0x08, 0x00,
+  0x01, 0x01, 0x63, 0x00, 0x1d, 0x23, 0x00, 0x01, 0x01, 0x62, 0x00, 0x1d,
+  0x23, 0x00, 0x01, 0x02, 0x62, 0x64, 0x00, 0x25, 0xce, 0x00, 0x01, 0x01,
+  0x31, 0x00, 0x26, 0x0f, 0x00, 0x01, 0x01, 0x38, 0x00, 0x26, 0x0f, 0x00,
+  0x01, 0x03, 0x2d, 0x2d, 0x6e, 0x00, 0x5c, 0x48, 0x00, 0x01, 0x01, 0x66,
+  0x00, 0x28, 0x74, 0x00, 0x01, 0x01, 0x71, 0x00, 0x26, 0x0f, 0x00, 0x01,
+  0x02, 0x62, 0x67, 0x00, 0x3c, 0x3a, 0x00, 0x07, 0x01, 0x67, 0x00, 0x5c,
+  0x4f, 0x01, 0x6c, 0x00, 0x39, 0x28, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01,
+  0x73, 0x00, 0x1d, 0x1c, 0x01, 0x74, 0x00, 0x5c, 0x56, 0x01, 0x75, 0x00,
+  0x27, 0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x00, 0x01, 0x01, 0x6c, 0x00,
+  0x26, 0xd7, 0x00, 0x01, 0x01, 0x73, 0x00, 0x46, 0x7c, 0x00, 0x0e, 0x01,
+  0x62, 0x00, 0x5c, 0x62, 0x01, 0x63, 0x00, 0x5c, 0x73, 0x01, 0x65, 0x00,
+  0x0f, 0x68, 0x01, 0x66, 0x00, 0x0f, 0x6f, 0x01, 0x6b, 0x00, 0x5c, 0x84,
+  0x01, 0x6c, 0x00, 0x0f, 0x6f, 0x01, 0x6e, 0x00, 0x41, 0x08, 0x01, 0x6f,
+  0x00, 0x0f, 0xfa, 0x01, 0x70, 0x00, 0x5c, 0x90, 0x01, 0x73, 0x00, 0x0f,
+  0x6f, 0x01, 0x74, 0x00, 0x5c, 0x9d, 0x01, 0x75, 0x00, 0x0f, 0x6f, 0x04,
+  0x76, 0x65, 0x64, 0x77, 0x00, 0x5c, 0xa9, 0x01, 0x79, 0x00, 0x5c, 0xb0,
+  0x00, 0x03, 0x01, 0x6d, 0x00, 0x26, 0xd7, 0x01, 0x72, 0x00, 0x5c, 0xb7,
+  0x01, 0x73, 0x00, 0x5c, 0xc5, 0x00, 0x01, 0x01, 0x76, 0x00, 0x26, 0xd7,
+  0x00, 0x01, 0x01, 0x74, 0x00, 0x27, 0x0f, 0x00, 0x02, 0x01, 0x65, 0x00,
+  0x3d, 0xfb, 0x01, 0x6f, 0x00, 0x21, 0x6d, 0x00, 0x01, 0x01, 0x61, 0x00,
+  0x0e, 0x15, 0x00, 0x01, 0x01, 0x6c, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01,
+  0x6d, 0x00, 0x41, 0x08, 0x00, 0x01, 0x01, 0x69, 0x00, 0x5c, 0xcc, 0x00,
+  0x01, 0x01, 0x79, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x69, 0x00, 0x38,
+  0xd2, 0x00, 0x01, 0x01, 0x6e, 0x00, 0x29, 0x5f, 0x01, 0x01, 0x01, 0x2e,
+  0x00, 0x5c, 0xd3, 0x00, 0x01, 0x01, 0x73, 0x00, 0x0e, 0x15, 0x01, 0x01,
+  0x01, 0x6f, 0x00, 0x0f, 0x6f, 0x01, 0x01, 0x02, 0x2e, 0x73, 0x00, 0x5c,
+  0xdc, 0x00, 0x01, 0x01, 0x69, 0x00, 0x0f, 0x6f, 0x00, 0x01, 0x01, 0x73,
+  0x00, 0x41, 0x08, 0x00, 0x01, 0x01, 0x6f, 0x00, 0x27, 0xf5, 0x00, 0x01,
+  0x01, 0x64, 0x00, 0x1d, 0x34, 0x00, 0x01, 0x01, 0x73, 0x00, 0x5c, 0xe3,
+  0x00, 0x08, 0x01, 0x63, 0x00, 0x0e, 0x15, 0x01, 0x67, 0x00, 0x5c, 0x4f,
+  0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x6f, 0x00, 0x5c, 0xea, 0x01, 0x72,
+  0x00, 0x5c, 0xf1, 0x01, 0x74, 0x00, 0x5c, 0xfd, 0x01, 0x75, 0x00, 0x27,
+  0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x00, 0x01, 0x01, 0x61, 0x00, 0x38,
+  0xd2, 0x00, 0x02, 0x04, 0x6e, 0x69, 0x73, 0x69, 0x00, 0x5d, 0x09, 0x04,
+  0x72, 0x62, 0x6d, 0x75, 0x00, 0x5d, 0x10, 0x00, 0x06, 0x01, 0x63, 0x00,
+  0x26, 0xd7, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6f, 0x00, 0x0f, 0xfa,
+  0x01, 0x73, 0x00, 0x5d, 0x17, 0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x76,
+  0x00, 0x58, 0xaf, 0x00, 0x01, 0x01, 0x6f, 0x00, 0x5d, 0x1e, 0x00, 0x0d,
+  0x01, 0x61, 0x00, 0x0f, 0xfa, 0x01, 0x63, 0x00, 0x0f, 0xfa, 0x01, 0x65,
+  0x00, 0x5d, 0x25, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x69, 0x00, 0x5d,
+  0x2c, 0x01, 0x6c, 0x00, 0x5d, 0x33, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01,
+  0x6e, 0x00, 0x2a, 0x10, 0x01, 0x6f, 0x00, 0x5d, 0x3a, 0x01, 0x72, 0x00,
+  0x5d, 0x4b, 0x01, 0x73, 0x00, 0x5d, 0x57, 0x01, 0x76, 0x00, 0x16, 0x7b,
+  0x01, 0x78, 0x00, 0x12, 0x22, 0x00, 0x01, 0x01, 0x76, 0x00, 0x0e, 0x15,
+  0x00, 0x01, 0x02, 0x6c, 0x65, 0x00, 0x5d, 0x63, 0x00, 0x01, 0x01, 0x65,
+  0x00, 0x26, 0xd7, 0x00, 0x08, 0x01, 0x62, 0x00, 0x58, 0xaf, 0x01, 0x63,
+  0x00, 0x26, 0xd7, 0x01, 0x64, 0x00, 0x5d, 0x6a, 0x01, 0x67, 0x00, 0x5d,
+  0x76, 0x01, 0x6d, 0x00, 0x5d, 0x82, 0x01, 0x6f, 0x00, 0x37, 0xd5, 0x01,
+  0x74, 0x00, 0x22, 0x26, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x01, 0x01,
+  0x2e, 0x00, 0x5d, 0x89, 0x00, 0x08, 0x01, 0x65, 0x00, 0x5d, 0x25, 0x01,
+  0x67, 0x00, 0x5c, 0x4f, 0x01, 0x68, 0x00, 0x4f, 0xff, 0x01, 0x6c, 0x00,
+  0x39, 0x28, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x74, 0x00, 0x5c, 0x56,
+  0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x00, 0x01,
+  0x01, 0x7a, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x6d, 0x00, 0x42, 0x43,
+  0x00, 0x01, 0x01, 0x34, 0x00, 0x21, 0x65, 0x01, 0x01, 0x0a, 0x64, 0x35,
+  0x75, 0x68, 0x66, 0x38, 0x6c, 0x65, 0x35, 0x38, 0x00, 0x17, 0x7c, 0x00,
+  0x02, 0x01, 0x6b, 0x00, 0x1c, 0x65, 0x01, 0x74, 0x00, 0x29, 0x66, 0x00,
+  0x08, 0x01, 0x62, 0x00, 0x5d, 0xae, 0x01, 0x64, 0x00, 0x5d, 0xb5, 0x01,
+  0x67, 0x00, 0x5c, 0x4f, 0x01, 0x68, 0x00, 0x4f, 0xff, 0x01, 0x6d, 0x00,
+  0x2f, 0x47, 0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x75, 0x00, 0x27, 0x3a,
+  0x01, 0x76, 0x00, 0x58, 0xaf, 0x01, 0x01, 0x07, 0x2e, 0x75, 0x62, 0x61,
+  0x6e, 0x2e, 0x69, 0x00, 0x5d, 0xbc, 0x00, 0x01, 0x01, 0x74, 0x00, 0x26,
+  0xd7, 0x00, 0x01, 0x01, 0x65, 0x00, 0x1e, 0x60, 0x00, 0x01, 0x01, 0x79,
+  0x00, 0x46, 0x7c, 0x00, 0x17, 0x01, 0x61, 0x00, 0x5d, 0xc3, 0x01, 0x62,
+  0x00, 0x27, 0x0f, 0x01, 0x63, 0x00, 0x0f, 0xfa, 0x01, 0x64, 0x00, 0x5d,
+  0xe7, 0x01, 0x65, 0x00, 0x5d, 0xfd, 0x01, 0x66, 0x00, 0x5e, 0x0f, 0x01,
+  0x67, 0x00, 0x5e, 0x1b, 0x01, 0x68, 0x00, 0x35, 0x0c, 0x01, 0x69, 0x00,
+  0x5e, 0x27, 0x01, 0x6b, 0x00, 0x5e, 0x39, 0x01, 0x6c, 0x00, 0x5e, 0x4a,
+  0x01, 0x6d, 0x00, 0x5e, 0x63, 0x01, 0x6e, 0x00, 0x5e, 0x79, 0x01, 0x6f,
+  0x00, 0x5e, 0x9c, 0x01, 0x70, 0x00, 0x5e, 0xa8, 0x01, 0x72, 0x00, 0x5e,
+  0xb9, 0x01, 0x73, 0x00, 0x35, 0x0c, 0x01, 0x74, 0x00, 0x5e, 0xd7, 0x01,
+  0x75, 0x00, 0x27, 0x3a, 0x01, 0x76, 0x00, 0x5e, 0xe8, 0x01, 0x78, 0x00,
+  0x0f, 0xfa, 0x01, 0x79, 0x00, 0x5f, 0x0d, 0x01, 0x7a, 0x00, 0x5f, 0x22,
+  0x00, 0x01, 0x01, 0x6b, 0x00, 0x41, 0x08, 0x00, 0x01, 0x01, 0x61, 0x00,
+  0x26, 0xde, 0x00, 0x01, 0x01, 0x61, 0x00, 0x0f, 0x6f, 0x00, 0x0c, 0x01,
+  0x62, 0x00, 0x43, 0xb8, 0x01, 0x63, 0x00, 0x5f, 0x2e, 0x01, 0x67, 0x00,
+  0x5c, 0x4f, 0x01, 0x6c, 0x00, 0x5f, 0x3a, 0x01, 0x6d, 0x00, 0x5f, 0x46,
+  0x01, 0x6f, 0x00, 0x5f, 0x52, 0x04, 0x72, 0x61, 0x64, 0x6e, 0x00, 0x5f,
+  0x5e, 0x01, 0x73, 0x00, 0x27, 0x25, 0x01, 0x74, 0x00, 0x5f, 0x65, 0x01,
+  0x75, 0x00, 0x27, 0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x01, 0x77, 0x00,
+  0x29, 0x5f, 0x00, 0x01, 0x01, 0x69, 0x00, 0x0f, 0x68, 0x00, 0x01, 0x01,
+  0x78, 0x00, 0x26, 0x0f, 0x00, 0x01, 0x01, 0x63, 0x00, 0x26, 0x01, 0x00,
+  0x01, 0x02, 0x6b, 0x63, 0x00, 0x2b, 0xef, 0x00, 0x01, 0x01, 0x61, 0x00,
+  0x33, 0x29, 0x00, 0x02, 0x02, 0x31, 0x72, 0x00, 0x5f, 0x71, 0x01, 0x71,
+  0x00, 0x4b, 0x1e, 0x00, 0x01, 0x01, 0x65, 0x00, 0x1d, 0x1c, 0x00, 0x08,
+  0x01, 0x65, 0x00, 0x3f, 0x9e, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6d,
+  0x00, 0x2f, 0x47, 0x01, 0x6f, 0x00, 0x5f, 0x78, 0x01, 0x74, 0x00, 0x22,
+  0x26, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x76, 0x00, 0x5f, 0x84, 0x01,
+  0x7a, 0x00, 0x5f, 0x90, 0x00, 0x01, 0x01, 0x69, 0x00, 0x0e, 0x15, 0x00,
+  0x05, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01,
+  0x74, 0x00, 0x22, 0x26, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x76, 0x00,
+  0x58, 0xaf, 0x00, 0x01, 0x01, 0x65, 0x00, 0x23, 0x27, 0x01, 0x02, 0x01,
+  0x2e, 0x00, 0x5f, 0x97, 0x01, 0x73, 0x00, 0x5f, 0xa8, 0x01, 0x01, 0x01,
+  0x2e, 0x00, 0x5f, 0xaf, 0x00, 0x01, 0x01, 0x6b, 0x00, 0x33, 0x14, 0x00,
+  0x01, 0x01, 0x62, 0x00, 0x26, 0x0f, 0x00, 0x01, 0x03, 0x72, 0x62, 0x32,
+  0x00, 0x10, 0xd5, 0x00, 0x03, 0x01, 0x32, 0x00, 0x10, 0xd5, 0x01, 0x35,
+  0x00, 0x0b, 0xb4, 0x01, 0x39, 0x00, 0x33, 0x7f, 0x00, 0x03, 0x01, 0x65,
+  0x00, 0x12, 0xf0, 0x01, 0x68, 0x00, 0x10, 0xdc, 0x01, 0x73, 0x00, 0x5f,
+  0xb6, 0x00, 0x07, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6c, 0x00, 0x39,
+  0x28, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x72, 0x00, 0x5f, 0xbd, 0x01,
+  0x74, 0x00, 0x22, 0x26, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x76, 0x00,
+  0x58, 0xaf, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x5f, 0xc4, 0x00, 0x01, 0x05,
+  0x63, 0x37, 0x79, 0x6c, 0x71, 0x00, 0x1d, 0x23, 0x00, 0x07, 0x0b, 0x65,
+  0x75, 0x67, 0x61, 0x65, 0x6c, 0x79, 0x73, 0x61, 0x74, 0x6e, 0x00, 0x5f,
+  0xdf, 0x03, 0x67, 0x6e, 0x69, 0x00, 0x5f, 0xe6, 0x02, 0x6c, 0x69, 0x00,
+  0x5f, 0xef, 0x08, 0x6e, 0x77, 0x61, 0x70, 0x73, 0x2e, 0x73, 0x65, 0x00,
+  0x5f, 0xf6, 0x06, 0x72, 0x65, 0x76, 0x72, 0x65, 0x73, 0x00, 0x5f, 0xfd,
+  0x01, 0x73, 0x00, 0x60, 0x05, 0x01, 0x78, 0x00, 0x60, 0x1f, 0x00, 0x01,
+  0x01, 0x6c, 0x00, 0x26, 0x0f, 0x00, 0x0c, 0x01, 0x32, 0x00, 0x60, 0x26,
+  0x01, 0x62, 0x00, 0x58, 0xaf, 0x01, 0x64, 0x00, 0x5d, 0xb5, 0x01, 0x65,
+  0x00, 0x60, 0x2d, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6c, 0x00, 0x60,
+  0x34, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x6e, 0x00, 0x60, 0x40, 0x01,
+  0x6f, 0x00, 0x60, 0x47, 0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x75, 0x00,
+  0x27, 0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x00, 0x01, 0x01, 0x65, 0x00,
+  0x60, 0x53, 0x00, 0x01, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x00, 0x02, 0x08,
+  0x62, 0x75, 0x70, 0x65, 0x72, 0x61, 0x6e, 0x61, 0x00, 0x60, 0x5a, 0x01,
+  0x6f, 0x00, 0x60, 0x61, 0x00, 0x03, 0x01, 0x61, 0x00, 0x52, 0xb5, 0x01,
+  0x69, 0x00, 0x3a, 0x7d, 0x03, 0x6f, 0x73, 0x61, 0x00, 0x60, 0x68, 0x00,
+  0x01, 0x01, 0x75, 0x00, 0x12, 0x22, 0x00, 0x01, 0x01, 0x69, 0x00, 0x0f,
+  0xfa, 0x00, 0x07, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6d, 0x00, 0x2f,
+  0x47, 0x01, 0x6f, 0x00, 0x0f, 0xfa, 0x01, 0x74, 0x00, 0x22, 0x26, 0x01,
+  0x75, 0x00, 0x27, 0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x01, 0x79, 0x00,
+  0x41, 0x08, 0x00, 0x02, 0x01, 0x6d, 0x00, 0x16, 0x7b, 0x01, 0x6f, 0x00,
+  0x60, 0x6f, 0x00, 0x02, 0x01, 0x6d, 0x00, 0x56, 0x74, 0x01, 0x6f, 0x00,
+  0x60, 0x6f, 0x00, 0x02, 0x01, 0x65, 0x00, 0x60, 0x76, 0x01, 0x68, 0x00,
+  0x0f, 0xfa, 0x00, 0x07, 0x01, 0x65, 0x00, 0x60, 0x82, 0x01, 0x67, 0x00,
+  0x5c, 0x4f, 0x01, 0x6c, 0x00, 0x39, 0x28, 0x01, 0x6d, 0x00, 0x2f, 0x47,
+  0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x76,
+  0x00, 0x60, 0x89, 0x00, 0x01, 0x01, 0x63, 0x00, 0x26, 0x0f, 0x00, 0x02,
+  0x03, 0x34, 0x62, 0x31, 0x00, 0x26, 0x01, 0x05, 0x39, 0x6a, 0x72, 0x63,
+  0x70, 0x00, 0x16, 0xcd, 0x00, 0x01, 0x02, 0x71, 0x35, 0x00, 0x13, 0xaa,
+  0x00, 0x01, 0x01, 0x6d, 0x00, 0x56, 0x74, 0x00, 0x01, 0x01, 0x6f, 0x00,
+  0x1e, 0x60, 0x00, 0x01, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x01, 0x01, 0x02,
+  0x62, 0x75, 0x00, 0x3a, 0x7d, 0x01, 0x01, 0x01, 0x6b, 0x00, 0x0e, 0x15,
+  0x00, 0x01, 0x01, 0x70, 0x00, 0x60, 0x95, 0x00, 0x01, 0x01, 0x6d, 0x00,
+  0x17, 0xbd, 0x00, 0x02, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x76, 0x00,
+  0x58, 0xaf, 0x00, 0x0d, 0x01, 0x61, 0x00, 0x60, 0x9c, 0x01, 0x62, 0x00,
+  0x43, 0xb8, 0x01, 0x63, 0x00, 0x26, 0xd7, 0x01, 0x65, 0x00, 0x60, 0xa3,
+  0x01, 0x68, 0x00, 0x4f, 0xff, 0x01, 0x6c, 0x00, 0x39, 0x28, 0x01, 0x6f,
+  0x00, 0x60, 0xaa, 0x01, 0x70, 0x00, 0x60, 0xb6, 0x01, 0x72, 0x00, 0x41,
+  0x08, 0x03, 0x73, 0x65, 0x70, 0x00, 0x60, 0xbd, 0x01, 0x74, 0x00, 0x22,
+  0x26, 0x02, 0x79, 0x6d, 0x00, 0x60, 0xc4, 0x01, 0x7a, 0x00, 0x5f, 0x90,
+  0x00, 0x01, 0x01, 0x72, 0x00, 0x60, 0xcd, 0x00, 0x01, 0x01, 0x64, 0x00,
+  0x13, 0x33, 0x00, 0x01, 0x01, 0x6f, 0x00, 0x35, 0x51, 0x00, 0x04, 0x01,
+  0x65, 0x00, 0x1e, 0x60, 0x01, 0x6f, 0x00, 0x16, 0x7b, 0x01, 0x70, 0x00,
+  0x16, 0xb8, 0x01, 0x74, 0x00, 0x60, 0xd4, 0x00, 0x02, 0x01, 0x62, 0x00,
+  0x0e, 0x15, 0x01, 0x6c, 0x00, 0x60, 0xe0, 0x00, 0x02, 0x01, 0x63, 0x00,
+  0x60, 0xf3, 0x02, 0x75, 0x67, 0x00, 0x61, 0x00, 0x01, 0x02, 0x01, 0x2e,
+  0x00, 0x61, 0x07, 0x06, 0x6a, 0x68, 0x33, 0x61, 0x31, 0x68, 0x00, 0x25,
+  0xdc, 0x00, 0x07, 0x01, 0x64, 0x00, 0x5d, 0xb5, 0x01, 0x67, 0x00, 0x5c,
+  0x4f, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x6f, 0x00, 0x5c, 0xea, 0x01,
+  0x74, 0x00, 0x22, 0x26, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x76, 0x00,
+  0x5f, 0x84, 0x01, 0x01, 0x02, 0x6b, 0x63, 0x00, 0x61, 0x13, 0x00, 0x01,
+  0x01, 0x74, 0x00, 0x61, 0x1a, 0x00, 0x11, 0x01, 0x61, 0x00, 0x61, 0x21,
+  0x01, 0x62, 0x00, 0x61, 0x3f, 0x0a, 0x63, 0x69, 0x74, 0x73, 0x61, 0x6c,
+  0x65, 0x6a, 0x2e, 0x70, 0x00, 0x4b, 0xdd, 0x01, 0x64, 0x00, 0x61, 0x50,
+  0x01, 0x65, 0x00, 0x61, 0x5a, 0x0d, 0x67, 0x6e, 0x69, 0x74, 0x73, 0x6f,
+  0x68, 0x64, 0x6e, 0x65, 0x72, 0x74, 0x2e, 0x00, 0x61, 0x69, 0x04, 0x69,
+  0x61, 0x7a, 0x6e, 0x00, 0x61, 0x75, 0x08, 0x6c, 0x65, 0x74, 0x65, 0x6d,
+  0x69, 0x72, 0x70, 0x00, 0x61, 0x7c, 0x01, 0x6d, 0x00, 0x61, 0x83, 0x01,
+  0x6e, 0x00, 0x61, 0x96, 0x01, 0x72, 0x00, 0x61, 0xa7, 0x05, 0x73, 0x63,
+  0x69, 0x74, 0x61, 0x00, 0x61, 0xb3, 0x0a, 0x74, 0x65, 0x6e, 0x72, 0x61,
+  0x78, 0x61, 0x2e, 0x31, 0x2d, 0x00, 0x61, 0xba, 0x06, 0x75, 0x6c, 0x75,
+  0x6c, 0x65, 0x74, 0x00, 0x61, 0xc1, 0x04, 0x77, 0x63, 0x73, 0x2e, 0x00,
+  0x61, 0xc8, 0x08, 0x78, 0x65, 0x6c, 0x70, 0x63, 0x69, 0x66, 0x66, 0x00,
+  0x3c, 0xee, 0x08, 0x79, 0x61, 0x77, 0x6f, 0x63, 0x6e, 0x65, 0x2e, 0x00,
+  0x62, 0x0c, 0x00, 0x01, 0x01, 0x6c, 0x00, 0x16, 0xcd, 0x00, 0x07, 0x01,
+  0x63, 0x00, 0x26, 0xd7, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x68, 0x00,
+  0x4f, 0xff, 0x01, 0x6c, 0x00, 0x39, 0x28, 0x01, 0x6f, 0x00, 0x0f, 0xfa,
+  0x01, 0x74, 0x00, 0x5c, 0x56, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x00, 0x08,
+  0x01, 0x63, 0x00, 0x26, 0xd7, 0x01, 0x65, 0x00, 0x62, 0x13, 0x06, 0x67,
+  0x6e, 0x69, 0x74, 0x73, 0x6f, 0x00, 0x62, 0x1b, 0x01, 0x6c, 0x00, 0x62,
+  0x22, 0x0f, 0x6e, 0x65, 0x76, 0x75, 0x65, 0x6c, 0x75, 0x6b, 0x2e, 0x79,
+  0x78, 0x6f, 0x72, 0x70, 0x7a, 0x00, 0x1d, 0x34, 0x01, 0x70, 0x00, 0x62,
+  0x2d, 0x12, 0x73, 0x6e, 0x6f, 0x69, 0x74, 0x75, 0x6c, 0x6f, 0x73, 0x74,
+  0x73, 0x6f, 0x68, 0x72, 0x65, 0x74, 0x6e, 0x69, 0x00, 0x62, 0x34, 0x01,
+  0x74, 0x00, 0x61, 0x1a, 0x01, 0x01, 0x01, 0x75, 0x00, 0x62, 0x3b, 0x01,
+  0x01, 0x01, 0x2e, 0x00, 0x62, 0x42, 0x00, 0x03, 0x02, 0x6c, 0x70, 0x00,
+  0x58, 0xfc, 0x02, 0x70, 0x73, 0x00, 0x62, 0x6c, 0x01, 0x73, 0x00, 0x26,
+  0x53, 0x01, 0x01, 0x01, 0x66, 0x00, 0x62, 0x7a, 0x00, 0x02, 0x01, 0x61,
+  0x00, 0x62, 0x81, 0x04, 0x65, 0x69, 0x63, 0x73, 0x00, 0x2e, 0xfb, 0x00,
+  0x01, 0x01, 0x72, 0x00, 0x62, 0x9c, 0x00, 0x15, 0x01, 0x31, 0x00, 0x62,
+  0xa3, 0x04, 0x34, 0x32, 0x70, 0x69, 0x00, 0x62, 0xaa, 0x01, 0x37, 0x00,
+  0x62, 0xb1, 0x01, 0x61, 0x00, 0x62, 0xb8, 0x01, 0x62, 0x00, 0x62, 0xc2,
+  0x03, 0x64, 0x65, 0x63, 0x00, 0x62, 0xe7, 0x01, 0x65, 0x00, 0x62, 0xf0,
+  0x0e, 0x68, 0x63, 0x69, 0x65, 0x72, 0x65, 0x62, 0x73, 0x6e, 0x6f, 0x69,
+  0x73, 0x73, 0x75, 0x00, 0x63, 0x2c, 0x07, 0x6b, 0x65, 0x65, 0x67, 0x6e,
+  0x69, 0x65, 0x00, 0x18, 0x88, 0x02, 0x6c, 0x73, 0x00, 0x63, 0x33, 0x01,
+  0x6d, 0x00, 0x63, 0x3a, 0x01, 0x6e, 0x00, 0x63, 0x4e, 0x02, 0x6f, 0x72,
+  0x00, 0x63, 0x99, 0x01, 0x70, 0x00, 0x63, 0xa4, 0x01, 0x72, 0x00, 0x63,
+  0xb7, 0x01, 0x73, 0x00, 0x63, 0xc7, 0x01, 0x74, 0x00, 0x61, 0x1a, 0x06,
+  0x76, 0x72, 0x65, 0x73, 0x69, 0x2d, 0x00, 0x63, 0xe6, 0x01, 0x78, 0x00,
+  0x63, 0xf2, 0x01, 0x79, 0x00, 0x63, 0xf9, 0x04, 0x7a, 0x74, 0x65, 0x6e,
+  0x00, 0x64, 0x19, 0x01, 0x01, 0x03, 0x2e, 0x6f, 0x62, 0x00, 0x26, 0xf3,
+  0x00, 0x02, 0x03, 0x73, 0x64, 0x6f, 0x00, 0x2c, 0xa2, 0x01, 0x75, 0x00,
+  0x0c, 0x1d, 0x00, 0x0a, 0x01, 0x62, 0x00, 0x17, 0xbd, 0x01, 0x64, 0x00,
+  0x5d, 0xb5, 0x01, 0x65, 0x00, 0x60, 0x40, 0x01, 0x67, 0x00, 0x5c, 0x4f,
+  0x01, 0x69, 0x00, 0x13, 0x4d, 0x02, 0x6b, 0x69, 0x00, 0x36, 0xd0, 0x01,
+  0x6d, 0x00, 0x64, 0x2e, 0x01, 0x70, 0x00, 0x62, 0x9c, 0x01, 0x75, 0x00,
+  0x27, 0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x00, 0x01, 0x01, 0x6f, 0x00,
+  0x0f, 0xfa, 0x00, 0x02, 0x01, 0x66, 0x00, 0x0e, 0x15, 0x01, 0x67, 0x00,
+  0x28, 0xd5, 0x00, 0x02, 0x01, 0x63, 0x00, 0x0e, 0x15, 0x01, 0x73, 0x00,
+  0x0e, 0x15, 0x00, 0x06, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6c, 0x00,
+  0x39, 0x28, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x74, 0x00, 0x64, 0x35,
+  0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x00, 0x05,
+  0x01, 0x66, 0x00, 0x0e, 0x15, 0x02, 0x67, 0x74, 0x00, 0x42, 0x3c, 0x01,
+  0x70, 0x00, 0x64, 0x41, 0x01, 0x72, 0x00, 0x64, 0x48, 0x01, 0x79, 0x00,
+  0x27, 0x33, 0x00, 0x01, 0x01, 0x6c, 0x00, 0x64, 0x4f, 0x00, 0x02, 0x01,
+  0x68, 0x00, 0x64, 0x56, 0x02, 0x72, 0x6f, 0x00, 0x64, 0x5d, 0x00, 0x01,
+  0x01, 0x6f, 0x00, 0x64, 0x65, 0x00, 0x03, 0x01, 0x70, 0x00, 0x62, 0x2d,
+  0x01, 0x74, 0x00, 0x61, 0x1a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x00, 0x01,
+  0x01, 0x69, 0x00, 0x64, 0x6c, 0x00, 0x02, 0x01, 0x62, 0x00, 0x37, 0xd5,
+  0x01, 0x6f, 0x00, 0x12, 0x22, 0x00, 0x04, 0x01, 0x66, 0x00, 0x41, 0x08,
+  0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6f, 0x00, 0x0f, 0xfa, 0x01, 0x74,
+  0x00, 0x22, 0x26, 0x00, 0x05, 0x01, 0x63, 0x00, 0x64, 0x73, 0x01, 0x65,
+  0x00, 0x64, 0x7f, 0x01, 0x69, 0x00, 0x5d, 0x2c, 0x01, 0x6f, 0x00, 0x64,
+  0x8b, 0x01, 0x72, 0x00, 0x41, 0x08, 0x00, 0x03, 0x01, 0x62, 0x00, 0x0e,
+  0x15, 0x01, 0x6c, 0x00, 0x0e, 0x15, 0x01, 0x6e, 0x00, 0x0e, 0x15, 0x00,
+  0x02, 0x02, 0x64, 0x6d, 0x00, 0x64, 0x9c, 0x01, 0x73, 0x00, 0x64, 0xa3,
+  0x00, 0x02, 0x01, 0x61, 0x00, 0x0e, 0x15, 0x01, 0x69, 0x00, 0x64, 0xaa,
+  0x00, 0x02, 0x01, 0x61, 0x00, 0x5c, 0x4f, 0x01, 0x72, 0x00, 0x2b, 0x7a,
+  0x00, 0x01, 0x01, 0x6e, 0x00, 0x16, 0x89, 0x01, 0x01, 0x01, 0x6f, 0x00,
+  0x58, 0xaf, 0x00, 0x02, 0x01, 0x62, 0x00, 0x64, 0xb6, 0x01, 0x6d, 0x00,
+  0x27, 0x0f, 0x00, 0x02, 0x02, 0x61, 0x73, 0x00, 0x29, 0x5f, 0x04, 0x65,
+  0x72, 0x61, 0x75, 0x00, 0x64, 0xbd, 0x00, 0x01, 0x01, 0x70, 0x00, 0x26,
+  0xd7, 0x01, 0x01, 0x01, 0x65, 0x00, 0x64, 0xc4, 0x00, 0x13, 0x01, 0x34,
+  0x00, 0x64, 0xcb, 0x02, 0x36, 0x36, 0x00, 0x0f, 0xfa, 0x05, 0x61, 0x69,
+  0x6c, 0x69, 0x73, 0x00, 0x64, 0xd8, 0x01, 0x62, 0x00, 0x64, 0xdf, 0x01,
+  0x63, 0x00, 0x26, 0xd7, 0x01, 0x64, 0x00, 0x64, 0xeb, 0x01, 0x65, 0x00,
+  0x64, 0xf5, 0x01, 0x67, 0x00, 0x65, 0x06, 0x04, 0x68, 0x63, 0x74, 0x69,
+  0x00, 0x43, 0xbf, 0x04, 0x6b, 0x63, 0x61, 0x74, 0x00, 0x65, 0x12, 0x01,
+  0x6e, 0x00, 0x65, 0x19, 0x01, 0x6f, 0x00, 0x65, 0x21, 0x01, 0x70, 0x00,
+  0x65, 0x32, 0x01, 0x72, 0x00, 0x65, 0x43, 0x01, 0x73, 0x00, 0x65, 0x56,
+  0x01, 0x74, 0x00, 0x65, 0x6e, 0x01, 0x75, 0x00, 0x65, 0x7a, 0x01, 0x76,
+  0x00, 0x65, 0x86, 0x01, 0x79, 0x00, 0x65, 0x92, 0x00, 0x02, 0x01, 0x67,
+  0x00, 0x0e, 0x15, 0x01, 0x6e, 0x00, 0x65, 0xa3, 0x00, 0x02, 0x01, 0x72,
+  0x00, 0x0f, 0x68, 0x02, 0x74, 0x77, 0x00, 0x15, 0xf4, 0x00, 0x01, 0x01,
+  0x72, 0x00, 0x46, 0x83, 0x00, 0x01, 0x01, 0x6f, 0x00, 0x64, 0x4f, 0x00,
+  0x02, 0x03, 0x6c, 0x6e, 0x6f, 0x00, 0x65, 0xaa, 0x01, 0x77, 0x00, 0x0e,
+  0x15, 0x01, 0x05, 0x01, 0x2e, 0x00, 0x65, 0xb1, 0x01, 0x68, 0x00, 0x0f,
+  0x68, 0x04, 0x6c, 0x61, 0x74, 0x69, 0x00, 0x65, 0xc6, 0x02, 0x74, 0x73,
+  0x00, 0x65, 0xcd, 0x01, 0x7a, 0x00, 0x65, 0xd9, 0x00, 0x01, 0x01, 0x6c,
+  0x00, 0x5d, 0xb5, 0x00, 0x06, 0x01, 0x62, 0x00, 0x58, 0xaf, 0x01, 0x67,
+  0x00, 0x5c, 0x4f, 0x01, 0x6c, 0x00, 0x39, 0x28, 0x01, 0x6d, 0x00, 0x5d,
+  0x82, 0x01, 0x74, 0x00, 0x5c, 0x56, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x00,
+  0x01, 0x01, 0x72, 0x00, 0x0c, 0x1d, 0x00, 0x01, 0x01, 0x6b, 0x00, 0x27,
+  0x0f, 0x00, 0x03, 0x01, 0x6d, 0x00, 0x5d, 0x82, 0x01, 0x6f, 0x00, 0x60,
+  0x6f, 0x01, 0x74, 0x00, 0x61, 0x1a, 0x00, 0x03, 0x01, 0x63, 0x00, 0x65,
+  0xe0, 0x01, 0x70, 0x00, 0x2b, 0x46, 0x01, 0x77, 0x00, 0x65, 0xe7, 0x01,
+  0x01, 0x01, 0x2e, 0x00, 0x65, 0xef, 0x00, 0x01, 0x01, 0x65, 0x00, 0x65,
+  0xfc, 0x00, 0x04, 0x01, 0x63, 0x00, 0x25, 0x56, 0x01, 0x73, 0x00, 0x66,
+  0x03, 0x01, 0x74, 0x00, 0x66, 0x0a, 0x01, 0x7a, 0x00, 0x26, 0xd7, 0x00,
+  0x18, 0x01, 0x61, 0x00, 0x66, 0x16, 0x01, 0x62, 0x00, 0x66, 0x28, 0x01,
+  0x63, 0x00, 0x66, 0x37, 0x01, 0x64, 0x00, 0x66, 0x3e, 0x01, 0x65, 0x00,
+  0x0e, 0x15, 0x01, 0x66, 0x00, 0x66, 0x4a, 0x01, 0x67, 0x00, 0x66, 0x51,
+  0x01, 0x68, 0x00, 0x66, 0x58, 0x01, 0x69, 0x00, 0x66, 0x5f, 0x01, 0x6b,
+  0x00, 0x66, 0x66, 0x01, 0x6c, 0x00, 0x0e, 0x15, 0x01, 0x6d, 0x00, 0x66,
+  0x6d, 0x01, 0x6e, 0x00, 0x66, 0x79, 0x01, 0x6f, 0x00, 0x0e, 0x15, 0x01,
+  0x70, 0x00, 0x66, 0x87, 0x01, 0x72, 0x00, 0x66, 0x93, 0x01, 0x73, 0x00,
+  0x66, 0xa2, 0x01, 0x74, 0x00, 0x66, 0xb0, 0x01, 0x75, 0x00, 0x0e, 0x15,
+  0x01, 0x76, 0x00, 0x66, 0xb7, 0x01, 0x77, 0x00, 0x0e, 0x15, 0x01, 0x78,
+  0x00, 0x66, 0xbe, 0x01, 0x79, 0x00, 0x0e, 0x15, 0x01, 0x7a, 0x00, 0x0e,
+  0x15, 0x00, 0x03, 0x01, 0x63, 0x00, 0x0e, 0x15, 0x01, 0x65, 0x00, 0x26,
+  0xde, 0x01, 0x68, 0x00, 0x0f, 0xfa, 0x00, 0x02, 0x01, 0x65, 0x00, 0x1d,
+  0x1c, 0x01, 0x75, 0x00, 0x66, 0xc6, 0x00, 0x01, 0x02, 0x65, 0x73, 0x00,
+  0x4b, 0x7d, 0x00, 0x01, 0x01, 0x6f, 0x00, 0x21, 0x6d, 0x00, 0x02, 0x01,
+  0x64, 0x00, 0x0e, 0x15, 0x02, 0x74, 0x73, 0x00, 0x66, 0xcd, 0x01, 0x02,
+  0x01, 0x2e, 0x00, 0x66, 0xd9, 0x02, 0x62, 0x65, 0x00, 0x38, 0xfe, 0x00,
+  0x02, 0x02, 0x69, 0x6f, 0x00, 0x67, 0x20, 0x01, 0x6f, 0x00, 0x26, 0xde,
+  0x00, 0x01, 0x01, 0x74, 0x00, 0x67, 0x27, 0x00, 0x02, 0x01, 0x6e, 0x00,
+  0x67, 0x2e, 0x01, 0x74, 0x00, 0x67, 0x35, 0x00, 0x0d, 0x01, 0x32, 0x00,
+  0x67, 0x3c, 0x01, 0x62, 0x00, 0x67, 0x43, 0x02, 0x63, 0x65, 0x00, 0x67,
+  0x54, 0x01, 0x65, 0x00, 0x3f, 0x9e, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01,
+  0x6c, 0x00, 0x39, 0x28, 0x01, 0x6d, 0x00, 0x67, 0x60, 0x01, 0x6f, 0x00,
+  0x5f, 0x78, 0x01, 0x72, 0x00, 0x67, 0x6c, 0x01, 0x73, 0x00, 0x67, 0x73,
+  0x01, 0x74, 0x00, 0x5c, 0xfd, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x76,
+  0x00, 0x58, 0xaf, 0x00, 0x03, 0x01, 0x6c, 0x00, 0x67, 0x7a, 0x01, 0x72,
+  0x00, 0x1e, 0x60, 0x05, 0x73, 0x73, 0x65, 0x72, 0x67, 0x00, 0x67, 0x81,
+  0x00, 0x06, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6c, 0x00, 0x39, 0x28,
+  0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x75,
+  0x00, 0x27, 0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x00, 0x01, 0x01, 0x6d,
+  0x00, 0x26, 0x0f, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x67, 0x88, 0x00, 0x01,
+  0x01, 0x31, 0x00, 0x18, 0xa6, 0x00, 0x01, 0x01, 0x31, 0x00, 0x67, 0xba,
+  0x00, 0x08, 0x01, 0x62, 0x00, 0x43, 0xb8, 0x01, 0x63, 0x00, 0x29, 0xdf,
+  0x01, 0x65, 0x00, 0x3f, 0x9e, 0x01, 0x6d, 0x00, 0x67, 0xc1, 0x01, 0x6f,
+  0x00, 0x5c, 0xea, 0x02, 0x72, 0x65, 0x00, 0x67, 0xcd, 0x01, 0x73, 0x00,
+  0x67, 0x73, 0x01, 0x74, 0x00, 0x22, 0x26, 0x00, 0x03, 0x01, 0x67, 0x00,
+  0x5c, 0x4f, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x75, 0x00, 0x27, 0x3a,
+  0x00, 0x02, 0x01, 0x68, 0x00, 0x4f, 0xff, 0x01, 0x7a, 0x00, 0x5f, 0x90,
+  0x01, 0x01, 0x01, 0x2e, 0x00, 0x67, 0xd9, 0x00, 0x01, 0x01, 0x73, 0x00,
+  0x26, 0x0f, 0x00, 0x01, 0x07, 0x64, 0x35, 0x61, 0x34, 0x70, 0x72, 0x65,
+  0x00, 0x1d, 0x23, 0x00, 0x04, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6d,
+  0x00, 0x5d, 0x82, 0x01, 0x6f, 0x00, 0x0f, 0xfa, 0x01, 0x74, 0x00, 0x22,
+  0x26, 0x00, 0x24, 0x01, 0x30, 0x00, 0x0e, 0x15, 0x01, 0x31, 0x00, 0x0e,
+  0x15, 0x01, 0x32, 0x00, 0x0e, 0x15, 0x01, 0x33, 0x00, 0x0e, 0x15, 0x01,
+  0x34, 0x00, 0x0e, 0x15, 0x01, 0x35, 0x00, 0x0e, 0x15, 0x01, 0x36, 0x00,
+  0x0e, 0x15, 0x01, 0x37, 0x00, 0x0e, 0x15, 0x01, 0x38, 0x00, 0x0e, 0x15,
+  0x01, 0x39, 0x00, 0x0e, 0x15, 0x01, 0x61, 0x00, 0x0e, 0x15, 0x01, 0x62,
+  0x00, 0x0e, 0x15, 0x01, 0x63, 0x00, 0x0e, 0x15, 0x01, 0x64, 0x00, 0x0e,
+  0x15, 0x01, 0x65, 0x00, 0x0e, 0x15, 0x01, 0x66, 0x00, 0x0e, 0x15, 0x01,
+  0x67, 0x00, 0x0e, 0x15, 0x01, 0x68, 0x00, 0x0e, 0x15, 0x01, 0x69, 0x00,
+  0x0e, 0x15, 0x01, 0x6a, 0x00, 0x0e, 0x15, 0x01, 0x6b, 0x00, 0x0e, 0x15,
+  0x01, 0x6c, 0x00, 0x0e, 0x15, 0x01, 0x6d, 0x00, 0x0e, 0x15, 0x01, 0x6e,
+  0x00, 0x0e, 0x15, 0x01, 0x6f, 0x00, 0x0e, 0x15, 0x01, 0x70, 0x00, 0x0e,
+  0x15, 0x01, 0x71, 0x00, 0x0e, 0x15, 0x01, 0x72, 0x00, 0x0e, 0x15, 0x01,
+  0x73, 0x00, 0x0e, 0x15, 0x01, 0x74, 0x00, 0x66, 0xb0, 0x01, 0x75, 0x00,
+  0x0e, 0x15, 0x01, 0x76, 0x00, 0x0e, 0x15, 0x01, 0x77, 0x00, 0x0e, 0x15,
+  0x01, 0x78, 0x00, 0x0e, 0x15, 0x01, 0x79, 0x00, 0x67, 0xf8, 0x01, 0x7a,
+  0x00, 0x0e, 0x15, 0x00, 0x09, 0x01, 0x65, 0x00, 0x5d, 0x25, 0x01, 0x67,
+  0x00, 0x5c, 0x4f, 0x01, 0x69, 0x00, 0x4f, 0xff, 0x01, 0x6c, 0x00, 0x39,
+  0x28, 0x01, 0x6d, 0x00, 0x64, 0x2e, 0x01, 0x6e, 0x00, 0x62, 0x0c, 0x01,
+  0x74, 0x00, 0x22, 0x26, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x76, 0x00,
+  0x58, 0xaf, 0x00, 0x06, 0x01, 0x61, 0x00, 0x54, 0xdc, 0x01, 0x67, 0x00,
+  0x5c, 0x4f, 0x05, 0x6c, 0x65, 0x6e, 0x61, 0x70, 0x00, 0x67, 0xff, 0x01,
+  0x6f, 0x00, 0x0f, 0xfa, 0x02, 0x73, 0x61, 0x00, 0x68, 0x09, 0x01, 0x74,
+  0x00, 0x22, 0x26, 0x00, 0x0a, 0x01, 0x67, 0x00, 0x68, 0x10, 0x01, 0x6b,
+  0x00, 0x5d, 0xbc, 0x01, 0x6c, 0x00, 0x39, 0x28, 0x01, 0x6d, 0x00, 0x2f,
+  0x47, 0x01, 0x6f, 0x00, 0x2a, 0x10, 0x01, 0x70, 0x00, 0x16, 0xb8, 0x01,
+  0x73, 0x00, 0x5d, 0xbc, 0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x75, 0x00,
+  0x27, 0x3a, 0x01, 0x76, 0x00, 0x5f, 0x84, 0x00, 0x07, 0x01, 0x64, 0x00,
+  0x13, 0x4d, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6c, 0x00, 0x39, 0x28,
+  0x01, 0x6d, 0x00, 0x68, 0x1c, 0x01, 0x6f, 0x00, 0x0f, 0xfa, 0x01, 0x75,
+  0x00, 0x27, 0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x00, 0x01, 0x01, 0x6b,
+  0x00, 0x0e, 0x15, 0x00, 0x0c, 0x01, 0x64, 0x00, 0x68, 0x28, 0x01, 0x65,
+  0x00, 0x5d, 0x25, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x68, 0x00, 0x4f,
+  0xff, 0x01, 0x69, 0x00, 0x68, 0x2f, 0x01, 0x6c, 0x00, 0x68, 0x36, 0x01,
+  0x6d, 0x00, 0x68, 0x42, 0x01, 0x6e, 0x00, 0x64, 0x65, 0x01, 0x6f, 0x00,
+  0x68, 0x4e, 0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x75, 0x00, 0x27, 0x3a,
+  0x01, 0x76, 0x00, 0x58, 0xaf, 0x00, 0x01, 0x01, 0x77, 0x00, 0x0e, 0x15,
+  0x01, 0x0b, 0x01, 0x62, 0x00, 0x68, 0x55, 0x01, 0x63, 0x00, 0x67, 0x6c,
+  0x01, 0x64, 0x00, 0x68, 0x5c, 0x01, 0x68, 0x00, 0x68, 0x68, 0x01, 0x6b,
+  0x00, 0x68, 0x74, 0x01, 0x6c, 0x00, 0x27, 0x0f, 0x01, 0x6e, 0x00, 0x68,
+  0x81, 0x01, 0x70, 0x00, 0x68, 0x8d, 0x02, 0x72, 0x65, 0x00, 0x68, 0x94,
+  0x01, 0x74, 0x00, 0x68, 0xa0, 0x02, 0x76, 0x69, 0x00, 0x68, 0xc8, 0x01,
+  0x01, 0x01, 0x73, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x05, 0x72, 0x65, 0x68,
+  0x63, 0x69, 0x00, 0x68, 0xd4, 0x01, 0x73, 0x00, 0x5f, 0xa8, 0x01, 0x01,
+  0x01, 0x2e, 0x00, 0x68, 0xdb, 0x00, 0x01, 0x01, 0x6c, 0x00, 0x18, 0xa6,
+  0x00, 0x01, 0x01, 0x6f, 0x00, 0x68, 0xf2, 0x01, 0x01, 0x01, 0x2e, 0x00,
+  0x68, 0xf9, 0x00, 0x02, 0x01, 0x6d, 0x00, 0x52, 0xae, 0x01, 0x6f, 0x00,
+  0x16, 0xb8, 0x00, 0x07, 0x06, 0x64, 0x65, 0x6c, 0x61, 0x63, 0x73, 0x00,
+  0x69, 0x73, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6d, 0x00, 0x2f, 0x47,
+  0x01, 0x72, 0x00, 0x69, 0x7a, 0x01, 0x74, 0x00, 0x5c, 0x56, 0x01, 0x75,
+  0x00, 0x27, 0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x00, 0x07, 0x01, 0x63,
+  0x00, 0x64, 0x73, 0x01, 0x65, 0x00, 0x0f, 0x6f, 0x01, 0x67, 0x00, 0x5c,
+  0x4f, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x6f, 0x00, 0x69, 0x81, 0x01,
+  0x72, 0x00, 0x41, 0x08, 0x01, 0x74, 0x00, 0x61, 0x1a, 0x00, 0x01, 0x01,
+  0x31, 0x00, 0x2b, 0xef, 0x00, 0x04, 0x01, 0x61, 0x00, 0x69, 0x8d, 0x08,
+  0x69, 0x64, 0x31, 0x6b, 0x7a, 0x75, 0x63, 0x33, 0x00, 0x10, 0xd5, 0x08,
+  0x6c, 0x38, 0x62, 0x78, 0x69, 0x38, 0x69, 0x66, 0x00, 0x69, 0xae, 0x06,
+  0x72, 0x62, 0x30, 0x65, 0x66, 0x31, 0x00, 0x69, 0xae, 0x00, 0x01, 0x02,
+  0x76, 0x66, 0x00, 0x0f, 0xa0, 0x00, 0x0b, 0x01, 0x37, 0x00, 0x62, 0xb1,
+  0x01, 0x61, 0x00, 0x62, 0xb8, 0x07, 0x64, 0x75, 0x6f, 0x6c, 0x63, 0x2d,
+  0x64, 0x00, 0x61, 0x50, 0x01, 0x65, 0x00, 0x62, 0x13, 0x04, 0x67, 0x6e,
+  0x69, 0x6b, 0x00, 0x69, 0xb6, 0x01, 0x70, 0x00, 0x69, 0xbd, 0x03, 0x73,
+  0x6e, 0x64, 0x00, 0x69, 0xc9, 0x01, 0x74, 0x00, 0x69, 0xd0, 0x06, 0x77,
+  0x6f, 0x6c, 0x66, 0x2e, 0x65, 0x00, 0x69, 0xe1, 0x01, 0x78, 0x00, 0x63,
+  0xf2, 0x01, 0x79, 0x00, 0x69, 0xf3, 0x01, 0x01, 0x01, 0x65, 0x00, 0x69,
+  0xfa, 0x00, 0x02, 0x01, 0x61, 0x00, 0x25, 0x56, 0x01, 0x75, 0x00, 0x46,
+  0x83, 0x00, 0x05, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6c, 0x00, 0x39,
+  0x28, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x01,
+  0x76, 0x00, 0x58, 0xaf, 0x00, 0x01, 0x01, 0x69, 0x00, 0x1d, 0x1c, 0x00,
+  0x08, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x69, 0x00, 0x0e, 0x15, 0x01,
+  0x6c, 0x00, 0x39, 0x28, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x6f, 0x00,
+  0x68, 0x4e, 0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x75, 0x00, 0x27, 0x3a,
+  0x01, 0x76, 0x00, 0x58, 0xaf, 0x00, 0x08, 0x01, 0x67, 0x00, 0x6a, 0x01,
+  0x01, 0x6c, 0x00, 0x6a, 0x0f, 0x01, 0x6d, 0x00, 0x6a, 0x1b, 0x01, 0x70,
+  0x00, 0x5f, 0x90, 0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x76, 0x00, 0x58,
+  0xaf, 0x01, 0x77, 0x00, 0x56, 0x74, 0x02, 0x79, 0x6f, 0x00, 0x6a, 0x2e,
+  0x00, 0x02, 0x01, 0x63, 0x00, 0x0e, 0x15, 0x01, 0x6e, 0x00, 0x64, 0xb6,
+  0x00, 0x03, 0x01, 0x64, 0x00, 0x0e, 0x15, 0x01, 0x66, 0x00, 0x0e, 0x15,
+  0x01, 0x72, 0x00, 0x2a, 0x10, 0x00, 0x08, 0x01, 0x63, 0x00, 0x26, 0xd7,
+  0x03, 0x65, 0x6e, 0x69, 0x00, 0x6a, 0x38, 0x01, 0x69, 0x00, 0x12, 0x22,
+  0x01, 0x6e, 0x00, 0x2a, 0x10, 0x01, 0x6f, 0x00, 0x69, 0x81, 0x01, 0x70,
+  0x00, 0x15, 0xf4, 0x01, 0x72, 0x00, 0x41, 0x08, 0x01, 0x74, 0x00, 0x22,
+  0x26, 0x01, 0x01, 0x03, 0x2e, 0x61, 0x72, 0x00, 0x21, 0x6d, 0x00, 0x02,
+  0x01, 0x62, 0x00, 0x26, 0xd7, 0x01, 0x65, 0x00, 0x6a, 0x3f, 0x00, 0x05,
+  0x01, 0x66, 0x00, 0x62, 0x7a, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6d,
+  0x00, 0x2f, 0x47, 0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x75, 0x00, 0x6a,
+  0x4b, 0x00, 0x01, 0x01, 0x75, 0x00, 0x1e, 0x60, 0x00, 0x01, 0x01, 0x75,
+  0x00, 0x52, 0x9a, 0x00, 0x01, 0x01, 0x69, 0x00, 0x46, 0x83, 0x00, 0x05,
+  0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x6f,
+  0x00, 0x0f, 0xfa, 0x01, 0x72, 0x00, 0x41, 0x08, 0x01, 0x75, 0x00, 0x27,
+  0x3a, 0x00, 0x01, 0x01, 0x62, 0x00, 0x26, 0xd7, 0x01, 0x01, 0x01, 0x6d,
+  0x00, 0x6a, 0x52, 0x00, 0x0d, 0x0a, 0x61, 0x79, 0x62, 0x2d, 0x74, 0x72,
+  0x6f, 0x70, 0x6f, 0x72, 0x00, 0x6a, 0x59, 0x01, 0x63, 0x00, 0x26, 0xd7,
+  0x01, 0x64, 0x00, 0x6a, 0x60, 0x01, 0x65, 0x00, 0x6a, 0x6c, 0x01, 0x67,
+  0x00, 0x5c, 0x4f, 0x01, 0x6c, 0x00, 0x0f, 0x6f, 0x01, 0x6d, 0x00, 0x2f,
+  0x47, 0x01, 0x6e, 0x00, 0x60, 0x40, 0x01, 0x6f, 0x00, 0x6a, 0x73, 0x01,
+  0x72, 0x00, 0x41, 0x08, 0x01, 0x74, 0x00, 0x5c, 0xfd, 0x01, 0x75, 0x00,
+  0x27, 0x3a, 0x01, 0x76, 0x00, 0x6a, 0x84, 0x00, 0x01, 0x01, 0x75, 0x00,
+  0x0c, 0x1d, 0x00, 0x01, 0x01, 0x69, 0x00, 0x43, 0x6a, 0x00, 0x09, 0x0a,
+  0x61, 0x77, 0x35, 0x2d, 0x6e, 0x65, 0x6e, 0x69, 0x6b, 0x6b, 0x00, 0x10,
+  0xd5, 0x02, 0x64, 0x6e, 0x00, 0x6a, 0x8b, 0x01, 0x69, 0x00, 0x6a, 0x92,
+  0x0e, 0x6d, 0x72, 0x6f, 0x66, 0x74, 0x61, 0x6c, 0x70, 0x64, 0x75, 0x6f,
+  0x6c, 0x63, 0x2e, 0x00, 0x60, 0x40, 0x01, 0x70, 0x00, 0x62, 0x2d, 0x0b,
+  0x72, 0x65, 0x74, 0x6e, 0x65, 0x63, 0x61, 0x74, 0x61, 0x64, 0x2e, 0x00,
+  0x6a, 0x9f, 0x01, 0x74, 0x00, 0x61, 0x1a, 0x08, 0x75, 0x76, 0x69, 0x73,
+  0x69, 0x74, 0x6f, 0x6b, 0x00, 0x6a, 0xab, 0x01, 0x79, 0x00, 0x1e, 0x60,
+  0x00, 0x01, 0x01, 0x6e, 0x00, 0x1c, 0x65, 0x00, 0x05, 0x01, 0x64, 0x00,
+  0x6a, 0xb2, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6d, 0x00, 0x2f, 0x47,
+  0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x00, 0x02,
+  0x01, 0x61, 0x00, 0x6a, 0xbe, 0x01, 0x72, 0x00, 0x26, 0xd7, 0x00, 0x02,
+  0x04, 0x61, 0x62, 0x6f, 0x64, 0x00, 0x62, 0x3b, 0x02, 0x69, 0x62, 0x00,
+  0x6a, 0xc5, 0x00, 0x01, 0x01, 0x68, 0x00, 0x27, 0x0f, 0x00, 0x07, 0x01,
+  0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x6f, 0x00,
+  0x5c, 0xea, 0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x75, 0x00, 0x27, 0x3a,
+  0x01, 0x76, 0x00, 0x58, 0xaf, 0x01, 0x7a, 0x00, 0x5f, 0x90, 0x00, 0x01,
+  0x01, 0x77, 0x00, 0x27, 0x08, 0x00, 0x01, 0x03, 0x69, 0x73, 0x6c, 0x00,
+  0x6a, 0xcc, 0x00, 0x01, 0x01, 0x7a, 0x00, 0x13, 0x5b, 0x00, 0x02, 0x01,
+  0x61, 0x00, 0x42, 0x43, 0x01, 0x74, 0x00, 0x61, 0x1a, 0x00, 0x01, 0x01,
+  0x73, 0x00, 0x2a, 0x10, 0x00, 0x01, 0x01, 0x69, 0x00, 0x12, 0x22, 0x00,
+  0x0a, 0x01, 0x62, 0x00, 0x6a, 0xd3, 0x01, 0x63, 0x00, 0x26, 0xd7, 0x01,
+  0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6c, 0x00, 0x39, 0x28, 0x01, 0x6d, 0x00,
+  0x5d, 0x82, 0x01, 0x6e, 0x00, 0x2a, 0x10, 0x01, 0x6f, 0x00, 0x5f, 0x78,
+  0x01, 0x74, 0x00, 0x5c, 0xfd, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x7a,
+  0x00, 0x5f, 0x90, 0x00, 0x02, 0x06, 0x68, 0x67, 0x72, 0x6f, 0x62, 0x6d,
+  0x00, 0x29, 0x5f, 0x01, 0x6d, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x65,
+  0x00, 0x16, 0x9c, 0x00, 0x03, 0x04, 0x65, 0x67, 0x61, 0x70, 0x00, 0x6a,
+  0xdf, 0x03, 0x70, 0x70, 0x61, 0x00, 0x6a, 0xdf, 0x01, 0x74, 0x00, 0x61,
+  0x1a, 0x00, 0x01, 0x01, 0x73, 0x00, 0x13, 0x33, 0x00, 0x02, 0x01, 0x63,
+  0x00, 0x0e, 0x15, 0x02, 0x6e, 0x69, 0x00, 0x5c, 0xea, 0x00, 0x05, 0x01,
+  0x32, 0x00, 0x60, 0x26, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6d, 0x00,
+  0x2f, 0x47, 0x01, 0x6f, 0x00, 0x0f, 0xfa, 0x01, 0x74, 0x00, 0x22, 0x26,
+  0x00, 0x0b, 0x04, 0x61, 0x63, 0x69, 0x72, 0x00, 0x6a, 0xe6, 0x01, 0x65,
+  0x00, 0x5c, 0xe3, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6d, 0x00, 0x6a,
+  0xed, 0x01, 0x6f, 0x00, 0x6a, 0xf9, 0x02, 0x72, 0x75, 0x00, 0x60, 0x6f,
+  0x01, 0x73, 0x00, 0x6b, 0x14, 0x01, 0x74, 0x00, 0x6b, 0x2b, 0x01, 0x75,
+  0x00, 0x27, 0x3a, 0x01, 0x76, 0x00, 0x6b, 0x3e, 0x02, 0x79, 0x65, 0x00,
+  0x6b, 0x45, 0x00, 0x09, 0x01, 0x63, 0x00, 0x26, 0xd7, 0x01, 0x65, 0x00,
+  0x5d, 0x25, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6c, 0x00, 0x39, 0x28,
+  0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x6f, 0x00, 0x60, 0x47, 0x01, 0x74,
+  0x00, 0x22, 0x26, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x01, 0x7a, 0x00, 0x5f,
+  0x90, 0x00, 0x0b, 0x01, 0x62, 0x00, 0x43, 0xb8, 0x01, 0x63, 0x00, 0x6b,
+  0x4c, 0x01, 0x65, 0x00, 0x5d, 0x25, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01,
+  0x6c, 0x00, 0x39, 0x28, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x6f, 0x00,
+  0x69, 0x81, 0x01, 0x74, 0x00, 0x6b, 0x58, 0x01, 0x75, 0x00, 0x27, 0x3a,
+  0x01, 0x76, 0x00, 0x58, 0xaf, 0x01, 0x7a, 0x00, 0x5f, 0x90, 0x04, 0x00,
+  0x00, 0x02, 0x03, 0x62, 0x64, 0x65, 0x00, 0x39, 0x74, 0x01, 0x6c, 0x00,
+  0x15, 0x5e, 0x00, 0x01, 0x01, 0x6e, 0x00, 0x12, 0xe2, 0x00, 0x01, 0x01,
+  0x6c, 0x00, 0x0f, 0xfa, 0x00, 0x01, 0x01, 0x65, 0x00, 0x6b, 0x69, 0x00,
+  0x07, 0x01, 0x65, 0x00, 0x6b, 0x70, 0x01, 0x67, 0x00, 0x29, 0xdf, 0x01,
+  0x6d, 0x00, 0x64, 0x9c, 0x01, 0x6f, 0x00, 0x0f, 0xfa, 0x01, 0x70, 0x00,
+  0x62, 0x2d, 0x01, 0x74, 0x00, 0x61, 0x1a, 0x01, 0x7a, 0x00, 0x5f, 0x90,
+  0x00, 0x01, 0x01, 0x6d, 0x00, 0x6b, 0x7d, 0x00, 0x0d, 0x01, 0x61, 0x00,
+  0x6b, 0x84, 0x03, 0x62, 0x33, 0x71, 0x00, 0x6b, 0x91, 0x01, 0x63, 0x00,
+  0x66, 0x03, 0x01, 0x64, 0x00, 0x6b, 0x9a, 0x01, 0x67, 0x00, 0x6b, 0xab,
+  0x01, 0x69, 0x00, 0x6b, 0xbd, 0x01, 0x6d, 0x00, 0x6b, 0xd2, 0x04, 0x6e,
+  0x70, 0x71, 0x69, 0x00, 0x2b, 0xef, 0x03, 0x73, 0x61, 0x61, 0x00, 0x6b,
+  0xde, 0x01, 0x74, 0x00, 0x5c, 0x56, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x01,
+  0x76, 0x00, 0x6b, 0xe5, 0x02, 0x78, 0x76, 0x00, 0x6b, 0xf6, 0x00, 0x01,
+  0x01, 0x64, 0x00, 0x38, 0x94, 0x00, 0x0d, 0x01, 0x62, 0x00, 0x43, 0xb8,
+  0x01, 0x63, 0x00, 0x6b, 0xfe, 0x01, 0x64, 0x00, 0x68, 0x28, 0x01, 0x67,
+  0x00, 0x5c, 0x4f, 0x01, 0x68, 0x00, 0x4f, 0xff, 0x01, 0x6c, 0x00, 0x6c,
+  0x0a, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x6e, 0x00, 0x60, 0x6f, 0x01,
+  0x6f, 0x00, 0x68, 0x4e, 0x01, 0x70, 0x00, 0x31, 0x67, 0x01, 0x74, 0x00,
+  0x5c, 0xfd, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf,
+  0x00, 0x07, 0x01, 0x65, 0x00, 0x5d, 0x25, 0x01, 0x66, 0x00, 0x66, 0x03,
+  0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x74,
+  0x00, 0x5c, 0x56, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x76, 0x00, 0x58,
+  0xaf, 0x01, 0x05, 0x02, 0x63, 0x66, 0x00, 0x0e, 0xff, 0x01, 0x65, 0x00,
+  0x3f, 0xa5, 0x01, 0x6d, 0x00, 0x2b, 0x46, 0x01, 0x74, 0x00, 0x6c, 0x11,
+  0x01, 0x75, 0x00, 0x0e, 0x15, 0x01, 0x02, 0x01, 0x6c, 0x00, 0x6c, 0x1d,
+  0x01, 0x70, 0x00, 0x0e, 0x15, 0x00, 0x0c, 0x01, 0x62, 0x00, 0x6a, 0xd3,
+  0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6b, 0x00, 0x58, 0xaf, 0x01, 0x6d,
+  0x00, 0x6c, 0x24, 0x01, 0x6e, 0x00, 0x58, 0xaf, 0x01, 0x6f, 0x00, 0x5c,
+  0xea, 0x01, 0x70, 0x00, 0x58, 0xaf, 0x01, 0x73, 0x00, 0x58, 0xaf, 0x01,
+  0x74, 0x00, 0x22, 0x26, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x76, 0x00,
+  0x58, 0xaf, 0x01, 0x7a, 0x00, 0x5f, 0x90, 0x01, 0x02, 0x01, 0x2e, 0x00,
+  0x6c, 0x30, 0x02, 0x64, 0x6f, 0x00, 0x3f, 0xd8, 0x00, 0x0e, 0x01, 0x63,
+  0x00, 0x6c, 0x4f, 0x01, 0x64, 0x00, 0x68, 0x28, 0x01, 0x65, 0x00, 0x6c,
+  0x5b, 0x03, 0x67, 0x72, 0x6f, 0x00, 0x6c, 0x67, 0x02, 0x68, 0x63, 0x00,
+  0x6c, 0x6e, 0x05, 0x6c, 0x65, 0x6e, 0x61, 0x70, 0x00, 0x6c, 0x75, 0x01,
+  0x6e, 0x00, 0x6c, 0x7d, 0x01, 0x6f, 0x00, 0x6c, 0x92, 0x01, 0x70, 0x00,
+  0x6c, 0x9e, 0x01, 0x73, 0x00, 0x6c, 0xa5, 0x01, 0x74, 0x00, 0x6c, 0xac,
+  0x03, 0x76, 0x6f, 0x67, 0x00, 0x6c, 0xc3, 0x06, 0x77, 0x65, 0x69, 0x76,
+  0x65, 0x72, 0x00, 0x6c, 0x75, 0x01, 0x79, 0x00, 0x6c, 0xca, 0x00, 0x01,
+  0x01, 0x77, 0x00, 0x26, 0x0f, 0x00, 0x06, 0x01, 0x67, 0x00, 0x5c, 0x4f,
+  0x01, 0x6c, 0x00, 0x39, 0x28, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x74,
+  0x00, 0x5c, 0x56, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x76, 0x00, 0x58,
+  0xaf, 0x00, 0x01, 0x01, 0x6f, 0x00, 0x43, 0xbf, 0x01, 0x01, 0x01, 0x65,
+  0x00, 0x26, 0xde, 0x00, 0x03, 0x01, 0x63, 0x00, 0x6c, 0xdc, 0x01, 0x72,
+  0x00, 0x6c, 0xec, 0x04, 0x74, 0x6e, 0x65, 0x64, 0x00, 0x6c, 0xf3, 0x00,
+  0x02, 0x01, 0x69, 0x00, 0x16, 0x9c, 0x04, 0x6f, 0x69, 0x74, 0x61, 0x00,
+  0x6c, 0xfa, 0x00, 0x03, 0x01, 0x69, 0x00, 0x6d, 0x01, 0x01, 0x6e, 0x00,
+  0x28, 0xd5, 0x01, 0x6f, 0x00, 0x16, 0x7b, 0x01, 0x01, 0x08, 0x6e, 0x72,
+  0x65, 0x74, 0x73, 0x65, 0x77, 0x68, 0x00, 0x6d, 0x0f, 0x00, 0x05, 0x01,
+  0x62, 0x00, 0x58, 0xaf, 0x01, 0x6c, 0x00, 0x39, 0x28, 0x01, 0x6f, 0x00,
+  0x0f, 0xfa, 0x01, 0x74, 0x00, 0x61, 0x1a, 0x01, 0x76, 0x00, 0x58, 0xaf,
+  0x00, 0x01, 0x01, 0x74, 0x00, 0x2b, 0x7a, 0x00, 0x02, 0x01, 0x61, 0x00,
+  0x46, 0x83, 0x04, 0x6e, 0x61, 0x68, 0x63, 0x00, 0x6d, 0x16, 0x01, 0x02,
+  0x01, 0x72, 0x00, 0x62, 0x9c, 0x01, 0x74, 0x00, 0x13, 0x33, 0x00, 0x01,
+  0x01, 0x61, 0x00, 0x52, 0x55, 0x00, 0x02, 0x03, 0x70, 0x62, 0x67, 0x00,
+  0x0f, 0x92, 0x01, 0x74, 0x00, 0x1d, 0x23, 0x00, 0x07, 0x01, 0x67, 0x00,
+  0x5c, 0x4f, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x6f, 0x00, 0x0f, 0xfa,
+  0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x78,
+  0x00, 0x5c, 0x48, 0x01, 0x7a, 0x00, 0x5f, 0x90, 0x00, 0x08, 0x01, 0x32,
+  0x00, 0x60, 0x26, 0x01, 0x63, 0x00, 0x26, 0xd7, 0x01, 0x66, 0x00, 0x6d,
+  0x2e, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x69, 0x00, 0x6d, 0x35, 0x02,
+  0x6f, 0x63, 0x00, 0x6d, 0x3c, 0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x76,
+  0x00, 0x58, 0xaf, 0x00, 0x02, 0x01, 0x66, 0x00, 0x0e, 0x15, 0x01, 0x6d,
+  0x00, 0x6d, 0x43, 0x00, 0x03, 0x01, 0x62, 0x00, 0x6d, 0x54, 0x01, 0x63,
+  0x00, 0x0e, 0x15, 0x01, 0x6d, 0x00, 0x16, 0x7b, 0x00, 0x02, 0x01, 0x64,
+  0x00, 0x0e, 0x15, 0x01, 0x68, 0x00, 0x27, 0x0f, 0x00, 0x01, 0x01, 0x6c,
+  0x00, 0x6d, 0x60, 0x00, 0x06, 0x01, 0x65, 0x00, 0x6a, 0x6c, 0x01, 0x67,
+  0x00, 0x5c, 0x4f, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x74, 0x00, 0x22,
+  0x26, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x76, 0x00, 0x6d, 0x67, 0x00,
+  0x09, 0x01, 0x65, 0x00, 0x62, 0x13, 0x01, 0x6c, 0x00, 0x62, 0x22, 0x02,
+  0x6e, 0x6f, 0x00, 0x6d, 0x73, 0x01, 0x6f, 0x00, 0x0f, 0xfa, 0x01, 0x70,
+  0x00, 0x62, 0x2d, 0x0b, 0x72, 0x65, 0x74, 0x73, 0x75, 0x6c, 0x63, 0x2d,
+  0x67, 0x6e, 0x69, 0x00, 0x6d, 0x80, 0x01, 0x74, 0x00, 0x61, 0x1a, 0x01,
+  0x76, 0x00, 0x58, 0xaf, 0x04, 0x79, 0x61, 0x6c, 0x70, 0x00, 0x6d, 0x87,
+  0x00, 0x01, 0x01, 0x74, 0x00, 0x6d, 0x8e, 0x01, 0x01, 0x02, 0x2e, 0x67,
+  0x00, 0x26, 0xe5, 0x00, 0x02, 0x01, 0x63, 0x00, 0x6d, 0x95, 0x01, 0x68,
+  0x00, 0x4f, 0xff, 0x00, 0x01, 0x01, 0x69, 0x00, 0x16, 0x7b, 0x00, 0x16,
+  0x01, 0x61, 0x00, 0x6d, 0x9c, 0x01, 0x63, 0x00, 0x6d, 0xda, 0x01, 0x64,
+  0x00, 0x6d, 0xeb, 0x01, 0x65, 0x00, 0x6e, 0x06, 0x01, 0x67, 0x00, 0x6e,
+  0x2a, 0x06, 0x68, 0x63, 0x79, 0x7a, 0x72, 0x62, 0x00, 0x6e, 0x41, 0x01,
+  0x69, 0x00, 0x6e, 0x48, 0x01, 0x6b, 0x00, 0x6e, 0x64, 0x01, 0x6c, 0x00,
+  0x6e, 0x87, 0x01, 0x6d, 0x00, 0x6e, 0x98, 0x01, 0x6e, 0x00, 0x6e, 0xa9,
+  0x01, 0x6f, 0x00, 0x6e, 0xc0, 0x01, 0x70, 0x00, 0x6e, 0xea, 0x07, 0x72,
+  0x6f, 0x6d, 0x6f, 0x70, 0x68, 0x63, 0x00, 0x6f, 0x01, 0x01, 0x73, 0x00,
+  0x48, 0x25, 0x01, 0x74, 0x00, 0x6f, 0x08, 0x01, 0x75, 0x00, 0x27, 0x3a,
+  0x01, 0x76, 0x00, 0x6f, 0x26, 0x01, 0x77, 0x00, 0x6f, 0x33, 0x01, 0x78,
+  0x00, 0x25, 0x56, 0x01, 0x79, 0x00, 0x6f, 0x3f, 0x01, 0x7a, 0x00, 0x6f,
+  0x70, 0x00, 0x06, 0x01, 0x61, 0x00, 0x6f, 0x91, 0x01, 0x65, 0x00, 0x6f,
+  0x98, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01,
+  0x6f, 0x00, 0x6f, 0x9f, 0x01, 0x74, 0x00, 0x5c, 0x56, 0x01, 0x01, 0x01,
+  0x62, 0x00, 0x43, 0xb8, 0x00, 0x01, 0x03, 0x72, 0x65, 0x74, 0x00, 0x6f,
+  0xb0, 0x00, 0x02, 0x01, 0x72, 0x00, 0x26, 0xc4, 0x01, 0x74, 0x00, 0x6f,
+  0xb7, 0x00, 0x01, 0x01, 0x6d, 0x00, 0x26, 0xd7, 0x00, 0x04, 0x01, 0x6d,
+  0x00, 0x2f, 0x47, 0x01, 0x6f, 0x00, 0x0f, 0xfa, 0x01, 0x74, 0x00, 0x22,
+  0x26, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x00, 0x06, 0x01, 0x67, 0x00, 0x5c,
+  0x4f, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x02, 0x6f, 0x69, 0x00, 0x6f, 0xbe,
+  0x01, 0x72, 0x00, 0x6f, 0xc5, 0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x75,
+  0x00, 0x27, 0x3a, 0x00, 0x06, 0x01, 0x63, 0x00, 0x26, 0xd7, 0x01, 0x67,
+  0x00, 0x5c, 0x4f, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x6f, 0x00, 0x6f,
+  0xcd, 0x01, 0x74, 0x00, 0x6f, 0xd9, 0x01, 0x76, 0x00, 0x16, 0x7b, 0x00,
+  0x0b, 0x01, 0x64, 0x00, 0x13, 0x4d, 0x01, 0x65, 0x00, 0x6f, 0xe5, 0x01,
+  0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6c, 0x00, 0x39, 0x28, 0x01, 0x6d, 0x00,
+  0x68, 0x1c, 0x02, 0x6e, 0x69, 0x00, 0x6f, 0xf1, 0x01, 0x6f, 0x00, 0x60,
+  0x6f, 0x01, 0x70, 0x00, 0x6f, 0xf9, 0x01, 0x73, 0x00, 0x70, 0x00, 0x01,
+  0x75, 0x00, 0x27, 0x3a, 0x01, 0x76, 0x00, 0x6d, 0x67, 0x00, 0x01, 0x03,
+  0x68, 0x6b, 0x63, 0x00, 0x64, 0x48, 0x00, 0x07, 0x01, 0x64, 0x00, 0x5d,
+  0xb5, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6d, 0x00, 0x70, 0x13, 0x01,
+  0x6f, 0x00, 0x70, 0x1f, 0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x75, 0x00,
+  0x27, 0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x01, 0x02, 0x01, 0x2e, 0x00,
+  0x70, 0x2b, 0x01, 0x69, 0x00, 0x70, 0xbd, 0x00, 0x01, 0x01, 0x73, 0x00,
+  0x26, 0x53, 0x00, 0x02, 0x01, 0x65, 0x00, 0x5d, 0x25, 0x01, 0x6e, 0x00,
+  0x70, 0xc4, 0x00, 0x01, 0x01, 0x72, 0x00, 0x64, 0x48, 0x00, 0x01, 0x01,
+  0x74, 0x00, 0x70, 0xcb, 0x00, 0x07, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01,
+  0x6c, 0x00, 0x39, 0x28, 0x01, 0x6d, 0x00, 0x5d, 0x82, 0x01, 0x6f, 0x00,
+  0x0f, 0xfa, 0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x75, 0x00, 0x27, 0x3a,
+  0x01, 0x76, 0x00, 0x58, 0xaf, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x70, 0xd2,
+  0x00, 0x01, 0x01, 0x6f, 0x00, 0x16, 0x9c, 0x00, 0x0a, 0x01, 0x63, 0x00,
+  0x26, 0xd7, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x68, 0x00, 0x4f, 0xff,
+  0x01, 0x6c, 0x00, 0x39, 0x28, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x6f,
+  0x00, 0x5f, 0x78, 0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x75, 0x00, 0x27,
+  0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x01, 0x7a, 0x00, 0x5f, 0x90, 0x00,
+  0x01, 0x01, 0x70, 0x00, 0x29, 0xdf, 0x00, 0x01, 0x01, 0x61, 0x00, 0x71,
+  0x4b, 0x00, 0x01, 0x01, 0x73, 0x00, 0x27, 0x25, 0x00, 0x02, 0x02, 0x68,
+  0x69, 0x00, 0x5c, 0x48, 0x01, 0x71, 0x00, 0x71, 0x52, 0x00, 0x01, 0x01,
+  0x61, 0x00, 0x71, 0x59, 0x00, 0x01, 0x01, 0x61, 0x00, 0x5a, 0x57, 0x00,
+  0x06, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01,
+  0x6f, 0x00, 0x0f, 0xfa, 0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x75, 0x00,
+  0x27, 0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x00, 0x16, 0x01, 0x61, 0x00,
+  0x21, 0x6d, 0x01, 0x62, 0x00, 0x21, 0x6d, 0x01, 0x63, 0x00, 0x64, 0x73,
+  0x01, 0x64, 0x00, 0x71, 0x60, 0x01, 0x65, 0x00, 0x21, 0x6d, 0x01, 0x67,
+  0x00, 0x71, 0x7a, 0x01, 0x68, 0x00, 0x71, 0x86, 0x01, 0x69, 0x00, 0x71,
+  0x97, 0x01, 0x6a, 0x00, 0x71, 0xa3, 0x01, 0x6b, 0x00, 0x21, 0x6d, 0x01,
+  0x6c, 0x00, 0x71, 0xbe, 0x01, 0x6d, 0x00, 0x71, 0xcf, 0x01, 0x6e, 0x00,
+  0x71, 0xdc, 0x01, 0x6f, 0x00, 0x12, 0x22, 0x01, 0x71, 0x00, 0x0f, 0xfa,
+  0x01, 0x73, 0x00, 0x71, 0xf2, 0x01, 0x74, 0x00, 0x72, 0x06, 0x01, 0x75,
+  0x00, 0x27, 0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x01, 0x77, 0x00, 0x16,
+  0x7b, 0x01, 0x78, 0x00, 0x72, 0x1d, 0x01, 0x7a, 0x00, 0x72, 0x33, 0x01,
+  0x01, 0x03, 0x2e, 0x79, 0x70, 0x00, 0x72, 0x3f, 0x00, 0x01, 0x01, 0x61,
+  0x00, 0x0c, 0x1d, 0x00, 0x01, 0x01, 0x75, 0x00, 0x68, 0x09, 0x00, 0x01,
+  0x01, 0x6b, 0x00, 0x72, 0x46, 0x00, 0x01, 0x01, 0x74, 0x00, 0x16, 0x89,
+  0x00, 0x02, 0x05, 0x6c, 0x69, 0x62, 0x6f, 0x6d, 0x00, 0x72, 0x4d, 0x01,
+  0x77, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x6f, 0x00, 0x0e, 0x15, 0x01,
+  0x01, 0x01, 0x65, 0x00, 0x72, 0x54, 0x00, 0x06, 0x01, 0x63, 0x00, 0x26,
+  0xd7, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01,
+  0x74, 0x00, 0x22, 0x26, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x76, 0x00,
+  0x58, 0xaf, 0x00, 0x02, 0x02, 0x65, 0x64, 0x00, 0x72, 0x5d, 0x01, 0x69,
+  0x00, 0x72, 0x66, 0x00, 0x07, 0x01, 0x62, 0x00, 0x58, 0xaf, 0x01, 0x63,
+  0x00, 0x0f, 0xfa, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6c, 0x00, 0x39,
+  0x28, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x74, 0x00, 0x22, 0x26, 0x01,
+  0x75, 0x00, 0x27, 0x3a, 0x00, 0x14, 0x01, 0x61, 0x00, 0x0f, 0xfa, 0x01,
+  0x62, 0x00, 0x43, 0xb8, 0x01, 0x63, 0x00, 0x6b, 0x4c, 0x01, 0x64, 0x00,
+  0x66, 0x03, 0x01, 0x65, 0x00, 0x72, 0x6d, 0x01, 0x67, 0x00, 0x72, 0x79,
+  0x01, 0x69, 0x00, 0x72, 0x8f, 0x01, 0x6b, 0x00, 0x5d, 0xbc, 0x01, 0x6c,
+  0x00, 0x72, 0x9b, 0x01, 0x6d, 0x00, 0x72, 0xa7, 0x01, 0x6e, 0x00, 0x72,
+  0xb8, 0x01, 0x6f, 0x00, 0x72, 0xc4, 0x01, 0x70, 0x00, 0x72, 0xda, 0x01,
+  0x72, 0x00, 0x72, 0xe6, 0x01, 0x73, 0x00, 0x72, 0xf8, 0x01, 0x74, 0x00,
+  0x73, 0x16, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x76, 0x00, 0x5f, 0x84,
+  0x01, 0x79, 0x00, 0x5c, 0xb0, 0x01, 0x7a, 0x00, 0x5f, 0x90, 0x00, 0x01,
+  0x01, 0x6c, 0x00, 0x42, 0x43, 0x00, 0x01, 0x01, 0x72, 0x00, 0x4b, 0xdd,
+  0x00, 0x01, 0x01, 0x72, 0x00, 0x73, 0x35, 0x00, 0x04, 0x01, 0x67, 0x00,
+  0x5c, 0x4f, 0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x75, 0x00, 0x27, 0x3a,
+  0x01, 0x76, 0x00, 0x58, 0xaf, 0x00, 0x01, 0x01, 0x6f, 0x00, 0x35, 0x0c,
+  0x00, 0x01, 0x01, 0x6e, 0x00, 0x17, 0xbd, 0x00, 0x04, 0x01, 0x63, 0x00,
+  0x73, 0x3c, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x75, 0x00, 0x27, 0x3a,
+  0x01, 0x76, 0x00, 0x58, 0xaf, 0x00, 0x01, 0x01, 0x6e, 0x00, 0x46, 0x75,
+  0x00, 0x04, 0x01, 0x68, 0x00, 0x73, 0x43, 0x01, 0x6e, 0x00, 0x73, 0x4a,
+  0x03, 0x73, 0x69, 0x76, 0x00, 0x73, 0x57, 0x01, 0x74, 0x00, 0x73, 0x5e,
+  0x00, 0x01, 0x01, 0x72, 0x00, 0x64, 0xb6, 0x00, 0x01, 0x01, 0x61, 0x00,
+  0x0f, 0xfa, 0x00, 0x02, 0x01, 0x71, 0x00, 0x0e, 0x15, 0x01, 0x75, 0x00,
+  0x2f, 0x47, 0x00, 0x03, 0x01, 0x69, 0x00, 0x13, 0x33, 0x01, 0x70, 0x00,
+  0x1d, 0x34, 0x03, 0x73, 0x63, 0x69, 0x00, 0x73, 0x6a, 0x00, 0x02, 0x01,
+  0x72, 0x00, 0x56, 0x74, 0x01, 0x73, 0x00, 0x17, 0x57, 0x00, 0x01, 0x01,
+  0x61, 0x00, 0x3e, 0xb9, 0x00, 0x05, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01,
+  0x6f, 0x00, 0x0f, 0xfa, 0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x75, 0x00,
+  0x27, 0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x00, 0x02, 0x01, 0x63, 0x00,
+  0x0e, 0x15, 0x01, 0x79, 0x00, 0x53, 0x44, 0x01, 0x01, 0x02, 0x2e, 0x65,
+  0x00, 0x73, 0x71, 0x00, 0x06, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6d,
+  0x00, 0x2f, 0x47, 0x01, 0x6f, 0x00, 0x73, 0x78, 0x01, 0x74, 0x00, 0x73,
+  0x7f, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x76, 0x00, 0x73, 0x8b, 0x00,
+  0x09, 0x01, 0x64, 0x00, 0x73, 0x97, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01,
+  0x6c, 0x00, 0x51, 0x22, 0x01, 0x6d, 0x00, 0x73, 0xaa, 0x01, 0x6e, 0x00,
+  0x60, 0x40, 0x01, 0x6f, 0x00, 0x73, 0xb7, 0x01, 0x73, 0x00, 0x69, 0x73,
+  0x01, 0x74, 0x00, 0x73, 0xc3, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x01, 0x01,
+  0x01, 0x2e, 0x00, 0x73, 0xcf, 0x00, 0x01, 0x01, 0x74, 0x00, 0x1e, 0x59,
+  0x00, 0x01, 0x01, 0x61, 0x00, 0x74, 0x0f, 0x00, 0x0a, 0x01, 0x63, 0x00,
+  0x26, 0xd7, 0x01, 0x65, 0x00, 0x5d, 0x25, 0x01, 0x67, 0x00, 0x5c, 0x4f,
+  0x01, 0x68, 0x00, 0x74, 0x16, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x6f,
+  0x00, 0x60, 0x47, 0x01, 0x74, 0x00, 0x74, 0x1e, 0x01, 0x75, 0x00, 0x27,
+  0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x01, 0x7a, 0x00, 0x5f, 0x90, 0x01,
+  0x01, 0x01, 0x65, 0x00, 0x65, 0xc6, 0x00, 0x06, 0x01, 0x62, 0x00, 0x0f,
+  0x68, 0x01, 0x64, 0x00, 0x1d, 0x34, 0x01, 0x67, 0x00, 0x41, 0x08, 0x01,
+  0x6f, 0x00, 0x0f, 0xfa, 0x01, 0x74, 0x00, 0x2a, 0x10, 0x01, 0x76, 0x00,
+  0x0c, 0x1d, 0x00, 0x01, 0x01, 0x61, 0x00, 0x16, 0x7b, 0x00, 0x0d, 0x01,
+  0x61, 0x00, 0x74, 0x2f, 0x01, 0x62, 0x00, 0x6a, 0xd3, 0x02, 0x64, 0x75,
+  0x00, 0x74, 0x5b, 0x01, 0x65, 0x00, 0x74, 0x62, 0x01, 0x67, 0x00, 0x68,
+  0x10, 0x02, 0x69, 0x6b, 0x00, 0x6d, 0x60, 0x01, 0x6c, 0x00, 0x74, 0x70,
+  0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x6f, 0x00, 0x74, 0x7c, 0x03, 0x73,
+  0x61, 0x69, 0x00, 0x74, 0x9a, 0x01, 0x74, 0x00, 0x74, 0xa2, 0x01, 0x75,
+  0x00, 0x27, 0x3a, 0x01, 0x76, 0x00, 0x16, 0x7b, 0x00, 0x01, 0x01, 0x65,
+  0x00, 0x35, 0x51, 0x00, 0x01, 0x01, 0x6c, 0x00, 0x0c, 0x1d, 0x00, 0x0e,
+  0x01, 0x62, 0x00, 0x43, 0xb8, 0x01, 0x63, 0x00, 0x29, 0xdf, 0x02, 0x64,
+  0x72, 0x00, 0x74, 0xb5, 0x02, 0x65, 0x73, 0x00, 0x74, 0xc1, 0x01, 0x67,
+  0x00, 0x5c, 0x4f, 0x01, 0x69, 0x00, 0x74, 0xc8, 0x01, 0x6c, 0x00, 0x74,
+  0xcf, 0x01, 0x6d, 0x00, 0x74, 0xdd, 0x01, 0x6f, 0x00, 0x5c, 0xea, 0x03,
+  0x70, 0x61, 0x74, 0x00, 0x74, 0xe9, 0x01, 0x73, 0x00, 0x74, 0xf0, 0x01,
+  0x74, 0x00, 0x74, 0xff, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x76, 0x00,
+  0x58, 0xaf, 0x00, 0x01, 0x01, 0x72, 0x00, 0x26, 0xd7, 0x00, 0x02, 0x02,
+  0x65, 0x64, 0x00, 0x64, 0xd8, 0x01, 0x69, 0x00, 0x0f, 0xfa, 0x00, 0x08,
+  0x01, 0x62, 0x00, 0x6a, 0xd3, 0x01, 0x64, 0x00, 0x75, 0x23, 0x01, 0x67,
+  0x00, 0x5c, 0x4f, 0x01, 0x6c, 0x00, 0x39, 0x28, 0x01, 0x6d, 0x00, 0x2f,
+  0x47, 0x01, 0x74, 0x00, 0x75, 0x2a, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x01,
+  0x76, 0x00, 0x58, 0xaf, 0x00, 0x02, 0x01, 0x69, 0x00, 0x27, 0xf5, 0x01,
+  0x6f, 0x00, 0x1d, 0x1c, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x75, 0x36, 0x01,
+  0x02, 0x01, 0x61, 0x00, 0x12, 0x22, 0x01, 0x69, 0x00, 0x15, 0x5e, 0x00,
+  0x15, 0x02, 0x33, 0x35, 0x00, 0x75, 0x7e, 0x02, 0x38, 0x33, 0x00, 0x75,
+  0x85, 0x01, 0x61, 0x00, 0x75, 0x8c, 0x01, 0x62, 0x00, 0x75, 0x9b, 0x02,
+  0x63, 0x7a, 0x00, 0x21, 0x6d, 0x01, 0x64, 0x00, 0x75, 0xa8, 0x01, 0x65,
+  0x00, 0x75, 0xbf, 0x03, 0x67, 0x6e, 0x69, 0x00, 0x75, 0xef, 0x02, 0x69,
+  0x6c, 0x00, 0x76, 0x0c, 0x01, 0x6b, 0x00, 0x76, 0x13, 0x01, 0x6d, 0x00,
+  0x2f, 0x47, 0x01, 0x6e, 0x00, 0x76, 0x39, 0x01, 0x6f, 0x00, 0x76, 0x57,
+  0x01, 0x70, 0x00, 0x76, 0x63, 0x01, 0x72, 0x00, 0x76, 0x70, 0x01, 0x73,
+  0x00, 0x76, 0x7e, 0x01, 0x74, 0x00, 0x76, 0xb9, 0x06, 0x76, 0x67, 0x69,
+  0x62, 0x2e, 0x30, 0x00, 0x76, 0xd6, 0x01, 0x77, 0x00, 0x38, 0xd2, 0x01,
+  0x78, 0x00, 0x76, 0xdd, 0x01, 0x79, 0x00, 0x76, 0xf9, 0x00, 0x02, 0x01,
+  0x61, 0x00, 0x1d, 0x1c, 0x01, 0x75, 0x00, 0x77, 0x0a, 0x00, 0x01, 0x01,
+  0x68, 0x00, 0x0f, 0x68, 0x00, 0x08, 0x01, 0x65, 0x00, 0x5d, 0x25, 0x01,
+  0x67, 0x00, 0x5c, 0x4f, 0x01, 0x68, 0x00, 0x4f, 0xff, 0x01, 0x6c, 0x00,
+  0x39, 0x28, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x74, 0x00, 0x22, 0x26,
+  0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x00, 0x16,
+  0x01, 0x61, 0x00, 0x77, 0x16, 0x01, 0x62, 0x00, 0x77, 0xe5, 0x02, 0x63,
+  0x61, 0x00, 0x78, 0x40, 0x01, 0x64, 0x00, 0x78, 0x86, 0x01, 0x65, 0x00,
+  0x78, 0xbc, 0x01, 0x66, 0x00, 0x79, 0x08, 0x01, 0x67, 0x00, 0x79, 0x2d,
+  0x01, 0x68, 0x00, 0x79, 0x59, 0x01, 0x69, 0x00, 0x79, 0x70, 0x01, 0x6a,
+  0x00, 0x79, 0xaa, 0x01, 0x6b, 0x00, 0x79, 0xc7, 0x01, 0x6c, 0x00, 0x79,
+  0xe7, 0x01, 0x6d, 0x00, 0x7a, 0x19, 0x01, 0x6e, 0x00, 0x7a, 0x3e, 0x01,
+  0x6f, 0x00, 0x7a, 0x8d, 0x01, 0x70, 0x00, 0x7a, 0xd2, 0x01, 0x72, 0x00,
+  0x7a, 0xe3, 0x01, 0x73, 0x00, 0x7b, 0x04, 0x01, 0x74, 0x00, 0x7b, 0x34,
+  0x01, 0x75, 0x00, 0x7b, 0x62, 0x01, 0x76, 0x00, 0x7b, 0x86, 0x01, 0x79,
+  0x00, 0x7b, 0x94, 0x00, 0x01, 0x01, 0x6b, 0x00, 0x2a, 0x10, 0x00, 0x02,
+  0x01, 0x73, 0x00, 0x42, 0x43, 0x01, 0x74, 0x00, 0x29, 0x5f, 0x00, 0x01,
+  0x01, 0x61, 0x00, 0x26, 0xf3, 0x00, 0x01, 0x01, 0x74, 0x00, 0x43, 0x6a,
+  0x00, 0x0a, 0x01, 0x63, 0x00, 0x29, 0xdf, 0x01, 0x65, 0x00, 0x3f, 0x9e,
+  0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6d, 0x00, 0x7b, 0xa0, 0x01, 0x6f,
+  0x00, 0x5f, 0x78, 0x01, 0x70, 0x00, 0x15, 0xf4, 0x01, 0x73, 0x00, 0x67,
+  0x73, 0x01, 0x74, 0x00, 0x5c, 0x9d, 0x02, 0x77, 0x77, 0x00, 0x35, 0x51,
+  0x01, 0x79, 0x00, 0x5c, 0xb0, 0x00, 0x03, 0x01, 0x61, 0x00, 0x7b, 0xb1,
+  0x01, 0x72, 0x00, 0x16, 0x53, 0x01, 0x7a, 0x00, 0x0e, 0x15, 0x01, 0x01,
+  0x01, 0x2e, 0x00, 0x7b, 0xb8, 0x00, 0x07, 0x01, 0x65, 0x00, 0x12, 0x22,
+  0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x68, 0x00, 0x4f, 0xff, 0x01, 0x6d,
+  0x00, 0x2f, 0x47, 0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x75, 0x00, 0x27,
+  0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x00, 0x0a, 0x02, 0x31, 0x31, 0x00,
+  0x7b, 0xf1, 0x01, 0x61, 0x00, 0x7b, 0xf8, 0x01, 0x67, 0x00, 0x5c, 0x4f,
+  0x01, 0x6c, 0x00, 0x39, 0x28, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x6e,
+  0x00, 0x6f, 0x91, 0x05, 0x73, 0x75, 0x6c, 0x70, 0x6e, 0x00, 0x7b, 0xff,
+  0x01, 0x74, 0x00, 0x72, 0x06, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x76,
+  0x00, 0x7c, 0x06, 0x00, 0x04, 0x01, 0x68, 0x00, 0x0f, 0x68, 0x01, 0x6d,
+  0x00, 0x0e, 0x15, 0x01, 0x76, 0x00, 0x0e, 0x15, 0x01, 0x79, 0x00, 0x35,
+  0x0c, 0x00, 0x01, 0x01, 0x6f, 0x00, 0x26, 0xde, 0x00, 0x01, 0x01, 0x6f,
+  0x00, 0x16, 0x7b, 0x00, 0x01, 0x01, 0x68, 0x00, 0x0f, 0xfa, 0x00, 0x07,
+  0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x69, 0x00, 0x5d, 0x2c, 0x01, 0x6d,
+  0x00, 0x2f, 0x47, 0x01, 0x6f, 0x00, 0x60, 0x6f, 0x01, 0x70, 0x00, 0x30,
+  0x72, 0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x01,
+  0x01, 0x02, 0x2e, 0x6e, 0x00, 0x4d, 0x1e, 0x00, 0x16, 0x01, 0x61, 0x00,
+  0x7c, 0x12, 0x01, 0x62, 0x00, 0x13, 0x5b, 0x01, 0x63, 0x00, 0x7c, 0x71,
+  0x01, 0x64, 0x00, 0x7c, 0xa5, 0x01, 0x65, 0x00, 0x7c, 0xd9, 0x01, 0x67,
+  0x00, 0x7d, 0x3a, 0x01, 0x68, 0x00, 0x7d, 0x56, 0x01, 0x69, 0x00, 0x7d,
+  0x7e, 0x01, 0x6b, 0x00, 0x7d, 0xb3, 0x01, 0x6c, 0x00, 0x7d, 0xe9, 0x01,
+  0x6d, 0x00, 0x7e, 0x0c, 0x01, 0x6e, 0x00, 0x7e, 0x2b, 0x01, 0x6f, 0x00,
+  0x7e, 0x57, 0x01, 0x70, 0x00, 0x7e, 0xc5, 0x01, 0x72, 0x00, 0x7e, 0xd1,
+  0x01, 0x73, 0x00, 0x7e, 0xfd, 0x01, 0x74, 0x00, 0x7f, 0x25, 0x01, 0x75,
+  0x00, 0x7f, 0x4c, 0x07, 0x77, 0x6f, 0x6e, 0x73, 0x65, 0x74, 0x69, 0x00,
+  0x1b, 0x9f, 0x03, 0x78, 0x35, 0x79, 0x00, 0x7f, 0x75, 0x01, 0x79, 0x00,
+  0x7f, 0x7c, 0x03, 0x7a, 0x37, 0x32, 0x00, 0x7f, 0xb9, 0x00, 0x06, 0x01,
+  0x61, 0x00, 0x52, 0x55, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6d, 0x00,
+  0x2f, 0x47, 0x01, 0x70, 0x00, 0x29, 0xdf, 0x01, 0x75, 0x00, 0x27, 0x3a,
+  0x01, 0x76, 0x00, 0x58, 0xaf, 0x00, 0x01, 0x01, 0x75, 0x00, 0x16, 0xb8,
+  0x00, 0x02, 0x01, 0x70, 0x00, 0x7f, 0xc0, 0x01, 0x73, 0x00, 0x7f, 0xc7,
+  0x01, 0x01, 0x01, 0x2e, 0x00, 0x7f, 0xce, 0x00, 0x0d, 0x05, 0x30, 0x6d,
+  0x72, 0x6f, 0x66, 0x00, 0x7f, 0xe0, 0x01, 0x61, 0x00, 0x7f, 0xe7, 0x03,
+  0x62, 0x65, 0x77, 0x00, 0x7f, 0xf3, 0x01, 0x65, 0x00, 0x7f, 0xfa, 0x04,
+  0x69, 0x6c, 0x72, 0x65, 0x00, 0x80, 0x30, 0x01, 0x6b, 0x00, 0x80, 0x37,
+  0x02, 0x6c, 0x65, 0x00, 0x80, 0x49, 0x07, 0x6d, 0x61, 0x65, 0x72, 0x64,
+  0x65, 0x70, 0x00, 0x80, 0x55, 0x01, 0x6e, 0x00, 0x80, 0x5c, 0x02, 0x70,
+  0x6f, 0x00, 0x56, 0x74, 0x01, 0x72, 0x00, 0x80, 0x73, 0x01, 0x74, 0x00,
+  0x80, 0x7f, 0x04, 0x79, 0x66, 0x69, 0x6c, 0x00, 0x23, 0xda, 0x00, 0x01,
+  0x01, 0x6b, 0x00, 0x13, 0x33, 0x00, 0x01, 0x01, 0x6c, 0x00, 0x40, 0xdc,
+  0x01, 0x04, 0x02, 0x2e, 0x65, 0x00, 0x80, 0x94, 0x01, 0x63, 0x00, 0x26,
+  0xc4, 0x02, 0x6b, 0x6f, 0x00, 0x80, 0x9d, 0x03, 0x6e, 0x61, 0x79, 0x00,
+  0x40, 0x3c, 0x00, 0x0a, 0x01, 0x61, 0x00, 0x80, 0xa4, 0x01, 0x62, 0x00,
+  0x58, 0xaf, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6c, 0x00, 0x80, 0xb1,
+  0x01, 0x6d, 0x00, 0x64, 0x2e, 0x01, 0x70, 0x00, 0x6f, 0xf9, 0x01, 0x72,
+  0x00, 0x4c, 0x11, 0x01, 0x74, 0x00, 0x80, 0xbe, 0x01, 0x75, 0x00, 0x27,
+  0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x00, 0x01, 0x01, 0x6f, 0x00, 0x58,
+  0xaf, 0x00, 0x01, 0x01, 0x6f, 0x00, 0x27, 0x0f, 0x00, 0x02, 0x01, 0x61,
+  0x00, 0x16, 0x7b, 0x01, 0x73, 0x00, 0x80, 0xca, 0x00, 0x01, 0x01, 0x61,
+  0x00, 0x16, 0xb8, 0x00, 0x17, 0x02, 0x32, 0x31, 0x00, 0x0c, 0x1d, 0x01,
+  0x61, 0x00, 0x80, 0xd1, 0x01, 0x62, 0x00, 0x81, 0x12, 0x01, 0x63, 0x00,
+  0x81, 0x28, 0x01, 0x64, 0x00, 0x81, 0x43, 0x01, 0x65, 0x00, 0x81, 0x59,
+  0x01, 0x66, 0x00, 0x81, 0x83, 0x01, 0x67, 0x00, 0x81, 0x99, 0x01, 0x68,
+  0x00, 0x81, 0xba, 0x01, 0x69, 0x00, 0x81, 0xc1, 0x01, 0x6c, 0x00, 0x81,
+  0xed, 0x01, 0x6d, 0x00, 0x82, 0x04, 0x01, 0x6e, 0x00, 0x82, 0x24, 0x01,
+  0x6f, 0x00, 0x82, 0x2b, 0x01, 0x70, 0x00, 0x82, 0x54, 0x01, 0x71, 0x00,
+  0x44, 0x12, 0x01, 0x72, 0x00, 0x82, 0x6f, 0x01, 0x73, 0x00, 0x82, 0x8a,
+  0x01, 0x74, 0x00, 0x82, 0x9b, 0x01, 0x75, 0x00, 0x82, 0xbb, 0x01, 0x76,
+  0x00, 0x82, 0xd5, 0x01, 0x78, 0x00, 0x4b, 0xdd, 0x01, 0x7a, 0x00, 0x82,
+  0xf1, 0x00, 0x06, 0x01, 0x61, 0x00, 0x27, 0x0f, 0x01, 0x63, 0x00, 0x26,
+  0xd7, 0x01, 0x64, 0x00, 0x1d, 0x34, 0x01, 0x69, 0x00, 0x16, 0x9c, 0x01,
+  0x6f, 0x00, 0x69, 0x81, 0x01, 0x72, 0x00, 0x41, 0x08, 0x00, 0x01, 0x01,
+  0x63, 0x00, 0x48, 0x25, 0x00, 0x03, 0x01, 0x62, 0x00, 0x0e, 0x15, 0x01,
+  0x6e, 0x00, 0x83, 0x02, 0x01, 0x72, 0x00, 0x42, 0x43, 0x00, 0x02, 0x01,
+  0x61, 0x00, 0x31, 0x67, 0x03, 0x72, 0x68, 0x65, 0x00, 0x17, 0x57, 0x00,
+  0x03, 0x01, 0x63, 0x00, 0x83, 0x0e, 0x01, 0x73, 0x00, 0x41, 0xf9, 0x01,
+  0x74, 0x00, 0x83, 0x15, 0x00, 0x01, 0x02, 0x74, 0x6e, 0x00, 0x83, 0x21,
+  0x00, 0x02, 0x01, 0x63, 0x00, 0x46, 0x75, 0x01, 0x6f, 0x00, 0x83, 0x28,
+  0x00, 0x02, 0x01, 0x61, 0x00, 0x28, 0xd5, 0x04, 0x66, 0x66, 0x65, 0x61,
+  0x00, 0x20, 0xed, 0x00, 0x05, 0x01, 0x61, 0x00, 0x31, 0x9e, 0x01, 0x6c,
+  0x00, 0x83, 0x34, 0x01, 0x6e, 0x00, 0x83, 0x3b, 0x01, 0x73, 0x00, 0x83,
+  0x42, 0x01, 0x75, 0x00, 0x83, 0x56, 0x00, 0x02, 0x01, 0x6f, 0x00, 0x83,
+  0x5d, 0x03, 0x72, 0x65, 0x73, 0x00, 0x83, 0x6a, 0x00, 0x01, 0x01, 0x74,
+  0x00, 0x83, 0x71, 0x00, 0x0e, 0x02, 0x61, 0x74, 0x00, 0x83, 0x78, 0x03,
+  0x62, 0x65, 0x77, 0x00, 0x83, 0x7f, 0x01, 0x64, 0x00, 0x13, 0x4d, 0x01,
+  0x65, 0x00, 0x83, 0x8d, 0x02, 0x68, 0x6e, 0x00, 0x26, 0xf3, 0x01, 0x69,
+  0x00, 0x83, 0xa0, 0x01, 0x6d, 0x00, 0x68, 0x1c, 0x01, 0x6e, 0x00, 0x83,
+  0xaf, 0x01, 0x6f, 0x00, 0x60, 0x6f, 0x01, 0x70, 0x00, 0x62, 0x2d, 0x01,
+  0x73, 0x00, 0x83, 0xbb, 0x01, 0x74, 0x00, 0x83, 0xc7, 0x01, 0x76, 0x00,
+  0x6a, 0x84, 0x04, 0x78, 0x6f, 0x62, 0x69, 0x00, 0x83, 0xd8, 0x00, 0x06,
+  0x01, 0x65, 0x00, 0x83, 0xdf, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6d,
+  0x00, 0x2f, 0x47, 0x01, 0x74, 0x00, 0x5c, 0x56, 0x01, 0x75, 0x00, 0x27,
+  0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x00, 0x04, 0x01, 0x65, 0x00, 0x83,
+  0xe7, 0x02, 0x6d, 0x6f, 0x00, 0x83, 0xf3, 0x01, 0x74, 0x00, 0x61, 0x1a,
+  0x01, 0x7a, 0x00, 0x2a, 0x10, 0x00, 0x08, 0x01, 0x61, 0x00, 0x83, 0xff,
+  0x01, 0x63, 0x00, 0x26, 0xd7, 0x01, 0x64, 0x00, 0x2a, 0x10, 0x01, 0x67,
+  0x00, 0x5c, 0x4f, 0x01, 0x68, 0x00, 0x4f, 0xff, 0x01, 0x6f, 0x00, 0x0f,
+  0xfa, 0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x00,
+  0x02, 0x01, 0x68, 0x00, 0x0e, 0x15, 0x01, 0x70, 0x00, 0x29, 0xdf, 0x00,
+  0x0d, 0x01, 0x63, 0x00, 0x64, 0x73, 0x01, 0x65, 0x00, 0x84, 0x0c, 0x01,
+  0x67, 0x00, 0x35, 0x0c, 0x05, 0x69, 0x67, 0x67, 0x6e, 0x6f, 0x00, 0x84,
+  0x1d, 0x03, 0x6b, 0x75, 0x62, 0x00, 0x84, 0x24, 0x01, 0x6c, 0x00, 0x84,
+  0x32, 0x03, 0x6d, 0x61, 0x6e, 0x00, 0x84, 0x24, 0x01, 0x6e, 0x00, 0x84,
+  0x3f, 0x01, 0x6f, 0x00, 0x69, 0x81, 0x01, 0x72, 0x00, 0x41, 0x08, 0x01,
+  0x73, 0x00, 0x84, 0x4c, 0x01, 0x74, 0x00, 0x61, 0x1a, 0x01, 0x75, 0x00,
+  0x84, 0x5d, 0x00, 0x01, 0x01, 0x69, 0x00, 0x84, 0x69, 0x00, 0x02, 0x01,
+  0x74, 0x00, 0x61, 0x1a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x00, 0x01, 0x01,
+  0x74, 0x00, 0x84, 0x70, 0x00, 0x02, 0x01, 0x63, 0x00, 0x84, 0x77, 0x01,
+  0x6c, 0x00, 0x5a, 0x14, 0x00, 0x0b, 0x01, 0x61, 0x00, 0x84, 0x83, 0x01,
+  0x63, 0x00, 0x26, 0xd7, 0x01, 0x65, 0x00, 0x5d, 0x25, 0x01, 0x66, 0x00,
+  0x67, 0x81, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6d, 0x00, 0x2f, 0x47,
+  0x01, 0x6f, 0x00, 0x60, 0x47, 0x01, 0x74, 0x00, 0x84, 0x8a, 0x01, 0x75,
+  0x00, 0x27, 0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x01, 0x7a, 0x00, 0x5f,
+  0x90, 0x00, 0x11, 0x01, 0x32, 0x00, 0x60, 0x26, 0x01, 0x62, 0x00, 0x43,
+  0xb8, 0x02, 0x63, 0x6e, 0x00, 0x18, 0x81, 0x01, 0x65, 0x00, 0x5d, 0x25,
+  0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6b, 0x00, 0x84, 0x96, 0x01, 0x6c,
+  0x00, 0x84, 0x9d, 0x01, 0x6d, 0x00, 0x64, 0x2e, 0x01, 0x6e, 0x00, 0x64,
+  0x65, 0x01, 0x6f, 0x00, 0x5c, 0xea, 0x01, 0x70, 0x00, 0x84, 0xae, 0x01,
+  0x72, 0x00, 0x1e, 0x60, 0x02, 0x73, 0x62, 0x00, 0x15, 0x5e, 0x01, 0x74,
+  0x00, 0x22, 0x26, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x76, 0x00, 0x84,
+  0xb5, 0x01, 0x7a, 0x00, 0x5f, 0x90, 0x00, 0x01, 0x01, 0x69, 0x00, 0x16,
+  0xcd, 0x00, 0x01, 0x01, 0x65, 0x00, 0x27, 0xf5, 0x00, 0x01, 0x01, 0x6c,
+  0x00, 0x4b, 0xdd, 0x00, 0x01, 0x03, 0x74, 0x73, 0x69, 0x00, 0x31, 0x05,
+  0x00, 0x06, 0x01, 0x65, 0x00, 0x35, 0x51, 0x01, 0x67, 0x00, 0x5c, 0x4f,
+  0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x75,
+  0x00, 0x27, 0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x00, 0x03, 0x01, 0x68,
+  0x00, 0x84, 0xc6, 0x01, 0x70, 0x00, 0x0e, 0x15, 0x01, 0x74, 0x00, 0x84,
+  0xcd, 0x00, 0x02, 0x04, 0x69, 0x77, 0x72, 0x69, 0x00, 0x5f, 0xdf, 0x02,
+  0x6f, 0x6d, 0x00, 0x84, 0xdf, 0x00, 0x01, 0x01, 0x65, 0x00, 0x84, 0xe6,
+  0x00, 0x05, 0x01, 0x62, 0x00, 0x84, 0xed, 0x01, 0x67, 0x00, 0x5c, 0x4f,
+  0x02, 0x6d, 0x6f, 0x00, 0x84, 0xfa, 0x01, 0x70, 0x00, 0x62, 0x2d, 0x01,
+  0x75, 0x00, 0x27, 0x3a, 0x01, 0x01, 0x03, 0x2e, 0x65, 0x6e, 0x00, 0x85,
+  0x06, 0x00, 0x02, 0x02, 0x64, 0x32, 0x00, 0x1d, 0x23, 0x02, 0x6f, 0x63,
+  0x00, 0x85, 0x0f, 0x00, 0x02, 0x01, 0x63, 0x00, 0x85, 0x18, 0x01, 0x67,
+  0x00, 0x85, 0x1f, 0x00, 0x03, 0x02, 0x6c, 0x70, 0x00, 0x59, 0x4e, 0x03,
+  0x72, 0x74, 0x73, 0x00, 0x85, 0x26, 0x07, 0x74, 0x72, 0x65, 0x70, 0x6f,
+  0x72, 0x70, 0x00, 0x85, 0x2d, 0x00, 0x01, 0x01, 0x69, 0x00, 0x27, 0xf5,
+  0x00, 0x05, 0x01, 0x61, 0x00, 0x35, 0x51, 0x01, 0x63, 0x00, 0x85, 0x34,
+  0x01, 0x65, 0x00, 0x85, 0x3d, 0x02, 0x67, 0x6e, 0x00, 0x85, 0x44, 0x01,
+  0x70, 0x00, 0x70, 0xcb, 0x00, 0x03, 0x01, 0x61, 0x00, 0x0c, 0x1d, 0x01,
+  0x6f, 0x00, 0x21, 0x6d, 0x01, 0x72, 0x00, 0x6a, 0xcc, 0x00, 0x01, 0x01,
+  0x75, 0x00, 0x16, 0x7b, 0x00, 0x01, 0x01, 0x69, 0x00, 0x85, 0x4b, 0x00,
+  0x02, 0x01, 0x69, 0x00, 0x16, 0x7b, 0x02, 0x75, 0x74, 0x00, 0x85, 0x52,
+  0x00, 0x02, 0x01, 0x69, 0x00, 0x85, 0x60, 0x01, 0x72, 0x00, 0x85, 0x6c,
+  0x00, 0x01, 0x01, 0x6f, 0x00, 0x60, 0x6f, 0x00, 0x01, 0x01, 0x69, 0x00,
+  0x0c, 0x1d, 0x00, 0x01, 0x01, 0x6c, 0x00, 0x32, 0x5a, 0x00, 0x06, 0x05,
+  0x65, 0x6b, 0x61, 0x63, 0x70, 0x00, 0x5d, 0x09, 0x01, 0x67, 0x00, 0x5c,
+  0x4f, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x74, 0x00, 0x74, 0x1e, 0x01,
+  0x75, 0x00, 0x27, 0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x00, 0x01, 0x01,
+  0x30, 0x00, 0x25, 0xce, 0x00, 0x01, 0x01, 0x6e, 0x00, 0x6b, 0x7d, 0x00,
+  0x01, 0x01, 0x61, 0x00, 0x0f, 0x68, 0x00, 0x01, 0x01, 0x61, 0x00, 0x31,
+  0x67, 0x00, 0x02, 0x02, 0x6f, 0x72, 0x00, 0x85, 0x73, 0x01, 0x75, 0x00,
+  0x27, 0x0f, 0x00, 0x08, 0x01, 0x63, 0x00, 0x64, 0x73, 0x01, 0x65, 0x00,
+  0x1e, 0x60, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6f, 0x00, 0x5f, 0x78,
+  0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x76,
+  0x00, 0x58, 0xaf, 0x01, 0x7a, 0x00, 0x5f, 0x90, 0x00, 0x02, 0x01, 0x65,
+  0x00, 0x1e, 0x60, 0x01, 0x74, 0x00, 0x85, 0x7a, 0x00, 0x02, 0x01, 0x73,
+  0x00, 0x85, 0x81, 0x03, 0x74, 0x6f, 0x68, 0x00, 0x85, 0x2d, 0x00, 0x01,
+  0x01, 0x72, 0x00, 0x13, 0x33, 0x00, 0x07, 0x01, 0x62, 0x00, 0x29, 0x5f,
+  0x05, 0x65, 0x74, 0x69, 0x73, 0x69, 0x00, 0x85, 0x88, 0x01, 0x67, 0x00,
+  0x5c, 0x4f, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x74, 0x00, 0x22, 0x26,
+  0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x01, 0x01,
+  0x0a, 0x2e, 0x74, 0x6e, 0x69, 0x6f, 0x70, 0x74, 0x68, 0x67, 0x69, 0x00,
+  0x85, 0x8f, 0x00, 0x01, 0x01, 0x61, 0x00, 0x3a, 0x7d, 0x00, 0x03, 0x01,
+  0x66, 0x00, 0x0e, 0x15, 0x01, 0x67, 0x00, 0x83, 0x21, 0x01, 0x6f, 0x00,
+  0x26, 0xde, 0x00, 0x01, 0x01, 0x73, 0x00, 0x85, 0x96, 0x00, 0x02, 0x01,
+  0x61, 0x00, 0x85, 0x9d, 0x01, 0x67, 0x00, 0x85, 0xa9, 0x00, 0x02, 0x02,
+  0x69, 0x74, 0x00, 0x85, 0xb0, 0x01, 0x70, 0x00, 0x85, 0x6c, 0x00, 0x01,
+  0x01, 0x6e, 0x00, 0x2f, 0x47, 0x00, 0x01, 0x01, 0x65, 0x00, 0x47, 0x51,
+  0x00, 0x01, 0x01, 0x70, 0x00, 0x6f, 0x01, 0x00, 0x02, 0x03, 0x6f, 0x68,
+  0x70, 0x00, 0x27, 0x08, 0x01, 0x75, 0x00, 0x26, 0xd7, 0x00, 0x07, 0x01,
+  0x63, 0x00, 0x25, 0x56, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6d, 0x00,
+  0x2f, 0x47, 0x01, 0x6f, 0x00, 0x85, 0xc5, 0x01, 0x74, 0x00, 0x22, 0x26,
+  0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x00, 0x03,
+  0x05, 0x68, 0x73, 0x72, 0x61, 0x6c, 0x00, 0x85, 0xcc, 0x01, 0x6c, 0x00,
+  0x85, 0xd3, 0x01, 0x74, 0x00, 0x0e, 0x15, 0x00, 0x0a, 0x01, 0x61, 0x00,
+  0x5d, 0xbc, 0x01, 0x63, 0x00, 0x26, 0xd7, 0x01, 0x67, 0x00, 0x5c, 0x4f,
+  0x01, 0x6e, 0x00, 0x2a, 0x10, 0x01, 0x6f, 0x00, 0x0f, 0xfa, 0x01, 0x74,
+  0x00, 0x61, 0x1a, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x76, 0x00, 0x58,
+  0xaf, 0x01, 0x78, 0x00, 0x41, 0x08, 0x08, 0x79, 0x6c, 0x64, 0x6e, 0x65,
+  0x72, 0x62, 0x2e, 0x00, 0x85, 0xda, 0x00, 0x03, 0x01, 0x63, 0x00, 0x0e,
+  0x15, 0x01, 0x70, 0x00, 0x0e, 0x15, 0x02, 0x74, 0x69, 0x00, 0x38, 0x2f,
+  0x00, 0x07, 0x05, 0x64, 0x6c, 0x69, 0x75, 0x62, 0x00, 0x85, 0xe1, 0x01,
+  0x65, 0x00, 0x71, 0x59, 0x01, 0x67, 0x00, 0x83, 0x0e, 0x01, 0x6c, 0x00,
+  0x85, 0xec, 0x01, 0x6d, 0x00, 0x85, 0xf3, 0x01, 0x6e, 0x00, 0x85, 0xfa,
+  0x01, 0x77, 0x00, 0x86, 0x06, 0x00, 0x02, 0x03, 0x63, 0x61, 0x72, 0x00,
+  0x4f, 0xea, 0x03, 0x6f, 0x6d, 0x61, 0x00, 0x45, 0xad, 0x00, 0x08, 0x01,
+  0x65, 0x00, 0x12, 0x22, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x68, 0x00,
+  0x4f, 0xff, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x74, 0x00, 0x22, 0x26,
+  0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x01, 0x7a,
+  0x00, 0x5f, 0x90, 0x00, 0x03, 0x01, 0x6e, 0x00, 0x86, 0x0d, 0x02, 0x72,
+  0x70, 0x00, 0x86, 0x1c, 0x01, 0x78, 0x00, 0x27, 0x01, 0x00, 0x01, 0x01,
+  0x77, 0x00, 0x27, 0x0f, 0x00, 0x02, 0x01, 0x65, 0x00, 0x86, 0x24, 0x01,
+  0x6f, 0x00, 0x15, 0x5e, 0x00, 0x02, 0x01, 0x63, 0x00, 0x3d, 0xfb, 0x01,
+  0x72, 0x00, 0x13, 0x33, 0x00, 0x02, 0x01, 0x63, 0x00, 0x45, 0xa6, 0x01,
+  0x67, 0x00, 0x4a, 0x66, 0x00, 0x02, 0x02, 0x61, 0x74, 0x00, 0x86, 0x30,
+  0x01, 0x65, 0x00, 0x86, 0x39, 0x00, 0x15, 0x01, 0x61, 0x00, 0x86, 0x47,
+  0x01, 0x63, 0x00, 0x86, 0x76, 0x01, 0x64, 0x00, 0x86, 0x87, 0x01, 0x65,
+  0x00, 0x86, 0xa7, 0x01, 0x68, 0x00, 0x86, 0xc2, 0x01, 0x69, 0x00, 0x86,
+  0xce, 0x01, 0x6a, 0x00, 0x86, 0xee, 0x01, 0x6b, 0x00, 0x86, 0xf5, 0x01,
+  0x6c, 0x00, 0x87, 0x01, 0x01, 0x6d, 0x00, 0x86, 0xee, 0x01, 0x6e, 0x00,
+  0x87, 0x12, 0x01, 0x6f, 0x00, 0x87, 0x2f, 0x01, 0x70, 0x00, 0x87, 0x40,
+  0x01, 0x72, 0x00, 0x87, 0x4c, 0x01, 0x73, 0x00, 0x87, 0x5d, 0x01, 0x74,
+  0x00, 0x87, 0x79, 0x02, 0x75, 0x67, 0x00, 0x87, 0x8f, 0x01, 0x76, 0x00,
+  0x87, 0x96, 0x01, 0x78, 0x00, 0x87, 0xa2, 0x01, 0x79, 0x00, 0x87, 0xaf,
+  0x02, 0x7a, 0x61, 0x00, 0x87, 0x8f, 0x01, 0x01, 0x01, 0x75, 0x00, 0x53,
+  0x44, 0x01, 0x01, 0x06, 0x2e, 0x79, 0x74, 0x72, 0x61, 0x70, 0x00, 0x87,
+  0xc5, 0x00, 0x01, 0x01, 0x65, 0x00, 0x87, 0xcc, 0x00, 0x02, 0x01, 0x6c,
+  0x00, 0x0e, 0x15, 0x01, 0x6e, 0x00, 0x0e, 0x15, 0x00, 0x08, 0x01, 0x36,
+  0x00, 0x87, 0xd3, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6d, 0x00, 0x2f,
+  0x47, 0x06, 0x72, 0x6f, 0x73, 0x69, 0x76, 0x64, 0x00, 0x5c, 0xa9, 0x01,
+  0x73, 0x00, 0x87, 0xda, 0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x75, 0x00,
+  0x27, 0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x00, 0x02, 0x01, 0x69, 0x00,
+  0x87, 0xe6, 0x01, 0x6e, 0x00, 0x87, 0xed, 0x00, 0x01, 0x01, 0x6e, 0x00,
+  0x6d, 0x60, 0x00, 0x01, 0x01, 0x6c, 0x00, 0x5d, 0x63, 0x00, 0x0c, 0x01,
+  0x61, 0x00, 0x62, 0xb8, 0x02, 0x63, 0x61, 0x00, 0x87, 0xf9, 0x02, 0x65,
+  0x74, 0x00, 0x88, 0x01, 0x03, 0x67, 0x6e, 0x69, 0x00, 0x88, 0x09, 0x01,
+  0x6f, 0x00, 0x88, 0x1b, 0x01, 0x70, 0x00, 0x69, 0xbd, 0x01, 0x72, 0x00,
+  0x88, 0x29, 0x09, 0x73, 0x6d, 0x63, 0x65, 0x72, 0x75, 0x74, 0x75, 0x66,
+  0x00, 0x88, 0x3e, 0x01, 0x76, 0x00, 0x88, 0x45, 0x01, 0x78, 0x00, 0x63,
+  0xf2, 0x01, 0x79, 0x00, 0x69, 0xf3, 0x01, 0x7a, 0x00, 0x5f, 0x90, 0x01,
+  0x01, 0x03, 0x61, 0x73, 0x69, 0x00, 0x88, 0x51, 0x00, 0x01, 0x01, 0x61,
+  0x00, 0x72, 0x4d, 0x00, 0x01, 0x01, 0x63, 0x00, 0x88, 0x58, 0x00, 0x01,
+  0x01, 0x74, 0x00, 0x4d, 0x56, 0x00, 0x02, 0x01, 0x6c, 0x00, 0x25, 0x56,
+  0x03, 0x72, 0x69, 0x64, 0x00, 0x88, 0x5f, 0x00, 0x01, 0x01, 0x63, 0x00,
+  0x27, 0x0f, 0x00, 0x08, 0x01, 0x65, 0x00, 0x5d, 0x25, 0x01, 0x67, 0x00,
+  0x5c, 0x4f, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x6f, 0x00, 0x5c, 0xea,
+  0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x76,
+  0x00, 0x58, 0xaf, 0x01, 0x7a, 0x00, 0x5f, 0x90, 0x00, 0x01, 0x01, 0x72,
+  0x00, 0x43, 0x6a, 0x00, 0x02, 0x01, 0x63, 0x00, 0x88, 0x67, 0x01, 0x72,
+  0x00, 0x13, 0x33, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x88, 0x6e, 0x00, 0x01,
+  0x01, 0x72, 0x00, 0x89, 0x17, 0x00, 0x09, 0x01, 0x62, 0x00, 0x58, 0xaf,
+  0x01, 0x64, 0x00, 0x66, 0x03, 0x01, 0x65, 0x00, 0x1e, 0x60, 0x01, 0x67,
+  0x00, 0x68, 0x10, 0x01, 0x6c, 0x00, 0x39, 0x28, 0x01, 0x6d, 0x00, 0x2f,
+  0x47, 0x01, 0x6f, 0x00, 0x16, 0x7b, 0x01, 0x74, 0x00, 0x22, 0x26, 0x01,
+  0x75, 0x00, 0x27, 0x3a, 0x00, 0x09, 0x01, 0x64, 0x00, 0x5d, 0xb5, 0x01,
+  0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6c, 0x00, 0x89, 0x1e, 0x01, 0x6d, 0x00,
+  0x67, 0xc1, 0x01, 0x6f, 0x00, 0x89, 0x2a, 0x02, 0x70, 0x6f, 0x00, 0x89,
+  0x3b, 0x01, 0x74, 0x00, 0x89, 0x47, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x01,
+  0x76, 0x00, 0x6a, 0x84, 0x00, 0x15, 0x01, 0x61, 0x00, 0x89, 0x59, 0x01,
+  0x62, 0x00, 0x89, 0xca, 0x01, 0x63, 0x00, 0x8a, 0x2d, 0x01, 0x64, 0x00,
+  0x8a, 0x52, 0x01, 0x65, 0x00, 0x8a, 0x5e, 0x01, 0x67, 0x00, 0x8a, 0xa3,
+  0x01, 0x68, 0x00, 0x0f, 0xfa, 0x01, 0x69, 0x00, 0x8a, 0xd2, 0x01, 0x6c,
+  0x00, 0x8b, 0x10, 0x01, 0x6d, 0x00, 0x8b, 0x26, 0x01, 0x6e, 0x00, 0x8b,
+  0x41, 0x01, 0x6f, 0x00, 0x8b, 0x70, 0x01, 0x70, 0x00, 0x8b, 0xba, 0x01,
+  0x71, 0x00, 0x26, 0xd7, 0x01, 0x72, 0x00, 0x8b, 0xd0, 0x01, 0x73, 0x00,
+  0x8c, 0x0e, 0x01, 0x74, 0x00, 0x8c, 0x43, 0x01, 0x75, 0x00, 0x8c, 0x75,
+  0x01, 0x76, 0x00, 0x8c, 0x8b, 0x01, 0x79, 0x00, 0x8c, 0xab, 0x01, 0x7a,
+  0x00, 0x8c, 0xca, 0x00, 0x01, 0x01, 0x65, 0x00, 0x66, 0xc6, 0x00, 0x01,
+  0x01, 0x74, 0x00, 0x66, 0x03, 0x00, 0x01, 0x01, 0x64, 0x00, 0x26, 0xd7,
+  0x00, 0x04, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6d, 0x00, 0x64, 0x2e,
+  0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x00, 0x03,
+  0x08, 0x6d, 0x6f, 0x72, 0x6f, 0x63, 0x6b, 0x69, 0x76, 0x00, 0x3b, 0x02,
+  0x01, 0x72, 0x00, 0x8c, 0xe0, 0x01, 0x74, 0x00, 0x86, 0x30, 0x00, 0x03,
+  0x01, 0x67, 0x00, 0x0e, 0x15, 0x01, 0x6d, 0x00, 0x8c, 0xe9, 0x01, 0x72,
+  0x00, 0x0e, 0x15, 0x01, 0x03, 0x01, 0x2e, 0x00, 0x62, 0x0c, 0x01, 0x6d,
+  0x00, 0x0e, 0x15, 0x03, 0x6f, 0x70, 0x64, 0x00, 0x8c, 0xfa, 0x00, 0x01,
+  0x02, 0x6f, 0x63, 0x00, 0x8d, 0x01, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x8d,
+  0x08, 0x00, 0x01, 0x01, 0x72, 0x00, 0x53, 0x44, 0x00, 0x02, 0x02, 0x65,
+  0x64, 0x00, 0x4b, 0x7d, 0x01, 0x73, 0x00, 0x0e, 0x15, 0x00, 0x08, 0x09,
+  0x62, 0x65, 0x77, 0x61, 0x6e, 0x69, 0x67, 0x61, 0x70, 0x00, 0x6a, 0xab,
+  0x01, 0x65, 0x00, 0x2c, 0x10, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6c,
+  0x00, 0x8d, 0x16, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x74, 0x00, 0x74,
+  0x1e, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x01,
+  0x01, 0x01, 0x6d, 0x00, 0x8d, 0x1d, 0x00, 0x03, 0x01, 0x65, 0x00, 0x1d,
+  0x1c, 0x03, 0x70, 0x75, 0x73, 0x00, 0x2a, 0x45, 0x01, 0x73, 0x00, 0x0e,
+  0x15, 0x00, 0x08, 0x06, 0x61, 0x64, 0x61, 0x78, 0x69, 0x61, 0x00, 0x8d,
+  0x29, 0x01, 0x65, 0x00, 0x8d, 0x30, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01,
+  0x6c, 0x00, 0x39, 0x28, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x6f, 0x00,
+  0x8d, 0x46, 0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x75, 0x00, 0x27, 0x3a,
+  0x00, 0x02, 0x01, 0x63, 0x00, 0x2b, 0x46, 0x01, 0x66, 0x00, 0x0e, 0x15,
+  0x00, 0x03, 0x01, 0x62, 0x00, 0x0e, 0x15, 0x01, 0x72, 0x00, 0x0e, 0x15,
+  0x01, 0x75, 0x00, 0x8d, 0x58, 0x01, 0x02, 0x01, 0x72, 0x00, 0x86, 0x06,
+  0x01, 0x74, 0x00, 0x8d, 0x5f, 0x00, 0x02, 0x01, 0x68, 0x00, 0x8d, 0x66,
+  0x01, 0x70, 0x00, 0x8d, 0x6d, 0x00, 0x01, 0x01, 0x72, 0x00, 0x16, 0x7b,
+  0x00, 0x0c, 0x01, 0x65, 0x00, 0x5d, 0x25, 0x01, 0x67, 0x00, 0x5c, 0x4f,
+  0x01, 0x69, 0x00, 0x5d, 0x2c, 0x01, 0x6c, 0x00, 0x85, 0xec, 0x01, 0x6d,
+  0x00, 0x70, 0x13, 0x01, 0x6f, 0x00, 0x8d, 0x74, 0x01, 0x70, 0x00, 0x6f,
+  0xf9, 0x01, 0x73, 0x00, 0x8d, 0x85, 0x01, 0x74, 0x00, 0x5c, 0xfd, 0x01,
+  0x75, 0x00, 0x27, 0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x01, 0x7a, 0x00,
+  0x5f, 0x90, 0x00, 0x01, 0x01, 0x79, 0x00, 0x21, 0x6d, 0x01, 0x02, 0x01,
+  0x62, 0x00, 0x37, 0xd5, 0x02, 0x69, 0x72, 0x00, 0x4c, 0xde, 0x00, 0x01,
+  0x01, 0x61, 0x00, 0x21, 0x6d, 0x00, 0x01, 0x01, 0x67, 0x00, 0x5c, 0x4f,
+  0x00, 0x01, 0x02, 0x73, 0x73, 0x00, 0x14, 0xed, 0x00, 0x0e, 0x01, 0x61,
+  0x00, 0x8d, 0x8c, 0x01, 0x63, 0x00, 0x4b, 0xdd, 0x01, 0x64, 0x00, 0x8d,
+  0x98, 0x01, 0x66, 0x00, 0x4d, 0x56, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x03,
+  0x6d, 0x6f, 0x63, 0x00, 0x8d, 0xa4, 0x01, 0x6e, 0x00, 0x8d, 0xab, 0x01,
+  0x6f, 0x00, 0x5c, 0xea, 0x01, 0x73, 0x00, 0x43, 0x6a, 0x01, 0x74, 0x00,
+  0x8d, 0xb2, 0x03, 0x75, 0x64, 0x65, 0x00, 0x8d, 0xc3, 0x03, 0x76, 0x6f,
+  0x67, 0x00, 0x8d, 0xca, 0x02, 0x77, 0x73, 0x00, 0x0f, 0x6f, 0x01, 0x7a,
+  0x00, 0x41, 0x08, 0x00, 0x06, 0x01, 0x66, 0x00, 0x66, 0x03, 0x01, 0x67,
+  0x00, 0x5c, 0x4f, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x74, 0x00, 0x22,
+  0x26, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x01,
+  0x01, 0x0b, 0x2e, 0x74, 0x69, 0x72, 0x2e, 0x73, 0x65, 0x67, 0x61, 0x70,
+  0x2d, 0x00, 0x6a, 0xdf, 0x00, 0x01, 0x01, 0x61, 0x00, 0x15, 0x5e, 0x00,
+  0x07, 0x01, 0x64, 0x00, 0x8d, 0xd1, 0x03, 0x65, 0x6e, 0x6f, 0x00, 0x8d,
+  0xd8, 0x01, 0x6c, 0x00, 0x62, 0x22, 0x01, 0x6e, 0x00, 0x65, 0x19, 0x06,
+  0x6f, 0x64, 0x61, 0x67, 0x6f, 0x64, 0x00, 0x8d, 0xe6, 0x01, 0x73, 0x00,
+  0x8d, 0xee, 0x01, 0x79, 0x00, 0x5c, 0xb0, 0x00, 0x07, 0x01, 0x62, 0x00,
+  0x43, 0xb8, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6d, 0x00, 0x8d, 0xfb,
+  0x01, 0x6f, 0x00, 0x5c, 0xea, 0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x75,
+  0x00, 0x27, 0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x00, 0x11, 0x02, 0x30,
+  0x30, 0x00, 0x75, 0x85, 0x01, 0x61, 0x00, 0x8e, 0x07, 0x04, 0x65, 0x64,
+  0x73, 0x7a, 0x00, 0x46, 0x7c, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x02, 0x69,
+  0x6c, 0x00, 0x13, 0x5b, 0x01, 0x6c, 0x00, 0x6c, 0x0a, 0x01, 0x6d, 0x00,
+  0x8e, 0x18, 0x06, 0x6e, 0x61, 0x6c, 0x74, 0x61, 0x67, 0x00, 0x66, 0x03,
+  0x01, 0x6f, 0x00, 0x8e, 0x30, 0x01, 0x70, 0x00, 0x15, 0xf4, 0x02, 0x72,
+  0x61, 0x00, 0x8e, 0x50, 0x01, 0x73, 0x00, 0x8e, 0x57, 0x01, 0x74, 0x00,
+  0x8e, 0x68, 0x01, 0x76, 0x00, 0x8e, 0x7a, 0x02, 0x78, 0x65, 0x00, 0x8e,
+  0x81, 0x01, 0x79, 0x00, 0x3c, 0xcc, 0x04, 0x7a, 0x73, 0x61, 0x67, 0x00,
+  0x61, 0xc1, 0x00, 0x02, 0x01, 0x65, 0x00, 0x62, 0x13, 0x01, 0x74, 0x00,
+  0x61, 0x1a, 0x00, 0x07, 0x01, 0x63, 0x00, 0x26, 0xd7, 0x01, 0x67, 0x00,
+  0x5c, 0x4f, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x6f, 0x00, 0x0f, 0xfa,
+  0x01, 0x72, 0x00, 0x41, 0x08, 0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x76,
+  0x00, 0x58, 0xaf, 0x00, 0x03, 0x09, 0x64, 0x75, 0x6f, 0x6c, 0x63, 0x65,
+  0x73, 0x69, 0x72, 0x00, 0x8e, 0x8d, 0x03, 0x65, 0x6e, 0x69, 0x00, 0x8e,
+  0x94, 0x05, 0x74, 0x65, 0x6e, 0x6b, 0x63, 0x00, 0x27, 0x72, 0x00, 0x01,
+  0x01, 0x6e, 0x00, 0x83, 0x34, 0x01, 0x01, 0x01, 0x63, 0x00, 0x0e, 0x15,
+  0x00, 0x15, 0x02, 0x33, 0x6b, 0x00, 0x26, 0xde, 0x01, 0x61, 0x00, 0x8e,
+  0xa1, 0x01, 0x62, 0x00, 0x8e, 0xad, 0x01, 0x63, 0x00, 0x26, 0xd7, 0x03,
+  0x64, 0x75, 0x6f, 0x00, 0x8e, 0xb4, 0x01, 0x65, 0x00, 0x8e, 0xbd, 0x01,
+  0x67, 0x00, 0x8e, 0xca, 0x02, 0x69, 0x61, 0x00, 0x8e, 0xe5, 0x01, 0x6b,
+  0x00, 0x8e, 0xee, 0x02, 0x6c, 0x69, 0x00, 0x8e, 0xfa, 0x01, 0x6d, 0x00,
+  0x2f, 0x47, 0x05, 0x6e, 0x61, 0x74, 0x73, 0x65, 0x00, 0x8f, 0x0c, 0x06,
+  0x6f, 0x6e, 0x69, 0x6a, 0x79, 0x6d, 0x00, 0x8f, 0x13, 0x01, 0x70, 0x00,
+  0x0f, 0x68, 0x02, 0x72, 0x69, 0x00, 0x8f, 0x1a, 0x01, 0x73, 0x00, 0x8f,
+  0x2b, 0x01, 0x74, 0x00, 0x8f, 0x37, 0x01, 0x75, 0x00, 0x8f, 0x53, 0x02,
+  0x76, 0x6f, 0x00, 0x8f, 0x5f, 0x01, 0x79, 0x00, 0x8f, 0x6b, 0x02, 0x7a,
+  0x61, 0x00, 0x8f, 0x73, 0x00, 0x01, 0x01, 0x79, 0x00, 0x0f, 0xfa, 0x00,
+  0x0e, 0x01, 0x61, 0x00, 0x8f, 0x7d, 0x01, 0x62, 0x00, 0x8e, 0xad, 0x02,
+  0x64, 0x61, 0x00, 0x8f, 0xac, 0x03, 0x67, 0x75, 0x6e, 0x00, 0x16, 0xd4,
+  0x01, 0x69, 0x00, 0x8f, 0xc0, 0x01, 0x6b, 0x00, 0x8f, 0xdb, 0x01, 0x6c,
+  0x00, 0x8f, 0xf1, 0x02, 0x6e, 0x61, 0x00, 0x8f, 0xff, 0x02, 0x6f, 0x76,
+  0x00, 0x90, 0x16, 0x01, 0x72, 0x00, 0x90, 0x20, 0x01, 0x74, 0x00, 0x90,
+  0x31, 0x02, 0x76, 0x6f, 0x00, 0x90, 0x40, 0x01, 0x79, 0x00, 0x8f, 0x6b,
+  0x01, 0x7a, 0x00, 0x90, 0x4e, 0x00, 0x02, 0x01, 0x61, 0x00, 0x90, 0x5b,
+  0x01, 0x69, 0x00, 0x90, 0x62, 0x00, 0x07, 0x01, 0x65, 0x00, 0x12, 0x22,
+  0x01, 0x67, 0x00, 0x68, 0x10, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x6e,
+  0x00, 0x0f, 0xfa, 0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x75, 0x00, 0x27,
+  0x3a, 0x01, 0x76, 0x00, 0x28, 0xd5, 0x00, 0x01, 0x01, 0x79, 0x00, 0x1d,
+  0x1c, 0x00, 0x05, 0x01, 0x65, 0x00, 0x2c, 0x10, 0x01, 0x67, 0x00, 0x5c,
+  0x4f, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x74, 0x00, 0x90, 0x6f, 0x01,
+  0x75, 0x00, 0x27, 0x3a, 0x00, 0x0d, 0x01, 0x32, 0x00, 0x1d, 0x1c, 0x01,
+  0x61, 0x00, 0x90, 0x7b, 0x01, 0x65, 0x00, 0x90, 0x82, 0x01, 0x67, 0x00,
+  0x90, 0x9f, 0x01, 0x68, 0x00, 0x90, 0xb2, 0x01, 0x6c, 0x00, 0x90, 0xbc,
+  0x01, 0x6f, 0x00, 0x90, 0xc8, 0x04, 0x70, 0x70, 0x61, 0x2d, 0x00, 0x90,
+  0xd5, 0x01, 0x73, 0x00, 0x90, 0xdc, 0x0a, 0x74, 0x72, 0x65, 0x63, 0x6c,
+  0x61, 0x63, 0x6f, 0x6c, 0x2e, 0x00, 0x90, 0xe9, 0x02, 0x76, 0x72, 0x00,
+  0x90, 0xf0, 0x08, 0x77, 0x65, 0x69, 0x76, 0x65, 0x72, 0x70, 0x62, 0x00,
+  0x90, 0xfc, 0x01, 0x79, 0x00, 0x91, 0x03, 0x00, 0x09, 0x01, 0x64, 0x00,
+  0x2a, 0x10, 0x01, 0x66, 0x00, 0x4d, 0x56, 0x01, 0x67, 0x00, 0x5c, 0x4f,
+  0x01, 0x6c, 0x00, 0x39, 0x28, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x6e,
+  0x00, 0x8d, 0xab, 0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x75, 0x00, 0x27,
+  0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x00, 0x0a, 0x01, 0x65, 0x00, 0x5d,
+  0x25, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6c, 0x00, 0x39, 0x28, 0x01,
+  0x6d, 0x00, 0x70, 0x13, 0x01, 0x6f, 0x00, 0x91, 0x14, 0x01, 0x70, 0x00,
+  0x6f, 0xf9, 0x01, 0x74, 0x00, 0x5c, 0xfd, 0x01, 0x75, 0x00, 0x27, 0x3a,
+  0x01, 0x76, 0x00, 0x58, 0xaf, 0x01, 0x7a, 0x00, 0x5f, 0x90, 0x00, 0x05,
+  0x01, 0x62, 0x00, 0x58, 0xaf, 0x01, 0x64, 0x00, 0x29, 0xdf, 0x01, 0x67,
+  0x00, 0x5c, 0x4f, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x75, 0x00, 0x27,
+  0x3a, 0x00, 0x03, 0x07, 0x62, 0x65, 0x77, 0x2d, 0x65, 0x68, 0x74, 0x00,
+  0x91, 0x20, 0x05, 0x6e, 0x61, 0x68, 0x74, 0x2d, 0x00, 0x91, 0x27, 0x01,
+  0x73, 0x00, 0x91, 0x36, 0x00, 0x01, 0x01, 0x6f, 0x00, 0x0f, 0x6f, 0x00,
+  0x02, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6f, 0x00, 0x0f, 0xfa, 0x00,
+  0x04, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01,
+  0x74, 0x00, 0x22, 0x26, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x00, 0x07, 0x01,
+  0x62, 0x00, 0x6b, 0x69, 0x01, 0x64, 0x00, 0x66, 0x03, 0x01, 0x67, 0x00,
+  0x5c, 0x4f, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x74, 0x00, 0x22, 0x26,
+  0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x00, 0x09,
+  0x01, 0x63, 0x00, 0x26, 0xd7, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6d,
+  0x00, 0x70, 0x13, 0x01, 0x6f, 0x00, 0x0f, 0xfa, 0x01, 0x70, 0x00, 0x6f,
+  0xf9, 0x01, 0x74, 0x00, 0x5c, 0xfd, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x01,
+  0x76, 0x00, 0x58, 0xaf, 0x01, 0x7a, 0x00, 0x5f, 0x90, 0x00, 0x01, 0x01,
+  0x73, 0x00, 0x64, 0xb6, 0x00, 0x07, 0x03, 0x33, 0x34, 0x34, 0x00, 0x5c,
+  0x48, 0x01, 0x64, 0x00, 0x1d, 0x34, 0x01, 0x65, 0x00, 0x0f, 0x6f, 0x01,
+  0x6f, 0x00, 0x69, 0x81, 0x01, 0x72, 0x00, 0x41, 0x08, 0x01, 0x73, 0x00,
+  0x5c, 0xdc, 0x02, 0x75, 0x61, 0x00, 0x91, 0x3d, 0x00, 0x07, 0x01, 0x63,
+  0x00, 0x26, 0xd7, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6c, 0x00, 0x39,
+  0x28, 0x01, 0x6f, 0x00, 0x0f, 0xfa, 0x01, 0x70, 0x00, 0x6f, 0xf9, 0x01,
+  0x74, 0x00, 0x22, 0x26, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x00, 0x0a, 0x04,
+  0x61, 0x34, 0x36, 0x6f, 0x00, 0x6b, 0xf6, 0x01, 0x62, 0x00, 0x91, 0x44,
+  0x01, 0x65, 0x00, 0x91, 0x52, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6c,
+  0x00, 0x91, 0x59, 0x03, 0x6d, 0x6f, 0x63, 0x00, 0x91, 0x65, 0x01, 0x74,
+  0x00, 0x5c, 0x56, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x76, 0x00, 0x6b,
+  0xe5, 0x01, 0x7a, 0x00, 0x91, 0x71, 0x00, 0x05, 0x01, 0x63, 0x00, 0x26,
+  0xd7, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6c, 0x00, 0x39, 0x28, 0x01,
+  0x6f, 0x00, 0x0f, 0xfa, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x00, 0x07, 0x01,
+  0x63, 0x00, 0x12, 0x22, 0x01, 0x65, 0x00, 0x15, 0x5e, 0x01, 0x67, 0x00,
+  0x0c, 0x1d, 0x01, 0x73, 0x00, 0x91, 0x78, 0x01, 0x74, 0x00, 0x42, 0x43,
+  0x01, 0x75, 0x00, 0x1d, 0x34, 0x01, 0x79, 0x00, 0x5c, 0x48, 0x00, 0x03,
+  0x01, 0x68, 0x00, 0x28, 0xce, 0x01, 0x6f, 0x00, 0x5c, 0xea, 0x01, 0x76,
+  0x00, 0x58, 0xaf, 0x00, 0x02, 0x01, 0x65, 0x00, 0x16, 0x9c, 0x01, 0x6e,
+  0x00, 0x45, 0xa6, 0x01, 0x01, 0x01, 0x6e, 0x00, 0x53, 0x44, 0x00, 0x05,
+  0x01, 0x62, 0x00, 0x58, 0xaf, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6d,
+  0x00, 0x2f, 0x47, 0x01, 0x74, 0x00, 0x5c, 0x56, 0x01, 0x75, 0x00, 0x27,
+  0x3a, 0x00, 0x01, 0x01, 0x67, 0x00, 0x1b, 0x10, 0x01, 0x01, 0x01, 0x78,
+  0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x65, 0x00, 0x5c, 0x48, 0x00, 0x02,
+  0x01, 0x6a, 0x00, 0x16, 0x7b, 0x01, 0x6b, 0x00, 0x16, 0x7b, 0x00, 0x01,
+  0x01, 0x75, 0x00, 0x26, 0x0f, 0x01, 0x02, 0x01, 0x69, 0x00, 0x91, 0x84,
+  0x02, 0x6f, 0x74, 0x00, 0x91, 0x91, 0x01, 0x01, 0x01, 0x69, 0x00, 0x26,
+  0x53, 0x00, 0x01, 0x02, 0x64, 0x61, 0x00, 0x91, 0xa1, 0x00, 0x06, 0x04,
+  0x64, 0x75, 0x6f, 0x6c, 0x00, 0x8d, 0xd1, 0x01, 0x66, 0x00, 0x41, 0x08,
+  0x01, 0x68, 0x00, 0x90, 0xb2, 0x01, 0x6c, 0x00, 0x39, 0x28, 0x01, 0x6d,
+  0x00, 0x64, 0x2e, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x00, 0x01, 0x01, 0x75,
+  0x00, 0x1d, 0x1c, 0x00, 0x0a, 0x01, 0x63, 0x00, 0x26, 0xd7, 0x01, 0x64,
+  0x00, 0x68, 0x28, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6c, 0x00, 0x39,
+  0x28, 0x01, 0x6d, 0x00, 0x91, 0xa8, 0x01, 0x6f, 0x00, 0x13, 0x4d, 0x01,
+  0x73, 0x00, 0x91, 0xb5, 0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x76, 0x00,
+  0x58, 0xaf, 0x01, 0x7a, 0x00, 0x5f, 0x90, 0x00, 0x01, 0x03, 0x6d, 0x72,
+  0x61, 0x00, 0x44, 0xf1, 0x00, 0x01, 0x01, 0x65, 0x00, 0x71, 0x4b, 0x00,
+  0x01, 0x01, 0x6f, 0x00, 0x0c, 0x1d, 0x00, 0x01, 0x01, 0x6e, 0x00, 0x73,
+  0x35, 0x00, 0x03, 0x01, 0x64, 0x00, 0x91, 0xc5, 0x01, 0x6f, 0x00, 0x12,
+  0x22, 0x03, 0x72, 0x6f, 0x74, 0x00, 0x28, 0xce, 0x00, 0x01, 0x01, 0x63,
+  0x00, 0x12, 0x22, 0x00, 0x07, 0x01, 0x65, 0x00, 0x15, 0x5e, 0x01, 0x67,
+  0x00, 0x5c, 0x4f, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x6f, 0x00, 0x0f,
+  0xfa, 0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x01,
+  0x76, 0x00, 0x58, 0xaf, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x2f, 0x47, 0x00,
+  0x01, 0x01, 0x65, 0x00, 0x69, 0x73, 0x00, 0x01, 0x01, 0x6f, 0x00, 0x44,
+  0xf1, 0x00, 0x08, 0x01, 0x63, 0x00, 0x85, 0xc5, 0x01, 0x64, 0x00, 0x91,
+  0xcc, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x68, 0x00, 0x4f, 0xff, 0x01,
+  0x6d, 0x00, 0x2f, 0x47, 0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x75, 0x00,
+  0x27, 0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x01, 0x01, 0x01, 0x6e, 0x00,
+  0x91, 0xd8, 0x00, 0x02, 0x01, 0x61, 0x00, 0x0e, 0x15, 0x01, 0x69, 0x00,
+  0x26, 0xde, 0x00, 0x01, 0x01, 0x70, 0x00, 0x13, 0x5b, 0x00, 0x08, 0x01,
+  0x65, 0x00, 0x5d, 0x25, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6c, 0x00,
+  0x39, 0x28, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x74, 0x00, 0x5c, 0x56,
+  0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x01, 0x7a,
+  0x00, 0x5f, 0x90, 0x01, 0x01, 0x03, 0x2e, 0x6c, 0x61, 0x00, 0x91, 0xdf,
+  0x00, 0x02, 0x02, 0x66, 0x66, 0x00, 0x3d, 0xfb, 0x01, 0x70, 0x00, 0x2b,
+  0x46, 0x00, 0x07, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6c, 0x00, 0x39,
+  0x28, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x70, 0x00, 0x6f, 0xf9, 0x01,
+  0x74, 0x00, 0x22, 0x26, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x76, 0x00,
+  0x58, 0xaf, 0x00, 0x04, 0x01, 0x63, 0x00, 0x5f, 0x5e, 0x01, 0x67, 0x00,
+  0x91, 0xe6, 0x01, 0x6c, 0x00, 0x47, 0xc9, 0x02, 0x76, 0x69, 0x00, 0x67,
+  0x20, 0x00, 0x01, 0x01, 0x65, 0x00, 0x91, 0xed, 0x00, 0x01, 0x04, 0x74,
+  0x63, 0x65, 0x72, 0x00, 0x91, 0xf4, 0x00, 0x01, 0x01, 0x6e, 0x00, 0x85,
+  0x6c, 0x00, 0x01, 0x01, 0x78, 0x00, 0x12, 0xe2, 0x00, 0x01, 0x01, 0x66,
+  0x00, 0x1c, 0x65, 0x00, 0x05, 0x01, 0x63, 0x00, 0x0e, 0x15, 0x03, 0x6c,
+  0x65, 0x64, 0x00, 0x60, 0x40, 0x01, 0x6e, 0x00, 0x91, 0xfb, 0x01, 0x72,
+  0x00, 0x92, 0x0c, 0x01, 0x73, 0x00, 0x92, 0x18, 0x00, 0x01, 0x01, 0x61,
+  0x00, 0x29, 0xdf, 0x00, 0x02, 0x02, 0x61, 0x70, 0x00, 0x2e, 0xfb, 0x02,
+  0x65, 0x70, 0x00, 0x67, 0x81, 0x00, 0x01, 0x01, 0x61, 0x00, 0x73, 0x35,
+  0x00, 0x06, 0x01, 0x62, 0x00, 0x38, 0x2f, 0x01, 0x67, 0x00, 0x5c, 0x4f,
+  0x01, 0x6c, 0x00, 0x39, 0x28, 0x01, 0x6d, 0x00, 0x64, 0x2e, 0x01, 0x74,
+  0x00, 0x22, 0x26, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x01, 0x01, 0x74,
+  0x00, 0x92, 0x21, 0x00, 0x01, 0x01, 0x6c, 0x00, 0x41, 0x08, 0x00, 0x0a,
+  0x01, 0x65, 0x00, 0x5d, 0x25, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6c,
+  0x00, 0x39, 0x28, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x6f, 0x00, 0x60,
+  0x47, 0x01, 0x70, 0x00, 0x0f, 0x68, 0x01, 0x74, 0x00, 0x5c, 0xfd, 0x01,
+  0x75, 0x00, 0x27, 0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x01, 0x7a, 0x00,
+  0x5f, 0x90, 0x00, 0x07, 0x01, 0x61, 0x00, 0x28, 0x66, 0x01, 0x67, 0x00,
+  0x5c, 0x4f, 0x01, 0x6a, 0x00, 0x92, 0x28, 0x01, 0x6d, 0x00, 0x2f, 0x47,
+  0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x76,
+  0x00, 0x58, 0xaf, 0x00, 0x05, 0x01, 0x34, 0x00, 0x1d, 0x34, 0x0b, 0x69,
+  0x6e, 0x75, 0x6d, 0x2e, 0x64, 0x75, 0x6f, 0x6c, 0x63, 0x2e, 0x00, 0x92,
+  0x2f, 0x01, 0x6d, 0x00, 0x92, 0x3b, 0x01, 0x6f, 0x00, 0x0f, 0xfa, 0x01,
+  0x74, 0x00, 0x61, 0x1a, 0x00, 0x08, 0x01, 0x63, 0x00, 0x48, 0x25, 0x01,
+  0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6c, 0x00, 0x92, 0x51, 0x01, 0x6d, 0x00,
+  0x92, 0x58, 0x01, 0x6f, 0x00, 0x60, 0x6f, 0x01, 0x74, 0x00, 0x75, 0x2a,
+  0x01, 0x75, 0x00, 0x27, 0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x00, 0x09,
+  0x01, 0x64, 0x00, 0x64, 0xeb, 0x01, 0x65, 0x00, 0x92, 0x64, 0x02, 0x69,
+  0x7a, 0x00, 0x61, 0xc1, 0x09, 0x6c, 0x69, 0x61, 0x72, 0x74, 0x65, 0x76,
+  0x69, 0x74, 0x00, 0x92, 0x7a, 0x05, 0x6e, 0x61, 0x66, 0x61, 0x6d, 0x00,
+  0x12, 0x22, 0x01, 0x70, 0x00, 0x92, 0x81, 0x06, 0x72, 0x65, 0x74, 0x74,
+  0x65, 0x62, 0x00, 0x92, 0x92, 0x03, 0x73, 0x6e, 0x64, 0x00, 0x92, 0x99,
+  0x01, 0x78, 0x00, 0x5c, 0x4f, 0x00, 0x07, 0x01, 0x64, 0x00, 0x92, 0xa5,
+  0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6c, 0x00, 0x39, 0x28, 0x01, 0x6d,
+  0x00, 0x2f, 0x47, 0x01, 0x74, 0x00, 0x92, 0xae, 0x01, 0x75, 0x00, 0x27,
+  0x3a, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x00, 0x07, 0x01, 0x63, 0x00, 0x26,
+  0xd7, 0x01, 0x67, 0x00, 0x5c, 0x4f, 0x01, 0x6c, 0x00, 0x39, 0x28, 0x01,
+  0x6f, 0x00, 0x0f, 0xfa, 0x01, 0x74, 0x00, 0x22, 0x26, 0x01, 0x75, 0x00,
+  0x27, 0x3a, 0x01, 0x76, 0x00, 0x92, 0xc7, 0x00, 0x0a, 0x05, 0x61, 0x73,
+  0x71, 0x2d, 0x69, 0x00, 0x92, 0xd3, 0x01, 0x63, 0x00, 0x26, 0xd7, 0x01,
+  0x67, 0x00, 0x5c, 0x4f, 0x01, 0x68, 0x00, 0x74, 0x16, 0x01, 0x69, 0x00,
+  0x92, 0xda, 0x01, 0x6b, 0x00, 0x92, 0xe7, 0x01, 0x6c, 0x00, 0x5f, 0x3a,
+  0x01, 0x6e, 0x00, 0x64, 0x65, 0x01, 0x6f, 0x00, 0x92, 0xee, 0x01, 0x74,
+  0x00, 0x92, 0xf5, 0x01, 0x01, 0x04, 0x6e, 0x69, 0x66, 0x6c, 0x00, 0x26,
+  0x53, 0x00, 0x03, 0x01, 0x63, 0x00, 0x26, 0xd7, 0x01, 0x67, 0x00, 0x5c,
+  0x4f, 0x01, 0x6f, 0x00, 0x0f, 0xfa, 0x00, 0x07, 0x01, 0x63, 0x00, 0x64,
+  0x73, 0x01, 0x65, 0x00, 0x64, 0x7f, 0x01, 0x69, 0x00, 0x5d, 0x2c, 0x01,
+  0x6c, 0x00, 0x93, 0x0b, 0x01, 0x6f, 0x00, 0x93, 0x17, 0x01, 0x72, 0x00,
+  0x41, 0x08, 0x01, 0x76, 0x00, 0x16, 0x7b, 0x00, 0x04, 0x01, 0x67, 0x00,
+  0x5c, 0x4f, 0x01, 0x6d, 0x00, 0x2f, 0x47, 0x01, 0x6f, 0x00, 0x0f, 0xfa,
+  0x01, 0x74, 0x00, 0x22, 0x26, 0x00, 0x01, 0x01, 0x77, 0x00, 0x56, 0x74,
+  0x00, 0x04, 0x01, 0x65, 0x00, 0x93, 0x28, 0x05, 0x67, 0x6e, 0x69, 0x74,
+  0x66, 0x00, 0x93, 0x37, 0x02, 0x6f, 0x74, 0x00, 0x4d, 0x64, 0x06, 0x74,
+  0x69, 0x62, 0x65, 0x6c, 0x65, 0x00, 0x93, 0x3e, 0x00, 0x01, 0x01, 0x78,
+  0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x72, 0x00, 0x41, 0x08, 0x00, 0x02,
+  0x01, 0x65, 0x00, 0x0f, 0x6f, 0x01, 0x6f, 0x00, 0x93, 0x45, 0x00, 0x03,
+  0x01, 0x61, 0x00, 0x0e, 0x15, 0x01, 0x6d, 0x00, 0x0e, 0x15, 0x01, 0x6e,
+  0x00, 0x0e, 0x15, 0x00, 0x03, 0x01, 0x62, 0x00, 0x0e, 0x15, 0x01, 0x67,
+  0x00, 0x0e, 0x15, 0x01, 0x71, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x01, 0x73,
+  0x00, 0x0e, 0x15, 0x01, 0x79, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x02, 0x69,
+  0x2d, 0x00, 0x56, 0x74, 0x01, 0x6f, 0x00, 0x93, 0x4c, 0x00, 0x02, 0x01,
+  0x6e, 0x00, 0x0e, 0x15, 0x01, 0x6f, 0x00, 0x93, 0x45, 0x00, 0x01, 0x01,
+  0x61, 0x00, 0x14, 0x4a, 0x00, 0x01, 0x01, 0x73, 0x00, 0x51, 0x91, 0x00,
+  0x02, 0x03, 0x65, 0x6d, 0x61, 0x00, 0x13, 0x4d, 0x01, 0x66, 0x00, 0x26,
+  0xd7, 0x00, 0x01, 0x01, 0x72, 0x00, 0x2f, 0x47, 0x00, 0x01, 0x01, 0x70,
+  0x00, 0x2a, 0x10, 0x00, 0x01, 0x03, 0x72, 0x65, 0x6d, 0x00, 0x93, 0x54,
+  0x00, 0x01, 0x01, 0x6e, 0x00, 0x93, 0x5b, 0x00, 0x01, 0x01, 0x74, 0x00,
+  0x41, 0x08, 0x00, 0x01, 0x01, 0x66, 0x00, 0x66, 0x03, 0x00, 0x02, 0x01,
+  0x65, 0x00, 0x0f, 0x68, 0x01, 0x6e, 0x00, 0x15, 0x5e, 0x00, 0x02, 0x01,
+  0x65, 0x00, 0x0f, 0x6f, 0x01, 0x6e, 0x00, 0x2a, 0x10, 0x00, 0x01, 0x01,
+  0x75, 0x00, 0x0f, 0xfa, 0x00, 0x01, 0x01, 0x64, 0x00, 0x29, 0xdf, 0x00,
+  0x01, 0x01, 0x73, 0x00, 0x93, 0x62, 0x00, 0x01, 0x01, 0x6b, 0x00, 0x62,
+  0x3b, 0x00, 0x01, 0x01, 0x6d, 0x00, 0x29, 0x66, 0x00, 0x01, 0x01, 0x62,
+  0x00, 0x64, 0xb6, 0x00, 0x01, 0x01, 0x6f, 0x00, 0x85, 0xcc, 0x00, 0x03,
+  0x01, 0x63, 0x00, 0x0e, 0x15, 0x01, 0x66, 0x00, 0x66, 0x03, 0x01, 0x72,
+  0x00, 0x0f, 0x68, 0x00, 0x02, 0x01, 0x64, 0x00, 0x0e, 0x15, 0x01, 0x6f,
+  0x00, 0x0e, 0x15, 0x00, 0x02, 0x01, 0x75, 0x00, 0x0e, 0x15, 0x01, 0x77,
+  0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x63, 0x00, 0x51, 0x91, 0x00, 0x02,
+  0x01, 0x65, 0x00, 0x12, 0x22, 0x01, 0x6c, 0x00, 0x27, 0x0f, 0x00, 0x02,
+  0x01, 0x6e, 0x00, 0x2a, 0x10, 0x01, 0x72, 0x00, 0x41, 0x08, 0x00, 0x01,
+  0x01, 0x6f, 0x00, 0x93, 0x69, 0x00, 0x06, 0x02, 0x34, 0x36, 0x00, 0x67,
+  0x3c, 0x01, 0x36, 0x00, 0x5c, 0xcc, 0x01, 0x69, 0x00, 0x93, 0x75, 0x01,
+  0x6e, 0x00, 0x93, 0x75, 0x04, 0x72, 0x64, 0x64, 0x61, 0x00, 0x93, 0x7c,
+  0x02, 0x73, 0x69, 0x00, 0x93, 0x83, 0x00, 0x01, 0x01, 0x75, 0x00, 0x0f,
+  0x68, 0x00, 0x01, 0x01, 0x65, 0x00, 0x12, 0x22, 0x00, 0x01, 0x01, 0x75,
+  0x00, 0x0e, 0x15, 0x00, 0x06, 0x02, 0x63, 0x69, 0x00, 0x93, 0x8a, 0x02,
+  0x65, 0x6d, 0x00, 0x88, 0x67, 0x01, 0x69, 0x00, 0x93, 0x91, 0x01, 0x73,
+  0x00, 0x93, 0x9f, 0x01, 0x74, 0x00, 0x93, 0xac, 0x03, 0x76, 0x61, 0x74,
+  0x00, 0x64, 0x6c, 0x00, 0x03, 0x06, 0x61, 0x72, 0x67, 0x6f, 0x76, 0x6f,
+  0x00, 0x93, 0xb3, 0x01, 0x6f, 0x00, 0x93, 0xba, 0x01, 0x74, 0x00, 0x26,
+  0xde, 0x00, 0x03, 0x01, 0x68, 0x00, 0x93, 0xc5, 0x02, 0x6e, 0x76, 0x00,
+  0x36, 0xd0, 0x01, 0x74, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x01, 0x69, 0x00,
+  0x0e, 0x15, 0x01, 0x6e, 0x00, 0x2a, 0x10, 0x00, 0x02, 0x01, 0x6c, 0x00,
+  0x0e, 0x15, 0x01, 0x72, 0x00, 0x41, 0x08, 0x00, 0x02, 0x03, 0x73, 0x74,
+  0x76, 0x00, 0x93, 0xd1, 0x05, 0x79, 0x6b, 0x73, 0x74, 0x79, 0x00, 0x93,
+  0xd8, 0x00, 0x03, 0x01, 0x63, 0x00, 0x0e, 0x15, 0x01, 0x6d, 0x00, 0x0e,
+  0x15, 0x01, 0x73, 0x00, 0x93, 0xe2, 0x00, 0x03, 0x04, 0x69, 0x70, 0x6f,
+  0x6e, 0x00, 0x93, 0xf4, 0x06, 0x6f, 0x70, 0x6f, 0x74, 0x73, 0x61, 0x00,
+  0x93, 0xfb, 0x01, 0x70, 0x00, 0x0e, 0x15, 0x00, 0x04, 0x01, 0x6b, 0x00,
+  0x0e, 0x15, 0x01, 0x6f, 0x00, 0x0f, 0xfa, 0x01, 0x73, 0x00, 0x0e, 0x15,
+  0x01, 0x79, 0x00, 0x94, 0x07, 0x00, 0x06, 0x01, 0x63, 0x00, 0x0e, 0x15,
+  0x01, 0x64, 0x00, 0x0e, 0x15, 0x01, 0x69, 0x00, 0x0e, 0x15, 0x04, 0x6f,
+  0x73, 0x72, 0x65, 0x00, 0x6d, 0x87, 0x01, 0x76, 0x00, 0x0e, 0x15, 0x01,
+  0x79, 0x00, 0x72, 0x46, 0x00, 0x02, 0x01, 0x63, 0x00, 0x0e, 0x15, 0x01,
+  0x6e, 0x00, 0x94, 0x0e, 0x00, 0x03, 0x01, 0x64, 0x00, 0x0e, 0x15, 0x01,
+  0x70, 0x00, 0x0e, 0x15, 0x01, 0x7a, 0x00, 0x0e, 0x15, 0x00, 0x04, 0x01,
+  0x63, 0x00, 0x0e, 0x15, 0x05, 0x69, 0x6d, 0x6f, 0x74, 0x69, 0x00, 0x94,
+  0x15, 0x01, 0x6b, 0x00, 0x0e, 0x15, 0x05, 0x79, 0x6d, 0x6f, 0x74, 0x79,
+  0x00, 0x94, 0x15, 0x00, 0x03, 0x01, 0x65, 0x00, 0x0f, 0x6f, 0x01, 0x6c,
+  0x00, 0x0e, 0x15, 0x01, 0x7a, 0x00, 0x0e, 0x15, 0x01, 0x07, 0x01, 0x63,
+  0x00, 0x0e, 0x15, 0x01, 0x65, 0x00, 0x94, 0x1c, 0x01, 0x69, 0x00, 0x94,
+  0x2a, 0x01, 0x6b, 0x00, 0x0e, 0x15, 0x01, 0x6c, 0x00, 0x0e, 0x15, 0x01,
+  0x6f, 0x00, 0x94, 0x48, 0x01, 0x72, 0x00, 0x0e, 0x15, 0x00, 0x03, 0x05,
+  0x69, 0x6b, 0x73, 0x74, 0x69, 0x00, 0x93, 0xd8, 0x01, 0x6d, 0x00, 0x13,
+  0x5b, 0x01, 0x73, 0x00, 0x94, 0x54, 0x00, 0x02, 0x01, 0x69, 0x00, 0x15,
+  0x5e, 0x01, 0x75, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x01, 0x61, 0x00, 0x0e,
+  0x15, 0x01, 0x69, 0x00, 0x94, 0x68, 0x00, 0x02, 0x01, 0x69, 0x00, 0x12,
+  0x22, 0x01, 0x6f, 0x00, 0x85, 0xcc, 0x00, 0x02, 0x01, 0x6f, 0x00, 0x0f,
+  0x6f, 0x01, 0x74, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x01, 0x63, 0x00, 0x17,
+  0x6e, 0x01, 0x67, 0x00, 0x0f, 0x6f, 0x00, 0x01, 0x01, 0x6f, 0x00, 0x31,
+  0x67, 0x00, 0x02, 0x01, 0x65, 0x00, 0x0f, 0x6f, 0x01, 0x6c, 0x00, 0x26,
+  0xd7, 0x00, 0x01, 0x01, 0x66, 0x00, 0x94, 0x74, 0x00, 0x02, 0x01, 0x63,
+  0x00, 0x0e, 0x15, 0x01, 0x66, 0x00, 0x66, 0x03, 0x00, 0x02, 0x01, 0x6f,
+  0x00, 0x0c, 0x1d, 0x01, 0x74, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x69,
+  0x00, 0x15, 0x5e, 0x00, 0x03, 0x01, 0x65, 0x00, 0x94, 0x7b, 0x01, 0x73,
+  0x00, 0x5c, 0xdc, 0x01, 0x79, 0x00, 0x5c, 0xb0, 0x00, 0x01, 0x01, 0x6d,
+  0x00, 0x1c, 0x65, 0x00, 0x01, 0x01, 0x79, 0x00, 0x5c, 0xb0, 0x00, 0x01,
+  0x01, 0x32, 0x00, 0x26, 0x0f, 0x00, 0x01, 0x01, 0x72, 0x00, 0x1e, 0x60,
+  0x00, 0x05, 0x01, 0x63, 0x00, 0x94, 0x82, 0x01, 0x67, 0x00, 0x94, 0x8a,
+  0x01, 0x68, 0x00, 0x94, 0x92, 0x01, 0x74, 0x00, 0x29, 0xcb, 0x01, 0x75,
+  0x00, 0x25, 0xe3, 0x00, 0x01, 0x01, 0x61, 0x00, 0x16, 0x9c, 0x00, 0x01,
+  0x03, 0x70, 0x70, 0x61, 0x00, 0x94, 0x9e, 0x00, 0x01, 0x01, 0x61, 0x00,
+  0x94, 0xa5, 0x00, 0x01, 0x01, 0x63, 0x00, 0x94, 0xad, 0x00, 0x01, 0x02,
+  0x2d, 0x65, 0x00, 0x91, 0x52, 0x00, 0x03, 0x01, 0x6e, 0x00, 0x93, 0x5b,
+  0x04, 0x6f, 0x74, 0x6f, 0x68, 0x00, 0x74, 0xc8, 0x07, 0x73, 0x65, 0x63,
+  0x63, 0x61, 0x70, 0x74, 0x00, 0x16, 0x9c, 0x00, 0x01, 0x01, 0x73, 0x00,
+  0x0f, 0xfa, 0x00, 0x01, 0x01, 0x31, 0x00, 0x35, 0x0c, 0x00, 0x01, 0x01,
+  0x73, 0x00, 0x53, 0x44, 0x00, 0x02, 0x01, 0x61, 0x00, 0x91, 0xdf, 0x01,
+  0x69, 0x00, 0x12, 0x22, 0x00, 0x01, 0x01, 0x69, 0x00, 0x16, 0x9c, 0x00,
+  0x02, 0x01, 0x66, 0x00, 0x66, 0x03, 0x01, 0x72, 0x00, 0x0f, 0x68, 0x00,
+  0x01, 0x01, 0x75, 0x00, 0x8d, 0x58, 0x00, 0x01, 0x01, 0x6e, 0x00, 0x53,
+  0x44, 0x00, 0x01, 0x01, 0x68, 0x00, 0x94, 0xb5, 0x00, 0x01, 0x01, 0x6e,
+  0x00, 0x4c, 0x7f, 0x00, 0x01, 0x01, 0x73, 0x00, 0x8d, 0xab, 0x00, 0x02,
+  0x01, 0x6d, 0x00, 0x0e, 0x15, 0x01, 0x77, 0x00, 0x0e, 0x15, 0x00, 0x01,
+  0x01, 0x30, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x01, 0x67, 0x00, 0x94, 0xbc,
+  0x01, 0x6f, 0x00, 0x0c, 0x1d, 0x00, 0x01, 0x01, 0x78, 0x00, 0x1d, 0x34,
+  0x00, 0x01, 0x01, 0x73, 0x00, 0x28, 0xd5, 0x00, 0x01, 0x01, 0x74, 0x00,
+  0x94, 0xc3, 0x00, 0x02, 0x01, 0x63, 0x00, 0x17, 0x6e, 0x01, 0x67, 0x00,
+  0x0e, 0x15, 0x00, 0x01, 0x01, 0x61, 0x00, 0x84, 0x69, 0x00, 0x01, 0x01,
+  0x6e, 0x00, 0x92, 0x51, 0x01, 0x01, 0x03, 0x2e, 0x73, 0x73, 0x00, 0x94,
+  0xca, 0x00, 0x01, 0x01, 0x64, 0x00, 0x71, 0x52, 0x00, 0x02, 0x01, 0x61,
+  0x00, 0x0e, 0x15, 0x01, 0x6f, 0x00, 0x93, 0x45, 0x01, 0x02, 0x07, 0x2e,
+  0x63, 0x69, 0x74, 0x61, 0x74, 0x73, 0x00, 0x94, 0xd1, 0x02, 0x72, 0x61,
+  0x00, 0x1c, 0x65, 0x00, 0x02, 0x01, 0x74, 0x00, 0x94, 0xd8, 0x02, 0x79,
+  0x61, 0x00, 0x4f, 0x82, 0x00, 0x01, 0x01, 0x6e, 0x00, 0x94, 0xe0, 0x00,
+  0x02, 0x01, 0x6f, 0x00, 0x0f, 0xfa, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x00,
+  0x01, 0x01, 0x72, 0x00, 0x5d, 0xb5, 0x00, 0x01, 0x01, 0x6f, 0x00, 0x93,
+  0x45, 0x00, 0x03, 0x0a, 0x62, 0x75, 0x72, 0x61, 0x2d, 0x76, 0x6e, 0x65,
+  0x6a, 0x2e, 0x00, 0x94, 0xe7, 0x04, 0x74, 0x63, 0x65, 0x70, 0x00, 0x73,
+  0x78, 0x02, 0x78, 0x6f, 0x00, 0x94, 0xfd, 0x00, 0x02, 0x01, 0x64, 0x00,
+  0x95, 0x04, 0x06, 0x65, 0x77, 0x69, 0x6c, 0x65, 0x6b, 0x00, 0x95, 0x0c,
+  0x00, 0x01, 0x04, 0x72, 0x61, 0x79, 0x6b, 0x00, 0x42, 0x00, 0x00, 0x02,
+  0x01, 0x6c, 0x00, 0x1c, 0x89, 0x04, 0x74, 0x69, 0x73, 0x6f, 0x00, 0x95,
+  0x13, 0x00, 0x02, 0x01, 0x65, 0x00, 0x1e, 0x60, 0x01, 0x68, 0x00, 0x0f,
+  0xfa, 0x00, 0x01, 0x01, 0x61, 0x00, 0x95, 0x26, 0x01, 0x01, 0x01, 0x2e,
+  0x00, 0x76, 0xd6, 0x00, 0x02, 0x02, 0x65, 0x64, 0x00, 0x84, 0xdf, 0x07,
+  0x69, 0x61, 0x6c, 0x63, 0x65, 0x72, 0x2e, 0x00, 0x95, 0x2d, 0x00, 0x02,
+  0x05, 0x65, 0x76, 0x75, 0x65, 0x6c, 0x00, 0x80, 0x9d, 0x02, 0x77, 0x6f,
+  0x00, 0x93, 0x75, 0x00, 0x02, 0x01, 0x65, 0x00, 0x95, 0x3e, 0x01, 0x6f,
+  0x00, 0x95, 0x51, 0x00, 0x01, 0x01, 0x74, 0x00, 0x6c, 0x6e, 0x00, 0x01,
+  0x01, 0x73, 0x00, 0x1d, 0x34, 0x00, 0x01, 0x01, 0x6f, 0x00, 0x16, 0xb8,
+  0x00, 0x06, 0x0a, 0x67, 0x6e, 0x69, 0x6c, 0x65, 0x62, 0x61, 0x6c, 0x74,
+  0x72, 0x00, 0x95, 0x5d, 0x07, 0x6b, 0x6f, 0x6f, 0x62, 0x65, 0x6c, 0x61,
+  0x00, 0x4f, 0xff, 0x0a, 0x6c, 0x61, 0x74, 0x65, 0x6d, 0x65, 0x72, 0x61,
+  0x62, 0x2e, 0x00, 0x95, 0x64, 0x07, 0x72, 0x61, 0x70, 0x2d, 0x72, 0x66,
+  0x2e, 0x00, 0x95, 0x73, 0x01, 0x73, 0x00, 0x95, 0x90, 0x07, 0x77, 0x61,
+  0x77, 0x2d, 0x6c, 0x70, 0x2e, 0x00, 0x95, 0xae, 0x00, 0x01, 0x01, 0x75,
+  0x00, 0x1d, 0x34, 0x00, 0x01, 0x02, 0x74, 0x69, 0x00, 0x95, 0xbf, 0x00,
+  0x01, 0x01, 0x68, 0x00, 0x95, 0xc9, 0x00, 0x01, 0x05, 0x72, 0x75, 0x73,
+  0x6e, 0x61, 0x00, 0x95, 0xd0, 0x00, 0x01, 0x01, 0x6f, 0x00, 0x93, 0x4c,
+  0x00, 0x01, 0x01, 0x2e, 0x00, 0x93, 0x5b, 0x00, 0x01, 0x01, 0x6f, 0x00,
+  0x26, 0xf3, 0x00, 0x04, 0x05, 0x61, 0x32, 0x71, 0x62, 0x64, 0x00, 0x26,
+  0x08, 0x05, 0x62, 0x38, 0x61, 0x64, 0x62, 0x00, 0x95, 0xd7, 0x08, 0x63,
+  0x36, 0x79, 0x74, 0x64, 0x67, 0x62, 0x64, 0x00, 0x0b, 0xb4, 0x06, 0x64,
+  0x38, 0x6c, 0x68, 0x62, 0x64, 0x00, 0x13, 0xaa, 0x01, 0x02, 0x01, 0x2e,
+  0x00, 0x95, 0xde, 0x03, 0x61, 0x72, 0x74, 0x00, 0x60, 0x95, 0x00, 0x01,
+  0x01, 0x66, 0x00, 0x41, 0x08, 0x00, 0x04, 0x01, 0x64, 0x00, 0x0e, 0x15,
+  0x02, 0x69, 0x6c, 0x00, 0x29, 0xdf, 0x01, 0x6e, 0x00, 0x60, 0x40, 0x05,
+  0x72, 0x75, 0x73, 0x6e, 0x69, 0x00, 0x95, 0xf5, 0x00, 0x01, 0x01, 0x69,
+  0x00, 0x26, 0xd7, 0x00, 0x01, 0x01, 0x73, 0x00, 0x91, 0x36, 0x00, 0x01,
+  0x01, 0x2d, 0x00, 0x75, 0x7e, 0x00, 0x01, 0x01, 0x65, 0x00, 0x96, 0x04,
+  0x00, 0x01, 0x04, 0x6d, 0x69, 0x6c, 0x34, 0x00, 0x0e, 0x15, 0x00, 0x03,
+  0x0a, 0x6f, 0x77, 0x2d, 0x6e, 0x72, 0x65, 0x66, 0x65, 0x69, 0x6c, 0x00,
+  0x96, 0x0d, 0x01, 0x72, 0x00, 0x96, 0x18, 0x0c, 0x76, 0x7a, 0x2d, 0x6e,
+  0x65, 0x6c, 0x6c, 0x65, 0x74, 0x73, 0x65, 0x62, 0x00, 0x96, 0x0d, 0x00,
+  0x01, 0x03, 0x61, 0x6c, 0x70, 0x00, 0x15, 0x5e, 0x00, 0x06, 0x07, 0x63,
+  0x61, 0x70, 0x73, 0x72, 0x65, 0x62, 0x00, 0x96, 0x1f, 0x09, 0x64, 0x61,
+  0x72, 0x65, 0x67, 0x74, 0x6d, 0x75, 0x65, 0x00, 0x3c, 0xee, 0x07, 0x6c,
+  0x75, 0x68, 0x63, 0x73, 0x76, 0x72, 0x00, 0x96, 0x26, 0x03, 0x6d, 0x6f,
+  0x68, 0x00, 0x69, 0xb6, 0x07, 0x6e, 0x69, 0x68, 0x63, 0x61, 0x6d, 0x79,
+  0x00, 0x84, 0xae, 0x01, 0x74, 0x00, 0x88, 0x01, 0x00, 0x01, 0x01, 0x6b,
+  0x00, 0x8d, 0x01, 0x00, 0x01, 0x01, 0x64, 0x00, 0x93, 0x7c, 0x00, 0x02,
+  0x01, 0x6f, 0x00, 0x0f, 0xfa, 0x09, 0x72, 0x6f, 0x66, 0x74, 0x74, 0x61,
+  0x6c, 0x70, 0x6c, 0x00, 0x96, 0x2d, 0x00, 0x07, 0x07, 0x2d, 0x69, 0x2d,
+  0x67, 0x2d, 0x6f, 0x2d, 0x00, 0x26, 0xde, 0x02, 0x61, 0x77, 0x00, 0x96,
+  0x34, 0x07, 0x65, 0x73, 0x67, 0x6e, 0x75, 0x74, 0x69, 0x00, 0x16, 0xd4,
+  0x01, 0x69, 0x00, 0x96, 0x3b, 0x0e, 0x6e, 0x6f, 0x72, 0x62, 0x6c, 0x69,
+  0x65, 0x68, 0x2d, 0x73, 0x68, 0x2e, 0x74, 0x69, 0x00, 0x96, 0x4c, 0x0c,
+  0x6f, 0x69, 0x74, 0x61, 0x74, 0x73, 0x6b, 0x73, 0x69, 0x64, 0x2d, 0x79,
+  0x00, 0x96, 0x53, 0x02, 0x70, 0x76, 0x00, 0x96, 0x5a, 0x00, 0x01, 0x05,
+  0x70, 0x2d, 0x79, 0x74, 0x69, 0x00, 0x6f, 0x98, 0x00, 0x03, 0x01, 0x68,
+  0x00, 0x96, 0x66, 0x03, 0x69, 0x6f, 0x67, 0x00, 0x96, 0x6d, 0x01, 0x6f,
+  0x00, 0x93, 0x4c, 0x00, 0x02, 0x01, 0x65, 0x00, 0x96, 0x74, 0x05, 0x6f,
+  0x67, 0x69, 0x76, 0x2d, 0x00, 0x96, 0x9b, 0x00, 0x04, 0x02, 0x64, 0x2d,
+  0x00, 0x96, 0xa7, 0x02, 0x6e, 0x64, 0x00, 0x96, 0xb3, 0x05, 0x6f, 0x70,
+  0x65, 0x72, 0x2d, 0x00, 0x96, 0xcd, 0x04, 0x73, 0x6e, 0x64, 0x64, 0x00,
+  0x96, 0xd9, 0x00, 0x02, 0x01, 0x6e, 0x00, 0x96, 0xe0, 0x01, 0x74, 0x00,
+  0x96, 0xe7, 0x00, 0x01, 0x01, 0x69, 0x00, 0x96, 0xee, 0x00, 0x04, 0x07,
+  0x61, 0x77, 0x65, 0x74, 0x61, 0x67, 0x2d, 0x00, 0x96, 0xf5, 0x05, 0x6b,
+  0x73, 0x75, 0x72, 0x66, 0x00, 0x14, 0x4a, 0x01, 0x73, 0x00, 0x51, 0x91,
+  0x01, 0x74, 0x00, 0x97, 0x01, 0x00, 0x02, 0x03, 0x6d, 0x69, 0x74, 0x00,
+  0x97, 0x0a, 0x08, 0x73, 0x61, 0x64, 0x74, 0x72, 0x65, 0x74, 0x74, 0x00,
+  0x97, 0x11, 0x00, 0x01, 0x01, 0x6f, 0x00, 0x92, 0xee, 0x00, 0x02, 0x01,
+  0x65, 0x00, 0x0f, 0x6f, 0x01, 0x76, 0x00, 0x0f, 0x68, 0x01, 0x01, 0x01,
+  0x2e, 0x00, 0x97, 0x18, 0x00, 0x01, 0x01, 0x6f, 0x00, 0x26, 0xc4, 0x00,
+  0x01, 0x01, 0x6c, 0x00, 0x2f, 0x47, 0x00, 0x01, 0x01, 0x63, 0x00, 0x60,
+  0x95, 0x01, 0x01, 0x02, 0x2e, 0x68, 0x00, 0x97, 0x4b, 0x00, 0x01, 0x01,
+  0x65, 0x00, 0x0c, 0x1d, 0x00, 0x01, 0x01, 0x6c, 0x00, 0x92, 0x51, 0x00,
+  0x02, 0x01, 0x61, 0x00, 0x0e, 0x15, 0x01, 0x73, 0x00, 0x0e, 0x15, 0x00,
+  0x02, 0x01, 0x6d, 0x00, 0x0e, 0x15, 0x01, 0x6e, 0x00, 0x0e, 0x15, 0x00,
+  0x03, 0x01, 0x63, 0x00, 0x17, 0x6e, 0x01, 0x66, 0x00, 0x66, 0x03, 0x01,
+  0x67, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x72, 0x00, 0x60, 0x40, 0x01,
+  0x01, 0x01, 0x72, 0x00, 0x3f, 0xd8, 0x00, 0x02, 0x01, 0x62, 0x00, 0x0e,
+  0x15, 0x01, 0x64, 0x00, 0x84, 0x70, 0x00, 0x01, 0x01, 0x6f, 0x00, 0x12,
+  0x22, 0x00, 0x01, 0x01, 0x71, 0x00, 0x26, 0xd7, 0x00, 0x01, 0x01, 0x66,
+  0x00, 0x17, 0xbd, 0x00, 0x02, 0x02, 0x33, 0x32, 0x00, 0x2a, 0x10, 0x01,
+  0x70, 0x00, 0x97, 0x52, 0x00, 0x01, 0x01, 0x61, 0x00, 0x97, 0x5e, 0x00,
+  0x02, 0x01, 0x64, 0x00, 0x95, 0x04, 0x01, 0x67, 0x00, 0x97, 0x65, 0x00,
+  0x01, 0x04, 0x75, 0x6f, 0x6c, 0x63, 0x00, 0x97, 0x6c, 0x00, 0x03, 0x01,
+  0x64, 0x00, 0x97, 0x65, 0x01, 0x69, 0x00, 0x97, 0x73, 0x01, 0x70, 0x00,
+  0x58, 0xd0, 0x00, 0x02, 0x01, 0x72, 0x00, 0x41, 0x08, 0x01, 0x73, 0x00,
+  0x97, 0x65, 0x00, 0x01, 0x01, 0x73, 0x00, 0x97, 0x82, 0x00, 0x01, 0x02,
+  0x6f, 0x69, 0x00, 0x97, 0x89, 0x00, 0x03, 0x01, 0x62, 0x00, 0x97, 0x93,
+  0x01, 0x63, 0x00, 0x0e, 0x15, 0x01, 0x74, 0x00, 0x97, 0x9a, 0x00, 0x03,
+  0x01, 0x69, 0x00, 0x97, 0xa6, 0x01, 0x6a, 0x00, 0x97, 0x65, 0x01, 0x6f,
+  0x00, 0x62, 0x1b, 0x00, 0x03, 0x01, 0x61, 0x00, 0x97, 0xb5, 0x02, 0x69,
+  0x64, 0x00, 0x58, 0xd0, 0x02, 0x6f, 0x66, 0x00, 0x69, 0xb6, 0x00, 0x04,
+  0x01, 0x64, 0x00, 0x97, 0xbe, 0x01, 0x6e, 0x00, 0x97, 0xc5, 0x01, 0x74,
+  0x00, 0x2a, 0x10, 0x03, 0x75, 0x6d, 0x68, 0x00, 0x46, 0x75, 0x00, 0x02,
+  0x01, 0x65, 0x00, 0x0f, 0x6f, 0x01, 0x73, 0x00, 0x97, 0xcc, 0x00, 0x02,
+  0x01, 0x61, 0x00, 0x97, 0x65, 0x01, 0x64, 0x00, 0x1d, 0x34, 0x00, 0x02,
+  0x01, 0x69, 0x00, 0x13, 0x4d, 0x01, 0x6f, 0x00, 0x0c, 0x1d, 0x00, 0x03,
+  0x01, 0x67, 0x00, 0x97, 0xd9, 0x01, 0x6f, 0x00, 0x6a, 0x2e, 0x01, 0x73,
+  0x00, 0x51, 0x91, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x97, 0xe2, 0x01, 0x01,
+  0x01, 0x2e, 0x00, 0x97, 0xf0, 0x00, 0x03, 0x05, 0x64, 0x65, 0x72, 0x6e,
+  0x6f, 0x00, 0x98, 0x07, 0x01, 0x65, 0x00, 0x98, 0x11, 0x01, 0x6b, 0x00,
+  0x98, 0x18, 0x00, 0x01, 0x01, 0x70, 0x00, 0x42, 0x43, 0x00, 0x02, 0x01,
+  0x64, 0x00, 0x29, 0xdf, 0x01, 0x65, 0x00, 0x98, 0x21, 0x01, 0x01, 0x01,
+  0x2e, 0x00, 0x98, 0x2e, 0x01, 0x01, 0x01, 0x68, 0x00, 0x74, 0x16, 0x00,
+  0x01, 0x02, 0x74, 0x66, 0x00, 0x48, 0x25, 0x00, 0x02, 0x01, 0x65, 0x00,
+  0x98, 0x47, 0x02, 0x79, 0x66, 0x00, 0x98, 0x58, 0x00, 0x01, 0x01, 0x68,
+  0x00, 0x16, 0x7b, 0x00, 0x01, 0x01, 0x6e, 0x00, 0x2a, 0x10, 0x00, 0x02,
+  0x01, 0x69, 0x00, 0x98, 0x5f, 0x01, 0x6e, 0x00, 0x98, 0x66, 0x01, 0x02,
+  0x04, 0x62, 0x61, 0x70, 0x2e, 0x00, 0x13, 0x5b, 0x04, 0x64, 0x69, 0x73,
+  0x6e, 0x00, 0x98, 0x6d, 0x01, 0x02, 0x02, 0x69, 0x62, 0x00, 0x27, 0x01,
+  0x03, 0x72, 0x6f, 0x66, 0x00, 0x90, 0x5b, 0x01, 0x01, 0x01, 0x61, 0x00,
+  0x0e, 0x15, 0x01, 0x02, 0x01, 0x62, 0x00, 0x0e, 0x15, 0x01, 0x6e, 0x00,
+  0x98, 0x75, 0x01, 0x01, 0x01, 0x6e, 0x00, 0x2f, 0x47, 0x01, 0x01, 0x01,
+  0x72, 0x00, 0x41, 0x08, 0x01, 0x01, 0x01, 0x66, 0x00, 0x0e, 0x15, 0x01,
+  0x01, 0x01, 0x74, 0x00, 0x98, 0x89, 0x01, 0x01, 0x01, 0x73, 0x00, 0x66,
+  0xb7, 0x01, 0x02, 0x01, 0x6f, 0x00, 0x0f, 0xfa, 0x01, 0x74, 0x00, 0x0e,
+  0x15, 0x01, 0x01, 0x08, 0x6d, 0x79, 0x67, 0x73, 0x6b, 0x75, 0x72, 0x62,
+  0x00, 0x98, 0x90, 0x01, 0x02, 0x01, 0x6f, 0x00, 0x93, 0x4c, 0x01, 0x70,
+  0x00, 0x0e, 0x15, 0x01, 0x01, 0x09, 0x6f, 0x77, 0x65, 0x62, 0x64, 0x6c,
+  0x75, 0x6f, 0x63, 0x00, 0x98, 0x97, 0x01, 0x02, 0x01, 0x73, 0x00, 0x93,
+  0x62, 0x03, 0x79, 0x73, 0x70, 0x00, 0x98, 0x9e, 0x01, 0x01, 0x01, 0x6f,
+  0x00, 0x93, 0x45, 0x00, 0x01, 0x01, 0x68, 0x00, 0x16, 0x9c, 0x01, 0x01,
+  0x02, 0x75, 0x76, 0x00, 0x90, 0x5b, 0x00, 0x01, 0x01, 0x72, 0x00, 0x0f,
+  0xfa, 0x00, 0x02, 0x01, 0x65, 0x00, 0x98, 0xa5, 0x01, 0x6c, 0x00, 0x26,
+  0x53, 0x00, 0x0a, 0x04, 0x61, 0x72, 0x65, 0x64, 0x00, 0x98, 0xb2, 0x01,
+  0x65, 0x00, 0x98, 0xbb, 0x09, 0x68, 0x73, 0x6d, 0x72, 0x6f, 0x66, 0x74,
+  0x61, 0x6c, 0x00, 0x98, 0xd3, 0x01, 0x6b, 0x00, 0x98, 0xda, 0x06, 0x6c,
+  0x61, 0x69, 0x63, 0x6f, 0x73, 0x00, 0x98, 0xee, 0x01, 0x6e, 0x00, 0x98,
+  0xf5, 0x02, 0x73, 0x70, 0x00, 0x99, 0x01, 0x01, 0x74, 0x00, 0x99, 0x08,
+  0x03, 0x78, 0x75, 0x6c, 0x00, 0x16, 0xd4, 0x01, 0x79, 0x00, 0x5c, 0xb0,
+  0x00, 0x01, 0x01, 0x6c, 0x00, 0x28, 0xd5, 0x00, 0x01, 0x01, 0x73, 0x00,
+  0x66, 0x03, 0x00, 0x01, 0x01, 0x69, 0x00, 0x3a, 0x7d, 0x00, 0x01, 0x01,
+  0x75, 0x00, 0x17, 0x57, 0x00, 0x01, 0x01, 0x31, 0x00, 0x1d, 0x34, 0x00,
+  0x03, 0x01, 0x65, 0x00, 0x35, 0x51, 0x01, 0x69, 0x00, 0x15, 0x5e, 0x01,
+  0x6f, 0x00, 0x0c, 0x1d, 0x00, 0x02, 0x01, 0x72, 0x00, 0x0e, 0x15, 0x01,
+  0x74, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x01, 0x6f, 0x00, 0x93, 0x69, 0x01,
+  0x72, 0x00, 0x60, 0x40, 0x00, 0x01, 0x01, 0x61, 0x00, 0x1d, 0x1c, 0x00,
+  0x01, 0x01, 0x74, 0x00, 0x44, 0x12, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x99,
+  0x15, 0x00, 0x01, 0x01, 0x6f, 0x00, 0x13, 0x4d, 0x00, 0x08, 0x02, 0x61,
+  0x31, 0x00, 0x0b, 0xb4, 0x04, 0x62, 0x38, 0x6c, 0x65, 0x00, 0x13, 0x2c,
+  0x01, 0x63, 0x00, 0x99, 0x1c, 0x01, 0x66, 0x00, 0x99, 0x2d, 0x01, 0x67,
+  0x00, 0x94, 0x8a, 0x02, 0x6e, 0x68, 0x00, 0x99, 0x3a, 0x02, 0x70, 0x64,
+  0x00, 0x13, 0x2c, 0x03, 0x7a, 0x69, 0x6c, 0x00, 0x99, 0x3a, 0x00, 0x01,
+  0x01, 0x64, 0x00, 0x26, 0x0f, 0x00, 0x02, 0x01, 0x6f, 0x00, 0x0f, 0xfa,
+  0x01, 0x72, 0x00, 0x60, 0x40, 0x00, 0x02, 0x01, 0x68, 0x00, 0x5c, 0xe3,
+  0x01, 0x70, 0x00, 0x0e, 0x15, 0x00, 0x05, 0x02, 0x61, 0x35, 0x00, 0x99,
+  0x42, 0x01, 0x64, 0x00, 0x99, 0x49, 0x02, 0x67, 0x6c, 0x00, 0x6b, 0x91,
+  0x02, 0x6d, 0x31, 0x00, 0x18, 0x9d, 0x02, 0x76, 0x74, 0x00, 0x99, 0x56,
+  0x01, 0x01, 0x01, 0x73, 0x00, 0x51, 0x91, 0x01, 0x01, 0x04, 0x2e, 0x6e,
+  0x6f, 0x6d, 0x00, 0x99, 0x5f, 0x00, 0x01, 0x01, 0x61, 0x00, 0x35, 0x0c,
+  0x00, 0x02, 0x01, 0x6f, 0x00, 0x68, 0xf2, 0x01, 0x72, 0x00, 0x41, 0x08,
+  0x00, 0x02, 0x01, 0x6f, 0x00, 0x93, 0x69, 0x01, 0x74, 0x00, 0x0e, 0x15,
+  0x00, 0x01, 0x01, 0x74, 0x00, 0x26, 0xde, 0x01, 0x01, 0x01, 0x62, 0x00,
+  0x64, 0xb6, 0x00, 0x02, 0x01, 0x69, 0x00, 0x12, 0x22, 0x01, 0x6f, 0x00,
+  0x0f, 0xfa, 0x00, 0x02, 0x01, 0x6f, 0x00, 0x92, 0xee, 0x01, 0x72, 0x00,
+  0x60, 0x40, 0x00, 0x01, 0x01, 0x67, 0x00, 0x0f, 0x6f, 0x01, 0x01, 0x01,
+  0x6d, 0x00, 0x99, 0x66, 0x00, 0x02, 0x01, 0x61, 0x00, 0x52, 0x55, 0x01,
+  0x64, 0x00, 0x43, 0xb8, 0x00, 0x02, 0x01, 0x73, 0x00, 0x60, 0x40, 0x01,
+  0x74, 0x00, 0x99, 0x6d, 0x00, 0x02, 0x01, 0x69, 0x00, 0x27, 0xf5, 0x02,
+  0x6f, 0x6f, 0x00, 0x99, 0x74, 0x00, 0x02, 0x01, 0x61, 0x00, 0x99, 0x80,
+  0x01, 0x69, 0x00, 0x3c, 0xee, 0x01, 0x01, 0x01, 0x70, 0x00, 0x15, 0xf4,
+  0x00, 0x02, 0x01, 0x65, 0x00, 0x99, 0x87, 0x01, 0x74, 0x00, 0x42, 0x43,
+  0x00, 0x07, 0x01, 0x61, 0x00, 0x1e, 0x60, 0x02, 0x65, 0x6b, 0x00, 0x4c,
+  0xde, 0x01, 0x68, 0x00, 0x99, 0x8f, 0x01, 0x6c, 0x00, 0x99, 0x96, 0x01,
+  0x6e, 0x00, 0x64, 0x65, 0x01, 0x6f, 0x00, 0x27, 0xf5, 0x03, 0x73, 0x6f,
+  0x68, 0x00, 0x99, 0x9d, 0x00, 0x02, 0x01, 0x67, 0x00, 0x0e, 0x15, 0x01,
+  0x6c, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x73, 0x00, 0x72, 0x66, 0x00,
+  0x03, 0x01, 0x64, 0x00, 0x99, 0xa9, 0x01, 0x65, 0x00, 0x99, 0xb0, 0x07,
+  0x74, 0x6e, 0x65, 0x74, 0x6e, 0x6f, 0x63, 0x00, 0x90, 0xe9, 0x00, 0x01,
+  0x01, 0x6c, 0x00, 0x15, 0x5e, 0x00, 0x14, 0x07, 0x37, 0x37, 0x6e, 0x64,
+  0x63, 0x2e, 0x63, 0x00, 0x99, 0xba, 0x01, 0x61, 0x00, 0x99, 0xc1, 0x06,
+  0x62, 0x65, 0x77, 0x2d, 0x6c, 0x6c, 0x00, 0x95, 0x5d, 0x01, 0x64, 0x00,
+  0x99, 0xd2, 0x01, 0x65, 0x00, 0x99, 0xf6, 0x01, 0x66, 0x00, 0x9a, 0x25,
+  0x06, 0x67, 0x6f, 0x6c, 0x62, 0x79, 0x6d, 0x00, 0x9a, 0x2c, 0x01, 0x6b,
+  0x00, 0x9a, 0x33, 0x01, 0x6c, 0x00, 0x9a, 0x44, 0x01, 0x6d, 0x00, 0x9a,
+  0x5b, 0x01, 0x6e, 0x00, 0x9a, 0x71, 0x01, 0x6f, 0x00, 0x9a, 0x8c, 0x01,
+  0x70, 0x00, 0x9a, 0x99, 0x01, 0x72, 0x00, 0x9a, 0xab, 0x01, 0x73, 0x00,
+  0x9a, 0xbe, 0x01, 0x74, 0x00, 0x9b, 0x13, 0x02, 0x75, 0x65, 0x00, 0x9b,
+  0x3a, 0x04, 0x76, 0x72, 0x65, 0x73, 0x00, 0x75, 0x7e, 0x01, 0x78, 0x00,
+  0x9b, 0x41, 0x01, 0x79, 0x00, 0x9b, 0x4d, 0x00, 0x01, 0x01, 0x6e, 0x00,
+  0x1d, 0x34, 0x00, 0x01, 0x01, 0x65, 0x00, 0x0f, 0x68, 0x00, 0x02, 0x01,
+  0x63, 0x00, 0x0e, 0x15, 0x01, 0x67, 0x00, 0x0e, 0x15, 0x00, 0x03, 0x05,
+  0x32, 0x78, 0x79, 0x63, 0x33, 0x00, 0x0f, 0x92, 0x06, 0x33, 0x6a, 0x30,
+  0x68, 0x63, 0x33, 0x00, 0x33, 0x14, 0x08, 0x76, 0x65, 0x34, 0x62, 0x33,
+  0x63, 0x30, 0x6f, 0x00, 0x69, 0xae, 0x00, 0x01, 0x02, 0x63, 0x32, 0x00,
+  0x26, 0x01, 0x00, 0x01, 0x01, 0x73, 0x00, 0x9b, 0x5e, 0x00, 0x02, 0x01,
+  0x68, 0x00, 0x96, 0x66, 0x01, 0x6f, 0x00, 0x93, 0x4c, 0x00, 0x01, 0x01,
+  0x74, 0x00, 0x58, 0xaf, 0x00, 0x02, 0x06, 0x65, 0x6e, 0x65, 0x72, 0x69,
+  0x66, 0x00, 0x9b, 0x65, 0x01, 0x6f, 0x00, 0x93, 0x45, 0x00, 0x02, 0x03,
+  0x61, 0x2e, 0x31, 0x00, 0x9b, 0x6e, 0x05, 0x6e, 0x69, 0x67, 0x6e, 0x65,
+  0x00, 0x9b, 0x75, 0x00, 0x01, 0x01, 0x74, 0x00, 0x97, 0x01, 0x00, 0x01,
+  0x01, 0x75, 0x00, 0x28, 0x66, 0x00, 0x02, 0x03, 0x6e, 0x61, 0x62, 0x00,
+  0x9b, 0x7c, 0x01, 0x72, 0x00, 0x41, 0x08, 0x00, 0x02, 0x01, 0x69, 0x00,
+  0x12, 0x22, 0x01, 0x78, 0x00, 0x27, 0xf5, 0x00, 0x02, 0x01, 0x6f, 0x00,
+  0x0f, 0xfa, 0x08, 0x72, 0x6f, 0x66, 0x74, 0x61, 0x6c, 0x70, 0x2e, 0x00,
+  0x9b, 0x83, 0x00, 0x01, 0x04, 0x6c, 0x70, 0x65, 0x64, 0x00, 0x43, 0xb8,
+  0x00, 0x01, 0x01, 0x6c, 0x00, 0x9b, 0x99, 0x01, 0x01, 0x06, 0x2e, 0x73,
+  0x70, 0x70, 0x61, 0x64, 0x00, 0x9b, 0xa0, 0x00, 0x01, 0x01, 0x77, 0x00,
+  0x5d, 0xbc, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x9b, 0xa9, 0x00, 0x01, 0x01,
+  0x61, 0x00, 0x26, 0x0f, 0x00, 0x02, 0x01, 0x65, 0x00, 0x0e, 0x15, 0x01,
+  0x6d, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x73, 0x00, 0x5d, 0x17, 0x00,
+  0x03, 0x01, 0x63, 0x00, 0x0e, 0x15, 0x01, 0x67, 0x00, 0x0e, 0x15, 0x01,
+  0x73, 0x00, 0x8d, 0xab, 0x00, 0x01, 0x01, 0x75, 0x00, 0x58, 0xaf, 0x00,
+  0x01, 0x01, 0x61, 0x00, 0x26, 0x53, 0x00, 0x02, 0x01, 0x6b, 0x00, 0x2a,
+  0x10, 0x02, 0x73, 0x70, 0x00, 0x68, 0x09, 0x00, 0x02, 0x01, 0x6f, 0x00,
+  0x9b, 0xb5, 0x01, 0x73, 0x00, 0x9b, 0xbc, 0x00, 0x01, 0x01, 0x33, 0x00,
+  0x96, 0x66, 0x00, 0x02, 0x01, 0x6f, 0x00, 0x12, 0x22, 0x01, 0x74, 0x00,
+  0x26, 0xde, 0x00, 0x01, 0x01, 0x74, 0x00, 0x7f, 0xc0, 0x00, 0x01, 0x01,
+  0x75, 0x00, 0x9b, 0xc3, 0x00, 0x01, 0x01, 0x65, 0x00, 0x21, 0x6d, 0x00,
+  0x02, 0x01, 0x65, 0x00, 0x35, 0x51, 0x01, 0x6f, 0x00, 0x0c, 0x1d, 0x00,
+  0x01, 0x01, 0x74, 0x00, 0x4c, 0x3f, 0x00, 0x01, 0x01, 0x66, 0x00, 0x26,
+  0xd7, 0x00, 0x02, 0x01, 0x6f, 0x00, 0x0f, 0xfa, 0x01, 0x73, 0x00, 0x9b,
+  0xca, 0x00, 0x05, 0x01, 0x63, 0x00, 0x9b, 0xd1, 0x01, 0x66, 0x00, 0x66,
+  0x03, 0x01, 0x6e, 0x00, 0x9b, 0xd8, 0x01, 0x72, 0x00, 0x71, 0x4b, 0x01,
+  0x74, 0x00, 0x9b, 0xdf, 0x00, 0x03, 0x03, 0x65, 0x74, 0x63, 0x00, 0x9b,
+  0xe6, 0x04, 0x72, 0x69, 0x73, 0x69, 0x00, 0x46, 0x75, 0x02, 0x74, 0x61,
+  0x00, 0x9b, 0xef, 0x00, 0x03, 0x01, 0x65, 0x00, 0x0f, 0x6f, 0x03, 0x6e,
+  0x61, 0x72, 0x00, 0x8c, 0xe0, 0x01, 0x6f, 0x00, 0x93, 0x45, 0x00, 0x01,
+  0x01, 0x69, 0x00, 0x70, 0xbd, 0x00, 0x01, 0x01, 0x6e, 0x00, 0x64, 0xb6,
+  0x00, 0x02, 0x01, 0x61, 0x00, 0x0e, 0x15, 0x01, 0x69, 0x00, 0x0f, 0x6f,
+  0x00, 0x03, 0x01, 0x65, 0x00, 0x0f, 0x6f, 0x01, 0x6e, 0x00, 0x2a, 0x10,
+  0x01, 0x73, 0x00, 0x6b, 0x7d, 0x00, 0x01, 0x01, 0x6d, 0x00, 0x1d, 0x34,
+  0x00, 0x02, 0x02, 0x64, 0x69, 0x00, 0x9b, 0xf6, 0x01, 0x72, 0x00, 0x64,
+  0x48, 0x00, 0x01, 0x01, 0x65, 0x00, 0x16, 0x7b, 0x00, 0x02, 0x02, 0x34,
+  0x79, 0x00, 0x99, 0x56, 0x01, 0x35, 0x00, 0x99, 0x42, 0x00, 0x01, 0x03,
+  0x61, 0x30, 0x64, 0x00, 0x0f, 0x92, 0x00, 0x03, 0x01, 0x32, 0x00, 0x9c,
+  0x02, 0x01, 0x35, 0x00, 0x0f, 0x8b, 0x01, 0x74, 0x00, 0x26, 0xde, 0x00,
+  0x03, 0x02, 0x61, 0x30, 0x00, 0x9c, 0x11, 0x01, 0x6c, 0x00, 0x6b, 0x91,
+  0x01, 0x72, 0x00, 0x41, 0x08, 0x00, 0x03, 0x03, 0x30, 0x35, 0x30, 0x00,
+  0x9c, 0x18, 0x01, 0x37, 0x00, 0x15, 0x6c, 0x03, 0x78, 0x61, 0x30, 0x00,
+  0x2a, 0x4c, 0x00, 0x02, 0x01, 0x31, 0x00, 0x18, 0x9d, 0x01, 0x6f, 0x00,
+  0x0f, 0xfa, 0x00, 0x01, 0x01, 0x63, 0x00, 0x25, 0x56, 0x00, 0x03, 0x01,
+  0x64, 0x00, 0x2a, 0x10, 0x01, 0x6f, 0x00, 0x0c, 0x1d, 0x01, 0x74, 0x00,
+  0x99, 0x56, 0x00, 0x01, 0x02, 0x61, 0x30, 0x00, 0x5f, 0x71, 0x00, 0x02,
+  0x01, 0x61, 0x00, 0x0e, 0x15, 0x01, 0x6f, 0x00, 0x27, 0x0f, 0x00, 0x01,
+  0x01, 0x65, 0x00, 0x85, 0x3d, 0x00, 0x02, 0x01, 0x65, 0x00, 0x0f, 0x6f,
+  0x01, 0x66, 0x00, 0x48, 0x25, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x9c, 0x20,
+  0x00, 0x02, 0x01, 0x61, 0x00, 0x16, 0x9c, 0x01, 0x6f, 0x00, 0x0f, 0xfa,
+  0x00, 0x04, 0x05, 0x68, 0x74, 0x75, 0x6d, 0x69, 0x00, 0x9c, 0x34, 0x03,
+  0x6e, 0x6f, 0x6c, 0x00, 0x16, 0x7b, 0x01, 0x6f, 0x00, 0x9c, 0x3b, 0x04,
+  0x73, 0x65, 0x63, 0x6c, 0x00, 0x5c, 0xa9, 0x00, 0x02, 0x01, 0x61, 0x00,
+  0x0e, 0x15, 0x01, 0x6c, 0x00, 0x0f, 0x68, 0x00, 0x02, 0x01, 0x63, 0x00,
+  0x2f, 0xce, 0x01, 0x6d, 0x00, 0x0e, 0x15, 0x01, 0x01, 0x01, 0x2e, 0x00,
+  0x9c, 0x47, 0x00, 0x01, 0x01, 0x73, 0x00, 0x14, 0x4a, 0x00, 0x01, 0x02,
+  0x2d, 0x74, 0x00, 0x9c, 0x5b, 0x00, 0x02, 0x01, 0x6e, 0x00, 0x2f, 0x47,
+  0x0a, 0x6f, 0x69, 0x73, 0x73, 0x69, 0x6d, 0x6d, 0x6f, 0x63, 0x2d, 0x00,
+  0x9c, 0x68, 0x00, 0x02, 0x01, 0x63, 0x00, 0x9c, 0x76, 0x01, 0x72, 0x00,
+  0x9c, 0x7d, 0x00, 0x01, 0x01, 0x73, 0x00, 0x32, 0x5a, 0x00, 0x01, 0x01,
+  0x68, 0x00, 0x0f, 0x6f, 0x00, 0x03, 0x01, 0x65, 0x00, 0x0f, 0x6f, 0x02,
+  0x6e, 0x6d, 0x00, 0x9c, 0x84, 0x06, 0x73, 0x65, 0x75, 0x71, 0x6e, 0x69,
+  0x00, 0x6c, 0x75, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x9c, 0x8b, 0x00, 0x02,
+  0x07, 0x72, 0x69, 0x75, 0x71, 0x6e, 0x69, 0x2d, 0x00, 0x9c, 0xa1, 0x01,
+  0x73, 0x00, 0x51, 0x91, 0x00, 0x02, 0x05, 0x6e, 0x61, 0x6e, 0x69, 0x66,
+  0x00, 0x9c, 0xad, 0x01, 0x6f, 0x00, 0x27, 0x0f, 0x00, 0x01, 0x01, 0x6f,
+  0x00, 0x9c, 0xba, 0x00, 0x01, 0x01, 0x75, 0x00, 0x13, 0x4d, 0x00, 0x01,
+  0x01, 0x6e, 0x00, 0x9c, 0xc1, 0x00, 0x02, 0x03, 0x67, 0x69, 0x64, 0x00,
+  0x9c, 0xc8, 0x01, 0x70, 0x00, 0x9c, 0xd8, 0x00, 0x01, 0x01, 0x74, 0x00,
+  0x9c, 0xe4, 0x01, 0x03, 0x04, 0x67, 0x6e, 0x69, 0x6b, 0x00, 0x6f, 0xf9,
+  0x01, 0x6c, 0x00, 0x85, 0xec, 0x05, 0x72, 0x65, 0x68, 0x74, 0x61, 0x00,
+  0x43, 0xb8, 0x00, 0x01, 0x01, 0x64, 0x00, 0x2a, 0x10, 0x00, 0x01, 0x01,
+  0x6e, 0x00, 0x2b, 0x73, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x9c, 0xeb, 0x00,
+  0x03, 0x01, 0x65, 0x00, 0x0e, 0x15, 0x01, 0x67, 0x00, 0x0e, 0x15, 0x01,
+  0x74, 0x00, 0x32, 0x5a, 0x00, 0x02, 0x01, 0x65, 0x00, 0x60, 0x2d, 0x01,
+  0x74, 0x00, 0x9d, 0x05, 0x00, 0x01, 0x01, 0x69, 0x00, 0x35, 0x51, 0x00,
+  0x02, 0x01, 0x6f, 0x00, 0x0c, 0x1d, 0x01, 0x75, 0x00, 0x58, 0xaf, 0x00,
+  0x02, 0x01, 0x6d, 0x00, 0x28, 0xd5, 0x02, 0x72, 0x74, 0x00, 0x9d, 0x15,
+  0x00, 0x01, 0x01, 0x74, 0x00, 0x6c, 0x9e, 0x00, 0x01, 0x01, 0x68, 0x00,
+  0x35, 0x0c, 0x00, 0x01, 0x01, 0x75, 0x00, 0x16, 0x9c, 0x01, 0x01, 0x01,
+  0x2e, 0x00, 0x9d, 0x1c, 0x00, 0x0b, 0x03, 0x63, 0x69, 0x6e, 0x00, 0x9d,
+  0x2a, 0x01, 0x64, 0x00, 0x9d, 0x36, 0x01, 0x69, 0x00, 0x9d, 0x49, 0x01,
+  0x6b, 0x00, 0x9d, 0x5b, 0x01, 0x6c, 0x00, 0x9d, 0x7a, 0x01, 0x6e, 0x00,
+  0x9d, 0x86, 0x03, 0x72, 0x6f, 0x67, 0x00, 0x9d, 0x9a, 0x01, 0x73, 0x00,
+  0x73, 0x3c, 0x02, 0x74, 0x73, 0x00, 0x16, 0x33, 0x01, 0x77, 0x00, 0x9d,
+  0xad, 0x01, 0x7a, 0x00, 0x9d, 0xb9, 0x00, 0x03, 0x01, 0x65, 0x00, 0x9d,
+  0xc8, 0x01, 0x6f, 0x00, 0x9d, 0xd6, 0x01, 0x70, 0x00, 0x0e, 0x15, 0x00,
+  0x04, 0x01, 0x65, 0x00, 0x12, 0x22, 0x01, 0x69, 0x00, 0x26, 0xd7, 0x03,
+  0x72, 0x61, 0x67, 0x00, 0x9d, 0xdd, 0x04, 0x75, 0x6f, 0x6c, 0x63, 0x00,
+  0x9d, 0xe4, 0x00, 0x06, 0x01, 0x63, 0x00, 0x9d, 0xf0, 0x01, 0x69, 0x00,
+  0x9e, 0x00, 0x01, 0x6c, 0x00, 0x9e, 0x1a, 0x05, 0x6e, 0x61, 0x70, 0x6f,
+  0x6b, 0x00, 0x6f, 0x01, 0x01, 0x74, 0x00, 0x9e, 0x27, 0x01, 0x7a, 0x00,
+  0x9e, 0x37, 0x00, 0x03, 0x03, 0x61, 0x6c, 0x62, 0x00, 0x9e, 0x45, 0x05,
+  0x65, 0x7a, 0x72, 0x62, 0x6f, 0x00, 0x9e, 0x4c, 0x01, 0x72, 0x00, 0x41,
+  0x08, 0x00, 0x01, 0x01, 0x6c, 0x00, 0x83, 0x34, 0x00, 0x03, 0x09, 0x63,
+  0x73, 0x6f, 0x6d, 0x6f, 0x68, 0x63, 0x75, 0x72, 0x00, 0x9e, 0x58, 0x01,
+  0x67, 0x00, 0x50, 0x30, 0x04, 0x6b, 0x6c, 0x61, 0x77, 0x00, 0x13, 0x5b,
+  0x00, 0x06, 0x01, 0x65, 0x00, 0x9e, 0x5f, 0x02, 0x69, 0x6e, 0x00, 0x9e,
+  0x6e, 0x01, 0x6c, 0x00, 0x1d, 0x34, 0x01, 0x6f, 0x00, 0x9e, 0x7f, 0x03,
+  0x72, 0x6f, 0x62, 0x00, 0x9e, 0x8d, 0x01, 0x73, 0x00, 0x9e, 0x99, 0x00,
+  0x03, 0x01, 0x63, 0x00, 0x9e, 0xbc, 0x01, 0x65, 0x00, 0x9e, 0xc4, 0x01,
+  0x69, 0x00, 0x9e, 0xd0, 0x00, 0x03, 0x01, 0x6f, 0x00, 0x9e, 0xdc, 0x01,
+  0x73, 0x00, 0x9e, 0xf2, 0x01, 0x74, 0x00, 0x66, 0x37, 0x00, 0x04, 0x01,
+  0x61, 0x00, 0x9e, 0xfe, 0x01, 0x69, 0x00, 0x9f, 0x0b, 0x02, 0x75, 0x6c,
+  0x00, 0x9f, 0x2e, 0x01, 0x79, 0x00, 0x9f, 0x35, 0x00, 0x08, 0x01, 0x63,
+  0x00, 0x0e, 0x15, 0x01, 0x66, 0x00, 0x66, 0x03, 0x01, 0x6b, 0x00, 0x9f,
+  0x43, 0x01, 0x6c, 0x00, 0x9f, 0x52, 0x01, 0x6e, 0x00, 0x9f, 0x59, 0x01,
+  0x72, 0x00, 0x71, 0x4b, 0x01, 0x74, 0x00, 0x84, 0x70, 0x01, 0x77, 0x00,
+  0x9f, 0x70, 0x00, 0x03, 0x01, 0x65, 0x00, 0x9f, 0x80, 0x05, 0x6b, 0x6c,
+  0x77, 0x77, 0x6f, 0x00, 0x9f, 0x8e, 0x03, 0x6f, 0x68, 0x73, 0x00, 0x9f,
+  0x95, 0x00, 0x01, 0x01, 0x61, 0x00, 0x28, 0x66, 0x00, 0x05, 0x03, 0x61,
+  0x69, 0x77, 0x00, 0x92, 0x51, 0x01, 0x65, 0x00, 0x0f, 0x6f, 0x02, 0x6f,
+  0x70, 0x00, 0x48, 0x25, 0x01, 0x72, 0x00, 0x26, 0xd7, 0x01, 0x73, 0x00,
+  0x9f, 0xa7, 0x00, 0x02, 0x01, 0x69, 0x00, 0x13, 0x4d, 0x02, 0x6f, 0x67,
+  0x00, 0x9f, 0xaf, 0x00, 0x02, 0x01, 0x61, 0x00, 0x9f, 0xb6, 0x01, 0x6f,
+  0x00, 0x9f, 0xc2, 0x00, 0x08, 0x03, 0x62, 0x75, 0x7a, 0x00, 0x9f, 0xdd,
+  0x01, 0x64, 0x00, 0x9f, 0xe4, 0x02, 0x68, 0x63, 0x00, 0x80, 0x55, 0x01,
+  0x6e, 0x00, 0x9f, 0xf5, 0x01, 0x70, 0x00, 0x29, 0x5f, 0x01, 0x72, 0x00,
+  0xa0, 0x0a, 0x03, 0x77, 0x61, 0x6c, 0x00, 0x5d, 0xae, 0x03, 0x7a, 0x75,
+  0x74, 0x00, 0xa0, 0x17, 0x00, 0x05, 0x05, 0x61, 0x6d, 0x2d, 0x61, 0x77,
+  0x00, 0x67, 0x6c, 0x01, 0x63, 0x00, 0xa0, 0x1e, 0x03, 0x64, 0x61, 0x6c,
+  0x00, 0x9f, 0xa7, 0x01, 0x69, 0x00, 0x15, 0x5e, 0x01, 0x73, 0x00, 0xa0,
+  0x35, 0x00, 0x01, 0x01, 0x61, 0x00, 0x73, 0x3c, 0x00, 0x01, 0x01, 0x6e,
+  0x00, 0xa0, 0x42, 0x00, 0x03, 0x01, 0x63, 0x00, 0x0e, 0x15, 0x01, 0x69,
+  0x00, 0x6f, 0xbe, 0x01, 0x6b, 0x00, 0x22, 0x26, 0x00, 0x01, 0x01, 0x73,
+  0x00, 0x3e, 0xb9, 0x01, 0x01, 0x01, 0x2e, 0x00, 0xa0, 0x4a, 0x00, 0x01,
+  0x01, 0x64, 0x00, 0x67, 0x6c, 0x00, 0x01, 0x02, 0x65, 0x73, 0x00, 0x96,
+  0x1f, 0x00, 0x02, 0x01, 0x63, 0x00, 0xa0, 0x56, 0x01, 0x72, 0x00, 0x0e,
+  0x15, 0x00, 0x02, 0x01, 0x65, 0x00, 0x0f, 0x6f, 0x01, 0x74, 0x00, 0x0e,
+  0x15, 0x00, 0x02, 0x01, 0x72, 0x00, 0xa0, 0x5d, 0x01, 0x73, 0x00, 0x5d,
+  0x17, 0x00, 0x01, 0x02, 0x63, 0x65, 0x00, 0xa0, 0x6a, 0x00, 0x01, 0x01,
+  0x6f, 0x00, 0x2f, 0x47, 0x00, 0x03, 0x02, 0x65, 0x72, 0x00, 0xa0, 0x71,
+  0x02, 0x6e, 0x65, 0x00, 0xa0, 0x79, 0x01, 0x73, 0x00, 0x26, 0xd7, 0x00,
+  0x02, 0x01, 0x6f, 0x00, 0x0f, 0xfa, 0x01, 0x75, 0x00, 0xa0, 0x81, 0x00,
+  0x02, 0x01, 0x63, 0x00, 0x0e, 0x15, 0x01, 0x72, 0x00, 0x0f, 0x68, 0x00,
+  0x1c, 0x02, 0x32, 0x61, 0x00, 0x8d, 0x58, 0x02, 0x33, 0x70, 0x00, 0xa0,
+  0x88, 0x01, 0x35, 0x00, 0xa0, 0x8f, 0x01, 0x61, 0x00, 0xa0, 0x96, 0x01,
+  0x62, 0x00, 0xa0, 0xd8, 0x01, 0x63, 0x00, 0xa0, 0xea, 0x01, 0x64, 0x00,
+  0xa1, 0x25, 0x01, 0x65, 0x00, 0xa1, 0x5f, 0x01, 0x66, 0x00, 0x9a, 0x25,
+  0x01, 0x67, 0x00, 0xa1, 0xc3, 0x01, 0x68, 0x00, 0xa1, 0xd0, 0x01, 0x69,
+  0x00, 0xa1, 0xdc, 0x02, 0x6a, 0x6e, 0x00, 0xa2, 0x1b, 0x01, 0x6b, 0x00,
+  0xa2, 0x22, 0x01, 0x6c, 0x00, 0xa2, 0x5e, 0x01, 0x6d, 0x00, 0xa2, 0x8c,
+  0x01, 0x6e, 0x00, 0xa2, 0xbf, 0x01, 0x6f, 0x00, 0xa2, 0xf1, 0x01, 0x70,
+  0x00, 0xa3, 0x2b, 0x01, 0x72, 0x00, 0xa3, 0x50, 0x01, 0x73, 0x00, 0xa3,
+  0x8a, 0x01, 0x74, 0x00, 0xa3, 0xfb, 0x01, 0x75, 0x00, 0xa4, 0x45, 0x01,
+  0x76, 0x00, 0xa4, 0x78, 0x01, 0x77, 0x00, 0xa4, 0x8a, 0x01, 0x78, 0x00,
+  0xa4, 0x99, 0x01, 0x79, 0x00, 0xa4, 0xc0, 0x02, 0x7a, 0x65, 0x00, 0xa4,
+  0xf1, 0x00, 0x01, 0x01, 0x6e, 0x00, 0x5d, 0xbc, 0x00, 0x01, 0x01, 0x77,
+  0x00, 0x41, 0x08, 0x00, 0x01, 0x01, 0x61, 0x00, 0x26, 0xc4, 0x00, 0x17,
+  0x01, 0x61, 0x00, 0xa4, 0xfa, 0x01, 0x63, 0x00, 0xa5, 0x6b, 0x01, 0x64,
+  0x00, 0xa5, 0x88, 0x01, 0x65, 0x00, 0xa5, 0xa4, 0x01, 0x66, 0x00, 0xa5,
+  0xf9, 0x01, 0x67, 0x00, 0xa6, 0x08, 0x01, 0x68, 0x00, 0xa6, 0x19, 0x01,
+  0x69, 0x00, 0xa6, 0x35, 0x01, 0x6b, 0x00, 0xa6, 0x64, 0x01, 0x6c, 0x00,
+  0xa6, 0x90, 0x01, 0x6d, 0x00, 0xa6, 0xab, 0x01, 0x6e, 0x00, 0xa6, 0xd5,
+  0x01, 0x6f, 0x00, 0xa7, 0x18, 0x04, 0x70, 0x6f, 0x68, 0x73, 0x00, 0xa7,
+  0x60, 0x02, 0x71, 0x61, 0x00, 0x93, 0x83, 0x01, 0x72, 0x00, 0xa7, 0x67,
+  0x01, 0x73, 0x00, 0xa7, 0x89, 0x01, 0x74, 0x00, 0xa7, 0xdc, 0x01, 0x75,
+  0x00, 0xa8, 0x16, 0x01, 0x77, 0x00, 0xa8, 0x23, 0x01, 0x78, 0x00, 0xa8,
+  0x30, 0x01, 0x79, 0x00, 0xa8, 0x49, 0x01, 0x7a, 0x00, 0xa8, 0x94, 0x00,
+  0x01, 0x01, 0x67, 0x00, 0x26, 0xd7, 0x00, 0x01, 0x01, 0x6e, 0x00, 0x26,
+  0xd7, 0x00, 0x01, 0x01, 0x72, 0x00, 0x42, 0x43, 0x00, 0x04, 0x01, 0x35,
+  0x00, 0x0f, 0x8b, 0x01, 0x67, 0x00, 0x0e, 0x15, 0x01, 0x73, 0x00, 0x0e,
+  0x15, 0x05, 0x75, 0x6f, 0x6c, 0x63, 0x74, 0x00, 0x94, 0xad, 0x00, 0x02,
+  0x01, 0x6c, 0x00, 0x6b, 0x91, 0x01, 0x72, 0x00, 0x41, 0x08, 0x00, 0x03,
+  0x01, 0x61, 0x00, 0x0e, 0x15, 0x01, 0x71, 0x00, 0x0e, 0x15, 0x01, 0x73,
+  0x00, 0x0e, 0x15, 0x00, 0x02, 0x01, 0x37, 0x00, 0x15, 0x6c, 0x01, 0x68,
+  0x00, 0x0e, 0x15, 0x00, 0x05, 0x01, 0x62, 0x00, 0x0e, 0x15, 0x01, 0x66,
+  0x00, 0x0e, 0x15, 0x01, 0x74, 0x00, 0x0e, 0x15, 0x01, 0x78, 0x00, 0x0e,
+  0x15, 0x01, 0x7a, 0x00, 0x0e, 0x15, 0x00, 0x03, 0x01, 0x68, 0x00, 0x0e,
+  0x15, 0x01, 0x69, 0x00, 0x12, 0x22, 0x01, 0x6a, 0x00, 0x0e, 0x15, 0x00,
+  0x02, 0x01, 0x6e, 0x00, 0x0e, 0x15, 0x02, 0x6f, 0x63, 0x00, 0xa8, 0xb3,
+  0x00, 0x04, 0x01, 0x68, 0x00, 0x0e, 0x15, 0x01, 0x6c, 0x00, 0x0e, 0x15,
+  0x01, 0x73, 0x00, 0x0e, 0x15, 0x01, 0x79, 0x00, 0x0e, 0x15, 0x00, 0x03,
+  0x01, 0x67, 0x00, 0x0e, 0x15, 0x01, 0x6a, 0x00, 0x0e, 0x15, 0x04, 0x70,
+  0x70, 0x61, 0x2d, 0x00, 0xa8, 0xc4, 0x00, 0x02, 0x0c, 0x63, 0x65, 0x6e,
+  0x6e, 0x6f, 0x63, 0x6b, 0x63, 0x69, 0x75, 0x71, 0x2e, 0x00, 0x59, 0xd8,
+  0x01, 0x65, 0x00, 0x0f, 0x6f, 0x00, 0x04, 0x01, 0x67, 0x00, 0x0e, 0x15,
+  0x01, 0x6a, 0x00, 0x0e, 0x15, 0x01, 0x6e, 0x00, 0x0e, 0x15, 0x01, 0x73,
+  0x00, 0x0e, 0x15, 0x00, 0x02, 0x01, 0x67, 0x00, 0x0e, 0x15, 0x01, 0x78,
+  0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x6e, 0x00, 0x0f, 0xfa, 0x00, 0x01,
+  0x01, 0x6c, 0x00, 0x27, 0x33, 0x00, 0x01, 0x01, 0x6d, 0x00, 0x2a, 0x10,
+  0x00, 0x01, 0x03, 0x64, 0x6e, 0x61, 0x00, 0xa8, 0xcc, 0x01, 0x01, 0x03,
+  0x2e, 0x73, 0x73, 0x00, 0x15, 0x5e, 0x00, 0x01, 0x01, 0x72, 0x00, 0x4b,
+  0x25, 0x00, 0x02, 0x01, 0x6d, 0x00, 0x0e, 0x15, 0x01, 0x73, 0x00, 0x74,
+  0xc1, 0x00, 0x04, 0x01, 0x35, 0x00, 0x0e, 0x15, 0x01, 0x36, 0x00, 0x0e,
+  0x15, 0x01, 0x70, 0x00, 0x0e, 0x15, 0x01, 0x72, 0x00, 0x41, 0x08, 0x00,
+  0x02, 0x01, 0x61, 0x00, 0x0e, 0x15, 0x01, 0x68, 0x00, 0x67, 0x20, 0x00,
+  0x02, 0x01, 0x65, 0x00, 0xa8, 0xd4, 0x01, 0x69, 0x00, 0x12, 0x22, 0x00,
+  0x03, 0x01, 0x61, 0x00, 0x0e, 0x15, 0x01, 0x6f, 0x00, 0x0f, 0xfa, 0x01,
+  0x72, 0x00, 0x60, 0x40, 0x00, 0x02, 0x01, 0x63, 0x00, 0x0e, 0x15, 0x01,
+  0x65, 0x00, 0x0c, 0x1d, 0x00, 0x04, 0x01, 0x63, 0x00, 0x0e, 0x15, 0x01,
+  0x66, 0x00, 0x66, 0x03, 0x01, 0x69, 0x00, 0x0e, 0x15, 0x01, 0x72, 0x00,
+  0x0f, 0x68, 0x00, 0x02, 0x01, 0x6f, 0x00, 0x2f, 0x47, 0x01, 0x75, 0x00,
+  0x0e, 0x15, 0x00, 0x03, 0x02, 0x61, 0x68, 0x00, 0x5f, 0x90, 0x01, 0x64,
+  0x00, 0x0e, 0x15, 0x01, 0x65, 0x00, 0x0e, 0x15, 0x00, 0x05, 0x01, 0x63,
+  0x00, 0x0e, 0x15, 0x01, 0x65, 0x00, 0x1d, 0x1c, 0x01, 0x6e, 0x00, 0x93,
+  0x5b, 0x04, 0x73, 0x65, 0x6e, 0x69, 0x00, 0xa8, 0xdb, 0x01, 0x75, 0x00,
+  0x0e, 0x15, 0x00, 0x05, 0x04, 0x61, 0x72, 0x61, 0x6a, 0x00, 0x38, 0x2f,
+  0x02, 0x65, 0x6e, 0x00, 0xa8, 0xe2, 0x01, 0x6e, 0x00, 0x2a, 0x10, 0x01,
+  0x6f, 0x00, 0x93, 0x45, 0x01, 0x73, 0x00, 0x92, 0x51, 0x00, 0x01, 0x01,
+  0x65, 0x00, 0x15, 0x5e, 0x00, 0x01, 0x01, 0x79, 0x00, 0x0f, 0x6f, 0x00,
+  0x01, 0x01, 0x73, 0x00, 0x5f, 0xdf, 0x00, 0x02, 0x01, 0x6f, 0x00, 0x0e,
+  0x15, 0x02, 0x75, 0x74, 0x00, 0x94, 0xd8, 0x01, 0x01, 0x01, 0x6f, 0x00,
+  0xa8, 0xe9, 0x00, 0x02, 0x01, 0x61, 0x00, 0xa8, 0xf0, 0x01, 0x63, 0x00,
+  0xa9, 0x04, 0x00, 0x01, 0x01, 0x72, 0x00, 0x1d, 0x34, 0x00, 0x01, 0x01,
+  0x69, 0x00, 0xa9, 0x10, 0x00, 0x01, 0x01, 0x73, 0x00, 0xa9, 0x17, 0x00,
+  0x02, 0x01, 0x6f, 0x00, 0x93, 0x45, 0x01, 0x72, 0x00, 0x26, 0xd7, 0x00,
+  0x02, 0x01, 0x69, 0x00, 0x70, 0xbd, 0x01, 0x75, 0x00, 0x58, 0xaf, 0x00,
+  0x02, 0x01, 0x6e, 0x00, 0x2a, 0x10, 0x08, 0x75, 0x6f, 0x6c, 0x63, 0x65,
+  0x67, 0x6e, 0x61, 0x00, 0x5c, 0x4f, 0x00, 0x02, 0x02, 0x6f, 0x63, 0x00,
+  0xa9, 0x1e, 0x01, 0x73, 0x00, 0x9b, 0xca, 0x00, 0x02, 0x01, 0x66, 0x00,
+  0x66, 0x03, 0x01, 0x73, 0x00, 0xa9, 0x17, 0x00, 0x02, 0x01, 0x61, 0x00,
+  0x0f, 0x6f, 0x01, 0x65, 0x00, 0x0f, 0x6f, 0x00, 0x08, 0x01, 0x62, 0x00,
+  0xa9, 0x25, 0x04, 0x64, 0x6c, 0x69, 0x75, 0x00, 0x95, 0x26, 0x01, 0x65,
+  0x00, 0xa9, 0x2c, 0x01, 0x6c, 0x00, 0x40, 0x13, 0x08, 0x6e, 0x6f, 0x69,
+  0x74, 0x61, 0x72, 0x67, 0x69, 0x00, 0xa9, 0x3d, 0x06, 0x72, 0x65, 0x74,
+  0x72, 0x6f, 0x70, 0x00, 0x9b, 0x99, 0x01, 0x73, 0x00, 0xa9, 0x44, 0x08,
+  0x74, 0x6e, 0x65, 0x6d, 0x70, 0x6f, 0x6c, 0x65, 0x00, 0xa9, 0x50, 0x00,
+  0x01, 0x01, 0x6d, 0x00, 0x45, 0xa6, 0x00, 0x01, 0x02, 0x74, 0x6c, 0x00,
+  0xa9, 0x57, 0x00, 0x03, 0x01, 0x65, 0x00, 0x0f, 0x6f, 0x01, 0x6e, 0x00,
+  0x2a, 0x10, 0x01, 0x6f, 0x00, 0x93, 0x45, 0x00, 0x06, 0x02, 0x63, 0x69,
+  0x00, 0xa9, 0x5e, 0x01, 0x69, 0x00, 0xa9, 0x6a, 0x01, 0x6e, 0x00, 0xa9,
+  0x8a, 0x04, 0x73, 0x65, 0x72, 0x70, 0x00, 0x6b, 0x69, 0x03, 0x74, 0x73,
+  0x69, 0x00, 0x87, 0xe6, 0x07, 0x76, 0x69, 0x74, 0x61, 0x72, 0x65, 0x70,
+  0x00, 0x6f, 0xf9, 0x00, 0x01, 0x01, 0x6c, 0x00, 0x1c, 0x65, 0x00, 0x02,
+  0x02, 0x72, 0x62, 0x00, 0x2c, 0x10, 0x02, 0x74, 0x72, 0x00, 0xa9, 0x98,
+  0x00, 0x02, 0x01, 0x61, 0x00, 0xa9, 0xa5, 0x01, 0x69, 0x00, 0x12, 0x22,
+  0x00, 0x04, 0x01, 0x66, 0x00, 0x66, 0x03, 0x03, 0x6c, 0x62, 0x65, 0x00,
+  0x5d, 0xae, 0x01, 0x72, 0x00, 0x71, 0x4b, 0x07, 0x74, 0x6e, 0x65, 0x69,
+  0x6d, 0x69, 0x76, 0x00, 0x64, 0xb6, 0x00, 0x01, 0x02, 0x63, 0x69, 0x00,
+  0xa9, 0xb3, 0x00, 0x03, 0x03, 0x61, 0x73, 0x6b, 0x00, 0x16, 0x7b, 0x01,
+  0x65, 0x00, 0x0f, 0x6f, 0x01, 0x6e, 0x00, 0x2a, 0x10, 0x00, 0x02, 0x01,
+  0x63, 0x00, 0x0e, 0x15, 0x01, 0x72, 0x00, 0x42, 0x43, 0x00, 0x01, 0x01,
+  0x61, 0x00, 0xa9, 0xba, 0x00, 0x01, 0x01, 0x70, 0x00, 0x97, 0xbe, 0x00,
+  0x02, 0x01, 0x69, 0x00, 0x12, 0x22, 0x03, 0x70, 0x65, 0x72, 0x00, 0xa9,
+  0xc2, 0x00, 0x02, 0x01, 0x6f, 0x00, 0x84, 0xfa, 0x01, 0x72, 0x00, 0x60,
+  0x40, 0x00, 0x01, 0x01, 0x6f, 0x00, 0x14, 0x4a, 0x00, 0x02, 0x04, 0x65,
+  0x67, 0x61, 0x70, 0x00, 0xa9, 0xc9, 0x01, 0x74, 0x00, 0x44, 0x12, 0x00,
+  0x04, 0x01, 0x34, 0x00, 0x0f, 0x6f, 0x01, 0x65, 0x00, 0x0f, 0x6f, 0x0f,
+  0x69, 0x6c, 0x70, 0x65, 0x72, 0x64, 0x65, 0x6c, 0x6c, 0x61, 0x77, 0x65,
+  0x72, 0x69, 0x66, 0x00, 0xa9, 0xc2, 0x01, 0x6e, 0x00, 0x2a, 0x10, 0x00,
+  0x01, 0x01, 0x6c, 0x00, 0x27, 0x0f, 0x00, 0x02, 0x01, 0x65, 0x00, 0x0f,
+  0x6f, 0x01, 0x72, 0x00, 0x26, 0xd7, 0x00, 0x0a, 0x01, 0x65, 0x00, 0xa9,
+  0xd5, 0x08, 0x6c, 0x6c, 0x61, 0x74, 0x69, 0x73, 0x77, 0x6f, 0x00, 0x85,
+  0x8f, 0x04, 0x6d, 0x61, 0x63, 0x72, 0x00, 0xa9, 0xf9, 0x05, 0x6f, 0x66,
+  0x6e, 0x69, 0x2d, 0x00, 0x27, 0xf5, 0x01, 0x70, 0x00, 0xaa, 0x00, 0x03,
+  0x72, 0x75, 0x6f, 0x00, 0x92, 0x92, 0x01, 0x73, 0x00, 0xaa, 0x0c, 0x03,
+  0x74, 0x73, 0x72, 0x00, 0xaa, 0x1a, 0x01, 0x79, 0x00, 0x5c, 0xb0, 0x03,
+  0x7a, 0x6d, 0x75, 0x00, 0x94, 0xc3, 0x00, 0x01, 0x01, 0x6e, 0x00, 0xaa,
+  0x23, 0x00, 0x01, 0x01, 0x30, 0x00, 0x96, 0xee, 0x00, 0x02, 0x01, 0x6d,
+  0x00, 0xaa, 0x2a, 0x04, 0x74, 0x61, 0x64, 0x2d, 0x00, 0x15, 0x5e, 0x00,
+  0x02, 0x02, 0x61, 0x6c, 0x00, 0x6a, 0xdf, 0x01, 0x75, 0x00, 0xaa, 0x34,
+  0x00, 0x03, 0x01, 0x69, 0x00, 0x0f, 0x6f, 0x07, 0x72, 0x61, 0x6f, 0x62,
+  0x65, 0x6c, 0x67, 0x00, 0x5a, 0x29, 0x01, 0x75, 0x00, 0xaa, 0x3b, 0x00,
+  0x07, 0x01, 0x63, 0x00, 0xaa, 0x49, 0x08, 0x64, 0x6f, 0x6e, 0x70, 0x70,
+  0x61, 0x64, 0x2e, 0x00, 0x62, 0xa3, 0x02, 0x65, 0x67, 0x00, 0xaa, 0x63,
+  0x01, 0x6c, 0x00, 0xaa, 0x6a, 0x01, 0x6e, 0x00, 0x85, 0x06, 0x04, 0x73,
+  0x75, 0x66, 0x78, 0x00, 0x17, 0x57, 0x01, 0x74, 0x00, 0xaa, 0x7b, 0x00,
+  0x02, 0x0e, 0x67, 0x61, 0x74, 0x73, 0x6e, 0x69, 0x73, 0x65, 0x72, 0x2e,
+  0x73, 0x65, 0x63, 0x69, 0x00, 0xa9, 0x50, 0x05, 0x74, 0x73, 0x6f, 0x68,
+  0x79, 0x00, 0x6d, 0x80, 0x00, 0x01, 0x01, 0x70, 0x00, 0x5d, 0xbc, 0x00,
+  0x03, 0x09, 0x63, 0x6f, 0x72, 0x65, 0x67, 0x72, 0x6f, 0x66, 0x2e, 0x00,
+  0x6d, 0x2e, 0x02, 0x6f, 0x72, 0x00, 0x68, 0x4e, 0x0d, 0x72, 0x61, 0x6d,
+  0x79, 0x74, 0x65, 0x66, 0x61, 0x73, 0x72, 0x65, 0x73, 0x77, 0x00, 0x91,
+  0xa1, 0x00, 0x04, 0x03, 0x61, 0x69, 0x63, 0x00, 0xaa, 0x92, 0x04, 0x6d,
+  0x74, 0x73, 0x70, 0x00, 0xaa, 0x99, 0x04, 0x72, 0x6f, 0x63, 0x61, 0x00,
+  0xaa, 0xa1, 0x01, 0x79, 0x00, 0x83, 0xd8, 0x00, 0x02, 0x01, 0x69, 0x00,
+  0xaa, 0xa9, 0x01, 0x74, 0x00, 0xaa, 0xb0, 0x00, 0x02, 0x01, 0x6f, 0x00,
+  0xaa, 0xbc, 0x02, 0x70, 0x61, 0x00, 0xaa, 0xc3, 0x00, 0x02, 0x01, 0x65,
+  0x00, 0xaa, 0xd1, 0x03, 0x69, 0x61, 0x6c, 0x00, 0xaa, 0xf5, 0x00, 0x07,
+  0x02, 0x33, 0x6b, 0x00, 0xaa, 0xa1, 0x06, 0x63, 0x6f, 0x64, 0x65, 0x68,
+  0x74, 0x00, 0x9a, 0x2c, 0x05, 0x67, 0x6e, 0x69, 0x68, 0x74, 0x00, 0x95,
+  0xc9, 0x06, 0x6e, 0x65, 0x6d, 0x65, 0x69, 0x73, 0x00, 0xaa, 0xfc, 0x03,
+  0x6f, 0x6c, 0x6f, 0x00, 0x61, 0xb3, 0x06, 0x70, 0x70, 0x61, 0x72, 0x65,
+  0x76, 0x00, 0x99, 0x80, 0x01, 0x74, 0x00, 0xab, 0x03, 0x00, 0x04, 0x01,
+  0x65, 0x00, 0xab, 0x12, 0x01, 0x69, 0x00, 0xab, 0x21, 0x08, 0x72, 0x61,
+  0x65, 0x64, 0x6f, 0x6e, 0x2e, 0x65, 0x00, 0xab, 0x38, 0x01, 0x73, 0x00,
+  0xab, 0x3f, 0x00, 0x01, 0x01, 0x6b, 0x00, 0x5d, 0xbc, 0x00, 0x03, 0x08,
+  0x62, 0x73, 0x6c, 0x70, 0x72, 0x62, 0x76, 0x2e, 0x00, 0x0c, 0x1d, 0x02,
+  0x63, 0x71, 0x00, 0xab, 0x53, 0x04, 0x72, 0x6f, 0x74, 0x69, 0x00, 0x27,
+  0x3a, 0x00, 0x03, 0x01, 0x35, 0x00, 0x6c, 0x6e, 0x01, 0x6f, 0x00, 0x6a,
+  0x2e, 0x01, 0x73, 0x00, 0x51, 0x91, 0x00, 0x02, 0x01, 0x61, 0x00, 0x0e,
+  0x15, 0x01, 0x74, 0x00, 0x27, 0x0f, 0x00, 0x1e, 0x01, 0x30, 0x00, 0xab,
+  0x5c, 0x01, 0x31, 0x00, 0xab, 0x8d, 0x0b, 0x33, 0x67, 0x2d, 0x64, 0x61,
+  0x74, 0x73, 0x6f, 0x62, 0x65, 0x67, 0x00, 0x10, 0xd5, 0x01, 0x34, 0x00,
+  0xab, 0xb8, 0x0b, 0x37, 0x6b, 0x2d, 0x61, 0x6e, 0x74, 0x6f, 0x75, 0x76,
+  0x61, 0x63, 0x00, 0xab, 0xd9, 0x01, 0x38, 0x00, 0xab, 0xe1, 0x01, 0x61,
+  0x00, 0xac, 0x09, 0x0f, 0x62, 0x63, 0x74, 0x2d, 0x65, 0x69, 0x6d, 0x65,
+  0x75, 0x76, 0x65, 0x6a, 0x73, 0x65, 0x6d, 0x00, 0x0b, 0xad, 0x01, 0x64,
+  0x00, 0xac, 0x10, 0x01, 0x66, 0x00, 0xac, 0x2f, 0x01, 0x67, 0x00, 0xac,
+  0x3d, 0x01, 0x68, 0x00, 0x0e, 0x15, 0x03, 0x69, 0x7a, 0x2d, 0x00, 0x2d,
+  0xb6, 0x01, 0x6a, 0x00, 0xac, 0x64, 0x01, 0x6b, 0x00, 0xac, 0x71, 0x01,
+  0x6c, 0x00, 0xac, 0x85, 0x02, 0x6d, 0x75, 0x00, 0x67, 0x6c, 0x01, 0x6e,
+  0x00, 0xac, 0xad, 0x01, 0x6f, 0x00, 0xac, 0xf7, 0x02, 0x70, 0x70, 0x00,
+  0x46, 0x75, 0x01, 0x71, 0x00, 0xad, 0x24, 0x01, 0x72, 0x00, 0xad, 0x3b,
+  0x01, 0x73, 0x00, 0xad, 0x9f, 0x01, 0x74, 0x00, 0xad, 0xc2, 0x01, 0x75,
+  0x00, 0xad, 0xf6, 0x01, 0x76, 0x00, 0xae, 0x40, 0x09, 0x77, 0x68, 0x2d,
+  0x61, 0x6e, 0x74, 0x6f, 0x75, 0x76, 0x00, 0x0b, 0xad, 0x01, 0x78, 0x00,
+  0xae, 0x58, 0x01, 0x79, 0x00, 0xae, 0xb7, 0x0a, 0x7a, 0x39, 0x2d, 0x64,
+  0x72, 0x6f, 0x6a, 0x66, 0x73, 0x74, 0x00, 0x2a, 0x53, 0x00, 0x08, 0x0b,
+  0x32, 0x35, 0x2d, 0x61, 0x6b, 0x69, 0x69, 0x76, 0x61, 0x67, 0x61, 0x00,
+  0xae, 0xf6, 0x0d, 0x35, 0x33, 0x61, 0x79, 0x37, 0x2d, 0x6f, 0x6c, 0x6f,
+  0x75, 0x73, 0x65, 0x63, 0x00, 0x10, 0xd5, 0x01, 0x61, 0x00, 0xae, 0xfd,
+  0x01, 0x63, 0x00, 0xaf, 0x17, 0x01, 0x67, 0x00, 0xaf, 0x35, 0x0e, 0x6a,
+  0x75, 0x2d, 0x65, 0x72, 0x64, 0x69, 0x6c, 0x73, 0x2d, 0x65, 0x72, 0x74,
+  0x73, 0x00, 0x1b, 0x10, 0x0f, 0x6e, 0x6a, 0x2d, 0x64, 0x6e, 0x61, 0x6c,
+  0x68, 0x2d, 0x67, 0x6f, 0x6b, 0x73, 0x72, 0x75, 0x00, 0x6a, 0x59, 0x01,
+  0x71, 0x00, 0xaf, 0x53, 0x00, 0x07, 0x0c, 0x34, 0x73, 0x2d, 0x61, 0x74,
+  0x73, 0x61, 0x65, 0x66, 0x72, 0x6d, 0x6d, 0x00, 0x10, 0xd5, 0x07, 0x38,
+  0x6d, 0x2d, 0x64, 0x6e, 0x75, 0x73, 0x00, 0xaf, 0x7b, 0x03, 0x69, 0x6c,
+  0x2d, 0x00, 0xaf, 0x84, 0x05, 0x6c, 0x65, 0x2d, 0x73, 0x6c, 0x00, 0x12,
+  0xf0, 0x05, 0x6e, 0x35, 0x2d, 0x72, 0x64, 0x00, 0xaf, 0x8b, 0x05, 0x6f,
+  0x70, 0x2d, 0x64, 0x72, 0x00, 0x16, 0xa3, 0x03, 0x75, 0x77, 0x2d, 0x00,
+  0xaf, 0x7b, 0x00, 0x07, 0x01, 0x61, 0x00, 0xaf, 0x92, 0x09, 0x62, 0x61,
+  0x72, 0x6d, 0x2d, 0x6a, 0x64, 0x64, 0x64, 0x00, 0x2a, 0x53, 0x02, 0x69,
+  0x65, 0x00, 0xaf, 0xab, 0x03, 0x6c, 0x6f, 0x66, 0x00, 0xaf, 0xb7, 0x01,
+  0x6e, 0x00, 0xaf, 0xc4, 0x01, 0x72, 0x00, 0xaf, 0xd0, 0x07, 0x75, 0x72,
+  0x65, 0x6b, 0x73, 0x75, 0x62, 0x00, 0xaf, 0xdc, 0x00, 0x0d, 0x08, 0x61,
+  0x79, 0x62, 0x2d, 0x79, 0x72, 0x65, 0x74, 0x00, 0xaf, 0xe3, 0x01, 0x64,
+  0x00, 0xaf, 0xea, 0x01, 0x67, 0x00, 0xb0, 0x00, 0x01, 0x69, 0x00, 0xb0,
+  0x0c, 0x01, 0x6a, 0x00, 0xb0, 0x1c, 0x01, 0x6b, 0x00, 0xb0, 0x28, 0x01,
+  0x6c, 0x00, 0xb0, 0x4d, 0x01, 0x6d, 0x00, 0xb0, 0x63, 0x01, 0x6e, 0x00,
+  0xb0, 0x6f, 0x01, 0x72, 0x00, 0xb0, 0x95, 0x03, 0x73, 0x61, 0x61, 0x00,
+  0xb0, 0xae, 0x01, 0x74, 0x00, 0xb0, 0xb5, 0x01, 0x75, 0x00, 0x31, 0x67,
+  0x00, 0x05, 0x0b, 0x36, 0x32, 0x61, 0x74, 0x73, 0x2d, 0x75, 0x67, 0x73,
+  0x72, 0x6f, 0x00, 0x14, 0xed, 0x01, 0x61, 0x00, 0xb0, 0xc7, 0x01, 0x6f,
+  0x00, 0xb0, 0xe8, 0x01, 0x73, 0x00, 0xac, 0x09, 0x01, 0x76, 0x00, 0xac,
+  0x09, 0x00, 0x06, 0x07, 0x35, 0x61, 0x6c, 0x79, 0x2d, 0x79, 0x72, 0x00,
+  0xb0, 0xf4, 0x01, 0x61, 0x00, 0xb1, 0x00, 0x01, 0x6e, 0x00, 0xb1, 0x0e,
+  0x03, 0x6f, 0x6b, 0x73, 0x00, 0xb1, 0x1b, 0x01, 0x72, 0x00, 0xb1, 0x33,
+  0x05, 0x75, 0x61, 0x68, 0x61, 0x74, 0x00, 0x3f, 0x8b, 0x00, 0x03, 0x07,
+  0x30, 0x61, 0x6c, 0x75, 0x2d, 0x79, 0x73, 0x00, 0x33, 0x14, 0x01, 0x37,
+  0x00, 0xb1, 0x43, 0x01, 0x61, 0x00, 0xac, 0x09, 0x00, 0x07, 0x01, 0x65,
+  0x00, 0xb1, 0x65, 0x01, 0x6b, 0x00, 0xb1, 0x75, 0x01, 0x6c, 0x00, 0x3e,
+  0xb9, 0x07, 0x6d, 0x70, 0x6f, 0x75, 0x76, 0x74, 0x61, 0x00, 0xb1, 0x86,
+  0x03, 0x70, 0x70, 0x68, 0x00, 0x29, 0x5f, 0x0a, 0x72, 0x72, 0x6f, 0x75,
+  0x6e, 0x61, 0x64, 0x64, 0x6c, 0x65, 0x00, 0x91, 0xf4, 0x05, 0x73, 0x73,
+  0x61, 0x6e, 0x65, 0x00, 0xb1, 0x8d, 0x00, 0x02, 0x07, 0x30, 0x61, 0x6f,
+  0x71, 0x2d, 0x79, 0x73, 0x00, 0xb1, 0x94, 0x0c, 0x39, 0x34, 0x62, 0x61,
+  0x77, 0x68, 0x2d, 0x61, 0x6b, 0x68, 0x6f, 0x6a, 0x00, 0xb1, 0x9b, 0x00,
+  0x05, 0x01, 0x61, 0x00, 0xb1, 0xa2, 0x02, 0x69, 0x76, 0x00, 0xb1, 0xb6,
+  0x03, 0x6b, 0x61, 0x62, 0x00, 0x59, 0x03, 0x01, 0x6f, 0x00, 0xb1, 0xdf,
+  0x03, 0x72, 0x61, 0x6d, 0x00, 0xb1, 0xe6, 0x00, 0x09, 0x01, 0x61, 0x00,
+  0xb1, 0xf5, 0x03, 0x62, 0x69, 0x62, 0x00, 0xb2, 0x0b, 0x02, 0x65, 0x73,
+  0x00, 0xb2, 0x1b, 0x01, 0x68, 0x00, 0xac, 0x09, 0x01, 0x69, 0x00, 0xb2,
+  0x22, 0x01, 0x6c, 0x00, 0xb2, 0x2e, 0x01, 0x6e, 0x00, 0xac, 0x09, 0x01,
+  0x6f, 0x00, 0xb2, 0x3c, 0x01, 0x72, 0x00, 0xac, 0x09, 0x00, 0x07, 0x01,
+  0x61, 0x00, 0xb2, 0x52, 0x01, 0x66, 0x00, 0xac, 0x09, 0x01, 0x68, 0x00,
+  0xac, 0x09, 0x01, 0x69, 0x00, 0xb2, 0x5e, 0x01, 0x6f, 0x00, 0x26, 0xde,
+  0x01, 0x74, 0x00, 0xac, 0x09, 0x01, 0x75, 0x00, 0xb2, 0x6a, 0x00, 0x0d,
+  0x01, 0x61, 0x00, 0xb2, 0x82, 0x01, 0x65, 0x00, 0xb2, 0x99, 0x01, 0x67,
+  0x00, 0xb2, 0xe3, 0x01, 0x69, 0x00, 0xb2, 0xef, 0x01, 0x6b, 0x00, 0x17,
+  0x57, 0x06, 0x6c, 0x61, 0x64, 0x65, 0x6e, 0x64, 0x00, 0x84, 0x70, 0x05,
+  0x6d, 0x61, 0x68, 0x65, 0x72, 0x00, 0xb2, 0xfd, 0x01, 0x6e, 0x00, 0xb3,
+  0x04, 0x03, 0x6f, 0x72, 0x66, 0x00, 0xb3, 0x12, 0x01, 0x72, 0x00, 0xb3,
+  0x19, 0x02, 0x73, 0x66, 0x00, 0x4b, 0x25, 0x01, 0x75, 0x00, 0xb3, 0x27,
+  0x01, 0x79, 0x00, 0xb3, 0x2e, 0x00, 0x0a, 0x0a, 0x36, 0x61, 0x78, 0x69,
+  0x2d, 0x79, 0x67, 0x76, 0x74, 0x73, 0x00, 0x2a, 0x32, 0x01, 0x63, 0x00,
+  0x0e, 0x15, 0x01, 0x64, 0x00, 0xb3, 0x35, 0x02, 0x69, 0x65, 0x00, 0xb3,
+  0x41, 0x03, 0x6b, 0x73, 0x73, 0x00, 0xb3, 0x48, 0x01, 0x6c, 0x00, 0xb3,
+  0x4f, 0x01, 0x6d, 0x00, 0xb3, 0x63, 0x06, 0x6e, 0x69, 0x65, 0x6b, 0x6f,
+  0x74, 0x00, 0x40, 0xe3, 0x01, 0x72, 0x00, 0xb3, 0x6c, 0x01, 0x73, 0x00,
+  0xb3, 0x7f, 0x00, 0x03, 0x01, 0x65, 0x00, 0x1e, 0x60, 0x01, 0x6f, 0x00,
+  0x93, 0x4c, 0x01, 0x70, 0x00, 0xb3, 0x8b, 0x00, 0x06, 0x01, 0x61, 0x00,
+  0xb3, 0x98, 0x01, 0x65, 0x00, 0xb3, 0xb6, 0x02, 0x69, 0x6d, 0x00, 0xb3,
+  0xea, 0x01, 0x6d, 0x00, 0xac, 0x09, 0x01, 0x6f, 0x00, 0xb3, 0xf1, 0x01,
+  0x74, 0x00, 0xac, 0x09, 0x00, 0x08, 0x01, 0x61, 0x00, 0xb3, 0xf8, 0x02,
+  0x65, 0x6e, 0x00, 0xb3, 0xff, 0x01, 0x67, 0x00, 0x27, 0xf5, 0x01, 0x68,
+  0x00, 0x16, 0x9c, 0x04, 0x69, 0x67, 0x61, 0x76, 0x00, 0x29, 0x5f, 0x01,
+  0x6f, 0x00, 0xb4, 0x29, 0x02, 0x73, 0x6f, 0x00, 0xb4, 0x35, 0x02, 0x75,
+  0x68, 0x00, 0xb4, 0x47, 0x00, 0x08, 0x01, 0x61, 0x00, 0xb4, 0x57, 0x01,
+  0x65, 0x00, 0xb4, 0x86, 0x02, 0x69, 0x6e, 0x00, 0xb3, 0x27, 0x02, 0x6c,
+  0x6f, 0x00, 0xb4, 0xa2, 0x01, 0x6e, 0x00, 0xac, 0x09, 0x01, 0x6f, 0x00,
+  0xb4, 0xa9, 0x01, 0x73, 0x00, 0xb4, 0xb5, 0x03, 0x74, 0x65, 0x72, 0x00,
+  0x6d, 0x2e, 0x00, 0x06, 0x01, 0x62, 0x00, 0xb4, 0xc9, 0x03, 0x64, 0x72,
+  0x61, 0x00, 0xb4, 0xdf, 0x01, 0x67, 0x00, 0xb4, 0xeb, 0x01, 0x6a, 0x00,
+  0xb4, 0xf8, 0x03, 0x6b, 0x73, 0x69, 0x00, 0xb3, 0x48, 0x01, 0x6e, 0x00,
+  0xb5, 0x13, 0x00, 0x02, 0x01, 0x69, 0x00, 0x13, 0x4d, 0x03, 0x6c, 0x65,
+  0x73, 0x00, 0xb1, 0x86, 0x00, 0x02, 0x01, 0x62, 0x00, 0xb5, 0x28, 0x01,
+  0x6f, 0x00, 0xb5, 0x40, 0x00, 0x03, 0x01, 0x6f, 0x00, 0x93, 0x69, 0x01,
+  0x72, 0x00, 0x60, 0x40, 0x01, 0x74, 0x00, 0x0e, 0x15, 0x01, 0x01, 0x01,
+  0x2e, 0x00, 0xb5, 0x75, 0x00, 0x09, 0x01, 0x61, 0x00, 0xb5, 0xcb, 0x01,
+  0x64, 0x00, 0x5d, 0xb5, 0x0b, 0x65, 0x63, 0x61, 0x72, 0x74, 0x73, 0x6e,
+  0x64, 0x2e, 0x69, 0x63, 0x00, 0x15, 0x5e, 0x01, 0x67, 0x00, 0x69, 0x73,
+  0x01, 0x72, 0x00, 0xb5, 0xdc, 0x01, 0x73, 0x00, 0x5c, 0xdc, 0x01, 0x74,
+  0x00, 0xb5, 0xe8, 0x01, 0x77, 0x00, 0x29, 0x5f, 0x01, 0x79, 0x00, 0x5c,
+  0xb0, 0x00, 0x01, 0x01, 0x36, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x79,
+  0x00, 0x41, 0x08, 0x00, 0x01, 0x01, 0x70, 0x00, 0x27, 0xf5, 0x00, 0x02,
+  0x01, 0x64, 0x00, 0x1d, 0x1c, 0x01, 0x6f, 0x00, 0x0c, 0x1d, 0x00, 0x10,
+  0x01, 0x33, 0x00, 0xb5, 0xf9, 0x04, 0x35, 0x77, 0x74, 0x62, 0x00, 0x18,
+  0x8f, 0x05, 0x38, 0x35, 0x75, 0x77, 0x75, 0x00, 0x58, 0x1e, 0x02, 0x39,
+  0x78, 0x00, 0x7f, 0x75, 0x01, 0x61, 0x00, 0x1e, 0x60, 0x01, 0x62, 0x00,
+  0xb6, 0x0c, 0x01, 0x63, 0x00, 0xb6, 0x1a, 0x01, 0x67, 0x00, 0xb6, 0x26,
+  0x01, 0x6b, 0x00, 0xb6, 0x35, 0x01, 0x6d, 0x00, 0xb6, 0x44, 0x01, 0x6e,
+  0x00, 0xb6, 0x5e, 0x04, 0x70, 0x70, 0x61, 0x63, 0x00, 0x37, 0xb3, 0x02,
+  0x72, 0x61, 0x00, 0xb6, 0x6b, 0x01, 0x74, 0x00, 0xb6, 0x78, 0x02, 0x77,
+  0x61, 0x00, 0xb6, 0x85, 0x01, 0x79, 0x00, 0xb6, 0x9e, 0x00, 0x06, 0x04,
+  0x32, 0x30, 0x34, 0x75, 0x00, 0xb1, 0x94, 0x07, 0x34, 0x36, 0x32, 0x61,
+  0x30, 0x74, 0x37, 0x00, 0x26, 0x0f, 0x08, 0x36, 0x37, 0x38, 0x7a, 0x37,
+  0x76, 0x71, 0x35, 0x00, 0x67, 0xba, 0x03, 0x39, 0x34, 0x70, 0x00, 0xb6,
+  0xad, 0x01, 0x61, 0x00, 0x0e, 0x15, 0x03, 0x6d, 0x70, 0x6f, 0x00, 0xaa,
+  0xbc, 0x00, 0x09, 0x02, 0x31, 0x37, 0x00, 0xb6, 0xb5, 0x01, 0x33, 0x00,
+  0x7f, 0xb9, 0x01, 0x35, 0x00, 0xb6, 0xbe, 0x01, 0x37, 0x00, 0xb6, 0xd0,
+  0x03, 0x38, 0x36, 0x31, 0x00, 0xb6, 0xdd, 0x01, 0x61, 0x00, 0x0e, 0x15,
+  0x01, 0x65, 0x00, 0xb6, 0xe5, 0x01, 0x6e, 0x00, 0xb6, 0xf1, 0x03, 0x6f,
+  0x6f, 0x66, 0x00, 0x94, 0xb5, 0x00, 0x0e, 0x02, 0x31, 0x36, 0x00, 0x7f,
+  0xb9, 0x01, 0x35, 0x00, 0xb7, 0x00, 0x02, 0x62, 0x6f, 0x00, 0xb7, 0x12,
+  0x04, 0x64, 0x61, 0x6d, 0x79, 0x00, 0x9a, 0x2c, 0x03, 0x65, 0x77, 0x65,
+  0x00, 0x69, 0x7a, 0x01, 0x69, 0x00, 0xb7, 0x19, 0x03, 0x6b, 0x69, 0x6c,
+  0x00, 0x95, 0xc9, 0x05, 0x6c, 0x61, 0x73, 0x72, 0x65, 0x00, 0x59, 0x4e,
+  0x04, 0x6d, 0x69, 0x68, 0x65, 0x00, 0xb7, 0x27, 0x01, 0x6e, 0x00, 0xb7,
+  0x2e, 0x08, 0x72, 0x6f, 0x74, 0x73, 0x6e, 0x6f, 0x69, 0x68, 0x00, 0x73,
+  0x43, 0x01, 0x73, 0x00, 0x72, 0x66, 0x01, 0x74, 0x00, 0xb7, 0x43, 0x03,
+  0x75, 0x6c, 0x62, 0x00, 0xb7, 0x5f, 0x00, 0x04, 0x02, 0x33, 0x7a, 0x00,
+  0xb7, 0x67, 0x03, 0x37, 0x31, 0x71, 0x00, 0xb7, 0x6f, 0x01, 0x6c, 0x00,
+  0x0e, 0x15, 0x04, 0x6f, 0x6c, 0x62, 0x6c, 0x00, 0x6f, 0xf9, 0x00, 0x05,
+  0x05, 0x30, 0x33, 0x70, 0x76, 0x32, 0x00, 0x10, 0xdc, 0x04, 0x31, 0x33,
+  0x79, 0x6e, 0x00, 0x0d, 0xc5, 0x03, 0x32, 0x32, 0x74, 0x00, 0xb7, 0x67,
+  0x05, 0x36, 0x31, 0x71, 0x71, 0x6c, 0x00, 0x0f, 0xa0, 0x01, 0x73, 0x00,
+  0xb7, 0x76, 0x00, 0x08, 0x04, 0x35, 0x34, 0x75, 0x72, 0x00, 0x2a, 0x4c,
+  0x04, 0x61, 0x64, 0x6e, 0x65, 0x00, 0xb7, 0x7d, 0x01, 0x63, 0x00, 0x28,
+  0xd5, 0x01, 0x67, 0x00, 0xb7, 0x84, 0x01, 0x68, 0x00, 0xb7, 0x97, 0x02,
+  0x6b, 0x61, 0x00, 0xb7, 0xa3, 0x02, 0x72, 0x6f, 0x00, 0xb7, 0xbc, 0x04,
+  0x75, 0x6b, 0x75, 0x66, 0x00, 0xb7, 0xd2, 0x00, 0x07, 0x05, 0x32, 0x36,
+  0x72, 0x74, 0x6c, 0x00, 0x26, 0x08, 0x01, 0x34, 0x00, 0xb7, 0xd9, 0x05,
+  0x35, 0x32, 0x32, 0x74, 0x69, 0x00, 0x0b, 0xad, 0x03, 0x37, 0x39, 0x37,
+  0x00, 0xb6, 0xdd, 0x02, 0x63, 0x69, 0x00, 0xb7, 0xe7, 0x03, 0x6c, 0x69,
+  0x6d, 0x00, 0xb7, 0x5f, 0x05, 0x6e, 0x75, 0x70, 0x61, 0x74, 0x00, 0xb7,
+  0xf9, 0x00, 0x05, 0x03, 0x33, 0x33, 0x75, 0x00, 0x52, 0xbc, 0x03, 0x65,
+  0x6c, 0x6c, 0x00, 0xb8, 0x01, 0x01, 0x6c, 0x00, 0x16, 0x89, 0x01, 0x6f,
+  0x00, 0x3f, 0xd8, 0x05, 0x72, 0x69, 0x67, 0x65, 0x74, 0x00, 0x5d, 0x09,
+  0x00, 0x04, 0x05, 0x31, 0x31, 0x74, 0x71, 0x71, 0x00, 0x26, 0x1f, 0x04,
+  0x34, 0x31, 0x73, 0x33, 0x00, 0x2b, 0xef, 0x01, 0x65, 0x00, 0x16, 0x9c,
+  0x03, 0x73, 0x69, 0x6f, 0x00, 0xb8, 0x08, 0x00, 0x06, 0x02, 0x33, 0x30,
+  0x00, 0xb6, 0xb5, 0x05, 0x36, 0x35, 0x7a, 0x71, 0x68, 0x00, 0x0f, 0xa0,
+  0x01, 0x61, 0x00, 0xb8, 0x0f, 0x01, 0x69, 0x00, 0x13, 0x33, 0x08, 0x6e,
+  0x37, 0x70, 0x37, 0x71, 0x72, 0x74, 0x30, 0x00, 0x26, 0x0f, 0x01, 0x6f,
+  0x00, 0xb8, 0x1e, 0x00, 0x10, 0x05, 0x31, 0x33, 0x31, 0x72, 0x6f, 0x00,
+  0x16, 0xc6, 0x04, 0x37, 0x71, 0x72, 0x62, 0x00, 0x0b, 0x7d, 0x01, 0x61,
+  0x00, 0x2b, 0x7a, 0x01, 0x63, 0x00, 0x0e, 0x15, 0x07, 0x64, 0x69, 0x61,
+  0x6b, 0x6b, 0x6f, 0x68, 0x00, 0xb8, 0x2a, 0x01, 0x67, 0x00, 0xb8, 0x31,
+  0x01, 0x68, 0x00, 0x7f, 0xc0, 0x03, 0x6b, 0x6f, 0x6e, 0x00, 0x29, 0xae,
+  0x01, 0x6c, 0x00, 0x16, 0x89, 0x01, 0x6d, 0x00, 0x46, 0x75, 0x05, 0x6e,
+  0x61, 0x67, 0x61, 0x6e, 0x00, 0xb8, 0x3f, 0x01, 0x6f, 0x00, 0xb8, 0x46,
+  0x05, 0x72, 0x6f, 0x70, 0x70, 0x61, 0x00, 0xb7, 0x7d, 0x02, 0x74, 0x6f,
+  0x00, 0xb8, 0x57, 0x02, 0x77, 0x74, 0x00, 0x29, 0xbc, 0x04, 0x79, 0x6b,
+  0x6f, 0x74, 0x00, 0xb8, 0x68, 0x00, 0x02, 0x01, 0x61, 0x00, 0xb8, 0x6f,
+  0x01, 0x6f, 0x00, 0xb8, 0x76, 0x00, 0x06, 0x04, 0x32, 0x78, 0x72, 0x6f,
+  0x00, 0x18, 0x8f, 0x07, 0x61, 0x74, 0x73, 0x65, 0x6c, 0x74, 0x74, 0x00,
+  0x17, 0xbd, 0x01, 0x65, 0x00, 0xb8, 0x89, 0x01, 0x67, 0x00, 0x0e, 0x15,
+  0x01, 0x6f, 0x00, 0x27, 0x16, 0x04, 0x75, 0x66, 0x65, 0x6b, 0x00, 0x5f,
+  0xdf, 0x00, 0x06, 0x02, 0x39, 0x6e, 0x00, 0x36, 0x51, 0x01, 0x64, 0x00,
+  0x64, 0xb6, 0x01, 0x70, 0x00, 0xb8, 0xa5, 0x06, 0x73, 0x69, 0x6b, 0x68,
+  0x63, 0x6e, 0x00, 0x4f, 0x2d, 0x01, 0x75, 0x00, 0xb8, 0xb1, 0x03, 0x78,
+  0x76, 0x70, 0x00, 0x0b, 0xb4, 0x00, 0x06, 0x01, 0x61, 0x00, 0xb8, 0xc3,
+  0x01, 0x65, 0x00, 0xb8, 0xd4, 0x06, 0x6e, 0x65, 0x74, 0x6e, 0x6f, 0x63,
+  0x00, 0xb8, 0xe1, 0x01, 0x6f, 0x00, 0x93, 0x45, 0x03, 0x73, 0x69, 0x64,
+  0x00, 0x1c, 0x65, 0x01, 0x75, 0x00, 0xb8, 0xe8, 0x00, 0x06, 0x04, 0x34,
+  0x72, 0x76, 0x70, 0x00, 0x26, 0x08, 0x03, 0x66, 0x69, 0x67, 0x00, 0xb8,
+  0xf5, 0x01, 0x68, 0x00, 0xb8, 0xfc, 0x01, 0x70, 0x00, 0x5d, 0xae, 0x04,
+  0x73, 0x74, 0x6f, 0x6b, 0x00, 0xb9, 0x0e, 0x02, 0x79, 0x6e, 0x00, 0x5d,
+  0xae, 0x00, 0x01, 0x01, 0x74, 0x00, 0xb9, 0x15, 0x00, 0x09, 0x05, 0x61,
+  0x64, 0x79, 0x6e, 0x6e, 0x00, 0x13, 0x5b, 0x01, 0x6b, 0x00, 0xb9, 0x1c,
+  0x01, 0x6c, 0x00, 0xb9, 0x23, 0x02, 0x6d, 0x6f, 0x00, 0x3c, 0x61, 0x01,
+  0x6f, 0x00, 0x15, 0x5e, 0x02, 0x70, 0x70, 0x00, 0xb9, 0x2f, 0x03, 0x72,
+  0x67, 0x6e, 0x00, 0xb9, 0x3b, 0x07, 0x75, 0x36, 0x64, 0x32, 0x37, 0x73,
+  0x72, 0x00, 0xb9, 0x47, 0x01, 0x76, 0x00, 0xa9, 0x57, 0x00, 0x01, 0x01,
+  0x74, 0x00, 0x13, 0xb1, 0x00, 0x01, 0x01, 0x69, 0x00, 0x21, 0x6d, 0x01,
+  0x01, 0x01, 0x2e, 0x00, 0xb9, 0x4e, 0x00, 0x02, 0x04, 0x6c, 0x6c, 0x64,
+  0x74, 0x00, 0x0f, 0x6f, 0x04, 0x73, 0x6e, 0x64, 0x2d, 0x00, 0x5c, 0x21,
+  0x00, 0x01, 0x01, 0x74, 0x00, 0xb9, 0x62, 0x00, 0x02, 0x01, 0x72, 0x00,
+  0xb9, 0x69, 0x01, 0x74, 0x00, 0x28, 0xd5, 0x01, 0x01, 0x01, 0x65, 0x00,
+  0x64, 0x9c, 0x00, 0x05, 0x06, 0x67, 0x61, 0x74, 0x73, 0x6b, 0x72, 0x00,
+  0x99, 0x80, 0x08, 0x6b, 0x61, 0x6c, 0x66, 0x77, 0x6f, 0x6e, 0x73, 0x00,
+  0xb9, 0x70, 0x04, 0x6e, 0x69, 0x6c, 0x6e, 0x00, 0xb9, 0x7c, 0x06, 0x74,
+  0x75, 0x70, 0x6d, 0x6f, 0x63, 0x00, 0x97, 0x82, 0x08, 0x76, 0x69, 0x72,
+  0x64, 0x68, 0x73, 0x61, 0x6c, 0x00, 0xb9, 0x89, 0x00, 0x01, 0x01, 0x73,
+  0x00, 0xb9, 0x90, 0x00, 0x02, 0x07, 0x6e, 0x61, 0x6c, 0x66, 0x68, 0x74,
+  0x72, 0x00, 0xb9, 0x97, 0x01, 0x72, 0x00, 0x99, 0x80, 0x00, 0x02, 0x01,
+  0x63, 0x00, 0x72, 0x66, 0x01, 0x6e, 0x00, 0xb9, 0x9f, 0x00, 0x01, 0x01,
+  0x79, 0x00, 0x16, 0x7b, 0x00, 0x02, 0x0b, 0x61, 0x65, 0x63, 0x6f, 0x6c,
+  0x61, 0x74, 0x69, 0x67, 0x69, 0x64, 0x00, 0x9b, 0x99, 0x02, 0x75, 0x72,
+  0x00, 0xb9, 0xa8, 0x00, 0x02, 0x01, 0x63, 0x00, 0x69, 0x73, 0x01, 0x65,
+  0x00, 0xb9, 0xaf, 0x00, 0x03, 0x03, 0x65, 0x67, 0x65, 0x00, 0x95, 0x26,
+  0x01, 0x69, 0x00, 0xb9, 0xbe, 0x03, 0x78, 0x65, 0x6e, 0x00, 0x35, 0x51,
+  0x00, 0x01, 0x03, 0x73, 0x72, 0x75, 0x00, 0x51, 0x82, 0x00, 0x01, 0x01,
+  0x75, 0x00, 0x35, 0x0c, 0x00, 0x02, 0x01, 0x63, 0x00, 0xaa, 0x92, 0x02,
+  0x73, 0x61, 0x00, 0xb9, 0xca, 0x00, 0x02, 0x02, 0x61, 0x75, 0x00, 0xb9,
+  0xd1, 0x01, 0x69, 0x00, 0x12, 0x22, 0x00, 0x02, 0x01, 0x65, 0x00, 0xb9,
+  0xd8, 0x01, 0x6e, 0x00, 0x2a, 0x10, 0x01, 0x01, 0x01, 0x75, 0x00, 0x22,
+  0x26, 0x00, 0x0a, 0x01, 0x62, 0x00, 0xb9, 0xe4, 0x04, 0x63, 0x6e, 0x6f,
+  0x67, 0x00, 0xb9, 0xf3, 0x05, 0x64, 0x69, 0x63, 0x65, 0x72, 0x00, 0xb9,
+  0xfa, 0x02, 0x67, 0x6e, 0x00, 0xba, 0x01, 0x01, 0x69, 0x00, 0xba, 0x08,
+  0x01, 0x6e, 0x00, 0xba, 0x18, 0x01, 0x6f, 0x00, 0x0f, 0x68, 0x01, 0x70,
+  0x00, 0xba, 0x25, 0x02, 0x72, 0x69, 0x00, 0x39, 0x74, 0x05, 0x74, 0x73,
+  0x69, 0x76, 0x61, 0x00, 0x17, 0x57, 0x01, 0x04, 0x01, 0x61, 0x00, 0x16,
+  0xb8, 0x01, 0x69, 0x00, 0x15, 0x5e, 0x01, 0x6d, 0x00, 0x2a, 0x10, 0x01,
+  0x73, 0x00, 0x15, 0x5e, 0x00, 0x05, 0x01, 0x62, 0x00, 0x26, 0xd7, 0x01,
+  0x65, 0x00, 0x67, 0x54, 0x01, 0x6a, 0x00, 0x27, 0x0f, 0x01, 0x73, 0x00,
+  0x0f, 0x68, 0x01, 0x74, 0x00, 0x9b, 0xd1, 0x00, 0x04, 0x01, 0x65, 0x00,
+  0x12, 0x22, 0x01, 0x6d, 0x00, 0x15, 0x5e, 0x01, 0x6e, 0x00, 0xba, 0x37,
+  0x01, 0x72, 0x00, 0x16, 0x7b, 0x00, 0x05, 0x07, 0x64, 0x6e, 0x61, 0x72,
+  0x67, 0x61, 0x6e, 0x00, 0xba, 0x43, 0x01, 0x66, 0x00, 0x4c, 0x18, 0x01,
+  0x68, 0x00, 0x16, 0x7b, 0x06, 0x6c, 0x6c, 0x69, 0x76, 0x6e, 0x69, 0x00,
+  0x61, 0xc1, 0x05, 0x72, 0x64, 0x6e, 0x61, 0x6f, 0x00, 0xba, 0x4a, 0x00,
+  0x04, 0x01, 0x64, 0x00, 0x16, 0xb8, 0x01, 0x65, 0x00, 0x1e, 0x60, 0x01,
+  0x67, 0x00, 0x0c, 0x1d, 0x01, 0x6e, 0x00, 0xba, 0x51, 0x00, 0x06, 0x01,
+  0x65, 0x00, 0xba, 0x5d, 0x01, 0x6c, 0x00, 0xba, 0x69, 0x01, 0x6e, 0x00,
+  0xba, 0x75, 0x02, 0x6f, 0x6c, 0x00, 0xba, 0x86, 0x01, 0x70, 0x00, 0x0f,
+  0x68, 0x01, 0x72, 0x00, 0x41, 0x08, 0x00, 0x01, 0x01, 0x76, 0x00, 0x0f,
+  0x68, 0x00, 0x08, 0x01, 0x64, 0x00, 0x5d, 0xbc, 0x01, 0x6b, 0x00, 0x6d,
+  0x60, 0x01, 0x6e, 0x00, 0xba, 0x97, 0x03, 0x6f, 0x72, 0x65, 0x00, 0xba,
+  0x9e, 0x01, 0x72, 0x00, 0xba, 0xa5, 0x01, 0x73, 0x00, 0x0f, 0x68, 0x01,
+  0x74, 0x00, 0x1d, 0x34, 0x01, 0x78, 0x00, 0x43, 0x6a, 0x00, 0x04, 0x02,
+  0x61, 0x74, 0x00, 0xba, 0xb2, 0x01, 0x65, 0x00, 0x26, 0xde, 0x01, 0x69,
+  0x00, 0x12, 0x22, 0x01, 0x73, 0x00, 0x8d, 0x58, 0x00, 0x06, 0x01, 0x61,
+  0x00, 0x0e, 0x15, 0x01, 0x64, 0x00, 0x26, 0xd7, 0x01, 0x65, 0x00, 0xba,
+  0xbe, 0x01, 0x66, 0x00, 0x0e, 0x15, 0x01, 0x69, 0x00, 0x0f, 0xfa, 0x01,
+  0x6f, 0x00, 0xba, 0xcb, 0x00, 0x01, 0x01, 0x63, 0x00, 0x1d, 0x34, 0x00,
+  0x07, 0x05, 0x61, 0x72, 0x69, 0x65, 0x62, 0x00, 0x36, 0xd0, 0x01, 0x63,
+  0x00, 0xba, 0xd7, 0x01, 0x64, 0x00, 0xba, 0xeb, 0x01, 0x65, 0x00, 0xba,
+  0xfc, 0x01, 0x69, 0x00, 0xbb, 0x08, 0x01, 0x72, 0x00, 0x0f, 0x68, 0x01,
+  0x74, 0x00, 0xbb, 0x1e, 0x00, 0x05, 0x01, 0x65, 0x00, 0x1d, 0x1c, 0x01,
+  0x6d, 0x00, 0xbb, 0x2c, 0x01, 0x6f, 0x00, 0x2f, 0x47, 0x01, 0x70, 0x00,
+  0x26, 0xd7, 0x01, 0x73, 0x00, 0x1d, 0x34, 0x00, 0x05, 0x01, 0x61, 0x00,
+  0x16, 0x9c, 0x01, 0x67, 0x00, 0x26, 0xd7, 0x01, 0x6f, 0x00, 0xbb, 0x38,
+  0x01, 0x74, 0x00, 0x0f, 0x6f, 0x01, 0x75, 0x00, 0x16, 0x7b, 0x00, 0x03,
+  0x01, 0x61, 0x00, 0xbb, 0x44, 0x01, 0x65, 0x00, 0x1e, 0x60, 0x01, 0x75,
+  0x00, 0xbb, 0x56, 0x00, 0x06, 0x01, 0x61, 0x00, 0x12, 0x22, 0x01, 0x65,
+  0x00, 0xbb, 0x67, 0x01, 0x6e, 0x00, 0x0f, 0xfa, 0x01, 0x6f, 0x00, 0xbb,
+  0x78, 0x01, 0x72, 0x00, 0x26, 0xd7, 0x01, 0x73, 0x00, 0x16, 0x9c, 0x00,
+  0x04, 0x05, 0x63, 0x61, 0x75, 0x67, 0x39, 0x00, 0x0e, 0x15, 0x01, 0x64,
+  0x00, 0x1d, 0x34, 0x01, 0x6a, 0x00, 0x26, 0xd7, 0x01, 0x72, 0x00, 0x0c,
+  0x1d, 0x00, 0x05, 0x01, 0x64, 0x00, 0x26, 0xd7, 0x01, 0x65, 0x00, 0x1e,
+  0x60, 0x02, 0x6f, 0x67, 0x00, 0xbb, 0x84, 0x01, 0x72, 0x00, 0x27, 0x0f,
+  0x01, 0x74, 0x00, 0x0e, 0x15, 0x00, 0x03, 0x01, 0x68, 0x00, 0x15, 0x5e,
+  0x01, 0x6c, 0x00, 0x27, 0x0f, 0x01, 0x6f, 0x00, 0xbb, 0x8b, 0x00, 0x02,
+  0x01, 0x69, 0x00, 0xbb, 0x97, 0x01, 0x6f, 0x00, 0x29, 0xae, 0x00, 0x01,
+  0x01, 0x6f, 0x00, 0x1d, 0x1c, 0x00, 0x02, 0x01, 0x61, 0x00, 0x43, 0xb8,
+  0x01, 0x6f, 0x00, 0x97, 0x5e, 0x00, 0x01, 0x01, 0x6f, 0x00, 0x87, 0xcc,
+  0x00, 0x02, 0x01, 0x70, 0x00, 0x0e, 0x15, 0x01, 0x72, 0x00, 0x15, 0x5e,
+  0x00, 0x01, 0x01, 0x61, 0x00, 0x35, 0x51, 0x00, 0x01, 0x01, 0x65, 0x00,
+  0x0f, 0xfa, 0x00, 0x03, 0x01, 0x61, 0x00, 0xbb, 0x9e, 0x01, 0x6e, 0x00,
+  0x64, 0xb6, 0x04, 0x75, 0x62, 0x6b, 0x63, 0x00, 0x35, 0xb8, 0x00, 0x01,
+  0x01, 0x70, 0x00, 0x2b, 0x46, 0x00, 0x02, 0x01, 0x63, 0x00, 0x8d, 0x01,
+  0x02, 0x72, 0x64, 0x00, 0x27, 0x01, 0x00, 0x01, 0x01, 0x62, 0x00, 0x41,
+  0x08, 0x00, 0x01, 0x01, 0x6c, 0x00, 0x2c, 0xa2, 0x00, 0x01, 0x01, 0x65,
+  0x00, 0x31, 0x67, 0x00, 0x02, 0x01, 0x2d, 0x00, 0x9b, 0x99, 0x03, 0x65,
+  0x74, 0x69, 0x00, 0xbb, 0xa5, 0x00, 0x03, 0x01, 0x63, 0x00, 0xbb, 0xac,
+  0x03, 0x6c, 0x69, 0x70, 0x00, 0x6a, 0x84, 0x01, 0x72, 0x00, 0xa0, 0x5d,
+  0x00, 0x02, 0x01, 0x63, 0x00, 0x0f, 0xfa, 0x04, 0x72, 0x67, 0x61, 0x62,
+  0x00, 0xbb, 0xcd, 0x00, 0x02, 0x01, 0x65, 0x00, 0xa0, 0x79, 0x01, 0x69,
+  0x00, 0x6f, 0xf1, 0x00, 0x02, 0x01, 0x65, 0x00, 0xbb, 0xd4, 0x01, 0x6f,
+  0x00, 0xbb, 0xf6, 0x00, 0x03, 0x01, 0x61, 0x00, 0x9b, 0xef, 0x01, 0x6f,
+  0x00, 0xbc, 0x03, 0x01, 0x72, 0x00, 0xbc, 0x11, 0x00, 0x01, 0x01, 0x64,
+  0x00, 0x28, 0xd5, 0x00, 0x01, 0x02, 0x74, 0x69, 0x00, 0xbc, 0x27, 0x00,
+  0x02, 0x01, 0x65, 0x00, 0x87, 0xcc, 0x01, 0x6d, 0x00, 0x29, 0x66, 0x00,
+  0x02, 0x01, 0x63, 0x00, 0x0e, 0x15, 0x01, 0x72, 0x00, 0x16, 0x9c, 0x00,
+  0x02, 0x02, 0x36, 0x31, 0x00, 0x26, 0x18, 0x01, 0x72, 0x00, 0x26, 0x18,
+  0x00, 0x03, 0x01, 0x6e, 0x00, 0x0e, 0x15, 0x01, 0x70, 0x00, 0x0e, 0x15,
+  0x01, 0x72, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x65, 0x00, 0xbc, 0x2f,
+  0x00, 0x02, 0x02, 0x67, 0x6e, 0x00, 0xbc, 0x36, 0x02, 0x6e, 0x6f, 0x00,
+  0x1c, 0x89, 0x00, 0x02, 0x01, 0x69, 0x00, 0x12, 0x22, 0x02, 0x75, 0x6f,
+  0x00, 0x25, 0x56, 0x00, 0x02, 0x02, 0x61, 0x73, 0x00, 0xbc, 0x42, 0x01,
+  0x6f, 0x00, 0xbc, 0x4e, 0x00, 0x03, 0x01, 0x65, 0x00, 0x0e, 0x15, 0x01,
+  0x68, 0x00, 0x0e, 0x15, 0x01, 0x6d, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x01,
+  0x67, 0x00, 0x99, 0x5f, 0x01, 0x6a, 0x00, 0xbc, 0x5c, 0x00, 0x01, 0x01,
+  0x6c, 0x00, 0x16, 0x9c, 0x00, 0x01, 0x01, 0x75, 0x00, 0x26, 0xd7, 0x00,
+  0x02, 0x01, 0x61, 0x00, 0x0e, 0x15, 0x01, 0x6f, 0x00, 0x1e, 0x60, 0x00,
+  0x01, 0x01, 0x6c, 0x00, 0x39, 0x21, 0x00, 0x02, 0x01, 0x65, 0x00, 0x0f,
+  0x6f, 0x01, 0x73, 0x00, 0x1d, 0x34, 0x00, 0x01, 0x01, 0x73, 0x00, 0x16,
+  0x7b, 0x00, 0x03, 0x01, 0x65, 0x00, 0xbc, 0x6b, 0x01, 0x69, 0x00, 0x12,
+  0x22, 0x01, 0x6f, 0x00, 0x0f, 0x68, 0x00, 0x01, 0x01, 0x65, 0x00, 0x35,
+  0x0c, 0x00, 0x03, 0x01, 0x61, 0x00, 0x0e, 0x15, 0x01, 0x6f, 0x00, 0x0c,
+  0x1d, 0x01, 0x74, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x70, 0x00, 0x4c,
+  0x86, 0x00, 0x02, 0x06, 0x73, 0x69, 0x67, 0x6f, 0x6c, 0x79, 0x00, 0xbc,
+  0x77, 0x02, 0x79, 0x6c, 0x00, 0xba, 0x97, 0x00, 0x01, 0x01, 0x61, 0x00,
+  0x91, 0xf4, 0x00, 0x01, 0x01, 0x6d, 0x00, 0x32, 0x5a, 0x00, 0x02, 0x02,
+  0x65, 0x77, 0x00, 0x98, 0x6d, 0x01, 0x6f, 0x00, 0x0c, 0x1d, 0x00, 0x02,
+  0x01, 0x63, 0x00, 0x17, 0x6e, 0x01, 0x6e, 0x00, 0x0e, 0x15, 0x00, 0x01,
+  0x03, 0x69, 0x6c, 0x6e, 0x00, 0xbc, 0x7f, 0x01, 0x01, 0x03, 0x2e, 0x6f,
+  0x77, 0x00, 0x74, 0xe9, 0x00, 0x01, 0x01, 0x74, 0x00, 0x83, 0x34, 0x00,
+  0x01, 0x01, 0x75, 0x00, 0x21, 0x6d, 0x00, 0x01, 0x01, 0x75, 0x00, 0xa9,
+  0x10, 0x01, 0x01, 0x01, 0x79, 0x00, 0xbc, 0x77, 0x00, 0x01, 0x03, 0x79,
+  0x63, 0x72, 0x00, 0xbc, 0x86, 0x00, 0x01, 0x01, 0x74, 0x00, 0x32, 0x5a,
+  0x00, 0x01, 0x01, 0x69, 0x00, 0x27, 0x0f, 0x00, 0x01, 0x01, 0x63, 0x00,
+  0x29, 0xdf, 0x00, 0x02, 0x03, 0x63, 0x69, 0x70, 0x00, 0xbc, 0x8d, 0x01,
+  0x6e, 0x00, 0x4b, 0x25, 0x00, 0x02, 0x01, 0x72, 0x00, 0x8e, 0x8d, 0x01,
+  0x75, 0x00, 0x66, 0xc6, 0x00, 0x01, 0x01, 0x75, 0x00, 0x2f, 0x47, 0x01,
+  0x01, 0x01, 0x2e, 0x00, 0xbc, 0x97, 0x00, 0x01, 0x01, 0x6e, 0x00, 0x29,
+  0xdf, 0x00, 0x01, 0x01, 0x73, 0x00, 0xbc, 0xad, 0x00, 0x01, 0x01, 0x6e,
+  0x00, 0x39, 0x28, 0x00, 0x01, 0x01, 0x6e, 0x00, 0x35, 0x0c, 0x00, 0x01,
+  0x01, 0x73, 0x00, 0x4c, 0x7f, 0x00, 0x02, 0x01, 0x67, 0x00, 0x51, 0x91,
+  0x01, 0x6d, 0x00, 0x2c, 0x17, 0x00, 0x01, 0x01, 0x69, 0x00, 0x5c, 0x4f,
+  0x00, 0x03, 0x02, 0x61, 0x63, 0x00, 0x94, 0xe0, 0x01, 0x63, 0x00, 0xbc,
+  0xb4, 0x04, 0x75, 0x6c, 0x6f, 0x73, 0x00, 0xbc, 0xbc, 0x00, 0x01, 0x01,
+  0x6c, 0x00, 0x0f, 0x68, 0x00, 0x01, 0x01, 0x6f, 0x00, 0x20, 0xed, 0x00,
+  0x01, 0x01, 0x69, 0x00, 0x44, 0xf1, 0x00, 0x01, 0x01, 0x70, 0x00, 0x15,
+  0xf4, 0x01, 0x01, 0x05, 0x2e, 0x65, 0x74, 0x69, 0x73, 0x00, 0x93, 0x5b,
+  0x00, 0x01, 0x01, 0x65, 0x00, 0xa8, 0xd4, 0x00, 0x01, 0x01, 0x72, 0x00,
+  0x5f, 0xdf, 0x00, 0x02, 0x01, 0x6e, 0x00, 0x6d, 0x60, 0x01, 0x74, 0x00,
+  0x98, 0x89, 0x00, 0x01, 0x01, 0x6f, 0x00, 0x84, 0x69, 0x00, 0x02, 0x04,
+  0x69, 0x73, 0x75, 0x62, 0x00, 0x58, 0xfc, 0x01, 0x74, 0x00, 0x60, 0x40,
+  0x01, 0x01, 0x02, 0x78, 0x65, 0x00, 0x59, 0x3b, 0x00, 0x02, 0x01, 0x62,
+  0x00, 0x0e, 0x15, 0x01, 0x79, 0x00, 0x3c, 0xcc, 0x00, 0x01, 0x03, 0x6e,
+  0x75, 0x6f, 0x00, 0xbc, 0xc6, 0x00, 0x02, 0x02, 0x6d, 0x74, 0x00, 0xbc,
+  0xcd, 0x02, 0x76, 0x65, 0x00, 0xbc, 0xdb, 0x00, 0x09, 0x01, 0x63, 0x00,
+  0x87, 0x8f, 0x01, 0x67, 0x00, 0x87, 0x8f, 0x01, 0x69, 0x00, 0x87, 0x8f,
+  0x01, 0x6c, 0x00, 0x87, 0x8f, 0x01, 0x6d, 0x00, 0xbc, 0xe2, 0x01, 0x70,
+  0x00, 0x87, 0x8f, 0x01, 0x73, 0x00, 0x2a, 0x10, 0x01, 0x76, 0x00, 0x87,
+  0x8f, 0x01, 0x77, 0x00, 0x87, 0x8f, 0x00, 0x03, 0x01, 0x64, 0x00, 0x87,
+  0x8f, 0x01, 0x6e, 0x00, 0x87, 0x8f, 0x01, 0x73, 0x00, 0x87, 0x8f, 0x00,
+  0x06, 0x01, 0x65, 0x00, 0xbc, 0xe9, 0x01, 0x69, 0x00, 0x87, 0x8f, 0x01,
+  0x6d, 0x00, 0x87, 0x8f, 0x01, 0x6e, 0x00, 0xbc, 0xfc, 0x01, 0x73, 0x00,
+  0xbc, 0xfc, 0x01, 0x75, 0x00, 0xbd, 0x03, 0x00, 0x04, 0x01, 0x64, 0x00,
+  0x87, 0x8f, 0x06, 0x6c, 0x61, 0x73, 0x2d, 0x34, 0x2d, 0x00, 0xbd, 0x0f,
+  0x01, 0x6d, 0x00, 0x87, 0x8f, 0x01, 0x6e, 0x00, 0x87, 0x8f, 0x00, 0x02,
+  0x01, 0x6e, 0x00, 0x87, 0x8f, 0x01, 0x6f, 0x00, 0x87, 0x8f, 0x00, 0x06,
+  0x01, 0x68, 0x00, 0xbc, 0xfc, 0x01, 0x6d, 0x00, 0xbd, 0x1b, 0x01, 0x6e,
+  0x00, 0x1e, 0x60, 0x01, 0x72, 0x00, 0xbc, 0xfc, 0x01, 0x76, 0x00, 0x87,
+  0x8f, 0x01, 0x77, 0x00, 0x87, 0x8f, 0x00, 0x01, 0x01, 0x6e, 0x00, 0x87,
+  0x8f, 0x00, 0x02, 0x01, 0x61, 0x00, 0x87, 0x8f, 0x01, 0x6f, 0x00, 0x87,
+  0x8f, 0x00, 0x03, 0x01, 0x61, 0x00, 0x87, 0x8f, 0x01, 0x66, 0x00, 0x87,
+  0x8f, 0x01, 0x69, 0x00, 0x87, 0x8f, 0x00, 0x05, 0x03, 0x61, 0x66, 0x66,
+  0x00, 0x8c, 0xfa, 0x01, 0x69, 0x00, 0x87, 0x8f, 0x01, 0x6d, 0x00, 0x87,
+  0x8f, 0x01, 0x73, 0x00, 0x0f, 0x6f, 0x01, 0x74, 0x00, 0x87, 0x8f, 0x00,
+  0x03, 0x01, 0x63, 0x00, 0x87, 0x8f, 0x01, 0x6d, 0x00, 0x87, 0x8f, 0x01,
+  0x74, 0x00, 0xbd, 0x22, 0x00, 0x02, 0x01, 0x69, 0x00, 0x56, 0x74, 0x01,
+  0x72, 0x00, 0xbd, 0x2a, 0x00, 0x03, 0x01, 0x61, 0x00, 0x87, 0x8f, 0x01,
+  0x6f, 0x00, 0x87, 0x8f, 0x01, 0x70, 0x00, 0x87, 0x8f, 0x00, 0x05, 0x01,
+  0x61, 0x00, 0x87, 0x8f, 0x01, 0x64, 0x00, 0x16, 0x89, 0x01, 0x6b, 0x00,
+  0x87, 0x8f, 0x01, 0x6d, 0x00, 0x87, 0x8f, 0x02, 0x6e, 0x64, 0x00, 0xbd,
+  0x32, 0x00, 0x04, 0x01, 0x63, 0x00, 0x87, 0x8f, 0x01, 0x6d, 0x00, 0x87,
+  0x8f, 0x01, 0x75, 0x00, 0x87, 0x8f, 0x01, 0x76, 0x00, 0x87, 0x8f, 0x01,
+  0x01, 0x01, 0x2e, 0x00, 0xbd, 0x3e, 0x00, 0x02, 0x01, 0x6e, 0x00, 0x87,
+  0x8f, 0x01, 0x77, 0x00, 0xbd, 0x4f, 0x00, 0x02, 0x02, 0x6f, 0x68, 0x00,
+  0x84, 0xc6, 0x01, 0x74, 0x00, 0x87, 0x8f, 0x00, 0x04, 0x01, 0x62, 0x00,
+  0xbd, 0x57, 0x01, 0x6b, 0x00, 0x87, 0x8f, 0x01, 0x6e, 0x00, 0x87, 0x8f,
+  0x01, 0x77, 0x00, 0x87, 0x8f, 0x00, 0x01, 0x01, 0x2e, 0x00, 0xb8, 0xe1,
+  0x00, 0x01, 0x01, 0x72, 0x00, 0x16, 0x9c, 0x00, 0x01, 0x01, 0x36, 0x00,
+  0x93, 0x5b, 0x00, 0x02, 0x01, 0x6e, 0x00, 0xbd, 0x5e, 0x01, 0x74, 0x00,
+  0xbd, 0x65, 0x00, 0x01, 0x01, 0x76, 0x00, 0x29, 0xdf, 0x01, 0x01, 0x06,
+  0x2e, 0x65, 0x6c, 0x62, 0x61, 0x65, 0x00, 0x74, 0x9a, 0x01, 0x01, 0x02,
+  0x2e, 0x68, 0x00, 0x26, 0xc4, 0x00, 0x01, 0x02, 0x69, 0x65, 0x00, 0x95,
+  0xbf, 0x00, 0x02, 0x04, 0x6c, 0x69, 0x61, 0x6d, 0x00, 0xbd, 0x6c, 0x04,
+  0x74, 0x73, 0x6f, 0x68, 0x00, 0xbd, 0x6c, 0x00, 0x02, 0x01, 0x63, 0x00,
+  0x17, 0x6e, 0x03, 0x66, 0x6e, 0x69, 0x00, 0xbd, 0x75, 0x00, 0x02, 0x0a,
+  0x65, 0x75, 0x65, 0x66, 0x6b, 0x6e, 0x75, 0x66, 0x2e, 0x6e, 0x00, 0x9f,
+  0x2e, 0x01, 0x6f, 0x00, 0x0e, 0x15, 0x02, 0x01, 0x01, 0x2e, 0x00, 0xbd,
+  0x80, 0x00, 0x02, 0x01, 0x67, 0x00, 0x0e, 0x15, 0x01, 0x69, 0x00, 0x13,
+  0x4d, 0x00, 0x01, 0x01, 0x74, 0x00, 0x1d, 0x34, 0x00, 0x01, 0x01, 0x6f,
+  0x00, 0x9b, 0xb5, 0x01, 0x01, 0x02, 0x74, 0x78, 0x00, 0x22, 0x26, 0x00,
+  0x01, 0x01, 0x69, 0x00, 0x66, 0xc6, 0x00, 0x1d, 0x01, 0x30, 0x00, 0x51,
+  0x91, 0x01, 0x31, 0x00, 0x51, 0x91, 0x01, 0x32, 0x00, 0x51, 0x91, 0x01,
+  0x35, 0x00, 0x6b, 0x3e, 0x02, 0x36, 0x76, 0x00, 0x75, 0x7e, 0x01, 0x37,
+  0x00, 0xbd, 0x8d, 0x01, 0x61, 0x00, 0xbd, 0x9d, 0x01, 0x62, 0x00, 0xbd,
+  0xbe, 0x01, 0x63, 0x00, 0xbd, 0xd5, 0x01, 0x64, 0x00, 0xbd, 0xe5, 0x01,
+  0x65, 0x00, 0xbe, 0x18, 0x01, 0x66, 0x00, 0xbe, 0x5a, 0x01, 0x67, 0x00,
+  0xbe, 0x70, 0x04, 0x68, 0x76, 0x6f, 0x2e, 0x00, 0xbe, 0x7e, 0x01, 0x69,
+  0x00, 0xbe, 0x90, 0x01, 0x6b, 0x00, 0xbe, 0x99, 0x01, 0x6c, 0x00, 0xbe,
+  0xae, 0x01, 0x6d, 0x00, 0xbe, 0xc7, 0x01, 0x6e, 0x00, 0xbe, 0xd8, 0x01,
+  0x6f, 0x00, 0xbe, 0xf3, 0x01, 0x70, 0x00, 0xbf, 0x0f, 0x01, 0x72, 0x00,
+  0xbf, 0x3f, 0x01, 0x73, 0x00, 0xbf, 0x54, 0x01, 0x74, 0x00, 0xbf, 0x90,
+  0x01, 0x75, 0x00, 0xbf, 0xc8, 0x13, 0x76, 0x65, 0x64, 0x2d, 0x6e, 0x61,
+  0x69, 0x73, 0x73, 0x61, 0x6c, 0x74, 0x61, 0x2e, 0x64, 0x6f, 0x72, 0x70,
+  0x2e, 0x00, 0xbf, 0xd9, 0x01, 0x78, 0x00, 0xbf, 0xe1, 0x01, 0x79, 0x00,
+  0xbf, 0xfc, 0x01, 0x7a, 0x00, 0xc0, 0x2a, 0x00, 0x01, 0x01, 0x63, 0x00,
+  0x39, 0x28, 0x00, 0x02, 0x01, 0x65, 0x00, 0x1d, 0x1c, 0x01, 0x6f, 0x00,
+  0x0f, 0x68, 0x00, 0x03, 0x01, 0x66, 0x00, 0x66, 0x03, 0x01, 0x72, 0x00,
+  0x0f, 0x68, 0x01, 0x73, 0x00, 0xc0, 0x38, 0x00, 0x02, 0x01, 0x68, 0x00,
+  0x27, 0x0f, 0x01, 0x6f, 0x00, 0x0f, 0xfa, 0x00, 0x03, 0x01, 0x65, 0x00,
+  0x0f, 0x6f, 0x02, 0x6c, 0x75, 0x00, 0x51, 0x29, 0x01, 0x72, 0x00, 0x26,
+  0xd7, 0x00, 0x13, 0x09, 0x32, 0x6e, 0x2d, 0x6c, 0x6f, 0x72, 0x69, 0x74,
+  0x64, 0x00, 0x33, 0x7f, 0x08, 0x37, 0x65, 0x2d, 0x65, 0x74, 0x73, 0x6f,
+  0x61, 0x00, 0xc0, 0x44, 0x01, 0x38, 0x00, 0xc0, 0x4d, 0x01, 0x61, 0x00,
+  0x16, 0x7b, 0x01, 0x62, 0x00, 0x0e, 0x15, 0x01, 0x63, 0x00, 0xc0, 0x65,
+  0x01, 0x64, 0x00, 0x27, 0xf5, 0x01, 0x69, 0x00, 0xc0, 0x6c, 0x01, 0x6c,
+  0x00, 0xc0, 0xaf, 0x01, 0x6d, 0x00, 0xc0, 0xbe, 0x01, 0x6e, 0x00, 0xc0,
+  0xca, 0x01, 0x6f, 0x00, 0xc0, 0xec, 0x01, 0x70, 0x00, 0x0e, 0x15, 0x01,
+  0x72, 0x00, 0xc0, 0xf3, 0x01, 0x73, 0x00, 0xc1, 0x0a, 0x01, 0x74, 0x00,
+  0xc1, 0x1d, 0x01, 0x75, 0x00, 0xc1, 0x37, 0x01, 0x76, 0x00, 0xc1, 0x3e,
+  0x02, 0x7a, 0x6e, 0x00, 0xc1, 0x45, 0x00, 0x0a, 0x01, 0x2d, 0x00, 0xc1,
+  0x59, 0x09, 0x33, 0x63, 0x2d, 0x6c, 0x6f, 0x72, 0x69, 0x74, 0x2d, 0x00,
+  0xc1, 0x6a, 0x08, 0x62, 0x65, 0x2d, 0x65, 0x74, 0x73, 0x6f, 0x61, 0x00,
+  0xc1, 0x74, 0x01, 0x63, 0x00, 0xc1, 0x80, 0x0b, 0x68, 0x65, 0x2d, 0x65,
+  0x74, 0x73, 0x6f, 0x61, 0x2d, 0x64, 0x2d, 0x00, 0xc0, 0x44, 0x01, 0x6d,
+  0x00, 0xc1, 0x9a, 0x0e, 0x6f, 0x32, 0x2d, 0x6c, 0x6f, 0x72, 0x69, 0x74,
+  0x64, 0x73, 0x2d, 0x6e, 0x65, 0x7a, 0x00, 0xc1, 0xa1, 0x0a, 0x73, 0x6e,
+  0x2d, 0x6c, 0x6f, 0x72, 0x69, 0x74, 0x64, 0x73, 0x00, 0xc1, 0xa8, 0x01,
+  0x76, 0x00, 0xc1, 0xb8, 0x01, 0x7a, 0x00, 0xc1, 0xd3, 0x00, 0x07, 0x01,
+  0x66, 0x00, 0x0e, 0x15, 0x01, 0x69, 0x00, 0x27, 0x0f, 0x01, 0x6c, 0x00,
+  0x0e, 0x15, 0x01, 0x6d, 0x00, 0x0e, 0x15, 0x01, 0x70, 0x00, 0x0e, 0x15,
+  0x01, 0x72, 0x00, 0x0e, 0x15, 0x01, 0x76, 0x00, 0x0e, 0x15, 0x00, 0x02,
+  0x01, 0x70, 0x00, 0x0e, 0x15, 0x01, 0x75, 0x00, 0xc1, 0xec, 0x00, 0x0d,
+  0x01, 0x63, 0x00, 0xc1, 0xf5, 0x01, 0x66, 0x00, 0x0e, 0x15, 0x01, 0x67,
+  0x00, 0xc2, 0x07, 0x02, 0x68, 0x63, 0x00, 0x4c, 0xde, 0x01, 0x6c, 0x00,
+  0x0e, 0x15, 0x01, 0x6d, 0x00, 0xc2, 0x19, 0x01, 0x6e, 0x00, 0xc2, 0x20,
+  0x01, 0x70, 0x00, 0x0e, 0x15, 0x01, 0x72, 0x00, 0x0e, 0x15, 0x01, 0x73,
+  0x00, 0xc2, 0x2d, 0x01, 0x74, 0x00, 0xc2, 0x3a, 0x01, 0x76, 0x00, 0x0e,
+  0x15, 0x02, 0x7a, 0x6e, 0x00, 0xc2, 0x48, 0x00, 0x09, 0x01, 0x61, 0x00,
+  0x0e, 0x15, 0x01, 0x62, 0x00, 0x0e, 0x15, 0x01, 0x66, 0x00, 0x0e, 0x15,
+  0x01, 0x69, 0x00, 0x26, 0xde, 0x01, 0x6f, 0x00, 0x0e, 0x15, 0x01, 0x70,
+  0x00, 0x0e, 0x15, 0x01, 0x72, 0x00, 0x0e, 0x15, 0x01, 0x75, 0x00, 0x0f,
+  0x68, 0x01, 0x76, 0x00, 0x16, 0x9c, 0x00, 0x0c, 0x01, 0x62, 0x00, 0x0e,
+  0x15, 0x01, 0x63, 0x00, 0x0e, 0x15, 0x01, 0x64, 0x00, 0x46, 0x75, 0x01,
+  0x66, 0x00, 0x0e, 0x15, 0x01, 0x6c, 0x00, 0xc2, 0x4f, 0x01, 0x6d, 0x00,
+  0x0e, 0x15, 0x01, 0x6e, 0x00, 0xc2, 0x63, 0x01, 0x70, 0x00, 0x0e, 0x15,
+  0x01, 0x72, 0x00, 0xc2, 0x75, 0x01, 0x73, 0x00, 0xc2, 0x7c, 0x01, 0x74,
+  0x00, 0xc2, 0x85, 0x01, 0x76, 0x00, 0x0e, 0x15, 0x00, 0x04, 0x01, 0x61,
+  0x00, 0x54, 0x59, 0x01, 0x62, 0x00, 0x0e, 0x15, 0x01, 0x63, 0x00, 0x0e,
+  0x15, 0x01, 0x6f, 0x00, 0xc2, 0x92, 0x00, 0x05, 0x01, 0x61, 0x00, 0x0f,
+  0xfa, 0x01, 0x66, 0x00, 0x0e, 0x15, 0x01, 0x69, 0x00, 0xc2, 0xa0, 0x01,
+  0x6f, 0x00, 0x26, 0xde, 0x01, 0x72, 0x00, 0x0e, 0x15, 0x00, 0x09, 0x01,
+  0x61, 0x00, 0xc2, 0xb5, 0x01, 0x62, 0x00, 0x0e, 0x15, 0x01, 0x63, 0x00,
+  0x0e, 0x15, 0x01, 0x65, 0x00, 0xc2, 0xc1, 0x01, 0x69, 0x00, 0xc2, 0xd4,
+  0x01, 0x6d, 0x00, 0xc2, 0xdb, 0x01, 0x70, 0x00, 0x0e, 0x15, 0x01, 0x72,
+  0x00, 0x0e, 0x15, 0x01, 0x74, 0x00, 0x0e, 0x15, 0x00, 0x0e, 0x01, 0x61,
+  0x00, 0xc2, 0xe2, 0x01, 0x62, 0x00, 0xc2, 0xe9, 0x01, 0x63, 0x00, 0xc2,
+  0xf2, 0x02, 0x65, 0x6e, 0x00, 0x5d, 0x09, 0x01, 0x67, 0x00, 0xc2, 0xf9,
+  0x01, 0x69, 0x00, 0xc3, 0x00, 0x01, 0x6c, 0x00, 0x0e, 0x15, 0x01, 0x6d,
+  0x00, 0xc3, 0x1c, 0x01, 0x6e, 0x00, 0xc3, 0x2e, 0x01, 0x70, 0x00, 0x0e,
+  0x15, 0x01, 0x72, 0x00, 0xc3, 0x4c, 0x01, 0x73, 0x00, 0xc3, 0x58, 0x01,
+  0x74, 0x00, 0xc3, 0x68, 0x02, 0x7a, 0x7a, 0x00, 0xc3, 0x79, 0x00, 0x04,
+  0x01, 0x61, 0x00, 0x0e, 0x15, 0x01, 0x6f, 0x00, 0x93, 0x4c, 0x01, 0x73,
+  0x00, 0x0e, 0x15, 0x01, 0x74, 0x00, 0x0e, 0x15, 0x00, 0x0c, 0x01, 0x61,
+  0x00, 0xc3, 0x86, 0x01, 0x62, 0x00, 0x66, 0x37, 0x01, 0x63, 0x00, 0x0e,
+  0x15, 0x01, 0x66, 0x00, 0x0e, 0x15, 0x01, 0x67, 0x00, 0x0e, 0x15, 0x01,
+  0x6b, 0x00, 0x0e, 0x15, 0x01, 0x6d, 0x00, 0x1d, 0x34, 0x01, 0x6f, 0x00,
+  0x0e, 0x15, 0x01, 0x70, 0x00, 0x0e, 0x15, 0x01, 0x73, 0x00, 0x0e, 0x15,
+  0x01, 0x74, 0x00, 0x0e, 0x15, 0x01, 0x76, 0x00, 0x0e, 0x15, 0x00, 0x0a,
+  0x01, 0x61, 0x00, 0xc3, 0x92, 0x01, 0x62, 0x00, 0x0e, 0x15, 0x01, 0x63,
+  0x00, 0x0e, 0x15, 0x02, 0x65, 0x6c, 0x00, 0xc3, 0xa3, 0x01, 0x69, 0x00,
+  0x0e, 0x15, 0x01, 0x6d, 0x00, 0x0e, 0x15, 0x01, 0x6f, 0x00, 0xc3, 0xaa,
+  0x01, 0x73, 0x00, 0x0e, 0x15, 0x01, 0x74, 0x00, 0x0e, 0x15, 0x01, 0x76,
+  0x00, 0x0e, 0x15, 0x00, 0x09, 0x01, 0x61, 0x00, 0x0e, 0x15, 0x01, 0x62,
+  0x00, 0x0e, 0x15, 0x01, 0x63, 0x00, 0x0e, 0x15, 0x01, 0x6c, 0x00, 0x0e,
+  0x15, 0x01, 0x6d, 0x00, 0x0e, 0x15, 0x04, 0x6e, 0x6f, 0x6d, 0x64, 0x00,
+  0xc3, 0xb6, 0x01, 0x6f, 0x00, 0xc3, 0xbd, 0x01, 0x70, 0x00, 0x0e, 0x15,
+  0x01, 0x76, 0x00, 0x0e, 0x15, 0x00, 0x04, 0x01, 0x64, 0x00, 0x1d, 0x34,
+  0x01, 0x6c, 0x00, 0x0e, 0x15, 0x01, 0x6e, 0x00, 0x0e, 0x15, 0x01, 0x70,
+  0x00, 0x0e, 0x15, 0x00, 0x06, 0x01, 0x61, 0x00, 0x0e, 0x15, 0x01, 0x6f,
+  0x00, 0x0c, 0x1d, 0x01, 0x70, 0x00, 0x0e, 0x15, 0x01, 0x73, 0x00, 0x0e,
+  0x15, 0x01, 0x74, 0x00, 0x0e, 0x15, 0x01, 0x76, 0x00, 0x0e, 0x15, 0x00,
+  0x04, 0x01, 0x64, 0x00, 0xc3, 0xc4, 0x05, 0x65, 0x6c, 0x6c, 0x61, 0x76,
+  0x00, 0xc3, 0xce, 0x03, 0x6c, 0x69, 0x63, 0x00, 0x85, 0x44, 0x04, 0x6e,
+  0x61, 0x63, 0x73, 0x00, 0x4c, 0x11, 0x00, 0x04, 0x01, 0x61, 0x00, 0x26,
+  0xde, 0x01, 0x62, 0x00, 0x0e, 0x15, 0x01, 0x63, 0x00, 0x0e, 0x15, 0x01,
+  0x70, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x03, 0x75, 0x61, 0x74, 0x00, 0x9b,
+  0xdf, 0x00, 0x02, 0x06, 0x65, 0x67, 0x61, 0x6e, 0x61, 0x6d, 0x00, 0xc3,
+  0xdb, 0x01, 0x70, 0x00, 0xc3, 0xe6, 0x00, 0x01, 0x01, 0x6c, 0x00, 0x58,
+  0xaf, 0x00, 0x01, 0x01, 0x73, 0x00, 0x91, 0xf4, 0x00, 0x02, 0x01, 0x75,
+  0x00, 0x27, 0x3a, 0x03, 0x76, 0x6f, 0x67, 0x00, 0xc3, 0xef, 0x00, 0x01,
+  0x01, 0x62, 0x00, 0x5d, 0xae, 0x00, 0x02, 0x01, 0x6c, 0x00, 0x83, 0x34,
+  0x01, 0x73, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x62, 0x00, 0x6b, 0x69,
+  0x00, 0x03, 0x03, 0x6d, 0x6f, 0x74, 0x00, 0xb9, 0xf3, 0x04, 0x70, 0x69,
+  0x63, 0x6e, 0x00, 0x8e, 0x7a, 0x01, 0x72, 0x00, 0x64, 0x48, 0x00, 0x03,
+  0x01, 0x63, 0x00, 0x0e, 0x15, 0x02, 0x64, 0x61, 0x00, 0xc3, 0xf7, 0x01,
+  0x68, 0x00, 0x56, 0x74, 0x00, 0x01, 0x01, 0x71, 0x00, 0x0e, 0x15, 0x00,
+  0x01, 0x01, 0x6e, 0x00, 0x28, 0xd5, 0x01, 0x01, 0x01, 0x2e, 0x00, 0xc3,
+  0xfe, 0x01, 0x01, 0x01, 0x73, 0x00, 0x84, 0x70, 0x00, 0x03, 0x01, 0x63,
+  0x00, 0x0e, 0x15, 0x01, 0x66, 0x00, 0x66, 0x03, 0x01, 0x72, 0x00, 0xc4,
+  0x2a, 0x00, 0x01, 0x01, 0x62, 0x00, 0x61, 0xc1, 0x00, 0x02, 0x01, 0x73,
+  0x00, 0x0e, 0x15, 0x01, 0x77, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x01, 0x69,
+  0x00, 0x0e, 0x15, 0x01, 0x6c, 0x00, 0x8d, 0x58, 0x01, 0x01, 0x01, 0x2e,
+  0x00, 0xc4, 0x36, 0x00, 0x01, 0x01, 0x73, 0x00, 0x26, 0xd7, 0x00, 0x03,
+  0x01, 0x63, 0x00, 0x26, 0xd7, 0x01, 0x65, 0x00, 0x0f, 0x6f, 0x01, 0x6e,
+  0x00, 0x0e, 0x15, 0x01, 0x01, 0x01, 0x2e, 0x00, 0xc4, 0x50, 0x01, 0x01,
+  0x01, 0x2e, 0x00, 0xc4, 0x73, 0x00, 0x01, 0x01, 0x63, 0x00, 0x97, 0xbe,
+  0x00, 0x01, 0x08, 0x7a, 0x67, 0x6e, 0x69, 0x65, 0x62, 0x6c, 0x6c, 0x00,
+  0x43, 0xb8, 0x00, 0x01, 0x02, 0x2e, 0x63, 0x00, 0xc4, 0x89, 0x00, 0x02,
+  0x02, 0x6e, 0x64, 0x00, 0xc4, 0x90, 0x01, 0x70, 0x00, 0xc4, 0x9c, 0x00,
+  0x02, 0x01, 0x61, 0x00, 0x38, 0x2f, 0x01, 0x6f, 0x00, 0x0f, 0xfa, 0x00,
+  0x03, 0x01, 0x63, 0x00, 0xc4, 0xa6, 0x01, 0x69, 0x00, 0xa0, 0x6a, 0x01,
+  0x6b, 0x00, 0xc4, 0xa6, 0x00, 0x04, 0x03, 0x61, 0x6c, 0x6b, 0x00, 0x29,
+  0xdf, 0x01, 0x6c, 0x00, 0x60, 0x40, 0x01, 0x74, 0x00, 0x0e, 0x15, 0x01,
+  0x75, 0x00, 0x94, 0xc3, 0x00, 0x05, 0x01, 0x63, 0x00, 0x0e, 0x15, 0x02,
+  0x65, 0x64, 0x00, 0x4b, 0xdd, 0x01, 0x66, 0x00, 0x66, 0x03, 0x04, 0x6c,
+  0x65, 0x76, 0x79, 0x00, 0xc4, 0xaf, 0x02, 0x6e, 0x69, 0x00, 0xc4, 0xb6,
+  0x00, 0x01, 0x01, 0x72, 0x00, 0x71, 0x4b, 0x00, 0x03, 0x01, 0x61, 0x00,
+  0xc4, 0xbd, 0x01, 0x65, 0x00, 0x91, 0x52, 0x01, 0x77, 0x00, 0x22, 0x26,
+  0x00, 0x03, 0x01, 0x6c, 0x00, 0x17, 0x57, 0x01, 0x6f, 0x00, 0x93, 0x45,
+  0x02, 0x72, 0x6f, 0x00, 0x8e, 0xad, 0x00, 0x01, 0x01, 0x69, 0x00, 0x13,
+  0x4d, 0x00, 0x02, 0x01, 0x73, 0x00, 0x0e, 0x15, 0x01, 0x7a, 0x00, 0x27,
+  0x0f, 0x00, 0x01, 0x01, 0x70, 0x00, 0xc4, 0xc9, 0x00, 0x02, 0x02, 0x65,
+  0x73, 0x00, 0x61, 0x13, 0x01, 0x6d, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x01,
+  0x69, 0x00, 0xc4, 0xd1, 0x01, 0x79, 0x00, 0xc4, 0xe2, 0x00, 0x01, 0x01,
+  0x70, 0x00, 0x27, 0x0f, 0x00, 0x01, 0x03, 0x6c, 0x63, 0x72, 0x00, 0x39,
+  0x28, 0x00, 0x02, 0x01, 0x6e, 0x00, 0xba, 0x01, 0x02, 0x72, 0x70, 0x00,
+  0x58, 0xd0, 0x00, 0x03, 0x01, 0x62, 0x00, 0x0f, 0xfa, 0x0b, 0x6e, 0x69,
+  0x74, 0x73, 0x6f, 0x68, 0x75, 0x72, 0x67, 0x65, 0x72, 0x00, 0x8d, 0xe6,
+  0x01, 0x72, 0x00, 0x41, 0x08, 0x00, 0x01, 0x03, 0x6e, 0x61, 0x74, 0x00,
+  0xc4, 0xeb, 0x00, 0x02, 0x01, 0x69, 0x00, 0xc4, 0xf2, 0x01, 0x73, 0x00,
+  0xc4, 0xfb, 0x00, 0x02, 0x07, 0x61, 0x6d, 0x64, 0x6c, 0x63, 0x2e, 0x62,
+  0x00, 0x21, 0x6d, 0x01, 0x6d, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x67,
+  0x00, 0x1e, 0x59, 0x01, 0x01, 0x01, 0x2e, 0x00, 0xc5, 0x0c, 0x00, 0x03,
+  0x01, 0x62, 0x00, 0x0e, 0x15, 0x01, 0x64, 0x00, 0xc5, 0x26, 0x01, 0x6d,
+  0x00, 0xc5, 0x33, 0x00, 0x02, 0x01, 0x61, 0x00, 0x1d, 0x1c, 0x01, 0x69,
+  0x00, 0xc5, 0x3b, 0x00, 0x05, 0x01, 0x65, 0x00, 0x0f, 0x6f, 0x02, 0x69,
+  0x61, 0x00, 0xbb, 0xa5, 0x01, 0x6e, 0x00, 0x2a, 0x10, 0x01, 0x6f, 0x00,
+  0x93, 0x45, 0x01, 0x73, 0x00, 0x6b, 0x7d, 0x00, 0x02, 0x01, 0x34, 0x00,
+  0x29, 0x66, 0x01, 0x64, 0x00, 0x1d, 0x34, 0x00, 0x02, 0x01, 0x67, 0x00,
+  0x0e, 0x15, 0x01, 0x6e, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x02, 0x6e, 0x7a,
+  0x00, 0x5f, 0x5e, 0x00, 0x01, 0x04, 0x6b, 0x76, 0x61, 0x6b, 0x00, 0xc5,
+  0x33, 0x00, 0x08, 0x01, 0x64, 0x00, 0xc5, 0x42, 0x02, 0x67, 0x75, 0x00,
+  0xc5, 0x51, 0x01, 0x69, 0x00, 0xc5, 0x58, 0x01, 0x6c, 0x00, 0x4c, 0x11,
+  0x04, 0x72, 0x61, 0x68, 0x6b, 0x00, 0x25, 0xc7, 0x01, 0x76, 0x00, 0x4c,
+  0x11, 0x01, 0x79, 0x00, 0xc4, 0xe2, 0x02, 0x7a, 0x6e, 0x00, 0x69, 0x7a,
+  0x00, 0x02, 0x03, 0x62, 0x61, 0x67, 0x00, 0xc5, 0x8b, 0x07, 0x72, 0x67,
+  0x6f, 0x6e, 0x69, 0x6c, 0x65, 0x00, 0x84, 0x96, 0x00, 0x04, 0x01, 0x61,
+  0x00, 0x8e, 0xe5, 0x01, 0x68, 0x00, 0x48, 0xd5, 0x02, 0x6f, 0x76, 0x00,
+  0x29, 0x66, 0x05, 0x74, 0x74, 0x61, 0x69, 0x6c, 0x00, 0xc5, 0x92, 0x00,
+  0x03, 0x06, 0x61, 0x6c, 0x68, 0x73, 0x79, 0x67, 0x00, 0xc5, 0x99, 0x01,
+  0x69, 0x00, 0xc4, 0xf2, 0x01, 0x73, 0x00, 0xc5, 0xa0, 0x00, 0x02, 0x02,
+  0x6f, 0x63, 0x00, 0xc5, 0xc5, 0x02, 0x79, 0x62, 0x00, 0xc5, 0xcc, 0x00,
+  0x03, 0x01, 0x67, 0x00, 0xc5, 0xd3, 0x06, 0x6a, 0x69, 0x61, 0x62, 0x72,
+  0x65, 0x00, 0x9c, 0x34, 0x02, 0x74, 0x73, 0x00, 0xc5, 0xda, 0x00, 0x01,
+  0x04, 0x6f, 0x6e, 0x61, 0x76, 0x00, 0x2a, 0x10, 0x00, 0x02, 0x05, 0x61,
+  0x64, 0x6f, 0x6e, 0x73, 0x00, 0xc5, 0xec, 0x02, 0x69, 0x6d, 0x00, 0xc5,
+  0x33, 0x00, 0x02, 0x02, 0x65, 0x6e, 0x00, 0x60, 0x95, 0x03, 0x6e, 0x65,
+  0x6b, 0x00, 0xc5, 0xf3, 0x00, 0x02, 0x03, 0x68, 0x73, 0x61, 0x00, 0xc6,
+  0x00, 0x01, 0x6e, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x01, 0x61, 0x00, 0x8f,
+  0x73, 0x02, 0x65, 0x6d, 0x00, 0x93, 0xf4, 0x00, 0x01, 0x01, 0x6d, 0x00,
+  0x41, 0xf9, 0x00, 0x02, 0x01, 0x6a, 0x00, 0x6d, 0x8e, 0x02, 0x6d, 0x61,
+  0x00, 0xc6, 0x07, 0x00, 0x02, 0x01, 0x6e, 0x00, 0x2a, 0x10, 0x01, 0x6f,
+  0x00, 0x93, 0x45, 0x00, 0x01, 0x01, 0x74, 0x00, 0x28, 0xd5, 0x00, 0x04,
+  0x03, 0x64, 0x6f, 0x63, 0x00, 0xc6, 0x0e, 0x04, 0x67, 0x61, 0x74, 0x73,
+  0x00, 0xc6, 0x15, 0x01, 0x6e, 0x00, 0x85, 0x06, 0x03, 0x72, 0x61, 0x68,
+  0x00, 0xc6, 0x22, 0x00, 0x02, 0x08, 0x6e, 0x69, 0x67, 0x61, 0x74, 0x73,
+  0x2d, 0x6f, 0x00, 0x8d, 0x5f, 0x01, 0x74, 0x00, 0x6c, 0x6e, 0x00, 0x01,
+  0x04, 0x63, 0x65, 0x74, 0x61, 0x00, 0xc6, 0x2b, 0x00, 0x02, 0x01, 0x63,
+  0x00, 0xc6, 0x32, 0x01, 0x65, 0x00, 0xc6, 0x39, 0x00, 0x02, 0x01, 0x6e,
+  0x00, 0x28, 0xd5, 0x02, 0x74, 0x70, 0x00, 0xc6, 0x40, 0x00, 0x01, 0x01,
+  0x72, 0x00, 0xbd, 0x2a, 0x00, 0x02, 0x01, 0x65, 0x00, 0xc6, 0x49, 0x02,
+  0x72, 0x65, 0x00, 0xa7, 0x60, 0x00, 0x01, 0x01, 0x72, 0x00, 0x6f, 0xc5,
+  0x00, 0x02, 0x01, 0x65, 0x00, 0x39, 0x21, 0x01, 0x75, 0x00, 0x0f, 0xfa,
+  0x00, 0x01, 0x01, 0x75, 0x00, 0xaa, 0x34, 0x00, 0x02, 0x06, 0x61, 0x77,
+  0x65, 0x74, 0x61, 0x67, 0x00, 0x14, 0x4a, 0x01, 0x6c, 0x00, 0x16, 0x9c,
+  0x00, 0x02, 0x01, 0x66, 0x00, 0x66, 0x03, 0x01, 0x72, 0x00, 0xc4, 0x2a,
+  0x00, 0x01, 0x01, 0x2d, 0x00, 0x9b, 0x99, 0x00, 0x02, 0x02, 0x65, 0x73,
+  0x00, 0xc6, 0x50, 0x03, 0x72, 0x65, 0x74, 0x00, 0xc6, 0x57, 0x00, 0x01,
+  0x01, 0x6e, 0x00, 0xbd, 0x5e, 0x00, 0x01, 0x01, 0x6c, 0x00, 0x73, 0x35,
+  0x00, 0x02, 0x03, 0x38, 0x32, 0x77, 0x00, 0x0f, 0x76, 0x01, 0x75, 0x00,
+  0x3a, 0x7d, 0x00, 0x01, 0x01, 0x6d, 0x00, 0x40, 0xdc, 0x00, 0x02, 0x01,
+  0x69, 0x00, 0x12, 0x22, 0x01, 0x72, 0x00, 0x5d, 0xbc, 0x01, 0x01, 0x06,
+  0x2e, 0x72, 0x65, 0x6c, 0x69, 0x61, 0x00, 0xc6, 0x5e, 0x00, 0x01, 0x01,
+  0x69, 0x00, 0xc6, 0x65, 0x00, 0x02, 0x01, 0x65, 0x00, 0x0e, 0x15, 0x01,
+  0x75, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x01, 0x6c, 0x00, 0x32, 0x5a, 0x02,
+  0x72, 0x66, 0x00, 0xc6, 0x6c, 0x01, 0x01, 0x0a, 0x2e, 0x65, 0x6d, 0x79,
+  0x66, 0x69, 0x6c, 0x61, 0x75, 0x71, 0x00, 0x93, 0x62, 0x00, 0x01, 0x01,
+  0x6f, 0x00, 0x97, 0x5e, 0x00, 0x02, 0x02, 0x6f, 0x63, 0x00, 0xc6, 0x75,
+  0x01, 0x74, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x05, 0x65, 0x67, 0x6f, 0x6c,
+  0x6b, 0x00, 0x1d, 0x34, 0x01, 0x73, 0x00, 0x93, 0x62, 0x00, 0x01, 0x01,
+  0x79, 0x00, 0x27, 0x0f, 0x00, 0x02, 0x01, 0x65, 0x00, 0x12, 0x22, 0x01,
+  0x69, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x61, 0x00, 0xc6, 0x7c, 0x00,
+  0x01, 0x01, 0x69, 0x00, 0xc6, 0x83, 0x00, 0x01, 0x01, 0x72, 0x00, 0x13,
+  0x5b, 0x00, 0x01, 0x01, 0x77, 0x00, 0x1c, 0x89, 0x00, 0x01, 0x01, 0x69,
+  0x00, 0x1e, 0x60, 0x00, 0x02, 0x02, 0x69, 0x66, 0x00, 0x5c, 0x48, 0x05,
+  0x75, 0x6d, 0x6d, 0x6f, 0x63, 0x00, 0xc6, 0x8c, 0x00, 0x02, 0x01, 0x61,
+  0x00, 0x46, 0x83, 0x01, 0x75, 0x00, 0x6b, 0xde, 0x00, 0x01, 0x03, 0x72,
+  0x65, 0x76, 0x00, 0x6b, 0x3e, 0x00, 0x01, 0x01, 0x73, 0x00, 0x73, 0x35,
+  0x00, 0x01, 0x01, 0x73, 0x00, 0x0c, 0x1d, 0x00, 0x02, 0x01, 0x72, 0x00,
+  0xc6, 0x93, 0x01, 0x74, 0x00, 0x84, 0x69, 0x00, 0x02, 0x01, 0x6c, 0x00,
+  0x5a, 0x14, 0x0b, 0x75, 0x72, 0x74, 0x6e, 0x65, 0x63, 0x61, 0x74, 0x65,
+  0x6d, 0x2e, 0x00, 0xc6, 0x9a, 0x00, 0x01, 0x01, 0x6f, 0x00, 0x0f, 0x68,
+  0x00, 0x02, 0x01, 0x6f, 0x00, 0x0f, 0xfa, 0x01, 0x74, 0x00, 0x0e, 0x15,
+  0x00, 0x03, 0x02, 0x68, 0x74, 0x00, 0x92, 0x92, 0x03, 0x6d, 0x6f, 0x73,
+  0x00, 0x92, 0x92, 0x03, 0x72, 0x6f, 0x6d, 0x00, 0x92, 0x92, 0x00, 0x01,
+  0x01, 0x63, 0x00, 0x26, 0xd7, 0x00, 0x03, 0x01, 0x69, 0x00, 0xc6, 0xa6,
+  0x01, 0x6f, 0x00, 0x62, 0x1b, 0x01, 0x74, 0x00, 0xc6, 0xb2, 0x00, 0x01,
+  0x01, 0x2d, 0x00, 0x94, 0xc3, 0x00, 0x02, 0x01, 0x6e, 0x00, 0xaa, 0x23,
+  0x01, 0x75, 0x00, 0x99, 0x6d, 0x00, 0x01, 0x03, 0x75, 0x6f, 0x6c, 0x00,
+  0xc6, 0xb9, 0x00, 0x02, 0x01, 0x65, 0x00, 0x0f, 0x6f, 0x0e, 0x72, 0x6f,
+  0x70, 0x65, 0x6c, 0x65, 0x74, 0x7a, 0x61, 0x6b, 0x2e, 0x73, 0x61, 0x61,
+  0x00, 0x76, 0x0c, 0x00, 0x02, 0x01, 0x64, 0x00, 0x26, 0xd7, 0x01, 0x6f,
+  0x00, 0x0c, 0x1d, 0x00, 0x01, 0x01, 0x72, 0x00, 0xc6, 0xc0, 0x00, 0x02,
+  0x01, 0x72, 0x00, 0xc6, 0xc7, 0x02, 0x77, 0x69, 0x00, 0x2c, 0x2d, 0x00,
+  0x01, 0x01, 0x65, 0x00, 0x64, 0x65, 0x00, 0x01, 0x01, 0x63, 0x00, 0x17,
+  0x6e, 0x00, 0x03, 0x01, 0x65, 0x00, 0x0f, 0x6f, 0x06, 0x6e, 0x65, 0x6d,
+  0x61, 0x69, 0x6c, 0x00, 0x98, 0x89, 0x01, 0x76, 0x00, 0x58, 0xaf, 0x00,
+  0x02, 0x01, 0x65, 0x00, 0x85, 0x3d, 0x01, 0x69, 0x00, 0x12, 0x22, 0x00,
+  0x03, 0x01, 0x63, 0x00, 0x0e, 0x15, 0x01, 0x66, 0x00, 0x66, 0x03, 0x01,
+  0x67, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x03, 0x6e, 0x6f, 0x7a, 0x00, 0xc6,
+  0xd3, 0x02, 0x74, 0x69, 0x00, 0xc6, 0xdc, 0x00, 0x01, 0x01, 0x61, 0x00,
+  0x66, 0xc6, 0x00, 0x01, 0x01, 0x74, 0x00, 0x14, 0x4a, 0x00, 0x01, 0x01,
+  0x70, 0x00, 0xc6, 0xdc, 0x00, 0x01, 0x02, 0x68, 0x73, 0x00, 0xc6, 0xe4,
+  0x00, 0x01, 0x01, 0x61, 0x00, 0x87, 0xcc, 0x00, 0x01, 0x01, 0x64, 0x00,
+  0x99, 0xa9, 0x00, 0x01, 0x01, 0x65, 0x00, 0x13, 0x4d, 0x00, 0x02, 0x01,
+  0x63, 0x00, 0x0e, 0x15, 0x01, 0x6e, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01,
+  0x72, 0x00, 0x5d, 0xbc, 0x00, 0x01, 0x01, 0x2d, 0x00, 0x66, 0x03, 0x00,
+  0x01, 0x01, 0x72, 0x00, 0x2a, 0x10, 0x00, 0x01, 0x01, 0x6e, 0x00, 0xc6,
+  0xeb, 0x00, 0x02, 0x01, 0x68, 0x00, 0x93, 0xc5, 0x03, 0x73, 0x74, 0x79,
+  0x00, 0x93, 0x8a, 0x00, 0x02, 0x01, 0x65, 0x00, 0xc6, 0xf2, 0x02, 0x73,
+  0x65, 0x00, 0xc6, 0xf2, 0x00, 0x01, 0x01, 0x6c, 0x00, 0x45, 0xa6, 0x00,
+  0x01, 0x01, 0x72, 0x00, 0x16, 0x89, 0x01, 0x01, 0x05, 0x72, 0x6f, 0x67,
+  0x68, 0x7a, 0x00, 0x5d, 0xbc, 0x00, 0x01, 0x06, 0x7a, 0x68, 0x7a, 0x69,
+  0x72, 0x6f, 0x00, 0x4d, 0x64, 0x00, 0x01, 0x01, 0x69, 0x00, 0xc6, 0xf9,
+  0x00, 0x01, 0x04, 0x6e, 0x6c, 0x65, 0x6d, 0x00, 0x6d, 0x87, 0x00, 0x03,
+  0x02, 0x6e, 0x61, 0x00, 0xc7, 0x00, 0x01, 0x74, 0x00, 0xc7, 0x07, 0x01,
+  0x76, 0x00, 0xc7, 0x13, 0x00, 0x01, 0x01, 0x72, 0x00, 0x6b, 0x7d, 0x00,
+  0x02, 0x01, 0x62, 0x00, 0x25, 0x56, 0x01, 0x76, 0x00, 0x25, 0x56, 0x00,
+  0x01, 0x01, 0x72, 0x00, 0x35, 0x0c, 0x00, 0x01, 0x01, 0x76, 0x00, 0x83,
+  0x0e, 0x00, 0x01, 0x01, 0x68, 0x00, 0x28, 0x66, 0x00, 0x02, 0x03, 0x61,
+  0x6c, 0x6f, 0x00, 0xc7, 0x2c, 0x01, 0x69, 0x00, 0x35, 0x0c, 0x00, 0x05,
+  0x04, 0x61, 0x6c, 0x6f, 0x6b, 0x00, 0x97, 0xbe, 0x01, 0x68, 0x00, 0x93,
+  0xd1, 0x01, 0x6b, 0x00, 0xc7, 0x33, 0x01, 0x76, 0x00, 0x26, 0xde, 0x01,
+  0x79, 0x00, 0x35, 0x0c, 0x00, 0x02, 0x01, 0x67, 0x00, 0xc7, 0x3a, 0x01,
+  0x6b, 0x00, 0xc7, 0x33, 0x00, 0x03, 0x01, 0x61, 0x00, 0xc7, 0x41, 0x02,
+  0x73, 0x61, 0x00, 0xc7, 0x41, 0x03, 0x74, 0x76, 0x6f, 0x00, 0xc6, 0xf9,
+  0x00, 0x02, 0x01, 0x6e, 0x00, 0x0e, 0x15, 0x01, 0x72, 0x00, 0x71, 0x4b,
+  0x00, 0x01, 0x01, 0x7a, 0x00, 0x26, 0x0f, 0x00, 0x01, 0x01, 0x6c, 0x00,
+  0x1c, 0x89, 0x00, 0x01, 0x02, 0x61, 0x31, 0x00, 0x0f, 0x92, 0x00, 0x01,
+  0x02, 0x76, 0x61, 0x00, 0x36, 0x21, 0x00, 0x02, 0x01, 0x63, 0x00, 0x94,
+  0x82, 0x01, 0x7a, 0x00, 0xc7, 0x48, 0x00, 0x01, 0x01, 0x72, 0x00, 0x4f,
+  0xff, 0x00, 0x01, 0x02, 0x6d, 0x77, 0x00, 0x16, 0x7b, 0x00, 0x01, 0x02,
+  0x6e, 0x61, 0x00, 0x32, 0x88, 0x00, 0x01, 0x01, 0x74, 0x00, 0x42, 0x43,
+  0x01, 0x01, 0x01, 0x2e, 0x00, 0x1e, 0x60, 0x00, 0x01, 0x01, 0x72, 0x00,
+  0x3f, 0xd8, 0x00, 0x01, 0x01, 0x72, 0x00, 0x14, 0x4a, 0x01, 0x01, 0x01,
+  0x2e, 0x00, 0xc7, 0x4f, 0x00, 0x01, 0x02, 0x69, 0x64, 0x00, 0x51, 0x1b,
+  0x00, 0x01, 0x01, 0x61, 0x00, 0x27, 0xf5, 0x00, 0x02, 0x01, 0x31, 0x00,
+  0x98, 0x97, 0x0b, 0x61, 0x62, 0x75, 0x72, 0x61, 0x2e, 0x72, 0x75, 0x65,
+  0x2e, 0x31, 0x00, 0x98, 0x97, 0x01, 0x01, 0x01, 0x2e, 0x00, 0xc7, 0x5b,
+  0x00, 0x01, 0x02, 0x6e, 0x65, 0x00, 0xc7, 0x67, 0x01, 0x01, 0x01, 0x2e,
+  0x00, 0x60, 0x1f, 0x00, 0x02, 0x04, 0x69, 0x73, 0x6e, 0x65, 0x00, 0x6c,
+  0x6e, 0x05, 0x74, 0x6e, 0x65, 0x67, 0x61, 0x00, 0xa9, 0x3d, 0x00, 0x01,
+  0x01, 0x62, 0x00, 0x14, 0x4a, 0x00, 0x03, 0x01, 0x61, 0x00, 0x0f, 0xfa,
+  0x01, 0x6b, 0x00, 0x5d, 0xbc, 0x01, 0x73, 0x00, 0x5d, 0xbc, 0x00, 0x02,
+  0x04, 0x68, 0x63, 0x6e, 0x61, 0x00, 0xaa, 0xa9, 0x05, 0x70, 0x6f, 0x6c,
+  0x72, 0x6f, 0x00, 0x27, 0x33, 0x00, 0x02, 0x01, 0x70, 0x00, 0x94, 0xe0,
+  0x01, 0x74, 0x00, 0xc7, 0x6e, 0x00, 0x01, 0x01, 0x61, 0x00, 0xc7, 0x78,
+  0x00, 0x02, 0x02, 0x31, 0x2d, 0x00, 0xc7, 0x7f, 0x03, 0x32, 0x2d, 0x72,
+  0x00, 0xc7, 0x8f, 0x00, 0x05, 0x01, 0x33, 0x00, 0x27, 0x0f, 0x03, 0x63,
+  0x6e, 0x66, 0x00, 0xc7, 0x98, 0x01, 0x65, 0x00, 0xc7, 0xa5, 0x01, 0x6d,
+  0x00, 0x1b, 0x9f, 0x01, 0x73, 0x00, 0xc7, 0xb1, 0x00, 0x03, 0x01, 0x38,
+  0x00, 0x35, 0x0c, 0x09, 0x65, 0x63, 0x6e, 0x61, 0x74, 0x73, 0x6e, 0x69,
+  0x2e, 0x00, 0xc7, 0xb9, 0x06, 0x6d, 0x61, 0x2d, 0x6c, 0x6e, 0x2e, 0x00,
+  0xc7, 0xc5, 0x00, 0x03, 0x01, 0x33, 0x00, 0x27, 0x0f, 0x01, 0x65, 0x00,
+  0xc7, 0xa5, 0x01, 0x73, 0x00, 0xc7, 0xb1, 0x00, 0x01, 0x04, 0x73, 0x62,
+  0x65, 0x77, 0x00, 0x6a, 0xab, 0x00, 0x01, 0x01, 0x62, 0x00, 0x43, 0xb8,
+  0x00, 0x01, 0x01, 0x72, 0x00, 0x93, 0x3e, 0x00, 0x01, 0x01, 0x65, 0x00,
+  0x10, 0xd5, 0x00, 0x03, 0x05, 0x6c, 0x6c, 0x61, 0x34, 0x73, 0x00, 0x5c,
+  0x48, 0x03, 0x72, 0x65, 0x62, 0x00, 0x5d, 0xbc, 0x01, 0x74, 0x00, 0xc7,
+  0xdb, 0x01, 0x02, 0x01, 0x65, 0x00, 0x64, 0xc4, 0x04, 0x73, 0x72, 0x65,
+  0x6c, 0x00, 0x85, 0xec, 0x00, 0x01, 0x03, 0x72, 0x61, 0x75, 0x00, 0xc7,
+  0xe3, 0x00, 0x01, 0x05, 0x67, 0x69, 0x74, 0x73, 0x6e, 0x00, 0x12, 0xf0,
+  0x00, 0x01, 0x01, 0x62, 0x00, 0x93, 0x7c, 0x00, 0x01, 0x01, 0x75, 0x00,
+  0x14, 0x4a, 0x00, 0x01, 0x01, 0x65, 0x00, 0x39, 0x21, 0x00, 0x01, 0x01,
+  0x75, 0x00, 0x20, 0xed, 0x00, 0x01, 0x01, 0x2d, 0x00, 0x97, 0xbe, 0x00,
+  0x02, 0x02, 0x65, 0x6d, 0x00, 0x18, 0x88, 0x05, 0x6c, 0x72, 0x65, 0x62,
+  0x2d, 0x00, 0xc7, 0xea, 0x00, 0x01, 0x01, 0x2e, 0x00, 0xc7, 0xf1, 0x00,
+  0x01, 0x01, 0x67, 0x00, 0x97, 0xd9, 0x00, 0x02, 0x01, 0x2d, 0x00, 0xc7,
+  0xea, 0x01, 0x6e, 0x00, 0xaa, 0x23, 0x00, 0x01, 0x01, 0x32, 0x00, 0xc7,
+  0xf8, 0x01, 0x01, 0x01, 0x6f, 0x00, 0x26, 0xde, 0x00, 0x04, 0x0e, 0x6e,
+  0x74, 0x72, 0x61, 0x70, 0x64, 0x65, 0x65, 0x70, 0x73, 0x2e, 0x72, 0x65,
+  0x6d, 0x00, 0xc7, 0xff, 0x02, 0x73, 0x75, 0x00, 0xc8, 0x06, 0x01, 0x74,
+  0x00, 0xc8, 0x13, 0x04, 0x76, 0x72, 0x65, 0x73, 0x00, 0xc8, 0x2a, 0x00,
+  0x02, 0x01, 0x6e, 0x00, 0x96, 0xe0, 0x01, 0x79, 0x00, 0x12, 0x22, 0x00,
+  0x02, 0x01, 0x6f, 0x00, 0xc8, 0x43, 0x01, 0x79, 0x00, 0x96, 0x53, 0x00,
+  0x04, 0x01, 0x2d, 0x00, 0xc8, 0x4a, 0x05, 0x69, 0x73, 0x6f, 0x63, 0x2e,
+  0x00, 0x75, 0x7e, 0x01, 0x70, 0x00, 0x27, 0x0f, 0x01, 0x79, 0x00, 0xc8,
+  0x6c, 0x00, 0x02, 0x01, 0x6e, 0x00, 0xb3, 0x41, 0x01, 0x74, 0x00, 0x4c,
+  0x3f, 0x01, 0x01, 0x01, 0x2e, 0x00, 0xc8, 0x73, 0x00, 0x01, 0x01, 0x69,
+  0x00, 0x5d, 0xb5, 0x00, 0x01, 0x01, 0x73, 0x00, 0x6b, 0x7d, 0x00, 0x01,
+  0x01, 0x32, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x01, 0x6c, 0x00, 0xc8, 0x7f,
+  0x01, 0x79, 0x00, 0x12, 0x22, 0x00, 0x01, 0x03, 0x69, 0x63, 0x2d, 0x00,
+  0xc8, 0x88, 0x00, 0x01, 0x01, 0x62, 0x00, 0x16, 0xd4, 0x00, 0x01, 0x01,
+  0x65, 0x00, 0x6d, 0x8e, 0x00, 0x08, 0x01, 0x33, 0x00, 0x99, 0x15, 0x02,
+  0x64, 0x65, 0x00, 0x99, 0xb0, 0x05, 0x67, 0x72, 0x65, 0x62, 0x65, 0x00,
+  0xc8, 0x8f, 0x01, 0x6b, 0x00, 0xc8, 0x96, 0x03, 0x73, 0x6e, 0x64, 0x00,
+  0x0f, 0x68, 0x03, 0x74, 0x65, 0x6e, 0x00, 0xc8, 0x9e, 0x01, 0x78, 0x00,
+  0xc8, 0xa5, 0x01, 0x79, 0x00, 0xc8, 0xac, 0x00, 0x01, 0x01, 0x63, 0x00,
+  0x6b, 0x7d, 0x00, 0x02, 0x01, 0x63, 0x00, 0x16, 0x7b, 0x01, 0x76, 0x00,
+  0x0e, 0x15, 0x00, 0x01, 0x01, 0x72, 0x00, 0x15, 0x5e, 0x00, 0x01, 0x01,
+  0x2d, 0x00, 0xc8, 0xb9, 0x00, 0x01, 0x01, 0x73, 0x00, 0x1e, 0x60, 0x00,
+  0x02, 0x01, 0x2d, 0x00, 0xc8, 0xb9, 0x04, 0x6c, 0x70, 0x61, 0x64, 0x00,
+  0xc8, 0xc1, 0x00, 0x01, 0x01, 0x65, 0x00, 0xc8, 0xcc, 0x00, 0x01, 0x04,
+  0x74, 0x61, 0x74, 0x73, 0x00, 0x63, 0x2c, 0x00, 0x01, 0x01, 0x6d, 0x00,
+  0x62, 0x3b, 0x00, 0x02, 0x01, 0x6e, 0x00, 0xbc, 0x7f, 0x01, 0x70, 0x00,
+  0x32, 0x5a, 0x00, 0x02, 0x01, 0x6f, 0x00, 0x0f, 0x6f, 0x04, 0x73, 0x6e,
+  0x61, 0x72, 0x00, 0xc8, 0xd3, 0x00, 0x01, 0x03, 0x65, 0x67, 0x65, 0x00,
+  0xc8, 0xdb, 0x00, 0x01, 0x01, 0x79, 0x00, 0x12, 0x22, 0x00, 0x01, 0x01,
+  0x64, 0x00, 0x1e, 0x60, 0x00, 0x02, 0x02, 0x61, 0x63, 0x00, 0xc8, 0xe2,
+  0x01, 0x6f, 0x00, 0xc8, 0xea, 0x00, 0x01, 0x03, 0x6f, 0x6c, 0x6f, 0x00,
+  0xc8, 0x43, 0x00, 0x02, 0x02, 0x72, 0x65, 0x00, 0xc8, 0xf1, 0x02, 0x73,
+  0x69, 0x00, 0xc8, 0xf1, 0x00, 0x03, 0x07, 0x65, 0x67, 0x61, 0x74, 0x73,
+  0x2d, 0x6f, 0x00, 0xc8, 0xfb, 0x01, 0x6f, 0x00, 0xc8, 0xfb, 0x01, 0x79,
+  0x00, 0x5c, 0xb0, 0x01, 0x01, 0x04, 0x2e, 0x67, 0x6e, 0x69, 0x00, 0xab,
+  0x38, 0x00, 0x01, 0x01, 0x63, 0x00, 0xc9, 0x03, 0x00, 0x01, 0x03, 0x6e,
+  0x69, 0x6c, 0x00, 0x4b, 0x7d, 0x00, 0x02, 0x02, 0x67, 0x64, 0x00, 0xc9,
+  0x0a, 0x01, 0x72, 0x00, 0x60, 0x40, 0x00, 0x04, 0x01, 0x36, 0x00, 0x87,
+  0xd3, 0x01, 0x61, 0x00, 0x2c, 0x3b, 0x04, 0x6e, 0x6f, 0x74, 0x69, 0x00,
+  0x95, 0xd0, 0x01, 0x73, 0x00, 0x21, 0x6d, 0x00, 0x02, 0x03, 0x72, 0x61,
+  0x77, 0x00, 0x85, 0xda, 0x04, 0x73, 0x61, 0x62, 0x65, 0x00, 0x3f, 0x9e,
+  0x00, 0x01, 0x01, 0x6c, 0x00, 0xc9, 0x11, 0x00, 0x01, 0x01, 0x6e, 0x00,
+  0xc9, 0x18, 0x00, 0x01, 0x01, 0x65, 0x00, 0xbc, 0xc6, 0x00, 0x01, 0x02,
+  0x69, 0x6d, 0x00, 0x6a, 0xab, 0x00, 0x02, 0x01, 0x61, 0x00, 0x97, 0x5e,
+  0x09, 0x75, 0x62, 0x72, 0x6f, 0x66, 0x6c, 0x61, 0x6e, 0x75, 0x00, 0xc9,
+  0x1f, 0x00, 0x01, 0x01, 0x72, 0x00, 0x4c, 0x7f, 0x00, 0x01, 0x01, 0x72,
+  0x00, 0xc9, 0x26, 0x00, 0x01, 0x01, 0x74, 0x00, 0x2a, 0x10, 0x00, 0x01,
+  0x01, 0x6f, 0x00, 0x2a, 0x10, 0x01, 0x02, 0x02, 0x2e, 0x65, 0x00, 0xc9,
+  0x2d, 0x01, 0x6c, 0x00, 0x5a, 0x14, 0x00, 0x01, 0x03, 0x75, 0x6f, 0x6c,
+  0x00, 0xc9, 0x37, 0x00, 0x04, 0x01, 0x6c, 0x00, 0x1c, 0x89, 0x01, 0x6e,
+  0x00, 0x85, 0x06, 0x01, 0x72, 0x00, 0xc9, 0x3e, 0x03, 0x77, 0x69, 0x6e,
+  0x00, 0x26, 0xe5, 0x00, 0x01, 0x01, 0x70, 0x00, 0x14, 0x4a, 0x00, 0x02,
+  0x08, 0x72, 0x6f, 0x77, 0x74, 0x65, 0x6e, 0x6f, 0x69, 0x00, 0xc9, 0x4e,
+  0x02, 0x77, 0x6e, 0x00, 0x16, 0x9c, 0x00, 0x01, 0x01, 0x6e, 0x00, 0xc9,
+  0x55, 0x00, 0x02, 0x01, 0x65, 0x00, 0xc9, 0x5c, 0x01, 0x6f, 0x00, 0x54,
+  0xdc, 0x00, 0x01, 0x01, 0x76, 0x00, 0xc9, 0x63, 0x00, 0x02, 0x02, 0x68,
+  0x72, 0x00, 0x27, 0x0f, 0x01, 0x73, 0x00, 0x93, 0x3e, 0x00, 0x01, 0x01,
+  0x78, 0x00, 0xc8, 0xa5, 0x00, 0x02, 0x06, 0x61, 0x76, 0x63, 0x30, 0x61,
+  0x61, 0x00, 0x25, 0xe3, 0x01, 0x6d, 0x00, 0xc7, 0x48, 0x00, 0x02, 0x02,
+  0x61, 0x31, 0x00, 0xc7, 0x48, 0x01, 0x65, 0x00, 0x13, 0x2c, 0x00, 0x01,
+  0x02, 0x61, 0x31, 0x00, 0x10, 0xd5, 0x00, 0x01, 0x01, 0x77, 0x00, 0x9c,
+  0x18, 0x00, 0x02, 0x02, 0x32, 0x32, 0x00, 0xc9, 0x6a, 0x01, 0x35, 0x00,
+  0x0f, 0x8b, 0x00, 0x01, 0x03, 0x61, 0x30, 0x63, 0x00, 0x58, 0x1e, 0x00,
+  0x01, 0x01, 0x65, 0x00, 0x1e, 0x59, 0x00, 0x01, 0x01, 0x75, 0x00, 0x85,
+  0xc5, 0x00, 0x01, 0x01, 0x6f, 0x00, 0x3a, 0x7d, 0x00, 0x02, 0x01, 0x62,
+  0x00, 0x0e, 0x15, 0x01, 0x63, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x65,
+  0x00, 0x3a, 0x7d, 0x00, 0x01, 0x02, 0x6e, 0x69, 0x00, 0xbb, 0x97, 0x00,
+  0x01, 0x01, 0x67, 0x00, 0x17, 0xbd, 0x00, 0x01, 0x01, 0x75, 0x00, 0xc9,
+  0x73, 0x01, 0x01, 0x06, 0x2e, 0x74, 0x66, 0x61, 0x72, 0x63, 0x00, 0x98,
+  0xee, 0x00, 0x01, 0x01, 0x75, 0x00, 0x99, 0x6d, 0x00, 0x01, 0x04, 0x74,
+  0x61, 0x6c, 0x73, 0x00, 0xc9, 0x7a, 0x01, 0x01, 0x01, 0x73, 0x00, 0x1d,
+  0x1c, 0x00, 0x03, 0x01, 0x72, 0x00, 0xc9, 0x81, 0x01, 0x74, 0x00, 0xc9,
+  0x88, 0x01, 0x7a, 0x00, 0x0e, 0x15, 0x00, 0x05, 0x02, 0x61, 0x62, 0x00,
+  0xc9, 0x9c, 0x01, 0x65, 0x00, 0xc9, 0xa7, 0x04, 0x6e, 0x75, 0x6f, 0x66,
+  0x00, 0xbd, 0x57, 0x03, 0x6f, 0x6f, 0x67, 0x00, 0xc9, 0x9c, 0x04, 0x75,
+  0x6f, 0x6c, 0x63, 0x00, 0xc9, 0xb9, 0x00, 0x08, 0x01, 0x61, 0x00, 0x0e,
+  0x15, 0x03, 0x63, 0x69, 0x6e, 0x00, 0xc9, 0x9c, 0x04, 0x67, 0x72, 0x6f,
+  0x66, 0x00, 0xc9, 0xc9, 0x01, 0x6c, 0x00, 0xc9, 0xd6, 0x01, 0x6d, 0x00,
+  0xc9, 0xe9, 0x01, 0x6e, 0x00, 0xc9, 0xff, 0x01, 0x72, 0x00, 0xca, 0x0e,
+  0x01, 0x74, 0x00, 0xca, 0x3f, 0x00, 0x01, 0x01, 0x65, 0x00, 0xca, 0x50,
+  0x00, 0x01, 0x01, 0x64, 0x00, 0x5a, 0x14, 0x00, 0x03, 0x01, 0x65, 0x00,
+  0xca, 0x57, 0x01, 0x68, 0x00, 0x0e, 0x15, 0x01, 0x6e, 0x00, 0x4c, 0x11,
+  0x00, 0x03, 0x01, 0x69, 0x00, 0xca, 0x60, 0x07, 0x6c, 0x61, 0x77, 0x65,
+  0x72, 0x69, 0x66, 0x00, 0xca, 0x6d, 0x01, 0x73, 0x00, 0x63, 0x33, 0x00,
+  0x02, 0x04, 0x61, 0x63, 0x73, 0x73, 0x00, 0x98, 0x66, 0x08, 0x65, 0x64,
+  0x6f, 0x6d, 0x2d, 0x65, 0x6c, 0x62, 0x00, 0x42, 0x43, 0x00, 0x04, 0x02,
+  0x61, 0x66, 0x00, 0xca, 0x79, 0x05, 0x69, 0x62, 0x70, 0x74, 0x74, 0x00,
+  0x21, 0x6d, 0x01, 0x6f, 0x00, 0xca, 0x9d, 0x01, 0x70, 0x00, 0xca, 0xaa,
+  0x00, 0x02, 0x01, 0x6a, 0x00, 0xca, 0xb1, 0x02, 0x74, 0x70, 0x00, 0xca,
+  0xb9, 0x00, 0x03, 0x01, 0x69, 0x00, 0xc6, 0xa6, 0x01, 0x6f, 0x00, 0xca,
+  0xc5, 0x02, 0x74, 0x66, 0x00, 0xca, 0xd5, 0x00, 0x03, 0x01, 0x65, 0x00,
+  0xca, 0xe1, 0x02, 0x67, 0x6d, 0x00, 0xca, 0xff, 0x02, 0x76, 0x64, 0x00,
+  0x28, 0x6d, 0x00, 0x0b, 0x01, 0x61, 0x00, 0xcb, 0x07, 0x01, 0x62, 0x00,
+  0xcb, 0x13, 0x01, 0x64, 0x00, 0xcb, 0x22, 0x0c, 0x65, 0x69, 0x72, 0x66,
+  0x6f, 0x74, 0x61, 0x74, 0x6f, 0x70, 0x68, 0x63, 0x00, 0x85, 0x6c, 0x01,
+  0x6a, 0x00, 0x0e, 0x15, 0x05, 0x6b, 0x6f, 0x6f, 0x62, 0x2d, 0x00, 0x9a,
+  0x2c, 0x02, 0x6c, 0x74, 0x00, 0x8d, 0x16, 0x02, 0x6e, 0x64, 0x00, 0xcb,
+  0x32, 0x01, 0x73, 0x00, 0xcb, 0x6e, 0x0c, 0x74, 0x6e, 0x65, 0x6d, 0x68,
+  0x63, 0x61, 0x74, 0x74, 0x61, 0x6f, 0x6d, 0x00, 0x15, 0x5e, 0x01, 0x75,
+  0x00, 0x0e, 0x15, 0x00, 0x05, 0x02, 0x63, 0x65, 0x00, 0xcb, 0x7a, 0x01,
+  0x65, 0x00, 0xcb, 0x94, 0x05, 0x68, 0x67, 0x69, 0x6e, 0x6b, 0x00, 0xcb,
+  0xa7, 0x08, 0x6f, 0x69, 0x2d, 0x61, 0x6c, 0x6c, 0x69, 0x7a, 0x00, 0x64,
+  0xb6, 0x01, 0x73, 0x00, 0xcb, 0xae, 0x01, 0x01, 0x01, 0x2e, 0x00, 0xcb,
+  0xc0, 0x00, 0x02, 0x01, 0x69, 0x00, 0xcc, 0x21, 0x01, 0x75, 0x00, 0x98,
+  0x18, 0x00, 0x02, 0x06, 0x6c, 0x69, 0x6d, 0x61, 0x66, 0x78, 0x00, 0x4c,
+  0x11, 0x01, 0x73, 0x00, 0x51, 0x91, 0x00, 0x01, 0x01, 0x6e, 0x00, 0x1e,
+  0x60, 0x02, 0x01, 0x03, 0x2e, 0x63, 0x76, 0x00, 0x6c, 0x6e, 0x00, 0x01,
+  0x01, 0x70, 0x00, 0x26, 0x53, 0x00, 0x01, 0x01, 0x70, 0x00, 0x30, 0x72,
+  0x00, 0x01, 0x01, 0x68, 0x00, 0xcc, 0x28, 0x00, 0x04, 0x01, 0x63, 0x00,
+  0x15, 0x5e, 0x01, 0x73, 0x00, 0x5d, 0xbc, 0x01, 0x74, 0x00, 0x69, 0x73,
+  0x01, 0x75, 0x00, 0x1d, 0x34, 0x00, 0x01, 0x01, 0x6e, 0x00, 0x41, 0x08,
+  0x02, 0x01, 0x03, 0x2e, 0x7a, 0x7a, 0x00, 0x95, 0x26, 0x00, 0x02, 0x01,
+  0x64, 0x00, 0x64, 0xeb, 0x01, 0x79, 0x00, 0x5c, 0xb0, 0x00, 0x01, 0x01,
+  0x6d, 0x00, 0x28, 0xd5, 0x00, 0x01, 0x01, 0x61, 0x00, 0x4c, 0x7f, 0x00,
+  0x01, 0x01, 0x73, 0x00, 0xcc, 0x2f, 0x00, 0x01, 0x01, 0x69, 0x00, 0xcc,
+  0x36, 0x01, 0x01, 0x01, 0x65, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x6f,
+  0x00, 0x82, 0x24, 0x00, 0x01, 0x01, 0x73, 0x00, 0x29, 0xdf, 0x00, 0x01,
+  0x03, 0x65, 0x74, 0x69, 0x00, 0xcc, 0x3e, 0x00, 0x01, 0x01, 0x63, 0x00,
+  0xcc, 0x46, 0x00, 0x01, 0x06, 0x73, 0x65, 0x6d, 0x6d, 0x65, 0x6a, 0x00,
+  0xcc, 0x4d, 0x00, 0x02, 0x01, 0x32, 0x00, 0xc9, 0x6a, 0x04, 0x33, 0x72,
+  0x76, 0x63, 0x00, 0x2a, 0xfa, 0x00, 0x01, 0x01, 0x6e, 0x00, 0x16, 0xc6,
+  0x00, 0x01, 0x02, 0x71, 0x6d, 0x00, 0x12, 0xf0, 0x00, 0x03, 0x03, 0x62,
+  0x65, 0x77, 0x00, 0xcc, 0x54, 0x02, 0x6e, 0x6f, 0x00, 0x54, 0xdc, 0x01,
+  0x70, 0x00, 0xbd, 0x65, 0x00, 0x01, 0x01, 0x7a, 0x00, 0x26, 0xd7, 0x00,
+  0x02, 0x01, 0x63, 0x00, 0x0e, 0x15, 0x01, 0x76, 0x00, 0x44, 0x12, 0x00,
+  0x03, 0x03, 0x67, 0x75, 0x6c, 0x00, 0xcc, 0x5b, 0x01, 0x73, 0x00, 0xc7,
+  0x00, 0x02, 0x79, 0x72, 0x00, 0xcc, 0x62, 0x00, 0x01, 0x07, 0x6e, 0x65,
+  0x64, 0x6e, 0x65, 0x70, 0x65, 0x00, 0xa9, 0x10, 0x00, 0x02, 0x03, 0x6c,
+  0x61, 0x79, 0x00, 0x83, 0x0e, 0x01, 0x74, 0x00, 0x9c, 0x5b, 0x01, 0x01,
+  0x01, 0x2e, 0x00, 0xcc, 0x79, 0x00, 0x01, 0x01, 0x70, 0x00, 0x2f, 0x47,
+  0x00, 0x01, 0x01, 0x79, 0x00, 0x0f, 0x68, 0x00, 0x03, 0x03, 0x65, 0x63,
+  0x69, 0x00, 0xcc, 0xba, 0x01, 0x69, 0x00, 0x30, 0x72, 0x04, 0x6e, 0x67,
+  0x69, 0x61, 0x00, 0xcc, 0xc8, 0x00, 0x02, 0x01, 0x63, 0x00, 0xcc, 0xcf,
+  0x01, 0x74, 0x00, 0x9c, 0x5b, 0x01, 0x02, 0x01, 0x2e, 0x00, 0x2f, 0x47,
+  0x02, 0x6c, 0x70, 0x00, 0x26, 0xde, 0x00, 0x01, 0x01, 0x6d, 0x00, 0x5d,
+  0xb5, 0x00, 0x01, 0x01, 0x72, 0x00, 0xcc, 0xd7, 0x01, 0x01, 0x0a, 0x2e,
+  0x73, 0x70, 0x70, 0x61, 0x64, 0x75, 0x6f, 0x6c, 0x63, 0x00, 0xcc, 0xde,
+  0x00, 0x02, 0x01, 0x61, 0x00, 0x0f, 0xfa, 0x01, 0x73, 0x00, 0x32, 0x5a,
+  0x00, 0x01, 0x01, 0x72, 0x00, 0x56, 0x74, 0x00, 0x03, 0x04, 0x65, 0x67,
+  0x61, 0x70, 0x00, 0xc7, 0x67, 0x07, 0x72, 0x65, 0x64, 0x72, 0x6f, 0x74,
+  0x69, 0x00, 0xcc, 0xe7, 0x01, 0x74, 0x00, 0xcc, 0xee, 0x00, 0x02, 0x05,
+  0x65, 0x6b, 0x73, 0x61, 0x62, 0x00, 0xcc, 0xfb, 0x01, 0x6f, 0x00, 0x3f,
+  0xd8, 0x00, 0x01, 0x01, 0x73, 0x00, 0x2b, 0x7a, 0x00, 0x02, 0x01, 0x65,
+  0x00, 0x1e, 0x60, 0x03, 0x72, 0x6f, 0x74, 0x00, 0xc7, 0x6e, 0x00, 0x02,
+  0x01, 0x64, 0x00, 0xcd, 0x02, 0x01, 0x67, 0x00, 0x16, 0xd4, 0x00, 0x03,
+  0x01, 0x67, 0x00, 0x0e, 0x15, 0x01, 0x6f, 0x00, 0x9f, 0x8e, 0x03, 0x75,
+  0x72, 0x61, 0x00, 0x5c, 0x21, 0x00, 0x03, 0x01, 0x64, 0x00, 0x5d, 0xb5,
+  0x01, 0x6d, 0x00, 0xcd, 0x09, 0x02, 0x6e, 0x79, 0x00, 0xcd, 0x10, 0x00,
+  0x04, 0x03, 0x65, 0x6c, 0x6f, 0x00, 0xcd, 0x17, 0x05, 0x73, 0x6c, 0x6f,
+  0x70, 0x6f, 0x00, 0xb1, 0x86, 0x01, 0x74, 0x00, 0xc6, 0x93, 0x04, 0x79,
+  0x74, 0x73, 0x79, 0x00, 0xc2, 0xd4, 0x00, 0x02, 0x01, 0x69, 0x00, 0x0f,
+  0x68, 0x01, 0x6f, 0x00, 0xcd, 0x25, 0x00, 0x03, 0x03, 0x65, 0x72, 0x61,
+  0x00, 0x85, 0xda, 0x02, 0x69, 0x6d, 0x00, 0x0c, 0x1d, 0x01, 0x7a, 0x00,
+  0x0f, 0x49, 0x00, 0x03, 0x03, 0x2d, 0x61, 0x69, 0x00, 0xcd, 0x31, 0x01,
+  0x6a, 0x00, 0x0e, 0x15, 0x01, 0x7a, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x01,
+  0x61, 0x00, 0xcd, 0x3e, 0x01, 0x6f, 0x00, 0xcd, 0x4b, 0x00, 0x02, 0x04,
+  0x65, 0x69, 0x77, 0x6f, 0x00, 0xcd, 0x59, 0x01, 0x6d, 0x00, 0x46, 0x75,
+  0x00, 0x02, 0x02, 0x69, 0x77, 0x00, 0xcd, 0x61, 0x02, 0x6c, 0x65, 0x00,
+  0xcd, 0x70, 0x00, 0x01, 0x01, 0x72, 0x00, 0x35, 0x51, 0x00, 0x01, 0x01,
+  0x72, 0x00, 0x70, 0xcb, 0x00, 0x02, 0x01, 0x69, 0x00, 0x70, 0xbd, 0x01,
+  0x73, 0x00, 0xcd, 0x7f, 0x00, 0x02, 0x01, 0x69, 0x00, 0xcd, 0x86, 0x05,
+  0x79, 0x7a, 0x72, 0x65, 0x69, 0x00, 0xcd, 0x92, 0x00, 0x03, 0x06, 0x63,
+  0x73, 0x6a, 0x75, 0x6f, 0x6e, 0x00, 0xcd, 0x02, 0x03, 0x6b, 0x73, 0x72,
+  0x00, 0xcd, 0x99, 0x03, 0x73, 0x61, 0x6c, 0x00, 0xcd, 0xa1, 0x00, 0x02,
+  0x02, 0x61, 0x68, 0x00, 0xcd, 0xa1, 0x01, 0x6f, 0x00, 0xcd, 0xa8, 0x00,
+  0x02, 0x05, 0x61, 0x74, 0x73, 0x65, 0x6c, 0x00, 0x5a, 0x14, 0x01, 0x69,
+  0x00, 0xbc, 0x27, 0x00, 0x02, 0x01, 0x72, 0x00, 0xcd, 0x99, 0x03, 0x73,
+  0x77, 0x6f, 0x00, 0xcd, 0xaf, 0x00, 0x01, 0x01, 0x6c, 0x00, 0x1d, 0x34,
+  0x00, 0x02, 0x01, 0x6c, 0x00, 0x41, 0xf9, 0x01, 0x6e, 0x00, 0x50, 0x30,
+  0x00, 0x01, 0x01, 0x65, 0x00, 0x27, 0x25, 0x00, 0x02, 0x01, 0x72, 0x00,
+  0x4c, 0x11, 0x04, 0x77, 0x61, 0x6c, 0x63, 0x00, 0x9e, 0xbc, 0x00, 0x03,
+  0x01, 0x62, 0x00, 0x55, 0x62, 0x01, 0x64, 0x00, 0xcd, 0x02, 0x01, 0x73,
+  0x00, 0xc5, 0xec, 0x00, 0x02, 0x01, 0x6e, 0x00, 0x1c, 0x65, 0x03, 0x74,
+  0x73, 0x79, 0x00, 0xcd, 0x59, 0x00, 0x02, 0x01, 0x65, 0x00, 0x26, 0xde,
+  0x01, 0x6c, 0x00, 0x13, 0x33, 0x00, 0x05, 0x01, 0x61, 0x00, 0x75, 0x23,
+  0x03, 0x6a, 0x61, 0x7a, 0x00, 0x16, 0xd4, 0x02, 0x6e, 0x61, 0x00, 0xcd,
+  0x10, 0x02, 0x70, 0x75, 0x00, 0x75, 0x23, 0x05, 0x72, 0x6f, 0x77, 0x65,
+  0x7a, 0x00, 0x13, 0x4d, 0x00, 0x01, 0x02, 0x6f, 0x6c, 0x00, 0x35, 0x51,
+  0x00, 0x02, 0x01, 0x72, 0x00, 0x0e, 0x15, 0x01, 0x76, 0x00, 0x3c, 0xee,
+  0x00, 0x02, 0x01, 0x61, 0x00, 0x12, 0x22, 0x01, 0x6d, 0x00, 0x0e, 0x15,
+  0x00, 0x04, 0x01, 0x63, 0x00, 0x0e, 0x15, 0x01, 0x64, 0x00, 0x67, 0x6c,
+  0x01, 0x6e, 0x00, 0x0e, 0x15, 0x01, 0x74, 0x00, 0xc9, 0x5c, 0x00, 0x02,
+  0x01, 0x67, 0x00, 0x0e, 0x15, 0x01, 0x69, 0x00, 0xcc, 0x36, 0x00, 0x02,
+  0x01, 0x67, 0x00, 0x6f, 0x01, 0x02, 0x6e, 0x7a, 0x00, 0x92, 0x51, 0x00,
+  0x06, 0x01, 0x62, 0x00, 0x12, 0xe2, 0x02, 0x63, 0x65, 0x00, 0xcd, 0xb6,
+  0x01, 0x6c, 0x00, 0xcd, 0xbe, 0x02, 0x6d, 0x6f, 0x00, 0x83, 0x71, 0x01,
+  0x6e, 0x00, 0x41, 0xf9, 0x02, 0x7a, 0x64, 0x00, 0xcd, 0xc5, 0x00, 0x01,
+  0x01, 0x65, 0x00, 0x6d, 0x60, 0x00, 0x02, 0x03, 0x74, 0x7a, 0x73, 0x00,
+  0x5a, 0x57, 0x01, 0x7a, 0x00, 0xcd, 0xd3, 0x00, 0x02, 0x02, 0x63, 0x65,
+  0x00, 0x5a, 0x57, 0x03, 0x7a, 0x64, 0x6f, 0x00, 0xcd, 0xe0, 0x00, 0x01,
+  0x01, 0x6b, 0x00, 0x29, 0x66, 0x00, 0x04, 0x02, 0x6c, 0x65, 0x00, 0x39,
+  0x28, 0x01, 0x70, 0x00, 0x84, 0xae, 0x01, 0x74, 0x00, 0xcd, 0xe7, 0x01,
+  0x7a, 0x00, 0xcd, 0xf3, 0x00, 0x02, 0x02, 0x65, 0x6a, 0x00, 0x4c, 0x86,
+  0x04, 0x6f, 0x67, 0x61, 0x72, 0x00, 0x12, 0x22, 0x00, 0x02, 0x01, 0x65,
+  0x00, 0x15, 0x5e, 0x03, 0x6c, 0x6b, 0x73, 0x00, 0xce, 0x09, 0x00, 0x01,
+  0x01, 0x72, 0x00, 0xce, 0x10, 0x01, 0x02, 0x07, 0x2d, 0x65, 0x63, 0x72,
+  0x65, 0x6d, 0x6d, 0x00, 0x9b, 0xd8, 0x01, 0x64, 0x00, 0xce, 0x17, 0x00,
+  0x01, 0x02, 0x65, 0x7a, 0x00, 0x0f, 0xfa, 0x01, 0x01, 0x01, 0x2e, 0x00,
+  0xce, 0x21, 0x00, 0x02, 0x01, 0x6c, 0x00, 0xce, 0x82, 0x01, 0x77, 0x00,
+  0x0e, 0x15, 0x00, 0x05, 0x01, 0x67, 0x00, 0x3c, 0x61, 0x01, 0x6b, 0x00,
+  0xce, 0x92, 0x01, 0x72, 0x00, 0xce, 0xa4, 0x01, 0x74, 0x00, 0xce, 0xb0,
+  0x01, 0x7a, 0x00, 0xce, 0xbf, 0x00, 0x01, 0x01, 0x73, 0x00, 0x68, 0x09,
+  0x00, 0x02, 0x05, 0x61, 0x7a, 0x63, 0x7a, 0x73, 0x00, 0xce, 0xcd, 0x02,
+  0x69, 0x6b, 0x00, 0x92, 0x21, 0x00, 0x02, 0x01, 0x6a, 0x00, 0x25, 0x56,
+  0x0a, 0x6c, 0x6f, 0x64, 0x2d, 0x7a, 0x72, 0x65, 0x69, 0x6d, 0x69, 0x00,
+  0xce, 0xd4, 0x00, 0x02, 0x02, 0x6f, 0x67, 0x00, 0x16, 0x7b, 0x01, 0x75,
+  0x00, 0xcd, 0xaf, 0x00, 0x01, 0x01, 0x72, 0x00, 0x68, 0x09, 0x00, 0x03,
+  0x02, 0x61, 0x70, 0x00, 0xa0, 0x17, 0x02, 0x69, 0x77, 0x00, 0x46, 0x75,
+  0x05, 0x7a, 0x73, 0x6f, 0x67, 0x64, 0x00, 0xc9, 0x5c, 0x00, 0x02, 0x01,
+  0x69, 0x00, 0xce, 0xdb, 0x02, 0x75, 0x6b, 0x00, 0x5a, 0x57, 0x00, 0x01,
+  0x02, 0x75, 0x6d, 0x00, 0x2b, 0x46, 0x00, 0x02, 0x01, 0x63, 0x00, 0xc4,
+  0x89, 0x01, 0x65, 0x00, 0x80, 0x94, 0x01, 0x01, 0x01, 0x2e, 0x00, 0xce,
+  0xe7, 0x00, 0x01, 0x07, 0x69, 0x61, 0x6e, 0x69, 0x72, 0x65, 0x74, 0x00,
+  0x4b, 0x25, 0x00, 0x01, 0x01, 0x64, 0x00, 0x5d, 0xb5, 0x00, 0x01, 0x02,
+  0x69, 0x61, 0x00, 0xa9, 0xb3, 0x00, 0x01, 0x02, 0x69, 0x63, 0x00, 0xce,
+  0xf3, 0x00, 0x01, 0x01, 0x65, 0x00, 0xce, 0xfa, 0x00, 0x01, 0x01, 0x6d,
+  0x00, 0xcf, 0x01, 0x00, 0x01, 0x01, 0x73, 0x00, 0xcf, 0x08, 0x00, 0x0b,
+  0x01, 0x63, 0x00, 0xcf, 0x0f, 0x01, 0x67, 0x00, 0xcf, 0x1c, 0x01, 0x69,
+  0x00, 0xa2, 0x1b, 0x01, 0x6d, 0x00, 0xcf, 0x2f, 0x01, 0x70, 0x00, 0xcf,
+  0x3d, 0x01, 0x72, 0x00, 0xcf, 0x49, 0x01, 0x73, 0x00, 0x0e, 0x15, 0x0a,
+  0x74, 0x61, 0x64, 0x74, 0x73, 0x75, 0x64, 0x67, 0x6e, 0x69, 0x00, 0x65,
+  0xfc, 0x01, 0x76, 0x00, 0xa2, 0x1b, 0x01, 0x77, 0x00, 0xa2, 0x1b, 0x01,
+  0x7a, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x02, 0x65, 0x77, 0x00, 0xcf, 0x55,
+  0x06, 0x69, 0x6c, 0x64, 0x74, 0x73, 0x2e, 0x00, 0xaa, 0x63, 0x00, 0x09,
+  0x03, 0x61, 0x6d, 0x79, 0x00, 0xcf, 0x6a, 0x01, 0x64, 0x00, 0xa2, 0x1b,
+  0x03, 0x65, 0x73, 0x79, 0x00, 0x94, 0x9e, 0x08, 0x69, 0x74, 0x73, 0x61,
+  0x6c, 0x65, 0x6a, 0x2e, 0x00, 0x88, 0x58, 0x01, 0x6e, 0x00, 0xcf, 0x75,
+  0x01, 0x70, 0x00, 0xcf, 0x81, 0x01, 0x71, 0x00, 0x0e, 0x15, 0x02, 0x72,
+  0x69, 0x00, 0xcf, 0x01, 0x01, 0x73, 0x00, 0xa2, 0x1b, 0x00, 0x09, 0x05,
+  0x61, 0x65, 0x72, 0x6f, 0x74, 0x00, 0xcf, 0x90, 0x01, 0x65, 0x00, 0xcf,
+  0x97, 0x01, 0x69, 0x00, 0xcf, 0xcb, 0x01, 0x6d, 0x00, 0xa2, 0x1b, 0x01,
+  0x6e, 0x00, 0xcf, 0xdf, 0x01, 0x73, 0x00, 0xa2, 0x1b, 0x04, 0x75, 0x6f,
+  0x6c, 0x63, 0x00, 0xcf, 0xf4, 0x01, 0x76, 0x00, 0xd0, 0x47, 0x05, 0x77,
+  0x65, 0x74, 0x6f, 0x6d, 0x00, 0x29, 0xdf, 0x00, 0x10, 0x06, 0x62, 0x75,
+  0x74, 0x75, 0x6f, 0x79, 0x00, 0xd0, 0x4e, 0x05, 0x63, 0x69, 0x66, 0x66,
+  0x6f, 0x00, 0xd0, 0x55, 0x01, 0x64, 0x00, 0xd0, 0x5c, 0x03, 0x65, 0x72,
+  0x66, 0x00, 0xd0, 0x68, 0x06, 0x66, 0x69, 0x6c, 0x66, 0x6c, 0x61, 0x00,
+  0xd0, 0x74, 0x01, 0x67, 0x00, 0xd0, 0x7b, 0x01, 0x69, 0x00, 0xd0, 0x8d,
+  0x01, 0x6b, 0x00, 0xd0, 0x9b, 0x01, 0x6c, 0x00, 0xd0, 0xb3, 0x01, 0x6d,
+  0x00, 0xd0, 0xc6, 0x01, 0x6e, 0x00, 0xd0, 0xdb, 0x01, 0x72, 0x00, 0xd0,
+  0xf0, 0x03, 0x73, 0x72, 0x75, 0x00, 0xd1, 0x15, 0x01, 0x74, 0x00, 0xd1,
+  0x1c, 0x01, 0x76, 0x00, 0xd1, 0x39, 0x01, 0x7a, 0x00, 0xd1, 0x4e, 0x00,
+  0x02, 0x02, 0x6e, 0x69, 0x00, 0xd1, 0x62, 0x01, 0x6f, 0x00, 0xd1, 0x84,
+  0x00, 0x02, 0x01, 0x6e, 0x00, 0xa2, 0x1b, 0x01, 0x6f, 0x00, 0xa2, 0x1b,
+  0x00, 0x09, 0x0b, 0x63, 0x6f, 0x2d, 0x72, 0x65, 0x6d, 0x6f, 0x74, 0x73,
+  0x75, 0x63, 0x00, 0xd1, 0x91, 0x05, 0x66, 0x69, 0x77, 0x65, 0x68, 0x00,
+  0xd1, 0x98, 0x01, 0x68, 0x00, 0xa2, 0x1b, 0x03, 0x6b, 0x69, 0x77, 0x00,
+  0xd0, 0x55, 0x01, 0x6d, 0x00, 0xa2, 0x1b, 0x01, 0x70, 0x00, 0xd1, 0x9f,
+  0x01, 0x72, 0x00, 0xa2, 0x1b, 0x01, 0x77, 0x00, 0xa2, 0x1b, 0x01, 0x7a,
+  0x00, 0xd1, 0xaf, 0x00, 0x01, 0x01, 0x2d, 0x00, 0xd1, 0xbf, 0x00, 0x08,
+  0x01, 0x61, 0x00, 0xd1, 0xc6, 0x03, 0x63, 0x69, 0x6c, 0x00, 0xd1, 0xd6,
+  0x03, 0x65, 0x65, 0x67, 0x00, 0xd1, 0xdd, 0x01, 0x68, 0x00, 0x0e, 0x15,
+  0x0f, 0x6c, 0x61, 0x74, 0x73, 0x6e, 0x61, 0x65, 0x62, 0x63, 0x69, 0x74,
+  0x73, 0x61, 0x6c, 0x65, 0x00, 0xd1, 0xe9, 0x01, 0x6f, 0x00, 0xa2, 0x1b,
+  0x01, 0x72, 0x00, 0xd1, 0xf0, 0x01, 0x75, 0x00, 0x0e, 0x15, 0x00, 0x08,
+  0x01, 0x61, 0x00, 0xd2, 0x03, 0x01, 0x66, 0x00, 0xa2, 0x1b, 0x01, 0x69,
+  0x00, 0xd2, 0x14, 0x01, 0x6c, 0x00, 0xd2, 0x21, 0x03, 0x70, 0x70, 0x6d,
+  0x00, 0xd2, 0x3a, 0x01, 0x72, 0x00, 0xd2, 0x42, 0x03, 0x73, 0x73, 0x75,
+  0x00, 0xd2, 0x53, 0x01, 0x78, 0x00, 0xd2, 0x5a, 0x00, 0x06, 0x03, 0x6d,
+  0x65, 0x30, 0x00, 0x14, 0x4a, 0x01, 0x6e, 0x00, 0xa2, 0x1b, 0x03, 0x70,
+  0x6d, 0x6c, 0x00, 0xd2, 0x61, 0x04, 0x72, 0x6f, 0x66, 0x65, 0x00, 0xd2,
+  0x68, 0x06, 0x73, 0x61, 0x63, 0x72, 0x61, 0x73, 0x00, 0xcf, 0x01, 0x08,
+  0x75, 0x69, 0x72, 0x61, 0x72, 0x72, 0x65, 0x74, 0x00, 0xd2, 0x7d, 0x00,
+  0x09, 0x01, 0x61, 0x00, 0xd2, 0x86, 0x01, 0x63, 0x00, 0x0e, 0x15, 0x02,
+  0x64, 0x63, 0x00, 0xd2, 0x9d, 0x03, 0x65, 0x65, 0x72, 0x00, 0xd2, 0xb2,
+  0x01, 0x69, 0x00, 0xa2, 0x1b, 0x01, 0x6d, 0x00, 0xa2, 0x1b, 0x01, 0x6f,
+  0x00, 0xd2, 0xb9, 0x01, 0x70, 0x00, 0x16, 0xb8, 0x01, 0x74, 0x00, 0xa2,
+  0x1b, 0x00, 0x08, 0x03, 0x62, 0x6f, 0x72, 0x00, 0xd2, 0xd5, 0x01, 0x63,
+  0x00, 0x0e, 0x15, 0x07, 0x68, 0x63, 0x65, 0x2d, 0x6e, 0x61, 0x6d, 0x00,
+  0xd2, 0xdc, 0x01, 0x6a, 0x00, 0xca, 0xb1, 0x01, 0x6d, 0x00, 0xd2, 0xe4,
+  0x01, 0x6e, 0x00, 0xd2, 0xf5, 0x09, 0x73, 0x73, 0x65, 0x63, 0x63, 0x61,
+  0x6e, 0x64, 0x63, 0x00, 0xd2, 0xff, 0x01, 0x74, 0x00, 0xd3, 0x06, 0x00,
+  0x06, 0x02, 0x32, 0x70, 0x00, 0xcf, 0x01, 0x04, 0x61, 0x65, 0x6c, 0x75,
+  0x00, 0xc5, 0x3b, 0x01, 0x69, 0x00, 0xd3, 0x0e, 0x01, 0x6f, 0x00, 0x93,
+  0x4c, 0x02, 0x70, 0x61, 0x00, 0xd3, 0x2d, 0x01, 0x74, 0x00, 0xd3, 0x67,
+  0x00, 0x0a, 0x01, 0x61, 0x00, 0xd3, 0x73, 0x01, 0x62, 0x00, 0x0e, 0x15,
+  0x01, 0x65, 0x00, 0xd3, 0x83, 0x01, 0x67, 0x00, 0x0e, 0x15, 0x02, 0x69,
+  0x74, 0x00, 0x67, 0x35, 0x01, 0x6b, 0x00, 0x0e, 0x15, 0x06, 0x6d, 0x67,
+  0x72, 0x70, 0x2e, 0x6e, 0x00, 0x58, 0x0b, 0x01, 0x6f, 0x00, 0xd3, 0xe2,
+  0x01, 0x70, 0x00, 0xa2, 0x1b, 0x01, 0x75, 0x00, 0xd4, 0x00, 0x00, 0x13,
+  0x01, 0x61, 0x00, 0xd4, 0x16, 0x01, 0x62, 0x00, 0xd4, 0x30, 0x02, 0x63,
+  0x69, 0x00, 0xd4, 0x37, 0x01, 0x64, 0x00, 0xd4, 0x4b, 0x01, 0x65, 0x00,
+  0xd4, 0x52, 0x04, 0x66, 0x70, 0x69, 0x2d, 0x00, 0xd4, 0x7f, 0x01, 0x69,
+  0x00, 0xd4, 0x8e, 0x02, 0x6a, 0x66, 0x00, 0x42, 0x43, 0x01, 0x6b, 0x00,
+  0xd4, 0x9d, 0x01, 0x6d, 0x00, 0xd4, 0xb5, 0x01, 0x6e, 0x00, 0xd4, 0xc2,
+  0x01, 0x6f, 0x00, 0xd4, 0xdc, 0x03, 0x70, 0x70, 0x61, 0x00, 0xd4, 0xe9,
+  0x01, 0x72, 0x00, 0xd4, 0xfa, 0x01, 0x73, 0x00, 0xd5, 0x06, 0x01, 0x74,
+  0x00, 0xd5, 0x14, 0x01, 0x75, 0x00, 0x0e, 0x15, 0x09, 0x77, 0x61, 0x6e,
+  0x6f, 0x7a, 0x61, 0x6d, 0x61, 0x2e, 0x00, 0xd5, 0x3d, 0x02, 0x79, 0x61,
+  0x00, 0xa4, 0xf1, 0x00, 0x0b, 0x05, 0x61, 0x72, 0x63, 0x6f, 0x6d, 0x00,
+  0xd5, 0x5d, 0x01, 0x63, 0x00, 0xd5, 0x64, 0x03, 0x65, 0x65, 0x6c, 0x00,
+  0xd5, 0x78, 0x0a, 0x68, 0x67, 0x69, 0x6c, 0x66, 0x68, 0x74, 0x69, 0x77,
+  0x6c, 0x00, 0x6c, 0x0a, 0x01, 0x69, 0x00, 0xd5, 0x87, 0x01, 0x6d, 0x00,
+  0xa2, 0x1b, 0x01, 0x6e, 0x00, 0xd5, 0x8e, 0x03, 0x6f, 0x70, 0x73, 0x00,
+  0xd5, 0x9f, 0x01, 0x73, 0x00, 0xd5, 0xb2, 0x01, 0x75, 0x00, 0xd5, 0xbf,
+  0x01, 0x76, 0x00, 0xa2, 0x1b, 0x00, 0x07, 0x01, 0x2d, 0x00, 0xd5, 0xd2,
+  0x01, 0x34, 0x00, 0x0e, 0x15, 0x04, 0x61, 0x2d, 0x73, 0x70, 0x00, 0xc4,
+  0x9c, 0x01, 0x65, 0x00, 0x0e, 0x15, 0x01, 0x68, 0x00, 0x0e, 0x15, 0x0c,
+  0x6f, 0x79, 0x6e, 0x61, 0x68, 0x74, 0x72, 0x65, 0x74, 0x72, 0x61, 0x6d,
+  0x00, 0xd5, 0xdc, 0x01, 0x72, 0x00, 0xd5, 0xe3, 0x00, 0x03, 0x01, 0x6e,
+  0x00, 0xa2, 0x1b, 0x02, 0x72, 0x64, 0x00, 0x84, 0x69, 0x01, 0x77, 0x00,
+  0xa2, 0x1b, 0x00, 0x02, 0x01, 0x6f, 0x00, 0xd5, 0xea, 0x04, 0x77, 0x77,
+  0x31, 0x30, 0x00, 0x60, 0x82, 0x00, 0x06, 0x04, 0x62, 0x73, 0x62, 0x66,
+  0x00, 0xaa, 0xf5, 0x01, 0x65, 0x00, 0x12, 0x22, 0x01, 0x69, 0x00, 0xd5,
+  0xfc, 0x05, 0x6f, 0x62, 0x61, 0x6e, 0x69, 0x00, 0xd6, 0x08, 0x01, 0x74,
+  0x00, 0xa2, 0x1b, 0x01, 0x75, 0x00, 0x98, 0x18, 0x00, 0x08, 0x01, 0x61,
+  0x00, 0xd6, 0x0f, 0x04, 0x64, 0x6e, 0x61, 0x63, 0x00, 0xd6, 0x22, 0x03,
+  0x66, 0x69, 0x70, 0x00, 0xd6, 0x2b, 0x01, 0x6b, 0x00, 0xd6, 0x33, 0x03,
+  0x72, 0x6f, 0x74, 0x00, 0xd6, 0x43, 0x01, 0x75, 0x00, 0xd6, 0x5a, 0x01,
+  0x77, 0x00, 0xa2, 0x1b, 0x01, 0x78, 0x00, 0xd6, 0x61, 0x00, 0x01, 0x03,
+  0x73, 0x64, 0x72, 0x00, 0x51, 0x82, 0x00, 0x10, 0x1d, 0x39, 0x32, 0x63,
+  0x68, 0x67, 0x2d, 0x73, 0x65, 0x61, 0x63, 0x69, 0x6e, 0x75, 0x6d, 0x6f,
+  0x63, 0x65, 0x6c, 0x65, 0x74, 0x2d, 0x65, 0x2d, 0x73, 0x6f, 0x69, 0x65,
+  0x72, 0x72, 0x00, 0xd6, 0x73, 0x02, 0x61, 0x74, 0x00, 0x61, 0x00, 0x01,
+  0x63, 0x00, 0xd6, 0x7a, 0x01, 0x64, 0x00, 0xd6, 0x88, 0x01, 0x65, 0x00,
+  0xd6, 0xa1, 0x01, 0x67, 0x00, 0xd6, 0xb4, 0x01, 0x68, 0x00, 0xd6, 0xc9,
+  0x01, 0x69, 0x00, 0xd6, 0xd0, 0x03, 0x6b, 0x73, 0x61, 0x00, 0xd7, 0x08,
+  0x01, 0x6c, 0x00, 0xd7, 0x15, 0x01, 0x6d, 0x00, 0xd7, 0x30, 0x01, 0x6e,
+  0x00, 0xd7, 0x41, 0x01, 0x72, 0x00, 0xd7, 0x5e, 0x01, 0x73, 0x00, 0x5d,
+  0xbc, 0x01, 0x74, 0x00, 0xd7, 0x71, 0x01, 0x7a, 0x00, 0xb9, 0x62, 0x00,
+  0x04, 0x07, 0x64, 0x6e, 0x6f, 0x74, 0x67, 0x6e, 0x69, 0x00, 0xd7, 0x82,
+  0x02, 0x65, 0x62, 0x00, 0x2b, 0x3f, 0x01, 0x69, 0x00, 0xd7, 0x89, 0x01,
+  0x79, 0x00, 0x0f, 0x6f, 0x00, 0x05, 0x01, 0x61, 0x00, 0xd7, 0xb6, 0x01,
+  0x69, 0x00, 0xd7, 0xd2, 0x02, 0x6c, 0x65, 0x00, 0x60, 0x40, 0x01, 0x6e,
+  0x00, 0xd7, 0xe6, 0x01, 0x72, 0x00, 0xd7, 0xf2, 0x00, 0x0f, 0x01, 0x63,
+  0x00, 0xd8, 0x02, 0x01, 0x64, 0x00, 0xd8, 0x18, 0x01, 0x65, 0x00, 0xd8,
+  0x2b, 0x01, 0x66, 0x00, 0xd8, 0x39, 0x01, 0x67, 0x00, 0xd8, 0x47, 0x01,
+  0x69, 0x00, 0xd8, 0x5b, 0x07, 0x6b, 0x6f, 0x6f, 0x72, 0x62, 0x72, 0x65,
+  0x00, 0x38, 0xd2, 0x01, 0x6c, 0x00, 0xd8, 0x69, 0x01, 0x6d, 0x00, 0xd8,
+  0x89, 0x01, 0x6e, 0x00, 0xd8, 0xa1, 0x01, 0x72, 0x00, 0xd8, 0xb6, 0x01,
+  0x73, 0x00, 0xd8, 0xd6, 0x01, 0x74, 0x00, 0xd8, 0xf2, 0x01, 0x75, 0x00,
+  0xd9, 0x07, 0x03, 0x76, 0x69, 0x74, 0x00, 0xd9, 0x16, 0x00, 0x02, 0x01,
+  0x69, 0x00, 0x47, 0x51, 0x04, 0x6f, 0x68, 0x67, 0x72, 0x00, 0x25, 0xc7,
+  0x00, 0x03, 0x01, 0x6e, 0x00, 0xd9, 0x24, 0x01, 0x6f, 0x00, 0x87, 0xcc,
+  0x01, 0x72, 0x00, 0xd9, 0x35, 0x00, 0x05, 0x01, 0x61, 0x00, 0xd9, 0x43,
+  0x01, 0x63, 0x00, 0xd9, 0x4a, 0x01, 0x67, 0x00, 0xd9, 0x5b, 0x02, 0x73,
+  0x69, 0x00, 0xd9, 0x6c, 0x01, 0x74, 0x00, 0xd9, 0x78, 0x00, 0x06, 0x06,
+  0x64, 0x36, 0x67, 0x6c, 0x62, 0x68, 0x00, 0x25, 0xf9, 0x03, 0x69, 0x61,
+  0x77, 0x00, 0x52, 0xae, 0x01, 0x6b, 0x00, 0xd9, 0x8b, 0x03, 0x6c, 0x61,
+  0x64, 0x00, 0xd9, 0x97, 0x02, 0x73, 0x69, 0x00, 0x60, 0x6f, 0x06, 0x74,
+  0x61, 0x6e, 0x6e, 0x69, 0x63, 0x00, 0xd9, 0xa0, 0x00, 0x07, 0x01, 0x63,
+  0x00, 0xd9, 0xa7, 0x01, 0x66, 0x00, 0x16, 0xb8, 0x04, 0x69, 0x6e, 0x65,
+  0x62, 0x00, 0x85, 0x44, 0x01, 0x6c, 0x00, 0xd9, 0xb8, 0x02, 0x6e, 0x61,
+  0x00, 0xd9, 0xc5, 0x04, 0x6f, 0x6f, 0x72, 0x62, 0x00, 0xb9, 0x1c, 0x01,
+  0x72, 0x00, 0xd9, 0xd3, 0x00, 0x05, 0x01, 0x61, 0x00, 0xd9, 0xe1, 0x01,
+  0x65, 0x00, 0xda, 0x17, 0x01, 0x69, 0x00, 0xda, 0x28, 0x01, 0x6c, 0x00,
+  0xda, 0x39, 0x01, 0x6f, 0x00, 0xda, 0x4a, 0x00, 0x07, 0x01, 0x61, 0x00,
+  0xda, 0x5c, 0x01, 0x63, 0x00, 0x16, 0x7b, 0x04, 0x65, 0x6c, 0x61, 0x73,
+  0x00, 0xda, 0x6d, 0x01, 0x6c, 0x00, 0xda, 0x75, 0x01, 0x72, 0x00, 0x5f,
+  0xdf, 0x03, 0x73, 0x69, 0x6c, 0x00, 0xda, 0x86, 0x01, 0x75, 0x00, 0xda,
+  0x8d, 0x00, 0x0b, 0x01, 0x61, 0x00, 0xda, 0xaf, 0x01, 0x65, 0x00, 0xda,
+  0xd5, 0x05, 0x67, 0x69, 0x73, 0x65, 0x64, 0x00, 0xdb, 0x0f, 0x01, 0x68,
+  0x00, 0xdb, 0x17, 0x01, 0x69, 0x00, 0xdb, 0x24, 0x01, 0x6c, 0x00, 0x1a,
+  0x6e, 0x01, 0x6e, 0x00, 0xdb, 0x30, 0x01, 0x6f, 0x00, 0xdb, 0x40, 0x01,
+  0x72, 0x00, 0xdb, 0x60, 0x07, 0x76, 0x61, 0x68, 0x6e, 0x65, 0x62, 0x65,
+  0x00, 0x41, 0xf9, 0x01, 0x77, 0x00, 0x46, 0x7c, 0x00, 0x0a, 0x0d, 0x32,
+  0x61, 0x36, 0x76, 0x2d, 0x73, 0x65, 0x61, 0x63, 0x69, 0x6e, 0x75, 0x6d,
+  0x00, 0xd6, 0x73, 0x03, 0x61, 0x62, 0x6c, 0x00, 0x5f, 0x90, 0x01, 0x63,
+  0x00, 0xdb, 0x6f, 0x01, 0x65, 0x00, 0xdb, 0x8a, 0x01, 0x67, 0x00, 0xdb,
+  0x91, 0x01, 0x69, 0x00, 0xdb, 0x9e, 0x05, 0x6c, 0x6c, 0x65, 0x63, 0x69,
+  0x00, 0xdb, 0xb3, 0x03, 0x6d, 0x69, 0x74, 0x00, 0xba, 0x01, 0x01, 0x6e,
+  0x00, 0xdb, 0xba, 0x01, 0x72, 0x00, 0xdb, 0xc1, 0x00, 0x01, 0x01, 0x6b,
+  0x00, 0xc6, 0x50, 0x00, 0x06, 0x02, 0x61, 0x77, 0x00, 0xdb, 0xd3, 0x01,
+  0x64, 0x00, 0x1e, 0x60, 0x01, 0x65, 0x00, 0xdb, 0xdf, 0x02, 0x69, 0x61,
+  0x00, 0xdc, 0x0d, 0x01, 0x6f, 0x00, 0xdc, 0x14, 0x01, 0x75, 0x00, 0xdc,
+  0x1b, 0x00, 0x0d, 0x01, 0x61, 0x00, 0xdc, 0x32, 0x02, 0x64, 0x69, 0x00,
+  0xdc, 0x3e, 0x01, 0x65, 0x00, 0xdc, 0x4d, 0x07, 0x67, 0x6e, 0x69, 0x72,
+  0x70, 0x73, 0x6d, 0x00, 0xdb, 0x8a, 0x02, 0x68, 0x74, 0x00, 0x53, 0x44,
+  0x01, 0x69, 0x00, 0xdc, 0x87, 0x01, 0x6c, 0x00, 0xdc, 0xa4, 0x08, 0x6d,
+  0x72, 0x61, 0x65, 0x72, 0x69, 0x66, 0x6c, 0x00, 0xdc, 0xb1, 0x01, 0x6e,
+  0x00, 0xdc, 0xba, 0x02, 0x72, 0x65, 0x00, 0xdc, 0xcc, 0x01, 0x73, 0x00,
+  0xdc, 0xeb, 0x01, 0x74, 0x00, 0xdc, 0xf7, 0x01, 0x75, 0x00, 0xdd, 0x11,
+  0x00, 0x09, 0x06, 0x61, 0x67, 0x69, 0x6c, 0x6c, 0x74, 0x00, 0xdd, 0x1e,
+  0x03, 0x63, 0x65, 0x6a, 0x00, 0x67, 0x81, 0x01, 0x64, 0x00, 0x70, 0xcb,
+  0x01, 0x65, 0x00, 0xdd, 0x25, 0x03, 0x69, 0x6f, 0x72, 0x00, 0x90, 0x7b,
+  0x02, 0x6e, 0x65, 0x00, 0xdd, 0x34, 0x02, 0x6f, 0x70, 0x00, 0x28, 0xd5,
+  0x01, 0x72, 0x00, 0xdd, 0x40, 0x01, 0x73, 0x00, 0xdd, 0x54, 0x00, 0x02,
+  0x01, 0x61, 0x00, 0xdd, 0x78, 0x02, 0x72, 0x6d, 0x00, 0x54, 0xdc, 0x00,
+  0x02, 0x02, 0x6f, 0x63, 0x00, 0x56, 0xf1, 0x01, 0x72, 0x00, 0x0f, 0x6f,
+  0x00, 0x04, 0x02, 0x65, 0x73, 0x00, 0x61, 0xba, 0x03, 0x69, 0x6e, 0x65,
+  0x00, 0x59, 0x0a, 0x01, 0x6e, 0x00, 0x13, 0x33, 0x01, 0x74, 0x00, 0x1c,
+  0x65, 0x00, 0x0d, 0x01, 0x61, 0x00, 0xdd, 0x8d, 0x01, 0x63, 0x00, 0xce,
+  0xf3, 0x01, 0x64, 0x00, 0x2f, 0x47, 0x01, 0x65, 0x00, 0xdd, 0xa0, 0x04,
+  0x67, 0x6f, 0x6c, 0x6f, 0x00, 0xdd, 0xbb, 0x01, 0x68, 0x00, 0x24, 0xa3,
+  0x01, 0x6c, 0x00, 0xdd, 0xde, 0x01, 0x6d, 0x00, 0xdd, 0xeb, 0x01, 0x6e,
+  0x00, 0xdd, 0xfb, 0x01, 0x70, 0x00, 0x27, 0x0f, 0x01, 0x72, 0x00, 0xde,
+  0x07, 0x06, 0x73, 0x70, 0x65, 0x6c, 0x69, 0x70, 0x00, 0x1d, 0x34, 0x01,
+  0x74, 0x00, 0xde, 0x35, 0x00, 0x05, 0x01, 0x61, 0x00, 0x31, 0x67, 0x02,
+  0x69, 0x65, 0x00, 0x25, 0x9f, 0x01, 0x6e, 0x00, 0x17, 0xbd, 0x02, 0x6f,
+  0x6a, 0x00, 0xde, 0x4a, 0x03, 0x75, 0x72, 0x63, 0x00, 0xde, 0x52, 0x01,
+  0x01, 0x0b, 0x2e, 0x73, 0x77, 0x61, 0x6e, 0x6f, 0x7a, 0x61, 0x6d, 0x61,
+  0x2e, 0x00, 0xde, 0x59, 0x00, 0x01, 0x02, 0x61, 0x76, 0x00, 0xde, 0x73,
+  0x00, 0x01, 0x02, 0x61, 0x6c, 0x00, 0x27, 0xf5, 0x00, 0x01, 0x01, 0x76,
+  0x00, 0x3c, 0xee, 0x00, 0x01, 0x01, 0x73, 0x00, 0x25, 0xc7, 0x01, 0x01,
+  0x01, 0x72, 0x00, 0xcc, 0xd7, 0x00, 0x01, 0x01, 0x72, 0x00, 0x62, 0x0c,
+  0x00, 0x03, 0x04, 0x63, 0x75, 0x64, 0x65, 0x00, 0x58, 0xfc, 0x01, 0x64,
+  0x00, 0xde, 0x7a, 0x01, 0x74, 0x00, 0xde, 0x82, 0x00, 0x02, 0x01, 0x65,
+  0x00, 0xde, 0x8a, 0x01, 0x75, 0x00, 0xde, 0x91, 0x00, 0x01, 0x01, 0x64,
+  0x00, 0x66, 0x03, 0x00, 0x01, 0x01, 0x72, 0x00, 0x69, 0x7a, 0x01, 0x01,
+  0x01, 0x6e, 0x00, 0x39, 0x28, 0x00, 0x01, 0x01, 0x64, 0x00, 0x95, 0x04,
+  0x00, 0x02, 0x01, 0x64, 0x00, 0xde, 0x9e, 0x06, 0x73, 0x61, 0x62, 0x61,
+  0x74, 0x61, 0x00, 0xcc, 0x54, 0x00, 0x01, 0x01, 0x6d, 0x00, 0x14, 0x4a,
+  0x00, 0x02, 0x01, 0x68, 0x00, 0x0e, 0x15, 0x01, 0x72, 0x00, 0xcf, 0x01,
+  0x00, 0x01, 0x01, 0x76, 0x00, 0x28, 0xd5, 0x00, 0x01, 0x01, 0x61, 0x00,
+  0x6a, 0xcc, 0x00, 0x02, 0x01, 0x73, 0x00, 0x2b, 0x73, 0x01, 0x74, 0x00,
+  0x2f, 0xce, 0x00, 0x05, 0x01, 0x63, 0x00, 0xde, 0xa5, 0x04, 0x67, 0x6f,
+  0x6c, 0x6f, 0x00, 0xde, 0xb2, 0x01, 0x6d, 0x00, 0xde, 0xbe, 0x02, 0x72,
+  0x74, 0x00, 0xde, 0xcb, 0x02, 0x76, 0x69, 0x00, 0xde, 0xd7, 0x00, 0x02,
+  0x02, 0x65, 0x67, 0x00, 0x73, 0x71, 0x02, 0x69, 0x63, 0x00, 0xc6, 0x2b,
+  0x00, 0x02, 0x01, 0x61, 0x00, 0x0e, 0x15, 0x02, 0x6f, 0x70, 0x00, 0xde,
+  0xde, 0x00, 0x02, 0x03, 0x6e, 0x6f, 0x69, 0x00, 0xde, 0xea, 0x01, 0x72,
+  0x00, 0xc9, 0x26, 0x00, 0x01, 0x01, 0x74, 0x00, 0x56, 0x74, 0x00, 0x01,
+  0x02, 0x62, 0x61, 0x00, 0x59, 0x4e, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x6d,
+  0x2e, 0x00, 0x02, 0x01, 0x64, 0x00, 0xde, 0xfc, 0x01, 0x6c, 0x00, 0x0e,
+  0x15, 0x00, 0x04, 0x01, 0x67, 0x00, 0xdf, 0x03, 0x01, 0x68, 0x00, 0xdf,
+  0x21, 0x09, 0x72, 0x6f, 0x6d, 0x2d, 0x72, 0x6f, 0x66, 0x2d, 0x65, 0x00,
+  0xdf, 0x2b, 0x07, 0x74, 0x61, 0x64, 0x70, 0x75, 0x73, 0x6e, 0x00, 0xdf,
+  0x32, 0x00, 0x01, 0x01, 0x76, 0x00, 0x1e, 0x60, 0x00, 0x02, 0x01, 0x69,
+  0x00, 0xc6, 0xa6, 0x01, 0x6f, 0x00, 0x62, 0x1b, 0x00, 0x02, 0x02, 0x69,
+  0x68, 0x00, 0xdf, 0x21, 0x02, 0x6e, 0x64, 0x00, 0xdf, 0x39, 0x00, 0x01,
+  0x03, 0x69, 0x66, 0x79, 0x00, 0x13, 0x33, 0x00, 0x01, 0x01, 0x79, 0x00,
+  0x1e, 0x60, 0x00, 0x01, 0x04, 0x69, 0x6e, 0x69, 0x66, 0x00, 0x28, 0xd5,
+  0x00, 0x01, 0x01, 0x68, 0x00, 0x6a, 0xdf, 0x00, 0x02, 0x03, 0x6f, 0x6c,
+  0x63, 0x00, 0xdf, 0x4b, 0x01, 0x72, 0x00, 0x1e, 0x60, 0x00, 0x02, 0x0b,
+  0x61, 0x70, 0x73, 0x69, 0x6e, 0x75, 0x2e, 0x31, 0x72, 0x66, 0x2d, 0x00,
+  0x93, 0x5b, 0x05, 0x69, 0x76, 0x65, 0x64, 0x6e, 0x00, 0xdf, 0x5f, 0x00,
+  0x01, 0x01, 0x69, 0x00, 0x30, 0x72, 0x00, 0x02, 0x06, 0x61, 0x63, 0x73,
+  0x6e, 0x6f, 0x6f, 0x00, 0xa9, 0x3d, 0x01, 0x65, 0x00, 0x16, 0xb8, 0x00,
+  0x03, 0x01, 0x69, 0x00, 0xdf, 0x66, 0x03, 0x6e, 0x65, 0x77, 0x00, 0xd9,
+  0x43, 0x05, 0x79, 0x62, 0x65, 0x65, 0x62, 0x00, 0xdf, 0x78, 0x00, 0x01,
+  0x01, 0x69, 0x00, 0xce, 0xfa, 0x01, 0x01, 0x02, 0x2e, 0x6b, 0x00, 0xdf,
+  0x80, 0x00, 0x01, 0x02, 0x2d, 0x6e, 0x00, 0x74, 0xe9, 0x00, 0x01, 0x01,
+  0x72, 0x00, 0xaa, 0xa1, 0x00, 0x02, 0x01, 0x6f, 0x00, 0x8d, 0x58, 0x01,
+  0x70, 0x00, 0xc6, 0x40, 0x00, 0x01, 0x01, 0x70, 0x00, 0xb7, 0xf9, 0x00,
+  0x02, 0x03, 0x2d, 0x61, 0x72, 0x00, 0xb9, 0x69, 0x01, 0x65, 0x00, 0xdf,
+  0x87, 0x00, 0x03, 0x0b, 0x6e, 0x69, 0x61, 0x74, 0x6e, 0x6f, 0x63, 0x65,
+  0x72, 0x75, 0x7a, 0x00, 0x5c, 0xa9, 0x07, 0x74, 0x73, 0x6e, 0x65, 0x75,
+  0x6d, 0x2d, 0x00, 0x66, 0xb7, 0x04, 0x76, 0x72, 0x65, 0x73, 0x00, 0xdf,
+  0x9f, 0x00, 0x01, 0x01, 0x2e, 0x00, 0xdf, 0xab, 0x00, 0x01, 0x01, 0x2d,
+  0x00, 0x64, 0xb6, 0x00, 0x02, 0x02, 0x61, 0x63, 0x00, 0x3b, 0x02, 0x03,
+  0x65, 0x6b, 0x63, 0x00, 0x3d, 0xfb, 0x00, 0x02, 0x03, 0x6b, 0x63, 0x75,
+  0x00, 0xdf, 0xb2, 0x02, 0x6e, 0x6f, 0x00, 0xde, 0x8a, 0x00, 0x04, 0x01,
+  0x62, 0x00, 0xdf, 0xba, 0x02, 0x64, 0x65, 0x00, 0xdf, 0xc1, 0x01, 0x67,
+  0x00, 0xdf, 0xc9, 0x01, 0x6b, 0x00, 0xdf, 0xd0, 0x00, 0x01, 0x01, 0x67,
+  0x00, 0x70, 0xcb, 0x00, 0x02, 0x02, 0x6f, 0x68, 0x00, 0x0c, 0x1d, 0x08,
+  0x75, 0x64, 0x67, 0x6e, 0x69, 0x68, 0x74, 0x2e, 0x00, 0xdf, 0xd9, 0x01,
+  0x01, 0x03, 0x2e, 0x73, 0x79, 0x00, 0x6c, 0x6e, 0x00, 0x04, 0x07, 0x62,
+  0x2d, 0x65, 0x6b, 0x68, 0x67, 0x6e, 0x00, 0xdf, 0xfd, 0x08, 0x63, 0x2d,
+  0x69, 0x65, 0x68, 0x73, 0x72, 0x67, 0x00, 0x2a, 0x32, 0x08, 0x67, 0x2d,
+  0x6c, 0x6b, 0x73, 0x65, 0x64, 0x6c, 0x00, 0xe0, 0x04, 0x08, 0x6b, 0x2d,
+  0x6e, 0x65, 0x67, 0x6e, 0x61, 0x6e, 0x00, 0xe0, 0x0b, 0x00, 0x05, 0x07,
+  0x70, 0x2d, 0x6e, 0x65, 0x64, 0x72, 0x61, 0x00, 0x57, 0xfd, 0x02, 0x71,
+  0x2d, 0x00, 0xe0, 0x12, 0x07, 0x72, 0x2d, 0x64, 0x61, 0x74, 0x73, 0x67,
+  0x00, 0xe0, 0x46, 0x02, 0x73, 0x2d, 0x00, 0xe0, 0x4d, 0x03, 0x76, 0x2d,
+  0x79, 0x00, 0xe0, 0x58, 0x00, 0x04, 0x02, 0x35, 0x2d, 0x00, 0xe0, 0x6a,
+  0x09, 0x36, 0x2d, 0x6e, 0x65, 0x6c, 0x61, 0x64, 0x6e, 0x6a, 0x00, 0x33,
+  0x14, 0x02, 0x73, 0x2d, 0x00, 0xe0, 0x8b, 0x02, 0x79, 0x2d, 0x00, 0xe0,
+  0xa4, 0x00, 0x01, 0x02, 0x63, 0x68, 0x00, 0x2a, 0x53, 0x00, 0x03, 0x09,
+  0x6b, 0x2d, 0x72, 0x65, 0x6b, 0x69, 0x65, 0x2d, 0x65, 0x00, 0xe0, 0xbf,
+  0x08, 0x6c, 0x2d, 0x6c, 0x61, 0x64, 0x72, 0x75, 0x61, 0x00, 0xe0, 0xc6,
+  0x09, 0x6d, 0x2d, 0x64, 0x61, 0x72, 0x65, 0x68, 0x73, 0x64, 0x00, 0xb1,
+  0x9b, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x92, 0x28, 0x00, 0x05, 0x01, 0x64,
+  0x00, 0x41, 0x08, 0x04, 0x69, 0x69, 0x73, 0x65, 0x00, 0xe0, 0xcd, 0x01,
+  0x6c, 0x00, 0x27, 0x33, 0x02, 0x6e, 0x61, 0x00, 0xb3, 0x2e, 0x01, 0x75,
+  0x00, 0x1c, 0x65, 0x00, 0x02, 0x02, 0x31, 0x2d, 0x00, 0xe0, 0xd5, 0x02,
+  0x32, 0x2d, 0x00, 0x10, 0xd5, 0x00, 0x05, 0x0a, 0x31, 0x30, 0x61, 0x71,
+  0x30, 0x2d, 0x69, 0x6e, 0x65, 0x76, 0x00, 0x0f, 0xa0, 0x01, 0x61, 0x00,
+  0x27, 0xf5, 0x01, 0x65, 0x00, 0x27, 0xf5, 0x01, 0x6c, 0x00, 0x46, 0x7c,
+  0x04, 0x72, 0x61, 0x6a, 0x6e, 0x00, 0xe0, 0xe1, 0x00, 0x02, 0x02, 0x64,
+  0x64, 0x00, 0xde, 0x4a, 0x01, 0x73, 0x00, 0x16, 0xd4, 0x00, 0x03, 0x01,
+  0x65, 0x00, 0x26, 0xde, 0x02, 0x68, 0x6f, 0x00, 0xb1, 0xdf, 0x03, 0x69,
+  0x69, 0x76, 0x00, 0xe0, 0xed, 0x00, 0x06, 0x01, 0x66, 0x00, 0x0e, 0x15,
+  0x06, 0x6c, 0x61, 0x68, 0x72, 0x65, 0x76, 0x00, 0x41, 0x08, 0x01, 0x6f,
+  0x00, 0xe0, 0xfc, 0x03, 0x73, 0x65, 0x6e, 0x00, 0xe1, 0x08, 0x02, 0x74,
+  0x2d, 0x00, 0xe1, 0x0f, 0x01, 0x75, 0x00, 0xe1, 0x1b, 0x00, 0x0c, 0x02,
+  0x30, 0x2d, 0x00, 0xe1, 0x28, 0x03, 0x32, 0x2d, 0x64, 0x00, 0xc1, 0xa1,
+  0x02, 0x35, 0x2d, 0x00, 0xe1, 0x2f, 0x01, 0x61, 0x00, 0xe1, 0x3d, 0x06,
+  0x64, 0x6f, 0x75, 0x76, 0x73, 0x61, 0x00, 0xe1, 0x49, 0x01, 0x6b, 0x00,
+  0x4b, 0xdd, 0x01, 0x6d, 0x00, 0x48, 0x25, 0x01, 0x6e, 0x00, 0x2c, 0x17,
+  0x01, 0x72, 0x00, 0x26, 0xd7, 0x01, 0x73, 0x00, 0x22, 0x26, 0x01, 0x74,
+  0x00, 0xe1, 0x51, 0x04, 0x7a, 0x2d, 0x72, 0x65, 0x00, 0x1b, 0x10, 0x00,
+  0x06, 0x02, 0x70, 0x2d, 0x00, 0xe1, 0x65, 0x04, 0x71, 0x2d, 0x6e, 0x61,
+  0x00, 0xb1, 0x94, 0x04, 0x72, 0x2d, 0x61, 0x73, 0x00, 0xe1, 0x73, 0x03,
+  0x73, 0x2d, 0x6b, 0x00, 0xe1, 0x7a, 0x04, 0x76, 0x2d, 0x6d, 0x75, 0x00,
+  0xe1, 0x81, 0x02, 0x77, 0x2d, 0x00, 0xe1, 0x88, 0x00, 0x03, 0x03, 0x30,
+  0x2d, 0x74, 0x00, 0xe1, 0x97, 0x02, 0x78, 0x2d, 0x00, 0xe1, 0xad, 0x04,
+  0x79, 0x2d, 0x74, 0x69, 0x00, 0xe1, 0xbc, 0x00, 0x0e, 0x03, 0x66, 0x2d,
+  0x61, 0x00, 0xe1, 0x28, 0x02, 0x67, 0x2d, 0x00, 0xe1, 0xc3, 0x02, 0x68,
+  0x2d, 0x00, 0xe1, 0xea, 0x01, 0x69, 0x00, 0xe1, 0xf8, 0x02, 0x6a, 0x2d,
+  0x00, 0xe2, 0x04, 0x01, 0x6b, 0x00, 0x84, 0x70, 0x02, 0x6c, 0x2d, 0x00,
+  0xe2, 0x18, 0x05, 0x6d, 0x2d, 0x74, 0x6c, 0x6f, 0x00, 0x13, 0xb1, 0x05,
+  0x6e, 0x2d, 0x65, 0x73, 0x61, 0x00, 0xe1, 0x73, 0x01, 0x6f, 0x00, 0x84,
+  0x69, 0x06, 0x70, 0x2d, 0x73, 0x64, 0x6e, 0x69, 0x00, 0x2a, 0xfa, 0x05,
+  0x73, 0x2d, 0x6c, 0x61, 0x64, 0x00, 0xe2, 0x28, 0x01, 0x74, 0x00, 0x7f,
+  0xc0, 0x06, 0x76, 0x2d, 0x72, 0x76, 0x73, 0x79, 0x00, 0x16, 0xc6, 0x00,
+  0x06, 0x01, 0x61, 0x00, 0xe2, 0x2f, 0x01, 0x69, 0x00, 0xe2, 0x3b, 0x02,
+  0x6c, 0x61, 0x00, 0xe2, 0x48, 0x03, 0x6d, 0x6f, 0x72, 0x00, 0xe2, 0x54,
+  0x01, 0x73, 0x00, 0x36, 0xd0, 0x01, 0x75, 0x00, 0x16, 0x9c, 0x00, 0x06,
+  0x06, 0x6b, 0x6f, 0x75, 0x6c, 0x6f, 0x6e, 0x00, 0xb2, 0xfd, 0x01, 0x6c,
+  0x00, 0x26, 0xd7, 0x06, 0x70, 0x2d, 0x72, 0x61, 0x64, 0x64, 0x00, 0xe2,
+  0x5b, 0x06, 0x72, 0x2d, 0x61, 0x67, 0x72, 0x6a, 0x00, 0x24, 0x14, 0x01,
+  0x73, 0x00, 0xe2, 0x62, 0x06, 0x75, 0x2d, 0x76, 0x72, 0x65, 0x69, 0x00,
+  0xe2, 0x77, 0x00, 0x09, 0x06, 0x68, 0x2d, 0x64, 0x6e, 0x75, 0x73, 0x00,
+  0xae, 0xf6, 0x02, 0x69, 0x2d, 0x00, 0xe2, 0x7e, 0x05, 0x6a, 0x2d, 0x65,
+  0x6b, 0x65, 0x00, 0x92, 0xd3, 0x06, 0x6b, 0x2d, 0x72, 0x65, 0x6b, 0x72,
+  0x00, 0xe2, 0x91, 0x02, 0x75, 0x2d, 0x00, 0xe2, 0x98, 0x05, 0x76, 0x2d,
+  0x6e, 0x65, 0x6b, 0x00, 0xe2, 0xb0, 0x02, 0x77, 0x2d, 0x00, 0xe2, 0xb7,
+  0x03, 0x79, 0x2d, 0x79, 0x00, 0xe2, 0xc5, 0x05, 0x7a, 0x2d, 0x73, 0x6d,
+  0x6f, 0x00, 0xe0, 0x46, 0x01, 0x03, 0x01, 0x2e, 0x00, 0x92, 0x28, 0x07,
+  0x6c, 0x65, 0x64, 0x61, 0x74, 0x73, 0x6b, 0x00, 0xe2, 0xdf, 0x02, 0x72,
+  0x65, 0x00, 0xe2, 0xe6, 0x00, 0x08, 0x0e, 0x39, 0x2d, 0x64, 0x6c, 0x6f,
+  0x66, 0x74, 0x73, 0x2d, 0x2d, 0x6e, 0x78, 0x2e, 0x61, 0x00, 0xe2, 0xed,
+  0x07, 0x64, 0x2d, 0x6e, 0x6d, 0x61, 0x68, 0x65, 0x00, 0xb1, 0x9b, 0x06,
+  0x66, 0x2d, 0x64, 0x6e, 0x61, 0x6c, 0x00, 0xe1, 0xbc, 0x07, 0x68, 0x2d,
+  0x6e, 0x65, 0x6c, 0x74, 0x6c, 0x00, 0xe2, 0xf9, 0x08, 0x69, 0x2d, 0x64,
+  0x72, 0x67, 0x65, 0x70, 0x70, 0x00, 0x0f, 0x92, 0x05, 0x6a, 0x2d, 0x67,
+  0x76, 0x65, 0x00, 0xe3, 0x00, 0x07, 0x6d, 0x2d, 0x6e, 0x65, 0x67, 0x6e,
+  0x69, 0x00, 0xe3, 0x0e, 0x07, 0x6e, 0x2d, 0x64, 0x72, 0x6f, 0x6a, 0x66,
+  0x00, 0xe0, 0x0b, 0x00, 0x07, 0x08, 0x37, 0x2d, 0x75, 0x6a, 0x64, 0x61,
+  0x65, 0x68, 0x00, 0xe3, 0x15, 0x08, 0x38, 0x2d, 0x61, 0x6e, 0x74, 0x6f,
+  0x75, 0x76, 0x00, 0xe0, 0x04, 0x02, 0x62, 0x2d, 0x00, 0xe3, 0x1c, 0x06,
+  0x65, 0x2d, 0x6e, 0x65, 0x6a, 0x73, 0x00, 0xc6, 0xc0, 0x03, 0x66, 0x2d,
+  0x79, 0x00, 0xe3, 0x3f, 0x05, 0x67, 0x2d, 0x72, 0x65, 0x67, 0x00, 0xdf,
+  0xfd, 0x01, 0x6f, 0x00, 0x87, 0xcc, 0x00, 0x01, 0x01, 0x65, 0x00, 0x2a,
+  0xfa, 0x00, 0x03, 0x03, 0x69, 0x79, 0x2d, 0x00, 0xb1, 0x94, 0x05, 0x6c,
+  0x65, 0x2d, 0x74, 0x6c, 0x00, 0xe3, 0x55, 0x04, 0x6e, 0x30, 0x2d, 0x79,
+  0x00, 0xe3, 0x61, 0x00, 0x02, 0x0a, 0x30, 0x2d, 0x64, 0x6e, 0x61, 0x6c,
+  0x2d, 0x65, 0x72, 0x64, 0x00, 0xe1, 0x73, 0x0a, 0x7a, 0x2d, 0x6e, 0x65,
+  0x74, 0x6f, 0x74, 0x2d, 0x65, 0x72, 0x00, 0xe3, 0x68, 0x00, 0x02, 0x0a,
+  0x67, 0x2d, 0x72, 0x65, 0x67, 0x6e, 0x61, 0x72, 0x61, 0x76, 0x00, 0xe0,
+  0xc6, 0x0a, 0x6f, 0x2d, 0x6e, 0x65, 0x6a, 0x73, 0x73, 0x65, 0x6e, 0x64,
+  0x00, 0xe3, 0x6f, 0x00, 0x02, 0x15, 0x71, 0x2d, 0x6c, 0x61, 0x64, 0x73,
+  0x6d, 0x6f, 0x72, 0x2d, 0x67, 0x6f, 0x2d, 0x65, 0x72, 0x6d, 0x2d, 0x2d,
+  0x6e, 0x78, 0x2e, 0x00, 0xe3, 0x77, 0x09, 0x73, 0x2d, 0x6e, 0x65, 0x73,
+  0x6c, 0x61, 0x68, 0x73, 0x00, 0xe0, 0x4d, 0x00, 0x01, 0x03, 0x79, 0x6e,
+  0x6e, 0x00, 0xe1, 0x81, 0x00, 0x01, 0x01, 0x74, 0x00, 0x2a, 0xfa, 0x00,
+  0x01, 0x01, 0x69, 0x00, 0x2a, 0x53, 0x00, 0x03, 0x06, 0x71, 0x78, 0x2d,
+  0x74, 0x67, 0x67, 0x00, 0xe0, 0xbf, 0x03, 0x72, 0x65, 0x68, 0x00, 0xe3,
+  0x84, 0x02, 0x74, 0x73, 0x00, 0xe3, 0x97, 0x01, 0x02, 0x01, 0x72, 0x00,
+  0x52, 0xae, 0x01, 0x73, 0x00, 0xe3, 0xc2, 0x00, 0x02, 0x01, 0x72, 0x00,
+  0x48, 0x25, 0x02, 0x74, 0x73, 0x00, 0xe3, 0xd1, 0x00, 0x02, 0x01, 0x61,
+  0x00, 0xe3, 0xe2, 0x01, 0x75, 0x00, 0xe3, 0xf5, 0x00, 0x02, 0x01, 0x61,
+  0x00, 0xe4, 0x01, 0x01, 0x6f, 0x00, 0xe4, 0x11, 0x00, 0x01, 0x01, 0x2e,
+  0x00, 0xe4, 0x1d, 0x00, 0x01, 0x01, 0x74, 0x00, 0x0b, 0xad, 0x00, 0x04,
+  0x01, 0x61, 0x00, 0x1d, 0x1c, 0x01, 0x69, 0x00, 0x9b, 0xf6, 0x01, 0x6c,
+  0x00, 0x64, 0xb6, 0x01, 0x72, 0x00, 0x3f, 0xd8, 0x00, 0x02, 0x01, 0x67,
+  0x00, 0x55, 0x62, 0x01, 0x6e, 0x00, 0x70, 0xcb, 0x00, 0x02, 0x04, 0x6d,
+  0x65, 0x75, 0x76, 0x00, 0xe4, 0x24, 0x02, 0x72, 0x6a, 0x00, 0x28, 0x04,
+  0x00, 0x02, 0x01, 0x64, 0x00, 0xe4, 0x38, 0x01, 0x6c, 0x00, 0x25, 0x56,
+  0x00, 0x05, 0x03, 0x65, 0x72, 0x61, 0x00, 0x64, 0xb6, 0x04, 0x68, 0x67,
+  0x6e, 0x61, 0x00, 0xc5, 0xec, 0x04, 0x69, 0x72, 0x65, 0x67, 0x00, 0xe4,
+  0x44, 0x03, 0x6b, 0x6f, 0x74, 0x00, 0x35, 0x93, 0x01, 0x73, 0x00, 0xe4,
+  0x4b, 0x00, 0x04, 0x01, 0x62, 0x00, 0xe4, 0x57, 0x01, 0x6b, 0x00, 0xc9,
+  0x5c, 0x01, 0x6c, 0x00, 0xe4, 0x5e, 0x01, 0x6f, 0x00, 0x21, 0x6d, 0x00,
+  0x02, 0x01, 0x69, 0x00, 0x16, 0x7b, 0x01, 0x6f, 0x00, 0xe4, 0x6b, 0x00,
+  0x07, 0x01, 0x61, 0x00, 0x31, 0x67, 0x01, 0x67, 0x00, 0x48, 0x25, 0x01,
+  0x6d, 0x00, 0x6a, 0xcc, 0x02, 0x72, 0x65, 0x00, 0x17, 0xbd, 0x01, 0x74,
+  0x00, 0x1d, 0x34, 0x01, 0x75, 0x00, 0xc9, 0x1f, 0x01, 0x79, 0x00, 0x97,
+  0x5e, 0x00, 0x03, 0x09, 0x64, 0x69, 0x6c, 0x73, 0x2d, 0x65, 0x72, 0x74,
+  0x73, 0x00, 0xe4, 0x72, 0x01, 0x75, 0x00, 0x26, 0xd7, 0x01, 0x76, 0x00,
+  0x2c, 0x17, 0x00, 0x01, 0x01, 0x6e, 0x00, 0x27, 0x0f, 0x00, 0x02, 0x05,
+  0x72, 0x6f, 0x62, 0x72, 0x61, 0x00, 0x26, 0xd7, 0x03, 0x73, 0x70, 0x61,
+  0x00, 0x94, 0xe0, 0x00, 0x02, 0x0a, 0x31, 0x30, 0x2d, 0x75, 0x6a, 0x76,
+  0x72, 0x65, 0x6b, 0x6b, 0x00, 0x13, 0xb1, 0x0d, 0x37, 0x6b, 0x2d, 0x74,
+  0x61, 0x6a, 0x6a, 0x72, 0x76, 0x2d, 0x61, 0x74, 0x74, 0x00, 0x33, 0x14,
+  0x01, 0x02, 0x01, 0x2e, 0x00, 0x92, 0x28, 0x01, 0x68, 0x00, 0x0e, 0x15,
+  0x00, 0x02, 0x01, 0x6e, 0x00, 0x26, 0x0f, 0x01, 0x76, 0x00, 0x26, 0x0f,
+  0x00, 0x02, 0x02, 0x6c, 0x6c, 0x00, 0x83, 0x0e, 0x02, 0x76, 0x65, 0x00,
+  0xe4, 0x7e, 0x00, 0x02, 0x02, 0x61, 0x76, 0x00, 0xe4, 0x8a, 0x01, 0x6f,
+  0x00, 0x31, 0x67, 0x00, 0x04, 0x01, 0x64, 0x00, 0xe4, 0x92, 0x01, 0x6d,
+  0x00, 0x83, 0x0e, 0x03, 0x6e, 0x65, 0x72, 0x00, 0x46, 0x75, 0x01, 0x72,
+  0x00, 0x41, 0x08, 0x00, 0x02, 0x02, 0x65, 0x62, 0x00, 0xe4, 0x99, 0x04,
+  0x6f, 0x62, 0x73, 0x70, 0x00, 0xe4, 0xad, 0x00, 0x02, 0x0c, 0x34, 0x61,
+  0x79, 0x38, 0x2d, 0x61, 0x6b, 0x69, 0x69, 0x76, 0x61, 0x67, 0x00, 0x12,
+  0xf0, 0x0c, 0x35, 0x61, 0x79, 0x37, 0x2d, 0x61, 0x74, 0x6b, 0x6f, 0x75,
+  0x6c, 0x6f, 0x00, 0x0b, 0x7d, 0x00, 0x02, 0x05, 0x68, 0x73, 0x72, 0x61,
+  0x67, 0x00, 0x4b, 0x25, 0x01, 0x72, 0x00, 0x16, 0x9c, 0x00, 0x02, 0x06,
+  0x68, 0x61, 0x76, 0x6c, 0x61, 0x72, 0x00, 0x5a, 0x29, 0x01, 0x73, 0x00,
+  0x0e, 0x15, 0x00, 0x01, 0x01, 0x6c, 0x00, 0x13, 0x33, 0x00, 0x01, 0x01,
+  0x76, 0x00, 0x1d, 0x34, 0x00, 0x01, 0x01, 0x67, 0x00, 0x23, 0x27, 0x00,
+  0x01, 0x01, 0x72, 0x00, 0x0b, 0x7d, 0x00, 0x03, 0x02, 0x62, 0x6f, 0x00,
+  0x5f, 0xbd, 0x01, 0x6a, 0x00, 0x31, 0x6e, 0x03, 0x6c, 0x6c, 0x65, 0x00,
+  0x85, 0x44, 0x01, 0x07, 0x05, 0x61, 0x6b, 0x6c, 0x65, 0x6a, 0x00, 0x8e,
+  0xad, 0x01, 0x6c, 0x00, 0xe4, 0xb4, 0x01, 0x6d, 0x00, 0x40, 0xdc, 0x01,
+  0x6e, 0x00, 0x16, 0xd4, 0x01, 0x6f, 0x00, 0xe4, 0xc5, 0x01, 0x72, 0x00,
+  0xe4, 0xcc, 0x01, 0x73, 0x00, 0xe4, 0xe3, 0x00, 0x01, 0x01, 0x6a, 0x00,
+  0xe4, 0xf4, 0x00, 0x02, 0x04, 0x64, 0x65, 0x68, 0x2e, 0x00, 0xe4, 0xfb,
+  0x01, 0x65, 0x00, 0xe5, 0x0c, 0x01, 0x03, 0x01, 0x64, 0x00, 0xe5, 0x1b,
+  0x05, 0x6b, 0x73, 0x65, 0x64, 0x6c, 0x00, 0x4c, 0x3f, 0x02, 0x72, 0x65,
+  0x00, 0x8d, 0xab, 0x00, 0x02, 0x02, 0x65, 0x6b, 0x00, 0xc9, 0x4e, 0x04,
+  0x73, 0x65, 0x6b, 0x6c, 0x00, 0xe5, 0x64, 0x01, 0x01, 0x01, 0x64, 0x00,
+  0x52, 0xae, 0x00, 0x02, 0x01, 0x6d, 0x00, 0x0e, 0x15, 0x01, 0x73, 0x00,
+  0xe5, 0x6b, 0x00, 0x02, 0x02, 0x65, 0x6a, 0x00, 0x16, 0x9c, 0x02, 0x6f,
+  0x76, 0x00, 0xe5, 0x72, 0x01, 0x04, 0x01, 0x2e, 0x00, 0x92, 0x28, 0x01,
+  0x62, 0x00, 0x32, 0x5a, 0x01, 0x67, 0x00, 0x0e, 0x15, 0x01, 0x68, 0x00,
+  0x0e, 0x15, 0x00, 0x02, 0x01, 0x72, 0x00, 0x52, 0xae, 0x01, 0x76, 0x00,
+  0x35, 0x0c, 0x00, 0x02, 0x01, 0x65, 0x00, 0xe5, 0x8a, 0x01, 0x6b, 0x00,
+  0x8d, 0xab, 0x00, 0x04, 0x01, 0x64, 0x00, 0x64, 0xb6, 0x01, 0x65, 0x00,
+  0xce, 0xfa, 0x01, 0x72, 0x00, 0xe5, 0x99, 0x03, 0x74, 0x74, 0x61, 0x00,
+  0x75, 0x23, 0x00, 0x04, 0x01, 0x67, 0x00, 0xe5, 0xb6, 0x02, 0x6a, 0x6c,
+  0x00, 0x85, 0x44, 0x01, 0x6f, 0x00, 0x1d, 0x1c, 0x01, 0x72, 0x00, 0xe5,
+  0xc5, 0x00, 0x0c, 0x01, 0x64, 0x00, 0xe5, 0xd1, 0x01, 0x67, 0x00, 0xe5,
+  0xe3, 0x01, 0x69, 0x00, 0x31, 0x6e, 0x01, 0x6b, 0x00, 0xe5, 0xf4, 0x01,
+  0x6c, 0x00, 0xe6, 0x00, 0x02, 0x6d, 0x6d, 0x00, 0xc8, 0x6c, 0x03, 0x6f,
+  0x6a, 0x73, 0x00, 0xe6, 0x0c, 0x02, 0x70, 0x70, 0x00, 0x3c, 0x61, 0x01,
+  0x73, 0x00, 0xe6, 0x1a, 0x01, 0x74, 0x00, 0xe6, 0x2e, 0x03, 0x76, 0x6c,
+  0x79, 0x00, 0xe6, 0x3a, 0x07, 0x79, 0x61, 0x6d, 0x2d, 0x6e, 0x61, 0x6a,
+  0x00, 0xac, 0x09, 0x00, 0x02, 0x01, 0x6f, 0x00, 0x87, 0xcc, 0x01, 0x75,
+  0x00, 0xe6, 0x47, 0x00, 0x02, 0x03, 0x64, 0x6e, 0x61, 0x00, 0xe6, 0x4e,
+  0x01, 0x76, 0x00, 0xe6, 0x55, 0x00, 0x01, 0x01, 0x6b, 0x00, 0x26, 0xd7,
+  0x00, 0x02, 0x01, 0x69, 0x00, 0x16, 0x7b, 0x03, 0x75, 0x72, 0x67, 0x00,
+  0xe6, 0x5c, 0x00, 0x01, 0x01, 0x2d, 0x00, 0xe6, 0x63, 0x00, 0x02, 0x02,
+  0x61, 0x69, 0x00, 0x73, 0x35, 0x02, 0x65, 0x76, 0x00, 0x70, 0xcb, 0x00,
+  0x01, 0x01, 0x61, 0x00, 0x31, 0x6e, 0x00, 0x01, 0x01, 0x72, 0x00, 0x26,
+  0xc4, 0x00, 0x02, 0x01, 0x6f, 0x00, 0x15, 0x5e, 0x01, 0x72, 0x00, 0x94,
+  0xe0, 0x00, 0x01, 0x01, 0x76, 0x00, 0x27, 0x0f, 0x00, 0x01, 0x01, 0x6f,
+  0x00, 0x6d, 0x8e, 0x00, 0x03, 0x01, 0x6d, 0x00, 0x17, 0x57, 0x03, 0x6f,
+  0x75, 0x73, 0x00, 0xe6, 0x6f, 0x02, 0x73, 0x6f, 0x00, 0xac, 0x09, 0x00,
+  0x01, 0x03, 0x73, 0x64, 0x65, 0x00, 0x31, 0x6e, 0x00, 0x03, 0x02, 0x65,
+  0x67, 0x00, 0xc5, 0xec, 0x01, 0x6f, 0x00, 0x84, 0x69, 0x02, 0x79, 0x6f,
+  0x00, 0x27, 0x2c, 0x00, 0x02, 0x01, 0x64, 0x00, 0x94, 0xe0, 0x01, 0x6d,
+  0x00, 0xe6, 0x4e, 0x00, 0x02, 0x02, 0x61, 0x6b, 0x00, 0xe6, 0x7d, 0x01,
+  0x65, 0x00, 0xcd, 0xe0, 0x00, 0x05, 0x01, 0x64, 0x00, 0xe6, 0x84, 0x02,
+  0x6a, 0x74, 0x00, 0x60, 0x40, 0x02, 0x6c, 0x75, 0x00, 0x40, 0xdc, 0x01,
+  0x6d, 0x00, 0x52, 0xae, 0x02, 0x76, 0x73, 0x00, 0x80, 0x55, 0x00, 0x09,
+  0x02, 0x67, 0x6e, 0x00, 0xe6, 0x91, 0x01, 0x69, 0x00, 0x26, 0xde, 0x03,
+  0x6a, 0x6b, 0x6e, 0x00, 0xe6, 0xa0, 0x01, 0x6b, 0x00, 0xe6, 0xa7, 0x02,
+  0x6c, 0x61, 0x00, 0xe6, 0xc1, 0x01, 0x6d, 0x00, 0xe6, 0xcd, 0x01, 0x6e,
+  0x00, 0x3a, 0x76, 0x02, 0x74, 0x73, 0x00, 0xe6, 0xdc, 0x01, 0x79, 0x00,
+  0x41, 0x08, 0x00, 0x01, 0x01, 0x70, 0x00, 0x52, 0xae, 0x00, 0x01, 0x01,
+  0x73, 0x00, 0x36, 0xd0, 0x00, 0x01, 0x01, 0x64, 0x00, 0x42, 0x00, 0x00,
+  0x06, 0x01, 0x64, 0x00, 0x38, 0x94, 0x01, 0x65, 0x00, 0xe6, 0xe8, 0x02,
+  0x6d, 0x65, 0x00, 0xe6, 0xf9, 0x0a, 0x6e, 0x72, 0x6f, 0x68, 0x2d, 0x67,
+  0x6f, 0x2d, 0x65, 0x6a, 0x00, 0xb1, 0x8d, 0x01, 0x73, 0x00, 0xe7, 0x05,
+  0x01, 0x74, 0x00, 0xe7, 0x20, 0x00, 0x02, 0x01, 0x72, 0x00, 0x83, 0x0e,
+  0x01, 0x73, 0x00, 0x5d, 0x25, 0x00, 0x03, 0x02, 0x66, 0x65, 0x00, 0xe7,
+  0x27, 0x01, 0x6d, 0x00, 0x0e, 0x15, 0x01, 0x76, 0x00, 0x0e, 0x15, 0x00,
+  0x02, 0x01, 0x6c, 0x00, 0x5d, 0xb5, 0x05, 0x73, 0x72, 0x65, 0x6b, 0x61,
+  0x00, 0xaf, 0xdc, 0x00, 0x07, 0x02, 0x62, 0x61, 0x00, 0x46, 0x75, 0x01,
+  0x67, 0x00, 0xe7, 0x2e, 0x08, 0x6a, 0x6a, 0x72, 0x61, 0x76, 0x2d, 0x61,
+  0x74, 0x00, 0xe7, 0x3a, 0x02, 0x6c, 0x61, 0x00, 0xe7, 0x41, 0x02, 0x73,
+  0x6f, 0x00, 0x2b, 0x73, 0x01, 0x74, 0x00, 0x27, 0x0f, 0x01, 0x76, 0x00,
+  0xe7, 0x4d, 0x00, 0x04, 0x05, 0x64, 0x6e, 0x61, 0x6c, 0x79, 0x00, 0x32,
+  0x5a, 0x01, 0x66, 0x00, 0x0e, 0x15, 0x01, 0x73, 0x00, 0xe7, 0x59, 0x03,
+  0x76, 0x74, 0x70, 0x00, 0xe2, 0xe6, 0x00, 0x01, 0x01, 0x68, 0x00, 0x67,
+  0x6c, 0x00, 0x02, 0x01, 0x6d, 0x00, 0x26, 0xd7, 0x01, 0x70, 0x00, 0xc6,
+  0xdc, 0x01, 0x03, 0x01, 0x2e, 0x00, 0x92, 0x28, 0x04, 0x65, 0x66, 0x72,
+  0x65, 0x00, 0xe7, 0x6e, 0x01, 0x6f, 0x00, 0x1d, 0x1c, 0x01, 0x04, 0x01,
+  0x2e, 0x00, 0x92, 0x28, 0x01, 0x61, 0x00, 0xcd, 0xe0, 0x01, 0x65, 0x00,
+  0xe7, 0x75, 0x01, 0x6c, 0x00, 0x25, 0x56, 0x00, 0x02, 0x01, 0x62, 0x00,
+  0x0e, 0x15, 0x01, 0x65, 0x00, 0x15, 0x5e, 0x00, 0x02, 0x02, 0x6e, 0x61,
+  0x00, 0xe6, 0x5c, 0x01, 0x76, 0x00, 0x2a, 0x10, 0x00, 0x03, 0x04, 0x64,
+  0x61, 0x65, 0x68, 0x00, 0x6a, 0x8b, 0x03, 0x6a, 0x65, 0x64, 0x00, 0x25,
+  0xc7, 0x06, 0x76, 0x61, 0x72, 0x65, 0x6b, 0x6b, 0x00, 0xb4, 0xa2, 0x00,
+  0x02, 0x09, 0x64, 0x69, 0x61, 0x65, 0x67, 0x61, 0x64, 0x76, 0x6f, 0x00,
+  0x38, 0x2f, 0x02, 0x74, 0x61, 0x00, 0x28, 0xd5, 0x00, 0x04, 0x02, 0x65,
+  0x73, 0x00, 0xe4, 0x1d, 0x01, 0x6e, 0x00, 0x3c, 0xee, 0x02, 0x73, 0x65,
+  0x00, 0x97, 0x0a, 0x01, 0x74, 0x00, 0xe7, 0x20, 0x00, 0x09, 0x01, 0x64,
+  0x00, 0xe7, 0x86, 0x04, 0x67, 0x61, 0x76, 0x74, 0x00, 0xe7, 0x20, 0x01,
+  0x6b, 0x00, 0xe7, 0x98, 0x01, 0x6c, 0x00, 0x5d, 0xb5, 0x01, 0x6d, 0x00,
+  0xa0, 0x17, 0x01, 0x6e, 0x00, 0xe7, 0xa5, 0x01, 0x72, 0x00, 0xe7, 0xb1,
+  0x01, 0x73, 0x00, 0xe7, 0xc7, 0x04, 0x76, 0x72, 0x65, 0x6a, 0x00, 0x31,
+  0x6e, 0x00, 0x0f, 0x01, 0x61, 0x00, 0xe7, 0xe3, 0x04, 0x62, 0x75, 0x6c,
+  0x63, 0x00, 0xe7, 0xf5, 0x02, 0x63, 0x69, 0x00, 0xe7, 0xfc, 0x01, 0x65,
+  0x00, 0xe8, 0x0e, 0x03, 0x67, 0x6e, 0x69, 0x00, 0xe8, 0x33, 0x03, 0x68,
+  0x63, 0x72, 0x00, 0xe8, 0x5e, 0x01, 0x6c, 0x00, 0xe8, 0x65, 0x01, 0x6e,
+  0x00, 0xe8, 0x81, 0x02, 0x6f, 0x67, 0x00, 0x71, 0x59, 0x01, 0x70, 0x00,
+  0xe8, 0x8f, 0x01, 0x72, 0x00, 0xe8, 0xa4, 0x01, 0x73, 0x00, 0xe8, 0xb0,
+  0x01, 0x74, 0x00, 0xe8, 0xd2, 0x01, 0x77, 0x00, 0xe9, 0x04, 0x01, 0x79,
+  0x00, 0xe9, 0x10, 0x00, 0x03, 0x01, 0x61, 0x00, 0x26, 0xd7, 0x01, 0x63,
+  0x00, 0x26, 0xd7, 0x01, 0x70, 0x00, 0x0f, 0xfa, 0x00, 0x02, 0x01, 0x61,
+  0x00, 0x15, 0x5e, 0x01, 0x75, 0x00, 0x16, 0xb8, 0x00, 0x03, 0x01, 0x61,
+  0x00, 0x9b, 0xef, 0x01, 0x63, 0x00, 0x92, 0x7a, 0x01, 0x68, 0x00, 0x85,
+  0x4b, 0x00, 0x02, 0x04, 0x35, 0x78, 0x71, 0x36, 0x00, 0x16, 0xcd, 0x05,
+  0x78, 0x71, 0x69, 0x30, 0x6f, 0x00, 0xb7, 0x6f, 0x00, 0x02, 0x01, 0x61,
+  0x00, 0x26, 0xc4, 0x03, 0x69, 0x68, 0x63, 0x00, 0xe9, 0x28, 0x00, 0x02,
+  0x01, 0x63, 0x00, 0x52, 0xae, 0x01, 0x65, 0x00, 0x1e, 0x60, 0x00, 0x02,
+  0x02, 0x61, 0x73, 0x00, 0xe9, 0x2f, 0x03, 0x69, 0x68, 0x73, 0x00, 0xe9,
+  0x36, 0x00, 0x02, 0x03, 0x61, 0x73, 0x6f, 0x00, 0xe9, 0x3d, 0x02, 0x6f,
+  0x75, 0x00, 0xe9, 0x44, 0x00, 0x04, 0x01, 0x61, 0x00, 0xe9, 0x55, 0x03,
+  0x69, 0x68, 0x73, 0x00, 0xe9, 0x6d, 0x03, 0x6e, 0x75, 0x67, 0x00, 0xe9,
+  0x7a, 0x01, 0x72, 0x00, 0x69, 0x7a, 0x00, 0x02, 0x02, 0x69, 0x62, 0x00,
+  0xe4, 0x57, 0x01, 0x6e, 0x00, 0x58, 0xaf, 0x00, 0x02, 0x01, 0x6e, 0x00,
+  0xe9, 0x81, 0x02, 0x72, 0x69, 0x00, 0xe9, 0x88, 0x00, 0x02, 0x02, 0x61,
+  0x67, 0x00, 0xe9, 0x8f, 0x01, 0x69, 0x00, 0xe9, 0xa0, 0x00, 0x03, 0x02,
+  0x67, 0x61, 0x00, 0xe9, 0xac, 0x05, 0x6b, 0x69, 0x68, 0x73, 0x69, 0x00,
+  0xe9, 0xba, 0x04, 0x6e, 0x69, 0x6b, 0x6f, 0x00, 0xe9, 0xc1, 0x00, 0x02,
+  0x04, 0x6f, 0x67, 0x61, 0x6e, 0x00, 0xe9, 0xc8, 0x01, 0x70, 0x00, 0x0e,
+  0x15, 0x00, 0x01, 0x02, 0x74, 0x72, 0x00, 0x13, 0xaa, 0x00, 0x01, 0x03,
+  0x73, 0x71, 0x6c, 0x00, 0x26, 0x01, 0x00, 0x02, 0x04, 0x32, 0x30, 0x78,
+  0x62, 0x00, 0x94, 0x74, 0x04, 0x34, 0x30, 0x73, 0x6a, 0x00, 0x13, 0xaa,
+  0x00, 0x02, 0x02, 0x38, 0x37, 0x00, 0x7f, 0x75, 0x01, 0x70, 0x00, 0x7f,
+  0x75, 0x00, 0x01, 0x02, 0x74, 0x69, 0x00, 0x0b, 0xb4, 0x01, 0x01, 0x06,
+  0x74, 0x66, 0x61, 0x72, 0x63, 0x64, 0x00, 0x22, 0x1f, 0x00, 0x02, 0x04,
+  0x65, 0x69, 0x72, 0x66, 0x00, 0xe9, 0xd3, 0x01, 0x6f, 0x00, 0x12, 0x22,
+  0x00, 0x02, 0x04, 0x31, 0x61, 0x34, 0x6d, 0x00, 0x5f, 0xb6, 0x04, 0x39,
+  0x6e, 0x79, 0x37, 0x00, 0x0b, 0x7d, 0x00, 0x01, 0x01, 0x6b, 0x00, 0xe9,
+  0xc8, 0x00, 0x02, 0x03, 0x62, 0x6d, 0x6f, 0x00, 0x28, 0x66, 0x01, 0x6d,
+  0x00, 0xe9, 0xe0, 0x01, 0x01, 0x01, 0x2e, 0x00, 0xe9, 0xe7, 0x01, 0x03,
+  0x01, 0x2e, 0x00, 0xea, 0x07, 0x05, 0x61, 0x6d, 0x69, 0x68, 0x73, 0x00,
+  0xea, 0x1c, 0x01, 0x6e, 0x00, 0x69, 0x7a, 0x00, 0x04, 0x03, 0x61, 0x77,
+  0x69, 0x00, 0xea, 0x23, 0x02, 0x69, 0x73, 0x00, 0xb8, 0x01, 0x02, 0x73,
+  0x61, 0x00, 0x5d, 0x25, 0x03, 0x74, 0x6f, 0x63, 0x00, 0x2f, 0x47, 0x00,
+  0x01, 0x02, 0x79, 0x62, 0x00, 0x53, 0x44, 0x00, 0x01, 0x02, 0x73, 0x69,
+  0x00, 0x58, 0x1e, 0x00, 0x01, 0x01, 0x73, 0x00, 0xaf, 0xe3, 0x00, 0x01,
+  0x01, 0x75, 0x00, 0x68, 0xf2, 0x00, 0x01, 0x01, 0x73, 0x00, 0xe9, 0xc8,
+  0x00, 0x02, 0x04, 0x61, 0x79, 0x69, 0x6d, 0x00, 0xea, 0x2a, 0x05, 0x69,
+  0x68, 0x63, 0x6f, 0x74, 0x00, 0xea, 0x31, 0x00, 0x02, 0x01, 0x63, 0x00,
+  0xea, 0x38, 0x01, 0x73, 0x00, 0xea, 0x50, 0x00, 0x03, 0x04, 0x72, 0x61,
+  0x62, 0x69, 0x00, 0xea, 0x61, 0x02, 0x73, 0x61, 0x00, 0xea, 0x68, 0x05,
+  0x7a, 0x61, 0x79, 0x69, 0x6d, 0x00, 0xea, 0x77, 0x00, 0x03, 0x01, 0x63,
+  0x00, 0x69, 0x7a, 0x03, 0x6d, 0x6f, 0x61, 0x00, 0xea, 0x7e, 0x04, 0x74,
+  0x74, 0x6f, 0x74, 0x00, 0xea, 0x85, 0x01, 0x01, 0x01, 0x2e, 0x00, 0xea,
+  0x8c, 0x00, 0x02, 0x02, 0x33, 0x71, 0x00, 0xb6, 0xad, 0x02, 0x79, 0x74,
+  0x00, 0xb9, 0x47, 0x00, 0x03, 0x01, 0x67, 0x00, 0x91, 0xf4, 0x01, 0x68,
+  0x00, 0x16, 0x7b, 0x02, 0x73, 0x65, 0x00, 0xea, 0xaf, 0x00, 0x01, 0x02,
+  0x69, 0x6c, 0x00, 0x46, 0x75, 0x00, 0x01, 0x01, 0x61, 0x00, 0x98, 0x89,
+  0x00, 0x01, 0x01, 0x67, 0x00, 0x1d, 0x34, 0x00, 0x02, 0x04, 0x65, 0x62,
+  0x79, 0x6c, 0x00, 0x94, 0x7b, 0x01, 0x69, 0x00, 0xea, 0xb6, 0x00, 0x02,
+  0x01, 0x72, 0x00, 0x80, 0x9d, 0x01, 0x73, 0x00, 0x85, 0x18, 0x01, 0x01,
+  0x01, 0x2e, 0x00, 0xea, 0xc4, 0x01, 0x02, 0x01, 0x69, 0x00, 0x98, 0x97,
+  0x03, 0x6f, 0x79, 0x68, 0x00, 0xea, 0xe4, 0x01, 0x01, 0x01, 0x2e, 0x00,
+  0xea, 0xeb, 0x00, 0x03, 0x01, 0x62, 0x00, 0x0e, 0x15, 0x01, 0x6d, 0x00,
+  0x0e, 0x15, 0x01, 0x70, 0x00, 0x42, 0x43, 0x00, 0x02, 0x05, 0x6d, 0x61,
+  0x6d, 0x75, 0x6b, 0x00, 0xeb, 0x0b, 0x02, 0x79, 0x6b, 0x00, 0xeb, 0x12,
+  0x01, 0x01, 0x01, 0x2e, 0x00, 0xeb, 0x19, 0x00, 0x01, 0x01, 0x65, 0x00,
+  0x46, 0x83, 0x00, 0x03, 0x02, 0x68, 0x73, 0x00, 0xeb, 0x34, 0x01, 0x70,
+  0x00, 0xeb, 0x46, 0x02, 0x72, 0x64, 0x00, 0xeb, 0x53, 0x00, 0x05, 0x01,
+  0x64, 0x00, 0xeb, 0x5f, 0x01, 0x68, 0x00, 0x0e, 0x15, 0x01, 0x69, 0x00,
+  0x84, 0x69, 0x02, 0x70, 0x70, 0x00, 0xeb, 0x6b, 0x01, 0x74, 0x00, 0xeb,
+  0x7c, 0x00, 0x02, 0x01, 0x69, 0x00, 0x46, 0x83, 0x01, 0x6f, 0x00, 0x41,
+  0x08, 0x00, 0x03, 0x01, 0x62, 0x00, 0xeb, 0x88, 0x02, 0x72, 0x75, 0x00,
+  0xeb, 0x8f, 0x01, 0x73, 0x00, 0x72, 0x66, 0x00, 0x02, 0x04, 0x63, 0x79,
+  0x73, 0x73, 0x00, 0x5d, 0xae, 0x03, 0x6f, 0x62, 0x67, 0x00, 0x29, 0xae,
+  0x00, 0x02, 0x01, 0x72, 0x00, 0x6b, 0xde, 0x02, 0x76, 0x6c, 0x00, 0x4b,
+  0x25, 0x00, 0x01, 0x01, 0x72, 0x00, 0xeb, 0x96, 0x00, 0x02, 0x01, 0x62,
+  0x00, 0x0e, 0x15, 0x02, 0x6f, 0x6c, 0x00, 0xeb, 0x9d, 0x01, 0x01, 0x01,
+  0x2e, 0x00, 0xeb, 0xa4, 0x00, 0x02, 0x01, 0x63, 0x00, 0x0e, 0x15, 0x07,
+  0x73, 0x75, 0x79, 0x6b, 0x61, 0x74, 0x69, 0x00, 0xb7, 0x12, 0x00, 0x01,
+  0x01, 0x6e, 0x00, 0x46, 0x7c, 0x00, 0x01, 0x01, 0x6c, 0x00, 0x0b, 0x7d,
+  0x00, 0x01, 0x01, 0x6e, 0x00, 0x93, 0x37, 0x00, 0x02, 0x01, 0x6f, 0x00,
+  0x21, 0x6d, 0x01, 0x72, 0x00, 0x4c, 0x3f, 0x00, 0x02, 0x01, 0x69, 0x00,
+  0x21, 0x6d, 0x01, 0x6f, 0x00, 0x84, 0x69, 0x00, 0x02, 0x01, 0x61, 0x00,
+  0x0e, 0x15, 0x01, 0x75, 0x00, 0x21, 0x6d, 0x00, 0x01, 0x01, 0x6a, 0x00,
+  0x67, 0xba, 0x00, 0x03, 0x01, 0x65, 0x00, 0x60, 0x2d, 0x04, 0x78, 0x69,
+  0x6c, 0x70, 0x00, 0x32, 0x5a, 0x01, 0x79, 0x00, 0x5c, 0xb0, 0x00, 0x01,
+  0x01, 0x61, 0x00, 0x85, 0xc5, 0x00, 0x01, 0x01, 0x75, 0x00, 0xcc, 0x28,
+  0x01, 0x01, 0x06, 0x2e, 0x6b, 0x6e, 0x69, 0x6c, 0x65, 0x00, 0xeb, 0xc5,
+  0x00, 0x02, 0x01, 0x69, 0x00, 0xeb, 0xce, 0x02, 0x6f, 0x6b, 0x00, 0xeb,
+  0xd5, 0x00, 0x01, 0x01, 0x66, 0x00, 0x9b, 0x99, 0x00, 0x01, 0x01, 0x73,
+  0x00, 0x5d, 0xb5, 0x00, 0x01, 0x02, 0x6f, 0x6e, 0x00, 0x14, 0x4a, 0x00,
+  0x01, 0x03, 0x61, 0x70, 0x79, 0x00, 0xeb, 0xdc, 0x01, 0x01, 0x01, 0x2e,
+  0x00, 0x26, 0xd7, 0x00, 0x02, 0x01, 0x6d, 0x00, 0x93, 0x54, 0x04, 0x70,
+  0x6f, 0x6c, 0x65, 0x00, 0xd2, 0xff, 0x00, 0x02, 0x01, 0x62, 0x00, 0xdf,
+  0xba, 0x01, 0x6c, 0x00, 0xeb, 0xe3, 0x00, 0x01, 0x01, 0x6e, 0x00, 0x25,
+  0x56, 0x00, 0x01, 0x01, 0x74, 0x00, 0x2b, 0x73, 0x00, 0x02, 0x01, 0x62,
+  0x00, 0x0e, 0x15, 0x01, 0x6e, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x01, 0x61,
+  0x00, 0xeb, 0xec, 0x04, 0x69, 0x74, 0x69, 0x72, 0x00, 0x5d, 0x09, 0x00,
+  0x01, 0x01, 0x6f, 0x00, 0x1c, 0x65, 0x00, 0x01, 0x01, 0x61, 0x00, 0x30,
+  0x72, 0x00, 0x01, 0x01, 0x69, 0x00, 0x4c, 0xde, 0x00, 0x02, 0x03, 0x6e,
+  0x61, 0x69, 0x00, 0x58, 0xaf, 0x03, 0x72, 0x61, 0x6d, 0x00, 0xde, 0x52,
+  0x00, 0x02, 0x01, 0x65, 0x00, 0x42, 0x3c, 0x02, 0x69, 0x72, 0x00, 0xeb,
+  0xf9, 0x00, 0x03, 0x01, 0x61, 0x00, 0xec, 0x00, 0x01, 0x69, 0x00, 0xec,
+  0x07, 0x02, 0x6d, 0x61, 0x00, 0x0d, 0xfc, 0x00, 0x02, 0x01, 0x66, 0x00,
+  0x0e, 0x15, 0x01, 0x69, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x69, 0x00,
+  0xcc, 0xc8, 0x00, 0x01, 0x01, 0x74, 0x00, 0x38, 0x94, 0x00, 0x02, 0x01,
+  0x65, 0x00, 0x0e, 0x15, 0x01, 0x69, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x01,
+  0x6c, 0x00, 0xbb, 0x84, 0x01, 0x73, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x01,
+  0x73, 0x00, 0x0e, 0x15, 0x01, 0x7a, 0x00, 0x0e, 0x15, 0x00, 0x03, 0x01,
+  0x63, 0x00, 0x0e, 0x15, 0x01, 0x65, 0x00, 0x0e, 0x15, 0x01, 0x6f, 0x00,
+  0x0e, 0x15, 0x01, 0x03, 0x01, 0x62, 0x00, 0x0e, 0x15, 0x01, 0x66, 0x00,
+  0x0e, 0x15, 0x01, 0x76, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x61, 0x00,
+  0x71, 0x52, 0x00, 0x01, 0x01, 0x74, 0x00, 0x27, 0x25, 0x00, 0x02, 0x01,
+  0x63, 0x00, 0x0e, 0x15, 0x02, 0x65, 0x75, 0x00, 0x51, 0x91, 0x00, 0x02,
+  0x01, 0x61, 0x00, 0x0f, 0x6f, 0x01, 0x72, 0x00, 0x3f, 0xd8, 0x00, 0x02,
+  0x02, 0x67, 0x61, 0x00, 0x4f, 0xea, 0x01, 0x6c, 0x00, 0x73, 0x35, 0x00,
+  0x02, 0x01, 0x63, 0x00, 0xec, 0x0e, 0x01, 0x6e, 0x00, 0x14, 0x4a, 0x00,
+  0x03, 0x01, 0x65, 0x00, 0x0e, 0x15, 0x04, 0x6e, 0x61, 0x72, 0x62, 0x00,
+  0xec, 0x15, 0x01, 0x73, 0x00, 0xec, 0x1c, 0x00, 0x02, 0x01, 0x6f, 0x00,
+  0x0e, 0x15, 0x06, 0x72, 0x61, 0x6e, 0x72, 0x65, 0x62, 0x00, 0xb9, 0xf3,
+  0x00, 0x02, 0x01, 0x67, 0x00, 0x0e, 0x15, 0x01, 0x74, 0x00, 0x0e, 0x15,
+  0x00, 0x04, 0x01, 0x62, 0x00, 0x0e, 0x15, 0x01, 0x64, 0x00, 0x67, 0x6c,
+  0x01, 0x65, 0x00, 0xec, 0x00, 0x01, 0x72, 0x00, 0x0e, 0x15, 0x00, 0x02,
+  0x01, 0x61, 0x00, 0x0e, 0x15, 0x03, 0x65, 0x72, 0x70, 0x00, 0xec, 0x15,
+  0x01, 0x02, 0x01, 0x65, 0x00, 0x0e, 0x15, 0x01, 0x74, 0x00, 0x0e, 0x15,
+  0x00, 0x02, 0x01, 0x64, 0x00, 0xec, 0x23, 0x01, 0x6a, 0x00, 0x0e, 0x15,
+  0x00, 0x03, 0x02, 0x69, 0x78, 0x00, 0x42, 0x43, 0x01, 0x6d, 0x00, 0xdb,
+  0x8a, 0x01, 0x6e, 0x00, 0xba, 0x43, 0x00, 0x03, 0x01, 0x61, 0x00, 0xc5,
+  0x99, 0x01, 0x6a, 0x00, 0x0e, 0x15, 0x01, 0x6d, 0x00, 0x0e, 0x15, 0x00,
+  0x03, 0x01, 0x64, 0x00, 0x0e, 0x15, 0x01, 0x6e, 0x00, 0x0e, 0x15, 0x01,
+  0x76, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x01, 0x66, 0x00, 0x0e, 0x15, 0x01,
+  0x6e, 0x00, 0x0e, 0x15, 0x01, 0x01, 0x01, 0x2e, 0x00, 0xec, 0x2b, 0x00,
+  0x02, 0x01, 0x63, 0x00, 0x0e, 0x15, 0x01, 0x66, 0x00, 0x0e, 0x15, 0x00,
+  0x01, 0x01, 0x67, 0x00, 0x69, 0x73, 0x00, 0x01, 0x01, 0x63, 0x00, 0x27,
+  0x01, 0x00, 0x01, 0x01, 0x73, 0x00, 0x6a, 0xab, 0x00, 0x02, 0x0c, 0x69,
+  0x74, 0x73, 0x75, 0x6a, 0x2d, 0x72, 0x65, 0x69, 0x73, 0x73, 0x69, 0x00,
+  0x85, 0x1f, 0x0b, 0x6e, 0x61, 0x72, 0x66, 0x2d, 0x6e, 0x65, 0x2d, 0x73,
+  0x65, 0x74, 0x00, 0xec, 0x7d, 0x00, 0x01, 0x01, 0x6d, 0x00, 0xec, 0x91,
+  0x00, 0x04, 0x0d, 0x6c, 0x62, 0x61, 0x74, 0x70, 0x6d, 0x6f, 0x63, 0x2d,
+  0x73, 0x74, 0x72, 0x65, 0x00, 0x2c, 0x34, 0x01, 0x72, 0x00, 0xa0, 0x71,
+  0x01, 0x74, 0x00, 0xec, 0x7d, 0x01, 0x75, 0x00, 0xcc, 0x46, 0x00, 0x02,
+  0x02, 0x2d, 0x78, 0x00, 0xec, 0x98, 0x01, 0x78, 0x00, 0xec, 0x98, 0x00,
+  0x02, 0x03, 0x6f, 0x72, 0x2d, 0x00, 0x69, 0x73, 0x01, 0x70, 0x00, 0xc6,
+  0xdc, 0x00, 0x02, 0x0a, 0x65, 0x70, 0x78, 0x65, 0x2d, 0x65, 0x72, 0x74,
+  0x65, 0x6d, 0x00, 0x2f, 0xb6, 0x02, 0x6f, 0x70, 0x00, 0xe7, 0xf5, 0x00,
+  0x01, 0x02, 0x73, 0x65, 0x00, 0xec, 0xa4, 0x00, 0x01, 0x01, 0x79, 0x00,
+  0x0c, 0x1d, 0x00, 0x02, 0x01, 0x6f, 0x00, 0x84, 0x1d, 0x01, 0x75, 0x00,
+  0x46, 0x83, 0x00, 0x02, 0x01, 0x6c, 0x00, 0x5d, 0xbc, 0x01, 0x75, 0x00,
+  0x15, 0x5e, 0x00, 0x02, 0x01, 0x65, 0x00, 0xec, 0xad, 0x03, 0x77, 0x67,
+  0x6e, 0x00, 0x40, 0xdc, 0x00, 0x02, 0x01, 0x65, 0x00, 0x16, 0xb8, 0x04,
+  0x67, 0x6e, 0x61, 0x77, 0x00, 0x0c, 0x1d, 0x00, 0x02, 0x01, 0x62, 0x00,
+  0x0e, 0x15, 0x01, 0x74, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x02, 0x72, 0x72,
+  0x00, 0x84, 0xae, 0x00, 0x01, 0x01, 0x69, 0x00, 0xeb, 0xce, 0x00, 0x01,
+  0x01, 0x6f, 0x00, 0xec, 0xba, 0x01, 0x01, 0x04, 0x2e, 0x37, 0x33, 0x33,
+  0x00, 0xc7, 0xf8, 0x00, 0x03, 0x04, 0x65, 0x63, 0x61, 0x70, 0x00, 0xec,
+  0xc1, 0x03, 0x73, 0x6e, 0x64, 0x00, 0xd2, 0xd5, 0x01, 0x79, 0x00, 0x69,
+  0xf3, 0x00, 0x01, 0x01, 0x75, 0x00, 0x97, 0x5e, 0x00, 0x01, 0x02, 0x75,
+  0x64, 0x00, 0x67, 0x81, 0x01, 0x01, 0x04, 0x2e, 0x72, 0x65, 0x68, 0x00,
+  0xec, 0xc8, 0x00, 0x01, 0x01, 0x63, 0x00, 0x92, 0x7a, 0x00, 0x02, 0x01,
+  0x72, 0x00, 0xb9, 0xfa, 0x03, 0x73, 0x65, 0x76, 0x00, 0x66, 0x03, 0x01,
+  0x01, 0x01, 0x2e, 0x00, 0xec, 0xcf, 0x01, 0x01, 0x01, 0x2e, 0x00, 0xec,
+  0xde, 0x00, 0x02, 0x01, 0x66, 0x00, 0x0e, 0x15, 0x08, 0x6c, 0x61, 0x63,
+  0x73, 0x6e, 0x65, 0x2e, 0x78, 0x00, 0x44, 0xf1, 0x01, 0x01, 0x01, 0x2e,
+  0x00, 0xec, 0xf1, 0x00, 0x02, 0x01, 0x6f, 0x00, 0x8e, 0xb4, 0x01, 0x72,
+  0x00, 0x1e, 0x60, 0x00, 0x02, 0x01, 0x64, 0x00, 0x27, 0x01, 0x01, 0x66,
+  0x00, 0xec, 0xfd, 0x01, 0x01, 0x01, 0x2e, 0x00, 0xed, 0x04, 0x00, 0x01,
+  0x02, 0x74, 0x6e, 0x00, 0xed, 0x3c, 0x00, 0x01, 0x02, 0x65, 0x74, 0x00,
+  0x7f, 0xe0, 0x00, 0x02, 0x01, 0x64, 0x00, 0xed, 0x43, 0x01, 0x75, 0x00,
+  0x99, 0x6d, 0x00, 0x03, 0x01, 0x32, 0x00, 0x60, 0x26, 0x01, 0x62, 0x00,
+  0x17, 0xbd, 0x01, 0x63, 0x00, 0x0f, 0xfa, 0x01, 0x01, 0x02, 0x2e, 0x63,
+  0x00, 0x0f, 0xfa, 0x00, 0x01, 0x01, 0x2d, 0x00, 0x39, 0x21, 0x00, 0x01,
+  0x01, 0x64, 0x00, 0x75, 0x7e, 0x00, 0x01, 0x01, 0x65, 0x00, 0x74, 0xc8,
+  0x00, 0x01, 0x03, 0x65, 0x72, 0x75, 0x00, 0x3d, 0xe0, 0x01, 0x01, 0x05,
+  0x73, 0x74, 0x72, 0x6f, 0x2e, 0x00, 0xed, 0x4a, 0x00, 0x02, 0x02, 0x6e,
+  0x69, 0x00, 0x14, 0x4a, 0x01, 0x78, 0x00, 0xed, 0x5b, 0x00, 0x02, 0x05,
+  0x37, 0x6e, 0x64, 0x63, 0x2e, 0x00, 0x1d, 0x1c, 0x01, 0x65, 0x00, 0x96,
+  0x04, 0x00, 0x05, 0x01, 0x6c, 0x00, 0xed, 0x62, 0x01, 0x6d, 0x00, 0xaa,
+  0x2a, 0x01, 0x72, 0x00, 0xc9, 0x81, 0x07, 0x74, 0x61, 0x64, 0x73, 0x79,
+  0x61, 0x77, 0x00, 0x26, 0x53, 0x01, 0x7a, 0x00, 0x0e, 0x15, 0x00, 0x03,
+  0x01, 0x62, 0x00, 0x98, 0x9e, 0x01, 0x67, 0x00, 0x0e, 0x15, 0x07, 0x6c,
+  0x79, 0x6c, 0x74, 0x73, 0x61, 0x66, 0x00, 0xed, 0x6e, 0x00, 0x02, 0x01,
+  0x69, 0x00, 0xed, 0x76, 0x05, 0x70, 0x61, 0x69, 0x64, 0x65, 0x00, 0xc6,
+  0x5e, 0x00, 0x05, 0x01, 0x65, 0x00, 0xed, 0x9a, 0x01, 0x68, 0x00, 0xed,
+  0xa6, 0x10, 0x69, 0x72, 0x67, 0x65, 0x76, 0x69, 0x73, 0x73, 0x61, 0x6d,
+  0x2e, 0x73, 0x61, 0x61, 0x70, 0x2e, 0x00, 0xed, 0xad, 0x07, 0x6e, 0x61,
+  0x62, 0x2d, 0x65, 0x68, 0x74, 0x00, 0x93, 0x7c, 0x04, 0x75, 0x6f, 0x6c,
+  0x63, 0x00, 0xed, 0xbb, 0x00, 0x0a, 0x01, 0x63, 0x00, 0xed, 0xda, 0x02,
+  0x67, 0x64, 0x00, 0xed, 0xf5, 0x07, 0x68, 0x74, 0x2d, 0x6e, 0x6f, 0x2d,
+  0x65, 0x00, 0xc6, 0x83, 0x01, 0x6c, 0x00, 0xee, 0x02, 0x01, 0x6d, 0x00,
+  0xee, 0x14, 0x01, 0x6e, 0x00, 0xee, 0x36, 0x05, 0x72, 0x65, 0x68, 0x75,
+  0x72, 0x00, 0x65, 0xfc, 0x01, 0x73, 0x00, 0xee, 0x46, 0x02, 0x74, 0x69,
+  0x00, 0xee, 0x4d, 0x03, 0x7a, 0x61, 0x6d, 0x00, 0xee, 0x5c, 0x00, 0x03,
+  0x03, 0x61, 0x65, 0x6c, 0x00, 0xee, 0x68, 0x04, 0x63, 0x72, 0x73, 0x2e,
+  0x00, 0xee, 0x70, 0x01, 0x65, 0x00, 0xca, 0x50, 0x00, 0x02, 0x02, 0x6e,
+  0x69, 0x00, 0xee, 0x7c, 0x02, 0x6f, 0x6c, 0x00, 0xd4, 0x30, 0x00, 0x02,
+  0x04, 0x67, 0x6e, 0x69, 0x74, 0x00, 0xee, 0xa1, 0x04, 0x73, 0x61, 0x61,
+  0x70, 0x00, 0xc6, 0x22, 0x00, 0x01, 0x03, 0x61, 0x6d, 0x61, 0x00, 0xb2,
+  0xfd, 0x00, 0x03, 0x05, 0x63, 0x61, 0x74, 0x73, 0x76, 0x00, 0xee, 0xaa,
+  0x01, 0x65, 0x00, 0xca, 0x57, 0x01, 0x75, 0x00, 0x0e, 0x15, 0x00, 0x04,
+  0x02, 0x61, 0x63, 0x00, 0xee, 0xb1, 0x01, 0x69, 0x00, 0x5f, 0xef, 0x03,
+  0x6d, 0x65, 0x74, 0x00, 0x6a, 0xcc, 0x01, 0x73, 0x00, 0xee, 0xb9, 0x00,
+  0x02, 0x02, 0x61, 0x63, 0x00, 0xee, 0xc8, 0x05, 0x75, 0x72, 0x6f, 0x66,
+  0x6e, 0x00, 0x96, 0xe0, 0x00, 0x04, 0x01, 0x61, 0x00, 0xee, 0xd4, 0x06,
+  0x64, 0x63, 0x64, 0x75, 0x61, 0x62, 0x00, 0xc6, 0x6c, 0x01, 0x69, 0x00,
+  0xee, 0xe0, 0x01, 0x70, 0x00, 0xca, 0xaa, 0x00, 0x05, 0x01, 0x63, 0x00,
+  0xa2, 0x1b, 0x02, 0x64, 0x75, 0x00, 0x9b, 0x75, 0x01, 0x6a, 0x00, 0xca,
+  0xb1, 0x01, 0x72, 0x00, 0x63, 0x99, 0x01, 0x74, 0x00, 0xd3, 0x06, 0x00,
+  0x07, 0x01, 0x69, 0x00, 0xee, 0xe7, 0x01, 0x6a, 0x00, 0x0e, 0x15, 0x09,
+  0x6d, 0x61, 0x63, 0x2d, 0x64, 0x6e, 0x61, 0x62, 0x2d, 0x00, 0x28, 0xce,
+  0x01, 0x6f, 0x00, 0xee, 0xfd, 0x02, 0x70, 0x61, 0x00, 0xef, 0x0f, 0x03,
+  0x74, 0x66, 0x65, 0x00, 0xef, 0x1b, 0x01, 0x75, 0x00, 0x69, 0xb6, 0x00,
+  0x02, 0x01, 0x65, 0x00, 0xef, 0x27, 0x0a, 0x76, 0x64, 0x73, 0x6c, 0x65,
+  0x6e, 0x6e, 0x61, 0x68, 0x63, 0x00, 0xef, 0x3d, 0x00, 0x09, 0x01, 0x61,
+  0x00, 0xcb, 0x07, 0x01, 0x62, 0x00, 0xd4, 0x30, 0x01, 0x64, 0x00, 0xd4,
+  0x4b, 0x01, 0x65, 0x00, 0xef, 0x44, 0x01, 0x6b, 0x00, 0xef, 0x5d, 0x01,
+  0x6e, 0x00, 0xef, 0x6d, 0x0e, 0x70, 0x70, 0x61, 0x63, 0x69, 0x74, 0x61,
+  0x74, 0x73, 0x65, 0x72, 0x75, 0x7a, 0x61, 0x00, 0xef, 0x7e, 0x01, 0x73,
+  0x00, 0xef, 0x85, 0x01, 0x74, 0x00, 0x0e, 0x15, 0x00, 0x08, 0x02, 0x61,
+  0x64, 0x00, 0xef, 0x94, 0x02, 0x63, 0x65, 0x00, 0xef, 0x9b, 0x01, 0x65,
+  0x00, 0xef, 0xb6, 0x07, 0x66, 0x61, 0x72, 0x63, 0x65, 0x6e, 0x69, 0x00,
+  0xa0, 0x88, 0x02, 0x69, 0x2d, 0x00, 0xef, 0xc7, 0x01, 0x6e, 0x00, 0xef,
+  0xd4, 0x06, 0x72, 0x30, 0x70, 0x33, 0x6c, 0x33, 0x00, 0x16, 0x7b, 0x01,
+  0x73, 0x00, 0xef, 0xe4, 0x00, 0x03, 0x01, 0x68, 0x00, 0x0e, 0x15, 0x01,
+  0x6e, 0x00, 0xaa, 0x23, 0x01, 0x72, 0x00, 0xef, 0xf4, 0x00, 0x01, 0x02,
+  0x6e, 0x64, 0x00, 0x0f, 0xfa, 0x00, 0x04, 0x01, 0x69, 0x00, 0xcc, 0x21,
+  0x01, 0x73, 0x00, 0x74, 0xc8, 0x06, 0x74, 0x73, 0x61, 0x6c, 0x65, 0x2e,
+  0x00, 0xf0, 0x00, 0x01, 0x75, 0x00, 0x98, 0x18, 0x00, 0x06, 0x02, 0x61,
+  0x77, 0x00, 0xf0, 0x11, 0x01, 0x65, 0x00, 0xf0, 0x1d, 0x09, 0x66, 0x66,
+  0x69, 0x6a, 0x64, 0x75, 0x6f, 0x6c, 0x63, 0x00, 0xf0, 0x24, 0x06, 0x6c,
+  0x74, 0x73, 0x61, 0x66, 0x2e, 0x00, 0xf0, 0x2b, 0x01, 0x6e, 0x00, 0xf0,
+  0x4a, 0x01, 0x73, 0x00, 0x51, 0x91, 0x00, 0x02, 0x01, 0x61, 0x00, 0xa2,
+  0x1b, 0x03, 0x74, 0x69, 0x72, 0x00, 0xc6, 0xb2, 0x00, 0x02, 0x01, 0x72,
+  0x00, 0x69, 0x7a, 0x01, 0x73, 0x00, 0x26, 0xd7, 0x00, 0x01, 0x03, 0x65,
+  0x6c, 0x6c, 0x00, 0xf0, 0x57, 0x00, 0x02, 0x08, 0x63, 0x2d, 0x61, 0x6e,
+  0x65, 0x73, 0x65, 0x63, 0x00, 0xf0, 0x5e, 0x06, 0x69, 0x2d, 0x6c, 0x72,
+  0x6f, 0x66, 0x00, 0xf0, 0x67, 0x01, 0x01, 0x01, 0x63, 0x00, 0x12, 0xe2,
+  0x00, 0x0b, 0x03, 0x62, 0x6c, 0x6f, 0x00, 0xf0, 0x72, 0x02, 0x63, 0x73,
+  0x00, 0xf0, 0x7f, 0x01, 0x64, 0x00, 0xc3, 0xc4, 0x01, 0x67, 0x00, 0xf0,
+  0x86, 0x01, 0x6c, 0x00, 0xf0, 0x92, 0x01, 0x6e, 0x00, 0xf0, 0xa5, 0x03,
+  0x6f, 0x74, 0x73, 0x00, 0x29, 0xae, 0x01, 0x72, 0x00, 0xf0, 0xbf, 0x06,
+  0x74, 0x6e, 0x65, 0x6c, 0x61, 0x76, 0x00, 0xf0, 0xd7, 0x01, 0x76, 0x00,
+  0x4c, 0x7f, 0x01, 0x7a, 0x00, 0xf0, 0xe4, 0x00, 0x02, 0x04, 0x69, 0x75,
+  0x71, 0x61, 0x00, 0xf0, 0xf0, 0x01, 0x6c, 0x00, 0xce, 0xcd, 0x00, 0x02,
+  0x01, 0x6f, 0x00, 0x1d, 0x1c, 0x01, 0x72, 0x00, 0x4c, 0x7f, 0x01, 0x06,
+  0x02, 0x61, 0x63, 0x00, 0x26, 0x5a, 0x01, 0x65, 0x00, 0xf0, 0xf7, 0x01,
+  0x67, 0x00, 0xf1, 0x0a, 0x01, 0x69, 0x00, 0xf1, 0x1e, 0x02, 0x6e, 0x65,
+  0x00, 0xf1, 0x2a, 0x01, 0x6f, 0x00, 0xf1, 0x31, 0x00, 0x01, 0x01, 0x6e,
+  0x00, 0x64, 0x65, 0x01, 0x03, 0x01, 0x61, 0x00, 0xf1, 0x47, 0x01, 0x65,
+  0x00, 0xe7, 0x3a, 0x07, 0x74, 0x73, 0x61, 0x69, 0x6c, 0x67, 0x6f, 0x00,
+  0xf1, 0x59, 0x01, 0x03, 0x01, 0x69, 0x00, 0x0f, 0x68, 0x03, 0x73, 0x61,
+  0x6d, 0x00, 0xf1, 0x66, 0x01, 0x75, 0x00, 0xf1, 0x73, 0x01, 0x04, 0x01,
+  0x61, 0x00, 0xf1, 0x81, 0x02, 0x72, 0x65, 0x00, 0xc4, 0xb6, 0x03, 0x73,
+  0x6f, 0x61, 0x00, 0xf1, 0x90, 0x02, 0x74, 0x65, 0x00, 0xf1, 0xa1, 0x00,
+  0x01, 0x01, 0x64, 0x00, 0x4c, 0x7f, 0x01, 0x01, 0x01, 0x6f, 0x00, 0xf1,
+  0xb5, 0x00, 0x03, 0x04, 0x61, 0x69, 0x72, 0x62, 0x00, 0xf1, 0xc6, 0x01,
+  0x65, 0x00, 0xf1, 0xd8, 0x01, 0x6f, 0x00, 0x12, 0x22, 0x00, 0x03, 0x01,
+  0x32, 0x00, 0xf1, 0xe9, 0x01, 0x34, 0x00, 0x7b, 0xf1, 0x01, 0x36, 0x00,
+  0xc7, 0xf8, 0x00, 0x01, 0x04, 0x64, 0x73, 0x2d, 0x6f, 0x00, 0xf1, 0xf0,
+  0x00, 0x02, 0x01, 0x2d, 0x00, 0xc0, 0x44, 0x01, 0x64, 0x00, 0xc0, 0x44,
+  0x01, 0x02, 0x09, 0x66, 0x2d, 0x61, 0x6e, 0x65, 0x73, 0x65, 0x63, 0x2d,
+  0x00, 0xf0, 0x5e, 0x07, 0x6d, 0x2d, 0x6c, 0x72, 0x6f, 0x66, 0x2d, 0x00,
+  0xf0, 0x67, 0x01, 0x01, 0x01, 0x75, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01,
+  0x6f, 0x00, 0x2a, 0x53, 0x00, 0x02, 0x05, 0x2d, 0x6e, 0x61, 0x73, 0x6c,
+  0x00, 0xf1, 0xf7, 0x01, 0x6e, 0x00, 0xf2, 0x03, 0x01, 0x02, 0x0a, 0x36,
+  0x2d, 0x6c, 0x6f, 0x72, 0x69, 0x74, 0x2d, 0x64, 0x73, 0x00, 0xf1, 0xf0,
+  0x07, 0x37, 0x2d, 0x6c, 0x6f, 0x72, 0x69, 0x74, 0x00, 0xf2, 0x0d, 0x00,
+  0x02, 0x08, 0x72, 0x2d, 0x6c, 0x6f, 0x72, 0x69, 0x74, 0x2d, 0x00, 0xf2,
+  0x0d, 0x07, 0x73, 0x2d, 0x6c, 0x6f, 0x72, 0x69, 0x74, 0x00, 0xc1, 0x6a,
+  0x01, 0x01, 0x03, 0x6f, 0x6c, 0x63, 0x00, 0xc8, 0x43, 0x01, 0x03, 0x01,
+  0x63, 0x00, 0x16, 0xd4, 0x01, 0x69, 0x00, 0xe1, 0x08, 0x02, 0x6e, 0x65,
+  0x00, 0xec, 0x07, 0x01, 0x02, 0x05, 0x61, 0x70, 0x65, 0x6d, 0x6f, 0x00,
+  0xcc, 0x4d, 0x03, 0x69, 0x64, 0x61, 0x00, 0xf2, 0x15, 0x01, 0x01, 0x01,
+  0x6f, 0x00, 0x1d, 0x1c, 0x00, 0x02, 0x02, 0x69, 0x64, 0x00, 0x5d, 0xbc,
+  0x01, 0x6f, 0x00, 0xf2, 0x29, 0x00, 0x02, 0x01, 0x65, 0x00, 0xf2, 0x36,
+  0x02, 0x69, 0x6c, 0x00, 0x64, 0xb6, 0x01, 0x02, 0x03, 0x6e, 0x6f, 0x6d,
+  0x00, 0xc3, 0xb6, 0x01, 0x73, 0x00, 0xf2, 0x3d, 0x00, 0x01, 0x01, 0x65,
+  0x00, 0x64, 0x9c, 0x01, 0x03, 0x02, 0x6c, 0x65, 0x00, 0xc6, 0x39, 0x01,
+  0x6f, 0x00, 0xc3, 0xa3, 0x03, 0x72, 0x6f, 0x66, 0x00, 0xf2, 0x4b, 0x00,
+  0x03, 0x01, 0x61, 0x00, 0xf2, 0x58, 0x02, 0x69, 0x6d, 0x00, 0x36, 0xd0,
+  0x01, 0x72, 0x00, 0x6b, 0x7d, 0x01, 0x01, 0x01, 0x61, 0x00, 0xf2, 0x65,
+  0x01, 0x01, 0x03, 0x69, 0x64, 0x6e, 0x00, 0xc9, 0x0a, 0x00, 0x02, 0x02,
+  0x65, 0x69, 0x00, 0xf2, 0x78, 0x01, 0x73, 0x00, 0x26, 0xd7, 0x00, 0x02,
+  0x01, 0x6d, 0x00, 0x0e, 0x15, 0x03, 0x72, 0x69, 0x74, 0x00, 0xf2, 0x84,
+  0x01, 0x01, 0x0f, 0x74, 0x2e, 0x6e, 0x65, 0x70, 0x6f, 0x2e, 0x63, 0x69,
+  0x74, 0x73, 0x61, 0x6c, 0x65, 0x6a, 0x00, 0x62, 0x34, 0x01, 0x02, 0x01,
+  0x6c, 0x00, 0x39, 0x28, 0x01, 0x73, 0x00, 0xf2, 0x95, 0x01, 0x03, 0x03,
+  0x65, 0x6e, 0x2e, 0x00, 0xc6, 0xb9, 0x01, 0x76, 0x00, 0x0e, 0x15, 0x01,
+  0x7a, 0x00, 0x17, 0x57, 0x00, 0x01, 0x01, 0x72, 0x00, 0x4c, 0x11, 0x01,
+  0x01, 0x01, 0x70, 0x00, 0x0e, 0x15, 0x01, 0x01, 0x01, 0x76, 0x00, 0x0e,
+  0x15, 0x01, 0x01, 0x03, 0x72, 0x65, 0x74, 0x00, 0x4b, 0xdd, 0x01, 0x01,
+  0x01, 0x63, 0x00, 0x16, 0xd4, 0x01, 0x01, 0x01, 0x69, 0x00, 0x94, 0x0e,
+  0x00, 0x04, 0x03, 0x64, 0x65, 0x6d, 0x00, 0xf2, 0x9c, 0x04, 0x70, 0x6d,
+  0x65, 0x74, 0x00, 0xf2, 0xa9, 0x02, 0x72, 0x64, 0x00, 0xf2, 0xb6, 0x01,
+  0x7a, 0x00, 0x29, 0x5f, 0x01, 0x03, 0x01, 0x61, 0x00, 0xf2, 0xbd, 0x01,
+  0x6f, 0x00, 0x0f, 0xfa, 0x02, 0x72, 0x65, 0x00, 0xf2, 0xc9, 0x01, 0x05,
+  0x01, 0x61, 0x00, 0xf2, 0xd5, 0x04, 0x65, 0x63, 0x69, 0x70, 0x00, 0xf2,
+  0xf1, 0x01, 0x69, 0x00, 0xf2, 0xfe, 0x01, 0x72, 0x00, 0xf3, 0x18, 0x01,
+  0x75, 0x00, 0xf3, 0x25, 0x01, 0x02, 0x01, 0x61, 0x00, 0xf3, 0x2c, 0x01,
+  0x6f, 0x00, 0xf3, 0x3c, 0x01, 0x02, 0x02, 0x69, 0x76, 0x00, 0xf3, 0x43,
+  0x04, 0x73, 0x61, 0x62, 0x6f, 0x00, 0xcc, 0xc8, 0x01, 0x03, 0x01, 0x61,
+  0x00, 0x13, 0x4d, 0x01, 0x65, 0x00, 0xf3, 0x4a, 0x01, 0x6e, 0x00, 0xf3,
+  0x57, 0x00, 0x02, 0x01, 0x65, 0x00, 0x44, 0x12, 0x02, 0x75, 0x72, 0x00,
+  0x37, 0xd5, 0x01, 0x02, 0x01, 0x6d, 0x00, 0x0e, 0x15, 0x01, 0x73, 0x00,
+  0x0e, 0x15, 0x00, 0x02, 0x01, 0x62, 0x00, 0x0e, 0x15, 0x06, 0x69, 0x73,
+  0x65, 0x6c, 0x67, 0x69, 0x00, 0xf3, 0x63, 0x00, 0x01, 0x01, 0x70, 0x00,
+  0x29, 0x66, 0x00, 0x02, 0x01, 0x74, 0x00, 0x0e, 0x15, 0x01, 0x78, 0x00,
+  0xf3, 0x70, 0x00, 0x01, 0x01, 0x65, 0x00, 0x29, 0xae, 0x01, 0x01, 0x01,
+  0x70, 0x00, 0xc6, 0xdc, 0x00, 0x01, 0x04, 0x72, 0x61, 0x62, 0x6d, 0x00,
+  0x46, 0x75, 0x00, 0x02, 0x02, 0x2d, 0x61, 0x00, 0xf3, 0x80, 0x01, 0x61,
+  0x00, 0xf3, 0x80, 0x01, 0x01, 0x05, 0x2e, 0x72, 0x65, 0x74, 0x75, 0x00,
+  0x83, 0x0e, 0x00, 0x01, 0x03, 0x69, 0x75, 0x71, 0x00, 0x1d, 0x34, 0x01,
+  0x01, 0x02, 0x2e, 0x65, 0x00, 0x98, 0x11, 0x00, 0x01, 0x01, 0x6c, 0x00,
+  0x99, 0x96, 0x00, 0x07, 0x05, 0x64, 0x75, 0x6f, 0x6c, 0x63, 0x00, 0xf3,
+  0x88, 0x01, 0x65, 0x00, 0xf3, 0x94, 0x01, 0x66, 0x00, 0xf3, 0xa2, 0x01,
+  0x6c, 0x00, 0xf3, 0xa9, 0x01, 0x73, 0x00, 0xf3, 0xb7, 0x01, 0x74, 0x00,
+  0xc7, 0xdb, 0x04, 0x76, 0x65, 0x64, 0x75, 0x00, 0xf3, 0xc7, 0x00, 0x02,
+  0x01, 0x65, 0x00, 0x26, 0xd7, 0x01, 0x70, 0x00, 0x0e, 0x15, 0x00, 0x03,
+  0x01, 0x70, 0x00, 0x62, 0x2d, 0x0a, 0x73, 0x74, 0x65, 0x6c, 0x64, 0x75,
+  0x6f, 0x6c, 0x63, 0x2e, 0x00, 0x31, 0x40, 0x01, 0x74, 0x00, 0x61, 0x1a,
+  0x00, 0x06, 0x01, 0x61, 0x00, 0x8d, 0x8c, 0x02, 0x63, 0x69, 0x00, 0xf3,
+  0xce, 0x01, 0x64, 0x00, 0xf3, 0xdb, 0x01, 0x73, 0x00, 0x43, 0x6a, 0x01,
+  0x74, 0x00, 0xf3, 0xe2, 0x03, 0x77, 0x73, 0x6e, 0x00, 0xf3, 0xee, 0x00,
+  0x04, 0x01, 0x61, 0x00, 0x8d, 0x8c, 0x01, 0x63, 0x00, 0x4b, 0xdd, 0x01,
+  0x64, 0x00, 0xf3, 0xdb, 0x01, 0x73, 0x00, 0x43, 0x6a, 0x00, 0x01, 0x01,
+  0x69, 0x00, 0xf3, 0xf6, 0x00, 0x02, 0x01, 0x70, 0x00, 0x27, 0x0f, 0x01,
+  0x75, 0x00, 0x99, 0x6d, 0x00, 0x01, 0x04, 0x70, 0x61, 0x74, 0x69, 0x00,
+  0xf3, 0xff, 0x00, 0x01, 0x03, 0x69, 0x74, 0x6f, 0x00, 0x73, 0x6a, 0x00,
+  0x01, 0x01, 0x6e, 0x00, 0x41, 0xf9, 0x00, 0x01, 0x01, 0x73, 0x00, 0x42,
+  0x43, 0x00, 0x02, 0x01, 0x6b, 0x00, 0x29, 0x5f, 0x01, 0x7a, 0x00, 0xf4,
+  0x06, 0x00, 0x01, 0x02, 0x72, 0x65, 0x00, 0xf4, 0x0d, 0x00, 0x03, 0x01,
+  0x6b, 0x00, 0xf4, 0x14, 0x01, 0x72, 0x00, 0xf4, 0x1c, 0x01, 0x76, 0x00,
+  0xf4, 0x25, 0x00, 0x01, 0x03, 0x65, 0x67, 0x79, 0x00, 0x51, 0x29, 0x00,
+  0x01, 0x01, 0x73, 0x00, 0x80, 0x9d, 0x00, 0x01, 0x03, 0x68, 0x63, 0x6c,
+  0x00, 0x29, 0x66, 0x00, 0x02, 0x01, 0x6d, 0x00, 0x0e, 0x15, 0x06, 0x72,
+  0x6f, 0x67, 0x69, 0x74, 0x61, 0x00, 0x9c, 0x84, 0x00, 0x03, 0x03, 0x67,
+  0x6e, 0x69, 0x00, 0xf4, 0x2d, 0x07, 0x6d, 0x75, 0x72, 0x74, 0x63, 0x65,
+  0x70, 0x00, 0x6c, 0x6e, 0x02, 0x73, 0x70, 0x00, 0xf4, 0x3b, 0x00, 0x02,
+  0x02, 0x63, 0x6d, 0x00, 0xf4, 0x42, 0x01, 0x6f, 0x00, 0xa8, 0xe9, 0x00,
+  0x01, 0x02, 0x69, 0x64, 0x00, 0xa8, 0xcc, 0x00, 0x01, 0x01, 0x74, 0x00,
+  0x97, 0xbe, 0x00, 0x02, 0x02, 0x67, 0x6f, 0x00, 0x72, 0x46, 0x03, 0x6e,
+  0x61, 0x67, 0x00, 0xc5, 0xc5, 0x00, 0x01, 0x01, 0x6c, 0x00, 0x68, 0x09,
+  0x00, 0x08, 0x01, 0x67, 0x00, 0xf4, 0x4a, 0x01, 0x6b, 0x00, 0xf4, 0x14,
+  0x02, 0x6c, 0x65, 0x00, 0xa0, 0x17, 0x03, 0x6e, 0x65, 0x6d, 0x00, 0x44,
+  0x12, 0x01, 0x72, 0x00, 0xf4, 0x1c, 0x04, 0x73, 0x73, 0x61, 0x6b, 0x00,
+  0xf4, 0x51, 0x01, 0x76, 0x00, 0xf4, 0x25, 0x04, 0x7a, 0x61, 0x68, 0x6b,
+  0x00, 0x37, 0xd5, 0x00, 0x01, 0x01, 0x68, 0x00, 0x8d, 0xab, 0x00, 0x01,
+  0x01, 0x67, 0x00, 0x46, 0x7c, 0x00, 0x01, 0x01, 0x6e, 0x00, 0x13, 0x33,
+  0x00, 0x05, 0x07, 0x6c, 0x65, 0x67, 0x6e, 0x61, 0x68, 0x6b, 0x00, 0x44,
+  0x12, 0x01, 0x6d, 0x00, 0x0e, 0x15, 0x01, 0x6e, 0x00, 0xf4, 0x58, 0x02,
+  0x74, 0x69, 0x00, 0xe6, 0x4e, 0x04, 0x76, 0x6f, 0x72, 0x6b, 0x00, 0x92,
+  0x51, 0x00, 0x01, 0x01, 0x61, 0x00, 0xa0, 0x17, 0x00, 0x01, 0x01, 0x6d,
+  0x00, 0x48, 0x38, 0x00, 0x01, 0x01, 0x72, 0x00, 0x80, 0x9d, 0x00, 0x02,
+  0x01, 0x65, 0x00, 0x8f, 0x0c, 0x07, 0x68, 0x6b, 0x61, 0x7a, 0x61, 0x6b,
+  0x2d, 0x00, 0xf4, 0x64, 0x00, 0x01, 0x01, 0x61, 0x00, 0x94, 0x07, 0x00,
+  0x02, 0x02, 0x68, 0x73, 0x00, 0x43, 0x6a, 0x01, 0x6d, 0x00, 0x37, 0xb3,
+  0x00, 0x01, 0x01, 0x6c, 0x00, 0x53, 0x44, 0x00, 0x01, 0x01, 0x73, 0x00,
+  0x7f, 0xc0, 0x00, 0x01, 0x01, 0x6f, 0x00, 0x4a, 0x79, 0x00, 0x02, 0x01,
+  0x67, 0x00, 0x61, 0xb3, 0x02, 0x6c, 0x63, 0x00, 0xc6, 0x32, 0x00, 0x01,
+  0x03, 0x62, 0x65, 0x77, 0x00, 0x14, 0x4a, 0x00, 0x01, 0x01, 0x69, 0x00,
+  0xa0, 0x6a, 0x00, 0x01, 0x01, 0x6c, 0x00, 0x14, 0x4a, 0x00, 0x01, 0x01,
+  0x63, 0x00, 0x72, 0x66, 0x00, 0x01, 0x03, 0x79, 0x72, 0x63, 0x00, 0xdf,
+  0xc1, 0x00, 0x01, 0x01, 0x67, 0x00, 0x4c, 0x7f, 0x00, 0x01, 0x01, 0x72,
+  0x00, 0x2c, 0xa2, 0x00, 0x01, 0x01, 0x74, 0x00, 0x73, 0x35, 0x00, 0x01,
+  0x01, 0x6d, 0x00, 0x97, 0xbe, 0x00, 0x01, 0x01, 0x62, 0x00, 0x1d, 0x34,
+  0x00, 0x01, 0x03, 0x6b, 0x63, 0x61, 0x00, 0x68, 0xf2, 0x01, 0x01, 0x01,
+  0x2e, 0x00, 0xf4, 0x70, 0x00, 0x01, 0x01, 0x63, 0x00, 0xf4, 0x7e, 0x00,
+  0x01, 0x03, 0x63, 0x69, 0x66, 0x00, 0x62, 0x7a, 0x01, 0x01, 0x01, 0x2e,
+  0x00, 0xf4, 0x87, 0x00, 0x01, 0x01, 0x73, 0x00, 0x5d, 0xbc, 0x00, 0x02,
+  0x01, 0x64, 0x00, 0x98, 0xb2, 0x01, 0x6d, 0x00, 0xc7, 0xff, 0x00, 0x02,
+  0x01, 0x2d, 0x00, 0x56, 0x74, 0x01, 0x66, 0x00, 0xc9, 0x11, 0x00, 0x01,
+  0x01, 0x66, 0x00, 0x97, 0xbe, 0x00, 0x01, 0x01, 0x63, 0x00, 0x16, 0xb8,
+  0x00, 0x01, 0x01, 0x6f, 0x00, 0x33, 0x14, 0x00, 0x02, 0x01, 0x63, 0x00,
+  0x0e, 0x15, 0x01, 0x6f, 0x00, 0x13, 0x33, 0x00, 0x01, 0x03, 0x6c, 0x61,
+  0x63, 0x00, 0x46, 0x75, 0x00, 0x01, 0x02, 0x73, 0x67, 0x00, 0x35, 0xb8,
+  0x00, 0x01, 0x01, 0x64, 0x00, 0xce, 0x17, 0x00, 0x01, 0x01, 0x6e, 0x00,
+  0x4b, 0xdd, 0x00, 0x01, 0x01, 0x64, 0x00, 0x41, 0x08, 0x00, 0x01, 0x01,
+  0x6e, 0x00, 0xf4, 0x9b, 0x00, 0x01, 0x01, 0x67, 0x00, 0x12, 0xe2, 0x00,
+  0x02, 0x01, 0x65, 0x00, 0xf4, 0xa2, 0x01, 0x75, 0x00, 0x26, 0xde, 0x00,
+  0x02, 0x07, 0x69, 0x6b, 0x6e, 0x61, 0x72, 0x66, 0x2d, 0x00, 0x90, 0x16,
+  0x08, 0x6f, 0x72, 0x74, 0x65, 0x70, 0x6f, 0x72, 0x70, 0x00, 0xf4, 0xa9,
+  0x00, 0x01, 0x01, 0x6b, 0x00, 0x27, 0x25, 0x00, 0x01, 0x01, 0x72, 0x00,
+  0xf4, 0x51, 0x01, 0x01, 0x01, 0x69, 0x00, 0xc6, 0xf9, 0x00, 0x01, 0x01,
+  0x6b, 0x00, 0xf4, 0x9b, 0x00, 0x01, 0x01, 0x61, 0x00, 0x4c, 0x71, 0x00,
+  0x02, 0x01, 0x73, 0x00, 0xee, 0x68, 0x01, 0x76, 0x00, 0x28, 0xd5, 0x00,
+  0x02, 0x01, 0x6b, 0x00, 0x5d, 0xbc, 0x01, 0x6e, 0x00, 0x16, 0x7b, 0x00,
+  0x01, 0x01, 0x76, 0x00, 0x67, 0x6c, 0x00, 0x01, 0x04, 0x6e, 0x65, 0x6d,
+  0x65, 0x00, 0x9e, 0x45, 0x00, 0x01, 0x01, 0x6d, 0x00, 0x27, 0x0f, 0x00,
+  0x02, 0x01, 0x72, 0x00, 0xc7, 0x8f, 0x05, 0x73, 0x6d, 0x61, 0x2d, 0x6c,
+  0x00, 0x0f, 0x6f, 0x00, 0x01, 0x03, 0x61, 0x70, 0x2d, 0x00, 0x87, 0xcc,
+  0x01, 0x01, 0x07, 0x2e, 0x73, 0x6e, 0x6f, 0x69, 0x74, 0x63, 0x00, 0xf4,
+  0xb5, 0x00, 0x01, 0x06, 0x74, 0x69, 0x73, 0x62, 0x65, 0x77, 0x00, 0xf4,
+  0xbc, 0x00, 0x01, 0x02, 0x38, 0x6b, 0x00, 0xf4, 0xc3, 0x00, 0x02, 0x01,
+  0x62, 0x00, 0x5d, 0xae, 0x01, 0x76, 0x00, 0x8e, 0x7a, 0x00, 0x04, 0x01,
+  0x33, 0x00, 0x27, 0x0f, 0x01, 0x65, 0x00, 0xc7, 0xa5, 0x01, 0x6d, 0x00,
+  0x1b, 0x9f, 0x01, 0x73, 0x00, 0xc7, 0xb1, 0x00, 0x01, 0x02, 0x73, 0x61,
+  0x00, 0xc6, 0xb2, 0x00, 0x01, 0x01, 0x71, 0x00, 0x27, 0x0f, 0x00, 0x01,
+  0x01, 0x6e, 0x00, 0xf4, 0xcd, 0x00, 0x01, 0x01, 0x73, 0x00, 0xd2, 0x5a,
+  0x00, 0x01, 0x01, 0x31, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x6f, 0x00,
+  0xf4, 0xd9, 0x00, 0x02, 0x02, 0x2d, 0x6c, 0x00, 0xf4, 0xe0, 0x01, 0x6c,
+  0x00, 0xf4, 0xe0, 0x00, 0x03, 0x04, 0x61, 0x64, 0x70, 0x75, 0x00, 0x69,
+  0xb6, 0x02, 0x74, 0x75, 0x00, 0x96, 0x18, 0x03, 0x75, 0x6f, 0x72, 0x00,
+  0x96, 0x34, 0x00, 0x03, 0x02, 0x2d, 0x65, 0x00, 0xf4, 0xe8, 0x08, 0x62,
+  0x65, 0x77, 0x2d, 0x65, 0x6d, 0x6f, 0x68, 0x00, 0xf4, 0xf8, 0x01, 0x6c,
+  0x00, 0x96, 0x2d, 0x00, 0x01, 0x01, 0x6e, 0x00, 0x91, 0xc5, 0x00, 0x05,
+  0x01, 0x64, 0x00, 0x1e, 0x60, 0x03, 0x6e, 0x75, 0x66, 0x00, 0x38, 0x36,
+  0x05, 0x73, 0x65, 0x68, 0x63, 0x73, 0x00, 0xf4, 0xff, 0x02, 0x74, 0x65,
+  0x00, 0x6c, 0xfa, 0x01, 0x79, 0x00, 0xc8, 0x6c, 0x00, 0x01, 0x01, 0x61,
+  0x00, 0x5f, 0xbd, 0x00, 0x02, 0x01, 0x6e, 0x00, 0xaa, 0x23, 0x01, 0x73,
+  0x00, 0x91, 0x36, 0x00, 0x01, 0x03, 0x6c, 0x61, 0x77, 0x00, 0xc2, 0x48,
+  0x00, 0x01, 0x01, 0x61, 0x00, 0x2c, 0x3b, 0x00, 0x01, 0x01, 0x64, 0x00,
+  0x2f, 0x47, 0x00, 0x01, 0x02, 0x73, 0x65, 0x00, 0x85, 0xc5, 0x00, 0x01,
+  0x01, 0x67, 0x00, 0x13, 0x33, 0x00, 0x01, 0x01, 0x6c, 0x00, 0x21, 0x6d,
+  0x00, 0x02, 0x02, 0x63, 0x76, 0x00, 0x13, 0x4d, 0x01, 0x6b, 0x00, 0xf5,
+  0x07, 0x00, 0x01, 0x02, 0x72, 0x61, 0x00, 0x97, 0xb5, 0x01, 0x01, 0x05,
+  0x2e, 0x74, 0x73, 0x6f, 0x68, 0x00, 0xc6, 0xd3, 0x00, 0x01, 0x01, 0x67,
+  0x00, 0x27, 0x3a, 0x00, 0x01, 0x02, 0x74, 0x2e, 0x00, 0xee, 0x68, 0x00,
+  0x01, 0x01, 0x6c, 0x00, 0x60, 0x40, 0x00, 0x01, 0x02, 0x64, 0x6e, 0x00,
+  0xf5, 0x0e, 0x00, 0x01, 0x01, 0x68, 0x00, 0x56, 0x74, 0x00, 0x01, 0x04,
+  0x68, 0x2e, 0x74, 0x6f, 0x00, 0xf5, 0x15, 0x00, 0x01, 0x02, 0x72, 0x65,
+  0x00, 0x1d, 0x34, 0x00, 0x01, 0x01, 0x69, 0x00, 0xf5, 0x1c, 0x00, 0x01,
+  0x01, 0x69, 0x00, 0x97, 0x5e, 0x00, 0x01, 0x01, 0x6c, 0x00, 0x25, 0x56,
+  0x00, 0x01, 0x01, 0x72, 0x00, 0x6d, 0x8e, 0x00, 0x01, 0x01, 0x6d, 0x00,
+  0x90, 0x5b, 0x00, 0x01, 0x01, 0x75, 0x00, 0xf5, 0x23, 0x00, 0x01, 0x04,
+  0x74, 0x75, 0x70, 0x6d, 0x00, 0xde, 0x9e, 0x00, 0x01, 0x01, 0x63, 0x00,
+  0x14, 0x4a, 0x00, 0x02, 0x02, 0x65, 0x74, 0x00, 0x85, 0x88, 0x04, 0x6f,
+  0x63, 0x65, 0x76, 0x00, 0x56, 0x74, 0x00, 0x01, 0x01, 0x6c, 0x00, 0x3f,
+  0xd8, 0x00, 0x01, 0x01, 0x65, 0x00, 0xcd, 0xa8, 0x00, 0x01, 0x01, 0x79,
+  0x00, 0x15, 0x5e, 0x00, 0x01, 0x01, 0x74, 0x00, 0x73, 0x43, 0x00, 0x01,
+  0x03, 0x73, 0x76, 0x63, 0x00, 0x3c, 0x3a, 0x00, 0x01, 0x01, 0x73, 0x00,
+  0x4d, 0x56, 0x00, 0x01, 0x01, 0x6e, 0x00, 0x3c, 0xee, 0x00, 0x01, 0x01,
+  0x65, 0x00, 0xf5, 0x2a, 0x00, 0x02, 0x04, 0x6e, 0x65, 0x69, 0x6d, 0x00,
+  0x29, 0xae, 0x06, 0x73, 0x69, 0x76, 0x72, 0x65, 0x74, 0x00, 0x26, 0x53,
+  0x00, 0x01, 0x05, 0x2d, 0x79, 0x72, 0x65, 0x76, 0x00, 0xbd, 0x57, 0x00,
+  0x02, 0x06, 0x73, 0x75, 0x66, 0x6e, 0x6f, 0x63, 0x00, 0xf5, 0x3a, 0x02,
+  0x76, 0x61, 0x00, 0xd1, 0xd6, 0x00, 0x02, 0x05, 0x61, 0x72, 0x66, 0x6e,
+  0x69, 0x00, 0xf5, 0x41, 0x01, 0x6d, 0x00, 0x35, 0x51, 0x00, 0x02, 0x02,
+  0x6c, 0x6f, 0x00, 0x46, 0x7c, 0x01, 0x70, 0x00, 0x6a, 0xcc, 0x00, 0x02,
+  0x05, 0x61, 0x73, 0x2d, 0x34, 0x2d, 0x00, 0xcf, 0x90, 0x04, 0x70, 0x6f,
+  0x65, 0x70, 0x00, 0xf5, 0x41, 0x00, 0x03, 0x01, 0x2d, 0x00, 0xd1, 0xbf,
+  0x01, 0x61, 0x00, 0xf5, 0x4a, 0x06, 0x6f, 0x68, 0x72, 0x75, 0x6f, 0x79,
+  0x00, 0xf5, 0x51, 0x00, 0x02, 0x01, 0x6f, 0x00, 0xf5, 0x58, 0x04, 0x75,
+  0x6d, 0x61, 0x2e, 0x00, 0xdf, 0xba, 0x00, 0x03, 0x0d, 0x65, 0x68, 0x77,
+  0x6f, 0x6e, 0x67, 0x6e, 0x69, 0x6f, 0x67, 0x79, 0x6c, 0x64, 0x00, 0xde,
+  0xd7, 0x02, 0x69, 0x77, 0x00, 0x97, 0xbe, 0x14, 0x75, 0x63, 0x65, 0x73,
+  0x2d, 0x37, 0x37, 0x6e, 0x64, 0x63, 0x2e, 0x6e, 0x69, 0x67, 0x69, 0x72,
+  0x6f, 0x2e, 0x6c, 0x73, 0x00, 0x27, 0x0f, 0x00, 0x02, 0x05, 0x61, 0x64,
+  0x69, 0x64, 0x6e, 0x00, 0xf5, 0x5f, 0x02, 0x69, 0x73, 0x00, 0xf5, 0x66,
+  0x00, 0x01, 0x01, 0x68, 0x00, 0xf5, 0x72, 0x00, 0x01, 0x03, 0x65, 0x67,
+  0x2d, 0x00, 0xf5, 0x79, 0x00, 0x02, 0x01, 0x61, 0x00, 0x94, 0xa5, 0x02,
+  0x76, 0x65, 0x00, 0xc9, 0x9c, 0x00, 0x02, 0x01, 0x2d, 0x00, 0x97, 0xbe,
+  0x01, 0x79, 0x00, 0x12, 0x22, 0x00, 0x06, 0x02, 0x62, 0x6c, 0x00, 0x12,
+  0x22, 0x02, 0x63, 0x66, 0x00, 0x5d, 0xbc, 0x03, 0x65, 0x67, 0x65, 0x00,
+  0x2f, 0xa2, 0x01, 0x6c, 0x00, 0xf5, 0x80, 0x01, 0x73, 0x00, 0xf5, 0x87,
+  0x01, 0x78, 0x00, 0xf5, 0x9f, 0x00, 0x02, 0x01, 0x69, 0x00, 0x97, 0x89,
+  0x02, 0x72, 0x76, 0x00, 0xed, 0x3c, 0x00, 0x01, 0x01, 0x76, 0x00, 0x93,
+  0x7c, 0x00, 0x01, 0x02, 0x6f, 0x64, 0x00, 0x69, 0xb6, 0x00, 0x02, 0x01,
+  0x61, 0x00, 0x28, 0x66, 0x01, 0x6f, 0x00, 0x21, 0x6d, 0x00, 0x02, 0x01,
+  0x68, 0x00, 0x95, 0xc9, 0x05, 0x74, 0x6b, 0x73, 0x65, 0x64, 0x00, 0xed,
+  0x43, 0x00, 0x02, 0x01, 0x65, 0x00, 0xef, 0x1b, 0x01, 0x79, 0x00, 0x12,
+  0x22, 0x00, 0x03, 0x03, 0x67, 0x61, 0x74, 0x00, 0x92, 0x51, 0x07, 0x70,
+  0x70, 0x65, 0x70, 0x74, 0x65, 0x65, 0x00, 0x4e, 0x75, 0x06, 0x73, 0x75,
+  0x2d, 0x78, 0x75, 0x6e, 0x00, 0xf5, 0xa6, 0x00, 0x01, 0x02, 0x74, 0x72,
+  0x00, 0x83, 0x3b, 0x00, 0x02, 0x01, 0x69, 0x00, 0xf5, 0xad, 0x01, 0x6e,
+  0x00, 0xf5, 0xb5, 0x00, 0x02, 0x04, 0x61, 0x6c, 0x66, 0x6d, 0x00, 0x35,
+  0x51, 0x01, 0x62, 0x00, 0xcf, 0x01, 0x00, 0x02, 0x05, 0x69, 0x6b, 0x63,
+  0x65, 0x74, 0x00, 0xf5, 0xbd, 0x01, 0x79, 0x00, 0xf5, 0xc4, 0x00, 0x0b,
+  0x01, 0x2d, 0x00, 0x5c, 0x21, 0x01, 0x64, 0x00, 0xed, 0x43, 0x01, 0x65,
+  0x00, 0x84, 0xe6, 0x01, 0x67, 0x00, 0x35, 0xb8, 0x02, 0x6b, 0x63, 0x00,
+  0x37, 0xa5, 0x01, 0x6d, 0x00, 0xf5, 0xcc, 0x03, 0x6e, 0x79, 0x64, 0x00,
+  0xf5, 0xd3, 0x01, 0x70, 0x00, 0x27, 0x0f, 0x01, 0x72, 0x00, 0xa9, 0xf9,
+  0x01, 0x74, 0x00, 0x58, 0xaf, 0x01, 0x75, 0x00, 0x99, 0x6d, 0x00, 0x02,
+  0x01, 0x61, 0x00, 0xf5, 0xda, 0x01, 0x6e, 0x00, 0x97, 0xc5, 0x00, 0x02,
+  0x0b, 0x6a, 0x6f, 0x72, 0x70, 0x61, 0x72, 0x6f, 0x64, 0x65, 0x66, 0x2e,
+  0x00, 0xf5, 0xe4, 0x05, 0x72, 0x69, 0x64, 0x65, 0x72, 0x00, 0x95, 0xc9,
+  0x00, 0x02, 0x03, 0x65, 0x77, 0x73, 0x00, 0xc9, 0x9c, 0x06, 0x6e, 0x72,
+  0x65, 0x74, 0x6e, 0x69, 0x00, 0xf5, 0xf9, 0x00, 0x01, 0x01, 0x2d, 0x00,
+  0xf6, 0x07, 0x00, 0x03, 0x02, 0x69, 0x78, 0x00, 0xf6, 0x0e, 0x01, 0x6f,
+  0x00, 0xf6, 0x17, 0x01, 0x72, 0x00, 0xaa, 0x1a, 0x00, 0x13, 0x01, 0x61,
+  0x00, 0xf6, 0x23, 0x01, 0x63, 0x00, 0x12, 0x22, 0x01, 0x64, 0x00, 0x0f,
+  0xfa, 0x01, 0x65, 0x00, 0xf6, 0x2f, 0x01, 0x67, 0x00, 0xb9, 0xd8, 0x01,
+  0x68, 0x00, 0x0f, 0xfa, 0x01, 0x69, 0x00, 0xf6, 0x4f, 0x01, 0x6b, 0x00,
+  0xf6, 0x5b, 0x01, 0x6c, 0x00, 0xf6, 0x71, 0x01, 0x6e, 0x00, 0xf6, 0x87,
+  0x01, 0x6f, 0x00, 0xf6, 0x93, 0x01, 0x70, 0x00, 0x16, 0xb8, 0x01, 0x72,
+  0x00, 0xf6, 0xa4, 0x01, 0x73, 0x00, 0xf6, 0xbf, 0x01, 0x74, 0x00, 0xf6,
+  0xd0, 0x01, 0x75, 0x00, 0xf6, 0xf5, 0x01, 0x76, 0x00, 0x26, 0xde, 0x01,
+  0x79, 0x00, 0xf7, 0x10, 0x01, 0x7a, 0x00, 0x93, 0x69, 0x00, 0x01, 0x01,
+  0x6e, 0x00, 0xf7, 0x1c, 0x00, 0x01, 0x01, 0x73, 0x00, 0x52, 0xae, 0x00,
+  0x01, 0x01, 0x74, 0x00, 0x39, 0x28, 0x00, 0x01, 0x02, 0x72, 0x75, 0x00,
+  0x46, 0x7c, 0x00, 0x01, 0x02, 0x68, 0x63, 0x00, 0x44, 0x12, 0x00, 0x01,
+  0x01, 0x6f, 0x00, 0x26, 0xbd, 0x00, 0x01, 0x01, 0x68, 0x00, 0x6a, 0xab,
+  0x00, 0x01, 0x01, 0x64, 0x00, 0x14, 0x4a, 0x01, 0x01, 0x01, 0x67, 0x00,
+  0x0e, 0x15, 0x00, 0x02, 0x06, 0x65, 0x74, 0x74, 0x6f, 0x6c, 0x79, 0x00,
+  0xf7, 0x23, 0x07, 0x74, 0x6e, 0x65, 0x65, 0x6c, 0x66, 0x66, 0x00, 0x67,
+  0x6c, 0x00, 0x08, 0x09, 0x62, 0x75, 0x6e, 0x73, 0x6f, 0x72, 0x74, 0x65,
+  0x72, 0x00, 0xf7, 0x35, 0x02, 0x65, 0x6e, 0x00, 0xf7, 0x3c, 0x09, 0x6b,
+  0x72, 0x61, 0x6d, 0x65, 0x74, 0x79, 0x62, 0x2e, 0x00, 0xf7, 0x4b, 0x03,
+  0x6f, 0x6d, 0x69, 0x00, 0x51, 0x29, 0x01, 0x70, 0x00, 0x5c, 0x90, 0x01,
+  0x74, 0x00, 0xf7, 0x57, 0x05, 0x76, 0x72, 0x65, 0x73, 0x2d, 0x00, 0x6c,
+  0xa5, 0x01, 0x79, 0x00, 0x5c, 0xb0, 0x00, 0x02, 0x03, 0x66, 0x66, 0x6f,
+  0x00, 0x4b, 0x7d, 0x01, 0x76, 0x00, 0xf7, 0x6b, 0x00, 0x01, 0x01, 0x70,
+  0x00, 0x28, 0x6d, 0x00, 0x01, 0x02, 0x69, 0x6c, 0x00, 0x8d, 0x16, 0x00,
+  0x01, 0x01, 0x65, 0x00, 0x51, 0x22, 0x01, 0x01, 0x03, 0x2e, 0x6e, 0x6f,
+  0x00, 0xeb, 0xf9, 0x00, 0x01, 0x01, 0x62, 0x00, 0x43, 0x6a, 0x00, 0x02,
+  0x02, 0x69, 0x62, 0x00, 0xf7, 0x72, 0x01, 0x6f, 0x00, 0x93, 0x45, 0x01,
+  0x01, 0x01, 0x2e, 0x00, 0xf7, 0x79, 0x00, 0x01, 0x01, 0x69, 0x00, 0x4e,
+  0x75, 0x00, 0x01, 0x01, 0x72, 0x00, 0x83, 0x34, 0x00, 0x01, 0x01, 0x64,
+  0x00, 0x0c, 0x1d, 0x00, 0x02, 0x03, 0x67, 0x75, 0x6c, 0x00, 0x1e, 0x60,
+  0x01, 0x72, 0x00, 0xce, 0x10, 0x00, 0x02, 0x01, 0x6b, 0x00, 0xf7, 0x85,
+  0x01, 0x77, 0x00, 0xf7, 0x8c, 0x00, 0x02, 0x01, 0x62, 0x00, 0x53, 0x44,
+  0x02, 0x6e, 0x65, 0x00, 0x94, 0x7b, 0x00, 0x02, 0x01, 0x6c, 0x00, 0xf7,
+  0x9c, 0x02, 0x7a, 0x73, 0x00, 0xcd, 0x09, 0x00, 0x02, 0x01, 0x6e, 0x00,
+  0xc8, 0x88, 0x03, 0x74, 0x61, 0x69, 0x00, 0x60, 0xbd, 0x00, 0x01, 0x02,
+  0x6c, 0x61, 0x00, 0x5f, 0x90, 0x00, 0x02, 0x04, 0x61, 0x6c, 0x73, 0x65,
+  0x00, 0xde, 0xd7, 0x01, 0x6f, 0x00, 0xf7, 0xad, 0x00, 0x02, 0x01, 0x69,
+  0x00, 0x12, 0x22, 0x04, 0x7a, 0x72, 0x6f, 0x67, 0x00, 0x28, 0x66, 0x00,
+  0x01, 0x01, 0x64, 0x00, 0x27, 0x0f, 0x00, 0x02, 0x01, 0x6c, 0x00, 0xf7,
+  0xba, 0x01, 0x77, 0x00, 0xf7, 0xc1, 0x00, 0x01, 0x01, 0x62, 0x00, 0x41,
+  0xf9, 0x00, 0x01, 0x02, 0x6f, 0x6d, 0x00, 0x92, 0x51, 0x00, 0x01, 0x01,
+  0x64, 0x00, 0x92, 0x51, 0x00, 0x01, 0x01, 0x70, 0x00, 0x41, 0x08, 0x00,
+  0x01, 0x01, 0x7a, 0x00, 0x13, 0x33, 0x00, 0x01, 0x02, 0x7a, 0x63, 0x00,
+  0xf7, 0x85, 0x00, 0x01, 0x01, 0x62, 0x00, 0x12, 0xe2, 0x00, 0x02, 0x01,
+  0x65, 0x00, 0x15, 0x5e, 0x03, 0x6f, 0x62, 0x65, 0x00, 0xcd, 0x02, 0x00,
+  0x02, 0x02, 0x72, 0x74, 0x00, 0x84, 0xae, 0x01, 0x73, 0x00, 0xf7, 0xcd,
+  0x00, 0x01, 0x01, 0x6c, 0x00, 0x35, 0x0c, 0x00, 0x02, 0x01, 0x75, 0x00,
+  0x35, 0x0c, 0x01, 0x79, 0x00, 0xcd, 0xb6, 0x00, 0x03, 0x02, 0x63, 0x6f,
+  0x00, 0xcd, 0xa8, 0x03, 0x65, 0x69, 0x6e, 0x00, 0x0c, 0x1d, 0x03, 0x72,
+  0x6f, 0x77, 0x00, 0x48, 0x38, 0x01, 0x01, 0x01, 0x65, 0x00, 0x84, 0xe6,
+  0x00, 0x01, 0x01, 0x74, 0x00, 0x27, 0x2c, 0x00, 0x01, 0x04, 0x61, 0x65,
+  0x72, 0x70, 0x00, 0xf7, 0xd4, 0x00, 0x11, 0x01, 0x61, 0x00, 0xf7, 0xdb,
+  0x03, 0x62, 0x6e, 0x69, 0x00, 0xf7, 0xe7, 0x01, 0x63, 0x00, 0x2a, 0x10,
+  0x01, 0x64, 0x00, 0xf7, 0xf3, 0x03, 0x65, 0x73, 0x73, 0x00, 0x0f, 0x68,
+  0x01, 0x66, 0x00, 0x6d, 0x60, 0x01, 0x67, 0x00, 0xf7, 0xfa, 0x02, 0x68,
+  0x69, 0x00, 0x6d, 0x60, 0x01, 0x6d, 0x00, 0xf8, 0x06, 0x01, 0x6e, 0x00,
+  0xcd, 0x7f, 0x01, 0x6f, 0x00, 0xf8, 0x18, 0x01, 0x70, 0x00, 0xf8, 0x31,
+  0x01, 0x72, 0x00, 0xf8, 0x4d, 0x01, 0x73, 0x00, 0xf8, 0x5a, 0x04, 0x74,
+  0x61, 0x6c, 0x75, 0x00, 0xf8, 0x70, 0x01, 0x77, 0x00, 0xf8, 0x77, 0x03,
+  0x7a, 0x6f, 0x75, 0x00, 0x35, 0x51, 0x00, 0x02, 0x02, 0x63, 0x6f, 0x00,
+  0x9d, 0xd6, 0x04, 0x73, 0x69, 0x7a, 0x64, 0x00, 0x2c, 0xa2, 0x00, 0x03,
+  0x01, 0x61, 0x00, 0x94, 0x07, 0x01, 0x75, 0x00, 0x26, 0xde, 0x02, 0x7a,
+  0x73, 0x00, 0x6c, 0xf3, 0x00, 0x02, 0x01, 0x61, 0x00, 0x28, 0x66, 0x01,
+  0x67, 0x00, 0x43, 0xb8, 0x00, 0x02, 0x02, 0x72, 0x61, 0x00, 0xcd, 0xbe,
+  0x03, 0x73, 0x75, 0x67, 0x00, 0x84, 0x70, 0x00, 0x02, 0x02, 0x63, 0x6f,
+  0x00, 0x31, 0x6e, 0x02, 0x73, 0x65, 0x00, 0xf8, 0x92, 0x00, 0x01, 0x01,
+  0x65, 0x00, 0x5f, 0x90, 0x00, 0x01, 0x01, 0x7a, 0x00, 0x68, 0x09, 0x00,
+  0x02, 0x01, 0x6c, 0x00, 0x68, 0x09, 0x01, 0x70, 0x00, 0x0e, 0x15, 0x00,
+  0x02, 0x01, 0x63, 0x00, 0x85, 0xc5, 0x01, 0x64, 0x00, 0x68, 0x28, 0x00,
+  0x01, 0x01, 0x61, 0x00, 0x58, 0x9f, 0x00, 0x01, 0x01, 0x73, 0x00, 0x2b,
+  0x73, 0x00, 0x01, 0x01, 0x65, 0x00, 0xf5, 0x1c, 0x00, 0x01, 0x01, 0x6e,
+  0x00, 0x97, 0xc5, 0x00, 0x02, 0x01, 0x2d, 0x00, 0xd1, 0xbf, 0x02, 0x69,
+  0x72, 0x00, 0xf8, 0x99, 0x00, 0x02, 0x01, 0x2d, 0x00, 0xd1, 0xbf, 0x08,
+  0x6f, 0x79, 0x2d, 0x73, 0x65, 0x68, 0x63, 0x61, 0x00, 0x6b, 0x7d, 0x00,
+  0x02, 0x01, 0x2d, 0x00, 0xd1, 0xbf, 0x03, 0x61, 0x6c, 0x6c, 0x00, 0xf8,
+  0xa6, 0x00, 0x02, 0x01, 0x2d, 0x00, 0xd1, 0xbf, 0x01, 0x63, 0x00, 0xcb,
+  0xa7, 0x00, 0x02, 0x01, 0x65, 0x00, 0xf5, 0x2a, 0x01, 0x6f, 0x00, 0xf8,
+  0xb4, 0x00, 0x03, 0x01, 0x2d, 0x00, 0x62, 0xa3, 0x05, 0x64, 0x72, 0x61,
+  0x69, 0x77, 0x00, 0x96, 0x4c, 0x01, 0x6f, 0x00, 0xf8, 0xbb, 0x00, 0x01,
+  0x05, 0x74, 0x69, 0x72, 0x75, 0x63, 0x00, 0x32, 0x52, 0x00, 0x02, 0x01,
+  0x2d, 0x00, 0xd1, 0xbf, 0x01, 0x76, 0x00, 0x97, 0xbe, 0x00, 0x02, 0x04,
+  0x6b, 0x72, 0x6f, 0x77, 0x00, 0x31, 0x9e, 0x01, 0x79, 0x00, 0xcf, 0x6a,
+  0x00, 0x01, 0x01, 0x66, 0x00, 0xec, 0xfd, 0x00, 0x05, 0x01, 0x63, 0x00,
+  0x62, 0xe7, 0x08, 0x69, 0x66, 0x69, 0x74, 0x72, 0x65, 0x63, 0x2d, 0x00,
+  0xf8, 0xc2, 0x02, 0x6c, 0x6c, 0x00, 0xf8, 0xd0, 0x0d, 0x72, 0x65, 0x77,
+  0x6f, 0x70, 0x65, 0x6e, 0x69, 0x67, 0x6e, 0x65, 0x70, 0x77, 0x00, 0xf8,
+  0xdc, 0x06, 0x74, 0x73, 0x6f, 0x68, 0x65, 0x63, 0x00, 0xf8, 0xe4, 0x00,
+  0x02, 0x01, 0x2d, 0x00, 0xd1, 0xbf, 0x09, 0x72, 0x67, 0x65, 0x76, 0x69,
+  0x73, 0x73, 0x61, 0x6d, 0x00, 0xdf, 0x78, 0x00, 0x02, 0x01, 0x2d, 0x00,
+  0xd1, 0xbf, 0x0a, 0x61, 0x62, 0x65, 0x68, 0x74, 0x2d, 0x68, 0x74, 0x69,
+  0x77, 0x00, 0xbd, 0x57, 0x00, 0x09, 0x07, 0x2d, 0x6e, 0x6f, 0x69, 0x74,
+  0x61, 0x74, 0x00, 0xde, 0x82, 0x01, 0x68, 0x00, 0x1d, 0x1c, 0x06, 0x69,
+  0x61, 0x66, 0x61, 0x77, 0x2e, 0x00, 0xf8, 0xec, 0x08, 0x6d, 0x65, 0x61,
+  0x65, 0x62, 0x6f, 0x64, 0x61, 0x00, 0xf8, 0xf8, 0x03, 0x6e, 0x65, 0x76,
+  0x00, 0x62, 0x9c, 0x06, 0x70, 0x61, 0x6e, 0x71, 0x79, 0x6d, 0x00, 0xf8,
+  0xff, 0x09, 0x73, 0x6d, 0x65, 0x74, 0x73, 0x79, 0x73, 0x74, 0x75, 0x00,
+  0x41, 0x08, 0x02, 0x74, 0x65, 0x00, 0xf9, 0x06, 0x03, 0x76, 0x65, 0x64,
+  0x00, 0xf9, 0x0e, 0x00, 0x01, 0x01, 0x72, 0x00, 0xf9, 0x1a, 0x00, 0x01,
+  0x01, 0x68, 0x00, 0xf7, 0xf3, 0x00, 0x01, 0x01, 0x2d, 0x00, 0x62, 0xa3,
+  0x01, 0x02, 0x01, 0x2d, 0x00, 0xd1, 0xbf, 0x01, 0x6f, 0x00, 0xf9, 0x21,
+  0x00, 0x02, 0x01, 0x2d, 0x00, 0x62, 0xa3, 0x01, 0x73, 0x00, 0xcf, 0x08,
+  0x00, 0x01, 0x01, 0x68, 0x00, 0xcf, 0x01, 0x00, 0x02, 0x02, 0x64, 0x65,
+  0x00, 0xd2, 0x7d, 0x06, 0x6e, 0x61, 0x68, 0x63, 0x78, 0x65, 0x00, 0xcf,
+  0x01, 0x00, 0x02, 0x02, 0x68, 0x63, 0x00, 0xf9, 0x2d, 0x02, 0x70, 0x2d,
+  0x00, 0xd6, 0x22, 0x00, 0x02, 0x03, 0x61, 0x75, 0x71, 0x00, 0xcf, 0x01,
+  0x0b, 0x69, 0x72, 0x74, 0x73, 0x72, 0x65, 0x74, 0x6e, 0x75, 0x6f, 0x63,
+  0x00, 0xcf, 0x01, 0x00, 0x02, 0x05, 0x62, 0x69, 0x74, 0x70, 0x61, 0x00,
+  0x91, 0x20, 0x04, 0x67, 0x6f, 0x6f, 0x67, 0x00, 0xd0, 0x4e, 0x00, 0x03,
+  0x01, 0x61, 0x00, 0xf5, 0x4a, 0x03, 0x69, 0x6e, 0x61, 0x00, 0xf9, 0x34,
+  0x03, 0x6f, 0x68, 0x2d, 0x00, 0xf9, 0x3f, 0x00, 0x03, 0x01, 0x2d, 0x00,
+  0xd1, 0xbf, 0x04, 0x69, 0x6c, 0x6e, 0x6f, 0x00, 0xf9, 0x4c, 0x02, 0x6f,
+  0x67, 0x00, 0xbd, 0x57, 0x00, 0x03, 0x08, 0x61, 0x6c, 0x66, 0x64, 0x75,
+  0x6f, 0x6c, 0x63, 0x00, 0xe5, 0x6b, 0x0c, 0x65, 0x68, 0x77, 0x79, 0x6e,
+  0x61, 0x6e, 0x6f, 0x68, 0x74, 0x79, 0x70, 0x00, 0xf9, 0x58, 0x03, 0x69,
+  0x68, 0x63, 0x00, 0x83, 0x3b, 0x00, 0x01, 0x01, 0x6e, 0x00, 0xcb, 0xa7,
+  0x00, 0x04, 0x01, 0x69, 0x00, 0xf9, 0x5f, 0x04, 0x6f, 0x6d, 0x65, 0x72,
+  0x00, 0xd0, 0x55, 0x05, 0x75, 0x70, 0x6d, 0x6f, 0x63, 0x00, 0x6f, 0xb0,
+  0x01, 0x79, 0x00, 0xc6, 0xdc, 0x00, 0x02, 0x0a, 0x61, 0x6c, 0x73, 0x2d,
+  0x65, 0x6c, 0x63, 0x69, 0x62, 0x75, 0x00, 0xf5, 0x72, 0x01, 0x69, 0x00,
+  0xf9, 0x6e, 0x00, 0x03, 0x03, 0x61, 0x6d, 0x6b, 0x00, 0xf9, 0x81, 0x02,
+  0x65, 0x65, 0x00, 0x43, 0xbf, 0x01, 0x69, 0x00, 0x4c, 0x3f, 0x00, 0x04,
+  0x05, 0x67, 0x61, 0x74, 0x73, 0x2d, 0x00, 0xf9, 0x88, 0x01, 0x6b, 0x00,
+  0xa0, 0x8f, 0x04, 0x72, 0x6f, 0x62, 0x73, 0x00, 0xf9, 0x98, 0x06, 0x74,
+  0x73, 0x6f, 0x68, 0x2d, 0x62, 0x00, 0xc8, 0xd3, 0x00, 0x02, 0x01, 0x66,
+  0x00, 0xf9, 0x9f, 0x02, 0x6c, 0x62, 0x00, 0xf9, 0xa6, 0x02, 0x01, 0x01,
+  0x2e, 0x00, 0xf9, 0xb9, 0x00, 0x01, 0x01, 0x74, 0x00, 0x9b, 0x99, 0x00,
+  0x02, 0x04, 0x61, 0x65, 0x72, 0x6f, 0x00, 0xf9, 0xca, 0x02, 0x64, 0x65,
+  0x00, 0x6d, 0x80, 0x00, 0x02, 0x03, 0x69, 0x68, 0x63, 0x00, 0x9b, 0x75,
+  0x03, 0x6e, 0x69, 0x6c, 0x00, 0x9b, 0x75, 0x00, 0x01, 0x01, 0x6d, 0x00,
+  0x83, 0x21, 0x00, 0x02, 0x01, 0x2d, 0x00, 0xd1, 0xbf, 0x05, 0x65, 0x72,
+  0x66, 0x6f, 0x63, 0x00, 0x9d, 0x15, 0x00, 0x01, 0x01, 0x73, 0x00, 0xbd,
+  0x57, 0x00, 0x02, 0x01, 0x2d, 0x00, 0xf5, 0x79, 0x01, 0x73, 0x00, 0xcf,
+  0x08, 0x01, 0x01, 0x01, 0x2e, 0x00, 0xf9, 0xd1, 0x00, 0x02, 0x07, 0x61,
+  0x64, 0x68, 0x74, 0x69, 0x77, 0x74, 0x00, 0xf9, 0xe9, 0x02, 0x6f, 0x77,
+  0x00, 0xf9, 0xf1, 0x00, 0x03, 0x01, 0x2d, 0x00, 0xd1, 0xbf, 0x01, 0x63,
+  0x00, 0xee, 0xb1, 0x01, 0x72, 0x00, 0xfa, 0x06, 0x00, 0x02, 0x01, 0x2d,
+  0x00, 0xd1, 0xbf, 0x02, 0x61, 0x6d, 0x00, 0xfa, 0x0e, 0x00, 0x02, 0x06,
+  0x65, 0x63, 0x65, 0x6c, 0x66, 0x66, 0x00, 0x83, 0x34, 0x09, 0x75, 0x66,
+  0x2d, 0x79, 0x74, 0x6e, 0x75, 0x6f, 0x62, 0x00, 0xfa, 0x1f, 0x00, 0x01,
+  0x02, 0x73, 0x77, 0x00, 0x26, 0xd7, 0x00, 0x02, 0x05, 0x69, 0x68, 0x77,
+  0x79, 0x61, 0x00, 0x98, 0xd3, 0x02, 0x75, 0x2d, 0x00, 0xfa, 0x27, 0x00,
+  0x01, 0x01, 0x6b, 0x00, 0xfa, 0x34, 0x00, 0x01, 0x01, 0x65, 0x00, 0xc6,
+  0x49, 0x00, 0x01, 0x01, 0x2e, 0x00, 0x9b, 0x75, 0x00, 0x02, 0x04, 0x70,
+  0x79, 0x74, 0x2e, 0x00, 0x67, 0x81, 0x07, 0x72, 0x65, 0x72, 0x61, 0x63,
+  0x2d, 0x68, 0x00, 0x74, 0x16, 0x00, 0x01, 0x03, 0x2d, 0x79, 0x6c, 0x00,
+  0xc9, 0x63, 0x00, 0x03, 0x07, 0x63, 0x69, 0x6c, 0x62, 0x75, 0x70, 0x65,
+  0x00, 0xfa, 0x3b, 0x01, 0x66, 0x00, 0xfa, 0x42, 0x01, 0x69, 0x00, 0xfa,
+  0x56, 0x00, 0x03, 0x03, 0x68, 0x73, 0x75, 0x00, 0xc7, 0x78, 0x01, 0x75,
+  0x00, 0xf3, 0xc7, 0x03, 0x78, 0x69, 0x72, 0x00, 0xfa, 0x69, 0x00, 0x01,
+  0x01, 0x67, 0x00, 0xcb, 0xa7, 0x00, 0x04, 0x06, 0x65, 0x68, 0x74, 0x6e,
+  0x61, 0x70, 0x00, 0x69, 0xc9, 0x02, 0x69, 0x73, 0x00, 0xfa, 0x72, 0x01,
+  0x72, 0x00, 0xfa, 0x7f, 0x01, 0x73, 0x00, 0xfa, 0x93, 0x00, 0x01, 0x01,
+  0x64, 0x00, 0x97, 0xbe, 0x00, 0x01, 0x02, 0x74, 0x73, 0x00, 0x92, 0x51,
+  0x00, 0x02, 0x01, 0x2d, 0x00, 0xd1, 0xbf, 0x06, 0x65, 0x64, 0x2d, 0x62,
+  0x61, 0x6c, 0x00, 0x49, 0x58, 0x01, 0x01, 0x04, 0x69, 0x6c, 0x6f, 0x78,
+  0x00, 0x29, 0xae, 0x00, 0x01, 0x01, 0x76, 0x00, 0xfa, 0xa6, 0x00, 0x01,
+  0x02, 0x74, 0x61, 0x00, 0xd2, 0xd5, 0x00, 0x05, 0x01, 0x2d, 0x00, 0x62,
+  0xa3, 0x01, 0x66, 0x00, 0xc9, 0x11, 0x01, 0x6f, 0x00, 0xeb, 0xce, 0x04,
+  0x72, 0x75, 0x6f, 0x79, 0x00, 0xfa, 0xad, 0x02, 0x79, 0x6d, 0x00, 0xfa,
+  0xbb, 0x00, 0x09, 0x01, 0x2d, 0x00, 0x90, 0xd5, 0x04, 0x61, 0x6e, 0x69,
+  0x73, 0x00, 0xfa, 0xc7, 0x04, 0x65, 0x73, 0x61, 0x62, 0x00, 0xc2, 0x48,
+  0x01, 0x6b, 0x00, 0xc7, 0xf8, 0x01, 0x6c, 0x00, 0xf8, 0xd0, 0x06, 0x6f,
+  0x69, 0x66, 0x69, 0x6c, 0x61, 0x00, 0x60, 0x53, 0x01, 0x72, 0x00, 0xfa,
+  0xce, 0x01, 0x74, 0x00, 0xfa, 0xe0, 0x01, 0x75, 0x00, 0xd2, 0x53, 0x00,
+  0x02, 0x01, 0x66, 0x00, 0xcf, 0x01, 0x01, 0x74, 0x00, 0xd0, 0x74, 0x01,
+  0x02, 0x01, 0x2d, 0x00, 0xd1, 0xbf, 0x05, 0x74, 0x73, 0x6b, 0x63, 0x6f,
+  0x00, 0xfa, 0x3b, 0x00, 0x0d, 0x01, 0x64, 0x00, 0xfa, 0xf0, 0x01, 0x65,
+  0x00, 0xfa, 0xff, 0x04, 0x67, 0x67, 0x6f, 0x6c, 0x00, 0xfb, 0x0d, 0x01,
+  0x68, 0x00, 0xfb, 0x14, 0x08, 0x6b, 0x72, 0x6f, 0x77, 0x2d, 0x64, 0x72,
+  0x61, 0x00, 0xfb, 0x28, 0x01, 0x6e, 0x00, 0xfb, 0x2f, 0x01, 0x70, 0x00,
+  0xfb, 0x3e, 0x03, 0x72, 0x65, 0x74, 0x00, 0xf5, 0x5f, 0x03, 0x73, 0x75,
+  0x62, 0x00, 0x8d, 0x58, 0x02, 0x74, 0x6e, 0x00, 0xfb, 0x53, 0x04, 0x76,
+  0x72, 0x65, 0x73, 0x00, 0xfb, 0x65, 0x01, 0x79, 0x00, 0xfb, 0x7c, 0x0b,
+  0x7a, 0x69, 0x6c, 0x69, 0x62, 0x6f, 0x6d, 0x64, 0x65, 0x65, 0x70, 0x00,
+  0xc7, 0xf1, 0x00, 0x03, 0x01, 0x2d, 0x00, 0xd1, 0xbf, 0x0e, 0x73, 0x69,
+  0x76, 0x64, 0x61, 0x6c, 0x61, 0x69, 0x63, 0x6e, 0x61, 0x6e, 0x69, 0x66,
+  0x00, 0xcb, 0xa7, 0x01, 0x74, 0x00, 0xfb, 0x89, 0x00, 0x03, 0x04, 0x61,
+  0x73, 0x2d, 0x6f, 0x00, 0x62, 0xaa, 0x01, 0x65, 0x00, 0xfb, 0xa9, 0x03,
+  0x6f, 0x6d, 0x75, 0x00, 0xd0, 0x74, 0x00, 0x04, 0x02, 0x61, 0x70, 0x00,
+  0x2c, 0x17, 0x01, 0x69, 0x00, 0xf5, 0xad, 0x01, 0x6e, 0x00, 0xf5, 0xb5,
+  0x04, 0x76, 0x6e, 0x61, 0x63, 0x00, 0x5c, 0xd3, 0x00, 0x01, 0x01, 0x62,
+  0x00, 0xcf, 0x01, 0x00, 0x02, 0x01, 0x70, 0x00, 0xfb, 0xc1, 0x09, 0x74,
+  0x63, 0x61, 0x74, 0x79, 0x74, 0x69, 0x72, 0x75, 0x00, 0x6b, 0xde, 0x00,
+  0x01, 0x01, 0x79, 0x00, 0xf5, 0xc4, 0x00, 0x05, 0x01, 0x63, 0x00, 0xfb,
+  0xcd, 0x07, 0x69, 0x74, 0x69, 0x6c, 0x69, 0x74, 0x75, 0x00, 0xf1, 0xe9,
+  0x0b, 0x6c, 0x61, 0x68, 0x77, 0x2d, 0x65, 0x68, 0x74, 0x2d, 0x73, 0x65,
+  0x00, 0xfb, 0xec, 0x03, 0x6d, 0x61, 0x67, 0x00, 0xf9, 0x34, 0x01, 0x74,
+  0x00, 0xfb, 0xf3, 0x00, 0x02, 0x04, 0x65, 0x72, 0x61, 0x6c, 0x00, 0xfc,
+  0x03, 0x01, 0x66, 0x00, 0x0f, 0xfa, 0x00, 0x02, 0x03, 0x68, 0x74, 0x32,
+  0x00, 0xbd, 0x22, 0x02, 0x70, 0x61, 0x00, 0xfc, 0x0a, 0x00, 0x03, 0x01,
+  0x2d, 0x00, 0xd1, 0xbf, 0x05, 0x61, 0x65, 0x72, 0x66, 0x2d, 0x00, 0x23,
+  0xda, 0x04, 0x63, 0x6f, 0x6c, 0x62, 0x00, 0xfc, 0x1a, 0x00, 0x02, 0x01,
+  0x2d, 0x00, 0xd1, 0xbf, 0x02, 0x63, 0x78, 0x00, 0x35, 0xb8, 0x00, 0x04,
+  0x01, 0x64, 0x00, 0xfc, 0x26, 0x01, 0x6b, 0x00, 0xc8, 0x96, 0x01, 0x6e,
+  0x00, 0xaa, 0x23, 0x05, 0x6f, 0x6f, 0x74, 0x72, 0x61, 0x00, 0xfc, 0x4a,
+  0x00, 0x02, 0x02, 0x2d, 0x78, 0x00, 0xfc, 0x51, 0x01, 0x78, 0x00, 0xfc,
+  0x51, 0x00, 0x03, 0x01, 0x2d, 0x00, 0xa8, 0xc4, 0x01, 0x72, 0x00, 0xfc,
+  0x58, 0x01, 0x74, 0x00, 0xfc, 0x62, 0x00, 0x02, 0x01, 0x61, 0x00, 0xfc,
+  0x4a, 0x01, 0x65, 0x00, 0xfc, 0x6e, 0x00, 0x02, 0x01, 0x65, 0x00, 0xfc,
+  0x89, 0x03, 0x69, 0x62, 0x6f, 0x00, 0xd2, 0xd5, 0x00, 0x03, 0x05, 0x63,
+  0x65, 0x6a, 0x62, 0x6f, 0x00, 0xfc, 0x97, 0x0a, 0x6e, 0x65, 0x6d, 0x65,
+  0x6c, 0x65, 0x70, 0x69, 0x75, 0x71, 0x00, 0x14, 0x4a, 0x0c, 0x73, 0x61,
+  0x65, 0x62, 0x2d, 0x63, 0x69, 0x68, 0x74, 0x79, 0x6d, 0x2e, 0x00, 0xfc,
+  0xaa, 0x00, 0x05, 0x02, 0x31, 0x2d, 0x00, 0xfc, 0xd4, 0x04, 0x32, 0x2d,
+  0x74, 0x73, 0x00, 0xfc, 0xed, 0x01, 0x33, 0x00, 0xfc, 0xfc, 0x02, 0x62,
+  0x6c, 0x00, 0xed, 0x5b, 0x01, 0x65, 0x00, 0xc9, 0x2d, 0x00, 0x01, 0x01,
+  0x65, 0x00, 0xfd, 0x0a, 0x00, 0x02, 0x01, 0x2d, 0x00, 0xd1, 0xbf, 0x09,
+  0x65, 0x74, 0x65, 0x64, 0x61, 0x74, 0x61, 0x64, 0x2e, 0x00, 0xfd, 0x11,
+  0x00, 0x02, 0x01, 0x2d, 0x00, 0x39, 0x21, 0x04, 0x72, 0x65, 0x62, 0x75,
+  0x00, 0xbd, 0x57, 0x01, 0x01, 0x01, 0x62, 0x00, 0xf7, 0x72, 0x00, 0x02,
+  0x06, 0x61, 0x74, 0x6e, 0x75, 0x6f, 0x63, 0x00, 0xfd, 0x1d, 0x01, 0x65,
+  0x00, 0xfd, 0x24, 0x00, 0x03, 0x01, 0x65, 0x00, 0xc8, 0x8f, 0x01, 0x67,
+  0x00, 0x35, 0xb8, 0x03, 0x70, 0x70, 0x61, 0x00, 0xfd, 0x4c, 0x00, 0x02,
+  0x01, 0x69, 0x00, 0xfd, 0x53, 0x02, 0x6f, 0x68, 0x00, 0xfd, 0x7c, 0x00,
+  0x02, 0x01, 0x2d, 0x00, 0xd1, 0xbf, 0x08, 0x6e, 0x79, 0x65, 0x6b, 0x63,
+  0x6f, 0x68, 0x2d, 0x00, 0xfd, 0x89, 0x00, 0x01, 0x04, 0x72, 0x6f, 0x66,
+  0x2d, 0x00, 0xf5, 0x51, 0x00, 0x01, 0x01, 0x73, 0x00, 0x39, 0x21, 0x01,
+  0x01, 0x01, 0x75, 0x00, 0xd2, 0xb2, 0x00, 0x02, 0x07, 0x6c, 0x70, 0x77,
+  0x6f, 0x6e, 0x73, 0x2d, 0x00, 0xe5, 0x6b, 0x01, 0x7a, 0x00, 0x41, 0xf9,
+  0x00, 0x02, 0x01, 0x6e, 0x00, 0xf7, 0x1c, 0x01, 0x72, 0x00, 0xfa, 0x69,
+  0x00, 0x01, 0x01, 0x61, 0x00, 0xc6, 0x57, 0x00, 0x03, 0x03, 0x62, 0x6e,
+  0x78, 0x00, 0xfd, 0x90, 0x01, 0x6c, 0x00, 0xfd, 0x97, 0x01, 0x77, 0x00,
+  0xf0, 0x11, 0x00, 0x01, 0x03, 0x73, 0x65, 0x6b, 0x00, 0x17, 0xbd, 0x00,
+  0x01, 0x02, 0x6f, 0x68, 0x00, 0xf7, 0xd4, 0x00, 0x02, 0x01, 0x2d, 0x00,
+  0xd1, 0xbf, 0x05, 0x6e, 0x69, 0x6b, 0x73, 0x69, 0x00, 0x69, 0xb6, 0x00,
+  0x02, 0x0a, 0x63, 0x65, 0x72, 0x69, 0x64, 0x65, 0x76, 0x69, 0x74, 0x63,
+  0x00, 0xfd, 0xa5, 0x03, 0x73, 0x69, 0x74, 0x00, 0x35, 0x0c, 0x01, 0x01,
+  0x01, 0x67, 0x00, 0xfd, 0xac, 0x00, 0x02, 0x05, 0x61, 0x6c, 0x61, 0x67,
+  0x6b, 0x00, 0x92, 0xe7, 0x03, 0x6f, 0x72, 0x70, 0x00, 0xfd, 0xb3, 0x00,
+  0x01, 0x01, 0x6f, 0x00, 0x2b, 0xef, 0x00, 0x02, 0x01, 0x69, 0x00, 0xfd,
+  0xc5, 0x03, 0x72, 0x6f, 0x6c, 0x00, 0xb1, 0x86, 0x00, 0x03, 0x01, 0x61,
+  0x00, 0xde, 0x73, 0x09, 0x65, 0x6e, 0x6f, 0x6d, 0x61, 0x6c, 0x65, 0x64,
+  0x61, 0x00, 0xc4, 0xb6, 0x01, 0x69, 0x00, 0xec, 0x07, 0x00, 0x02, 0x05,
+  0x72, 0x61, 0x61, 0x69, 0x68, 0x00, 0xfd, 0xd2, 0x04, 0x73, 0x72, 0x65,
+  0x64, 0x00, 0x70, 0xbd, 0x00, 0x02, 0x05, 0x68, 0x61, 0x6e, 0x6e, 0x61,
+  0x00, 0xfb, 0xec, 0x06, 0x6f, 0x6f, 0x6e, 0x61, 0x74, 0x74, 0x00, 0xec,
+  0x91, 0x00, 0x01, 0x01, 0x61, 0x00, 0x26, 0xe5, 0x00, 0x09, 0x02, 0x61,
+  0x75, 0x00, 0xfd, 0xdc, 0x06, 0x62, 0x6d, 0x75, 0x6c, 0x6f, 0x63, 0x00,
+  0xfd, 0xe3, 0x01, 0x64, 0x00, 0x5d, 0xb5, 0x01, 0x67, 0x00, 0xf4, 0x4a,
+  0x01, 0x68, 0x00, 0xfd, 0xd2, 0x01, 0x6c, 0x00, 0xfd, 0xed, 0x01, 0x6e,
+  0x00, 0xfd, 0xfc, 0x02, 0x73, 0x73, 0x00, 0x58, 0x64, 0x03, 0x74, 0x73,
+  0x6f, 0x00, 0xf4, 0xa2, 0x00, 0x02, 0x01, 0x6c, 0x00, 0x26, 0xd7, 0x02,
+  0x72, 0x62, 0x00, 0x22, 0x26, 0x00, 0x03, 0x03, 0x6c, 0x6f, 0x6a, 0x00,
+  0x29, 0x5f, 0x04, 0x71, 0x2d, 0x73, 0x6e, 0x00, 0x2a, 0xfa, 0x06, 0x75,
+  0x6f, 0x73, 0x73, 0x69, 0x6d, 0x00, 0xfe, 0x0c, 0x00, 0x03, 0x01, 0x61,
+  0x00, 0xfe, 0x13, 0x01, 0x65, 0x00, 0xd9, 0xa0, 0x01, 0x6f, 0x00, 0xfe,
+  0x1f, 0x00, 0x04, 0x01, 0x61, 0x00, 0xfe, 0x2b, 0x03, 0x65, 0x64, 0x61,
+  0x00, 0x85, 0x96, 0x06, 0x69, 0x6c, 0x6f, 0x72, 0x61, 0x63, 0x00, 0xfe,
+  0x37, 0x01, 0x6f, 0x00, 0x27, 0xfc, 0x00, 0x02, 0x05, 0x61, 0x62, 0x72,
+  0x61, 0x62, 0x00, 0xde, 0x52, 0x04, 0x65, 0x7a, 0x7a, 0x69, 0x00, 0xb3,
+  0x41, 0x00, 0x02, 0x03, 0x6e, 0x61, 0x6c, 0x00, 0x28, 0xce, 0x04, 0x6f,
+  0x73, 0x65, 0x6e, 0x00, 0x85, 0x88, 0x00, 0x01, 0x01, 0x68, 0x00, 0xfe,
+  0x3f, 0x00, 0x07, 0x07, 0x64, 0x65, 0x70, 0x6f, 0x6c, 0x63, 0x79, 0x00,
+  0xf9, 0xca, 0x03, 0x66, 0x69, 0x63, 0x00, 0x4c, 0x7f, 0x01, 0x68, 0x00,
+  0xfe, 0x46, 0x01, 0x6c, 0x00, 0x8d, 0x16, 0x01, 0x73, 0x00, 0x2b, 0x73,
+  0x01, 0x74, 0x00, 0xfe, 0x53, 0x01, 0x76, 0x00, 0x5d, 0xbc, 0x00, 0x04,
+  0x03, 0x64, 0x68, 0x67, 0x00, 0x53, 0x44, 0x03, 0x65, 0x74, 0x73, 0x00,
+  0xfe, 0x6c, 0x01, 0x6d, 0x00, 0x0e, 0x15, 0x03, 0x6f, 0x72, 0x6c, 0x00,
+  0xfe, 0x73, 0x00, 0x02, 0x01, 0x72, 0x00, 0x2c, 0x9b, 0x09, 0x75, 0x6c,
+  0x65, 0x67, 0x6e, 0x65, 0x64, 0x6c, 0x65, 0x00, 0x73, 0x35, 0x00, 0x02,
+  0x01, 0x61, 0x00, 0xfe, 0x7a, 0x01, 0x75, 0x00, 0xfe, 0x81, 0x00, 0x02,
+  0x03, 0x61, 0x75, 0x67, 0x00, 0x2e, 0x67, 0x03, 0x6f, 0x66, 0x78, 0x00,
+  0x41, 0x08, 0x00, 0x04, 0x01, 0x61, 0x00, 0xfe, 0x9c, 0x01, 0x6e, 0x00,
+  0xfe, 0xa8, 0x01, 0x70, 0x00, 0x9e, 0x58, 0x01, 0x72, 0x00, 0x3f, 0xd8,
+  0x00, 0x02, 0x05, 0x6e, 0x75, 0x6b, 0x6e, 0x65, 0x00, 0x40, 0xea, 0x04,
+  0x72, 0x65, 0x76, 0x61, 0x00, 0xb9, 0x90, 0x00, 0x02, 0x01, 0x72, 0x00,
+  0x16, 0x7b, 0x03, 0x74, 0x73, 0x75, 0x00, 0x52, 0x55, 0x00, 0x02, 0x01,
+  0x61, 0x00, 0xba, 0x4a, 0x03, 0x69, 0x6c, 0x64, 0x00, 0x3d, 0x7c, 0x00,
+  0x03, 0x01, 0x61, 0x00, 0xfe, 0xb4, 0x04, 0x64, 0x69, 0x72, 0x62, 0x00,
+  0x28, 0x6d, 0x01, 0x72, 0x00, 0x58, 0xaf, 0x00, 0x02, 0x01, 0x63, 0x00,
+  0x6d, 0x35, 0x03, 0x6e, 0x6f, 0x6c, 0x00, 0x6e, 0x41, 0x00, 0x06, 0x01,
+  0x61, 0x00, 0x15, 0x5e, 0x01, 0x62, 0x00, 0x5f, 0x90, 0x01, 0x63, 0x00,
+  0x85, 0x34, 0x01, 0x69, 0x00, 0xfe, 0xc4, 0x01, 0x6f, 0x00, 0x31, 0x6e,
+  0x01, 0x74, 0x00, 0xc4, 0xb6, 0x00, 0x03, 0x05, 0x61, 0x66, 0x66, 0x6f,
+  0x6c, 0x00, 0xf3, 0xa2, 0x02, 0x69, 0x74, 0x00, 0xfe, 0xd1, 0x03, 0x75,
+  0x74, 0x73, 0x00, 0x2f, 0x47, 0x00, 0x03, 0x03, 0x67, 0x6f, 0x6c, 0x00,
+  0x48, 0x25, 0x01, 0x69, 0x00, 0x6a, 0x38, 0x03, 0x72, 0x65, 0x63, 0x00,
+  0x12, 0xe2, 0x00, 0x05, 0x01, 0x61, 0x00, 0xfe, 0xd8, 0x01, 0x69, 0x00,
+  0xfe, 0xe8, 0x04, 0x6f, 0x6d, 0x69, 0x74, 0x00, 0xc6, 0x00, 0x02, 0x75,
+  0x74, 0x00, 0xfe, 0xf5, 0x02, 0x76, 0x75, 0x00, 0x46, 0x75, 0x00, 0x04,
+  0x03, 0x61, 0x62, 0x61, 0x00, 0x43, 0x01, 0x03, 0x69, 0x61, 0x63, 0x00,
+  0xff, 0x0d, 0x01, 0x73, 0x00, 0xff, 0x14, 0x03, 0x75, 0x6f, 0x68, 0x00,
+  0xff, 0x1b, 0x00, 0x03, 0x01, 0x61, 0x00, 0xff, 0x22, 0x03, 0x69, 0x6d,
+  0x65, 0x00, 0xff, 0x36, 0x03, 0x74, 0x65, 0x76, 0x00, 0x5c, 0xc5, 0x00,
+  0x02, 0x03, 0x71, 0x69, 0x68, 0x00, 0xfe, 0x46, 0x02, 0x76, 0x65, 0x00,
+  0xf3, 0x25, 0x00, 0x02, 0x02, 0x63, 0x61, 0x00, 0x9c, 0xc1, 0x02, 0x6f,
+  0x6d, 0x00, 0xc6, 0x0e, 0x00, 0x02, 0x01, 0x69, 0x00, 0xff, 0x3d, 0x06,
+  0x75, 0x6c, 0x6d, 0x6d, 0x61, 0x73, 0x00, 0xff, 0x6f, 0x00, 0x02, 0x03,
+  0x65, 0x62, 0x6e, 0x00, 0x9d, 0xdd, 0x01, 0x75, 0x00, 0xff, 0x77, 0x00,
+  0x01, 0x01, 0x74, 0x00, 0x5d, 0xbc, 0x00, 0x03, 0x01, 0x72, 0x00, 0xe8,
+  0x5e, 0x01, 0x73, 0x00, 0xff, 0x84, 0x01, 0x75, 0x00, 0x46, 0x7c, 0x00,
+  0x02, 0x01, 0x65, 0x00, 0x99, 0x3a, 0x06, 0x72, 0x75, 0x62, 0x73, 0x74,
+  0x74, 0x00, 0x29, 0xae, 0x00, 0x02, 0x01, 0x74, 0x00, 0xc9, 0x0a, 0x01,
+  0x77, 0x00, 0x1c, 0x89, 0x00, 0x03, 0x01, 0x6c, 0x00, 0xa9, 0x57, 0x02,
+  0x72, 0x6f, 0x00, 0xff, 0x8b, 0x02, 0x75, 0x6f, 0x00, 0xff, 0x97, 0x00,
+  0x02, 0x01, 0x6e, 0x00, 0x39, 0x05, 0x01, 0x73, 0x00, 0x0e, 0x15, 0x01,
+  0x01, 0x03, 0x72, 0x6f, 0x64, 0x00, 0xec, 0x23, 0x00, 0x01, 0x01, 0x6e,
+  0x00, 0x2b, 0x7a, 0x00, 0x02, 0x04, 0x6e, 0x69, 0x76, 0x6c, 0x00, 0x92,
+  0xe7, 0x03, 0x6f, 0x6c, 0x63, 0x00, 0xff, 0xa3, 0x00, 0x02, 0x01, 0x69,
+  0x00, 0x27, 0x0f, 0x02, 0x6f, 0x66, 0x00, 0x9c, 0xe4, 0x00, 0x02, 0x03,
+  0x72, 0x66, 0x65, 0x00, 0xff, 0xb5, 0x01, 0x74, 0x00, 0x0e, 0x15, 0x00,
+  0x02, 0x02, 0x61, 0x6d, 0x00, 0xff, 0xbc, 0x02, 0x6f, 0x79, 0x00, 0xff,
+  0xc9, 0x00, 0x09, 0x02, 0x63, 0x69, 0x00, 0xff, 0xd0, 0x02, 0x65, 0x72,
+  0x00, 0xdb, 0xb3, 0x02, 0x69, 0x72, 0x00, 0x6c, 0xec, 0x05, 0x6e, 0x6f,
+  0x69, 0x74, 0x61, 0x00, 0xff, 0xe9, 0x01, 0x6f, 0x00, 0x0f, 0xfa, 0x01,
+  0x72, 0x00, 0xff, 0xf5, 0x01, 0x74, 0x00, 0xdd, 0x1e, 0x01, 0x75, 0x00,
+  0xff, 0xfe, 0x01, 0x76, 0x00, 0x29, 0x66, 0x00, 0x03, 0x01, 0x6e, 0x00,
+  0xbc, 0xad, 0x01, 0x73, 0x01, 0x00, 0x05, 0x01, 0x75, 0x00, 0xff, 0xfe,
+  0x00, 0x02, 0x06, 0x61, 0x72, 0x74, 0x6e, 0x6f, 0x67, 0x01, 0x00, 0x11,
+  0x01, 0x73, 0x00, 0x64, 0xd8, 0x00, 0x03, 0x01, 0x61, 0x01, 0x00, 0x18,
+  0x01, 0x65, 0x01, 0x00, 0x2a, 0x01, 0x69, 0x01, 0x00, 0x39, 0x00, 0x03,
+  0x01, 0x62, 0x00, 0x5d, 0xae, 0x01, 0x6f, 0x00, 0x20, 0xed, 0x02, 0x74,
+  0x73, 0x00, 0xc9, 0x0a, 0x00, 0x03, 0x01, 0x64, 0x00, 0x3e, 0xa4, 0x01,
+  0x65, 0x00, 0x26, 0xc4, 0x01, 0x68, 0x01, 0x00, 0x45, 0x01, 0x01, 0x02,
+  0x75, 0x72, 0x00, 0x1c, 0x89, 0x00, 0x03, 0x01, 0x69, 0x00, 0x16, 0x9c,
+  0x01, 0x6f, 0x00, 0x3f, 0x51, 0x01, 0x75, 0x00, 0x0e, 0x15, 0x00, 0x01,
+  0x01, 0x61, 0x01, 0x00, 0x54, 0x00, 0x03, 0x0c, 0x65, 0x73, 0x75, 0x6d,
+  0x79, 0x72, 0x6f, 0x74, 0x73, 0x69, 0x68, 0x6c, 0x01, 0x00, 0x5d, 0x03,
+  0x69, 0x72, 0x61, 0x01, 0x00, 0x64, 0x05, 0x74, 0x65, 0x72, 0x6f, 0x62,
+  0x00, 0x44, 0x12, 0x00, 0x05, 0x01, 0x63, 0x01, 0x00, 0x72, 0x03, 0x67,
+  0x69, 0x68, 0x00, 0x89, 0x17, 0x01, 0x69, 0x01, 0x00, 0x7d, 0x04, 0x6d,
+  0x66, 0x6f, 0x65, 0x00, 0x84, 0x83, 0x07, 0x77, 0x65, 0x68, 0x63, 0x74,
+  0x61, 0x6b, 0x01, 0x00, 0x8b, 0x00, 0x07, 0x01, 0x64, 0x01, 0x00, 0x92,
+  0x05, 0x67, 0x61, 0x68, 0x6e, 0x65, 0x00, 0x9c, 0x7d, 0x03, 0x68, 0x63,
+  0x6e, 0x01, 0x00, 0xa6, 0x03, 0x6c, 0x61, 0x66, 0x01, 0x00, 0xad, 0x0d,
+  0x70, 0x70, 0x61, 0x68, 0x63, 0x73, 0x6e, 0x65, 0x74, 0x65, 0x77, 0x72,
+  0x75, 0x00, 0xc9, 0x26, 0x01, 0x72, 0x01, 0x00, 0xb4, 0x02, 0x73, 0x73,
+  0x01, 0x00, 0xc6, 0x01, 0x01, 0x02, 0x64, 0x6e, 0x01, 0x00, 0xcd, 0x00,
+  0x02, 0x02, 0x61, 0x62, 0x01, 0x00, 0xd9, 0x01, 0x6f, 0x01, 0x00, 0xe2,
+  0x00, 0x02, 0x01, 0x6c, 0x00, 0x41, 0xdc, 0x01, 0x74, 0x01, 0x00, 0xe9,
+  0x00, 0x02, 0x01, 0x6f, 0x00, 0x15, 0x5e, 0x05, 0x75, 0x72, 0x62, 0x6e,
+  0x65, 0x00, 0x85, 0xcc, 0x00, 0x06, 0x01, 0x64, 0x00, 0x42, 0x1d, 0x01,
+  0x67, 0x01, 0x00, 0x11, 0x01, 0x69, 0x01, 0x00, 0xf0, 0x01, 0x72, 0x00,
+  0x2a, 0x10, 0x01, 0x73, 0x01, 0x00, 0xfc, 0x01, 0x74, 0x01, 0x01, 0x16,
+  0x00, 0x02, 0x01, 0x65, 0x01, 0x01, 0x2a, 0x04, 0x6f, 0x62, 0x72, 0x65,
+  0x00, 0xc1, 0x37, 0x00, 0x03, 0x02, 0x65, 0x64, 0x00, 0x67, 0x73, 0x04,
+  0x69, 0x78, 0x65, 0x6d, 0x01, 0x01, 0x45, 0x07, 0x73, 0x69, 0x63, 0x6e,
+  0x61, 0x72, 0x66, 0x00, 0x38, 0x94, 0x00, 0x01, 0x01, 0x6c, 0x00, 0x4c,
+  0x7f, 0x00, 0x02, 0x01, 0x61, 0x01, 0x01, 0x4c, 0x02, 0x65, 0x69, 0x00,
+  0x3b, 0x02, 0x00, 0x03, 0x03, 0x63, 0x61, 0x64, 0x00, 0xf4, 0xb5, 0x02,
+  0x64, 0x69, 0x00, 0x5d, 0x17, 0x02, 0x72, 0x61, 0x00, 0xd1, 0x98, 0x00,
+  0x01, 0x01, 0x74, 0x00, 0x6b, 0x45, 0x00, 0x01, 0x01, 0x69, 0x01, 0x01,
+  0x58, 0x00, 0x02, 0x01, 0x68, 0x01, 0x01, 0x5f, 0x07, 0x69, 0x65, 0x6e,
+  0x61, 0x6a, 0x65, 0x64, 0x00, 0xec, 0x15, 0x01, 0x02, 0x01, 0x64, 0x00,
+  0x64, 0x4f, 0x01, 0x6c, 0x01, 0x01, 0x66, 0x00, 0x06, 0x01, 0x62, 0x01,
+  0x01, 0x6e, 0x01, 0x69, 0x01, 0x01, 0x7a, 0x07, 0x6c, 0x6c, 0x69, 0x6d,
+  0x73, 0x69, 0x77, 0x00, 0x16, 0xd4, 0x06, 0x6e, 0x61, 0x6b, 0x73, 0x69,
+  0x7a, 0x00, 0xff, 0x0d, 0x04, 0x70, 0x61, 0x70, 0x73, 0x01, 0x01, 0x45,
+  0x01, 0x74, 0x01, 0x01, 0x81, 0x01, 0x01, 0x01, 0x6e, 0x00, 0xc9, 0x55,
+  0x00, 0x01, 0x01, 0x62, 0x00, 0x29, 0x5f, 0x00, 0x03, 0x04, 0x61, 0x73,
+  0x6f, 0x6e, 0x00, 0x91, 0xf4, 0x01, 0x6f, 0x00, 0xdc, 0x14, 0x04, 0x74,
+  0x61, 0x6b, 0x69, 0x00, 0xa0, 0x17, 0x00, 0x02, 0x01, 0x6c, 0x01, 0x01,
+  0x9e, 0x01, 0x78, 0x00, 0x6b, 0x7d, 0x00, 0x02, 0x01, 0x6b, 0x00, 0x0e,
+  0x15, 0x04, 0x70, 0x61, 0x72, 0x64, 0x00, 0xe6, 0x55, 0x00, 0x08, 0x06,
+  0x63, 0x6e, 0x65, 0x69, 0x63, 0x73, 0x01, 0x01, 0xaa, 0x01, 0x64, 0x00,
+  0x27, 0x01, 0x04, 0x68, 0x63, 0x73, 0x69, 0x01, 0x01, 0xb1, 0x06, 0x69,
+  0x74, 0x69, 0x6e, 0x61, 0x6d, 0x00, 0x85, 0x1f, 0x01, 0x6c, 0x01, 0x01,
+  0xc9, 0x01, 0x72, 0x01, 0x01, 0xdd, 0x04, 0x73, 0x75, 0x6f, 0x68, 0x01,
+  0x01, 0xe9, 0x01, 0x75, 0x01, 0x01, 0xf0, 0x00, 0x04, 0x04, 0x6c, 0x6f,
+  0x70, 0x61, 0x01, 0x01, 0xfc, 0x01, 0x72, 0x00, 0x4c, 0x7f, 0x05, 0x75,
+  0x6f, 0x6c, 0x74, 0x6e, 0x01, 0x02, 0x04, 0x01, 0x78, 0x00, 0x26, 0xd7,
+  0x00, 0x02, 0x02, 0x65, 0x73, 0x00, 0x85, 0x81, 0x01, 0x6c, 0x00, 0x2c,
+  0x17, 0x00, 0x01, 0x03, 0x61, 0x6e, 0x6f, 0x01, 0x02, 0x0b, 0x00, 0x03,
+  0x01, 0x61, 0x01, 0x02, 0x12, 0x01, 0x65, 0x01, 0x02, 0x1e, 0x02, 0x6f,
+  0x69, 0x01, 0x02, 0x26, 0x00, 0x05, 0x02, 0x64, 0x6e, 0x00, 0x60, 0xb6,
+  0x01, 0x6c, 0x01, 0x02, 0x3b, 0x01, 0x6d, 0x00, 0x85, 0xf3, 0x01, 0x6e,
+  0x00, 0x39, 0x28, 0x04, 0x74, 0x6e, 0x65, 0x63, 0x01, 0x02, 0x42, 0x00,
+  0x02, 0x01, 0x61, 0x00, 0x43, 0xbf, 0x01, 0x65, 0x00, 0x13, 0x4d, 0x00,
+  0x04, 0x04, 0x66, 0x61, 0x72, 0x63, 0x01, 0x02, 0x49, 0x01, 0x6e, 0x00,
+  0xb9, 0x62, 0x01, 0x6f, 0x01, 0x02, 0x53, 0x02, 0x72, 0x61, 0x01, 0x02,
+  0x5a, 0x00, 0x02, 0x01, 0x62, 0x01, 0x02, 0x6c, 0x02, 0x63, 0x72, 0x00,
+  0x2b, 0x7a, 0x00, 0x01, 0x01, 0x72, 0x00, 0x92, 0x51, 0x00, 0x02, 0x01,
+  0x65, 0x00, 0xce, 0xfa, 0x04, 0x6b, 0x72, 0x61, 0x6d, 0x01, 0x01, 0xfc,
+  0x00, 0x02, 0x01, 0x6d, 0x01, 0x02, 0x74, 0x01, 0x76, 0x00, 0x4d, 0x56,
+  0x00, 0x03, 0x01, 0x61, 0x01, 0x02, 0x8a, 0x02, 0x6f, 0x70, 0x01, 0x02,
+  0xbe, 0x03, 0x75, 0x66, 0x6b, 0x00, 0xff, 0x0d, 0x00, 0x06, 0x01, 0x61,
+  0x01, 0x02, 0xcf, 0x02, 0x65, 0x77, 0x00, 0xfe, 0x37, 0x04, 0x69, 0x6c,
+  0x61, 0x79, 0x00, 0x46, 0x75, 0x01, 0x6e, 0x00, 0x80, 0x9d, 0x01, 0x72,
+  0x01, 0x02, 0xdc, 0x01, 0x75, 0x00, 0x52, 0x55, 0x00, 0x02, 0x02, 0x62,
+  0x67, 0x00, 0x41, 0xdc, 0x09, 0x65, 0x74, 0x61, 0x6c, 0x70, 0x6f, 0x64,
+  0x61, 0x72, 0x00, 0x31, 0x0c, 0x00, 0x02, 0x08, 0x62, 0x65, 0x6b, 0x61,
+  0x65, 0x70, 0x61, 0x73, 0x00, 0xb8, 0x6f, 0x01, 0x77, 0x01, 0x02, 0xef,
+  0x00, 0x05, 0x01, 0x68, 0x00, 0xa8, 0xdb, 0x01, 0x6c, 0x01, 0x02, 0xfc,
+  0x01, 0x6e, 0x01, 0x03, 0x09, 0x01, 0x72, 0x00, 0x91, 0xe6, 0x01, 0x73,
+  0x01, 0x03, 0x15, 0x00, 0x06, 0x01, 0x65, 0x01, 0x03, 0x25, 0x02, 0x6d,
+  0x6f, 0x00, 0xf4, 0x0d, 0x02, 0x6e, 0x68, 0x01, 0x03, 0x31, 0x01, 0x6f,
+  0x00, 0x28, 0x66, 0x02, 0x70, 0x6f, 0x01, 0x03, 0x3d, 0x01, 0x72, 0x00,
+  0x32, 0x5a, 0x00, 0x02, 0x02, 0x65, 0x74, 0x01, 0x03, 0x4a, 0x01, 0x69,
+  0x01, 0x03, 0x52, 0x00, 0x02, 0x01, 0x65, 0x01, 0x03, 0x59, 0x05, 0x6f,
+  0x6e, 0x6f, 0x72, 0x74, 0x00, 0x8d, 0xab, 0x00, 0x02, 0x01, 0x61, 0x01,
+  0x03, 0x61, 0x01, 0x79, 0x00, 0x0f, 0x6f, 0x00, 0x06, 0x01, 0x61, 0x01,
+  0x03, 0x68, 0x01, 0x65, 0x01, 0x03, 0x76, 0x01, 0x6c, 0x00, 0x59, 0xd1,
+  0x05, 0x6e, 0x6f, 0x73, 0x61, 0x6d, 0x00, 0xed, 0x43, 0x05, 0x6f, 0x74,
+  0x73, 0x69, 0x68, 0x01, 0x03, 0x8d, 0x07, 0x74, 0x73, 0x75, 0x64, 0x6e,
+  0x69, 0x64, 0x01, 0x03, 0xb6, 0x00, 0x03, 0x05, 0x65, 0x69, 0x63, 0x6f,
+  0x73, 0x01, 0x03, 0xbe, 0x01, 0x69, 0x01, 0x03, 0xc6, 0x01, 0x6e, 0x00,
+  0x85, 0x6c, 0x00, 0x01, 0x02, 0x61, 0x64, 0x00, 0x53, 0x44, 0x00, 0x01,
+  0x01, 0x61, 0x00, 0xba, 0x4a, 0x00, 0x03, 0x0a, 0x31, 0x2d, 0x68, 0x74,
+  0x72, 0x6f, 0x6e, 0x2d, 0x6e, 0x63, 0x00, 0xf5, 0xbd, 0x01, 0x62, 0x01,
+  0x03, 0xd2, 0x01, 0x65, 0x00, 0xc9, 0x2d, 0x00, 0x01, 0x01, 0x6e, 0x00,
+  0x42, 0x43, 0x00, 0x01, 0x02, 0x6e, 0x75, 0x00, 0x3f, 0xd8, 0x00, 0x01,
+  0x02, 0x73, 0x79, 0x00, 0xb9, 0x62, 0x00, 0x01, 0x01, 0x74, 0x00, 0x67,
+  0x81, 0x00, 0x02, 0x01, 0x61, 0x00, 0x0e, 0x15, 0x02, 0x72, 0x74, 0x00,
+  0xc9, 0x73, 0x00, 0x01, 0x01, 0x6f, 0x00, 0xc9, 0x37, 0x00, 0x02, 0x02,
+  0x61, 0x72, 0x00, 0x4f, 0xe3, 0x01, 0x6e, 0x00, 0xf7, 0xcd, 0x00, 0x02,
+  0x01, 0x63, 0x00, 0x1d, 0x34, 0x01, 0x6e, 0x00, 0x97, 0x4b, 0x00, 0x02,
+  0x01, 0x65, 0x01, 0x03, 0x59, 0x02, 0x6f, 0x6e, 0x00, 0x9b, 0xd8, 0x00,
+  0x02, 0x01, 0x61, 0x00, 0x0f, 0x68, 0x01, 0x73, 0x00, 0x85, 0x26, 0x00,
+  0x01, 0x01, 0x6c, 0x00, 0x17, 0x57, 0x00, 0x02, 0x01, 0x65, 0x00, 0x1e,
+  0x60, 0x01, 0x73, 0x00, 0xc9, 0x7a, 0x00, 0x02, 0x05, 0x63, 0x61, 0x6e,
+  0x69, 0x72, 0x00, 0x99, 0x66, 0x03, 0x73, 0x65, 0x66, 0x00, 0x67, 0x81,
+  0x00, 0x01, 0x01, 0x61, 0x00, 0x16, 0xd4, 0x00, 0x02, 0x0c, 0x64, 0x65,
+  0x6c, 0x77, 0x6f, 0x6e, 0x6b, 0x2d, 0x66, 0x6f, 0x2d, 0x6c, 0x01, 0x03,
+  0xe1, 0x08, 0x65, 0x6c, 0x6c, 0x6f, 0x63, 0x65, 0x76, 0x6f, 0x01, 0x03,
+  0xee, 0x00, 0x01, 0x04, 0x74, 0x2d, 0x73, 0x6b, 0x00, 0x5f, 0x5e, 0x00,
+  0x01, 0x01, 0x72, 0x00, 0x6a, 0xcc, 0x01, 0x01, 0x01, 0x64, 0x00, 0x0e,
+  0x15, 0x00, 0x03, 0x02, 0x2d, 0x63, 0x00, 0xf4, 0xff, 0x01, 0x6e, 0x00,
+  0xaa, 0x23, 0x01, 0x75, 0x00, 0x99, 0x6d, 0x00, 0x02, 0x07, 0x69, 0x61,
+  0x7a, 0x6e, 0x61, 0x62, 0x2e, 0x01, 0x03, 0xf5, 0x03, 0x72, 0x6f, 0x70,
+  0x00, 0x94, 0xe0, 0x00, 0x01, 0x01, 0x69, 0x00, 0x9b, 0xdf, 0x00, 0x02,
+  0x02, 0x62, 0x65, 0x00, 0xb7, 0x76, 0x06, 0x73, 0x6e, 0x6f, 0x65, 0x68,
+  0x74, 0x00, 0x60, 0x68, 0x00, 0x01, 0x02, 0x2e, 0x73, 0x00, 0x9b, 0xbc,
+  0x00, 0x01, 0x01, 0x63, 0x00, 0x64, 0xb6, 0x00, 0x02, 0x05, 0x6e, 0x61,
+  0x6c, 0x70, 0x6b, 0x01, 0x04, 0x07, 0x09, 0x74, 0x79, 0x62, 0x65, 0x65,
+  0x62, 0x2e, 0x31, 0x64, 0x01, 0x04, 0x0e, 0x00, 0x02, 0x01, 0x63, 0x01,
+  0x04, 0x15, 0x01, 0x6c, 0x00, 0xf4, 0xe0, 0x00, 0x01, 0x01, 0x73, 0x00,
+  0x9b, 0x75, 0x00, 0x01, 0x02, 0x62, 0x74, 0x00, 0x5f, 0x90, 0x00, 0x01,
+  0x01, 0x65, 0x01, 0x04, 0x1c, 0x00, 0x01, 0x02, 0x74, 0x66, 0x00, 0x26,
+  0xfa, 0x00, 0x01, 0x01, 0x75, 0x00, 0x27, 0x3a, 0x00, 0x01, 0x03, 0x65,
+  0x63, 0x61, 0x00, 0x8e, 0xad, 0x00, 0x04, 0x05, 0x63, 0x65, 0x72, 0x73,
+  0x69, 0x01, 0x04, 0x23, 0x04, 0x64, 0x6f, 0x72, 0x70, 0x00, 0xf7, 0x35,
+  0x07, 0x67, 0x6e, 0x69, 0x74, 0x73, 0x65, 0x74, 0x01, 0x04, 0x2a, 0x02,
+  0x76, 0x65, 0x01, 0x04, 0x23, 0x00, 0x01, 0x01, 0x61, 0x00, 0xb1, 0x9b,
+  0x00, 0x01, 0x01, 0x69, 0x00, 0x12, 0xf0, 0x00, 0x01, 0x01, 0x76, 0x00,
+  0x0b, 0x7d, 0x00, 0x06, 0x05, 0x61, 0x73, 0x69, 0x65, 0x72, 0x01, 0x04,
+  0x31, 0x05, 0x67, 0x72, 0x65, 0x62, 0x73, 0x00, 0x9c, 0x11, 0x04, 0x6c,
+  0x61, 0x64, 0x6f, 0x00, 0xe0, 0xc6, 0x01, 0x6e, 0x01, 0x04, 0x38, 0x05,
+  0x72, 0x65, 0x67, 0x6e, 0x61, 0x01, 0x04, 0x4a, 0x06, 0x73, 0x73, 0x6f,
+  0x66, 0x65, 0x6e, 0x00, 0x10, 0xd5, 0x00, 0x01, 0x01, 0x72, 0x00, 0x16,
+  0xc6, 0x00, 0x01, 0x05, 0x6c, 0x61, 0x64, 0x72, 0x6a, 0x00, 0xe3, 0x68,
+  0x00, 0x02, 0x05, 0x73, 0x65, 0x6e, 0x6e, 0x65, 0x00, 0x0d, 0xc5, 0x03,
+  0x76, 0x72, 0x65, 0x00, 0xe1, 0x7a, 0x00, 0x03, 0x07, 0x64, 0x6e, 0x61,
+  0x6c, 0x65, 0x70, 0x72, 0x00, 0x18, 0xa6, 0x06, 0x67, 0x6f, 0x6b, 0x73,
+  0x6e, 0x65, 0x00, 0xe2, 0x28, 0x06, 0x74, 0x65, 0x64, 0x6e, 0x61, 0x6c,
+  0x01, 0x04, 0x4a, 0x00, 0x02, 0x07, 0x61, 0x6e, 0x74, 0x6f, 0x75, 0x76,
+  0x61, 0x00, 0xab, 0xd9, 0x08, 0x69, 0x6d, 0x70, 0x6f, 0x75, 0x76, 0x74,
+  0x61, 0x01, 0x04, 0x51, 0x00, 0x02, 0x09, 0x61, 0x67, 0x72, 0x6a, 0x6e,
+  0x65, 0x76, 0x76, 0x61, 0x00, 0x67, 0xba, 0x08, 0x69, 0x6b, 0x68, 0x76,
+  0x6c, 0x61, 0x72, 0x61, 0x01, 0x04, 0x58, 0x00, 0x01, 0x01, 0x72, 0x00,
+  0x23, 0x27, 0x00, 0x01, 0x01, 0x2d, 0x01, 0x04, 0x31, 0x00, 0x01, 0x02,
+  0x76, 0x76, 0x00, 0x1e, 0x59, 0x00, 0x02, 0x01, 0x6c, 0x00, 0x26, 0x0f,
+  0x01, 0x73, 0x00, 0x26, 0x0f, 0x00, 0x02, 0x01, 0x65, 0x00, 0xe0, 0xcd,
+  0x01, 0x75, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x04, 0x61, 0x67, 0x6e, 0x61,
+  0x01, 0x04, 0x5f, 0x01, 0x72, 0x00, 0x29, 0x66, 0x00, 0x02, 0x01, 0x6d,
+  0x00, 0x27, 0x0f, 0x01, 0x73, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x6e,
+  0x00, 0x4b, 0x25, 0x00, 0x02, 0x01, 0x69, 0x01, 0x04, 0x51, 0x01, 0x74,
+  0x00, 0xc6, 0xc0, 0x00, 0x02, 0x02, 0x2d, 0x65, 0x00, 0xe3, 0x61, 0x01,
+  0x73, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x74, 0x01, 0x04, 0x6b, 0x00,
+  0x02, 0x01, 0x61, 0x01, 0x04, 0x72, 0x03, 0x74, 0x61, 0x6c, 0x00, 0x33,
+  0x7f, 0x00, 0x02, 0x01, 0x72, 0x01, 0x04, 0x7a, 0x01, 0x74, 0x00, 0x0e,
+  0x15, 0x00, 0x01, 0x02, 0x74, 0x76, 0x00, 0x91, 0xf4, 0x00, 0x02, 0x07,
+  0x61, 0x6f, 0x75, 0x76, 0x61, 0x74, 0x68, 0x01, 0x00, 0xc6, 0x03, 0x6f,
+  0x75, 0x76, 0x01, 0x04, 0x8c, 0x00, 0x02, 0x02, 0x6c, 0x61, 0x00, 0xe3,
+  0x61, 0x02, 0x73, 0x65, 0x00, 0xe1, 0x73, 0x00, 0x01, 0x01, 0x6e, 0x00,
+  0x33, 0x7f, 0x00, 0x01, 0x01, 0x6a, 0x00, 0xe2, 0x77, 0x00, 0x01, 0x01,
+  0x72, 0x00, 0x2a, 0x53, 0x00, 0x02, 0x03, 0x61, 0x6e, 0x72, 0x01, 0x04,
+  0x9e, 0x02, 0x75, 0x62, 0x00, 0xb9, 0x15, 0x00, 0x03, 0x03, 0x62, 0x61,
+  0x6f, 0x00, 0x2a, 0xfa, 0x03, 0x73, 0x6f, 0x75, 0x00, 0x33, 0x14, 0x02,
+  0x76, 0x65, 0x00, 0xaf, 0x8b, 0x00, 0x02, 0x04, 0x69, 0x70, 0x70, 0x68,
+  0x00, 0x2a, 0xfa, 0x01, 0x72, 0x01, 0x04, 0xaa, 0x00, 0x01, 0x01, 0x6e,
+  0x00, 0xe2, 0x77, 0x00, 0x06, 0x02, 0x61, 0x6e, 0x01, 0x04, 0xba, 0x01,
+  0x65, 0x01, 0x04, 0xc6, 0x02, 0x6d, 0x75, 0x01, 0x04, 0x31, 0x02, 0x6e,
+  0x65, 0x00, 0xaf, 0x84, 0x03, 0x6f, 0x6c, 0x6d, 0x00, 0x2a, 0x53, 0x03,
+  0x73, 0x6f, 0x72, 0x00, 0x0d, 0xc5, 0x00, 0x02, 0x01, 0x61, 0x01, 0x04,
+  0xd3, 0x03, 0x65, 0x6d, 0x6a, 0x00, 0x16, 0xc6, 0x00, 0x02, 0x01, 0x2d,
+  0x01, 0x04, 0xe0, 0x01, 0x73, 0x00, 0xd9, 0x43, 0x00, 0x03, 0x02, 0x64,
+  0x72, 0x00, 0xf0, 0x57, 0x02, 0x72, 0x6f, 0x00, 0x2d, 0xb6, 0x02, 0x73,
+  0x64, 0x00, 0xf0, 0x57, 0x00, 0x02, 0x03, 0x64, 0x72, 0x6f, 0x00, 0x25,
+  0xd5, 0x03, 0x6c, 0x61, 0x72, 0x00, 0x13, 0xa3, 0x00, 0x01, 0x01, 0x72,
+  0x00, 0x2a, 0xfa, 0x00, 0x02, 0x01, 0x6e, 0x00, 0x27, 0x0f, 0x01, 0x6f,
+  0x00, 0xb0, 0xae, 0x00, 0x02, 0x01, 0x61, 0x00, 0x1d, 0x1c, 0x02, 0x65,
+  0x72, 0x00, 0xe6, 0x63, 0x00, 0x02, 0x01, 0x67, 0x00, 0x0e, 0x15, 0x01,
+  0x68, 0x00, 0x0e, 0x15, 0x01, 0x01, 0x01, 0x74, 0x00, 0x0e, 0x15, 0x00,
+  0x01, 0x01, 0x6a, 0x00, 0x2a, 0x53, 0x00, 0x03, 0x05, 0x61, 0x65, 0x66,
+  0x72, 0x61, 0x00, 0xe7, 0x6e, 0x01, 0x6f, 0x00, 0x87, 0xcc, 0x01, 0x72,
+  0x00, 0x41, 0x08, 0x00, 0x01, 0x01, 0x6b, 0x00, 0x33, 0x7f, 0x00, 0x02,
+  0x05, 0x64, 0x72, 0x6f, 0x6a, 0x66, 0x00, 0x0b, 0x7d, 0x04, 0x76, 0x6c,
+  0x65, 0x73, 0x01, 0x04, 0x51, 0x00, 0x01, 0x01, 0x65, 0x00, 0x33, 0x14,
+  0x00, 0x03, 0x03, 0x64, 0x6e, 0x61, 0x00, 0xe3, 0x0e, 0x03, 0x67, 0x6f,
+  0x6b, 0x01, 0x04, 0x6b, 0x04, 0x73, 0x65, 0x6e, 0x73, 0x00, 0x0b, 0x7d,
+  0x00, 0x01, 0x01, 0x79, 0x00, 0x0d, 0xc5, 0x00, 0x02, 0x01, 0x6b, 0x01,
+  0x04, 0xf2, 0x03, 0x6f, 0x72, 0x79, 0x01, 0x05, 0x02, 0x00, 0x04, 0x01,
+  0x64, 0x00, 0xe3, 0x6f, 0x03, 0x6d, 0x72, 0x61, 0x00, 0x0b, 0x7d, 0x01,
+  0x6e, 0x01, 0x05, 0x09, 0x03, 0x72, 0x65, 0x76, 0x00, 0x6a, 0x59, 0x00,
+  0x01, 0x01, 0x6f, 0x00, 0x94, 0x07, 0x00, 0x01, 0x01, 0x69, 0x00, 0x31,
+  0x6e, 0x00, 0x01, 0x06, 0x6f, 0x71, 0x2d, 0x72, 0x65, 0x6c, 0x00, 0x23,
+  0x27, 0x00, 0x01, 0x01, 0x6f, 0x00, 0x10, 0xd5, 0x00, 0x02, 0x02, 0x67,
+  0x6e, 0x00, 0xe3, 0x15, 0x02, 0x6c, 0x72, 0x01, 0x04, 0x58, 0x00, 0x01,
+  0x01, 0x6c, 0x00, 0x0d, 0xc5, 0x00, 0x01, 0x01, 0x61, 0x00, 0x2a, 0xfa,
+  0x00, 0x04, 0x04, 0x64, 0x6c, 0x6f, 0x66, 0x01, 0x04, 0x31, 0x05, 0x67,
+  0x6f, 0x6b, 0x73, 0x6d, 0x00, 0x0d, 0xc5, 0x04, 0x6b, 0x69, 0x76, 0x72,
+  0x00, 0xe2, 0xb0, 0x04, 0x72, 0x65, 0x74, 0x73, 0x00, 0x35, 0xb1, 0x00,
+  0x03, 0x03, 0x6b, 0x72, 0x61, 0x00, 0xe2, 0x5b, 0x02, 0x72, 0x65, 0x01,
+  0x05, 0x15, 0x03, 0x73, 0x74, 0x69, 0x00, 0xe0, 0x0b, 0x00, 0x02, 0x01,
+  0x62, 0x00, 0x26, 0x0f, 0x01, 0x73, 0x00, 0x26, 0x0f, 0x00, 0x01, 0x01,
+  0x64, 0x00, 0x0d, 0xc5, 0x00, 0x01, 0x01, 0x74, 0x00, 0x33, 0x7f, 0x00,
+  0x01, 0x02, 0x6e, 0x61, 0x00, 0x33, 0x7f, 0x00, 0x02, 0x02, 0x61, 0x72,
+  0x01, 0x05, 0x22, 0x01, 0x65, 0x00, 0x3b, 0x02, 0x01, 0x03, 0x02, 0x6e,
+  0x6e, 0x01, 0x05, 0x2c, 0x02, 0x73, 0x64, 0x00, 0xe2, 0xdf, 0x01, 0x75,
+  0x00, 0x1c, 0x65, 0x00, 0x07, 0x01, 0x65, 0x01, 0x05, 0x33, 0x01, 0x67,
+  0x00, 0xe6, 0x4e, 0x01, 0x6b, 0x01, 0x05, 0x4b, 0x03, 0x6c, 0x65, 0x76,
+  0x00, 0x4b, 0x25, 0x02, 0x6d, 0x69, 0x00, 0x31, 0x67, 0x04, 0x6f, 0x62,
+  0x65, 0x67, 0x00, 0x52, 0xae, 0x01, 0x72, 0x01, 0x05, 0x59, 0x00, 0x02,
+  0x02, 0x65, 0x74, 0x01, 0x05, 0x2c, 0x03, 0x6c, 0x61, 0x64, 0x00, 0x5d,
+  0x25, 0x00, 0x02, 0x04, 0x65, 0x76, 0x2e, 0x65, 0x00, 0x3b, 0x02, 0x03,
+  0x6f, 0x2e, 0x72, 0x01, 0x05, 0x65, 0x00, 0x03, 0x01, 0x6c, 0x01, 0x05,
+  0x6c, 0x03, 0x72, 0x74, 0x73, 0x01, 0x05, 0xa7, 0x01, 0x73, 0x01, 0x05,
+  0xae, 0x00, 0x02, 0x01, 0x6c, 0x01, 0x05, 0xbf, 0x01, 0x73, 0x01, 0x05,
+  0xc6, 0x00, 0x02, 0x05, 0x62, 0x6c, 0x61, 0x76, 0x73, 0x00, 0xac, 0x09,
+  0x01, 0x67, 0x01, 0x05, 0xf3, 0x00, 0x02, 0x01, 0x6a, 0x01, 0x06, 0x00,
+  0x01, 0x74, 0x00, 0x27, 0x0f, 0x00, 0x01, 0x01, 0x73, 0x00, 0x22, 0x26,
+  0x00, 0x02, 0x06, 0x65, 0x6a, 0x73, 0x65, 0x6d, 0x61, 0x00, 0x29, 0x66,
+  0x04, 0x73, 0x65, 0x6b, 0x61, 0x00, 0x29, 0x5f, 0x00, 0x02, 0x01, 0x65,
+  0x00, 0x16, 0x9c, 0x01, 0x6f, 0x00, 0x31, 0x6e, 0x00, 0x01, 0x01, 0x6e,
+  0x00, 0x36, 0xd0, 0x00, 0x02, 0x01, 0x69, 0x00, 0x0c, 0x1d, 0x01, 0x75,
+  0x00, 0x5f, 0xdf, 0x00, 0x01, 0x01, 0x6d, 0x00, 0x53, 0x44, 0x00, 0x02,
+  0x01, 0x61, 0x00, 0x27, 0xf5, 0x02, 0x65, 0x68, 0x00, 0x3f, 0xa5, 0x00,
+  0x01, 0x01, 0x6a, 0x00, 0x16, 0x7b, 0x00, 0x02, 0x01, 0x65, 0x00, 0x27,
+  0xf5, 0x01, 0x79, 0x00, 0x41, 0x08, 0x00, 0x02, 0x01, 0x67, 0x00, 0x27,
+  0x01, 0x01, 0x6c, 0x00, 0x41, 0xdc, 0x01, 0x01, 0x02, 0x73, 0x6e, 0x01,
+  0x06, 0x0c, 0x00, 0x01, 0x01, 0x69, 0x00, 0x1d, 0x34, 0x01, 0x03, 0x02,
+  0x61, 0x64, 0x01, 0x06, 0x15, 0x03, 0x65, 0x64, 0x79, 0x00, 0x8e, 0xad,
+  0x01, 0x73, 0x01, 0x06, 0x1c, 0x00, 0x01, 0x01, 0x72, 0x00, 0x1c, 0x65,
+  0x00, 0x03, 0x01, 0x61, 0x00, 0x12, 0x22, 0x01, 0x65, 0x00, 0xb3, 0x41,
+  0x01, 0x75, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x6a, 0x00, 0x0c, 0x1d,
+  0x00, 0x04, 0x01, 0x61, 0x00, 0x4f, 0x34, 0x02, 0x65, 0x70, 0x00, 0x41,
+  0xf9, 0x01, 0x69, 0x00, 0x16, 0xd4, 0x01, 0x79, 0x00, 0x83, 0x0e, 0x00,
+  0x03, 0x01, 0x61, 0x00, 0x21, 0x6d, 0x01, 0x6b, 0x00, 0x16, 0xd4, 0x01,
+  0x6f, 0x00, 0x12, 0x22, 0x00, 0x01, 0x01, 0x73, 0x00, 0xc5, 0xc5, 0x00,
+  0x03, 0x01, 0x61, 0x00, 0xe2, 0xed, 0x01, 0x72, 0x01, 0x05, 0x65, 0x01,
+  0x73, 0x00, 0x41, 0x08, 0x00, 0x02, 0x04, 0x6c, 0x65, 0x74, 0x2e, 0x01,
+  0x06, 0x32, 0x01, 0x72, 0x00, 0x26, 0xd7, 0x00, 0x0e, 0x02, 0x61, 0x6e,
+  0x00, 0x91, 0xe6, 0x01, 0x64, 0x01, 0x06, 0x3f, 0x01, 0x65, 0x01, 0x06,
+  0x4d, 0x01, 0x67, 0x01, 0x06, 0x64, 0x01, 0x6b, 0x00, 0x5c, 0x4f, 0x01,
+  0x6c, 0x01, 0x06, 0x71, 0x01, 0x6e, 0x01, 0x06, 0x82, 0x01, 0x6f, 0x00,
+  0xb3, 0x12, 0x01, 0x70, 0x00, 0xcd, 0xa8, 0x01, 0x72, 0x01, 0x06, 0xa7,
+  0x01, 0x73, 0x01, 0x06, 0xc2, 0x01, 0x74, 0x01, 0x06, 0xe3, 0x01, 0x76,
+  0x01, 0x06, 0xf6, 0x01, 0x79, 0x00, 0x16, 0x7b, 0x00, 0x01, 0x01, 0x79,
+  0x00, 0x16, 0x9c, 0x00, 0x01, 0x01, 0x79, 0x00, 0x52, 0x55, 0x00, 0x04,
+  0x01, 0x65, 0x01, 0x07, 0x07, 0x02, 0x67, 0x6e, 0x00, 0x3d, 0xfb, 0x01,
+  0x6b, 0x00, 0x8d, 0xab, 0x02, 0x73, 0x64, 0x00, 0xe4, 0x92, 0x00, 0x02,
+  0x01, 0x68, 0x01, 0x07, 0x0e, 0x04, 0x72, 0x6b, 0x72, 0x65, 0x00, 0xe6,
+  0x47, 0x00, 0x05, 0x01, 0x61, 0x00, 0x15, 0x5e, 0x03, 0x64, 0x72, 0x65,
+  0x00, 0xe4, 0xc5, 0x01, 0x65, 0x01, 0x07, 0x21, 0x01, 0x6f, 0x00, 0x27,
+  0x0f, 0x01, 0x75, 0x00, 0x21, 0x6d, 0x00, 0x02, 0x01, 0x61, 0x00, 0x27,
+  0xf5, 0x04, 0x6f, 0x6b, 0x73, 0x73, 0x00, 0x5d, 0x25, 0x00, 0x02, 0x01,
+  0x67, 0x00, 0x0e, 0x15, 0x01, 0x72, 0x00, 0x4b, 0x25, 0x00, 0x03, 0x02,
+  0x64, 0x6f, 0x01, 0x07, 0x28, 0x01, 0x6c, 0x00, 0x52, 0xae, 0x01, 0x72,
+  0x01, 0x07, 0x34, 0x00, 0x03, 0x01, 0x69, 0x01, 0x07, 0x43, 0x01, 0x6e,
+  0x01, 0x07, 0x4a, 0x01, 0x72, 0x00, 0x73, 0x35, 0x00, 0x02, 0x01, 0x73,
+  0x01, 0x01, 0x58, 0x01, 0x79, 0x00, 0x83, 0x0e, 0x00, 0x02, 0x01, 0x61,
+  0x01, 0x07, 0x5b, 0x01, 0x75, 0x00, 0x0c, 0x1d, 0x00, 0x02, 0x01, 0x6f,
+  0x00, 0x12, 0x22, 0x03, 0x73, 0x65, 0x6e, 0x00, 0x3b, 0x02, 0x00, 0x02,
+  0x09, 0x6c, 0x61, 0x68, 0x73, 0x6c, 0x61, 0x64, 0x72, 0x6f, 0x01, 0x00,
+  0xe2, 0x01, 0x6f, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x01, 0x6f, 0x01, 0x07,
+  0x67, 0x01, 0x72, 0x00, 0x32, 0x5a, 0x00, 0x02, 0x02, 0x6b, 0x6b, 0x00,
+  0x91, 0xc5, 0x01, 0x6e, 0x00, 0x94, 0xe0, 0x00, 0x01, 0x01, 0x6a, 0x00,
+  0x15, 0x5e, 0x00, 0x01, 0x01, 0x6f, 0x00, 0x52, 0x55, 0x00, 0x01, 0x01,
+  0x6e, 0x00, 0x4c, 0x86, 0x00, 0x01, 0x01, 0x73, 0x00, 0xdd, 0x1e, 0x00,
+  0x02, 0x01, 0x64, 0x00, 0x9c, 0xe4, 0x01, 0x72, 0x00, 0x48, 0x25, 0x00,
+  0x02, 0x01, 0x61, 0x00, 0x60, 0xcd, 0x03, 0x65, 0x63, 0x68, 0x00, 0x42,
+  0x43, 0x00, 0x01, 0x01, 0x64, 0x00, 0x9c, 0xe4, 0x00, 0x02, 0x02, 0x64,
+  0x6a, 0x00, 0x53, 0x44, 0x01, 0x69, 0x00, 0x53, 0x44, 0x00, 0x02, 0x01,
+  0x61, 0x01, 0x07, 0x78, 0x04, 0x69, 0x76, 0x73, 0x67, 0x00, 0xc4, 0xaf,
+  0x00, 0x01, 0x01, 0x69, 0x01, 0x07, 0x43, 0x00, 0x04, 0x01, 0x61, 0x01,
+  0x07, 0xa5, 0x05, 0x69, 0x65, 0x2d, 0x65, 0x72, 0x01, 0x07, 0xb7, 0x01,
+  0x72, 0x00, 0x13, 0x33, 0x01, 0x73, 0x00, 0x26, 0xd7, 0x00, 0x02, 0x01,
+  0x6a, 0x00, 0x16, 0x9c, 0x01, 0x76, 0x00, 0x21, 0x6d, 0x00, 0x02, 0x01,
+  0x62, 0x00, 0x52, 0xae, 0x04, 0x6d, 0x61, 0x68, 0x65, 0x01, 0x07, 0xc3,
+  0x00, 0x02, 0x01, 0x6c, 0x00, 0x61, 0xc1, 0x01, 0x75, 0x00, 0x26, 0xde,
+  0x00, 0x03, 0x01, 0x64, 0x00, 0x71, 0x4b, 0x01, 0x6b, 0x01, 0x07, 0xcb,
+  0x01, 0x76, 0x00, 0x1d, 0x34, 0x00, 0x02, 0x01, 0x68, 0x00, 0x0e, 0x15,
+  0x01, 0x6a, 0x00, 0x0c, 0x1d, 0x00, 0x05, 0x01, 0x61, 0x00, 0x0e, 0x15,
+  0x01, 0x65, 0x00, 0xb3, 0xf8, 0x01, 0x6b, 0x00, 0x41, 0x08, 0x01, 0x6f,
+  0x00, 0x16, 0x9c, 0x01, 0x79, 0x00, 0x16, 0x7b, 0x00, 0x01, 0x01, 0x73,
+  0x00, 0x4b, 0x25, 0x00, 0x01, 0x01, 0x6e, 0x00, 0x32, 0x5a, 0x00, 0x02,
+  0x01, 0x61, 0x00, 0x27, 0x33, 0x01, 0x67, 0x00, 0xf2, 0x36, 0x00, 0x01,
+  0x01, 0x74, 0x00, 0x13, 0x33, 0x00, 0x02, 0x01, 0x62, 0x00, 0x0e, 0x15,
+  0x01, 0x73, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x01, 0x65, 0x00, 0x5f, 0x90,
+  0x01, 0x6f, 0x00, 0x58, 0x64, 0x00, 0x03, 0x01, 0x6e, 0x00, 0x80, 0x55,
+  0x05, 0x72, 0x6f, 0x6b, 0x6f, 0x6d, 0x00, 0xb3, 0x63, 0x01, 0x73, 0x00,
+  0x22, 0x26, 0x00, 0x01, 0x01, 0x6d, 0x01, 0x07, 0xd8, 0x00, 0x03, 0x01,
+  0x64, 0x00, 0x71, 0x52, 0x01, 0x67, 0x00, 0xe4, 0x44, 0x01, 0x6e, 0x00,
+  0x85, 0x7a, 0x00, 0x03, 0x01, 0x61, 0x00, 0x1d, 0x1c, 0x02, 0x6e, 0x61,
+  0x00, 0x35, 0x93, 0x01, 0x6f, 0x00, 0x1d, 0x1c, 0x00, 0x02, 0x02, 0x72,
+  0x61, 0x00, 0xe6, 0x47, 0x01, 0x73, 0x00, 0x26, 0xd7, 0x00, 0x02, 0x01,
+  0x61, 0x00, 0x52, 0x55, 0x01, 0x6e, 0x01, 0x07, 0xdf, 0x00, 0x04, 0x01,
+  0x61, 0x01, 0x07, 0xeb, 0x01, 0x65, 0x01, 0x07, 0xfc, 0x01, 0x75, 0x00,
+  0x26, 0xde, 0x01, 0x79, 0x00, 0x1e, 0x60, 0x00, 0x05, 0x01, 0x61, 0x00,
+  0x12, 0x22, 0x02, 0x65, 0x6e, 0x00, 0x85, 0x7a, 0x01, 0x67, 0x00, 0x94,
+  0xe0, 0x01, 0x6c, 0x00, 0xa0, 0x17, 0x01, 0x74, 0x01, 0x05, 0x2c, 0x00,
+  0x03, 0x01, 0x61, 0x00, 0x0f, 0xfa, 0x02, 0x63, 0x67, 0x00, 0x1e, 0x60,
+  0x01, 0x69, 0x00, 0xa0, 0x6a, 0x01, 0x01, 0x01, 0x6f, 0x01, 0x08, 0x0d,
+  0x00, 0x02, 0x05, 0x66, 0x66, 0x61, 0x72, 0x74, 0x00, 0x2e, 0x67, 0x03,
+  0x74, 0x61, 0x62, 0x01, 0x08, 0x14, 0x00, 0x05, 0x02, 0x63, 0x6e, 0x01,
+  0x08, 0x1b, 0x04, 0x67, 0x6e, 0x61, 0x68, 0x00, 0x64, 0x56, 0x04, 0x6d,
+  0x6f, 0x72, 0x64, 0x01, 0x08, 0x14, 0x02, 0x6e, 0x69, 0x01, 0x08, 0x2a,
+  0x03, 0x72, 0x61, 0x77, 0x00, 0x65, 0xe7, 0x00, 0x07, 0x01, 0x64, 0x01,
+  0x08, 0x3c, 0x01, 0x6c, 0x01, 0x08, 0x4a, 0x04, 0x6e, 0x6f, 0x6f, 0x6c,
+  0x00, 0xc6, 0x00, 0x02, 0x72, 0x65, 0x00, 0x94, 0xb5, 0x01, 0x73, 0x00,
+  0xde, 0xfc, 0x01, 0x74, 0x01, 0x08, 0x5e, 0x03, 0x76, 0x69, 0x64, 0x01,
+  0x08, 0x6c, 0x00, 0x01, 0x01, 0x61, 0x00, 0xf9, 0x1a, 0x00, 0x04, 0x01,
+  0x61, 0x01, 0x00, 0x54, 0x01, 0x65, 0x00, 0x6d, 0x8e, 0x02, 0x69, 0x63,
+  0x00, 0x59, 0xe2, 0x06, 0x6f, 0x72, 0x74, 0x6e, 0x6f, 0x63, 0x01, 0x08,
+  0x73, 0x00, 0x02, 0x02, 0x67, 0x69, 0x00, 0x60, 0x9c, 0x02, 0x6f, 0x69,
+  0x01, 0x08, 0x81, 0x00, 0x02, 0x07, 0x69, 0x68, 0x73, 0x6e, 0x6f, 0x69,
+  0x70, 0x00, 0xbb, 0xcd, 0x04, 0x75, 0x6f, 0x72, 0x67, 0x01, 0x08, 0x8d,
+  0x00, 0x02, 0x01, 0x65, 0x01, 0x08, 0x95, 0x01, 0x6f, 0x01, 0x08, 0xb2,
+  0x00, 0x05, 0x04, 0x63, 0x69, 0x74, 0x73, 0x00, 0xbc, 0x7f, 0x01, 0x65,
+  0x01, 0x08, 0xc0, 0x01, 0x6b, 0x00, 0xc6, 0x50, 0x04, 0x73, 0x65, 0x72,
+  0x70, 0x01, 0x08, 0xcc, 0x02, 0x74, 0x6e, 0x00, 0x58, 0xa8, 0x00, 0x07,
+  0x05, 0x66, 0x61, 0x72, 0x63, 0x72, 0x01, 0x08, 0xd3, 0x04, 0x68, 0x67,
+  0x69, 0x6c, 0x01, 0x08, 0xe0, 0x04, 0x6c, 0x69, 0x75, 0x62, 0x00, 0x4b,
+  0x7d, 0x01, 0x6e, 0x01, 0x08, 0xec, 0x01, 0x6f, 0x01, 0x02, 0x53, 0x03,
+  0x72, 0x6f, 0x70, 0x00, 0x2e, 0x67, 0x02, 0x73, 0x69, 0x01, 0x08, 0xf9,
+  0x00, 0x02, 0x01, 0x65, 0x00, 0x66, 0xc6, 0x01, 0x6f, 0x00, 0x38, 0xd2,
+  0x00, 0x03, 0x05, 0x63, 0x6e, 0x65, 0x67, 0x72, 0x00, 0x3a, 0x84, 0x03,
+  0x64, 0x6f, 0x62, 0x00, 0x40, 0x13, 0x02, 0x74, 0x65, 0x00, 0x59, 0xf0,
+  0x01, 0x01, 0x01, 0x2e, 0x01, 0x09, 0x05, 0x01, 0x01, 0x01, 0x2e, 0x01,
+  0x09, 0x28, 0x01, 0x01, 0x01, 0x2e, 0x01, 0x09, 0x45, 0x01, 0x01, 0x01,
+  0x2e, 0x01, 0x09, 0x6d, 0x00, 0x02, 0x03, 0x6b, 0x75, 0x66, 0x01, 0x09,
+  0x96, 0x04, 0x7a, 0x69, 0x68, 0x73, 0x01, 0x09, 0x9d, 0x00, 0x03, 0x05,
+  0x68, 0x6f, 0x6b, 0x6f, 0x79, 0x00, 0xe9, 0xc8, 0x04, 0x74, 0x69, 0x61,
+  0x73, 0x01, 0x09, 0xa4, 0x01, 0x79, 0x01, 0x09, 0xab, 0x00, 0x02, 0x01,
+  0x6f, 0x01, 0x09, 0xb9, 0x02, 0x75, 0x6b, 0x01, 0x09, 0xc9, 0x01, 0x01,
+  0x01, 0x2e, 0x01, 0x09, 0xd7, 0x01, 0x01, 0x01, 0x2e, 0x01, 0x09, 0xed,
+  0x00, 0x01, 0x01, 0x6b, 0x00, 0x16, 0x89, 0x00, 0x02, 0x04, 0x61, 0x6d,
+  0x61, 0x79, 0x01, 0x0a, 0x03, 0x03, 0x69, 0x69, 0x6e, 0x01, 0x0a, 0x0a,
+  0x00, 0x02, 0x01, 0x6b, 0x01, 0x0a, 0x11, 0x01, 0x6f, 0x01, 0x0a, 0x1d,
+  0x00, 0x02, 0x01, 0x6b, 0x01, 0x0a, 0x24, 0x03, 0x6e, 0x61, 0x6b, 0x01,
+  0x0a, 0x2b, 0x01, 0x01, 0x01, 0x2e, 0x01, 0x0a, 0x32, 0x01, 0x01, 0x01,
+  0x2e, 0x01, 0x0a, 0x4f, 0x02, 0x01, 0x05, 0x2e, 0x79, 0x74, 0x69, 0x63,
+  0x00, 0x3a, 0x66, 0x00, 0x02, 0x02, 0x6c, 0x72, 0x00, 0x4c, 0x3f, 0x01,
+  0x79, 0x00, 0x17, 0x57, 0x01, 0x01, 0x01, 0x2e, 0x01, 0x0a, 0x6f, 0x00,
+  0x06, 0x01, 0x61, 0x01, 0x0a, 0x8a, 0x01, 0x65, 0x01, 0x0a, 0x99, 0x01,
+  0x69, 0x01, 0x0a, 0xa0, 0x01, 0x6e, 0x01, 0x0a, 0xb4, 0x01, 0x6f, 0x01,
+  0x0a, 0xc9, 0x01, 0x75, 0x01, 0x0a, 0xea, 0x00, 0x02, 0x04, 0x6e, 0x72,
+  0x69, 0x68, 0x00, 0x64, 0x65, 0x07, 0x74, 0x65, 0x6e, 0x69, 0x65, 0x73,
+  0x61, 0x00, 0x87, 0xc5, 0x01, 0x01, 0x01, 0x2e, 0x01, 0x0a, 0xf8, 0x01,
+  0x01, 0x01, 0x2e, 0x01, 0x0b, 0x1a, 0x01, 0x01, 0x01, 0x2e, 0x01, 0x0b,
+  0x35, 0x01, 0x01, 0x01, 0x2e, 0x01, 0x0b, 0x50, 0x00, 0x03, 0x02, 0x69,
+  0x61, 0x01, 0x0b, 0x6b, 0x02, 0x6f, 0x6b, 0x01, 0x0b, 0x72, 0x06, 0x75,
+  0x67, 0x61, 0x6d, 0x61, 0x79, 0x01, 0x0b, 0x79, 0x00, 0x02, 0x06, 0x61,
+  0x6e, 0x61, 0x6d, 0x61, 0x79, 0x01, 0x0b, 0x80, 0x01, 0x75, 0x01, 0x0b,
+  0x87, 0x01, 0x01, 0x01, 0x2e, 0x01, 0x0b, 0x8e, 0x00, 0x02, 0x03, 0x67,
+  0x61, 0x6e, 0x01, 0x0b, 0xa9, 0x02, 0x77, 0x61, 0x00, 0xb7, 0x12, 0x01,
+  0x01, 0x01, 0x2e, 0x01, 0x0b, 0xb0, 0x01, 0x01, 0x01, 0x2e, 0x01, 0x0b,
+  0xd1, 0x01, 0x01, 0x01, 0x2e, 0x01, 0x0b, 0xec, 0x00, 0x05, 0x01, 0x61,
+  0x01, 0x0c, 0x10, 0x03, 0x65, 0x61, 0x62, 0x00, 0x1c, 0x65, 0x01, 0x69,
+  0x01, 0x0c, 0x28, 0x07, 0x6e, 0x65, 0x7a, 0x69, 0x68, 0x63, 0x65, 0x01,
+  0x0c, 0x41, 0x01, 0x6f, 0x00, 0x9b, 0x99, 0x00, 0x01, 0x01, 0x76, 0x00,
+  0x46, 0x75, 0x00, 0x02, 0x03, 0x6c, 0x6f, 0x67, 0x00, 0x6b, 0x45, 0x01,
+  0x76, 0x00, 0x4b, 0xdd, 0x00, 0x06, 0x01, 0x61, 0x01, 0x0c, 0x48, 0x01,
+  0x65, 0x01, 0x0c, 0x85, 0x01, 0x69, 0x01, 0x0c, 0xc1, 0x01, 0x6e, 0x01,
+  0x0c, 0xf2, 0x01, 0x6f, 0x01, 0x0c, 0xff, 0x01, 0x75, 0x01, 0x0d, 0x24,
+  0x01, 0x01, 0x01, 0x2e, 0x01, 0x0d, 0x58, 0x00, 0x06, 0x01, 0x61, 0x01,
+  0x0d, 0x73, 0x01, 0x65, 0x01, 0x0d, 0xa8, 0x01, 0x69, 0x01, 0x0d, 0xbc,
+  0x01, 0x6e, 0x01, 0x0d, 0xd7, 0x01, 0x6f, 0x01, 0x0d, 0xea, 0x01, 0x75,
+  0x01, 0x0e, 0x07, 0x01, 0x01, 0x01, 0x2e, 0x01, 0x0e, 0x16, 0x01, 0x01,
+  0x01, 0x2e, 0x01, 0x0e, 0x34, 0x00, 0x05, 0x01, 0x61, 0x01, 0x0e, 0x55,
+  0x01, 0x65, 0x01, 0x0e, 0x81, 0x01, 0x69, 0x01, 0x0e, 0x97, 0x01, 0x6f,
+  0x01, 0x0e, 0xb7, 0x01, 0x75, 0x01, 0x0e, 0xdf, 0x00, 0x03, 0x01, 0x65,
+  0x00, 0x65, 0xfc, 0x02, 0x69, 0x69, 0x01, 0x0e, 0xf2, 0x01, 0x79, 0x00,
+  0x25, 0xc7, 0x00, 0x02, 0x01, 0x65, 0x00, 0xea, 0xaf, 0x02, 0x79, 0x64,
+  0x00, 0xde, 0x73, 0x00, 0x02, 0x01, 0x6b, 0x01, 0x04, 0x07, 0x01, 0x6e,
+  0x00, 0xfe, 0x73, 0x00, 0x02, 0x01, 0x6e, 0x00, 0x5d, 0xbc, 0x01, 0x77,
+  0x01, 0x0e, 0xf9, 0x00, 0x03, 0x01, 0x65, 0x00, 0x0f, 0x68, 0x01, 0x69,
+  0x00, 0xb3, 0x2e, 0x01, 0x75, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x01, 0x61,
+  0x00, 0x83, 0x78, 0x01, 0x74, 0x00, 0x5f, 0x90, 0x00, 0x01, 0x01, 0x6c,
+  0x00, 0x5d, 0x33, 0x00, 0x01, 0x01, 0x63, 0x00, 0x2a, 0x10, 0x00, 0x01,
+  0x01, 0x65, 0x00, 0xc6, 0x93, 0x00, 0x01, 0x01, 0x6c, 0x00, 0x37, 0xb3,
+  0x00, 0x06, 0x01, 0x61, 0x01, 0x0f, 0x00, 0x01, 0x65, 0x01, 0x0f, 0x2d,
+  0x01, 0x69, 0x01, 0x0f, 0x39, 0x02, 0x6e, 0x61, 0x01, 0x0f, 0x5c, 0x01,
+  0x6f, 0x01, 0x0f, 0x63, 0x01, 0x75, 0x01, 0x0f, 0x88, 0x00, 0x01, 0x03,
+  0x74, 0x61, 0x76, 0x00, 0x8e, 0x7a, 0x00, 0x01, 0x01, 0x67, 0x00, 0x46,
+  0x75, 0x00, 0x01, 0x01, 0x6f, 0x00, 0x17, 0x57, 0x00, 0x01, 0x01, 0x73,
+  0x01, 0x0f, 0x94, 0x00, 0x01, 0x03, 0x6d, 0x61, 0x65, 0x00, 0xb3, 0x2e,
+  0x00, 0x02, 0x02, 0x63, 0x6f, 0x01, 0x0f, 0x9b, 0x01, 0x69, 0x00, 0x5d,
+  0x09, 0x00, 0x01, 0x01, 0x64, 0x00, 0x42, 0x1d, 0x00, 0x01, 0x01, 0x63,
+  0x00, 0x13, 0x33, 0x00, 0x01, 0x01, 0x72, 0x00, 0x86, 0x06, 0x01, 0x01,
+  0x01, 0x2e, 0x01, 0x0f, 0xa2, 0x00, 0x01, 0x01, 0x6f, 0x00, 0x36, 0xd0,
+  0x00, 0x01, 0x01, 0x61, 0x00, 0x27, 0x2c, 0x00, 0x01, 0x02, 0x61, 0x76,
+  0x00, 0x74, 0x5b, 0x00, 0x10, 0x01, 0x61, 0x01, 0x0f, 0xc6, 0x01, 0x62,
+  0x00, 0x0f, 0x68, 0x01, 0x63, 0x00, 0x64, 0x73, 0x01, 0x65, 0x01, 0x0f,
+  0xd7, 0x01, 0x66, 0x00, 0x1e, 0x60, 0x01, 0x67, 0x00, 0x12, 0x22, 0x01,
+  0x69, 0x00, 0x0f, 0x68, 0x01, 0x6a, 0x00, 0x1d, 0x1c, 0x01, 0x6c, 0x00,
+  0x26, 0xd7, 0x01, 0x6d, 0x00, 0x26, 0xd7, 0x01, 0x6e, 0x00, 0x1d, 0x1c,
+  0x01, 0x6f, 0x01, 0x0f, 0xe8, 0x01, 0x70, 0x00, 0x64, 0x73, 0x01, 0x72,
+  0x01, 0x0f, 0xf9, 0x01, 0x73, 0x01, 0x10, 0x05, 0x01, 0x74, 0x00, 0x12,
+  0x22, 0x00, 0x01, 0x0e, 0x73, 0x69, 0x74, 0x6e, 0x65, 0x64, 0x2d, 0x73,
+  0x6e, 0x65, 0x69, 0x67, 0x72, 0x75, 0x01, 0x10, 0x16, 0x00, 0x01, 0x01,
+  0x61, 0x00, 0x46, 0x83, 0x00, 0x02, 0x01, 0x62, 0x00, 0x16, 0x9c, 0x01,
+  0x6f, 0x01, 0x10, 0x1d, 0x00, 0x01, 0x03, 0x6c, 0x70, 0x6d, 0x00, 0x85,
+  0x44, 0x00, 0x02, 0x02, 0x68, 0x63, 0x00, 0x66, 0x03, 0x01, 0x6a, 0x00,
+  0x99, 0x5f, 0x00, 0x01, 0x01, 0x74, 0x00, 0x64, 0xb6, 0x00, 0x01, 0x01,
+  0x73, 0x00, 0x95, 0xc9, 0x00, 0x01, 0x01, 0x69, 0x00, 0xcc, 0x54, 0x00,
+  0x02, 0x04, 0x6e, 0x69, 0x62, 0x6f, 0x00, 0x41, 0xf9, 0x01, 0x6f, 0x00,
+  0x0f, 0xfa, 0x00, 0x03, 0x03, 0x32, 0x31, 0x6b, 0x01, 0x10, 0x24, 0x01,
+  0x62, 0x00, 0x17, 0xbd, 0x01, 0x63, 0x00, 0x0f, 0xfa, 0x00, 0x02, 0x01,
+  0x62, 0x00, 0x17, 0xbd, 0x01, 0x63, 0x00, 0x0f, 0xfa, 0x00, 0x01, 0x01,
+  0x66, 0x01, 0x10, 0x2b, 0x00, 0x09, 0x01, 0x32, 0x00, 0x60, 0x26, 0x01,
+  0x62, 0x00, 0x17, 0xbd, 0x01, 0x63, 0x01, 0x10, 0x32, 0x01, 0x67, 0x00,
+  0x2f, 0x47, 0x01, 0x6e, 0x01, 0x10, 0x3e, 0x06, 0x72, 0x6f, 0x62, 0x72,
+  0x61, 0x2d, 0x00, 0xff, 0xb5, 0x01, 0x73, 0x00, 0x2b, 0x73, 0x01, 0x74,
+  0x00, 0x97, 0x6c, 0x05, 0x77, 0x61, 0x6e, 0x65, 0x74, 0x00, 0xd7, 0x82,
+  0x00, 0x01, 0x01, 0x69, 0x00, 0x92, 0x51, 0x00, 0x01, 0x01, 0x65, 0x00,
+  0x4f, 0x2d, 0x00, 0x02, 0x06, 0x6e, 0x65, 0x64, 0x6e, 0x75, 0x6b, 0x00,
+  0x14, 0x4a, 0x01, 0x78, 0x00, 0xed, 0x5b, 0x00, 0x01, 0x01, 0x65, 0x00,
+  0x14, 0x4a, 0x00, 0x02, 0x01, 0x2d, 0x00, 0xd1, 0xbf, 0x01, 0x6d, 0x00,
+  0xeb, 0xd5, 0x01, 0x01, 0x02, 0x2e, 0x70, 0x00, 0x13, 0x33, 0x00, 0x03,
+  0x08, 0x6d, 0x6f, 0x6e, 0x6f, 0x74, 0x70, 0x79, 0x72, 0x00, 0xc9, 0x37,
+  0x09, 0x6e, 0x61, 0x67, 0x72, 0x6f, 0x2d, 0x67, 0x6e, 0x69, 0x01, 0x10,
+  0x4a, 0x05, 0x74, 0x61, 0x74, 0x73, 0x2d, 0x01, 0x10, 0x51, 0x00, 0x02,
+  0x01, 0x63, 0x00, 0x62, 0xe7, 0x01, 0x7a, 0x00, 0xed, 0xa6, 0x00, 0x01,
+  0x01, 0x69, 0x00, 0xbe, 0x90, 0x00, 0x02, 0x02, 0x31, 0x2d, 0x01, 0x10,
+  0x59, 0x02, 0x32, 0x2d, 0x01, 0x10, 0x6f, 0x00, 0x03, 0x03, 0x6d, 0x65,
+  0x61, 0x01, 0x10, 0x7b, 0x08, 0x6e, 0x69, 0x65, 0x76, 0x61, 0x73, 0x2e,
+  0x63, 0x01, 0x10, 0x84, 0x06, 0x78, 0x65, 0x64, 0x6e, 0x61, 0x79, 0x01,
+  0x10, 0x96, 0x00, 0x02, 0x10, 0x6e, 0x61, 0x72, 0x75, 0x73, 0x6e, 0x69,
+  0x68, 0x74, 0x6c, 0x61, 0x65, 0x68, 0x65, 0x7a, 0x69, 0x00, 0xeb, 0xc5,
+  0x01, 0x72, 0x01, 0x10, 0x9e, 0x00, 0x02, 0x01, 0x65, 0x00, 0xed, 0xa6,
+  0x02, 0x69, 0x72, 0x00, 0xdf, 0xb2, 0x00, 0x02, 0x03, 0x61, 0x63, 0x73,
+  0x01, 0x10, 0xab, 0x05, 0x69, 0x62, 0x6f, 0x6d, 0x2d, 0x01, 0x10, 0xbc,
+  0x00, 0x04, 0x03, 0x65, 0x63, 0x6e, 0x00, 0x67, 0x35, 0x05, 0x69, 0x74,
+  0x6e, 0x75, 0x72, 0x01, 0x10, 0x51, 0x03, 0x6f, 0x68, 0x74, 0x01, 0x10,
+  0xc4, 0x05, 0x74, 0x63, 0x65, 0x72, 0x69, 0x00, 0x5d, 0x10, 0x00, 0x02,
+  0x05, 0x69, 0x6c, 0x6e, 0x6f, 0x2d, 0x01, 0x10, 0xcb, 0x01, 0x6f, 0x00,
+  0xf5, 0x58, 0x01, 0x01, 0x01, 0x61, 0x00, 0xa9, 0xba, 0x00, 0x02, 0x04,
+  0x73, 0x2d, 0x72, 0x65, 0x00, 0x5f, 0xe6, 0x01, 0x75, 0x00, 0x65, 0x12,
+  0x00, 0x02, 0x01, 0x61, 0x00, 0x97, 0xbe, 0x01, 0x6b, 0x00, 0xf9, 0x81,
+  0x00, 0x01, 0x02, 0x65, 0x74, 0x00, 0x85, 0x44, 0x00, 0x02, 0x01, 0x63,
+  0x00, 0x48, 0x25, 0x01, 0x72, 0x00, 0xeb, 0x96, 0x00, 0x04, 0x05, 0x67,
+  0x61, 0x74, 0x73, 0x2d, 0x01, 0x10, 0xd2, 0x04, 0x72, 0x65, 0x65, 0x73,
+  0x00, 0xb9, 0xca, 0x03, 0x73, 0x69, 0x72, 0x00, 0xf9, 0x06, 0x07, 0x74,
+  0x73, 0x6f, 0x68, 0x6e, 0x6e, 0x79, 0x00, 0x84, 0x69, 0x00, 0x01, 0x03,
+  0x73, 0x6f, 0x68, 0x00, 0x14, 0x4a, 0x00, 0x01, 0x01, 0x61, 0x00, 0x9b,
+  0x99, 0x00, 0x01, 0x02, 0x6f, 0x6c, 0x01, 0x10, 0xf0, 0x00, 0x02, 0x01,
+  0x64, 0x00, 0x93, 0x7c, 0x04, 0x73, 0x2d, 0x37, 0x37, 0x00, 0xbf, 0xd9,
+  0x00, 0x02, 0x01, 0x61, 0x00, 0xc4, 0xb6, 0x01, 0x69, 0x00, 0x21, 0x6d,
+  0x00, 0x02, 0x01, 0x66, 0x01, 0x10, 0xf7, 0x01, 0x69, 0x01, 0x11, 0x03,
+  0x01, 0x01, 0x01, 0x67, 0x01, 0x11, 0x11, 0x00, 0x04, 0x01, 0x2d, 0x01,
+  0x11, 0x1a, 0x01, 0x65, 0x00, 0x84, 0xe6, 0x01, 0x66, 0x00, 0xc9, 0x11,
+  0x01, 0x6e, 0x00, 0x70, 0xc4, 0x00, 0x02, 0x07, 0x2d, 0x6f, 0x69, 0x64,
+  0x61, 0x72, 0x2d, 0x01, 0x07, 0xd8, 0x01, 0x68, 0x01, 0x11, 0x28, 0x00,
+  0x02, 0x01, 0x64, 0x00, 0x99, 0xa9, 0x01, 0x65, 0x00, 0xc8, 0xcc, 0x00,
+  0x02, 0x01, 0x6d, 0x00, 0x32, 0x5a, 0x01, 0x76, 0x00, 0xf7, 0x6b, 0x00,
+  0x02, 0x06, 0x74, 0x73, 0x75, 0x6c, 0x63, 0x79, 0x00, 0x93, 0x5b, 0x06,
+  0x76, 0x72, 0x65, 0x73, 0x2d, 0x78, 0x00, 0x85, 0x8f, 0x01, 0x01, 0x01,
+  0x2e, 0x00, 0x5d, 0xbc, 0x00, 0x03, 0x04, 0x67, 0x64, 0x65, 0x2d, 0x00,
+  0xbf, 0xd9, 0x06, 0x73, 0x75, 0x6f, 0x68, 0x73, 0x79, 0x00, 0x25, 0xc7,
+  0x01, 0x74, 0x01, 0x11, 0x34, 0x00, 0x02, 0x04, 0x63, 0x61, 0x74, 0x73,
+  0x00, 0xc9, 0x63, 0x02, 0x65, 0x6b, 0x01, 0x11, 0x44, 0x00, 0x02, 0x01,
+  0x64, 0x01, 0x11, 0x4c, 0x06, 0x6f, 0x69, 0x74, 0x63, 0x6e, 0x75, 0x00,
+  0xfc, 0x03, 0x01, 0x01, 0x01, 0x2e, 0x01, 0x11, 0x67, 0x00, 0x02, 0x01,
+  0x61, 0x00, 0xf5, 0xda, 0x04, 0x65, 0x63, 0x63, 0x61, 0x01, 0x11, 0x8f,
+  0x00, 0x01, 0x01, 0x69, 0x00, 0x25, 0x56, 0x00, 0x03, 0x03, 0x66, 0x66,
+  0x65, 0x00, 0x97, 0xbe, 0x07, 0x6a, 0x6f, 0x72, 0x70, 0x72, 0x6f, 0x74,
+  0x01, 0x11, 0x9b, 0x03, 0x6c, 0x65, 0x73, 0x00, 0x85, 0xda, 0x00, 0x02,
+  0x06, 0x6e, 0x72, 0x65, 0x74, 0x6e, 0x69, 0x01, 0x11, 0xa2, 0x01, 0x73,
+  0x00, 0x9c, 0xba, 0x00, 0x02, 0x02, 0x65, 0x6b, 0x00, 0x91, 0xa1, 0x01,
+  0x73, 0x01, 0x11, 0xa9, 0x00, 0x02, 0x04, 0x65, 0x73, 0x73, 0x69, 0x00,
+  0xd2, 0xd5, 0x02, 0x6f, 0x72, 0x00, 0xfc, 0x03, 0x00, 0x02, 0x04, 0x69,
+  0x78, 0x65, 0x74, 0x00, 0xf4, 0xa2, 0x02, 0x6f, 0x68, 0x01, 0x11, 0xba,
+  0x01, 0x01, 0x06, 0x65, 0x61, 0x6b, 0x75, 0x73, 0x74, 0x00, 0x8d, 0xe6,
+  0x00, 0x03, 0x01, 0x31, 0x01, 0x11, 0xc9, 0x01, 0x32, 0x01, 0x11, 0xc9,
+  0x01, 0x33, 0x01, 0x11, 0xc9, 0x00, 0x01, 0x06, 0x65, 0x74, 0x61, 0x67,
+  0x2d, 0x6c, 0x00, 0xc8, 0x7f, 0x00, 0x01, 0x01, 0x6b, 0x00, 0x97, 0x82,
+  0x01, 0x01, 0x01, 0x2e, 0x01, 0x11, 0xd5, 0x00, 0x04, 0x05, 0x64, 0x6f,
+  0x72, 0x70, 0x2e, 0x01, 0x11, 0xe7, 0x04, 0x6c, 0x73, 0x73, 0x2e, 0x01,
+  0x11, 0xf3, 0x01, 0x70, 0x00, 0x13, 0x33, 0x03, 0x73, 0x6c, 0x74, 0x00,
+  0xed, 0x43, 0x00, 0x02, 0x01, 0x2d, 0x00, 0xd1, 0xbf, 0x02, 0x6f, 0x66,
+  0x00, 0x26, 0xec, 0x00, 0x01, 0x01, 0x61, 0x00, 0x23, 0x27, 0x00, 0x01,
+  0x03, 0x6c, 0x72, 0x6f, 0x00, 0x16, 0xcd, 0x00, 0x01, 0x05, 0x61, 0x6e,
+  0x65, 0x73, 0x65, 0x00, 0x2b, 0xef, 0x00, 0x02, 0x02, 0x2d, 0x6f, 0x01,
+  0x12, 0x04, 0x01, 0x6f, 0x01, 0x12, 0x04, 0x00, 0x01, 0x01, 0x65, 0x00,
+  0x97, 0x5e, 0x00, 0x02, 0x01, 0x67, 0x00, 0x3f, 0xd8, 0x01, 0x75, 0x00,
+  0xa9, 0x17, 0x00, 0x03, 0x01, 0x67, 0x00, 0x5d, 0xae, 0x01, 0x69, 0x01,
+  0x12, 0x0b, 0x03, 0x75, 0x69, 0x67, 0x01, 0x12, 0x18, 0x00, 0x04, 0x01,
+  0x61, 0x01, 0x12, 0x2e, 0x01, 0x69, 0x01, 0x12, 0x44, 0x05, 0x6f, 0x62,
+  0x72, 0x61, 0x63, 0x01, 0x12, 0x4b, 0x01, 0x72, 0x00, 0x96, 0x26, 0x00,
+  0x04, 0x01, 0x62, 0x01, 0x12, 0x58, 0x03, 0x64, 0x6e, 0x61, 0x01, 0x12,
+  0x67, 0x01, 0x65, 0x01, 0x12, 0x8a, 0x01, 0x75, 0x00, 0x99, 0x8f, 0x00,
+  0x02, 0x02, 0x2d, 0x6f, 0x01, 0x12, 0x91, 0x01, 0x6f, 0x01, 0x12, 0x91,
+  0x00, 0x02, 0x01, 0x65, 0x01, 0x12, 0x98, 0x01, 0x69, 0x00, 0xf7, 0xba,
+  0x01, 0x01, 0x01, 0x6c, 0x00, 0x0e, 0x15, 0x00, 0x03, 0x01, 0x64, 0x00,
+  0x64, 0xb6, 0x01, 0x69, 0x00, 0x27, 0x0f, 0x03, 0x73, 0x65, 0x63, 0x01,
+  0x12, 0xa5, 0x00, 0x03, 0x04, 0x61, 0x6d, 0x6f, 0x72, 0x01, 0x12, 0xb2,
+  0x01, 0x65, 0x01, 0x12, 0x44, 0x01, 0x6f, 0x00, 0xde, 0xd7, 0x00, 0x02,
+  0x01, 0x73, 0x00, 0xb9, 0x90, 0x01, 0x74, 0x00, 0x29, 0x5f, 0x01, 0x01,
+  0x01, 0x76, 0x00, 0x67, 0x6c, 0x00, 0x04, 0x01, 0x63, 0x00, 0x71, 0x52,
+  0x01, 0x6d, 0x00, 0x51, 0x1b, 0x01, 0x72, 0x00, 0x4b, 0x25, 0x01, 0x76,
+  0x00, 0x1c, 0x65, 0x00, 0x03, 0x01, 0x63, 0x01, 0x12, 0xbf, 0x02, 0x72,
+  0x72, 0x01, 0x12, 0xc6, 0x01, 0x76, 0x00, 0x56, 0x74, 0x01, 0x02, 0x02,
+  0x2d, 0x6c, 0x00, 0x67, 0x20, 0x01, 0x6c, 0x00, 0x67, 0x20, 0x00, 0x02,
+  0x02, 0x2d, 0x61, 0x01, 0x12, 0xd3, 0x01, 0x61, 0x01, 0x12, 0xd3, 0x00,
+  0x02, 0x03, 0x63, 0x61, 0x72, 0x00, 0x85, 0x44, 0x01, 0x67, 0x00, 0x67,
+  0x6c, 0x00, 0x02, 0x03, 0x63, 0x69, 0x6c, 0x01, 0x04, 0x15, 0x02, 0x72,
+  0x65, 0x00, 0xec, 0x00, 0x01, 0x03, 0x01, 0x2d, 0x01, 0x12, 0xdb, 0x01,
+  0x64, 0x01, 0x12, 0xe7, 0x01, 0x65, 0x01, 0x12, 0xf8, 0x00, 0x02, 0x04,
+  0x6c, 0x72, 0x61, 0x62, 0x01, 0x12, 0xff, 0x06, 0x73, 0x73, 0x69, 0x6e,
+  0x61, 0x74, 0x00, 0x41, 0xce, 0x00, 0x03, 0x01, 0x64, 0x00, 0x4c, 0x7f,
+  0x01, 0x6e, 0x00, 0x64, 0x65, 0x01, 0x74, 0x00, 0xc5, 0x99, 0x00, 0x03,
+  0x02, 0x2d, 0x61, 0x01, 0x13, 0x19, 0x01, 0x61, 0x01, 0x13, 0x2b, 0x01,
+  0x65, 0x01, 0x13, 0x3b, 0x00, 0x03, 0x01, 0x63, 0x01, 0x13, 0x43, 0x01,
+  0x73, 0x00, 0x2f, 0x47, 0x01, 0x74, 0x00, 0x92, 0x51, 0x00, 0x01, 0x01,
+  0x33, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x6e, 0x00, 0xf2, 0x03, 0x00,
+  0x02, 0x01, 0x61, 0x00, 0x2a, 0x53, 0x01, 0x75, 0x00, 0x2a, 0x53, 0x00,
+  0x01, 0x04, 0x69, 0x74, 0x6e, 0x65, 0x00, 0xe0, 0x46, 0x00, 0x01, 0x02,
+  0x64, 0x73, 0x01, 0x13, 0x4f, 0x00, 0x03, 0x01, 0x2d, 0x01, 0x13, 0x5b,
+  0x01, 0x61, 0x01, 0x13, 0x6a, 0x04, 0x6f, 0x74, 0x6c, 0x61, 0x01, 0x13,
+  0x76, 0x00, 0x02, 0x01, 0x6e, 0x01, 0x13, 0x84, 0x02, 0x74, 0x6f, 0x00,
+  0x66, 0xc6, 0x00, 0x01, 0x01, 0x72, 0x00, 0x94, 0xe0, 0x00, 0x02, 0x02,
+  0x65, 0x69, 0x00, 0x52, 0x55, 0x02, 0x6f, 0x61, 0x01, 0x13, 0x92, 0x00,
+  0x02, 0x02, 0x2d, 0x61, 0x01, 0x13, 0xa3, 0x01, 0x61, 0x01, 0x13, 0xa3,
+  0x00, 0x02, 0x01, 0x70, 0x00, 0x3c, 0xee, 0x02, 0x72, 0x74, 0x01, 0x13,
+  0xac, 0x00, 0x03, 0x01, 0x62, 0x00, 0x0e, 0x15, 0x03, 0x69, 0x6c, 0x67,
+  0x00, 0x42, 0x43, 0x01, 0x73, 0x01, 0x00, 0x8b, 0x00, 0x02, 0x01, 0x68,
+  0x00, 0x0f, 0xfa, 0x01, 0x72, 0x00, 0x0e, 0x15, 0x00, 0x03, 0x01, 0x2d,
+  0x01, 0x13, 0xc7, 0x01, 0x64, 0x01, 0x13, 0xd3, 0x01, 0x73, 0x01, 0x13,
+  0x6a, 0x00, 0x01, 0x01, 0x6c, 0x01, 0x13, 0xe2, 0x00, 0x02, 0x02, 0x2d,
+  0x6f, 0x01, 0x13, 0xee, 0x01, 0x6f, 0x01, 0x13, 0xee, 0x00, 0x02, 0x02,
+  0x2d, 0x61, 0x01, 0x13, 0xf7, 0x01, 0x61, 0x01, 0x13, 0xf7, 0x00, 0x01,
+  0x01, 0x6e, 0x00, 0x48, 0x25, 0x00, 0x02, 0x01, 0x67, 0x00, 0x41, 0xdc,
+  0x01, 0x72, 0x00, 0x6b, 0x7d, 0x00, 0x02, 0x01, 0x66, 0x00, 0x0e, 0x15,
+  0x01, 0x6c, 0x00, 0x4c, 0x7f, 0x00, 0x04, 0x06, 0x64, 0x69, 0x70, 0x6d,
+  0x61, 0x63, 0x01, 0x13, 0xff, 0x01, 0x6c, 0x00, 0x39, 0x28, 0x02, 0x74,
+  0x73, 0x00, 0x85, 0xa9, 0x01, 0x7a, 0x00, 0xde, 0xd7, 0x00, 0x02, 0x02,
+  0x2d, 0x69, 0x01, 0x14, 0x0c, 0x01, 0x69, 0x01, 0x14, 0x0c, 0x00, 0x04,
+  0x03, 0x62, 0x72, 0x75, 0x01, 0x14, 0x15, 0x03, 0x6c, 0x6c, 0x65, 0x00,
+  0x26, 0xbd, 0x01, 0x72, 0x00, 0x46, 0x7c, 0x01, 0x74, 0x01, 0x14, 0x22,
+  0x00, 0x02, 0x01, 0x65, 0x00, 0x74, 0x5b, 0x02, 0x6f, 0x76, 0x00, 0x17,
+  0xbd, 0x00, 0x01, 0x01, 0x6c, 0x00, 0x91, 0x3d, 0x00, 0x02, 0x03, 0x73,
+  0x65, 0x70, 0x01, 0x14, 0x29, 0x03, 0x7a, 0x6e, 0x61, 0x00, 0x94, 0xb5,
+  0x00, 0x01, 0x01, 0x75, 0x00, 0x0f, 0x6f, 0x00, 0x01, 0x01, 0x65, 0x00,
+  0x52, 0x55, 0x00, 0x02, 0x01, 0x6e, 0x00, 0x4b, 0x25, 0x02, 0x73, 0x73,
+  0x00, 0x5f, 0x5e, 0x00, 0x02, 0x01, 0x61, 0x00, 0x50, 0x30, 0x01, 0x65,
+  0x01, 0x14, 0x36, 0x00, 0x02, 0x02, 0x2d, 0x61, 0x01, 0x14, 0x49, 0x01,
+  0x61, 0x01, 0x14, 0x49, 0x00, 0x02, 0x01, 0x62, 0x00, 0x2a, 0x10, 0x05,
+  0x6f, 0x62, 0x64, 0x61, 0x69, 0x01, 0x03, 0xee, 0x00, 0x01, 0x02, 0x74,
+  0x73, 0x01, 0x14, 0x53, 0x00, 0x02, 0x01, 0x70, 0x00, 0x0e, 0x15, 0x01,
+  0x72, 0x00, 0x39, 0x28, 0x00, 0x02, 0x01, 0x6c, 0x00, 0x1c, 0x89, 0x03,
+  0x74, 0x69, 0x73, 0x00, 0xed, 0x43, 0x00, 0x01, 0x01, 0x6c, 0x00, 0x52,
+  0xae, 0x00, 0x02, 0x02, 0x65, 0x6e, 0x00, 0xb9, 0x9f, 0x02, 0x72, 0x75,
+  0x01, 0x14, 0x5a, 0x00, 0x02, 0x01, 0x70, 0x00, 0x99, 0x01, 0x05, 0x73,
+  0x65, 0x63, 0x63, 0x61, 0x00, 0x93, 0x5b, 0x00, 0x01, 0x01, 0x6d, 0x01,
+  0x14, 0x61, 0x00, 0x02, 0x02, 0x6c, 0x6f, 0x00, 0x60, 0x61, 0x01, 0x76,
+  0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x6c, 0x00, 0x8d, 0x58, 0x00, 0x02,
+  0x01, 0x63, 0x00, 0x26, 0xd7, 0x01, 0x6e, 0x00, 0x0e, 0x15, 0x01, 0x01,
+  0x02, 0x2e, 0x73, 0x00, 0xeb, 0x88, 0x00, 0x01, 0x03, 0x74, 0x73, 0x61,
+  0x00, 0x94, 0x7b, 0x00, 0x01, 0x01, 0x6b, 0x00, 0x2e, 0x67, 0x00, 0x01,
+  0x01, 0x61, 0x00, 0xd9, 0x43, 0x00, 0x01, 0x01, 0x74, 0x00, 0x69, 0x73,
+  0x00, 0x01, 0x02, 0x79, 0x6d, 0x00, 0xc5, 0x51, 0x00, 0x01, 0x03, 0x69,
+  0x6b, 0x68, 0x00, 0x60, 0x2d, 0x00, 0x01, 0x02, 0x6f, 0x64, 0x00, 0x42,
+  0x3c, 0x00, 0x02, 0x03, 0x64, 0x6e, 0x61, 0x00, 0xc6, 0x32, 0x01, 0x74,
+  0x00, 0xee, 0xa1, 0x00, 0x01, 0x01, 0x76, 0x00, 0x14, 0x4a, 0x01, 0x01,
+  0x02, 0x2e, 0x73, 0x00, 0x7b, 0xff, 0x00, 0x01, 0x01, 0x72, 0x00, 0x2f,
+  0xb6, 0x00, 0x01, 0x01, 0x61, 0x00, 0x6d, 0x87, 0x00, 0x02, 0x01, 0x61,
+  0x01, 0x14, 0x68, 0x01, 0x69, 0x01, 0x14, 0x74, 0x00, 0x02, 0x01, 0x68,
+  0x00, 0x6d, 0x0f, 0x01, 0x74, 0x00, 0xeb, 0xdc, 0x00, 0x02, 0x03, 0x65,
+  0x63, 0x72, 0x01, 0x10, 0x9e, 0x01, 0x74, 0x00, 0x61, 0x1a, 0x00, 0x01,
+  0x03, 0x69, 0x72, 0x65, 0x00, 0x3e, 0xb9, 0x00, 0x03, 0x01, 0x62, 0x00,
+  0xa9, 0x25, 0x01, 0x67, 0x00, 0x56, 0x74, 0x04, 0x6d, 0x75, 0x72, 0x6f,
+  0x00, 0xc6, 0xb2, 0x00, 0x01, 0x01, 0x72, 0x00, 0xb8, 0x6f, 0x00, 0x01,
+  0x01, 0x6e, 0x00, 0x2c, 0x17, 0x00, 0x02, 0x01, 0x65, 0x00, 0x9b, 0x5e,
+  0x01, 0x69, 0x00, 0x9b, 0x5e, 0x00, 0x01, 0x01, 0x6e, 0x00, 0x6d, 0x8e,
+  0x00, 0x01, 0x01, 0x2d, 0x01, 0x14, 0x83, 0x01, 0x01, 0x04, 0x2e, 0x73,
+  0x65, 0x64, 0x00, 0x56, 0x74, 0x00, 0x02, 0x01, 0x69, 0x00, 0x0e, 0x15,
+  0x01, 0x79, 0x00, 0x1e, 0x60, 0x00, 0x01, 0x01, 0x74, 0x01, 0x14, 0x8a,
+  0x00, 0x01, 0x02, 0x61, 0x75, 0x00, 0xff, 0xfe, 0x00, 0x02, 0x03, 0x62,
+  0x75, 0x63, 0x00, 0x26, 0xde, 0x03, 0x6d, 0x6f, 0x68, 0x00, 0x97, 0xbe,
+  0x01, 0x01, 0x01, 0x2e, 0x00, 0x75, 0x7e, 0x00, 0x01, 0x02, 0x69, 0x6d,
+  0x01, 0x10, 0xc4, 0x00, 0x01, 0x01, 0x63, 0x00, 0x83, 0x0e, 0x00, 0x01,
+  0x01, 0x75, 0x00, 0x48, 0x25, 0x00, 0x01, 0x01, 0x67, 0x00, 0x94, 0xc3,
+  0x00, 0x01, 0x01, 0x76, 0x00, 0xf7, 0x6b, 0x00, 0x01, 0x01, 0x74, 0x00,
+  0x29, 0x66, 0x00, 0x01, 0x0a, 0x6d, 0x61, 0x63, 0x79, 0x74, 0x69, 0x72,
+  0x75, 0x63, 0x65, 0x00, 0xf7, 0xd4, 0x00, 0x01, 0x01, 0x73, 0x00, 0x39,
+  0x28, 0x00, 0x01, 0x03, 0x61, 0x72, 0x6f, 0x01, 0x14, 0x91, 0x00, 0x01,
+  0x01, 0x67, 0x00, 0xcf, 0x01, 0x00, 0x01, 0x01, 0x73, 0x00, 0x98, 0x58,
+  0x00, 0x01, 0x01, 0x7a, 0x00, 0xcd, 0xa1, 0x00, 0x01, 0x01, 0x61, 0x00,
+  0xf5, 0x72, 0x00, 0x02, 0x01, 0x2d, 0x01, 0x14, 0x98, 0x01, 0x67, 0x00,
+  0x35, 0xb8, 0x00, 0x01, 0x01, 0x63, 0x00, 0xcb, 0xa7, 0x00, 0x01, 0x01,
+  0x61, 0x01, 0x14, 0xa1, 0x00, 0x01, 0x01, 0x66, 0x00, 0x0f, 0x6f, 0x00,
+  0x03, 0x05, 0x63, 0x69, 0x74, 0x6c, 0x65, 0x00, 0xf5, 0x72, 0x04, 0x6e,
+  0x69, 0x75, 0x72, 0x00, 0xfb, 0x0d, 0x01, 0x74, 0x01, 0x14, 0xad, 0x00,
+  0x01, 0x01, 0x6f, 0x01, 0x14, 0xb4, 0x00, 0x01, 0x01, 0x69, 0x01, 0x14,
+  0xbb, 0x00, 0x01, 0x02, 0x6c, 0x61, 0x01, 0x14, 0xc2, 0x00, 0x01, 0x02,
+  0x79, 0x6d, 0x00, 0x97, 0x6c, 0x00, 0x01, 0x01, 0x2e, 0x01, 0x14, 0x83,
+  0x00, 0x01, 0x02, 0x6c, 0x69, 0x01, 0x03, 0x52, 0x00, 0x01, 0x01, 0x6f,
+  0x00, 0x2c, 0x17, 0x01, 0x01, 0x01, 0x2e, 0x01, 0x14, 0xce, 0x00, 0x01,
+  0x04, 0x2d, 0x73, 0x6b, 0x63, 0x00, 0x16, 0x89, 0x00, 0x03, 0x01, 0x64,
+  0x00, 0x99, 0xa9, 0x05, 0x67, 0x74, 0x73, 0x2e, 0x73, 0x01, 0x14, 0xda,
+  0x01, 0x73, 0x01, 0x14, 0xda, 0x00, 0x02, 0x03, 0x65, 0x68, 0x74, 0x01,
+  0x11, 0xa2, 0x01, 0x66, 0x01, 0x14, 0xe1, 0x00, 0x01, 0x01, 0x61, 0x00,
+  0xbd, 0x57, 0x00, 0x01, 0x03, 0x65, 0x74, 0x6e, 0x01, 0x14, 0xe9, 0x00,
+  0x02, 0x01, 0x68, 0x00, 0x5f, 0xfd, 0x01, 0x6c, 0x00, 0xbd, 0x57, 0x00,
+  0x02, 0x01, 0x2d, 0x00, 0x8d, 0x58, 0x01, 0x63, 0x00, 0x0e, 0x15, 0x00,
+  0x06, 0x01, 0x62, 0x00, 0x0e, 0x15, 0x01, 0x64, 0x00, 0x0e, 0x15, 0x01,
+  0x65, 0x00, 0x0e, 0x15, 0x01, 0x69, 0x00, 0x0e, 0x15, 0x01, 0x6d, 0x00,
+  0x0e, 0x15, 0x01, 0x73, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x01, 0x66, 0x00,
+  0x0e, 0x15, 0x01, 0x73, 0x00, 0x0e, 0x15, 0x00, 0x04, 0x01, 0x64, 0x00,
+  0x0e, 0x15, 0x01, 0x6d, 0x00, 0x0e, 0x15, 0x01, 0x73, 0x00, 0x0e, 0x15,
+  0x01, 0x75, 0x00, 0x0e, 0x15, 0x00, 0x04, 0x01, 0x61, 0x00, 0x0e, 0x15,
+  0x01, 0x69, 0x00, 0x0e, 0x15, 0x01, 0x6e, 0x00, 0x0e, 0x15, 0x01, 0x70,
+  0x00, 0x0e, 0x15, 0x00, 0x02, 0x01, 0x63, 0x00, 0x0e, 0x15, 0x01, 0x69,
+  0x00, 0x0e, 0x15, 0x00, 0x03, 0x01, 0x6e, 0x00, 0x0e, 0x15, 0x01, 0x72,
+  0x00, 0x0e, 0x15, 0x01, 0x73, 0x00, 0x8d, 0xab, 0x00, 0x05, 0x01, 0x66,
+  0x00, 0x0e, 0x15, 0x01, 0x67, 0x00, 0x0e, 0x15, 0x01, 0x68, 0x00, 0x0e,
+  0x15, 0x01, 0x6b, 0x00, 0x0e, 0x15, 0x01, 0x74, 0x00, 0x0e, 0x15, 0x00,
+  0x03, 0x01, 0x65, 0x00, 0x0e, 0x15, 0x01, 0x69, 0x01, 0x14, 0xf6, 0x01,
+  0x75, 0x00, 0x0e, 0x15, 0x00, 0x07, 0x01, 0x61, 0x00, 0x0e, 0x15, 0x01,
+  0x65, 0x00, 0x0f, 0x6f, 0x01, 0x69, 0x00, 0x0e, 0x15, 0x01, 0x6c, 0x00,
+  0x0e, 0x15, 0x01, 0x6d, 0x00, 0x0e, 0x15, 0x01, 0x6e, 0x00, 0x2a, 0x10,
+  0x01, 0x70, 0x00, 0x0e, 0x15, 0x00, 0x05, 0x01, 0x61, 0x00, 0x0e, 0x15,
+  0x01, 0x64, 0x00, 0x1d, 0x34, 0x01, 0x68, 0x00, 0x0e, 0x15, 0x01, 0x6c,
+  0x00, 0x0e, 0x15, 0x01, 0x72, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x01, 0x63,
+  0x00, 0x0e, 0x15, 0x01, 0x6d, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x75,
+  0x00, 0x4b, 0x7d, 0x00, 0x02, 0x03, 0x6c, 0x6b, 0x65, 0x00, 0x43, 0xb8,
+  0x05, 0x74, 0x69, 0x6e, 0x69, 0x66, 0x00, 0x6a, 0xe6, 0x00, 0x01, 0x01,
+  0x2e, 0x00, 0xf4, 0xd9, 0x00, 0x02, 0x04, 0x69, 0x6c, 0x6e, 0x6f, 0x00,
+  0x5f, 0xaf, 0x01, 0x6f, 0x00, 0x8d, 0xd8, 0x00, 0x02, 0x01, 0x68, 0x00,
+  0x1e, 0x60, 0x01, 0x6d, 0x00, 0x27, 0xf5, 0x00, 0x02, 0x09, 0x66, 0x69,
+  0x68, 0x73, 0x72, 0x65, 0x79, 0x61, 0x6c, 0x01, 0x14, 0xfd, 0x01, 0x6f,
+  0x00, 0x93, 0x45, 0x00, 0x01, 0x01, 0x72, 0x00, 0x25, 0x56, 0x00, 0x01,
+  0x01, 0x61, 0x00, 0xc5, 0x3b, 0x00, 0x02, 0x01, 0x73, 0x00, 0x84, 0x70,
+  0x01, 0x7a, 0x00, 0x0f, 0x6f, 0x00, 0x01, 0x01, 0x7a, 0x00, 0x27, 0x0f,
+  0x00, 0x02, 0x04, 0x2d, 0x61, 0x77, 0x6f, 0x01, 0x15, 0x04, 0x02, 0x6f,
+  0x6b, 0x00, 0xf8, 0x70, 0x00, 0x03, 0x01, 0x65, 0x00, 0x5f, 0x90, 0x01,
+  0x69, 0x00, 0x0e, 0x15, 0x01, 0x6f, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x02,
+  0x6e, 0x73, 0x00, 0x48, 0x25, 0x01, 0x72, 0x00, 0xce, 0x10, 0x00, 0x01,
+  0x01, 0x72, 0x00, 0x58, 0xaf, 0x00, 0x02, 0x01, 0x69, 0x00, 0x43, 0xbf,
+  0x01, 0x6f, 0x01, 0x15, 0x0b, 0x00, 0x01, 0x01, 0x65, 0x00, 0x2b, 0x7a,
+  0x00, 0x01, 0x01, 0x73, 0x00, 0x97, 0xbe, 0x00, 0x02, 0x01, 0x70, 0x00,
+  0x0e, 0x15, 0x01, 0x73, 0x01, 0x15, 0x1d, 0x00, 0x02, 0x01, 0x70, 0x00,
+  0x0e, 0x15, 0x01, 0x77, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x74, 0x00,
+  0x6d, 0x60, 0x00, 0x02, 0x01, 0x69, 0x01, 0x15, 0x24, 0x01, 0x75, 0x00,
+  0x0e, 0x15, 0x00, 0x03, 0x02, 0x69, 0x67, 0x00, 0x5d, 0xbc, 0x01, 0x72,
+  0x01, 0x15, 0x2b, 0x01, 0x75, 0x01, 0x15, 0x32, 0x00, 0x04, 0x01, 0x6b,
+  0x00, 0x27, 0x0f, 0x01, 0x70, 0x01, 0x15, 0x39, 0x01, 0x73, 0x00, 0x0e,
+  0x15, 0x04, 0x77, 0x74, 0x73, 0x6f, 0x00, 0x9d, 0xdd, 0x00, 0x05, 0x01,
+  0x61, 0x00, 0x0e, 0x15, 0x02, 0x73, 0x70, 0x01, 0x15, 0x40, 0x01, 0x75,
+  0x01, 0x15, 0x51, 0x01, 0x77, 0x00, 0x35, 0x0c, 0x01, 0x7a, 0x00, 0x0e,
+  0x15, 0x00, 0x02, 0x02, 0x6b, 0x73, 0x00, 0x35, 0x51, 0x01, 0x73, 0x00,
+  0x0e, 0x15, 0x00, 0x04, 0x01, 0x69, 0x00, 0x0e, 0x15, 0x01, 0x6f, 0x00,
+  0x6d, 0x60, 0x01, 0x75, 0x00, 0x0e, 0x15, 0x01, 0x7a, 0x00, 0x5d, 0xbc,
+  0x00, 0x01, 0x01, 0x73, 0x00, 0xc4, 0xaf, 0x00, 0x05, 0x01, 0x67, 0x00,
+  0xf8, 0x92, 0x01, 0x69, 0x01, 0x15, 0x5d, 0x01, 0x6d, 0x00, 0x0e, 0x15,
+  0x01, 0x6f, 0x00, 0x76, 0x0c, 0x01, 0x75, 0x01, 0x15, 0x6e, 0x00, 0x01,
+  0x01, 0x7a, 0x00, 0x1d, 0x1c, 0x00, 0x02, 0x02, 0x62, 0x61, 0x00, 0xb9,
+  0x89, 0x01, 0x66, 0x00, 0x26, 0xd7, 0x00, 0x02, 0x01, 0x2d, 0x00, 0xf6,
+  0x07, 0x03, 0x61, 0x6d, 0x61, 0x00, 0x2a, 0x10, 0x00, 0x01, 0x01, 0x64,
+  0x00, 0x7f, 0xc0, 0x00, 0x01, 0x01, 0x74, 0x00, 0x43, 0x01, 0x00, 0x02,
+  0x01, 0x73, 0x00, 0x2a, 0x10, 0x03, 0x74, 0x6f, 0x6e, 0x00, 0xbd, 0x57,
+  0x00, 0x01, 0x06, 0x6f, 0x72, 0x74, 0x6e, 0x6f, 0x63, 0x00, 0x93, 0x5b,
+  0x01, 0x01, 0x02, 0x2e, 0x73, 0x00, 0x16, 0xb8, 0x00, 0x01, 0x02, 0x61,
+  0x70, 0x00, 0xdf, 0xab, 0x00, 0x02, 0x01, 0x64, 0x01, 0x15, 0x77, 0x01,
+  0x6e, 0x00, 0x46, 0x75, 0x01, 0x01, 0x01, 0x2e, 0x00, 0xd2, 0xff, 0x01,
+  0x01, 0x01, 0x2d, 0x01, 0x15, 0x83, 0x00, 0x01, 0x02, 0x6b, 0x63, 0x00,
+  0x67, 0x2e, 0x00, 0x02, 0x01, 0x6a, 0x00, 0x0e, 0x15, 0x01, 0x70, 0x00,
+  0x35, 0x51, 0x00, 0x01, 0x01, 0x65, 0x00, 0x9b, 0xdf, 0x00, 0x02, 0x01,
+  0x63, 0x01, 0x15, 0x90, 0x01, 0x6e, 0x01, 0x15, 0xa3, 0x00, 0x01, 0x01,
+  0x65, 0x01, 0x15, 0xb5, 0x00, 0x01, 0x05, 0x2d, 0x6f, 0x74, 0x6e, 0x69,
+  0x00, 0xbd, 0x57, 0x00, 0x02, 0x01, 0x73, 0x00, 0x91, 0x36, 0x02, 0x74,
+  0x61, 0x00, 0xd0, 0x55, 0x00, 0x02, 0x01, 0x2d, 0x01, 0x10, 0xcb, 0x01,
+  0x79, 0x00, 0x5c, 0xb0, 0x01, 0x01, 0x01, 0x2e, 0x00, 0x62, 0x0c, 0x00,
+  0x02, 0x04, 0x6e, 0x75, 0x61, 0x72, 0x00, 0xc9, 0x55, 0x01, 0x73, 0x01,
+  0x15, 0xbc, 0x00, 0x02, 0x01, 0x6c, 0x00, 0xa0, 0x8f, 0x08, 0x74, 0x61,
+  0x76, 0x72, 0x65, 0x73, 0x6e, 0x6f, 0x00, 0xf5, 0x72, 0x00, 0x01, 0x01,
+  0x63, 0x00, 0x67, 0x6c, 0x00, 0x02, 0x01, 0x72, 0x00, 0xfc, 0x58, 0x05,
+  0x73, 0x77, 0x65, 0x6e, 0x6e, 0x01, 0x15, 0xd9, 0x00, 0x01, 0x01, 0x69,
+  0x00, 0xa7, 0x60, 0x00, 0x01, 0x01, 0x67, 0x00, 0x0f, 0x68, 0x00, 0x02,
+  0x01, 0x2d, 0x00, 0x62, 0xa3, 0x08, 0x73, 0x69, 0x68, 0x74, 0x73, 0x65,
+  0x74, 0x69, 0x00, 0x9d, 0xd6, 0x00, 0x03, 0x01, 0x69, 0x01, 0x15, 0xe0,
+  0x01, 0x70, 0x01, 0x15, 0xe0, 0x01, 0x73, 0x01, 0x15, 0xe0, 0x00, 0x01,
+  0x01, 0x63, 0x00, 0x69, 0x73, 0x00, 0x03, 0x02, 0x31, 0x2d, 0x01, 0x15,
+  0xe7, 0x04, 0x32, 0x2d, 0x74, 0x73, 0x01, 0x16, 0x02, 0x04, 0x33, 0x2d,
+  0x74, 0x73, 0x01, 0x16, 0x10, 0x00, 0x01, 0x02, 0x6c, 0x69, 0x00, 0x25,
+  0xc7, 0x00, 0x02, 0x01, 0x2d, 0x00, 0xf9, 0x3f, 0x0a, 0x74, 0x65, 0x6e,
+  0x2d, 0x6f, 0x72, 0x65, 0x68, 0x6b, 0x63, 0x00, 0x70, 0xcb, 0x00, 0x01,
+  0x02, 0x65, 0x62, 0x00, 0xf5, 0xa6, 0x00, 0x02, 0x01, 0x2d, 0x00, 0x62,
+  0xa3, 0x06, 0x64, 0x65, 0x74, 0x73, 0x6f, 0x68, 0x01, 0x14, 0x61, 0x01,
+  0x01, 0x02, 0x2e, 0x61, 0x01, 0x16, 0x22, 0x00, 0x02, 0x01, 0x65, 0x00,
+  0xec, 0xa4, 0x02, 0x74, 0x61, 0x00, 0x22, 0x26, 0x00, 0x01, 0x01, 0x6f,
+  0x00, 0xdf, 0x2b, 0x00, 0x01, 0x01, 0x72, 0x00, 0xcb, 0xa7, 0x00, 0x02,
+  0x05, 0x2d, 0x73, 0x6c, 0x6c, 0x75, 0x00, 0xfb, 0x0d, 0x05, 0x72, 0x61,
+  0x63, 0x73, 0x61, 0x00, 0xd1, 0x15, 0x00, 0x02, 0x05, 0x63, 0x69, 0x73,
+  0x75, 0x6d, 0x00, 0xcb, 0xa7, 0x04, 0x72, 0x61, 0x74, 0x72, 0x00, 0xfa,
+  0x06, 0x00, 0x01, 0x03, 0x74, 0x72, 0x65, 0x01, 0x12, 0x8a, 0x00, 0x01,
+  0x07, 0x61, 0x6d, 0x2d, 0x61, 0x6c, 0x2d, 0x61, 0x01, 0x16, 0x2e, 0x00,
+  0x02, 0x04, 0x69, 0x74, 0x61, 0x6c, 0x00, 0x16, 0x89, 0x06, 0x74, 0x61,
+  0x70, 0x2d, 0x65, 0x6c, 0x01, 0x16, 0x2e, 0x00, 0x02, 0x01, 0x69, 0x00,
+  0xfa, 0x72, 0x08, 0x72, 0x65, 0x70, 0x6c, 0x61, 0x75, 0x73, 0x75, 0x00,
+  0x70, 0xbd, 0x00, 0x01, 0x01, 0x65, 0x00, 0xcc, 0x54, 0x00, 0x02, 0x01,
+  0x65, 0x01, 0x16, 0x36, 0x03, 0x68, 0x63, 0x74, 0x00, 0x91, 0xf4, 0x00,
+  0x02, 0x01, 0x65, 0x00, 0x4f, 0x2d, 0x01, 0x74, 0x00, 0x64, 0x65, 0x01,
+  0x01, 0x01, 0x70, 0x00, 0x4b, 0xdd, 0x00, 0x02, 0x03, 0x61, 0x65, 0x67,
+  0x01, 0x08, 0x6c, 0x05, 0x6f, 0x65, 0x74, 0x65, 0x6d, 0x00, 0xf9, 0x58,
+  0x00, 0x02, 0x02, 0x69, 0x6c, 0x00, 0xeb, 0xe3, 0x04, 0x6e, 0x6f, 0x72,
+  0x66, 0x00, 0xd2, 0x5a, 0x00, 0x02, 0x02, 0x69, 0x76, 0x01, 0x16, 0x3d,
+  0x03, 0x6e, 0x65, 0x72, 0x01, 0x16, 0x58, 0x00, 0x02, 0x01, 0x62, 0x00,
+  0xcf, 0x01, 0x03, 0x6e, 0x69, 0x67, 0x01, 0x16, 0x64, 0x00, 0x01, 0x01,
+  0x62, 0x00, 0xcb, 0xa7, 0x00, 0x02, 0x02, 0x63, 0x61, 0x00, 0xf9, 0x2d,
+  0x08, 0x70, 0x61, 0x72, 0x67, 0x6f, 0x74, 0x6f, 0x68, 0x01, 0x16, 0x6c,
+  0x00, 0x01, 0x01, 0x68, 0x00, 0xcb, 0xa7, 0x00, 0x02, 0x03, 0x67, 0x69,
+  0x73, 0x00, 0xd5, 0x5d, 0x02, 0x69, 0x61, 0x01, 0x16, 0x73, 0x00, 0x02,
+  0x05, 0x61, 0x63, 0x73, 0x64, 0x6e, 0x01, 0x16, 0x8a, 0x06, 0x65, 0x65,
+  0x6b, 0x6b, 0x6f, 0x6f, 0x00, 0xfb, 0x0d, 0x00, 0x03, 0x02, 0x65, 0x63,
+  0x00, 0x5f, 0xaf, 0x01, 0x69, 0x01, 0x14, 0xad, 0x01, 0x75, 0x00, 0xfb,
+  0x28, 0x00, 0x04, 0x01, 0x2d, 0x01, 0x16, 0x91, 0x01, 0x69, 0x00, 0x85,
+  0x88, 0x02, 0x6e, 0x6d, 0x00, 0x1e, 0x59, 0x01, 0x73, 0x00, 0x68, 0x09,
+  0x00, 0x02, 0x02, 0x61, 0x6c, 0x01, 0x16, 0x6c, 0x01, 0x77, 0x01, 0x16,
+  0x8a, 0x00, 0x03, 0x0e, 0x61, 0x72, 0x65, 0x6c, 0x65, 0x63, 0x63, 0x61,
+  0x6c, 0x61, 0x62, 0x6f, 0x6c, 0x67, 0x00, 0xd2, 0x3a, 0x01, 0x63, 0x01,
+  0x16, 0x9f, 0x03, 0x73, 0x75, 0x73, 0x00, 0xfd, 0xa5, 0x00, 0x02, 0x05,
+  0x74, 0x73, 0x6f, 0x68, 0x2e, 0x01, 0x16, 0xab, 0x09, 0x75, 0x67, 0x6f,
+  0x6c, 0x62, 0x2d, 0x6e, 0x6f, 0x6d, 0x01, 0x16, 0x2e, 0x00, 0x02, 0x01,
+  0x2d, 0x00, 0x62, 0xa3, 0x01, 0x65, 0x00, 0xf5, 0x1c, 0x00, 0x02, 0x0d,
+  0x61, 0x70, 0x73, 0x6e, 0x61, 0x65, 0x63, 0x6f, 0x6c, 0x61, 0x74, 0x69,
+  0x67, 0x00, 0xec, 0xc8, 0x08, 0x69, 0x76, 0x65, 0x64, 0x2d, 0x61, 0x6e,
+  0x65, 0x00, 0xc6, 0x00, 0x00, 0x01, 0x01, 0x76, 0x00, 0x1c, 0x65, 0x00,
+  0x02, 0x01, 0x69, 0x01, 0x16, 0xba, 0x05, 0x79, 0x73, 0x6b, 0x63, 0x69,
+  0x00, 0x60, 0x53, 0x00, 0x01, 0x01, 0x66, 0x00, 0x93, 0x5b, 0x00, 0x02,
+  0x01, 0x65, 0x01, 0x16, 0xc6, 0x05, 0x74, 0x6e, 0x65, 0x6c, 0x74, 0x00,
+  0xc0, 0xec, 0x00, 0x02, 0x01, 0x65, 0x00, 0xf5, 0x15, 0x01, 0x70, 0x00,
+  0xd6, 0x2b, 0x00, 0x06, 0x01, 0x2d, 0x01, 0x14, 0x5a, 0x02, 0x64, 0x79,
+  0x00, 0xc8, 0x6c, 0x01, 0x67, 0x00, 0x35, 0xb8, 0x04, 0x68, 0x74, 0x69,
+  0x77, 0x00, 0x80, 0x30, 0x01, 0x6d, 0x00, 0xf5, 0xcc, 0x01, 0x74, 0x00,
+  0x58, 0xaf, 0x00, 0x01, 0x01, 0x63, 0x00, 0xf9, 0x34, 0x00, 0x01, 0x01,
+  0x6f, 0x01, 0x10, 0x1d, 0x00, 0x01, 0x04, 0x61, 0x65, 0x67, 0x68, 0x00,
+  0x4a, 0x79, 0x00, 0x02, 0x01, 0x69, 0x00, 0xf3, 0xff, 0x01, 0x6e, 0x00,
+  0x64, 0x65, 0x00, 0x02, 0x0a, 0x6e, 0x74, 0x72, 0x61, 0x70, 0x2d, 0x70,
+  0x61, 0x65, 0x6c, 0x00, 0x4c, 0x11, 0x07, 0x74, 0x73, 0x6f, 0x68, 0x6d,
+  0x61, 0x65, 0x00, 0x5f, 0xbd, 0x00, 0x02, 0x02, 0x6c, 0x2d, 0x00, 0xd5,
+  0xd2, 0x02, 0x72, 0x74, 0x00, 0xfd, 0x1d, 0x00, 0x02, 0x05, 0x65, 0x64,
+  0x6f, 0x6e, 0x69, 0x00, 0xc6, 0x32, 0x04, 0x72, 0x74, 0x6c, 0x75, 0x00,
+  0xf4, 0x3b, 0x00, 0x07, 0x01, 0x61, 0x01, 0x16, 0xce, 0x01, 0x69, 0x00,
+  0x93, 0xac, 0x03, 0x6c, 0x61, 0x63, 0x00, 0x40, 0x35, 0x02, 0x72, 0x65,
+  0x01, 0x16, 0xdd, 0x01, 0x73, 0x00, 0x27, 0xf5, 0x03, 0x74, 0x6f, 0x6c,
+  0x01, 0x16, 0xec, 0x01, 0x78, 0x01, 0x16, 0xf4, 0x00, 0x04, 0x01, 0x65,
+  0x00, 0xc9, 0x2d, 0x02, 0x68, 0x74, 0x01, 0x16, 0xfb, 0x02, 0x6c, 0x61,
+  0x01, 0x17, 0x0e, 0x02, 0x74, 0x73, 0x01, 0x17, 0x24, 0x00, 0x02, 0x02,
+  0x61, 0x65, 0x01, 0x17, 0x33, 0x03, 0x65, 0x77, 0x2d, 0x01, 0x17, 0x42,
+  0x00, 0x02, 0x03, 0x2d, 0x74, 0x73, 0x01, 0x17, 0x4e, 0x01, 0x73, 0x00,
+  0x0e, 0x15, 0x00, 0x01, 0x01, 0x64, 0x00, 0xcb, 0xa7, 0x00, 0x02, 0x01,
+  0x65, 0x00, 0x5f, 0xf6, 0x01, 0x6f, 0x00, 0x9b, 0xb5, 0x00, 0x01, 0x01,
+  0x63, 0x01, 0x17, 0x65, 0x00, 0x04, 0x03, 0x64, 0x75, 0x74, 0x01, 0x14,
+  0xb4, 0x05, 0x72, 0x2d, 0x6f, 0x74, 0x2d, 0x00, 0xdf, 0xd0, 0x08, 0x74,
+  0x6e, 0x6f, 0x63, 0x72, 0x65, 0x73, 0x75, 0x01, 0x17, 0x6c, 0x06, 0x79,
+  0x6f, 0x6a, 0x2e, 0x73, 0x6e, 0x00, 0xc9, 0x37, 0x01, 0x01, 0x01, 0x2e,
+  0x00, 0x94, 0xca, 0x00, 0x05, 0x07, 0x68, 0x63, 0x72, 0x61, 0x6e, 0x61,
+  0x2d, 0x01, 0x17, 0x7d, 0x04, 0x6c, 0x61, 0x69, 0x63, 0x00, 0xf5, 0x9f,
+  0x05, 0x70, 0x61, 0x72, 0x65, 0x68, 0x01, 0x15, 0xb5, 0x02, 0x74, 0x72,
+  0x01, 0x17, 0x65, 0x01, 0x78, 0x00, 0xf6, 0x0e, 0x00, 0x02, 0x02, 0x70,
+  0x69, 0x00, 0x97, 0xbe, 0x01, 0x73, 0x00, 0xf5, 0x80, 0x00, 0x01, 0x01,
+  0x61, 0x00, 0x39, 0x21, 0x01, 0x01, 0x01, 0x2e, 0x01, 0x17, 0x89, 0x00,
+  0x02, 0x02, 0x65, 0x72, 0x01, 0x10, 0xf0, 0x02, 0x70, 0x65, 0x00, 0xcd,
+  0xaf, 0x00, 0x01, 0x01, 0x61, 0x00, 0x97, 0xbe, 0x00, 0x01, 0x01, 0x6f,
+  0x00, 0x41, 0x08, 0x00, 0x02, 0x02, 0x68, 0x73, 0x00, 0xcc, 0xcf, 0x06,
+  0x6d, 0x61, 0x70, 0x73, 0x6f, 0x6e, 0x00, 0x62, 0x34, 0x00, 0x02, 0x01,
+  0x61, 0x01, 0x17, 0x9b, 0x02, 0x72, 0x66, 0x01, 0x17, 0xa2, 0x00, 0x01,
+  0x04, 0x70, 0x6c, 0x65, 0x64, 0x01, 0x03, 0x4a, 0x00, 0x01, 0x01, 0x68,
+  0x00, 0xc6, 0x93, 0x01, 0x01, 0x04, 0x68, 0x73, 0x69, 0x74, 0x00, 0xc9,
+  0x0a, 0x00, 0x02, 0x02, 0x61, 0x72, 0x01, 0x07, 0x07, 0x03, 0x65, 0x74,
+  0x61, 0x00, 0xc8, 0xdb, 0x00, 0x02, 0x02, 0x69, 0x67, 0x00, 0x41, 0xd5,
+  0x04, 0x72, 0x6f, 0x66, 0x69, 0x00, 0x41, 0xce, 0x01, 0x01, 0x01, 0x74,
+  0x00, 0x94, 0xc3, 0x00, 0x02, 0x01, 0x62, 0x00, 0x6a, 0x8b, 0x01, 0x6e,
+  0x00, 0x4c, 0x7f, 0x00, 0x02, 0x01, 0x6d, 0x00, 0x0e, 0x15, 0x01, 0x72,
+  0x00, 0x0e, 0x15, 0x00, 0x02, 0x01, 0x63, 0x00, 0xf4, 0x7e, 0x01, 0x69,
+  0x00, 0xa9, 0x10, 0x00, 0x01, 0x02, 0x68, 0x74, 0x00, 0xf5, 0x0e, 0x00,
+  0x01, 0x01, 0x73, 0x00, 0x83, 0x34, 0x00, 0x01, 0x07, 0x70, 0x61, 0x72,
+  0x67, 0x6f, 0x6e, 0x61, 0x01, 0x16, 0xec, 0x00, 0x03, 0x05, 0x63, 0x61,
+  0x72, 0x70, 0x6f, 0x01, 0x10, 0x16, 0x01, 0x6c, 0x00, 0x83, 0x3b, 0x05,
+  0x6e, 0x61, 0x6c, 0x74, 0x61, 0x01, 0x17, 0xa9, 0x00, 0x01, 0x01, 0x6d,
+  0x00, 0x85, 0xf3, 0x00, 0x01, 0x01, 0x69, 0x00, 0x67, 0x6c, 0x01, 0x01,
+  0x01, 0x6c, 0x01, 0x17, 0xb0, 0x00, 0x02, 0x0a, 0x62, 0x72, 0x6f, 0x66,
+  0x73, 0x64, 0x67, 0x79, 0x62, 0x6d, 0x00, 0x6a, 0xcc, 0x07, 0x6f, 0x73,
+  0x64, 0x6e, 0x61, 0x65, 0x67, 0x00, 0x4f, 0xdc, 0x00, 0x02, 0x01, 0x6c,
+  0x01, 0x17, 0xce, 0x01, 0x70, 0x00, 0x27, 0x0f, 0x00, 0x02, 0x01, 0x61,
+  0x01, 0x17, 0xdc, 0x01, 0x65, 0x01, 0x17, 0xea, 0x00, 0x02, 0x01, 0x6c,
+  0x00, 0x4b, 0x2c, 0x05, 0x74, 0x69, 0x72, 0x65, 0x68, 0x01, 0x18, 0x07,
+  0x00, 0x02, 0x01, 0x73, 0x00, 0xf5, 0x3a, 0x02, 0x74, 0x78, 0x00, 0x6b,
+  0x7d, 0x01, 0x01, 0x01, 0x69, 0x00, 0x4c, 0xde, 0x00, 0x02, 0x01, 0x75,
+  0x00, 0xc7, 0xe3, 0x05, 0x77, 0x61, 0x6c, 0x65, 0x64, 0x01, 0x18, 0x0e,
+  0x00, 0x02, 0x02, 0x68, 0x73, 0x01, 0x18, 0x17, 0x01, 0x6f, 0x01, 0x18,
+  0x2b, 0x00, 0x04, 0x01, 0x61, 0x00, 0x0f, 0x6f, 0x01, 0x63, 0x00, 0x9b,
+  0xe6, 0x01, 0x69, 0x00, 0x98, 0x5f, 0x03, 0x6c, 0x75, 0x63, 0x01, 0x18,
+  0x32, 0x00, 0x01, 0x01, 0x6e, 0x00, 0x93, 0x54, 0x00, 0x01, 0x01, 0x69,
+  0x00, 0x13, 0x5b, 0x01, 0x01, 0x01, 0x6c, 0x00, 0x2b, 0x73, 0x00, 0x03,
+  0x03, 0x6c, 0x6f, 0x63, 0x01, 0x0e, 0xf9, 0x01, 0x72, 0x00, 0x68, 0x09,
+  0x02, 0x74, 0x73, 0x01, 0x18, 0x3e, 0x00, 0x01, 0x01, 0x73, 0x00, 0x62,
+  0x3b, 0x00, 0x07, 0x01, 0x64, 0x00, 0xf9, 0xe9, 0x08, 0x67, 0x69, 0x6e,
+  0x65, 0x72, 0x65, 0x76, 0x6d, 0x01, 0x18, 0x45, 0x01, 0x6b, 0x00, 0x4b,
+  0xdd, 0x02, 0x6c, 0x61, 0x00, 0x1b, 0x9f, 0x01, 0x6e, 0x00, 0x39, 0x28,
+  0x06, 0x70, 0x65, 0x65, 0x6b, 0x65, 0x6d, 0x00, 0x3d, 0xfb, 0x01, 0x76,
+  0x00, 0x17, 0xbd, 0x00, 0x01, 0x02, 0x74, 0x73, 0x01, 0x18, 0x4c, 0x00,
+  0x02, 0x01, 0x62, 0x01, 0x18, 0x53, 0x02, 0x6f, 0x62, 0x01, 0x18, 0x73,
+  0x00, 0x01, 0x01, 0x69, 0x01, 0x18, 0x80, 0x00, 0x02, 0x01, 0x6e, 0x00,
+  0x0e, 0x15, 0x01, 0x77, 0x00, 0x60, 0xa3, 0x00, 0x02, 0x01, 0x6d, 0x00,
+  0x6b, 0x45, 0x01, 0x79, 0x00, 0x0e, 0x15, 0x01, 0x02, 0x05, 0x2d, 0x64,
+  0x6e, 0x61, 0x2d, 0x01, 0x18, 0x87, 0x03, 0x64, 0x6e, 0x61, 0x01, 0x18,
+  0x87, 0x00, 0x01, 0x01, 0x6e, 0x00, 0x71, 0x52, 0x00, 0x02, 0x01, 0x6e,
+  0x00, 0x28, 0xd5, 0x02, 0x72, 0x65, 0x00, 0xe6, 0xa0, 0x01, 0x01, 0x01,
+  0x77, 0x00, 0x22, 0x26, 0x00, 0x04, 0x01, 0x64, 0x00, 0x5d, 0xb5, 0x04,
+  0x67, 0x6f, 0x6c, 0x6f, 0x01, 0x18, 0x8f, 0x01, 0x6e, 0x01, 0x18, 0xa1,
+  0x01, 0x72, 0x01, 0x18, 0xa8, 0x00, 0x02, 0x01, 0x63, 0x00, 0xdf, 0xc9,
+  0x01, 0x6e, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x03, 0x75, 0x74, 0x6c, 0x00,
+  0x5d, 0x09, 0x00, 0x01, 0x01, 0x74, 0x00, 0x41, 0xd5, 0x00, 0x02, 0x01,
+  0x61, 0x00, 0x15, 0x5e, 0x01, 0x73, 0x00, 0xbc, 0xad, 0x00, 0x01, 0x01,
+  0x65, 0x00, 0x5c, 0x4f, 0x00, 0x02, 0x02, 0x62, 0x65, 0x00, 0x60, 0x2d,
+  0x06, 0x68, 0x73, 0x6e, 0x6f, 0x65, 0x67, 0x00, 0x91, 0xe6, 0x00, 0x02,
+  0x01, 0x68, 0x00, 0x27, 0x0f, 0x04, 0x72, 0x64, 0x6e, 0x65, 0x01, 0x07,
+  0x21, 0x00, 0x02, 0x01, 0x62, 0x00, 0x0e, 0x15, 0x01, 0x6d, 0x01, 0x18,
+  0xaf, 0x00, 0x02, 0x04, 0x6e, 0x65, 0x74, 0x6c, 0x00, 0xb8, 0x6f, 0x01,
+  0x72, 0x00, 0x37, 0xa5, 0x00, 0x01, 0x03, 0x6e, 0x72, 0x75, 0x00, 0x61,
+  0xc1, 0x00, 0x01, 0x01, 0x61, 0x00, 0x98, 0x90, 0x00, 0x02, 0x03, 0x74,
+  0x65, 0x6e, 0x00, 0xb9, 0x62, 0x01, 0x75, 0x00, 0x64, 0xbd, 0x01, 0x01,
+  0x05, 0x69, 0x72, 0x65, 0x6d, 0x61, 0x01, 0x18, 0xb6, 0x00, 0x02, 0x01,
+  0x64, 0x00, 0x66, 0x03, 0x03, 0x74, 0x70, 0x79, 0x00, 0xb8, 0x08, 0x00,
+  0x01, 0x01, 0x73, 0x00, 0x1c, 0x65, 0x00, 0x03, 0x02, 0x61, 0x6c, 0x01,
+  0x11, 0x44, 0x01, 0x65, 0x00, 0x4e, 0x75, 0x03, 0x72, 0x61, 0x67, 0x01,
+  0x18, 0xbe, 0x00, 0x01, 0x01, 0x65, 0x00, 0x2b, 0x73, 0x00, 0x01, 0x01,
+  0x74, 0x01, 0x18, 0xd1, 0x00, 0x03, 0x01, 0x64, 0x00, 0xeb, 0x9d, 0x01,
+  0x65, 0x00, 0x72, 0x54, 0x02, 0x68, 0x75, 0x01, 0x18, 0xd8, 0x00, 0x01,
+  0x01, 0x65, 0x00, 0x4c, 0x3f, 0x00, 0x02, 0x01, 0x61, 0x00, 0x67, 0x73,
+  0x01, 0x75, 0x00, 0xff, 0x6f, 0x01, 0x01, 0x03, 0x6e, 0x65, 0x73, 0x00,
+  0xe4, 0x92, 0x00, 0x01, 0x01, 0x6a, 0x00, 0x26, 0xc4, 0x00, 0x01, 0x01,
+  0x73, 0x00, 0x84, 0x70, 0x00, 0x02, 0x01, 0x73, 0x01, 0x18, 0xe5, 0x01,
+  0x74, 0x01, 0x18, 0xf2, 0x00, 0x04, 0x01, 0x64, 0x00, 0x22, 0x1f, 0x01,
+  0x69, 0x00, 0xc5, 0xcc, 0x04, 0x72, 0x65, 0x66, 0x66, 0x00, 0x1c, 0x89,
+  0x02, 0x73, 0x72, 0x00, 0x29, 0x5f, 0x00, 0x03, 0x04, 0x65, 0x72, 0x62,
+  0x65, 0x00, 0x65, 0xc6, 0x01, 0x6e, 0x00, 0x67, 0x2e, 0x01, 0x73, 0x00,
+  0x17, 0x57, 0x00, 0x05, 0x01, 0x62, 0x00, 0x0e, 0x15, 0x01, 0x64, 0x00,
+  0x64, 0xb6, 0x01, 0x74, 0x01, 0x18, 0xd1, 0x01, 0x75, 0x00, 0x53, 0x44,
+  0x01, 0x7a, 0x00, 0x12, 0xe2, 0x00, 0x01, 0x01, 0x77, 0x00, 0x22, 0x26,
+  0x00, 0x02, 0x01, 0x63, 0x00, 0x37, 0xb3, 0x01, 0x74, 0x00, 0x41, 0x08,
+  0x00, 0x01, 0x01, 0x72, 0x00, 0x46, 0x7c, 0x00, 0x01, 0x01, 0x74, 0x00,
+  0x71, 0x52, 0x00, 0x01, 0x02, 0x69, 0x76, 0x00, 0x2b, 0x7a, 0x00, 0x02,
+  0x01, 0x6d, 0x00, 0x26, 0xd7, 0x01, 0x79, 0x00, 0x0f, 0xfa, 0x00, 0x01,
+  0x01, 0x72, 0x00, 0x71, 0x59, 0x00, 0x05, 0x01, 0x61, 0x00, 0x31, 0x9e,
+  0x01, 0x65, 0x00, 0x60, 0x95, 0x03, 0x6e, 0x65, 0x63, 0x01, 0x19, 0x06,
+  0x01, 0x73, 0x01, 0x19, 0x1e, 0x01, 0x75, 0x00, 0x83, 0x56, 0x00, 0x02,
+  0x01, 0x67, 0x00, 0x0e, 0x15, 0x01, 0x6c, 0x01, 0x19, 0x2c, 0x01, 0x01,
+  0x01, 0x6c, 0x01, 0x00, 0x5d, 0x00, 0x03, 0x01, 0x64, 0x00, 0x4d, 0x5d,
+  0x06, 0x72, 0x6f, 0x74, 0x73, 0x69, 0x68, 0x01, 0x19, 0x38, 0x03, 0x73,
+  0x65, 0x6c, 0x00, 0x20, 0xed, 0x00, 0x03, 0x01, 0x61, 0x00, 0x35, 0x51,
+  0x04, 0x65, 0x67, 0x6e, 0x61, 0x01, 0x16, 0x36, 0x01, 0x6c, 0x01, 0x19,
+  0x46, 0x00, 0x02, 0x01, 0x65, 0x01, 0x19, 0x53, 0x01, 0x74, 0x00, 0xc4,
+  0xb6, 0x00, 0x01, 0x01, 0x63, 0x00, 0xff, 0x84, 0x00, 0x02, 0x01, 0x65,
+  0x00, 0x0f, 0x6f, 0x01, 0x71, 0x01, 0x19, 0x60, 0x00, 0x01, 0x02, 0x6e,
+  0x61, 0x00, 0x73, 0x71, 0x00, 0x01, 0x01, 0x69, 0x00, 0x1c, 0x65, 0x00,
+  0x01, 0x01, 0x69, 0x00, 0xf5, 0x23, 0x00, 0x02, 0x01, 0x62, 0x01, 0x15,
+  0x04, 0x01, 0x6c, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x02, 0x72, 0x64, 0x00,
+  0xeb, 0x9d, 0x00, 0x02, 0x01, 0x73, 0x00, 0xc5, 0x99, 0x0a, 0x74, 0x61,
+  0x63, 0x69, 0x6e, 0x75, 0x6d, 0x6d, 0x6f, 0x63, 0x01, 0x19, 0x70, 0x00,
+  0x01, 0x01, 0x74, 0x01, 0x19, 0x80, 0x00, 0x01, 0x01, 0x65, 0x01, 0x19,
+  0x87, 0x01, 0x01, 0x04, 0x64, 0x6e, 0x61, 0x73, 0x00, 0x67, 0x73, 0x00,
+  0x01, 0x01, 0x6c, 0x00, 0x29, 0xae, 0x01, 0x03, 0x01, 0x65, 0x01, 0x19,
+  0x8e, 0x01, 0x73, 0x00, 0x5d, 0xbc, 0x02, 0x78, 0x75, 0x00, 0x5a, 0x29,
+  0x01, 0x01, 0x02, 0x6d, 0x75, 0x00, 0x64, 0x4f, 0x00, 0x03, 0x02, 0x65,
+  0x6c, 0x01, 0x02, 0x3b, 0x01, 0x6e, 0x01, 0x19, 0xa2, 0x05, 0x70, 0x69,
+  0x75, 0x71, 0x65, 0x00, 0xfe, 0x6c, 0x01, 0x08, 0x01, 0x64, 0x01, 0x19,
+  0xac, 0x02, 0x65, 0x6e, 0x00, 0x60, 0x40, 0x03, 0x67, 0x74, 0x74, 0x01,
+  0x10, 0x2b, 0x03, 0x68, 0x73, 0x69, 0x00, 0x91, 0xed, 0x01, 0x6b, 0x00,
+  0xf5, 0x07, 0x01, 0x6e, 0x01, 0x19, 0xb3, 0x03, 0x74, 0x61, 0x6d, 0x00,
+  0x8d, 0xab, 0x04, 0x79, 0x72, 0x61, 0x72, 0x01, 0x19, 0xc1, 0x00, 0x03,
+  0x01, 0x61, 0x00, 0x25, 0x56, 0x01, 0x73, 0x00, 0xc9, 0x7a, 0x01, 0x77,
+  0x00, 0x22, 0x26, 0x00, 0x02, 0x01, 0x63, 0x00, 0x58, 0x39, 0x02, 0x6f,
+  0x63, 0x01, 0x19, 0xcb, 0x00, 0x02, 0x05, 0x6f, 0x68, 0x6e, 0x65, 0x6d,
+  0x00, 0x67, 0x20, 0x04, 0x75, 0x68, 0x6c, 0x79, 0x00, 0x4c, 0xde, 0x00,
+  0x02, 0x02, 0x65, 0x74, 0x00, 0x40, 0xdc, 0x01, 0x6c, 0x00, 0xfe, 0x73,
+  0x00, 0x02, 0x02, 0x65, 0x6b, 0x00, 0x41, 0xdc, 0x01, 0x6c, 0x01, 0x19,
+  0xd2, 0x00, 0x02, 0x01, 0x64, 0x00, 0x91, 0xc5, 0x01, 0x6f, 0x00, 0x12,
+  0x22, 0x00, 0x02, 0x03, 0x6e, 0x72, 0x65, 0x00, 0x38, 0x2f, 0x03, 0x72,
+  0x65, 0x6a, 0x01, 0x01, 0x45, 0x00, 0x02, 0x01, 0x61, 0x00, 0xcc, 0x3e,
+  0x01, 0x67, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x01, 0x63, 0x00, 0x6b, 0x7d,
+  0x01, 0x74, 0x00, 0x1d, 0x34, 0x00, 0x02, 0x02, 0x72, 0x68, 0x01, 0x01,
+  0x5f, 0x01, 0x74, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x02, 0x61, 0x6c, 0x00,
+  0x85, 0xd3, 0x00, 0x01, 0x01, 0x6d, 0x00, 0x5f, 0xdf, 0x00, 0x01, 0x02,
+  0x64, 0x61, 0x00, 0x92, 0x7a, 0x00, 0x01, 0x01, 0x74, 0x00, 0x17, 0x57,
+  0x00, 0x02, 0x01, 0x72, 0x01, 0x19, 0xc1, 0x03, 0x74, 0x69, 0x6c, 0x00,
+  0x39, 0x28, 0x00, 0x03, 0x04, 0x64, 0x69, 0x6f, 0x72, 0x00, 0x8d, 0x29,
+  0x04, 0x6c, 0x6c, 0x61, 0x67, 0x01, 0x19, 0xdf, 0x01, 0x76, 0x00, 0x51,
+  0x82, 0x01, 0x06, 0x01, 0x64, 0x01, 0x03, 0xb6, 0x01, 0x65, 0x01, 0x19,
+  0x87, 0x06, 0x67, 0x6e, 0x69, 0x76, 0x69, 0x6c, 0x01, 0x19, 0xe6, 0x02,
+  0x6c, 0x61, 0x01, 0x19, 0xed, 0x04, 0x72, 0x65, 0x74, 0x75, 0x00, 0x83,
+  0x56, 0x01, 0x73, 0x00, 0x5d, 0xbc, 0x00, 0x01, 0x02, 0x6e, 0x61, 0x01,
+  0x02, 0x42, 0x01, 0x01, 0x02, 0x6c, 0x61, 0x01, 0x01, 0xe9, 0x00, 0x02,
+  0x01, 0x6e, 0x00, 0xa0, 0x42, 0x01, 0x73, 0x00, 0x92, 0x18, 0x00, 0x02,
+  0x04, 0x65, 0x2e, 0x31, 0x2d, 0x01, 0x19, 0xf9, 0x01, 0x6c, 0x00, 0xed,
+  0x5b, 0x00, 0x02, 0x01, 0x65, 0x01, 0x1a, 0x09, 0x02, 0x6c, 0x65, 0x01,
+  0x1a, 0x09, 0x00, 0x01, 0x01, 0x6c, 0x00, 0x2a, 0x10, 0x00, 0x02, 0x01,
+  0x70, 0x00, 0x30, 0x72, 0x07, 0x73, 0x64, 0x72, 0x61, 0x79, 0x6b, 0x63,
+  0x00, 0x61, 0x75, 0x00, 0x01, 0x01, 0x63, 0x00, 0x53, 0x44, 0x00, 0x01,
+  0x01, 0x6b, 0x00, 0x25, 0x56, 0x00, 0x01, 0x01, 0x69, 0x00, 0x60, 0x2d,
+  0x00, 0x01, 0x01, 0x6c, 0x00, 0x6b, 0x7d, 0x00, 0x01, 0x01, 0x64, 0x01,
+  0x04, 0x2a, 0x00, 0x01, 0x01, 0x2e, 0x01, 0x1a, 0x10, 0x00, 0x01, 0x01,
+  0x72, 0x00, 0x33, 0x7f, 0x00, 0x02, 0x05, 0x65, 0x67, 0x6e, 0x69, 0x64,
+  0x00, 0x2a, 0xfa, 0x03, 0x6f, 0x72, 0x66, 0x00, 0xe0, 0xc6, 0x00, 0x01,
+  0x01, 0x79, 0x00, 0x10, 0xd5, 0x00, 0x01, 0x01, 0x6c, 0x00, 0x33, 0x14,
+  0x00, 0x01, 0x01, 0x65, 0x00, 0x2a, 0x53, 0x00, 0x02, 0x01, 0x65, 0x00,
+  0x26, 0xde, 0x01, 0x67, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x73, 0x00,
+  0x0d, 0xc5, 0x00, 0x01, 0x02, 0x73, 0x69, 0x00, 0x0d, 0xc5, 0x01, 0x03,
+  0x02, 0x2d, 0x69, 0x00, 0xaa, 0xfc, 0x01, 0x66, 0x00, 0x0e, 0x15, 0x01,
+  0x74, 0x00, 0x0e, 0x15, 0x00, 0x03, 0x01, 0x61, 0x01, 0x1a, 0x1c, 0x01,
+  0x69, 0x00, 0x40, 0xdc, 0x02, 0x73, 0x61, 0x01, 0x1a, 0x28, 0x00, 0x02,
+  0x01, 0x66, 0x00, 0x26, 0x0f, 0x01, 0x74, 0x00, 0x26, 0x0f, 0x00, 0x02,
+  0x03, 0x65, 0x6d, 0x62, 0x00, 0x10, 0xd5, 0x03, 0x69, 0x6d, 0x70, 0x00,
+  0x10, 0xd5, 0x00, 0x02, 0x01, 0x6d, 0x00, 0x33, 0x7f, 0x01, 0x6e, 0x00,
+  0x67, 0xba, 0x00, 0x02, 0x01, 0x64, 0x01, 0x1a, 0x34, 0x02, 0x6e, 0x67,
+  0x00, 0x33, 0x7f, 0x00, 0x02, 0x02, 0x6c, 0x6d, 0x00, 0x33, 0x7f, 0x01,
+  0x79, 0x01, 0x1a, 0x34, 0x00, 0x03, 0x02, 0x6c, 0x62, 0x00, 0xe2, 0xf9,
+  0x01, 0x72, 0x01, 0x04, 0x72, 0x01, 0x79, 0x01, 0x1a, 0x3b, 0x00, 0x02,
+  0x03, 0x61, 0x62, 0x72, 0x00, 0x67, 0xba, 0x03, 0x69, 0x76, 0x6a, 0x00,
+  0x12, 0xf0, 0x00, 0x01, 0x01, 0x73, 0x00, 0x0f, 0x92, 0x00, 0x02, 0x01,
+  0x61, 0x00, 0xe0, 0x46, 0x01, 0x6e, 0x00, 0x4b, 0x1e, 0x00, 0x02, 0x02,
+  0x64, 0x6e, 0x00, 0x10, 0xce, 0x01, 0x74, 0x01, 0x05, 0x02, 0x00, 0x01,
+  0x04, 0x69, 0x2d, 0x79, 0x72, 0x00, 0x95, 0xd7, 0x00, 0x01, 0x01, 0x69,
+  0x01, 0x1a, 0x52, 0x00, 0x04, 0x01, 0x62, 0x00, 0x2a, 0x10, 0x02, 0x6b,
+  0x6b, 0x00, 0x67, 0x6c, 0x02, 0x6c, 0x6c, 0x00, 0x52, 0x9a, 0x01, 0x6e,
+  0x01, 0x1a, 0x59, 0x00, 0x02, 0x01, 0x61, 0x00, 0x84, 0x69, 0x03, 0x69,
+  0x72, 0x64, 0x00, 0x4f, 0x2d, 0x00, 0x02, 0x01, 0x61, 0x00, 0x21, 0x6d,
+  0x01, 0x65, 0x00, 0xe4, 0xc5, 0x00, 0x01, 0x01, 0x65, 0x01, 0x1a, 0x60,
+  0x00, 0x09, 0x04, 0x2d, 0x65, 0x72, 0x64, 0x01, 0x1a, 0x67, 0x06, 0x61,
+  0x64, 0x72, 0x6f, 0x68, 0x2e, 0x00, 0x27, 0x2c, 0x05, 0x64, 0x72, 0x6f,
+  0x6e, 0x2e, 0x01, 0x1a, 0x73, 0x01, 0x65, 0x01, 0x1a, 0x84, 0x01, 0x67,
+  0x00, 0xc9, 0x5c, 0x01, 0x6e, 0x00, 0xb3, 0x27, 0x01, 0x6f, 0x01, 0x1a,
+  0x96, 0x01, 0x72, 0x01, 0x1a, 0xa8, 0x01, 0x74, 0x01, 0x0f, 0x9b, 0x01,
+  0x01, 0x01, 0x65, 0x01, 0x1a, 0xb4, 0x00, 0x03, 0x01, 0x65, 0x01, 0x07,
+  0xc3, 0x01, 0x6e, 0x01, 0x1a, 0xc7, 0x01, 0x72, 0x00, 0x3f, 0xd8, 0x01,
+  0x01, 0x01, 0x6f, 0x00, 0x27, 0x0f, 0x01, 0x08, 0x01, 0x64, 0x01, 0x1a,
+  0xd2, 0x01, 0x65, 0x01, 0x1a, 0xdf, 0x01, 0x6b, 0x01, 0x1a, 0xec, 0x01,
+  0x6c, 0x01, 0x1a, 0xf3, 0x01, 0x6e, 0x01, 0x1a, 0xc7, 0x01, 0x72, 0x01,
+  0x1a, 0xfa, 0x01, 0x74, 0x00, 0x39, 0x74, 0x04, 0x79, 0x6f, 0x6e, 0x6e,
+  0x00, 0x91, 0xa1, 0x00, 0x02, 0x02, 0x65, 0x70, 0x00, 0xcd, 0xa8, 0x01,
+  0x6c, 0x00, 0x26, 0xd7, 0x00, 0x02, 0x01, 0x66, 0x01, 0x1b, 0x07, 0x01,
+  0x6c, 0x00, 0x25, 0x56, 0x00, 0x01, 0x03, 0x65, 0x6c, 0x6c, 0x00, 0x5d,
+  0xbc, 0x00, 0x01, 0x01, 0x6e, 0x00, 0x67, 0x6c, 0x00, 0x04, 0x01, 0x64,
+  0x00, 0xe4, 0x92, 0x01, 0x65, 0x00, 0x84, 0x69, 0x01, 0x67, 0x00, 0xc4,
+  0xaf, 0x01, 0x6e, 0x00, 0x46, 0x7c, 0x00, 0x02, 0x02, 0x61, 0x67, 0x01,
+  0x1b, 0x29, 0x01, 0x6f, 0x00, 0x15, 0x5e, 0x00, 0x02, 0x03, 0x6e, 0x75,
+  0x6d, 0x00, 0xbc, 0xad, 0x01, 0x72, 0x00, 0x56, 0x74, 0x00, 0x04, 0x02,
+  0x67, 0x6e, 0x00, 0xc8, 0x6c, 0x01, 0x6e, 0x00, 0x88, 0x51, 0x01, 0x73,
+  0x01, 0x1b, 0x31, 0x01, 0x74, 0x00, 0xba, 0x9e, 0x00, 0x02, 0x01, 0x69,
+  0x00, 0x27, 0x0f, 0x02, 0x6e, 0x79, 0x00, 0x26, 0xde, 0x00, 0x03, 0x01,
+  0x65, 0x00, 0x12, 0x22, 0x01, 0x6c, 0x01, 0x1b, 0x3d, 0x01, 0x75, 0x01,
+  0x1b, 0x4c, 0x00, 0x07, 0x01, 0x61, 0x00, 0x12, 0x22, 0x01, 0x65, 0x00,
+  0x44, 0x12, 0x01, 0x67, 0x00, 0x48, 0x25, 0x01, 0x69, 0x01, 0x1b, 0x5d,
+  0x01, 0x6b, 0x00, 0x48, 0x25, 0x01, 0x6e, 0x00, 0x13, 0x5b, 0x01, 0x6f,
+  0x00, 0x16, 0xb8, 0x00, 0x05, 0x01, 0x61, 0x01, 0x1b, 0x6e, 0x01, 0x65,
+  0x01, 0x1b, 0x7a, 0x01, 0x69, 0x00, 0x27, 0x0f, 0x01, 0x6f, 0x01, 0x1b,
+  0x8b, 0x01, 0x75, 0x01, 0x1b, 0x97, 0x00, 0x04, 0x01, 0x65, 0x01, 0x1b,
+  0xa3, 0x01, 0x6b, 0x00, 0x94, 0xe0, 0x0c, 0x6d, 0x6f, 0x72, 0x2d, 0x67,
+  0x6f, 0x2d, 0x65, 0x72, 0x6f, 0x6d, 0x2e, 0x01, 0x1b, 0xb4, 0x01, 0x75,
+  0x00, 0x40, 0xdc, 0x00, 0x03, 0x01, 0x6c, 0x00, 0x1c, 0x65, 0x02, 0x72,
+  0x61, 0x01, 0x1b, 0xc0, 0x02, 0x73, 0x75, 0x00, 0x29, 0x66, 0x00, 0x02,
+  0x01, 0x6c, 0x01, 0x1b, 0xc7, 0x06, 0x75, 0x2d, 0x67, 0x6f, 0x2d, 0x65,
+  0x00, 0x9c, 0xe4, 0x00, 0x01, 0x01, 0x74, 0x01, 0x00, 0xe9, 0x00, 0x03,
+  0x02, 0x64, 0x6e, 0x00, 0xe6, 0x4e, 0x01, 0x72, 0x01, 0x07, 0x07, 0x02,
+  0x73, 0x73, 0x00, 0x1c, 0x89, 0x00, 0x01, 0x01, 0x76, 0x00, 0x9e, 0x45,
+  0x00, 0x02, 0x01, 0x73, 0x00, 0x22, 0x26, 0x01, 0x74, 0x00, 0x56, 0x74,
+  0x00, 0x02, 0x02, 0x61, 0x67, 0x00, 0x7b, 0xf8, 0x03, 0x6f, 0x6a, 0x66,
+  0x00, 0x39, 0x91, 0x00, 0x01, 0x01, 0x65, 0x00, 0x26, 0xc4, 0x00, 0x03,
+  0x01, 0x61, 0x01, 0x1b, 0xd4, 0x01, 0x69, 0x01, 0x1b, 0xea, 0x01, 0x79,
+  0x00, 0x26, 0xde, 0x00, 0x02, 0x01, 0x64, 0x01, 0x1b, 0xf6, 0x01, 0x74,
+  0x00, 0x4c, 0x46, 0x00, 0x02, 0x01, 0x6c, 0x00, 0x0e, 0x15, 0x06, 0x74,
+  0x2d, 0x65, 0x72, 0x74, 0x73, 0x01, 0x1c, 0x07, 0x00, 0x08, 0x01, 0x6b,
+  0x01, 0x1c, 0x13, 0x01, 0x6d, 0x00, 0xf0, 0x7f, 0x01, 0x6e, 0x01, 0x1c,
+  0x1f, 0x04, 0x72, 0x61, 0x76, 0x2d, 0x01, 0x0f, 0x9b, 0x01, 0x73, 0x00,
+  0xdd, 0x1e, 0x01, 0x74, 0x00, 0x60, 0xb6, 0x01, 0x76, 0x01, 0x1c, 0x2b,
+  0x01, 0x79, 0x00, 0x32, 0x5a, 0x00, 0x03, 0x02, 0x6e, 0x76, 0x00, 0x1c,
+  0x89, 0x01, 0x72, 0x00, 0x5d, 0xb5, 0x01, 0x73, 0x01, 0x1c, 0x37, 0x00,
+  0x02, 0x01, 0x64, 0x00, 0x22, 0x26, 0x01, 0x76, 0x00, 0x41, 0x08, 0x00,
+  0x01, 0x02, 0x6c, 0x6c, 0x00, 0x17, 0xbd, 0x00, 0x02, 0x02, 0x72, 0x69,
+  0x01, 0x1c, 0x43, 0x01, 0x73, 0x00, 0x64, 0xb6, 0x00, 0x01, 0x01, 0x6d,
+  0x00, 0x52, 0xae, 0x00, 0x02, 0x01, 0x69, 0x00, 0x16, 0x9c, 0x01, 0x6f,
+  0x00, 0x97, 0x5e, 0x00, 0x03, 0x01, 0x6d, 0x00, 0x52, 0xae, 0x01, 0x6e,
+  0x00, 0x0e, 0x15, 0x01, 0x76, 0x00, 0x0e, 0x15, 0x00, 0x03, 0x01, 0x64,
+  0x00, 0x66, 0x03, 0x01, 0x74, 0x01, 0x1c, 0x4f, 0x01, 0x76, 0x00, 0x26,
+  0xd7, 0x00, 0x01, 0x01, 0x72, 0x00, 0x28, 0x04, 0x00, 0x01, 0x01, 0x6f,
+  0x01, 0x08, 0x0d, 0x00, 0x02, 0x01, 0x61, 0x01, 0x1c, 0x5b, 0x04, 0x65,
+  0x72, 0x65, 0x66, 0x00, 0x4d, 0x56, 0x00, 0x03, 0x01, 0x67, 0x00, 0x69,
+  0x73, 0x01, 0x6c, 0x00, 0x2e, 0x67, 0x02, 0x7a, 0x61, 0x00, 0xc8, 0x9e,
+  0x00, 0x02, 0x01, 0x61, 0x00, 0x52, 0x55, 0x03, 0x69, 0x6c, 0x67, 0x01,
+  0x1c, 0x70, 0x00, 0x02, 0x07, 0x64, 0x6e, 0x61, 0x68, 0x64, 0x6e, 0x75,
+  0x00, 0x5f, 0x5e, 0x03, 0x6c, 0x65, 0x64, 0x00, 0x64, 0xb6, 0x00, 0x02,
+  0x01, 0x6c, 0x00, 0x99, 0x96, 0x03, 0x75, 0x68, 0x63, 0x00, 0xb8, 0x01,
+  0x00, 0x01, 0x01, 0x79, 0x00, 0x31, 0x6e, 0x01, 0x01, 0x08, 0x2d, 0x63,
+  0x69, 0x66, 0x66, 0x61, 0x72, 0x74, 0x01, 0x1c, 0x7c, 0x00, 0x02, 0x01,
+  0x6e, 0x00, 0x5d, 0xbc, 0x01, 0x74, 0x01, 0x1c, 0x83, 0x01, 0x01, 0x02,
+  0x67, 0x6e, 0x00, 0xf9, 0x98, 0x00, 0x05, 0x01, 0x64, 0x00, 0x3c, 0xee,
+  0x01, 0x65, 0x00, 0x99, 0x87, 0x01, 0x6b, 0x00, 0x91, 0xa1, 0x02, 0x6e,
+  0x69, 0x00, 0x3c, 0xee, 0x02, 0x74, 0x72, 0x00, 0xec, 0x91, 0x00, 0x02,
+  0x01, 0x68, 0x00, 0x4a, 0x79, 0x03, 0x74, 0x61, 0x63, 0x00, 0xdf, 0xc9,
+  0x00, 0x02, 0x01, 0x63, 0x00, 0xc9, 0x03, 0x01, 0x72, 0x00, 0x0e, 0x15,
+  0x01, 0x01, 0x01, 0x78, 0x00, 0x1d, 0x34, 0x00, 0x02, 0x01, 0x69, 0x00,
+  0x26, 0xd7, 0x02, 0x6f, 0x74, 0x00, 0x83, 0x0e, 0x00, 0x02, 0x01, 0x66,
+  0x00, 0x0e, 0x15, 0x01, 0x6f, 0x00, 0x50, 0x4a, 0x00, 0x02, 0x02, 0x61,
+  0x74, 0x00, 0xc3, 0xf7, 0x01, 0x65, 0x01, 0x1c, 0x99, 0x00, 0x02, 0x01,
+  0x6c, 0x00, 0xda, 0x86, 0x01, 0x74, 0x01, 0x1c, 0xa5, 0x00, 0x06, 0x01,
+  0x61, 0x01, 0x1c, 0xae, 0x01, 0x65, 0x01, 0x1c, 0xde, 0x01, 0x69, 0x01,
+  0x1c, 0xea, 0x04, 0x6e, 0x61, 0x6e, 0x6f, 0x01, 0x1d, 0x18, 0x01, 0x6f,
+  0x01, 0x1d, 0x24, 0x01, 0x75, 0x01, 0x1d, 0x5a, 0x00, 0x05, 0x01, 0x61,
+  0x01, 0x1d, 0x70, 0x01, 0x65, 0x01, 0x1d, 0x86, 0x01, 0x69, 0x01, 0x1d,
+  0x95, 0x03, 0x6e, 0x65, 0x7a, 0x00, 0x7f, 0xc0, 0x01, 0x75, 0x01, 0x1d,
+  0xbb, 0x00, 0x07, 0x01, 0x61, 0x01, 0x1d, 0xc7, 0x01, 0x65, 0x01, 0x1d,
+  0xe2, 0x02, 0x68, 0x6f, 0x00, 0x22, 0xd6, 0x01, 0x69, 0x01, 0x1d, 0xf2,
+  0x02, 0x6e, 0x61, 0x01, 0x1e, 0x0b, 0x01, 0x6f, 0x01, 0x1e, 0x1c, 0x02,
+  0x75, 0x73, 0x01, 0x1e, 0x2e, 0x00, 0x07, 0x01, 0x61, 0x01, 0x1e, 0x3a,
+  0x01, 0x65, 0x01, 0x1e, 0x5c, 0x01, 0x68, 0x01, 0x1e, 0x6e, 0x01, 0x69,
+  0x01, 0x1e, 0x75, 0x03, 0x6e, 0x61, 0x6e, 0x01, 0x1e, 0x90, 0x01, 0x6f,
+  0x01, 0x1e, 0x9c, 0x03, 0x75, 0x73, 0x74, 0x01, 0x1e, 0xb2, 0x01, 0x01,
+  0x01, 0x2e, 0x01, 0x1e, 0xbe, 0x01, 0x01, 0x01, 0x2e, 0x01, 0x1e, 0xdf,
+  0x01, 0x01, 0x01, 0x2e, 0x01, 0x1e, 0xfd, 0x00, 0x02, 0x02, 0x61, 0x6b,
+  0x01, 0x1f, 0x1f, 0x02, 0x6f, 0x74, 0x01, 0x1f, 0x2c, 0x00, 0x02, 0x03,
+  0x67, 0x61, 0x6b, 0x01, 0x1f, 0x33, 0x03, 0x72, 0x69, 0x68, 0x01, 0x1f,
+  0x3a, 0x00, 0x02, 0x02, 0x6f, 0x74, 0x01, 0x1f, 0x41, 0x02, 0x75, 0x66,
+  0x01, 0x1f, 0x48, 0x00, 0x04, 0x01, 0x61, 0x01, 0x1f, 0x4f, 0x01, 0x69,
+  0x01, 0x1f, 0x7a, 0x01, 0x6f, 0x01, 0x1f, 0x9d, 0x01, 0x75, 0x01, 0x1f,
+  0xaf, 0x00, 0x04, 0x01, 0x61, 0x01, 0x1f, 0xc4, 0x01, 0x65, 0x01, 0x1f,
+  0xe9, 0x01, 0x69, 0x01, 0x20, 0x00, 0x01, 0x6f, 0x01, 0x20, 0x2c, 0x01,
+  0x01, 0x01, 0x2e, 0x01, 0x20, 0x57, 0x01, 0x01, 0x01, 0x2e, 0x01, 0x20,
+  0x73, 0x00, 0x02, 0x01, 0x61, 0x01, 0x20, 0x93, 0x01, 0x69, 0x00, 0x0f,
+  0x6f, 0x01, 0x01, 0x01, 0x2e, 0x01, 0x20, 0x9a, 0x01, 0x01, 0x01, 0x2e,
+  0x01, 0x20, 0xb7, 0x01, 0x01, 0x01, 0x2e, 0x01, 0x20, 0xd5, 0x00, 0x05,
+  0x01, 0x61, 0x01, 0x20, 0xeb, 0x01, 0x69, 0x01, 0x21, 0x0f, 0x03, 0x6e,
+  0x61, 0x73, 0x01, 0x21, 0x29, 0x01, 0x6f, 0x01, 0x21, 0x30, 0x01, 0x75,
+  0x01, 0x21, 0x3e, 0x00, 0x06, 0x01, 0x61, 0x01, 0x21, 0x4f, 0x01, 0x65,
+  0x01, 0x21, 0x78, 0x01, 0x69, 0x01, 0x21, 0x86, 0x01, 0x6e, 0x01, 0x21,
+  0xa4, 0x01, 0x6f, 0x01, 0x21, 0xb0, 0x01, 0x75, 0x01, 0x21, 0xc4, 0x00,
+  0x05, 0x01, 0x61, 0x01, 0x21, 0xdb, 0x01, 0x65, 0x01, 0x21, 0xf9, 0x01,
+  0x69, 0x01, 0x22, 0x0b, 0x01, 0x6f, 0x01, 0x22, 0x2b, 0x01, 0x75, 0x00,
+  0x84, 0x96, 0x00, 0x02, 0x01, 0x6d, 0x01, 0x22, 0x3c, 0x04, 0x74, 0x61,
+  0x6b, 0x69, 0x01, 0x22, 0x49, 0x00, 0x01, 0x01, 0x62, 0x00, 0x46, 0x7c,
+  0x00, 0x03, 0x01, 0x61, 0x00, 0xe7, 0x27, 0x02, 0x6b, 0x61, 0x00, 0x39,
+  0x91, 0x03, 0x72, 0x61, 0x62, 0x00, 0x4f, 0xdc, 0x00, 0x03, 0x02, 0x61,
+  0x6e, 0x00, 0x62, 0x9c, 0x04, 0x65, 0x67, 0x6f, 0x6b, 0x01, 0x22, 0x50,
+  0x01, 0x6f, 0x00, 0x46, 0x7c, 0x00, 0x05, 0x01, 0x6a, 0x01, 0x02, 0x04,
+  0x01, 0x6b, 0x01, 0x22, 0x57, 0x01, 0x6e, 0x01, 0x22, 0x60, 0x06, 0x75,
+  0x68, 0x63, 0x75, 0x6b, 0x6f, 0x00, 0x0c, 0x43, 0x02, 0x79, 0x69, 0x01,
+  0x22, 0x67, 0x00, 0x02, 0x03, 0x6b, 0x6f, 0x68, 0x00, 0x16, 0x89, 0x01,
+  0x7a, 0x00, 0x41, 0x08, 0x00, 0x06, 0x01, 0x61, 0x01, 0x22, 0x6e, 0x01,
+  0x65, 0x01, 0x22, 0x84, 0x01, 0x69, 0x01, 0x22, 0x90, 0x03, 0x6e, 0x61,
+  0x6e, 0x00, 0x70, 0xbd, 0x01, 0x6f, 0x01, 0x22, 0xa5, 0x01, 0x75, 0x01,
+  0x22, 0xb9, 0x00, 0x05, 0x01, 0x61, 0x01, 0x22, 0xc5, 0x01, 0x65, 0x01,
+  0x22, 0xe2, 0x01, 0x69, 0x01, 0x22, 0xf0, 0x01, 0x6f, 0x01, 0x23, 0x0b,
+  0x01, 0x75, 0x01, 0x23, 0x20, 0x00, 0x05, 0x01, 0x61, 0x01, 0x23, 0x27,
+  0x01, 0x65, 0x01, 0x23, 0x49, 0x01, 0x69, 0x01, 0x23, 0x56, 0x01, 0x6f,
+  0x01, 0x23, 0x6e, 0x01, 0x75, 0x01, 0x23, 0x81, 0x00, 0x05, 0x01, 0x61,
+  0x01, 0x23, 0x8d, 0x01, 0x65, 0x01, 0x23, 0xb3, 0x01, 0x69, 0x01, 0x23,
+  0xc7, 0x01, 0x6f, 0x01, 0x23, 0xd3, 0x01, 0x75, 0x01, 0x23, 0xe9, 0x01,
+  0x01, 0x01, 0x2e, 0x01, 0x23, 0xf5, 0x01, 0x01, 0x01, 0x2e, 0x01, 0x24,
+  0x15, 0x01, 0x01, 0x01, 0x2e, 0x01, 0x24, 0x2b, 0x01, 0x01, 0x01, 0x2e,
+  0x01, 0x24, 0x4e, 0x00, 0x01, 0x01, 0x62, 0x00, 0x56, 0x74, 0x00, 0x05,
+  0x01, 0x61, 0x01, 0x24, 0x74, 0x01, 0x65, 0x01, 0x24, 0xa6, 0x01, 0x69,
+  0x01, 0x24, 0xbf, 0x01, 0x6f, 0x01, 0x24, 0xe9, 0x01, 0x75, 0x01, 0x25,
+  0x16, 0x01, 0x01, 0x01, 0x2e, 0x01, 0x25, 0x28, 0x00, 0x06, 0x01, 0x61,
+  0x01, 0x25, 0x47, 0x01, 0x65, 0x01, 0x25, 0x77, 0x01, 0x69, 0x01, 0x25,
+  0x86, 0x01, 0x6e, 0x01, 0x25, 0x9e, 0x01, 0x6f, 0x01, 0x25, 0xa9, 0x02,
+  0x75, 0x72, 0x01, 0x25, 0xba, 0x00, 0x05, 0x01, 0x61, 0x01, 0x25, 0xc2,
+  0x01, 0x65, 0x01, 0x25, 0xd4, 0x01, 0x69, 0x01, 0x25, 0xe4, 0x01, 0x6f,
+  0x01, 0x26, 0x1b, 0x01, 0x75, 0x01, 0x26, 0x27, 0x00, 0x06, 0x01, 0x61,
+  0x01, 0x26, 0x35, 0x01, 0x65, 0x01, 0x26, 0x42, 0x05, 0x69, 0x72, 0x6f,
+  0x74, 0x74, 0x00, 0x46, 0x7c, 0x01, 0x6e, 0x01, 0x25, 0x9e, 0x01, 0x6f,
+  0x01, 0x26, 0x49, 0x01, 0x75, 0x01, 0x26, 0x60, 0x00, 0x04, 0x01, 0x64,
+  0x01, 0x26, 0x6c, 0x01, 0x67, 0x01, 0x26, 0x73, 0x02, 0x6d, 0x61, 0x01,
+  0x26, 0x7b, 0x02, 0x73, 0x61, 0x01, 0x26, 0x8c, 0x00, 0x04, 0x01, 0x61,
+  0x01, 0x26, 0x93, 0x01, 0x68, 0x00, 0x41, 0x08, 0x04, 0x6a, 0x69, 0x65,
+  0x68, 0x00, 0xe4, 0x92, 0x01, 0x75, 0x01, 0x26, 0x9a, 0x01, 0x01, 0x01,
+  0x69, 0x01, 0x26, 0xa1, 0x00, 0x0a, 0x01, 0x64, 0x01, 0x26, 0x6c, 0x05,
+  0x67, 0x61, 0x6b, 0x69, 0x68, 0x00, 0x96, 0xe7, 0x03, 0x68, 0x63, 0x65,
+  0x01, 0x26, 0xa8, 0x01, 0x6b, 0x01, 0x26, 0xaf, 0x01, 0x6d, 0x01, 0x26,
+  0xbb, 0x01, 0x72, 0x01, 0x26, 0xda, 0x03, 0x73, 0x61, 0x6b, 0x00, 0x39,
+  0x28, 0x02, 0x74, 0x61, 0x01, 0x26, 0xed, 0x01, 0x77, 0x01, 0x26, 0xf9,
+  0x01, 0x79, 0x00, 0x46, 0x7c, 0x00, 0x09, 0x01, 0x61, 0x01, 0x27, 0x0a,
+  0x01, 0x62, 0x01, 0x27, 0x16, 0x01, 0x69, 0x00, 0x29, 0x66, 0x01, 0x6b,
+  0x01, 0x27, 0x22, 0x03, 0x6e, 0x61, 0x6b, 0x00, 0x4f, 0xdc, 0x05, 0x70,
+  0x70, 0x6f, 0x6b, 0x6f, 0x01, 0x27, 0x2f, 0x03, 0x73, 0x6f, 0x74, 0x00,
+  0x37, 0xb3, 0x03, 0x74, 0x61, 0x64, 0x01, 0x27, 0x36, 0x04, 0x75, 0x6f,
+  0x6e, 0x69, 0x01, 0x27, 0x3d, 0x00, 0x08, 0x01, 0x61, 0x01, 0x27, 0x44,
+  0x01, 0x65, 0x00, 0x5f, 0x90, 0x01, 0x68, 0x01, 0x27, 0x58, 0x07, 0x6a,
+  0x75, 0x66, 0x69, 0x72, 0x69, 0x68, 0x00, 0xb3, 0xf1, 0x01, 0x6b, 0x01,
+  0x27, 0x64, 0x01, 0x6d, 0x01, 0x27, 0x70, 0x02, 0x6f, 0x61, 0x01, 0x27,
+  0x7c, 0x01, 0x72, 0x01, 0x27, 0x88, 0x00, 0x02, 0x01, 0x61, 0x01, 0x27,
+  0x9d, 0x02, 0x75, 0x62, 0x00, 0x29, 0xdf, 0x00, 0x06, 0x02, 0x6b, 0x61,
+  0x00, 0x28, 0xdc, 0x01, 0x6d, 0x01, 0x27, 0xb7, 0x05, 0x6e, 0x61, 0x72,
+  0x75, 0x66, 0x01, 0x27, 0xc3, 0x01, 0x6f, 0x01, 0x27, 0xcc, 0x01, 0x72,
+  0x01, 0x27, 0xd3, 0x01, 0x74, 0x01, 0x27, 0xe6, 0x00, 0x08, 0x01, 0x62,
+  0x01, 0x27, 0xf8, 0x03, 0x6b, 0x6f, 0x74, 0x01, 0x27, 0xff, 0x01, 0x6d,
+  0x01, 0x28, 0x06, 0x02, 0x70, 0x70, 0x01, 0x28, 0x13, 0x01, 0x72, 0x01,
+  0x28, 0x26, 0x01, 0x73, 0x01, 0x28, 0x2d, 0x03, 0x79, 0x72, 0x75, 0x01,
+  0x28, 0x3e, 0x06, 0x7a, 0x69, 0x6d, 0x69, 0x68, 0x73, 0x01, 0x28, 0x45,
+  0x00, 0x05, 0x01, 0x61, 0x01, 0x28, 0x4c, 0x01, 0x69, 0x01, 0x28, 0x73,
+  0x01, 0x6e, 0x01, 0x28, 0x9b, 0x01, 0x6f, 0x01, 0x28, 0xab, 0x01, 0x75,
+  0x01, 0x28, 0xd5, 0x00, 0x0a, 0x01, 0x62, 0x01, 0x21, 0x29, 0x01, 0x64,
+  0x01, 0x28, 0xe1, 0x01, 0x6b, 0x01, 0x28, 0xf2, 0x01, 0x6d, 0x01, 0x29,
+  0x05, 0x01, 0x6e, 0x01, 0x29, 0x17, 0x01, 0x72, 0x01, 0x29, 0x23, 0x01,
+  0x73, 0x00, 0x16, 0x33, 0x01, 0x74, 0x01, 0x29, 0x2f, 0x01, 0x77, 0x01,
+  0x29, 0x3c, 0x02, 0x79, 0x61, 0x01, 0x29, 0x50, 0x00, 0x03, 0x01, 0x61,
+  0x01, 0x26, 0x93, 0x03, 0x6e, 0x61, 0x67, 0x01, 0x29, 0x5c, 0x02, 0x73,
+  0x75, 0x00, 0x83, 0x6a, 0x00, 0x05, 0x01, 0x67, 0x01, 0x29, 0x63, 0x01,
+  0x68, 0x01, 0x29, 0x6a, 0x01, 0x6b, 0x01, 0x29, 0x7d, 0x01, 0x6d, 0x01,
+  0x29, 0x97, 0x01, 0x72, 0x01, 0x29, 0xa8, 0x00, 0x02, 0x01, 0x61, 0x00,
+  0x71, 0x52, 0x08, 0x65, 0x73, 0x6e, 0x6f, 0x61, 0x77, 0x61, 0x7a, 0x00,
+  0x56, 0x74, 0x00, 0x05, 0x01, 0x68, 0x01, 0x29, 0xba, 0x01, 0x6e, 0x01,
+  0x29, 0xc1, 0x02, 0x72, 0x6f, 0x00, 0x90, 0x5b, 0x02, 0x73, 0x69, 0x01,
+  0x29, 0xd2, 0x01, 0x74, 0x01, 0x29, 0xde, 0x00, 0x02, 0x01, 0x6b, 0x01,
+  0x29, 0xe6, 0x04, 0x73, 0x74, 0x61, 0x6d, 0x00, 0x58, 0xa8, 0x00, 0x05,
+  0x01, 0x61, 0x01, 0x29, 0xf3, 0x04, 0x65, 0x6e, 0x75, 0x66, 0x00, 0x39,
+  0x28, 0x01, 0x69, 0x01, 0x2a, 0x11, 0x01, 0x6f, 0x01, 0x2a, 0x2d, 0x01,
+  0x75, 0x01, 0x2a, 0x4b, 0x00, 0x06, 0x01, 0x61, 0x01, 0x2a, 0x57, 0x01,
+  0x65, 0x01, 0x2a, 0x82, 0x01, 0x69, 0x01, 0x2a, 0x94, 0x02, 0x6e, 0x61,
+  0x01, 0x2a, 0xaa, 0x01, 0x6f, 0x01, 0x2a, 0xb1, 0x01, 0x75, 0x01, 0x2a,
+  0xd4, 0x00, 0x08, 0x01, 0x64, 0x01, 0x2a, 0xe2, 0x01, 0x6b, 0x01, 0x2a,
+  0xee, 0x01, 0x6d, 0x01, 0x2a, 0xfc, 0x01, 0x72, 0x01, 0x2b, 0x08, 0x02,
+  0x73, 0x73, 0x00, 0x6d, 0x8e, 0x01, 0x74, 0x01, 0x2b, 0x1b, 0x02, 0x77,
+  0x61, 0x01, 0x2b, 0x27, 0x01, 0x79, 0x01, 0x2b, 0x33, 0x00, 0x04, 0x01,
+  0x61, 0x00, 0x90, 0x5b, 0x01, 0x64, 0x01, 0x2b, 0x41, 0x01, 0x6d, 0x01,
+  0x2b, 0x49, 0x01, 0x73, 0x01, 0x2b, 0x57, 0x00, 0x05, 0x03, 0x65, 0x6e,
+  0x61, 0x01, 0x26, 0x42, 0x01, 0x67, 0x01, 0x2b, 0x5e, 0x01, 0x68, 0x01,
+  0x2b, 0x65, 0x01, 0x6a, 0x01, 0x2b, 0x74, 0x04, 0x6d, 0x61, 0x6e, 0x69,
+  0x01, 0x2b, 0x83, 0x00, 0x07, 0x01, 0x68, 0x01, 0x2b, 0x8a, 0x01, 0x6a,
+  0x01, 0x2b, 0x91, 0x01, 0x6e, 0x01, 0x2b, 0x9a, 0x03, 0x72, 0x75, 0x67,
+  0x00, 0x5d, 0xb5, 0x01, 0x74, 0x01, 0x2b, 0xae, 0x01, 0x75, 0x00, 0x46,
+  0x83, 0x02, 0x79, 0x6b, 0x01, 0x2b, 0xbf, 0x00, 0x03, 0x01, 0x66, 0x01,
+  0x0e, 0xf9, 0x01, 0x68, 0x01, 0x2b, 0xc6, 0x03, 0x6b, 0x75, 0x6a, 0x01,
+  0x27, 0xff, 0x00, 0x01, 0x01, 0x61, 0x01, 0x2b, 0xcd, 0x00, 0x01, 0x01,
+  0x6f, 0x00, 0x46, 0x83, 0x00, 0x07, 0x01, 0x64, 0x01, 0x2b, 0xd4, 0x02,
+  0x6b, 0x69, 0x01, 0x2b, 0xe0, 0x01, 0x6d, 0x01, 0x2b, 0xe7, 0x01, 0x6e,
+  0x00, 0x1d, 0x34, 0x04, 0x72, 0x61, 0x68, 0x61, 0x01, 0x2b, 0xf3, 0x04,
+  0x74, 0x61, 0x67, 0x61, 0x01, 0x2c, 0x00, 0x02, 0x77, 0x61, 0x01, 0x2c,
+  0x0c, 0x00, 0x02, 0x01, 0x6b, 0x01, 0x2c, 0x1d, 0x01, 0x75, 0x01, 0x0e,
+  0xf2, 0x00, 0x06, 0x03, 0x67, 0x6f, 0x68, 0x01, 0x2c, 0x24, 0x02, 0x68,
+  0x63, 0x01, 0x2c, 0x2b, 0x01, 0x6b, 0x01, 0x2c, 0x39, 0x01, 0x6d, 0x01,
+  0x2c, 0x4a, 0x01, 0x6e, 0x00, 0x68, 0x09, 0x01, 0x75, 0x00, 0x50, 0x30,
+  0x00, 0x01, 0x01, 0x6e, 0x00, 0x4c, 0x3f, 0x00, 0x06, 0x01, 0x64, 0x00,
+  0x58, 0xaf, 0x01, 0x6a, 0x00, 0x38, 0x2f, 0x03, 0x6d, 0x61, 0x6b, 0x01,
+  0x1e, 0x6e, 0x01, 0x6e, 0x00, 0x39, 0x28, 0x01, 0x72, 0x00, 0x62, 0x3b,
+  0x04, 0x73, 0x69, 0x68, 0x63, 0x00, 0x7f, 0xc0, 0x00, 0x02, 0x01, 0x66,
+  0x00, 0x4c, 0x3f, 0x01, 0x73, 0x01, 0x2c, 0x57, 0x00, 0x01, 0x01, 0x61,
+  0x00, 0x1d, 0x34, 0x00, 0x01, 0x01, 0x72, 0x00, 0x48, 0x25, 0x00, 0x03,
+  0x14, 0x64, 0x75, 0x6f, 0x6c, 0x63, 0x6c, 0x61, 0x75, 0x74, 0x72, 0x69,
+  0x76, 0x2e, 0x65, 0x6c, 0x61, 0x63, 0x73, 0x2e, 0x73, 0x00, 0xb8, 0xe1,
+  0x01, 0x65, 0x00, 0x83, 0xdf, 0x01, 0x74, 0x00, 0x61, 0x1a, 0x00, 0x03,
+  0x01, 0x62, 0x00, 0x0e, 0x15, 0x01, 0x6d, 0x00, 0x0e, 0x15, 0x01, 0x70,
+  0x00, 0x0e, 0x15, 0x00, 0x03, 0x01, 0x63, 0x00, 0x0e, 0x15, 0x01, 0x70,
+  0x00, 0x0e, 0x15, 0x01, 0x73, 0x00, 0x0e, 0x15, 0x00, 0x03, 0x01, 0x67,
+  0x00, 0x0e, 0x15, 0x01, 0x72, 0x00, 0x0e, 0x15, 0x01, 0x74, 0x00, 0x0e,
+  0x15, 0x00, 0x02, 0x01, 0x70, 0x00, 0x0e, 0x15, 0x01, 0x72, 0x00, 0x0e,
+  0x15, 0x00, 0x03, 0x01, 0x65, 0x00, 0x0e, 0x15, 0x01, 0x6d, 0x00, 0x0e,
+  0x15, 0x01, 0x72, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x72, 0x00, 0x37,
+  0xb3, 0x00, 0x01, 0x01, 0x62, 0x00, 0xed, 0x43, 0x01, 0x01, 0x01, 0x2e,
+  0x01, 0x2c, 0x63, 0x00, 0x01, 0x01, 0x75, 0x00, 0x26, 0xc4, 0x00, 0x02,
+  0x01, 0x63, 0x00, 0x0e, 0x15, 0x01, 0x65, 0x00, 0x16, 0x7b, 0x00, 0x02,
+  0x01, 0x65, 0x00, 0x0c, 0x1d, 0x01, 0x6f, 0x01, 0x10, 0x4a, 0x00, 0x01,
+  0x01, 0x74, 0x01, 0x0f, 0x94, 0x00, 0x01, 0x02, 0x6f, 0x69, 0x01, 0x10,
+  0x7b, 0x00, 0x04, 0x01, 0x67, 0x00, 0x27, 0x0f, 0x01, 0x6e, 0x00, 0x46,
+  0x75, 0x01, 0x72, 0x00, 0x16, 0x9c, 0x01, 0x79, 0x00, 0x0f, 0x6f, 0x00,
+  0x02, 0x01, 0x6e, 0x00, 0x46, 0x75, 0x01, 0x79, 0x00, 0x0f, 0x6f, 0x00,
+  0x01, 0x03, 0x65, 0x62, 0x6f, 0x00, 0x51, 0x29, 0x00, 0x02, 0x07, 0x64,
+  0x69, 0x2d, 0x65, 0x74, 0x73, 0x65, 0x00, 0xe6, 0x7d, 0x01, 0x69, 0x00,
+  0xf3, 0xf6, 0x01, 0x01, 0x02, 0x2e, 0x65, 0x01, 0x2c, 0x77, 0x00, 0x01,
+  0x07, 0x6f, 0x66, 0x65, 0x6c, 0x61, 0x63, 0x73, 0x01, 0x14, 0xfd, 0x00,
+  0x02, 0x05, 0x6c, 0x69, 0x61, 0x74, 0x2e, 0x00, 0xd6, 0x08, 0x02, 0x6e,
+  0x6f, 0x00, 0x64, 0xb6, 0x00, 0x01, 0x02, 0x65, 0x72, 0x01, 0x2c, 0x85,
+  0x00, 0x01, 0x01, 0x61, 0x00, 0x75, 0x7e, 0x00, 0x01, 0x01, 0x65, 0x01,
+  0x2c, 0x8c, 0x00, 0x05, 0x01, 0x64, 0x01, 0x2c, 0x93, 0x01, 0x65, 0x01,
+  0x2c, 0xa0, 0x01, 0x69, 0x00, 0xbe, 0x90, 0x03, 0x6e, 0x69, 0x67, 0x01,
+  0x11, 0x11, 0x02, 0x79, 0x65, 0x00, 0xf0, 0x1d, 0x00, 0x01, 0x01, 0x6f,
+  0x00, 0xf8, 0xbb, 0x00, 0x02, 0x01, 0x61, 0x00, 0xf9, 0x9f, 0x01, 0x6c,
+  0x00, 0x6c, 0xa5, 0x00, 0x02, 0x01, 0x62, 0x00, 0x28, 0xd5, 0x03, 0x6c,
+  0x6c, 0x65, 0x00, 0x94, 0x07, 0x00, 0x01, 0x03, 0x69, 0x72, 0x6f, 0x00,
+  0xed, 0xa6, 0x00, 0x02, 0x03, 0x65, 0x74, 0x73, 0x00, 0x39, 0x74, 0x01,
+  0x6f, 0x00, 0x0f, 0x6f, 0x00, 0x02, 0x01, 0x62, 0x00, 0x43, 0xb8, 0x01,
+  0x73, 0x00, 0xc6, 0xe4, 0x00, 0x02, 0x05, 0x69, 0x73, 0x62, 0x65, 0x77,
+  0x01, 0x10, 0xbc, 0x01, 0x79, 0x00, 0x27, 0x0f, 0x00, 0x01, 0x02, 0x6f,
+  0x6b, 0x00, 0x85, 0xcc, 0x00, 0x05, 0x01, 0x2d, 0x00, 0x5c, 0x21, 0x01,
+  0x61, 0x00, 0xb2, 0xfd, 0x01, 0x64, 0x00, 0x0e, 0x15, 0x01, 0x67, 0x00,
+  0x35, 0xb8, 0x01, 0x6e, 0x00, 0x7b, 0xff, 0x00, 0x05, 0x01, 0x31, 0x00,
+  0x0e, 0x15, 0x01, 0x32, 0x01, 0x2c, 0xb0, 0x03, 0x61, 0x69, 0x73, 0x01,
+  0x17, 0xa2, 0x06, 0x65, 0x70, 0x6f, 0x72, 0x75, 0x65, 0x01, 0x00, 0xad,
+  0x07, 0x73, 0x75, 0x6c, 0x61, 0x72, 0x74, 0x6e, 0x00, 0x83, 0x3b, 0x00,
+  0x02, 0x01, 0x2d, 0x01, 0x2c, 0xba, 0x01, 0x64, 0x00, 0x99, 0xa9, 0x01,
+  0x01, 0x01, 0x2e, 0x00, 0xc7, 0xf1, 0x00, 0x01, 0x01, 0x66, 0x01, 0x14,
+  0xe1, 0x00, 0x03, 0x01, 0x65, 0x00, 0x2c, 0x17, 0x01, 0x6c, 0x00, 0xc9,
+  0x11, 0x01, 0x74, 0x00, 0x64, 0x65, 0x00, 0x02, 0x04, 0x2d, 0x73, 0x70,
+  0x76, 0x01, 0x2c, 0xc2, 0x01, 0x67, 0x00, 0x30, 0x48, 0x00, 0x01, 0x06,
+  0x6f, 0x74, 0x73, 0x2d, 0x73, 0x6c, 0x00, 0x16, 0xb8, 0x00, 0x02, 0x04,
+  0x65, 0x64, 0x2d, 0x31, 0x00, 0x93, 0x54, 0x04, 0x73, 0x75, 0x2d, 0x31,
+  0x01, 0x00, 0xad, 0x00, 0x02, 0x01, 0x61, 0x00, 0x0e, 0x15, 0x01, 0x6c,
+  0x01, 0x2c, 0xd2, 0x00, 0x03, 0x01, 0x61, 0x00, 0x0e, 0x15, 0x01, 0x62,
+  0x00, 0x0e, 0x15, 0x01, 0x6c, 0x01, 0x2c, 0xd2, 0x00, 0x01, 0x01, 0x69,
+  0x01, 0x14, 0x5a, 0x00, 0x02, 0x01, 0x63, 0x00, 0x85, 0x44, 0x02, 0x6d,
+  0x65, 0x01, 0x2c, 0xda, 0x00, 0x04, 0x01, 0x2d, 0x01, 0x2c, 0xe6, 0x01,
+  0x61, 0x01, 0x2c, 0xf7, 0x01, 0x65, 0x01, 0x2d, 0x02, 0x01, 0x76, 0x01,
+  0x2d, 0x09, 0x00, 0x04, 0x01, 0x62, 0x00, 0x72, 0x66, 0x01, 0x63, 0x00,
+  0x12, 0xe2, 0x01, 0x70, 0x00, 0x28, 0x6d, 0x01, 0x74, 0x00, 0x42, 0x43,
+  0x00, 0x01, 0x01, 0x64, 0x00, 0xe4, 0xad, 0x00, 0x02, 0x02, 0x2d, 0x73,
+  0x01, 0x2d, 0x16, 0x01, 0x73, 0x01, 0x2d, 0x16, 0x00, 0x02, 0x04, 0x61,
+  0x6c, 0x61, 0x63, 0x01, 0x2d, 0x22, 0x01, 0x6d, 0x00, 0x5d, 0xbc, 0x00,
+  0x04, 0x01, 0x2d, 0x01, 0x2d, 0x2e, 0x08, 0x61, 0x74, 0x74, 0x65, 0x6c,
+  0x72, 0x61, 0x62, 0x01, 0x2d, 0x46, 0x05, 0x69, 0x6e, 0x61, 0x72, 0x74,
+  0x01, 0x2d, 0x4d, 0x03, 0x73, 0x73, 0x65, 0x00, 0x26, 0x53, 0x00, 0x01,
+  0x01, 0x70, 0x00, 0x72, 0x4d, 0x00, 0x01, 0x01, 0x62, 0x00, 0x4b, 0xdd,
+  0x00, 0x02, 0x01, 0x6e, 0x00, 0x4b, 0x25, 0x02, 0x70, 0x73, 0x01, 0x2d,
+  0x58, 0x00, 0x02, 0x02, 0x2d, 0x69, 0x01, 0x2d, 0x64, 0x01, 0x69, 0x01,
+  0x2d, 0x64, 0x00, 0x02, 0x02, 0x2d, 0x61, 0x01, 0x2d, 0x6b, 0x01, 0x61,
+  0x01, 0x2d, 0x6b, 0x00, 0x01, 0x01, 0x73, 0x00, 0x69, 0x7a, 0x00, 0x02,
+  0x02, 0x61, 0x63, 0x01, 0x2d, 0x74, 0x01, 0x65, 0x00, 0x16, 0x9c, 0x00,
+  0x01, 0x02, 0x72, 0x61, 0x01, 0x01, 0x7a, 0x00, 0x02, 0x01, 0x64, 0x01,
+  0x12, 0xe7, 0x01, 0x65, 0x01, 0x12, 0xf8, 0x00, 0x03, 0x01, 0x2d, 0x01,
+  0x2d, 0x81, 0x01, 0x65, 0x01, 0x12, 0xf8, 0x01, 0x6c, 0x00, 0x94, 0xe0,
+  0x00, 0x01, 0x01, 0x6c, 0x01, 0x1a, 0x60, 0x00, 0x03, 0x01, 0x2d, 0x01,
+  0x2d, 0x8d, 0x06, 0x61, 0x69, 0x72, 0x64, 0x6e, 0x61, 0x01, 0x2d, 0x46,
+  0x05, 0x69, 0x6e, 0x61, 0x72, 0x74, 0x01, 0x2d, 0xa2, 0x00, 0x02, 0x07,
+  0x6c, 0x6c, 0x65, 0x64, 0x2d, 0x65, 0x2d, 0x01, 0x13, 0x3b, 0x01, 0x7a,
+  0x00, 0x6b, 0x45, 0x00, 0x02, 0x05, 0x6c, 0x6c, 0x65, 0x64, 0x65, 0x01,
+  0x13, 0x3b, 0x01, 0x7a, 0x00, 0x6b, 0x45, 0x00, 0x01, 0x02, 0x61, 0x7a,
+  0x00, 0x6b, 0x45, 0x00, 0x02, 0x01, 0x61, 0x00, 0x29, 0xae, 0x01, 0x69,
+  0x00, 0x27, 0xf5, 0x00, 0x02, 0x01, 0x2d, 0x00, 0xf1, 0xf0, 0x01, 0x6f,
+  0x00, 0xf1, 0xf0, 0x00, 0x02, 0x01, 0x61, 0x01, 0x13, 0x6a, 0x04, 0x6f,
+  0x74, 0x6c, 0x61, 0x01, 0x2d, 0xaa, 0x00, 0x02, 0x01, 0x2d, 0x01, 0x2d,
+  0xb6, 0x01, 0x6f, 0x01, 0x2d, 0xbd, 0x01, 0x02, 0x03, 0x2d, 0x6f, 0x6e,
+  0x01, 0x2d, 0xc4, 0x01, 0x6f, 0x01, 0x2d, 0xbd, 0x00, 0x02, 0x02, 0x65,
+  0x64, 0x00, 0xdd, 0x1e, 0x02, 0x69, 0x73, 0x00, 0x83, 0x21, 0x01, 0x03,
+  0x01, 0x2d, 0x01, 0x2d, 0xd1, 0x01, 0x64, 0x01, 0x2d, 0xde, 0x01, 0x65,
+  0x01, 0x2d, 0xe5, 0x00, 0x01, 0x03, 0x6e, 0x65, 0x73, 0x00, 0x83, 0x3b,
+  0x00, 0x02, 0x09, 0x2d, 0x61, 0x74, 0x74, 0x65, 0x6c, 0x72, 0x61, 0x62,
+  0x01, 0x2d, 0xec, 0x08, 0x61, 0x74, 0x74, 0x65, 0x6c, 0x72, 0x61, 0x62,
+  0x01, 0x2d, 0xa2, 0x00, 0x02, 0x01, 0x64, 0x01, 0x2d, 0xf3, 0x01, 0x73,
+  0x01, 0x13, 0x6a, 0x00, 0x02, 0x03, 0x65, 0x75, 0x73, 0x01, 0x2e, 0x00,
+  0x02, 0x75, 0x73, 0x01, 0x2e, 0x11, 0x00, 0x02, 0x01, 0x61, 0x00, 0x15,
+  0x5e, 0x01, 0x75, 0x00, 0x15, 0x5e, 0x00, 0x01, 0x03, 0x6e, 0x61, 0x64,
+  0x00, 0xba, 0x43, 0x00, 0x01, 0x02, 0x69, 0x62, 0x00, 0x5a, 0x57, 0x00,
+  0x02, 0x02, 0x2d, 0x6f, 0x00, 0xc6, 0x2b, 0x01, 0x6f, 0x00, 0xc6, 0x2b,
+  0x00, 0x01, 0x03, 0x6c, 0x6f, 0x63, 0x00, 0x8d, 0xab, 0x00, 0x02, 0x02,
+  0x2d, 0x6f, 0x01, 0x2e, 0x22, 0x01, 0x6f, 0x01, 0x2e, 0x22, 0x00, 0x01,
+  0x01, 0x6e, 0x00, 0xf3, 0x43, 0x00, 0x02, 0x02, 0x2d, 0x6f, 0x01, 0x2e,
+  0x2a, 0x01, 0x6f, 0x01, 0x2e, 0x2a, 0x00, 0x03, 0x02, 0x67, 0x69, 0x00,
+  0x8e, 0x50, 0x01, 0x72, 0x00, 0x16, 0x7b, 0x02, 0x76, 0x65, 0x00, 0x58,
+  0xb6, 0x00, 0x01, 0x04, 0x69, 0x6e, 0x6f, 0x62, 0x00, 0x71, 0x59, 0x00,
+  0x01, 0x01, 0x6f, 0x00, 0x26, 0xd7, 0x00, 0x01, 0x01, 0x70, 0x00, 0x3a,
+  0xb0, 0x00, 0x01, 0x01, 0x70, 0x00, 0x35, 0x51, 0x00, 0x02, 0x01, 0x6d,
+  0x01, 0x2e, 0x33, 0x01, 0x79, 0x00, 0x97, 0x5e, 0x00, 0x02, 0x04, 0x62,
+  0x75, 0x79, 0x74, 0x00, 0xb2, 0xfd, 0x01, 0x6e, 0x00, 0x83, 0x6a, 0x00,
+  0x01, 0x01, 0x33, 0x00, 0x27, 0x0f, 0x00, 0x01, 0x01, 0x73, 0x00, 0x5d,
+  0x09, 0x00, 0x01, 0x01, 0x64, 0x00, 0x39, 0x74, 0x00, 0x01, 0x03, 0x79,
+  0x62, 0x62, 0x00, 0x32, 0x5a, 0x00, 0x02, 0x01, 0x2d, 0x00, 0x39, 0x21,
+  0x01, 0x73, 0x00, 0x2a, 0x10, 0x00, 0x01, 0x01, 0x61, 0x01, 0x16, 0x6c,
+  0x00, 0x01, 0x01, 0x73, 0x00, 0xcb, 0xa7, 0x00, 0x01, 0x01, 0x6c, 0x00,
+  0xcb, 0xa7, 0x00, 0x02, 0x01, 0x6e, 0x00, 0xaa, 0x23, 0x01, 0x73, 0x00,
+  0x9b, 0x5e, 0x00, 0x02, 0x01, 0x65, 0x00, 0x84, 0xe6, 0x01, 0x6f, 0x00,
+  0x0c, 0x1d, 0x00, 0x01, 0x01, 0x6f, 0x00, 0xd2, 0x61, 0x00, 0x01, 0x02,
+  0x6f, 0x64, 0x00, 0x69, 0x73, 0x00, 0x02, 0x01, 0x6f, 0x00, 0x1e, 0x60,
+  0x02, 0x73, 0x65, 0x00, 0x2c, 0x17, 0x01, 0x01, 0x01, 0x72, 0x00, 0x4c,
+  0x7f, 0x00, 0x01, 0x01, 0x2e, 0x00, 0x16, 0xb8, 0x00, 0x01, 0x01, 0x6c,
+  0x00, 0x70, 0xcb, 0x00, 0x03, 0x02, 0x68, 0x63, 0x01, 0x2e, 0x3a, 0x01,
+  0x6b, 0x00, 0x64, 0x6c, 0x01, 0x74, 0x00, 0x68, 0x09, 0x01, 0x01, 0x01,
+  0x77, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x6d, 0x00, 0x5d, 0xbc, 0x00,
+  0x01, 0x01, 0x69, 0x00, 0x41, 0x08, 0x01, 0x01, 0x01, 0x6f, 0x00, 0x0e,
+  0x15, 0x01, 0x01, 0x01, 0x70, 0x00, 0x5d, 0xbc, 0x01, 0x03, 0x01, 0x6d,
+  0x00, 0x35, 0x0c, 0x01, 0x70, 0x00, 0x35, 0x0c, 0x01, 0x77, 0x00, 0x35,
+  0x0c, 0x00, 0x02, 0x01, 0x6d, 0x00, 0x0e, 0x15, 0x01, 0x70, 0x00, 0x0e,
+  0x15, 0x00, 0x03, 0x01, 0x70, 0x00, 0x0e, 0x15, 0x01, 0x72, 0x00, 0x0c,
+  0x1d, 0x01, 0x77, 0x00, 0x0e, 0x15, 0x01, 0x01, 0x03, 0x69, 0x6d, 0x7a,
+  0x00, 0x35, 0x51, 0x00, 0x02, 0x01, 0x65, 0x00, 0x16, 0xb8, 0x01, 0x79,
+  0x00, 0x1d, 0x1c, 0x00, 0x02, 0x02, 0x61, 0x68, 0x00, 0x9b, 0x6e, 0x01,
+  0x76, 0x00, 0x28, 0xd5, 0x00, 0x02, 0x08, 0x2e, 0x72, 0x65, 0x64, 0x6c,
+  0x69, 0x75, 0x62, 0x01, 0x2e, 0x46, 0x01, 0x65, 0x01, 0x16, 0xc6, 0x00,
+  0x02, 0x03, 0x69, 0x6c, 0x2e, 0x01, 0x2e, 0x4d, 0x05, 0x6e, 0x65, 0x76,
+  0x65, 0x2e, 0x01, 0x2e, 0x65, 0x00, 0x01, 0x01, 0x74, 0x00, 0xcb, 0xa7,
+  0x00, 0x05, 0x01, 0x2d, 0x01, 0x14, 0x98, 0x02, 0x61, 0x6c, 0x00, 0x62,
+  0x3b, 0x01, 0x65, 0x00, 0xec, 0xa4, 0x02, 0x74, 0x69, 0x00, 0x85, 0xda,
+  0x01, 0x78, 0x00, 0x6d, 0x60, 0x00, 0x01, 0x01, 0x77, 0x00, 0x46, 0x7c,
+  0x00, 0x01, 0x01, 0x63, 0x00, 0x74, 0xe9, 0x00, 0x03, 0x03, 0x68, 0x74,
+  0x75, 0x01, 0x2e, 0x7b, 0x08, 0x6c, 0x61, 0x72, 0x74, 0x6e, 0x65, 0x63,
+  0x2d, 0x01, 0x2e, 0x83, 0x02, 0x74, 0x73, 0x01, 0x2e, 0x8f, 0x00, 0x02,
+  0x02, 0x61, 0x65, 0x01, 0x2e, 0x9e, 0x02, 0x65, 0x77, 0x01, 0x2e, 0xaa,
+  0x00, 0x02, 0x05, 0x61, 0x65, 0x68, 0x74, 0x72, 0x01, 0x2e, 0xb1, 0x03,
+  0x65, 0x77, 0x2d, 0x00, 0x62, 0x0c, 0x00, 0x02, 0x01, 0x68, 0x00, 0x9b,
+  0x6e, 0x01, 0x74, 0x00, 0x73, 0x35, 0x00, 0x01, 0x02, 0x2d, 0x74, 0x00,
+  0x61, 0xba, 0x00, 0x01, 0x01, 0x73, 0x00, 0x46, 0x75, 0x00, 0x02, 0x0d,
+  0x65, 0x72, 0x70, 0x2d, 0x79, 0x62, 0x2d, 0x64, 0x65, 0x74, 0x73, 0x6f,
+  0x68, 0x00, 0xdf, 0x78, 0x04, 0x6f, 0x72, 0x70, 0x6e, 0x00, 0x70, 0xc4,
+  0x00, 0x02, 0x01, 0x2e, 0x00, 0x9b, 0x75, 0x01, 0x6e, 0x00, 0x41, 0x08,
+  0x00, 0x01, 0x02, 0x6e, 0x65, 0x01, 0x2e, 0xb9, 0x00, 0x01, 0x01, 0x70,
+  0x00, 0xcb, 0xa7, 0x00, 0x02, 0x09, 0x72, 0x74, 0x6c, 0x61, 0x6e, 0x6f,
+  0x73, 0x72, 0x65, 0x01, 0x16, 0x6c, 0x04, 0x74, 0x72, 0x65, 0x74, 0x01,
+  0x16, 0x64, 0x00, 0x01, 0x01, 0x61, 0x01, 0x14, 0xbb, 0x00, 0x02, 0x03,
+  0x6b, 0x69, 0x2e, 0x01, 0x2e, 0xc1, 0x01, 0x73, 0x01, 0x2e, 0xd5, 0x00,
+  0x02, 0x01, 0x61, 0x01, 0x2e, 0xb9, 0x01, 0x6f, 0x00, 0xfd, 0x0a, 0x00,
+  0x02, 0x01, 0x64, 0x01, 0x2e, 0xe1, 0x04, 0x68, 0x63, 0x2d, 0x64, 0x01,
+  0x2e, 0xe1, 0x00, 0x02, 0x01, 0x69, 0x00, 0x85, 0x44, 0x01, 0x73, 0x00,
+  0x5c, 0x4f, 0x00, 0x01, 0x02, 0x6c, 0x67, 0x00, 0x48, 0x1e, 0x00, 0x02,
+  0x04, 0x6c, 0x6c, 0x69, 0x63, 0x00, 0x9b, 0x99, 0x01, 0x7a, 0x00, 0x9b,
+  0x99, 0x00, 0x02, 0x04, 0x67, 0x69, 0x74, 0x6e, 0x00, 0x39, 0x74, 0x01,
+  0x6d, 0x00, 0xc7, 0xff, 0x00, 0x01, 0x02, 0x65, 0x63, 0x00, 0x41, 0x08,
+  0x01, 0x01, 0x01, 0x6e, 0x01, 0x2e, 0xed, 0x00, 0x02, 0x05, 0x72, 0x6f,
+  0x6e, 0x2d, 0x75, 0x01, 0x2e, 0xfa, 0x04, 0x75, 0x6f, 0x73, 0x2d, 0x01,
+  0x2f, 0x01, 0x00, 0x02, 0x06, 0x6e, 0x72, 0x65, 0x74, 0x78, 0x65, 0x00,
+  0xf4, 0xbc, 0x06, 0x72, 0x74, 0x6e, 0x65, 0x63, 0x2d, 0x01, 0x2f, 0x18,
+  0x00, 0x02, 0x02, 0x61, 0x65, 0x01, 0x2f, 0x25, 0x03, 0x65, 0x77, 0x2d,
+  0x01, 0x2f, 0x32, 0x00, 0x02, 0x03, 0x2d, 0x73, 0x75, 0x01, 0x2f, 0x4a,
+  0x02, 0x68, 0x74, 0x01, 0x2f, 0x56, 0x00, 0x02, 0x01, 0x73, 0x01, 0x2f,
+  0x66, 0x01, 0x75, 0x01, 0x2f, 0x6d, 0x00, 0x02, 0x09, 0x61, 0x65, 0x68,
+  0x74, 0x72, 0x6f, 0x6e, 0x2d, 0x70, 0x01, 0x2f, 0x74, 0x04, 0x65, 0x77,
+  0x2d, 0x75, 0x01, 0x2f, 0x6d, 0x00, 0x01, 0x01, 0x61, 0x01, 0x2e, 0xb9,
+  0x00, 0x03, 0x01, 0x62, 0x00, 0x90, 0xfc, 0x01, 0x65, 0x01, 0x2f, 0x7b,
+  0x01, 0x70, 0x00, 0x26, 0xde, 0x00, 0x02, 0x01, 0x61, 0x00, 0xbd, 0x57,
+  0x01, 0x6e, 0x00, 0xf6, 0x07, 0x00, 0x02, 0x01, 0x32, 0x00, 0x5d, 0xbc,
+  0x07, 0x6c, 0x61, 0x63, 0x6f, 0x6c, 0x2d, 0x32, 0x00, 0x5d, 0xbc, 0x00,
+  0x01, 0x01, 0x64, 0x00, 0x47, 0x51, 0x00, 0x01, 0x01, 0x61, 0x01, 0x19,
+  0xcb, 0x00, 0x01, 0x01, 0x64, 0x00, 0x39, 0x28, 0x00, 0x05, 0x01, 0x67,
+  0x00, 0x69, 0x73, 0x01, 0x6e, 0x00, 0x60, 0x40, 0x04, 0x72, 0x61, 0x67,
+  0x79, 0x01, 0x17, 0x9b, 0x01, 0x74, 0x01, 0x2f, 0x9a, 0x01, 0x79, 0x00,
+  0x4c, 0xde, 0x00, 0x02, 0x01, 0x61, 0x00, 0x0f, 0x68, 0x03, 0x70, 0x68,
+  0x74, 0x01, 0x19, 0xac, 0x00, 0x02, 0x02, 0x6c, 0x75, 0x01, 0x2f, 0xa6,
+  0x02, 0x74, 0x73, 0x00, 0xdf, 0x5f, 0x00, 0x03, 0x08, 0x66, 0x65, 0x64,
+  0x6c, 0x61, 0x74, 0x73, 0x61, 0x00, 0x2f, 0x47, 0x04, 0x67, 0x69, 0x6c,
+  0x6c, 0x00, 0xcc, 0xd7, 0x03, 0x69, 0x63, 0x73, 0x01, 0x2f, 0xad, 0x01,
+  0x01, 0x01, 0x6c, 0x00, 0xdc, 0xb1, 0x01, 0x01, 0x03, 0x66, 0x6f, 0x65,
+  0x00, 0x3f, 0xa5, 0x00, 0x03, 0x01, 0x61, 0x00, 0xbb, 0x9e, 0x01, 0x6b,
+  0x01, 0x2f, 0xb6, 0x04, 0x70, 0x6d, 0x61, 0x68, 0x01, 0x01, 0x45, 0x00,
+  0x01, 0x01, 0x74, 0x00, 0xc6, 0x07, 0x01, 0x02, 0x01, 0x69, 0x00, 0x8e,
+  0x50, 0x01, 0x73, 0x00, 0x5d, 0xbc, 0x01, 0x01, 0x01, 0x65, 0x01, 0x2f,
+  0xbd, 0x00, 0x01, 0x01, 0x75, 0x00, 0xa0, 0x81, 0x00, 0x01, 0x01, 0x6e,
+  0x00, 0x80, 0x9d, 0x00, 0x06, 0x01, 0x69, 0x00, 0x4f, 0x2d, 0x01, 0x6c,
+  0x00, 0x1d, 0x34, 0x01, 0x6d, 0x01, 0x2f, 0xca, 0x01, 0x72, 0x00, 0x13,
+  0x33, 0x01, 0x73, 0x01, 0x2f, 0xd6, 0x01, 0x7a, 0x00, 0x74, 0x5b, 0x00,
+  0x02, 0x01, 0x69, 0x00, 0x87, 0xcc, 0x02, 0x6d, 0x65, 0x00, 0x59, 0xe9,
+  0x00, 0x01, 0x01, 0x72, 0x01, 0x18, 0xa8, 0x00, 0x01, 0x02, 0x68, 0x63,
+  0x00, 0x85, 0x18, 0x00, 0x03, 0x02, 0x65, 0x61, 0x00, 0xcc, 0x3e, 0x01,
+  0x6d, 0x00, 0x64, 0x65, 0x01, 0x6f, 0x00, 0x28, 0x66, 0x00, 0x01, 0x01,
+  0x61, 0x01, 0x03, 0x61, 0x00, 0x01, 0x01, 0x6f, 0x01, 0x18, 0x2b, 0x01,
+  0x01, 0x01, 0x64, 0x00, 0x4f, 0x7b, 0x01, 0x01, 0x02, 0x65, 0x76, 0x01,
+  0x02, 0x0b, 0x01, 0x03, 0x01, 0x63, 0x01, 0x2f, 0xf3, 0x03, 0x6c, 0x61,
+  0x63, 0x01, 0x2f, 0xf3, 0x01, 0x73, 0x01, 0x2f, 0xfb, 0x00, 0x01, 0x01,
+  0x73, 0x00, 0x43, 0xb8, 0x01, 0x01, 0x07, 0x64, 0x6e, 0x75, 0x74, 0x61,
+  0x6d, 0x69, 0x00, 0x6a, 0xcc, 0x00, 0x02, 0x02, 0x69, 0x76, 0x01, 0x30,
+  0x08, 0x01, 0x6e, 0x00, 0x13, 0x33, 0x00, 0x03, 0x01, 0x61, 0x01, 0x30,
+  0x16, 0x01, 0x63, 0x01, 0x30, 0x5c, 0x04, 0x69, 0x62, 0x69, 0x68, 0x00,
+  0x60, 0x95, 0x01, 0x04, 0x01, 0x65, 0x01, 0x19, 0x87, 0x03, 0x6c, 0x61,
+  0x72, 0x00, 0xff, 0xf5, 0x01, 0x6d, 0x01, 0x18, 0x45, 0x01, 0x74, 0x00,
+  0x44, 0x12, 0x00, 0x02, 0x03, 0x65, 0x68, 0x63, 0x01, 0x30, 0x6a, 0x01,
+  0x6e, 0x01, 0x00, 0xa6, 0x00, 0x02, 0x01, 0x61, 0x00, 0x1e, 0x60, 0x01,
+  0x65, 0x00, 0x21, 0x6d, 0x01, 0x02, 0x03, 0x6e, 0x69, 0x7a, 0x00, 0xc6,
+  0x2b, 0x01, 0x72, 0x00, 0xc9, 0x26, 0x00, 0x02, 0x01, 0x65, 0x01, 0x30,
+  0x76, 0x02, 0x69, 0x61, 0x00, 0x68, 0xd4, 0x00, 0x02, 0x01, 0x65, 0x00,
+  0x12, 0x22, 0x02, 0x75, 0x67, 0x00, 0x60, 0x40, 0x00, 0x02, 0x02, 0x61,
+  0x64, 0x00, 0x42, 0x43, 0x04, 0x69, 0x74, 0x6e, 0x61, 0x01, 0x30, 0x87,
+  0x01, 0x01, 0x0a, 0x65, 0x6c, 0x65, 0x74, 0x2d, 0x64, 0x6e, 0x61, 0x2d,
+  0x73, 0x00, 0xd2, 0xdc, 0x00, 0x01, 0x01, 0x74, 0x00, 0x25, 0x56, 0x00,
+  0x01, 0x01, 0x63, 0x01, 0x1c, 0xa5, 0x00, 0x02, 0x01, 0x6e, 0x00, 0x60,
+  0x40, 0x09, 0x76, 0x69, 0x74, 0x61, 0x72, 0x6f, 0x63, 0x65, 0x64, 0x01,
+  0x19, 0xe6, 0x00, 0x01, 0x04, 0x6f, 0x72, 0x69, 0x76, 0x00, 0x69, 0x73,
+  0x00, 0x01, 0x01, 0x72, 0x00, 0x5f, 0x90, 0x00, 0x02, 0x01, 0x61, 0x00,
+  0xc6, 0x7c, 0x03, 0x6f, 0x6f, 0x74, 0x00, 0x71, 0x59, 0x00, 0x01, 0x04,
+  0x6f, 0x70, 0x6d, 0x65, 0x00, 0x4f, 0xea, 0x00, 0x01, 0x01, 0x74, 0x00,
+  0xeb, 0xdc, 0x00, 0x02, 0x02, 0x61, 0x76, 0x01, 0x30, 0x93, 0x01, 0x6f,
+  0x00, 0x52, 0x55, 0x01, 0x01, 0x01, 0x74, 0x00, 0x44, 0x12, 0x01, 0x01,
+  0x01, 0x73, 0x00, 0x5d, 0xbc, 0x00, 0x02, 0x01, 0x63, 0x00, 0x46, 0x75,
+  0x01, 0x72, 0x00, 0xc9, 0x26, 0x00, 0x02, 0x01, 0x68, 0x01, 0x30, 0xa0,
+  0x05, 0x74, 0x73, 0x65, 0x77, 0x68, 0x01, 0x30, 0xa0, 0x00, 0x01, 0x01,
+  0x72, 0x00, 0x51, 0x91, 0x00, 0x02, 0x01, 0x64, 0x01, 0x2c, 0x8c, 0x01,
+  0x74, 0x01, 0x14, 0x8a, 0x00, 0x02, 0x01, 0x63, 0x01, 0x30, 0xab, 0x01,
+  0x6e, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x01, 0x6d, 0x00, 0x41, 0x08, 0x01,
+  0x74, 0x00, 0xe1, 0x49, 0x00, 0x01, 0x01, 0x72, 0x00, 0x16, 0xcd, 0x00,
+  0x04, 0x01, 0x64, 0x01, 0x30, 0xb8, 0x02, 0x6b, 0x73, 0x00, 0x6a, 0x59,
+  0x01, 0x6c, 0x00, 0xe2, 0x91, 0x01, 0x72, 0x01, 0x30, 0xc4, 0x00, 0x01,
+  0x01, 0x76, 0x00, 0x35, 0x0c, 0x00, 0x01, 0x01, 0x6e, 0x00, 0x29, 0x66,
+  0x00, 0x01, 0x01, 0x6c, 0x00, 0x94, 0xe0, 0x00, 0x02, 0x01, 0x6e, 0x00,
+  0x48, 0x25, 0x01, 0x72, 0x00, 0x56, 0x74, 0x00, 0x03, 0x01, 0x61, 0x01,
+  0x30, 0xd0, 0x01, 0x6f, 0x00, 0x15, 0x5e, 0x01, 0x79, 0x00, 0xfa, 0x34,
+  0x00, 0x03, 0x01, 0x6d, 0x01, 0x30, 0xdc, 0x02, 0x70, 0x72, 0x00, 0x61,
+  0xc1, 0x01, 0x76, 0x00, 0x2a, 0x10, 0x00, 0x02, 0x07, 0x68, 0x2d, 0x67,
+  0x6f, 0x6b, 0x73, 0x72, 0x00, 0x84, 0x70, 0x01, 0x72, 0x00, 0x16, 0x9c,
+  0x00, 0x02, 0x01, 0x6f, 0x00, 0x0e, 0x15, 0x01, 0x75, 0x00, 0x26, 0xd7,
+  0x00, 0x03, 0x03, 0x64, 0x65, 0x76, 0x00, 0x16, 0x7b, 0x01, 0x6c, 0x00,
+  0x53, 0x44, 0x01, 0x6d, 0x00, 0x4c, 0x46, 0x00, 0x01, 0x05, 0x61, 0x69,
+  0x74, 0x73, 0x69, 0x00, 0x94, 0x07, 0x00, 0x02, 0x01, 0x69, 0x00, 0x12,
+  0x22, 0x02, 0x6c, 0x65, 0x00, 0xe4, 0x6b, 0x00, 0x02, 0x02, 0x67, 0x75,
+  0x00, 0x52, 0xae, 0x01, 0x6c, 0x00, 0x26, 0xd7, 0x00, 0x01, 0x01, 0x6b,
+  0x00, 0x32, 0x5a, 0x00, 0x01, 0x01, 0x61, 0x01, 0x1a, 0x52, 0x00, 0x02,
+  0x01, 0x61, 0x00, 0x16, 0x9c, 0x02, 0x65, 0x67, 0x01, 0x30, 0xe4, 0x00,
+  0x06, 0x01, 0x61, 0x01, 0x30, 0xf0, 0x01, 0x64, 0x00, 0xe4, 0x92, 0x01,
+  0x65, 0x01, 0x31, 0x01, 0x03, 0x6c, 0x6c, 0x69, 0x00, 0xb0, 0xae, 0x01,
+  0x72, 0x01, 0x31, 0x0f, 0x01, 0x73, 0x01, 0x31, 0x1b, 0x00, 0x01, 0x02,
+  0x35, 0x2d, 0x00, 0x2a, 0x53, 0x00, 0x02, 0x01, 0x6d, 0x00, 0x6a, 0xcc,
+  0x01, 0x73, 0x00, 0x27, 0x25, 0x00, 0x02, 0x04, 0x65, 0x6a, 0x66, 0x74,
+  0x01, 0x31, 0x2c, 0x01, 0x6f, 0x00, 0x16, 0x9c, 0x00, 0x02, 0x06, 0x61,
+  0x67, 0x2d, 0x65, 0x72, 0x74, 0x01, 0x17, 0xa9, 0x01, 0x73, 0x00, 0x0e,
+  0x15, 0x00, 0x03, 0x01, 0x62, 0x00, 0x0e, 0x15, 0x01, 0x6e, 0x01, 0x31,
+  0x33, 0x01, 0x72, 0x00, 0x0e, 0x15, 0x01, 0x02, 0x01, 0x6c, 0x00, 0x0e,
+  0x15, 0x01, 0x6e, 0x00, 0x4c, 0xde, 0x00, 0x03, 0x01, 0x67, 0x00, 0x69,
+  0x73, 0x01, 0x6c, 0x00, 0x0e, 0x15, 0x01, 0x76, 0x00, 0x0e, 0x15, 0x00,
+  0x02, 0x01, 0x6a, 0x00, 0x26, 0xc4, 0x01, 0x74, 0x00, 0x27, 0x0f, 0x00,
+  0x02, 0x01, 0x61, 0x00, 0xb3, 0x12, 0x01, 0x68, 0x00, 0x0e, 0x15, 0x00,
+  0x03, 0x01, 0x6a, 0x00, 0x0c, 0x1d, 0x01, 0x6e, 0x01, 0x05, 0x2c, 0x01,
+  0x72, 0x00, 0xe5, 0x64, 0x00, 0x02, 0x01, 0x65, 0x00, 0x3b, 0x02, 0x01,
+  0x79, 0x00, 0xfa, 0x34, 0x00, 0x01, 0x01, 0x6a, 0x00, 0x21, 0x6d, 0x00,
+  0x02, 0x01, 0x61, 0x00, 0x0e, 0x15, 0x02, 0x65, 0x2d, 0x00, 0x3f, 0x9e,
+  0x00, 0x04, 0x01, 0x6c, 0x01, 0x31, 0x3a, 0x01, 0x6e, 0x01, 0x1a, 0xf3,
+  0x01, 0x74, 0x01, 0x31, 0x46, 0x01, 0x76, 0x01, 0x31, 0x54, 0x00, 0x02,
+  0x01, 0x64, 0x00, 0x46, 0x75, 0x01, 0x6c, 0x00, 0x67, 0x6c, 0x00, 0x03,
+  0x01, 0x67, 0x00, 0xf2, 0xb6, 0x01, 0x6e, 0x01, 0x31, 0x62, 0x01, 0x6f,
+  0x00, 0x12, 0x22, 0x00, 0x02, 0x01, 0x65, 0x00, 0x27, 0xf5, 0x01, 0x6f,
+  0x00, 0x0e, 0x15, 0x00, 0x02, 0x01, 0x69, 0x00, 0x16, 0xd4, 0x01, 0x72,
+  0x00, 0x41, 0x08, 0x00, 0x02, 0x01, 0x61, 0x00, 0x16, 0x7b, 0x01, 0x6d,
+  0x00, 0x1c, 0x65, 0x00, 0x02, 0x01, 0x61, 0x00, 0x26, 0xc4, 0x01, 0x65,
+  0x00, 0x26, 0xde, 0x00, 0x02, 0x01, 0x67, 0x00, 0xe4, 0x44, 0x01, 0x6e,
+  0x01, 0x06, 0x0c, 0x00, 0x02, 0x01, 0x62, 0x00, 0x0e, 0x15, 0x01, 0x6b,
+  0x00, 0x0e, 0x15, 0x00, 0x02, 0x01, 0x73, 0x00, 0x41, 0x08, 0x01, 0x74,
+  0x00, 0x56, 0x74, 0x00, 0x03, 0x01, 0x6c, 0x01, 0x31, 0x6f, 0x04, 0x6e,
+  0x65, 0x74, 0x6e, 0x01, 0x31, 0x81, 0x02, 0x72, 0x75, 0x00, 0x67, 0x27,
+  0x01, 0x02, 0x01, 0x61, 0x00, 0x98, 0x89, 0x01, 0x67, 0x00, 0x22, 0x1f,
+  0x00, 0x01, 0x01, 0x2d, 0x00, 0x2e, 0x67, 0x00, 0x03, 0x01, 0x61, 0x01,
+  0x31, 0x88, 0x01, 0x63, 0x00, 0xbc, 0xb4, 0x06, 0x6e, 0x65, 0x76, 0x65,
+  0x72, 0x70, 0x01, 0x31, 0xa9, 0x00, 0x02, 0x01, 0x64, 0x01, 0x10, 0x2b,
+  0x01, 0x6d, 0x01, 0x31, 0xb5, 0x00, 0x01, 0x03, 0x6e, 0x65, 0x69, 0x00,
+  0x4f, 0xff, 0x00, 0x08, 0x06, 0x62, 0x69, 0x68, 0x63, 0x69, 0x61, 0x00,
+  0x5d, 0x1e, 0x01, 0x64, 0x00, 0x56, 0x74, 0x02, 0x6d, 0x61, 0x01, 0x31,
+  0xc8, 0x01, 0x72, 0x01, 0x31, 0xd5, 0x01, 0x73, 0x01, 0x31, 0xe1, 0x01,
+  0x74, 0x01, 0x31, 0xee, 0x01, 0x77, 0x01, 0x31, 0xfb, 0x01, 0x79, 0x01,
+  0x32, 0x07, 0x00, 0x02, 0x01, 0x61, 0x01, 0x26, 0x93, 0x01, 0x6e, 0x01,
+  0x32, 0x15, 0x00, 0x08, 0x02, 0x61, 0x7a, 0x00, 0x66, 0x03, 0x02, 0x65,
+  0x73, 0x01, 0x0e, 0xf9, 0x01, 0x68, 0x01, 0x32, 0x1c, 0x02, 0x6b, 0x61,
+  0x01, 0x32, 0x28, 0x02, 0x6d, 0x75, 0x00, 0x39, 0x21, 0x01, 0x6f, 0x01,
+  0x32, 0x34, 0x01, 0x72, 0x01, 0x32, 0x3b, 0x01, 0x75, 0x01, 0x32, 0x57,
+  0x00, 0x02, 0x01, 0x68, 0x00, 0x0f, 0xfa, 0x01, 0x79, 0x00, 0x35, 0x0c,
+  0x00, 0x08, 0x01, 0x64, 0x01, 0x32, 0x5e, 0x05, 0x68, 0x73, 0x6f, 0x6e,
+  0x68, 0x00, 0x46, 0x7c, 0x01, 0x6b, 0x01, 0x32, 0x6f, 0x05, 0x6e, 0x69,
+  0x68, 0x73, 0x61, 0x01, 0x32, 0x7b, 0x03, 0x73, 0x6f, 0x62, 0x01, 0x32,
+  0x82, 0x03, 0x74, 0x61, 0x73, 0x01, 0x32, 0x89, 0x01, 0x75, 0x00, 0x46,
+  0x83, 0x01, 0x79, 0x01, 0x32, 0x9b, 0x00, 0x03, 0x03, 0x6b, 0x75, 0x6a,
+  0x00, 0x9b, 0x99, 0x01, 0x73, 0x01, 0x32, 0xa4, 0x04, 0x7a, 0x61, 0x72,
+  0x61, 0x01, 0x32, 0xb1, 0x00, 0x04, 0x01, 0x67, 0x00, 0x1c, 0x65, 0x01,
+  0x6d, 0x01, 0x32, 0xb8, 0x01, 0x72, 0x00, 0x43, 0x6a, 0x01, 0x74, 0x01,
+  0x32, 0xc4, 0x00, 0x02, 0x02, 0x6b, 0x61, 0x01, 0x32, 0xd2, 0x03, 0x6e,
+  0x69, 0x6d, 0x01, 0x32, 0xd9, 0x00, 0x06, 0x02, 0x61, 0x6b, 0x00, 0xc0,
+  0xec, 0x01, 0x67, 0x01, 0x32, 0xe0, 0x01, 0x68, 0x01, 0x32, 0xee, 0x03,
+  0x6b, 0x61, 0x7a, 0x01, 0x32, 0xfa, 0x03, 0x6d, 0x6f, 0x64, 0x01, 0x33,
+  0x01, 0x02, 0x72, 0x61, 0x01, 0x33, 0x08, 0x00, 0x02, 0x01, 0x6b, 0x01,
+  0x33, 0x17, 0x01, 0x73, 0x01, 0x33, 0x24, 0x00, 0x04, 0x01, 0x6b, 0x00,
+  0x41, 0xf9, 0x01, 0x6d, 0x01, 0x33, 0x30, 0x03, 0x72, 0x61, 0x62, 0x01,
+  0x31, 0x81, 0x04, 0x77, 0x61, 0x67, 0x6f, 0x00, 0xa9, 0xb3, 0x00, 0x02,
+  0x04, 0x6d, 0x69, 0x68, 0x61, 0x01, 0x01, 0x58, 0x02, 0x6e, 0x6f, 0x01,
+  0x33, 0x3e, 0x00, 0x04, 0x02, 0x61, 0x7a, 0x01, 0x33, 0x45, 0x01, 0x65,
+  0x01, 0x33, 0x4c, 0x02, 0x6b, 0x75, 0x01, 0x33, 0x53, 0x02, 0x6d, 0x6f,
+  0x01, 0x33, 0x5a, 0x00, 0x02, 0x06, 0x6d, 0x69, 0x68, 0x63, 0x61, 0x68,
+  0x01, 0x33, 0x61, 0x01, 0x6e, 0x00, 0x41, 0xf9, 0x00, 0x03, 0x02, 0x68,
+  0x73, 0x00, 0x62, 0x9c, 0x01, 0x6d, 0x00, 0x40, 0xdc, 0x01, 0x74, 0x01,
+  0x33, 0x68, 0x00, 0x02, 0x01, 0x61, 0x00, 0x26, 0xf3, 0x01, 0x74, 0x01,
+  0x33, 0x7a, 0x00, 0x06, 0x01, 0x64, 0x01, 0x33, 0x86, 0x01, 0x6b, 0x01,
+  0x33, 0x95, 0x01, 0x6d, 0x01, 0x33, 0xa8, 0x01, 0x72, 0x01, 0x33, 0xb7,
+  0x01, 0x74, 0x01, 0x33, 0xc5, 0x03, 0x77, 0x61, 0x67, 0x01, 0x33, 0xd2,
+  0x00, 0x02, 0x01, 0x73, 0x00, 0x56, 0x74, 0x07, 0x74, 0x61, 0x77, 0x61,
+  0x6e, 0x6f, 0x6a, 0x00, 0x26, 0xfa, 0x00, 0x01, 0x01, 0x6f, 0x00, 0x85,
+  0x88, 0x00, 0x05, 0x01, 0x61, 0x01, 0x26, 0x93, 0x01, 0x68, 0x01, 0x33,
+  0xe1, 0x01, 0x6b, 0x01, 0x33, 0xef, 0x01, 0x6d, 0x01, 0x33, 0xfb, 0x01,
+  0x72, 0x01, 0x34, 0x02, 0x00, 0x02, 0x01, 0x61, 0x00, 0x35, 0x0c, 0x01,
+  0x6e, 0x01, 0x34, 0x0f, 0x00, 0x04, 0x01, 0x61, 0x00, 0x26, 0xf3, 0x01,
+  0x6e, 0x01, 0x34, 0x1b, 0x01, 0x74, 0x01, 0x34, 0x34, 0x01, 0x75, 0x00,
+  0x46, 0x83, 0x00, 0x02, 0x01, 0x6f, 0x01, 0x34, 0x45, 0x01, 0x74, 0x00,
+  0x25, 0x56, 0x00, 0x06, 0x01, 0x61, 0x01, 0x34, 0x4c, 0x01, 0x65, 0x01,
+  0x34, 0x7e, 0x01, 0x69, 0x01, 0x34, 0x8f, 0x02, 0x6e, 0x65, 0x01, 0x34,
+  0xb4, 0x01, 0x6f, 0x01, 0x34, 0xc2, 0x01, 0x75, 0x01, 0x34, 0xe9, 0x00,
+  0x05, 0x01, 0x61, 0x01, 0x34, 0xfd, 0x01, 0x69, 0x01, 0x35, 0x32, 0x04,
+  0x6e, 0x6f, 0x68, 0x65, 0x01, 0x35, 0x62, 0x01, 0x6f, 0x01, 0x35, 0x69,
+  0x01, 0x75, 0x01, 0x35, 0x77, 0x00, 0x06, 0x01, 0x61, 0x01, 0x35, 0x86,
+  0x01, 0x65, 0x01, 0x35, 0xac, 0x01, 0x69, 0x01, 0x35, 0xca, 0x03, 0x6e,
+  0x61, 0x7a, 0x01, 0x06, 0x15, 0x01, 0x6f, 0x01, 0x35, 0xe6, 0x01, 0x75,
+  0x01, 0x36, 0x0b, 0x00, 0x02, 0x02, 0x61, 0x77, 0x01, 0x36, 0x24, 0x01,
+  0x6f, 0x01, 0x36, 0x2b, 0x01, 0x01, 0x01, 0x2e, 0x01, 0x36, 0x32, 0x01,
+  0x01, 0x01, 0x2e, 0x01, 0x36, 0x56, 0x01, 0x01, 0x01, 0x2e, 0x01, 0x36,
+  0x7a, 0x01, 0x01, 0x01, 0x2e, 0x01, 0x36, 0xa5, 0x01, 0x01, 0x01, 0x2e,
+  0x01, 0x36, 0xc5, 0x00, 0x08, 0x01, 0x62, 0x01, 0x0e, 0xf2, 0x02, 0x64,
+  0x6f, 0x01, 0x36, 0xe8, 0x01, 0x6b, 0x01, 0x36, 0xef, 0x01, 0x6d, 0x01,
+  0x36, 0xfc, 0x01, 0x6e, 0x01, 0x37, 0x0d, 0x01, 0x72, 0x01, 0x37, 0x1b,
+  0x01, 0x74, 0x01, 0x37, 0x34, 0x01, 0x77, 0x01, 0x37, 0x46, 0x00, 0x05,
+  0x03, 0x68, 0x73, 0x61, 0x01, 0x37, 0x59, 0x03, 0x6b, 0x61, 0x73, 0x01,
+  0x37, 0x68, 0x01, 0x6d, 0x01, 0x37, 0x74, 0x04, 0x6f, 0x67, 0x61, 0x6d,
+  0x01, 0x37, 0x82, 0x02, 0x72, 0x6f, 0x01, 0x17, 0xa9, 0x00, 0x03, 0x02,
+  0x6a, 0x6f, 0x01, 0x37, 0x89, 0x01, 0x6e, 0x01, 0x37, 0x90, 0x01, 0x74,
+  0x01, 0x27, 0xff, 0x00, 0x03, 0x03, 0x6b, 0x6f, 0x6d, 0x01, 0x1a, 0x59,
+  0x03, 0x73, 0x74, 0x61, 0x00, 0xc4, 0xeb, 0x01, 0x79, 0x00, 0x93, 0xb3,
+  0x00, 0x06, 0x01, 0x62, 0x01, 0x37, 0x9d, 0x01, 0x64, 0x01, 0x37, 0xa4,
+  0x04, 0x67, 0x75, 0x72, 0x61, 0x00, 0x45, 0x93, 0x01, 0x6d, 0x01, 0x37,
+  0xb3, 0x02, 0x72, 0x61, 0x01, 0x37, 0xc0, 0x02, 0x77, 0x61, 0x01, 0x37,
+  0xcc, 0x00, 0x04, 0x01, 0x6b, 0x01, 0x37, 0xd9, 0x02, 0x6f, 0x7a, 0x00,
+  0x43, 0x08, 0x01, 0x73, 0x00, 0x58, 0xaf, 0x01, 0x75, 0x00, 0x9b, 0xc3,
+  0x00, 0x08, 0x01, 0x61, 0x01, 0x37, 0xe0, 0x01, 0x67, 0x01, 0x37, 0xec,
+  0x01, 0x68, 0x01, 0x37, 0xf4, 0x01, 0x6a, 0x00, 0x41, 0x08, 0x02, 0x6b,
+  0x61, 0x01, 0x38, 0x01, 0x02, 0x6d, 0x61, 0x01, 0x38, 0x0d, 0x01, 0x6e,
+  0x00, 0x48, 0x25, 0x01, 0x72, 0x01, 0x38, 0x14, 0x00, 0x06, 0x01, 0x64,
+  0x01, 0x38, 0x26, 0x01, 0x67, 0x00, 0x38, 0x94, 0x01, 0x6a, 0x01, 0x27,
+  0xff, 0x06, 0x6e, 0x69, 0x68, 0x73, 0x6f, 0x79, 0x01, 0x38, 0x32, 0x07,
+  0x74, 0x6f, 0x6d, 0x61, 0x72, 0x61, 0x77, 0x00, 0x43, 0x6a, 0x01, 0x79,
+  0x01, 0x38, 0x39, 0x00, 0x05, 0x01, 0x61, 0x01, 0x38, 0x40, 0x01, 0x65,
+  0x01, 0x38, 0x6e, 0x01, 0x69, 0x01, 0x38, 0x89, 0x01, 0x6f, 0x01, 0x38,
+  0x9a, 0x02, 0x75, 0x6b, 0x01, 0x38, 0xab, 0x00, 0x06, 0x01, 0x61, 0x01,
+  0x38, 0xb3, 0x01, 0x65, 0x01, 0x38, 0xd9, 0x01, 0x69, 0x01, 0x38, 0xe6,
+  0x01, 0x6e, 0x01, 0x39, 0x02, 0x01, 0x6f, 0x01, 0x39, 0x0f, 0x01, 0x75,
+  0x01, 0x39, 0x34, 0x01, 0x01, 0x01, 0x2e, 0x01, 0x39, 0x43, 0x00, 0x05,
+  0x01, 0x61, 0x01, 0x39, 0x65, 0x01, 0x65, 0x01, 0x39, 0x7f, 0x01, 0x69,
+  0x01, 0x39, 0x8e, 0x03, 0x6f, 0x6e, 0x6f, 0x01, 0x39, 0x9f, 0x01, 0x75,
+  0x01, 0x39, 0xa7, 0x00, 0x05, 0x01, 0x61, 0x01, 0x39, 0xbe, 0x04, 0x65,
+  0x6d, 0x61, 0x67, 0x01, 0x39, 0xd8, 0x01, 0x69, 0x01, 0x39, 0xdf, 0x01,
+  0x6f, 0x01, 0x39, 0xf2, 0x01, 0x75, 0x01, 0x3a, 0x06, 0x00, 0x04, 0x01,
+  0x61, 0x01, 0x3a, 0x13, 0x01, 0x65, 0x01, 0x3a, 0x45, 0x01, 0x69, 0x01,
+  0x3a, 0x54, 0x01, 0x6f, 0x01, 0x3a, 0x80, 0x00, 0x06, 0x02, 0x64, 0x61,
+  0x01, 0x3a, 0x93, 0x01, 0x67, 0x00, 0x68, 0x09, 0x01, 0x6b, 0x00, 0x26,
+  0xfa, 0x01, 0x6d, 0x01, 0x3a, 0x9a, 0x01, 0x74, 0x01, 0x3a, 0xa2, 0x04,
+  0x77, 0x61, 0x7a, 0x61, 0x01, 0x32, 0xfa, 0x00, 0x04, 0x01, 0x67, 0x01,
+  0x26, 0x73, 0x05, 0x68, 0x63, 0x69, 0x6f, 0x6e, 0x00, 0x56, 0x74, 0x01,
+  0x6d, 0x00, 0x56, 0x74, 0x01, 0x75, 0x01, 0x3a, 0xae, 0x00, 0x01, 0x01,
+  0x75, 0x01, 0x3a, 0xae, 0x00, 0x02, 0x01, 0x61, 0x01, 0x1a, 0x59, 0x03,
+  0x74, 0x6f, 0x6e, 0x01, 0x3a, 0xb5, 0x00, 0x03, 0x01, 0x6b, 0x01, 0x38,
+  0xab, 0x01, 0x73, 0x01, 0x3a, 0xbc, 0x01, 0x7a, 0x01, 0x3a, 0xc3, 0x00,
+  0x07, 0x01, 0x68, 0x00, 0x29, 0x66, 0x01, 0x6d, 0x01, 0x3a, 0xd0, 0x01,
+  0x6e, 0x01, 0x3a, 0xe2, 0x02, 0x72, 0x61, 0x01, 0x3a, 0xee, 0x02, 0x77,
+  0x61, 0x01, 0x3a, 0xfa, 0x03, 0x79, 0x65, 0x68, 0x00, 0x2a, 0x10, 0x01,
+  0x7a, 0x01, 0x3b, 0x06, 0x00, 0x02, 0x02, 0x6f, 0x73, 0x01, 0x3b, 0x0d,
+  0x02, 0x73, 0x65, 0x00, 0x45, 0xa6, 0x00, 0x05, 0x01, 0x68, 0x01, 0x3b,
+  0x14, 0x01, 0x6a, 0x01, 0x3b, 0x1b, 0x01, 0x6b, 0x01, 0x3b, 0x22, 0x01,
+  0x6d, 0x01, 0x3b, 0x30, 0x04, 0x6e, 0x75, 0x67, 0x61, 0x01, 0x3b, 0x43,
+  0x00, 0x02, 0x01, 0x61, 0x01, 0x3b, 0x4a, 0x01, 0x69, 0x01, 0x3b, 0x5c,
+  0x00, 0x03, 0x01, 0x67, 0x00, 0x29, 0x66, 0x01, 0x6a, 0x01, 0x1a, 0x59,
+  0x04, 0x74, 0x69, 0x61, 0x64, 0x01, 0x3b, 0x69, 0x00, 0x03, 0x01, 0x62,
+  0x00, 0xbc, 0x86, 0x05, 0x6b, 0x75, 0x73, 0x75, 0x67, 0x01, 0x3b, 0x75,
+  0x03, 0x72, 0x61, 0x62, 0x01, 0x3b, 0x84, 0x00, 0x05, 0x01, 0x62, 0x00,
+  0x46, 0x7c, 0x01, 0x6b, 0x01, 0x3b, 0x90, 0x01, 0x6d, 0x01, 0x3b, 0x9c,
+  0x03, 0x6e, 0x61, 0x77, 0x00, 0x80, 0x9d, 0x02, 0x77, 0x69, 0x01, 0x3b,
+  0xa8, 0x00, 0x03, 0x01, 0x62, 0x01, 0x2b, 0x5e, 0x01, 0x6f, 0x01, 0x3b,
+  0xb4, 0x02, 0x73, 0x69, 0x01, 0x0c, 0x41, 0x00, 0x05, 0x03, 0x61, 0x72,
+  0x61, 0x00, 0x85, 0x18, 0x02, 0x67, 0x75, 0x00, 0xf5, 0x3a, 0x01, 0x68,
+  0x01, 0x3b, 0xbb, 0x01, 0x6b, 0x01, 0x3b, 0xca, 0x03, 0x72, 0x61, 0x62,
+  0x00, 0x29, 0x66, 0x00, 0x03, 0x01, 0x64, 0x00, 0x43, 0x6a, 0x01, 0x68,
+  0x00, 0x16, 0x89, 0x01, 0x6e, 0x01, 0x3b, 0xd6, 0x00, 0x02, 0x01, 0x61,
+  0x01, 0x3b, 0xea, 0x02, 0x69, 0x6a, 0x01, 0x3b, 0xf6, 0x01, 0x01, 0x01,
+  0x6d, 0x00, 0x29, 0x66, 0x00, 0x01, 0x01, 0x61, 0x01, 0x3c, 0x02, 0x00,
+  0x01, 0x03, 0x69, 0x68, 0x63, 0x00, 0x5d, 0xbc, 0x00, 0x01, 0x01, 0x75,
+  0x01, 0x3c, 0x09, 0x01, 0x01, 0x01, 0x65, 0x00, 0x27, 0x0f, 0x00, 0x04,
+  0x01, 0x64, 0x01, 0x3c, 0x10, 0x01, 0x6b, 0x01, 0x3c, 0x21, 0x01, 0x6d,
+  0x01, 0x3c, 0x29, 0x01, 0x77, 0x01, 0x3c, 0x3a, 0x00, 0x02, 0x01, 0x6e,
+  0x01, 0x3c, 0x41, 0x01, 0x75, 0x01, 0x3c, 0x09, 0x00, 0x03, 0x01, 0x67,
+  0x01, 0x3c, 0x48, 0x04, 0x6b, 0x6f, 0x6e, 0x69, 0x01, 0x3c, 0x54, 0x02,
+  0x6d, 0x69, 0x01, 0x33, 0x3e, 0x00, 0x03, 0x02, 0x6d, 0x75, 0x01, 0x3c,
+  0x5b, 0x03, 0x6e, 0x61, 0x77, 0x01, 0x37, 0x82, 0x01, 0x74, 0x01, 0x3c,
+  0x68, 0x00, 0x02, 0x01, 0x73, 0x00, 0x69, 0xc9, 0x01, 0x79, 0x01, 0x3c,
+  0x6f, 0x00, 0x05, 0x02, 0x62, 0x61, 0x01, 0x3c, 0x76, 0x01, 0x64, 0x01,
+  0x3c, 0x7d, 0x02, 0x6b, 0x6f, 0x01, 0x3c, 0x89, 0x01, 0x74, 0x01, 0x3c,
+  0x90, 0x01, 0x77, 0x01, 0x3c, 0x9c, 0x00, 0x02, 0x03, 0x68, 0x6f, 0x6e,
+  0x01, 0x3c, 0xa9, 0x01, 0x74, 0x01, 0x3c, 0xb5, 0x00, 0x05, 0x01, 0x61,
+  0x01, 0x3c, 0xbd, 0x01, 0x68, 0x01, 0x3c, 0xce, 0x01, 0x6a, 0x01, 0x3c,
+  0xdc, 0x01, 0x6b, 0x01, 0x3c, 0xe8, 0x01, 0x6d, 0x01, 0x3c, 0xf5, 0x00,
+  0x03, 0x01, 0x6b, 0x01, 0x37, 0xd9, 0x02, 0x6e, 0x6f, 0x01, 0x3d, 0x05,
+  0x04, 0x74, 0x61, 0x6e, 0x75, 0x00, 0x62, 0x7a, 0x00, 0x01, 0x01, 0x68,
+  0x00, 0x27, 0x2c, 0x00, 0x06, 0x02, 0x64, 0x75, 0x01, 0x3c, 0x54, 0x01,
+  0x6d, 0x01, 0x3d, 0x11, 0x01, 0x72, 0x01, 0x3d, 0x2a, 0x02, 0x74, 0x61,
+  0x01, 0x3d, 0x37, 0x01, 0x77, 0x01, 0x3d, 0x43, 0x01, 0x79, 0x01, 0x3d,
+  0x4f, 0x00, 0x02, 0x01, 0x6d, 0x00, 0x46, 0x7c, 0x02, 0x6e, 0x69, 0x01,
+  0x3d, 0x5b, 0x00, 0x04, 0x02, 0x68, 0x73, 0x01, 0x3d, 0x62, 0x02, 0x6b,
+  0x61, 0x01, 0x3d, 0x69, 0x01, 0x6d, 0x00, 0x68, 0x09, 0x01, 0x72, 0x01,
+  0x3d, 0x77, 0x00, 0x03, 0x01, 0x61, 0x00, 0x28, 0x66, 0x03, 0x6a, 0x61,
+  0x67, 0x00, 0x43, 0x6a, 0x01, 0x74, 0x01, 0x3d, 0x83, 0x00, 0x02, 0x01,
+  0x66, 0x00, 0x36, 0xd0, 0x01, 0x6b, 0x01, 0x3d, 0x90, 0x00, 0x07, 0x01,
+  0x67, 0x01, 0x3d, 0xa7, 0x01, 0x6b, 0x00, 0x64, 0xb6, 0x01, 0x6d, 0x01,
+  0x3d, 0xb3, 0x01, 0x72, 0x01, 0x3d, 0xc0, 0x01, 0x74, 0x01, 0x3d, 0xd1,
+  0x02, 0x77, 0x61, 0x01, 0x3d, 0xdd, 0x01, 0x79, 0x01, 0x3d, 0xeb, 0x00,
+  0x03, 0x01, 0x69, 0x01, 0x3d, 0xfc, 0x02, 0x6b, 0x75, 0x01, 0x3e, 0x04,
+  0x03, 0x6e, 0x75, 0x66, 0x01, 0x3c, 0xb5, 0x00, 0x02, 0x01, 0x61, 0x01,
+  0x3e, 0x0c, 0x01, 0x67, 0x01, 0x3e, 0x13, 0x00, 0x04, 0x01, 0x6b, 0x01,
+  0x3e, 0x24, 0x01, 0x6e, 0x00, 0x1c, 0x65, 0x01, 0x73, 0x01, 0x3e, 0x30,
+  0x01, 0x74, 0x00, 0x53, 0x44, 0x00, 0x02, 0x01, 0x62, 0x00, 0x39, 0x28,
+  0x01, 0x73, 0x00, 0x29, 0x66, 0x00, 0x06, 0x01, 0x61, 0x01, 0x3e, 0x37,
+  0x01, 0x65, 0x01, 0x3e, 0x59, 0x01, 0x69, 0x01, 0x3e, 0x71, 0x01, 0x6e,
+  0x01, 0x3e, 0x95, 0x01, 0x6f, 0x01, 0x3e, 0xa4, 0x01, 0x75, 0x01, 0x3e,
+  0xc4, 0x00, 0x04, 0x01, 0x61, 0x01, 0x3e, 0xe0, 0x01, 0x69, 0x01, 0x3f,
+  0x05, 0x01, 0x6f, 0x01, 0x3f, 0x2d, 0x01, 0x75, 0x01, 0x3f, 0x46, 0x00,
+  0x06, 0x01, 0x61, 0x01, 0x3f, 0x5a, 0x01, 0x65, 0x01, 0x3f, 0x66, 0x01,
+  0x69, 0x01, 0x3f, 0x73, 0x04, 0x6e, 0x61, 0x6e, 0x75, 0x00, 0x38, 0xd2,
+  0x01, 0x6f, 0x01, 0x3f, 0x8e, 0x01, 0x75, 0x01, 0x3f, 0x95, 0x00, 0x06,
+  0x01, 0x61, 0x01, 0x3f, 0xb4, 0x03, 0x65, 0x67, 0x75, 0x01, 0x33, 0x4c,
+  0x01, 0x69, 0x01, 0x3f, 0xd2, 0x01, 0x6f, 0x01, 0x3f, 0xe3, 0x05, 0x73,
+  0x70, 0x6c, 0x61, 0x2d, 0x01, 0x32, 0x82, 0x01, 0x75, 0x01, 0x3f, 0xfa,
+  0x00, 0x09, 0x01, 0x62, 0x01, 0x40, 0x10, 0x01, 0x67, 0x00, 0x41, 0xf9,
+  0x03, 0x6b, 0x61, 0x6e, 0x01, 0x40, 0x17, 0x01, 0x6d, 0x01, 0x40, 0x1e,
+  0x01, 0x6e, 0x00, 0x2a, 0x10, 0x01, 0x72, 0x01, 0x40, 0x2f, 0x01, 0x74,
+  0x01, 0x40, 0x3b, 0x01, 0x77, 0x01, 0x40, 0x48, 0x02, 0x79, 0x69, 0x01,
+  0x40, 0x55, 0x00, 0x04, 0x02, 0x62, 0x6f, 0x01, 0x2b, 0xe0, 0x01, 0x64,
+  0x00, 0xdb, 0xba, 0x01, 0x6e, 0x00, 0x46, 0x7c, 0x03, 0x74, 0x61, 0x64,
+  0x01, 0x3b, 0x1b, 0x00, 0x07, 0x01, 0x61, 0x01, 0x40, 0x62, 0x01, 0x65,
+  0x01, 0x40, 0x6e, 0x01, 0x67, 0x01, 0x25, 0xba, 0x01, 0x68, 0x01, 0x40,
+  0x75, 0x01, 0x6b, 0x01, 0x40, 0x81, 0x01, 0x6d, 0x00, 0x26, 0xd7, 0x06,
+  0x72, 0x75, 0x6b, 0x75, 0x73, 0x74, 0x01, 0x3c, 0x6f, 0x00, 0x08, 0x01,
+  0x64, 0x00, 0x60, 0x5a, 0x01, 0x67, 0x01, 0x40, 0x94, 0x01, 0x68, 0x00,
+  0x39, 0x28, 0x01, 0x6b, 0x01, 0x40, 0x9b, 0x04, 0x72, 0x69, 0x68, 0x73,
+  0x01, 0x40, 0xa2, 0x01, 0x73, 0x00, 0x61, 0xc1, 0x01, 0x74, 0x01, 0x40,
+  0xa9, 0x01, 0x79, 0x01, 0x32, 0x9b, 0x00, 0x03, 0x01, 0x66, 0x00, 0xff,
+  0x14, 0x02, 0x6b, 0x69, 0x00, 0xfd, 0xdc, 0x01, 0x73, 0x01, 0x32, 0xd9,
+  0x00, 0x05, 0x01, 0x61, 0x01, 0x40, 0xb6, 0x01, 0x69, 0x01, 0x40, 0xd7,
+  0x03, 0x6e, 0x65, 0x7a, 0x00, 0x70, 0xbd, 0x01, 0x6f, 0x01, 0x40, 0xef,
+  0x03, 0x75, 0x73, 0x74, 0x01, 0x41, 0x01, 0x00, 0x08, 0x02, 0x62, 0x69,
+  0x00, 0x26, 0xfa, 0x01, 0x67, 0x00, 0x37, 0xac, 0x01, 0x6b, 0x01, 0x41,
+  0x16, 0x03, 0x6d, 0x69, 0x68, 0x00, 0xc4, 0xeb, 0x01, 0x72, 0x01, 0x41,
+  0x26, 0x02, 0x74, 0x61, 0x01, 0x41, 0x33, 0x03, 0x77, 0x61, 0x67, 0x01,
+  0x41, 0x3f, 0x01, 0x79, 0x00, 0x26, 0xd7, 0x00, 0x02, 0x02, 0x62, 0x61,
+  0x01, 0x41, 0x4b, 0x03, 0x73, 0x61, 0x6b, 0x00, 0x58, 0xaf, 0x00, 0x03,
+  0x05, 0x68, 0x73, 0x61, 0x79, 0x61, 0x00, 0xcd, 0x92, 0x04, 0x6b, 0x61,
+  0x7a, 0x61, 0x01, 0x41, 0x52, 0x01, 0x6d, 0x01, 0x41, 0x5e, 0x00, 0x01,
+  0x05, 0x61, 0x6e, 0x69, 0x68, 0x63, 0x00, 0x27, 0x25, 0x00, 0x03, 0x01,
+  0x6a, 0x01, 0x41, 0x6e, 0x01, 0x6e, 0x01, 0x41, 0x7d, 0x01, 0x74, 0x01,
+  0x02, 0x04, 0x00, 0x01, 0x02, 0x61, 0x68, 0x01, 0x29, 0x63, 0x00, 0x03,
+  0x02, 0x64, 0x61, 0x01, 0x15, 0xd9, 0x01, 0x74, 0x01, 0x26, 0x73, 0x01,
+  0x77, 0x01, 0x3c, 0x68, 0x00, 0x02, 0x03, 0x68, 0x6f, 0x6e, 0x01, 0x41,
+  0x89, 0x03, 0x73, 0x61, 0x72, 0x01, 0x15, 0x2b, 0x00, 0x08, 0x02, 0x61,
+  0x6e, 0x01, 0x41, 0xa2, 0x05, 0x67, 0x61, 0x6e, 0x61, 0x79, 0x01, 0x40,
+  0x9b, 0x02, 0x68, 0x73, 0x01, 0x3e, 0x30, 0x02, 0x6a, 0x65, 0x00, 0xc8,
+  0xea, 0x04, 0x6b, 0x61, 0x73, 0x6f, 0x01, 0x27, 0xcc, 0x04, 0x6d, 0x61,
+  0x6b, 0x69, 0x00, 0x9b, 0x7c, 0x01, 0x6e, 0x01, 0x41, 0xa9, 0x01, 0x72,
+  0x01, 0x41, 0xb0, 0x00, 0x02, 0x01, 0x67, 0x01, 0x27, 0xff, 0x01, 0x6b,
+  0x01, 0x27, 0x3d, 0x00, 0x02, 0x03, 0x72, 0x61, 0x67, 0x01, 0x37, 0x82,
+  0x01, 0x73, 0x00, 0xb9, 0xd1, 0x00, 0x02, 0x01, 0x72, 0x01, 0x41, 0xc0,
+  0x02, 0x73, 0x61, 0x01, 0x41, 0xcd, 0x00, 0x01, 0x01, 0x67, 0x00, 0x41,
+  0xf9, 0x00, 0x03, 0x02, 0x67, 0x61, 0x01, 0x41, 0xd9, 0x01, 0x6e, 0x00,
+  0x7f, 0xc0, 0x06, 0x74, 0x61, 0x6e, 0x69, 0x6d, 0x69, 0x01, 0x2c, 0x24,
+  0x00, 0x02, 0x01, 0x62, 0x01, 0x1a, 0x59, 0x01, 0x7a, 0x01, 0x41, 0xe0,
+  0x00, 0x01, 0x01, 0x65, 0x00, 0x45, 0x93, 0x00, 0x01, 0x02, 0x75, 0x72,
+  0x01, 0x37, 0x82, 0x00, 0x03, 0x01, 0x62, 0x00, 0x41, 0x08, 0x01, 0x68,
+  0x01, 0x41, 0xec, 0x01, 0x79, 0x01, 0x41, 0xf8, 0x00, 0x01, 0x01, 0x6b,
+  0x00, 0x83, 0x34, 0x00, 0x01, 0x01, 0x6b, 0x00, 0x1c, 0x65, 0x00, 0x01,
+  0x01, 0x6b, 0x00, 0x6d, 0x8e, 0x00, 0x01, 0x01, 0x6d, 0x01, 0x41, 0xff,
+  0x00, 0x01, 0x01, 0x62, 0x00, 0x26, 0xfa, 0x00, 0x02, 0x01, 0x61, 0x00,
+  0xf8, 0xb4, 0x01, 0x75, 0x01, 0x42, 0x06, 0x00, 0x05, 0x03, 0x61, 0x79,
+  0x69, 0x00, 0xc5, 0xd3, 0x01, 0x68, 0x00, 0x46, 0x7c, 0x03, 0x69, 0x68,
+  0x73, 0x01, 0x42, 0x12, 0x01, 0x6f, 0x00, 0xe4, 0xad, 0x01, 0x75, 0x01,
+  0x42, 0x21, 0x00, 0x03, 0x02, 0x69, 0x62, 0x01, 0x42, 0x28, 0x02, 0x6f,
+  0x7a, 0x00, 0x41, 0x08, 0x01, 0x75, 0x01, 0x42, 0x39, 0x00, 0x02, 0x01,
+  0x67, 0x01, 0x42, 0x46, 0x01, 0x6d, 0x00, 0xf3, 0x3c, 0x00, 0x03, 0x01,
+  0x61, 0x01, 0x42, 0x4d, 0x01, 0x69, 0x00, 0x69, 0x73, 0x01, 0x6f, 0x01,
+  0x42, 0x61, 0x00, 0x02, 0x01, 0x6d, 0x01, 0x22, 0x60, 0x01, 0x6e, 0x00,
+  0x29, 0x66, 0x00, 0x02, 0x01, 0x61, 0x01, 0x42, 0x68, 0x01, 0x6f, 0x01,
+  0x42, 0x74, 0x00, 0x02, 0x01, 0x69, 0x01, 0x42, 0x81, 0x02, 0x75, 0x66,
+  0x01, 0x42, 0x88, 0x01, 0x01, 0x01, 0x69, 0x01, 0x42, 0x8f, 0x01, 0x01,
+  0x01, 0x6f, 0x01, 0x3a, 0xae, 0x00, 0x01, 0x01, 0x6b, 0x00, 0x43, 0x6a,
+  0x00, 0x03, 0x01, 0x62, 0x00, 0x5f, 0x90, 0x04, 0x6d, 0x6f, 0x6b, 0x61,
+  0x01, 0x2b, 0xe0, 0x01, 0x6e, 0x01, 0x42, 0x96, 0x00, 0x02, 0x01, 0x63,
+  0x01, 0x42, 0xb7, 0x01, 0x73, 0x01, 0x42, 0xc3, 0x00, 0x02, 0x01, 0x61,
+  0x01, 0x42, 0xdc, 0x01, 0x69, 0x01, 0x42, 0xe3, 0x00, 0x02, 0x01, 0x61,
+  0x00, 0x40, 0xf1, 0x01, 0x6f, 0x01, 0x42, 0xef, 0x00, 0x02, 0x01, 0x6b,
+  0x00, 0x26, 0xfa, 0x01, 0x72, 0x00, 0x26, 0xfa, 0x00, 0x03, 0x01, 0x61,
+  0x01, 0x42, 0xf6, 0x03, 0x69, 0x68, 0x73, 0x01, 0x43, 0x07, 0x03, 0x6f,
+  0x74, 0x61, 0x01, 0x19, 0xac, 0x00, 0x04, 0x03, 0x68, 0x63, 0x74, 0x00,
+  0x80, 0x9d, 0x01, 0x72, 0x01, 0x43, 0x13, 0x01, 0x73, 0x00, 0x1d, 0x34,
+  0x03, 0x74, 0x6f, 0x6b, 0x00, 0x27, 0x72, 0x00, 0x02, 0x01, 0x69, 0x00,
+  0x73, 0x6a, 0x01, 0x75, 0x01, 0x43, 0x1a, 0x01, 0x01, 0x03, 0x69, 0x6d,
+  0x61, 0x01, 0x43, 0x21, 0x00, 0x01, 0x01, 0x72, 0x00, 0x7f, 0xc0, 0x00,
+  0x03, 0x02, 0x69, 0x68, 0x01, 0x43, 0x2d, 0x01, 0x6f, 0x01, 0x43, 0x39,
+  0x02, 0x75, 0x6d, 0x00, 0x22, 0x26, 0x00, 0x03, 0x02, 0x61, 0x73, 0x01,
+  0x2b, 0x57, 0x01, 0x65, 0x00, 0x29, 0x58, 0x01, 0x75, 0x01, 0x1a, 0xec,
+  0x00, 0x01, 0x01, 0x61, 0x00, 0x60, 0x6f, 0x00, 0x01, 0x01, 0x6e, 0x00,
+  0x26, 0xfa, 0x00, 0x02, 0x02, 0x61, 0x73, 0x00, 0xfe, 0x3f, 0x01, 0x75,
+  0x00, 0x41, 0x08, 0x00, 0x03, 0x02, 0x61, 0x6b, 0x01, 0x43, 0x4f, 0x02,
+  0x65, 0x6e, 0x01, 0x43, 0x56, 0x01, 0x69, 0x00, 0x0f, 0x68, 0x00, 0x01,
+  0x01, 0x61, 0x00, 0x5c, 0xe3, 0x00, 0x03, 0x01, 0x61, 0x01, 0x27, 0x3d,
+  0x01, 0x74, 0x01, 0x43, 0x62, 0x01, 0x75, 0x01, 0x3b, 0x0d, 0x01, 0x01,
+  0x01, 0x6b, 0x00, 0x32, 0x5a, 0x01, 0x01, 0x01, 0x6f, 0x00, 0x35, 0x0c,
+  0x00, 0x07, 0x01, 0x62, 0x01, 0x43, 0x77, 0x01, 0x64, 0x00, 0x38, 0x94,
+  0x01, 0x67, 0x01, 0x43, 0x7e, 0x01, 0x6b, 0x01, 0x43, 0x85, 0x01, 0x6d,
+  0x01, 0x43, 0x99, 0x02, 0x77, 0x61, 0x01, 0x43, 0xa6, 0x02, 0x79, 0x69,
+  0x01, 0x43, 0xb2, 0x00, 0x07, 0x01, 0x61, 0x00, 0x9f, 0xdd, 0x02, 0x68,
+  0x73, 0x01, 0x43, 0xbe, 0x01, 0x6a, 0x01, 0x43, 0xca, 0x01, 0x6b, 0x01,
+  0x43, 0xd8, 0x01, 0x6d, 0x01, 0x40, 0x9b, 0x01, 0x6f, 0x00, 0x62, 0x9c,
+  0x03, 0x72, 0x6f, 0x67, 0x01, 0x32, 0xd9, 0x00, 0x02, 0x02, 0x61, 0x6e,
+  0x00, 0x38, 0x94, 0x04, 0x65, 0x73, 0x6e, 0x6f, 0x01, 0x27, 0xff, 0x00,
+  0x07, 0x04, 0x67, 0x61, 0x73, 0x61, 0x01, 0x43, 0xe4, 0x01, 0x6b, 0x00,
+  0x26, 0xd7, 0x01, 0x6e, 0x01, 0x43, 0xeb, 0x02, 0x72, 0x69, 0x01, 0x43,
+  0xfc, 0x01, 0x73, 0x00, 0x26, 0xfa, 0x02, 0x74, 0x6f, 0x01, 0x44, 0x03,
+  0x01, 0x79, 0x00, 0x1c, 0x65, 0x00, 0x02, 0x01, 0x62, 0x00, 0x45, 0xa6,
+  0x01, 0x67, 0x01, 0x27, 0xff, 0x00, 0x03, 0x01, 0x61, 0x01, 0x44, 0x0a,
+  0x01, 0x65, 0x01, 0x44, 0x16, 0x01, 0x69, 0x00, 0x2a, 0x10, 0x00, 0x03,
+  0x01, 0x61, 0x01, 0x44, 0x22, 0x03, 0x69, 0x68, 0x73, 0x00, 0xfd, 0xac,
+  0x01, 0x6f, 0x01, 0x44, 0x2e, 0x00, 0x03, 0x02, 0x61, 0x79, 0x01, 0x44,
+  0x35, 0x01, 0x69, 0x01, 0x44, 0x41, 0x01, 0x75, 0x01, 0x44, 0x52, 0x00,
+  0x02, 0x01, 0x69, 0x01, 0x44, 0x59, 0x01, 0x75, 0x01, 0x44, 0x61, 0x00,
+  0x02, 0x01, 0x61, 0x00, 0x21, 0x6d, 0x01, 0x75, 0x00, 0xc5, 0x92, 0x00,
+  0x02, 0x02, 0x61, 0x67, 0x00, 0x43, 0x08, 0x01, 0x6f, 0x01, 0x44, 0x68,
+  0x00, 0x03, 0x01, 0x61, 0x01, 0x44, 0x6f, 0x04, 0x6f, 0x6e, 0x69, 0x6d,
+  0x01, 0x0c, 0x41, 0x01, 0x75, 0x01, 0x44, 0x81, 0x00, 0x02, 0x01, 0x6b,
+  0x00, 0x41, 0x08, 0x01, 0x72, 0x00, 0x7f, 0xc0, 0x00, 0x01, 0x01, 0x61,
+  0x00, 0x90, 0x5b, 0x00, 0x01, 0x01, 0x61, 0x01, 0x27, 0x3d, 0x00, 0x03,
+  0x01, 0x61, 0x00, 0x8d, 0xab, 0x01, 0x63, 0x01, 0x44, 0x8d, 0x03, 0x73,
+  0x75, 0x6b, 0x01, 0x32, 0x15, 0x00, 0x04, 0x01, 0x61, 0x01, 0x44, 0x99,
+  0x02, 0x69, 0x61, 0x01, 0x3b, 0x69, 0x01, 0x6f, 0x00, 0x26, 0xd7, 0x04,
+  0x75, 0x7a, 0x69, 0x68, 0x00, 0xdf, 0x80, 0x00, 0x03, 0x01, 0x61, 0x01,
+  0x38, 0x0d, 0x01, 0x69, 0x01, 0x44, 0xaa, 0x01, 0x6f, 0x00, 0xe2, 0x54,
+  0x00, 0x03, 0x01, 0x61, 0x00, 0x5c, 0xe3, 0x02, 0x69, 0x6a, 0x01, 0x44,
+  0xb1, 0x01, 0x6f, 0x01, 0x44, 0xb8, 0x00, 0x01, 0x01, 0x75, 0x01, 0x26,
+  0x93, 0x00, 0x03, 0x01, 0x61, 0x01, 0x44, 0xbf, 0x01, 0x69, 0x01, 0x44,
+  0xcb, 0x01, 0x75, 0x01, 0x44, 0xd7, 0x00, 0x02, 0x01, 0x67, 0x00, 0x29,
+  0x66, 0x01, 0x6b, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x02, 0x6f, 0x6d, 0x01,
+  0x22, 0x60, 0x00, 0x02, 0x01, 0x61, 0x00, 0x27, 0x0f, 0x02, 0x6f, 0x68,
+  0x01, 0x44, 0xde, 0x00, 0x04, 0x01, 0x67, 0x00, 0x43, 0x08, 0x03, 0x72,
+  0x61, 0x68, 0x01, 0x44, 0xe5, 0x06, 0x73, 0x75, 0x6b, 0x61, 0x6d, 0x61,
+  0x01, 0x44, 0xec, 0x02, 0x74, 0x61, 0x01, 0x26, 0xa1, 0x00, 0x04, 0x03,
+  0x68, 0x63, 0x75, 0x00, 0xe9, 0x88, 0x01, 0x6b, 0x01, 0x44, 0xf3, 0x04,
+  0x6e, 0x75, 0x67, 0x6f, 0x01, 0x0c, 0x41, 0x02, 0x72, 0x6f, 0x01, 0x44,
+  0xb8, 0x00, 0x05, 0x01, 0x61, 0x00, 0x44, 0x12, 0x04, 0x72, 0x69, 0x68,
+  0x73, 0x01, 0x3c, 0x21, 0x01, 0x73, 0x00, 0x26, 0xd7, 0x01, 0x74, 0x01,
+  0x44, 0xff, 0x01, 0x79, 0x01, 0x0e, 0xf9, 0x00, 0x02, 0x01, 0x73, 0x01,
+  0x45, 0x11, 0x01, 0x7a, 0x00, 0x41, 0x08, 0x00, 0x06, 0x02, 0x62, 0x6d,
+  0x01, 0x45, 0x18, 0x01, 0x6b, 0x01, 0x45, 0x21, 0x04, 0x6d, 0x61, 0x79,
+  0x69, 0x01, 0x45, 0x34, 0x04, 0x6e, 0x69, 0x68, 0x73, 0x00, 0x43, 0x08,
+  0x05, 0x72, 0x61, 0x77, 0x61, 0x74, 0x01, 0x3d, 0xfc, 0x01, 0x74, 0x01,
+  0x45, 0x40, 0x00, 0x03, 0x02, 0x62, 0x61, 0x01, 0x45, 0x4c, 0x01, 0x64,
+  0x00, 0x2a, 0x10, 0x01, 0x6e, 0x00, 0x2a, 0x10, 0x00, 0x03, 0x01, 0x6a,
+  0x00, 0x5d, 0xbc, 0x06, 0x6b, 0x61, 0x7a, 0x61, 0x6d, 0x61, 0x00, 0x7b,
+  0xf8, 0x01, 0x6d, 0x01, 0x41, 0xff, 0x00, 0x01, 0x01, 0x74, 0x01, 0x1a,
+  0x59, 0x00, 0x05, 0x02, 0x67, 0x6e, 0x01, 0x45, 0x18, 0x01, 0x6b, 0x00,
+  0x2b, 0x73, 0x01, 0x6d, 0x00, 0x68, 0x09, 0x08, 0x72, 0x69, 0x68, 0x73,
+  0x61, 0x6d, 0x61, 0x79, 0x01, 0x32, 0x82, 0x01, 0x79, 0x01, 0x45, 0x5a,
+  0x00, 0x02, 0x03, 0x72, 0x75, 0x7a, 0x01, 0x31, 0x81, 0x01, 0x7a, 0x01,
+  0x45, 0x6c, 0x00, 0x02, 0x01, 0x69, 0x01, 0x45, 0x78, 0x01, 0x6f, 0x01,
+  0x36, 0xe8, 0x00, 0x02, 0x01, 0x61, 0x00, 0xcc, 0x2f, 0x03, 0x69, 0x68,
+  0x73, 0x01, 0x41, 0xf8, 0x00, 0x02, 0x01, 0x61, 0x01, 0x45, 0x84, 0x01,
+  0x69, 0x01, 0x45, 0x98, 0x00, 0x03, 0x01, 0x61, 0x01, 0x45, 0xa5, 0x03,
+  0x69, 0x61, 0x64, 0x00, 0x41, 0xf9, 0x01, 0x75, 0x01, 0x07, 0xd8, 0x00,
+  0x02, 0x01, 0x69, 0x00, 0x35, 0x0c, 0x01, 0x6f, 0x00, 0x0e, 0x15, 0x00,
+  0x02, 0x01, 0x67, 0x01, 0x45, 0xb3, 0x01, 0x6b, 0x01, 0x45, 0xbf, 0x00,
+  0x02, 0x03, 0x61, 0x67, 0x61, 0x01, 0x19, 0x80, 0x01, 0x75, 0x01, 0x26,
+  0xa8, 0x00, 0x01, 0x02, 0x6f, 0x6e, 0x00, 0x7f, 0xc0, 0x00, 0x02, 0x01,
+  0x6f, 0x00, 0x0e, 0x15, 0x03, 0x75, 0x72, 0x75, 0x01, 0x45, 0xcb, 0x00,
+  0x01, 0x01, 0x6f, 0x01, 0x45, 0xd2, 0x00, 0x01, 0x01, 0x61, 0x00, 0x66,
+  0x03, 0x00, 0x02, 0x02, 0x63, 0x61, 0x01, 0x45, 0xd9, 0x03, 0x73, 0x61,
+  0x62, 0x01, 0x40, 0x9b, 0x00, 0x02, 0x04, 0x6e, 0x75, 0x62, 0x75, 0x01,
+  0x45, 0xe5, 0x01, 0x6f, 0x01, 0x2b, 0x91, 0x00, 0x01, 0x01, 0x67, 0x00,
+  0x13, 0x5b, 0x00, 0x01, 0x01, 0x75, 0x01, 0x45, 0xec, 0x00, 0x01, 0x03,
+  0x69, 0x68, 0x63, 0x00, 0x52, 0xae, 0x00, 0x03, 0x01, 0x61, 0x00, 0x9f,
+  0x52, 0x02, 0x69, 0x68, 0x01, 0x45, 0xf3, 0x03, 0x75, 0x72, 0x69, 0x00,
+  0xb2, 0xfd, 0x00, 0x03, 0x01, 0x61, 0x01, 0x45, 0xfb, 0x01, 0x69, 0x00,
+  0x43, 0x6a, 0x01, 0x6f, 0x00, 0x35, 0x0c, 0x00, 0x01, 0x01, 0x6e, 0x00,
+  0x25, 0xc7, 0x00, 0x01, 0x01, 0x63, 0x00, 0x6d, 0x8e, 0x00, 0x01, 0x01,
+  0x77, 0x00, 0x68, 0x09, 0x00, 0x02, 0x01, 0x65, 0x00, 0x45, 0x93, 0x01,
+  0x69, 0x00, 0x21, 0x6d, 0x00, 0x01, 0x01, 0x6d, 0x00, 0x46, 0x7c, 0x00,
+  0x02, 0x01, 0x61, 0x01, 0x46, 0x08, 0x01, 0x69, 0x00, 0x9b, 0x7c, 0x00,
+  0x02, 0x02, 0x67, 0x69, 0x01, 0x46, 0x0f, 0x01, 0x73, 0x00, 0x68, 0x09,
+  0x00, 0x02, 0x01, 0x6d, 0x00, 0x45, 0xa6, 0x01, 0x74, 0x00, 0x16, 0x89,
+  0x00, 0x02, 0x01, 0x67, 0x01, 0x46, 0x1c, 0x06, 0x6b, 0x61, 0x72, 0x69,
+  0x68, 0x73, 0x01, 0x38, 0x32, 0x00, 0x01, 0x01, 0x61, 0x00, 0xcc, 0x2f,
+  0x00, 0x01, 0x01, 0x61, 0x01, 0x26, 0x93, 0x00, 0x02, 0x02, 0x61, 0x70,
+  0x00, 0x71, 0x52, 0x02, 0x75, 0x6f, 0x00, 0x54, 0x52, 0x00, 0x03, 0x01,
+  0x61, 0x01, 0x46, 0x2a, 0x01, 0x65, 0x00, 0x27, 0x0f, 0x01, 0x6f, 0x00,
+  0x16, 0x7b, 0x00, 0x02, 0x02, 0x61, 0x6e, 0x01, 0x2b, 0x8a, 0x01, 0x69,
+  0x01, 0x46, 0x31, 0x00, 0x02, 0x01, 0x6f, 0x00, 0xec, 0xba, 0x01, 0x74,
+  0x01, 0x46, 0x38, 0x00, 0x03, 0x03, 0x68, 0x63, 0x6f, 0x00, 0x98, 0x89,
+  0x02, 0x72, 0x74, 0x00, 0x46, 0x83, 0x01, 0x74, 0x00, 0x81, 0xba, 0x00,
+  0x02, 0x02, 0x67, 0x61, 0x00, 0x3f, 0x9e, 0x02, 0x74, 0x69, 0x00, 0xec,
+  0xc1, 0x00, 0x01, 0x01, 0x75, 0x00, 0x9c, 0x34, 0x00, 0x01, 0x01, 0x76,
+  0x00, 0xd0, 0x47, 0x00, 0x02, 0x02, 0x65, 0x7a, 0x00, 0xed, 0xa6, 0x01,
+  0x68, 0x00, 0xed, 0xa6, 0x00, 0x02, 0x03, 0x67, 0x64, 0x65, 0x00, 0xed,
+  0xa6, 0x03, 0x74, 0x69, 0x75, 0x00, 0x65, 0x12, 0x01, 0x01, 0x04, 0x73,
+  0x75, 0x74, 0x73, 0x01, 0x46, 0x45, 0x00, 0x01, 0x02, 0x63, 0x69, 0x00,
+  0x3f, 0xa5, 0x01, 0x01, 0x0a, 0x2e, 0x63, 0x69, 0x74, 0x73, 0x61, 0x6c,
+  0x65, 0x6a, 0x2e, 0x01, 0x46, 0x51, 0x00, 0x01, 0x02, 0x61, 0x62, 0x00,
+  0x3c, 0x61, 0x00, 0x02, 0x01, 0x2d, 0x01, 0x46, 0x63, 0x01, 0x6f, 0x01,
+  0x46, 0x6a, 0x00, 0x03, 0x01, 0x61, 0x01, 0x2c, 0xf7, 0x01, 0x65, 0x01,
+  0x2d, 0x02, 0x01, 0x76, 0x01, 0x2d, 0x09, 0x00, 0x01, 0x05, 0x69, 0x7a,
+  0x65, 0x6e, 0x65, 0x01, 0x2d, 0x02, 0x00, 0x01, 0x01, 0x76, 0x01, 0x2d,
+  0x09, 0x00, 0x02, 0x02, 0x2d, 0x69, 0x01, 0x46, 0x73, 0x01, 0x69, 0x01,
+  0x46, 0x73, 0x00, 0x01, 0x06, 0x61, 0x69, 0x73, 0x65, 0x6c, 0x67, 0x00,
+  0x2a, 0x10, 0x01, 0x02, 0x01, 0x2d, 0x01, 0x46, 0x63, 0x01, 0x6f, 0x01,
+  0x46, 0x6a, 0x00, 0x02, 0x08, 0x61, 0x74, 0x74, 0x65, 0x6c, 0x72, 0x61,
+  0x62, 0x01, 0x46, 0x7c, 0x06, 0x69, 0x6e, 0x61, 0x72, 0x74, 0x2d, 0x01,
+  0x2d, 0x4d, 0x00, 0x01, 0x01, 0x69, 0x00, 0xc9, 0x7a, 0x00, 0x01, 0x05,
+  0x61, 0x74, 0x74, 0x65, 0x6c, 0x00, 0x51, 0x91, 0x00, 0x02, 0x01, 0x2d,
+  0x00, 0x29, 0x5f, 0x01, 0x61, 0x00, 0x26, 0xde, 0x00, 0x01, 0x01, 0x6c,
+  0x00, 0x94, 0xc3, 0x00, 0x01, 0x03, 0x69, 0x6c, 0x69, 0x00, 0x6b, 0x69,
+  0x00, 0x02, 0x02, 0x2d, 0x61, 0x01, 0x46, 0x83, 0x01, 0x61, 0x01, 0x46,
+  0x83, 0x00, 0x02, 0x01, 0x65, 0x01, 0x12, 0xf8, 0x01, 0x6c, 0x00, 0x94,
+  0xe0, 0x00, 0x02, 0x06, 0x61, 0x69, 0x72, 0x64, 0x6e, 0x61, 0x01, 0x46,
+  0x7c, 0x05, 0x69, 0x6e, 0x61, 0x72, 0x74, 0x01, 0x2d, 0xec, 0x00, 0x01,
+  0x02, 0x61, 0x69, 0x00, 0x2c, 0x94, 0x01, 0x02, 0x01, 0x2d, 0x01, 0x2d,
+  0xb6, 0x01, 0x6f, 0x01, 0x2d, 0xbd, 0x00, 0x01, 0x01, 0x6f, 0x01, 0x2d,
+  0xbd, 0x00, 0x01, 0x01, 0x6e, 0x01, 0x46, 0x8a, 0x00, 0x02, 0x02, 0x61,
+  0x7a, 0x00, 0xde, 0xd7, 0x01, 0x69, 0x01, 0x46, 0x91, 0x00, 0x02, 0x02,
+  0x64, 0x2d, 0x01, 0x2d, 0xde, 0x01, 0x65, 0x01, 0x2d, 0xe5, 0x00, 0x01,
+  0x01, 0x65, 0x01, 0x2d, 0xe5, 0x00, 0x01, 0x01, 0x65, 0x01, 0x12, 0xf8,
+  0x00, 0x01, 0x01, 0x2d, 0x01, 0x2d, 0xa2, 0x00, 0x02, 0x02, 0x65, 0x75,
+  0x01, 0x46, 0x98, 0x01, 0x75, 0x01, 0x46, 0x98, 0x01, 0x03, 0x01, 0x2d,
+  0x01, 0x46, 0x9f, 0x01, 0x6e, 0x01, 0x46, 0x8a, 0x01, 0x6f, 0x01, 0x2d,
+  0xbd, 0x00, 0x03, 0x01, 0x2d, 0x01, 0x46, 0x9f, 0x01, 0x6e, 0x01, 0x46,
+  0x8a, 0x01, 0x6f, 0x01, 0x2d, 0xbd, 0x00, 0x01, 0x02, 0x72, 0x61, 0x01,
+  0x12, 0xbf, 0x00, 0x01, 0x03, 0x6e, 0x69, 0x62, 0x00, 0x93, 0x75, 0x00,
+  0x01, 0x01, 0x72, 0x00, 0x2b, 0x73, 0x00, 0x02, 0x01, 0x61, 0x00, 0x9d,
+  0xdd, 0x01, 0x6f, 0x00, 0x13, 0x4d, 0x02, 0x01, 0x01, 0x2d, 0x01, 0x46,
+  0xab, 0x00, 0x02, 0x0a, 0x72, 0x65, 0x63, 0x6e, 0x61, 0x6c, 0x61, 0x62,
+  0x65, 0x64, 0x00, 0xb9, 0x97, 0x04, 0x73, 0x72, 0x65, 0x62, 0x00, 0x9c,
+  0xba, 0x00, 0x04, 0x01, 0x31, 0x01, 0x2e, 0xaa, 0x01, 0x32, 0x01, 0x2e,
+  0xaa, 0x01, 0x33, 0x01, 0x2e, 0xaa, 0x01, 0x34, 0x01, 0x2e, 0xaa, 0x00,
+  0x01, 0x02, 0x6f, 0x73, 0x01, 0x46, 0xb7, 0x00, 0x02, 0x01, 0x61, 0x00,
+  0x0f, 0xfa, 0x01, 0x75, 0x00, 0x1d, 0x34, 0x00, 0x02, 0x02, 0x61, 0x65,
+  0x01, 0x46, 0xbe, 0x03, 0x65, 0x77, 0x2d, 0x01, 0x46, 0xca, 0x00, 0x02,
+  0x01, 0x2d, 0x00, 0xc6, 0x93, 0x01, 0x68, 0x01, 0x46, 0xde, 0x00, 0x01,
+  0x01, 0x2d, 0x01, 0x46, 0xe5, 0x00, 0x01, 0x02, 0x6f, 0x6e, 0x01, 0x46,
+  0xb7, 0x00, 0x01, 0x02, 0x2d, 0x6e, 0x00, 0xf6, 0x07, 0x00, 0x02, 0x09,
+  0x63, 0x70, 0x6a, 0x2d, 0x72, 0x65, 0x76, 0x2d, 0x64, 0x00, 0x92, 0xa5,
+  0x01, 0x64, 0x00, 0x92, 0xa5, 0x00, 0x02, 0x01, 0x6e, 0x00, 0xbd, 0x5e,
+  0x01, 0x70, 0x00, 0x99, 0x01, 0x00, 0x01, 0x06, 0x75, 0x6f, 0x6c, 0x63,
+  0x2d, 0x67, 0x00, 0x67, 0x6c, 0x00, 0x02, 0x02, 0x69, 0x68, 0x00, 0x8e,
+  0xad, 0x01, 0x79, 0x00, 0x26, 0xde, 0x00, 0x01, 0x01, 0x65, 0x01, 0x46,
+  0xf1, 0x00, 0x04, 0x02, 0x65, 0x6d, 0x01, 0x46, 0xf1, 0x01, 0x66, 0x01,
+  0x2f, 0x74, 0x01, 0x70, 0x01, 0x46, 0xf8, 0x01, 0x75, 0x01, 0x2e, 0xfa,
+  0x00, 0x02, 0x02, 0x61, 0x63, 0x01, 0x2f, 0x4a, 0x01, 0x75, 0x01, 0x2f,
+  0x6d, 0x00, 0x02, 0x01, 0x2d, 0x01, 0x46, 0xff, 0x02, 0x68, 0x74, 0x01,
+  0x47, 0x12, 0x00, 0x03, 0x01, 0x73, 0x01, 0x2f, 0x66, 0x02, 0x75, 0x65,
+  0x01, 0x47, 0x20, 0x07, 0x76, 0x6f, 0x67, 0x2d, 0x73, 0x75, 0x2d, 0x01,
+  0x47, 0x2c, 0x00, 0x02, 0x01, 0x2d, 0x01, 0x14, 0x83, 0x01, 0x2e, 0x01,
+  0x47, 0x3b, 0x00, 0x02, 0x05, 0x72, 0x6f, 0x6e, 0x2d, 0x70, 0x01, 0x46,
+  0xf8, 0x01, 0x75, 0x01, 0x47, 0x51, 0x00, 0x01, 0x01, 0x75, 0x01, 0x47,
+  0x59, 0x00, 0x01, 0x01, 0x65, 0x01, 0x2f, 0x4a, 0x00, 0x01, 0x01, 0x61,
+  0x01, 0x46, 0xf1, 0x00, 0x03, 0x01, 0x63, 0x00, 0xf8, 0xe4, 0x06, 0x64,
+  0x6f, 0x6e, 0x69, 0x6c, 0x2e, 0x00, 0x5c, 0xcc, 0x0a, 0x6c, 0x62, 0x61,
+  0x76, 0x72, 0x65, 0x73, 0x62, 0x6f, 0x2e, 0x01, 0x2c, 0xba, 0x00, 0x02,
+  0x01, 0x6f, 0x00, 0x4f, 0xff, 0x01, 0x72, 0x00, 0x92, 0x51, 0x00, 0x01,
+  0x01, 0x62, 0x00, 0x3e, 0xb9, 0x01, 0x01, 0x03, 0x66, 0x6f, 0x79, 0x01,
+  0x18, 0x80, 0x00, 0x01, 0x01, 0x72, 0x00, 0x62, 0x3b, 0x01, 0x01, 0x07,
+  0x79, 0x72, 0x74, 0x6e, 0x75, 0x6f, 0x63, 0x01, 0x19, 0xe6, 0x00, 0x02,
+  0x01, 0x61, 0x00, 0x21, 0x6d, 0x01, 0x75, 0x00, 0x29, 0x66, 0x00, 0x03,
+  0x07, 0x6d, 0x61, 0x69, 0x6c, 0x6c, 0x69, 0x77, 0x01, 0x47, 0x65, 0x03,
+  0x6e, 0x61, 0x69, 0x00, 0x4b, 0x33, 0x05, 0x72, 0x65, 0x74, 0x65, 0x70,
+  0x00, 0x26, 0xc4, 0x00, 0x01, 0x02, 0x69, 0x6e, 0x01, 0x18, 0xa1, 0x00,
+  0x02, 0x02, 0x6e, 0x65, 0x01, 0x02, 0x1e, 0x01, 0x75, 0x00, 0x0e, 0x15,
+  0x00, 0x02, 0x03, 0x64, 0x6e, 0x61, 0x00, 0xc8, 0xe2, 0x01, 0x65, 0x01,
+  0x04, 0x1c, 0x00, 0x0b, 0x01, 0x63, 0x01, 0x47, 0x6f, 0x01, 0x64, 0x00,
+  0xde, 0x7a, 0x01, 0x65, 0x00, 0x66, 0xc6, 0x01, 0x69, 0x01, 0x47, 0x7d,
+  0x08, 0x6b, 0x69, 0x6e, 0x75, 0x6d, 0x6d, 0x6f, 0x6b, 0x00, 0xdf, 0xba,
+  0x04, 0x6e, 0x69, 0x73, 0x73, 0x01, 0x27, 0xf8, 0x01, 0x72, 0x01, 0x47,
+  0x89, 0x01, 0x73, 0x01, 0x47, 0xa6, 0x01, 0x74, 0x01, 0x47, 0xad, 0x04,
+  0x76, 0x72, 0x65, 0x73, 0x01, 0x47, 0xb9, 0x01, 0x7a, 0x01, 0x47, 0xa6,
+  0x00, 0x02, 0x01, 0x65, 0x00, 0x2f, 0xa2, 0x03, 0x69, 0x66, 0x2d, 0x01,
+  0x02, 0x42, 0x00, 0x02, 0x01, 0x6e, 0x00, 0x13, 0x33, 0x01, 0x6f, 0x00,
+  0x1d, 0x1c, 0x00, 0x02, 0x06, 0x72, 0x75, 0x74, 0x61, 0x6e, 0x73, 0x01,
+  0x02, 0x42, 0x01, 0x78, 0x00, 0xbc, 0xad, 0x01, 0x02, 0x01, 0x6e, 0x00,
+  0x91, 0xd8, 0x01, 0x73, 0x00, 0x5d, 0xbc, 0x01, 0x01, 0x07, 0x65, 0x6e,
+  0x69, 0x77, 0x79, 0x64, 0x6e, 0x00, 0x64, 0xd8, 0x00, 0x01, 0x05, 0x74,
+  0x72, 0x6f, 0x6e, 0x2d, 0x00, 0x72, 0x3f, 0x00, 0x02, 0x02, 0x63, 0x68,
+  0x00, 0x53, 0x44, 0x01, 0x68, 0x00, 0x53, 0x44, 0x00, 0x02, 0x01, 0x61,
+  0x00, 0x0d, 0xc5, 0x01, 0x6e, 0x00, 0x6a, 0x59, 0x00, 0x02, 0x01, 0x75,
+  0x00, 0x2a, 0xfa, 0x01, 0x79, 0x00, 0x67, 0xba, 0x00, 0x02, 0x01, 0x67,
+  0x01, 0x1b, 0x29, 0x01, 0x72, 0x01, 0x05, 0x22, 0x01, 0x01, 0x02, 0x6c,
+  0x65, 0x01, 0x1b, 0xc0, 0x00, 0x02, 0x01, 0x65, 0x00, 0x0e, 0x15, 0x01,
+  0x69, 0x00, 0x1d, 0x34, 0x01, 0x03, 0x01, 0x64, 0x00, 0xc6, 0xeb, 0x01,
+  0x6b, 0x00, 0x0e, 0x15, 0x01, 0x76, 0x00, 0x35, 0x0c, 0x00, 0x02, 0x01,
+  0x64, 0x00, 0x38, 0x94, 0x03, 0x6b, 0x6b, 0x65, 0x00, 0x84, 0x69, 0x00,
+  0x02, 0x01, 0x69, 0x00, 0x16, 0xd4, 0x01, 0x6f, 0x00, 0x26, 0xc4, 0x00,
+  0x03, 0x01, 0x6c, 0x00, 0x53, 0x44, 0x01, 0x74, 0x00, 0x53, 0x44, 0x01,
+  0x79, 0x00, 0x16, 0x7b, 0x00, 0x01, 0x01, 0x74, 0x00, 0x52, 0xae, 0x00,
+  0x01, 0x01, 0x72, 0x00, 0x32, 0x5a, 0x00, 0x02, 0x01, 0x61, 0x00, 0x27,
+  0x0f, 0x01, 0x6c, 0x00, 0x53, 0x44, 0x00, 0x02, 0x01, 0x61, 0x00, 0x31,
+  0x67, 0x03, 0x64, 0x64, 0x6f, 0x00, 0xe4, 0x1d, 0x00, 0x02, 0x01, 0x61,
+  0x00, 0x26, 0xde, 0x03, 0x65, 0x73, 0x73, 0x00, 0x27, 0x33, 0x00, 0x02,
+  0x01, 0x65, 0x00, 0x1d, 0x1c, 0x02, 0x6f, 0x6a, 0x00, 0x12, 0x22, 0x00,
+  0x02, 0x07, 0x6c, 0x69, 0x65, 0x76, 0x72, 0x75, 0x73, 0x01, 0x1c, 0x7c,
+  0x01, 0x75, 0x01, 0x2f, 0xa6, 0x00, 0x01, 0x01, 0x69, 0x00, 0x13, 0x33,
+  0x00, 0x05, 0x04, 0x63, 0x69, 0x66, 0x69, 0x00, 0xca, 0xff, 0x02, 0x65,
+  0x72, 0x00, 0x85, 0x4b, 0x02, 0x67, 0x69, 0x01, 0x47, 0xce, 0x01, 0x69,
+  0x01, 0x47, 0xdf, 0x02, 0x72, 0x65, 0x01, 0x14, 0x91, 0x00, 0x01, 0x06,
+  0x2d, 0x74, 0x6e, 0x65, 0x64, 0x69, 0x00, 0xbc, 0xc6, 0x00, 0x03, 0x03,
+  0x65, 0x73, 0x75, 0x00, 0x3e, 0xb9, 0x01, 0x6e, 0x01, 0x47, 0xf0, 0x01,
+  0x70, 0x00, 0xc3, 0xe6, 0x00, 0x02, 0x01, 0x68, 0x00, 0x39, 0x28, 0x02,
+  0x79, 0x65, 0x01, 0x47, 0xff, 0x00, 0x02, 0x01, 0x61, 0x01, 0x48, 0x0b,
+  0x01, 0x75, 0x01, 0x48, 0x1c, 0x00, 0x02, 0x01, 0x6f, 0x00, 0x27, 0x0f,
+  0x02, 0x75, 0x66, 0x01, 0x3b, 0x1b, 0x00, 0x02, 0x02, 0x61, 0x6d, 0x01,
+  0x32, 0x9b, 0x01, 0x69, 0x01, 0x32, 0x7b, 0x00, 0x02, 0x01, 0x61, 0x01,
+  0x48, 0x30, 0x01, 0x69, 0x01, 0x48, 0x43, 0x00, 0x02, 0x02, 0x61, 0x67,
+  0x01, 0x48, 0x4a, 0x02, 0x69, 0x6d, 0x01, 0x48, 0x51, 0x00, 0x01, 0x01,
+  0x61, 0x00, 0xc5, 0x92, 0x00, 0x02, 0x01, 0x61, 0x00, 0x8d, 0xab, 0x01,
+  0x73, 0x01, 0x48, 0x59, 0x00, 0x02, 0x01, 0x74, 0x00, 0x41, 0x08, 0x01,
+  0x7a, 0x00, 0x41, 0xf9, 0x00, 0x01, 0x01, 0x72, 0x00, 0x26, 0xfa, 0x00,
+  0x03, 0x09, 0x61, 0x6b, 0x69, 0x68, 0x61, 0x62, 0x69, 0x68, 0x73, 0x00,
+  0x27, 0xab, 0x01, 0x6f, 0x01, 0x48, 0x66, 0x04, 0x75, 0x6b, 0x75, 0x6a,
+  0x00, 0x80, 0x9d, 0x00, 0x01, 0x01, 0x73, 0x00, 0x26, 0xfa, 0x00, 0x02,
+  0x06, 0x69, 0x61, 0x6b, 0x75, 0x73, 0x74, 0x00, 0x62, 0x3b, 0x01, 0x75,
+  0x01, 0x3c, 0x09, 0x00, 0x02, 0x01, 0x61, 0x01, 0x48, 0x72, 0x01, 0x69,
+  0x00, 0x37, 0xd5, 0x00, 0x01, 0x01, 0x72, 0x00, 0x29, 0x66, 0x00, 0x01,
+  0x01, 0x69, 0x01, 0x26, 0xa1, 0x00, 0x02, 0x07, 0x61, 0x72, 0x69, 0x68,
+  0x73, 0x69, 0x6d, 0x01, 0x48, 0x7e, 0x01, 0x69, 0x01, 0x2b, 0xe0, 0x00,
+  0x01, 0x03, 0x69, 0x68, 0x63, 0x00, 0x45, 0xa6, 0x00, 0x02, 0x02, 0x61,
+  0x79, 0x01, 0x3b, 0x0d, 0x01, 0x74, 0x01, 0x48, 0x85, 0x00, 0x01, 0x01,
+  0x73, 0x00, 0x16, 0x89, 0x00, 0x02, 0x01, 0x61, 0x01, 0x48, 0x91, 0x01,
+  0x69, 0x01, 0x48, 0x43, 0x00, 0x02, 0x01, 0x61, 0x01, 0x48, 0x9d, 0x03,
+  0x69, 0x72, 0x61, 0x01, 0x27, 0x2f, 0x00, 0x01, 0x01, 0x69, 0x00, 0x44,
+  0x12, 0x00, 0x01, 0x01, 0x69, 0x01, 0x48, 0xa9, 0x00, 0x02, 0x03, 0x61,
+  0x72, 0x75, 0x01, 0x42, 0x61, 0x01, 0x6f, 0x00, 0x0e, 0x15, 0x00, 0x02,
+  0x01, 0x63, 0x01, 0x48, 0xb0, 0x01, 0x73, 0x01, 0x3d, 0x62, 0x00, 0x01,
+  0x01, 0x6e, 0x00, 0x68, 0x09, 0x00, 0x01, 0x01, 0x75, 0x01, 0x26, 0x9a,
+  0x00, 0x02, 0x04, 0x67, 0x6f, 0x6e, 0x69, 0x01, 0x48, 0xbc, 0x01, 0x6d,
+  0x00, 0x2a, 0x10, 0x00, 0x02, 0x01, 0x61, 0x00, 0x16, 0x7b, 0x02, 0x6f,
+  0x68, 0x01, 0x48, 0xc3, 0x00, 0x02, 0x01, 0x6f, 0x00, 0x16, 0x7b, 0x01,
+  0x74, 0x00, 0xc5, 0xc5, 0x00, 0x02, 0x01, 0x61, 0x01, 0x48, 0xca, 0x03,
+  0x69, 0x68, 0x73, 0x01, 0x29, 0x63, 0x00, 0x01, 0x01, 0x6b, 0x00, 0x7f,
+  0xc0, 0x00, 0x01, 0x01, 0x61, 0x01, 0x44, 0xe5, 0x00, 0x01, 0x01, 0x73,
+  0x00, 0x41, 0xf9, 0x00, 0x01, 0x01, 0x73, 0x01, 0x48, 0xd6, 0x00, 0x01,
+  0x01, 0x69, 0x01, 0x48, 0xdd, 0x00, 0x01, 0x01, 0x69, 0x00, 0x26, 0xe5,
+  0x00, 0x03, 0x02, 0x61, 0x73, 0x01, 0x48, 0xe4, 0x01, 0x6f, 0x00, 0x35,
+  0x0c, 0x01, 0x74, 0x00, 0x36, 0xd0, 0x00, 0x02, 0x01, 0x61, 0x00, 0xc4,
+  0xeb, 0x01, 0x6f, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x04, 0x61, 0x77, 0x69,
+  0x68, 0x01, 0x32, 0xb1, 0x01, 0x65, 0x00, 0x45, 0x93, 0x00, 0x03, 0x01,
+  0x61, 0x01, 0x48, 0xeb, 0x02, 0x6f, 0x61, 0x01, 0x48, 0xf7, 0x02, 0x75,
+  0x7a, 0x01, 0x48, 0xfe, 0x00, 0x02, 0x04, 0x61, 0x79, 0x61, 0x73, 0x01,
+  0x49, 0x05, 0x01, 0x6f, 0x01, 0x49, 0x0c, 0x00, 0x02, 0x01, 0x61, 0x01,
+  0x49, 0x13, 0x03, 0x65, 0x64, 0x69, 0x01, 0x40, 0xa2, 0x00, 0x02, 0x02,
+  0x61, 0x6b, 0x01, 0x41, 0xa2, 0x01, 0x69, 0x01, 0x49, 0x1f, 0x00, 0x02,
+  0x02, 0x61, 0x79, 0x00, 0x22, 0x26, 0x03, 0x6f, 0x64, 0x6f, 0x01, 0x49,
+  0x2b, 0x00, 0x02, 0x03, 0x63, 0x75, 0x67, 0x01, 0x3c, 0x89, 0x01, 0x73,
+  0x01, 0x49, 0x32, 0x00, 0x02, 0x01, 0x61, 0x01, 0x49, 0x4d, 0x01, 0x75,
+  0x01, 0x33, 0x53, 0x00, 0x01, 0x01, 0x75, 0x01, 0x49, 0x59, 0x00, 0x02,
+  0x01, 0x69, 0x01, 0x46, 0x31, 0x02, 0x6f, 0x74, 0x01, 0x22, 0x50, 0x00,
+  0x02, 0x01, 0x61, 0x00, 0x21, 0x6d, 0x01, 0x65, 0x00, 0x27, 0x0f, 0x00,
+  0x04, 0x01, 0x61, 0x01, 0x49, 0x60, 0x01, 0x65, 0x00, 0x37, 0xd5, 0x04,
+  0x69, 0x6b, 0x69, 0x62, 0x00, 0x52, 0xae, 0x01, 0x6f, 0x00, 0x28, 0xdc,
+  0x00, 0x03, 0x01, 0x61, 0x00, 0x85, 0x88, 0x01, 0x69, 0x00, 0x1e, 0x59,
+  0x01, 0x6f, 0x01, 0x42, 0xdc, 0x00, 0x01, 0x01, 0x69, 0x01, 0x49, 0x76,
+  0x00, 0x09, 0x01, 0x64, 0x01, 0x49, 0x7d, 0x01, 0x67, 0x01, 0x49, 0x89,
+  0x02, 0x68, 0x69, 0x00, 0x76, 0xd6, 0x01, 0x6b, 0x01, 0x49, 0x9a, 0x02,
+  0x6d, 0x61, 0x01, 0x49, 0xa7, 0x01, 0x72, 0x01, 0x0e, 0xf2, 0x01, 0x74,
+  0x01, 0x49, 0xb3, 0x02, 0x77, 0x61, 0x01, 0x49, 0xbf, 0x01, 0x79, 0x01,
+  0x49, 0xcc, 0x00, 0x03, 0x01, 0x6d, 0x01, 0x49, 0xd8, 0x01, 0x74, 0x01,
+  0x49, 0xe4, 0x01, 0x75, 0x00, 0x27, 0x0f, 0x00, 0x07, 0x01, 0x61, 0x01,
+  0x49, 0xeb, 0x01, 0x67, 0x01, 0x49, 0xf9, 0x01, 0x68, 0x01, 0x4a, 0x00,
+  0x01, 0x6b, 0x01, 0x4a, 0x0c, 0x01, 0x6d, 0x01, 0x4a, 0x24, 0x01, 0x72,
+  0x01, 0x4a, 0x3b, 0x01, 0x75, 0x00, 0xc6, 0x93, 0x00, 0x02, 0x02, 0x73,
+  0x69, 0x00, 0x84, 0xae, 0x02, 0x7a, 0x75, 0x01, 0x4a, 0x48, 0x00, 0x07,
+  0x01, 0x67, 0x01, 0x44, 0xde, 0x01, 0x68, 0x01, 0x4a, 0x54, 0x01, 0x6a,
+  0x01, 0x4a, 0x65, 0x01, 0x6b, 0x01, 0x37, 0xd9, 0x03, 0x6e, 0x69, 0x68,
+  0x01, 0x40, 0x6e, 0x01, 0x74, 0x00, 0x41, 0x08, 0x01, 0x75, 0x00, 0x46,
+  0x83, 0x00, 0x03, 0x04, 0x66, 0x69, 0x61, 0x7a, 0x00, 0x1e, 0x59, 0x01,
+  0x67, 0x01, 0x27, 0xff, 0x01, 0x73, 0x01, 0x42, 0xef, 0x00, 0x08, 0x03,
+  0x62, 0x6d, 0x65, 0x00, 0x69, 0xc9, 0x01, 0x64, 0x01, 0x4a, 0x71, 0x02,
+  0x6b, 0x6f, 0x01, 0x4a, 0x87, 0x03, 0x6d, 0x69, 0x68, 0x00, 0xf5, 0x3a,
+  0x02, 0x72, 0x61, 0x01, 0x4a, 0x8f, 0x01, 0x74, 0x01, 0x3c, 0xb5, 0x02,
+  0x77, 0x61, 0x01, 0x4a, 0x9f, 0x05, 0x79, 0x69, 0x6d, 0x6f, 0x6e, 0x01,
+  0x40, 0xa2, 0x00, 0x07, 0x01, 0x61, 0x01, 0x4a, 0xab, 0x04, 0x68, 0x63,
+  0x61, 0x6d, 0x01, 0x3c, 0x89, 0x01, 0x6a, 0x00, 0x6d, 0x8e, 0x03, 0x6b,
+  0x61, 0x7a, 0x01, 0x4a, 0xb7, 0x02, 0x6d, 0x61, 0x01, 0x4a, 0xc3, 0x05,
+  0x6e, 0x75, 0x6b, 0x6f, 0x6e, 0x01, 0x33, 0xfb, 0x02, 0x6f, 0x72, 0x01,
+  0x33, 0x01, 0x00, 0x01, 0x01, 0x6e, 0x01, 0x0e, 0xf2, 0x00, 0x02, 0x03,
+  0x6e, 0x6f, 0x73, 0x00, 0x13, 0x5b, 0x01, 0x74, 0x00, 0x2a, 0x10, 0x00,
+  0x02, 0x04, 0x73, 0x74, 0x61, 0x6d, 0x01, 0x4a, 0xcf, 0x01, 0x7a, 0x01,
+  0x4a, 0xd6, 0x00, 0x07, 0x01, 0x64, 0x01, 0x4a, 0xe2, 0x01, 0x6b, 0x01,
+  0x4a, 0xf3, 0x01, 0x6d, 0x01, 0x4a, 0xff, 0x01, 0x6e, 0x00, 0x2a, 0x10,
+  0x02, 0x77, 0x61, 0x01, 0x4b, 0x10, 0x01, 0x79, 0x01, 0x4b, 0x28, 0x01,
+  0x7a, 0x01, 0x43, 0x4f, 0x00, 0x05, 0x03, 0x62, 0x61, 0x6b, 0x01, 0x43,
+  0x7e, 0x01, 0x6f, 0x01, 0x3b, 0xb4, 0x02, 0x73, 0x6f, 0x01, 0x46, 0x2a,
+  0x01, 0x74, 0x01, 0x4b, 0x34, 0x01, 0x7a, 0x00, 0x27, 0xab, 0x00, 0x05,
+  0x02, 0x62, 0x61, 0x00, 0xcd, 0x09, 0x01, 0x68, 0x01, 0x4b, 0x3b, 0x01,
+  0x69, 0x01, 0x2f, 0xb6, 0x01, 0x6b, 0x01, 0x4b, 0x48, 0x01, 0x6d, 0x01,
+  0x4b, 0x59, 0x00, 0x07, 0x01, 0x64, 0x01, 0x2c, 0x24, 0x01, 0x69, 0x01,
+  0x43, 0xfc, 0x01, 0x6a, 0x00, 0xe7, 0x27, 0x01, 0x6e, 0x01, 0x4b, 0x6d,
+  0x01, 0x72, 0x01, 0x4b, 0x84, 0x01, 0x74, 0x01, 0x4b, 0x92, 0x01, 0x7a,
+  0x00, 0x68, 0x09, 0x00, 0x03, 0x07, 0x62, 0x69, 0x68, 0x63, 0x69, 0x68,
+  0x63, 0x01, 0x38, 0x32, 0x03, 0x73, 0x6f, 0x6e, 0x01, 0x48, 0xc3, 0x01,
+  0x79, 0x00, 0x22, 0x1f, 0x01, 0x01, 0x01, 0x2e, 0x01, 0x4b, 0xa7, 0x01,
+  0x01, 0x01, 0x2e, 0x01, 0x4b, 0xca, 0x00, 0x06, 0x01, 0x61, 0x01, 0x4b,
+  0xe5, 0x02, 0x65, 0x62, 0x01, 0x4c, 0x12, 0x01, 0x69, 0x01, 0x4c, 0x1e,
+  0x04, 0x6e, 0x65, 0x7a, 0x75, 0x00, 0x73, 0x3c, 0x01, 0x6f, 0x01, 0x2a,
+  0xaa, 0x01, 0x75, 0x01, 0x4c, 0x32, 0x00, 0x06, 0x01, 0x61, 0x01, 0x4c,
+  0x46, 0x01, 0x65, 0x01, 0x4c, 0x57, 0x01, 0x69, 0x01, 0x4c, 0x6c, 0x01,
+  0x6e, 0x00, 0x96, 0x26, 0x01, 0x6f, 0x01, 0x4c, 0x8a, 0x05, 0x75, 0x7a,
+  0x69, 0x6d, 0x75, 0x00, 0x50, 0x30, 0x00, 0x06, 0x01, 0x61, 0x01, 0x4c,
+  0x9b, 0x01, 0x65, 0x01, 0x4c, 0xb7, 0x01, 0x69, 0x01, 0x4c, 0xc3, 0x0b,
+  0x6e, 0x65, 0x67, 0x6f, 0x6b, 0x69, 0x6b, 0x65, 0x73, 0x6e, 0x69, 0x00,
+  0x16, 0xb8, 0x01, 0x6f, 0x01, 0x4c, 0xd8, 0x02, 0x75, 0x68, 0x01, 0x2b,
+  0xc6, 0x00, 0x05, 0x01, 0x61, 0x01, 0x4c, 0xe4, 0x04, 0x65, 0x67, 0x69,
+  0x68, 0x01, 0x4c, 0xf8, 0x01, 0x69, 0x01, 0x4c, 0xff, 0x03, 0x6e, 0x61,
+  0x6e, 0x01, 0x4d, 0x1d, 0x01, 0x6f, 0x01, 0x4d, 0x29, 0x00, 0x06, 0x01,
+  0x61, 0x01, 0x4d, 0x35, 0x01, 0x65, 0x01, 0x4d, 0x52, 0x01, 0x69, 0x01,
+  0x4d, 0x67, 0x04, 0x6e, 0x69, 0x68, 0x73, 0x00, 0x38, 0x36, 0x01, 0x6f,
+  0x01, 0x4d, 0x89, 0x01, 0x75, 0x01, 0x4d, 0xa6, 0x00, 0x01, 0x01, 0x79,
+  0x00, 0x37, 0xb3, 0x00, 0x02, 0x01, 0x61, 0x00, 0xff, 0xb5, 0x02, 0x6f,
+  0x69, 0x01, 0x4d, 0xc2, 0x00, 0x02, 0x01, 0x61, 0x01, 0x46, 0x08, 0x06,
+  0x75, 0x73, 0x74, 0x61, 0x67, 0x61, 0x01, 0x33, 0x5a, 0x00, 0x02, 0x03,
+  0x69, 0x68, 0x73, 0x01, 0x4d, 0xd3, 0x01, 0x6e, 0x00, 0x68, 0x09, 0x00,
+  0x04, 0x04, 0x61, 0x68, 0x6f, 0x6e, 0x01, 0x45, 0x11, 0x01, 0x6e, 0x00,
+  0x68, 0x09, 0x01, 0x6f, 0x00, 0x0e, 0x15, 0x01, 0x75, 0x01, 0x4d, 0xda,
+  0x00, 0x03, 0x02, 0x61, 0x6d, 0x00, 0xf3, 0x3c, 0x01, 0x69, 0x01, 0x4d,
+  0xe6, 0x01, 0x6f, 0x00, 0x0e, 0x15, 0x00, 0x03, 0x03, 0x61, 0x6b, 0x75,
+  0x01, 0x26, 0xa8, 0x01, 0x69, 0x00, 0x5d, 0xb5, 0x01, 0x6f, 0x00, 0x38,
+  0xd2, 0x00, 0x02, 0x02, 0x62, 0x65, 0x00, 0x13, 0x33, 0x03, 0x79, 0x61,
+  0x62, 0x01, 0x4d, 0xed, 0x00, 0x02, 0x01, 0x61, 0x01, 0x27, 0x3d, 0x01,
+  0x65, 0x00, 0x39, 0x21, 0x00, 0x02, 0x02, 0x61, 0x6b, 0x01, 0x41, 0xff,
+  0x02, 0x75, 0x7a, 0x01, 0x15, 0x2b, 0x00, 0x01, 0x01, 0x75, 0x00, 0x84,
+  0x96, 0x00, 0x01, 0x01, 0x6e, 0x01, 0x4d, 0xf4, 0x00, 0x02, 0x01, 0x65,
+  0x00, 0x5d, 0xbc, 0x02, 0x6f, 0x79, 0x01, 0x42, 0x46, 0x00, 0x01, 0x01,
+  0x69, 0x01, 0x48, 0x43, 0x00, 0x02, 0x04, 0x61, 0x6b, 0x61, 0x74, 0x01,
+  0x4d, 0xfb, 0x01, 0x75, 0x01, 0x15, 0x32, 0x00, 0x02, 0x02, 0x61, 0x79,
+  0x01, 0x4e, 0x02, 0x01, 0x6f, 0x00, 0x45, 0x93, 0x00, 0x02, 0x01, 0x68,
+  0x01, 0x37, 0x9d, 0x01, 0x6e, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x02, 0x67,
+  0x65, 0x01, 0x4e, 0x14, 0x01, 0x6b, 0x00, 0x4c, 0x78, 0x00, 0x01, 0x01,
+  0x61, 0x01, 0x44, 0x68, 0x00, 0x02, 0x01, 0x72, 0x01, 0x29, 0xba, 0x01,
+  0x77, 0x00, 0x68, 0x09, 0x00, 0x01, 0x02, 0x61, 0x72, 0x01, 0x41, 0xf8,
+  0x00, 0x02, 0x02, 0x63, 0x69, 0x01, 0x3b, 0x1b, 0x01, 0x73, 0x01, 0x4e,
+  0x1b, 0x00, 0x02, 0x01, 0x6d, 0x01, 0x32, 0xfa, 0x01, 0x74, 0x01, 0x49,
+  0xf9, 0x00, 0x01, 0x01, 0x6b, 0x01, 0x0e, 0xf2, 0x00, 0x03, 0x01, 0x6e,
+  0x00, 0x6b, 0x7d, 0x01, 0x6f, 0x01, 0x48, 0xd6, 0x02, 0x75, 0x67, 0x00,
+  0x6a, 0xcc, 0x00, 0x02, 0x01, 0x6e, 0x00, 0x26, 0xd7, 0x01, 0x6f, 0x00,
+  0x7b, 0xf8, 0x01, 0x01, 0x01, 0x69, 0x01, 0x48, 0xdd, 0x00, 0x01, 0x01,
+  0x72, 0x00, 0x41, 0xf9, 0x00, 0x07, 0x04, 0x64, 0x69, 0x68, 0x73, 0x01,
+  0x15, 0x2b, 0x01, 0x6b, 0x01, 0x4e, 0x22, 0x03, 0x6d, 0x61, 0x79, 0x01,
+  0x4e, 0x2f, 0x03, 0x72, 0x75, 0x6b, 0x01, 0x4e, 0x40, 0x02, 0x74, 0x61,
+  0x01, 0x4e, 0x47, 0x02, 0x77, 0x61, 0x01, 0x4e, 0x59, 0x01, 0x7a, 0x01,
+  0x4e, 0x6b, 0x00, 0x05, 0x01, 0x61, 0x01, 0x4e, 0x72, 0x01, 0x62, 0x01,
+  0x4e, 0x79, 0x01, 0x64, 0x01, 0x4e, 0x80, 0x01, 0x6e, 0x01, 0x33, 0x5a,
+  0x01, 0x6f, 0x00, 0x0e, 0x15, 0x00, 0x03, 0x01, 0x61, 0x01, 0x4e, 0x87,
+  0x01, 0x68, 0x01, 0x4e, 0x93, 0x01, 0x6e, 0x01, 0x4e, 0x9f, 0x00, 0x03,
+  0x01, 0x64, 0x00, 0x4c, 0x78, 0x01, 0x6a, 0x01, 0x27, 0xff, 0x01, 0x79,
+  0x01, 0x1a, 0x59, 0x00, 0x01, 0x02, 0x6f, 0x68, 0x00, 0x68, 0x09, 0x00,
+  0x06, 0x01, 0x67, 0x00, 0x26, 0xd7, 0x01, 0x6b, 0x01, 0x4e, 0xa6, 0x05,
+  0x6d, 0x75, 0x6e, 0x6f, 0x75, 0x01, 0x0c, 0x41, 0x01, 0x74, 0x01, 0x4e,
+  0xb2, 0x01, 0x77, 0x01, 0x4e, 0xbe, 0x03, 0x79, 0x69, 0x6a, 0x00, 0x41,
+  0x08, 0x00, 0x02, 0x01, 0x6b, 0x00, 0x6a, 0xc5, 0x02, 0x6d, 0x61, 0x01,
+  0x4e, 0xca, 0x00, 0x04, 0x02, 0x61, 0x6e, 0x00, 0x38, 0x36, 0x04, 0x68,
+  0x63, 0x61, 0x6d, 0x01, 0x4e, 0xd1, 0x03, 0x6b, 0x61, 0x7a, 0x01, 0x4e,
+  0xd8, 0x01, 0x6d, 0x01, 0x4e, 0xe5, 0x00, 0x02, 0x02, 0x61, 0x6e, 0x01,
+  0x37, 0x82, 0x01, 0x65, 0x01, 0x4e, 0xf1, 0x00, 0x07, 0x01, 0x64, 0x00,
+  0x1c, 0x65, 0x01, 0x69, 0x01, 0x4e, 0xf8, 0x01, 0x6a, 0x00, 0x38, 0x94,
+  0x01, 0x6b, 0x01, 0x4f, 0x00, 0x01, 0x6d, 0x00, 0x68, 0x09, 0x01, 0x6e,
+  0x00, 0x40, 0x1a, 0x01, 0x72, 0x00, 0xef, 0x94, 0x00, 0x02, 0x02, 0x6f,
+  0x72, 0x00, 0xef, 0x94, 0x03, 0x73, 0x74, 0x65, 0x00, 0x61, 0xc1, 0x00,
+  0x06, 0x01, 0x61, 0x01, 0x4f, 0x0c, 0x01, 0x65, 0x01, 0x4f, 0x22, 0x01,
+  0x69, 0x01, 0x4f, 0x3e, 0x03, 0x6e, 0x65, 0x73, 0x01, 0x40, 0x94, 0x01,
+  0x6f, 0x01, 0x4f, 0x57, 0x01, 0x75, 0x01, 0x4f, 0x82, 0x00, 0x04, 0x05,
+  0x64, 0x61, 0x6b, 0x61, 0x74, 0x01, 0x39, 0x9f, 0x01, 0x6d, 0x01, 0x4f,
+  0x91, 0x01, 0x73, 0x00, 0x5d, 0xbc, 0x01, 0x74, 0x01, 0x4f, 0xa0, 0x00,
+  0x02, 0x03, 0x6f, 0x6e, 0x6f, 0x01, 0x45, 0xe5, 0x02, 0x75, 0x73, 0x01,
+  0x4f, 0xac, 0x00, 0x03, 0x01, 0x6a, 0x00, 0x7f, 0xc0, 0x01, 0x6b, 0x01,
+  0x4f, 0xb3, 0x01, 0x6d, 0x01, 0x40, 0x10, 0x00, 0x01, 0x02, 0x6f, 0x67,
+  0x01, 0x2b, 0xbf, 0x00, 0x04, 0x01, 0x66, 0x01, 0x4e, 0x6b, 0x01, 0x6a,
+  0x00, 0x80, 0x9d, 0x02, 0x70, 0x70, 0x00, 0x73, 0x35, 0x01, 0x73, 0x00,
+  0x80, 0x9d, 0x00, 0x03, 0x05, 0x6d, 0x69, 0x68, 0x73, 0x6f, 0x00, 0x29,
+  0x66, 0x03, 0x72, 0x69, 0x68, 0x01, 0x4f, 0xc5, 0x04, 0x77, 0x61, 0x67,
+  0x61, 0x01, 0x4f, 0xcd, 0x00, 0x01, 0x01, 0x75, 0x00, 0x4c, 0xde, 0x00,
+  0x03, 0x01, 0x6a, 0x01, 0x4f, 0xd9, 0x02, 0x6b, 0x75, 0x00, 0x38, 0x94,
+  0x02, 0x6d, 0x6f, 0x01, 0x3a, 0x93, 0x00, 0x03, 0x03, 0x68, 0x73, 0x6f,
+  0x00, 0xb9, 0x0e, 0x01, 0x6e, 0x00, 0xc5, 0x99, 0x02, 0x79, 0x6f, 0x00,
+  0xcc, 0x2f, 0x00, 0x02, 0x02, 0x73, 0x74, 0x01, 0x4f, 0xe9, 0x01, 0x7a,
+  0x00, 0xf4, 0x06, 0x00, 0x08, 0x01, 0x64, 0x01, 0x22, 0x60, 0x03, 0x6b,
+  0x75, 0x73, 0x01, 0x4f, 0xf5, 0x01, 0x6d, 0x00, 0x6f, 0x01, 0x01, 0x6e,
+  0x00, 0x91, 0x71, 0x01, 0x72, 0x01, 0x50, 0x01, 0x03, 0x74, 0x69, 0x6b,
+  0x00, 0x43, 0x08, 0x02, 0x77, 0x61, 0x01, 0x50, 0x0d, 0x04, 0x79, 0x69,
+  0x6d, 0x6f, 0x00, 0x0c, 0x68, 0x00, 0x02, 0x02, 0x6e, 0x6f, 0x01, 0x3a,
+  0xae, 0x03, 0x73, 0x61, 0x79, 0x00, 0x26, 0xd7, 0x00, 0x07, 0x01, 0x61,
+  0x00, 0x9f, 0x52, 0x02, 0x65, 0x73, 0x01, 0x48, 0xfe, 0x02, 0x67, 0x75,
+  0x01, 0x42, 0x21, 0x02, 0x68, 0x73, 0x00, 0x69, 0xfa, 0x05, 0x6b, 0x61,
+  0x73, 0x61, 0x67, 0x00, 0x37, 0xb3, 0x01, 0x6f, 0x00, 0x0e, 0x15, 0x01,
+  0x75, 0x01, 0x50, 0x19, 0x00, 0x03, 0x03, 0x6e, 0x61, 0x64, 0x00, 0x52,
+  0xae, 0x01, 0x73, 0x01, 0x15, 0x2b, 0x01, 0x74, 0x00, 0x43, 0x08, 0x00,
+  0x01, 0x01, 0x6e, 0x01, 0x22, 0x57, 0x00, 0x01, 0x02, 0x69, 0x6a, 0x00,
+  0x83, 0x34, 0x00, 0x02, 0x01, 0x61, 0x01, 0x4e, 0xca, 0x01, 0x69, 0x01,
+  0x38, 0x0d, 0x00, 0x01, 0x01, 0x6b, 0x00, 0x52, 0xae, 0x01, 0x01, 0x01,
+  0x61, 0x00, 0x9f, 0x52, 0x00, 0x01, 0x01, 0x74, 0x01, 0x29, 0x5c, 0x00,
+  0x02, 0x02, 0x69, 0x6d, 0x00, 0xba, 0x97, 0x01, 0x75, 0x00, 0x27, 0x0f,
+  0x00, 0x03, 0x01, 0x61, 0x00, 0x50, 0x30, 0x02, 0x69, 0x6a, 0x01, 0x50,
+  0x20, 0x01, 0x75, 0x00, 0x93, 0x75, 0x00, 0x02, 0x01, 0x65, 0x01, 0x50,
+  0x27, 0x01, 0x6e, 0x00, 0x41, 0x08, 0x00, 0x02, 0x01, 0x68, 0x01, 0x44,
+  0xe5, 0x01, 0x72, 0x00, 0x7f, 0xc0, 0x00, 0x02, 0x01, 0x6b, 0x01, 0x50,
+  0x33, 0x01, 0x6e, 0x00, 0x0d, 0x59, 0x00, 0x01, 0x01, 0x6f, 0x01, 0x0f,
+  0x5c, 0x00, 0x01, 0x01, 0x61, 0x00, 0x93, 0x75, 0x00, 0x01, 0x01, 0x73,
+  0x01, 0x50, 0x3a, 0x00, 0x01, 0x01, 0x6f, 0x01, 0x50, 0x41, 0x00, 0x02,
+  0x01, 0x61, 0x01, 0x50, 0x48, 0x03, 0x69, 0x68, 0x73, 0x01, 0x4e, 0xd1,
+  0x00, 0x03, 0x01, 0x61, 0x01, 0x50, 0x54, 0x01, 0x69, 0x01, 0x46, 0x2a,
+  0x03, 0x6f, 0x74, 0x65, 0x01, 0x27, 0x3d, 0x01, 0x01, 0x01, 0x6e, 0x00,
+  0x62, 0x3b, 0x00, 0x03, 0x01, 0x6d, 0x01, 0x50, 0x68, 0x02, 0x74, 0x69,
+  0x00, 0x97, 0x93, 0x01, 0x77, 0x01, 0x3b, 0x06, 0x00, 0x02, 0x02, 0x6a,
+  0x69, 0x00, 0x9f, 0x52, 0x01, 0x6b, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x01,
+  0x61, 0x00, 0x40, 0xf1, 0x01, 0x69, 0x01, 0x26, 0xa1, 0x00, 0x02, 0x04,
+  0x61, 0x6b, 0x61, 0x6e, 0x01, 0x50, 0x6f, 0x01, 0x69, 0x01, 0x2b, 0xe0,
+  0x00, 0x02, 0x01, 0x61, 0x01, 0x41, 0xd9, 0x01, 0x65, 0x00, 0x52, 0xae,
+  0x00, 0x02, 0x01, 0x61, 0x01, 0x4c, 0xf8, 0x01, 0x75, 0x00, 0x39, 0x0e,
+  0x00, 0x02, 0x01, 0x61, 0x01, 0x50, 0x76, 0x01, 0x69, 0x00, 0x38, 0xd2,
+  0x00, 0x02, 0x01, 0x65, 0x00, 0x12, 0x22, 0x01, 0x6b, 0x00, 0x0e, 0x15,
+  0x00, 0x01, 0x01, 0x67, 0x01, 0x0e, 0xf2, 0x00, 0x02, 0x01, 0x61, 0x00,
+  0x8d, 0xab, 0x04, 0x63, 0x69, 0x61, 0x6b, 0x00, 0x5d, 0x1e, 0x00, 0x02,
+  0x01, 0x61, 0x01, 0x50, 0x82, 0x01, 0x69, 0x00, 0x43, 0x6a, 0x00, 0x03,
+  0x01, 0x61, 0x01, 0x3c, 0x02, 0x04, 0x69, 0x68, 0x73, 0x65, 0x00, 0x93,
+  0x75, 0x01, 0x6f, 0x01, 0x50, 0x93, 0x00, 0x02, 0x01, 0x68, 0x01, 0x50,
+  0x9f, 0x01, 0x79, 0x01, 0x22, 0x60, 0x00, 0x02, 0x01, 0x61, 0x00, 0x6a,
+  0x4b, 0x01, 0x69, 0x01, 0x48, 0xa9, 0x00, 0x01, 0x01, 0x6d, 0x00, 0x80,
+  0x9d, 0x00, 0x01, 0x01, 0x73, 0x00, 0xe7, 0x3a, 0x00, 0x03, 0x01, 0x61,
+  0x01, 0x07, 0xd8, 0x01, 0x68, 0x00, 0x41, 0x08, 0x01, 0x75, 0x00, 0x39,
+  0x91, 0x00, 0x01, 0x02, 0x75, 0x73, 0x01, 0x50, 0xad, 0x00, 0x02, 0x01,
+  0x61, 0x00, 0x0e, 0x15, 0x06, 0x69, 0x68, 0x73, 0x6f, 0x6e, 0x69, 0x01,
+  0x50, 0xb4, 0x00, 0x01, 0x01, 0x61, 0x01, 0x33, 0x3e, 0x00, 0x01, 0x01,
+  0x61, 0x01, 0x50, 0x41, 0x00, 0x02, 0x01, 0x61, 0x00, 0xb2, 0xfd, 0x01,
+  0x75, 0x01, 0x50, 0xc0, 0x00, 0x01, 0x01, 0x6b, 0x00, 0x68, 0x09, 0x00,
+  0x02, 0x01, 0x6b, 0x00, 0x45, 0xa6, 0x02, 0x7a, 0x69, 0x01, 0x50, 0xc7,
+  0x00, 0x01, 0x01, 0x61, 0x00, 0xf5, 0x3a, 0x00, 0x01, 0x01, 0x61, 0x01,
+  0x43, 0x77, 0x00, 0x01, 0x01, 0x68, 0x00, 0x45, 0xa6, 0x00, 0x02, 0x01,
+  0x61, 0x00, 0x74, 0x0f, 0x01, 0x6f, 0x00, 0x0f, 0x6f, 0x00, 0x01, 0x01,
+  0x69, 0x00, 0x42, 0x3c, 0x00, 0x02, 0x01, 0x61, 0x01, 0x50, 0xd3, 0x01,
+  0x69, 0x01, 0x44, 0x03, 0x00, 0x02, 0x02, 0x61, 0x73, 0x01, 0x50, 0xe7,
+  0x01, 0x69, 0x00, 0x38, 0xd2, 0x00, 0x02, 0x01, 0x69, 0x01, 0x50, 0xf3,
+  0x01, 0x75, 0x00, 0x35, 0x0c, 0x00, 0x01, 0x02, 0x61, 0x77, 0x00, 0x2a,
+  0x10, 0x00, 0x03, 0x01, 0x64, 0x00, 0x6d, 0x8e, 0x01, 0x6d, 0x01, 0x50,
+  0xff, 0x01, 0x77, 0x00, 0x68, 0x09, 0x00, 0x02, 0x02, 0x63, 0x75, 0x00,
+  0x27, 0x41, 0x02, 0x73, 0x69, 0x01, 0x51, 0x06, 0x00, 0x02, 0x01, 0x6f,
+  0x00, 0x8d, 0x85, 0x01, 0x75, 0x00, 0x35, 0x0c, 0x00, 0x02, 0x01, 0x61,
+  0x01, 0x51, 0x13, 0x02, 0x65, 0x73, 0x01, 0x48, 0x51, 0x00, 0x02, 0x02,
+  0x61, 0x6b, 0x01, 0x51, 0x22, 0x04, 0x75, 0x7a, 0x69, 0x61, 0x01, 0x51,
+  0x29, 0x00, 0x02, 0x01, 0x72, 0x00, 0x7f, 0xc0, 0x01, 0x74, 0x00, 0x0e,
+  0x15, 0x00, 0x03, 0x01, 0x61, 0x01, 0x51, 0x35, 0x08, 0x69, 0x68, 0x73,
+  0x75, 0x73, 0x74, 0x61, 0x6d, 0x01, 0x38, 0x32, 0x02, 0x75, 0x6e, 0x01,
+  0x3c, 0xb5, 0x00, 0x02, 0x02, 0x61, 0x77, 0x01, 0x51, 0x41, 0x01, 0x69,
+  0x01, 0x4e, 0x40, 0x00, 0x02, 0x01, 0x62, 0x00, 0x26, 0xfa, 0x01, 0x72,
+  0x00, 0x2b, 0x73, 0x00, 0x02, 0x01, 0x61, 0x01, 0x51, 0x48, 0x01, 0x69,
+  0x00, 0x43, 0x6a, 0x00, 0x02, 0x01, 0x69, 0x01, 0x2b, 0xe0, 0x01, 0x75,
+  0x01, 0x26, 0x8c, 0x00, 0x01, 0x01, 0x6d, 0x00, 0x25, 0x56, 0x00, 0x01,
+  0x01, 0x69, 0x01, 0x51, 0x54, 0x00, 0x02, 0x03, 0x6d, 0x6f, 0x6e, 0x01,
+  0x50, 0x33, 0x01, 0x73, 0x01, 0x51, 0x5b, 0x00, 0x02, 0x01, 0x61, 0x00,
+  0x85, 0x18, 0x01, 0x6f, 0x01, 0x51, 0x67, 0x00, 0x02, 0x01, 0x61, 0x00,
+  0xf5, 0x3a, 0x02, 0x6f, 0x6d, 0x00, 0x43, 0x08, 0x00, 0x02, 0x05, 0x69,
+  0x72, 0x6e, 0x61, 0x73, 0x01, 0x32, 0x82, 0x08, 0x75, 0x68, 0x73, 0x61,
+  0x6b, 0x69, 0x68, 0x63, 0x00, 0x26, 0xfa, 0x00, 0x02, 0x01, 0x61, 0x01,
+  0x51, 0x73, 0x01, 0x75, 0x00, 0x84, 0x96, 0x00, 0x02, 0x02, 0x61, 0x79,
+  0x01, 0x51, 0x80, 0x01, 0x75, 0x01, 0x32, 0xfa, 0x00, 0x03, 0x01, 0x61,
+  0x01, 0x51, 0x8c, 0x01, 0x69, 0x01, 0x4e, 0x40, 0x01, 0x75, 0x01, 0x26,
+  0x93, 0x00, 0x02, 0x01, 0x61, 0x01, 0x51, 0xa0, 0x01, 0x69, 0x00, 0x45,
+  0xa6, 0x00, 0x02, 0x02, 0x6b, 0x6f, 0x01, 0x51, 0xa7, 0x02, 0x7a, 0x65,
+  0x01, 0x41, 0x4b, 0x00, 0x02, 0x06, 0x69, 0x6d, 0x6f, 0x6e, 0x75, 0x73,
+  0x00, 0xd9, 0x43, 0x01, 0x6f, 0x00, 0x26, 0xfa, 0x00, 0x01, 0x02, 0x69,
+  0x6a, 0x00, 0x5d, 0xbc, 0x00, 0x01, 0x02, 0x73, 0x74, 0x01, 0x3b, 0x1b,
+  0x00, 0x01, 0x01, 0x6b, 0x01, 0x51, 0xae, 0x00, 0x03, 0x01, 0x65, 0x00,
+  0xec, 0xba, 0x01, 0x69, 0x01, 0x4e, 0xf8, 0x01, 0x6f, 0x00, 0x0f, 0x6f,
+  0x00, 0x02, 0x01, 0x69, 0x01, 0x42, 0x81, 0x01, 0x6b, 0x00, 0x27, 0x25,
+  0x00, 0x01, 0x01, 0x69, 0x01, 0x49, 0xf9, 0x00, 0x06, 0x01, 0x64, 0x00,
+  0x22, 0x1f, 0x01, 0x6d, 0x01, 0x51, 0xb6, 0x01, 0x72, 0x01, 0x51, 0xc4,
+  0x01, 0x74, 0x01, 0x51, 0xd5, 0x02, 0x77, 0x61, 0x01, 0x51, 0xe1, 0x02,
+  0x79, 0x69, 0x01, 0x51, 0xed, 0x00, 0x04, 0x01, 0x69, 0x01, 0x32, 0xfa,
+  0x01, 0x6b, 0x01, 0x51, 0xf9, 0x03, 0x6d, 0x61, 0x6e, 0x01, 0x52, 0x05,
+  0x01, 0x6e, 0x01, 0x48, 0xe4, 0x00, 0x06, 0x01, 0x61, 0x01, 0x52, 0x0c,
+  0x01, 0x65, 0x00, 0x46, 0x7c, 0x01, 0x68, 0x01, 0x52, 0x1d, 0x01, 0x6b,
+  0x01, 0x52, 0x32, 0x02, 0x6d, 0x6f, 0x01, 0x50, 0xad, 0x04, 0x72, 0x6f,
+  0x67, 0x61, 0x00, 0x91, 0x52, 0x00, 0x02, 0x02, 0x61, 0x6e, 0x01, 0x52,
+  0x3f, 0x03, 0x69, 0x68, 0x73, 0x00, 0x40, 0x21, 0x00, 0x06, 0x01, 0x67,
+  0x00, 0x46, 0x7c, 0x01, 0x69, 0x01, 0x42, 0x8f, 0x01, 0x6a, 0x00, 0x71,
+  0x52, 0x01, 0x72, 0x01, 0x52, 0x4c, 0x01, 0x73, 0x00, 0x6d, 0x8e, 0x01,
+  0x74, 0x00, 0x25, 0x56, 0x00, 0x05, 0x01, 0x62, 0x00, 0x41, 0x08, 0x02,
+  0x72, 0x61, 0x01, 0x4e, 0x40, 0x01, 0x73, 0x01, 0x52, 0x55, 0x01, 0x79,
+  0x01, 0x10, 0x16, 0x01, 0x7a, 0x00, 0x52, 0xae, 0x00, 0x06, 0x01, 0x64,
+  0x01, 0x44, 0x2e, 0x01, 0x6b, 0x01, 0x52, 0x62, 0x03, 0x6d, 0x61, 0x79,
+  0x00, 0xbc, 0x86, 0x01, 0x72, 0x01, 0x52, 0x69, 0x03, 0x73, 0x6f, 0x74,
+  0x01, 0x27, 0x2f, 0x02, 0x77, 0x61, 0x01, 0x52, 0x76, 0x00, 0x06, 0x03,
+  0x65, 0x73, 0x69, 0x00, 0x64, 0x65, 0x03, 0x68, 0x63, 0x6f, 0x00, 0x2c,
+  0x2d, 0x02, 0x6a, 0x61, 0x01, 0x15, 0x24, 0x01, 0x6b, 0x01, 0x52, 0x82,
+  0x02, 0x6d, 0x61, 0x01, 0x52, 0x8e, 0x03, 0x72, 0x61, 0x68, 0x00, 0x29,
+  0x66, 0x00, 0x04, 0x02, 0x6d, 0x75, 0x01, 0x52, 0x9a, 0x01, 0x6e, 0x01,
+  0x52, 0xa1, 0x01, 0x74, 0x01, 0x43, 0x13, 0x03, 0x79, 0x6f, 0x74, 0x01,
+  0x15, 0x32, 0x00, 0x02, 0x03, 0x6b, 0x6f, 0x6b, 0x01, 0x1a, 0x59, 0x07,
+  0x7a, 0x69, 0x6d, 0x69, 0x68, 0x73, 0x61, 0x00, 0x26, 0x5a, 0x00, 0x02,
+  0x01, 0x6d, 0x01, 0x52, 0xaf, 0x01, 0x74, 0x01, 0x48, 0xe4, 0x00, 0x02,
+  0x01, 0x62, 0x00, 0x5d, 0xbc, 0x02, 0x73, 0x75, 0x00, 0xcc, 0xe7, 0x00,
+  0x04, 0x01, 0x67, 0x00, 0x52, 0xae, 0x04, 0x6b, 0x65, 0x73, 0x6f, 0x01,
+  0x4d, 0xe6, 0x03, 0x6e, 0x75, 0x6b, 0x01, 0x3c, 0xb5, 0x01, 0x72, 0x01,
+  0x3c, 0x3a, 0x00, 0x01, 0x01, 0x74, 0x01, 0x45, 0x11, 0x00, 0x05, 0x01,
+  0x62, 0x00, 0x26, 0xd7, 0x01, 0x66, 0x00, 0x32, 0x5a, 0x01, 0x6f, 0x00,
+  0xcc, 0x2f, 0x05, 0x73, 0x74, 0x61, 0x6d, 0x61, 0x01, 0x52, 0xbd, 0x01,
+  0x75, 0x00, 0x26, 0xf3, 0x00, 0x04, 0x06, 0x64, 0x69, 0x68, 0x73, 0x6f,
+  0x79, 0x01, 0x40, 0xa2, 0x04, 0x6d, 0x61, 0x79, 0x61, 0x00, 0xcc, 0xe7,
+  0x01, 0x72, 0x01, 0x52, 0xc4, 0x01, 0x77, 0x01, 0x52, 0xd7, 0x00, 0x03,
+  0x01, 0x61, 0x00, 0x35, 0x0c, 0x01, 0x68, 0x01, 0x52, 0xe3, 0x01, 0x6b,
+  0x01, 0x52, 0xf0, 0x00, 0x04, 0x01, 0x6b, 0x01, 0x52, 0xff, 0x02, 0x6e,
+  0x69, 0x01, 0x23, 0x20, 0x01, 0x74, 0x01, 0x53, 0x15, 0x01, 0x75, 0x00,
+  0x46, 0x83, 0x00, 0x04, 0x01, 0x62, 0x01, 0x53, 0x27, 0x01, 0x66, 0x00,
+  0x41, 0xf9, 0x01, 0x68, 0x01, 0x33, 0x4c, 0x01, 0x72, 0x01, 0x37, 0x82,
+  0x00, 0x01, 0x01, 0x75, 0x01, 0x50, 0x19, 0x01, 0x01, 0x01, 0x69, 0x01,
+  0x53, 0x33, 0x00, 0x03, 0x01, 0x61, 0x01, 0x53, 0x3b, 0x01, 0x69, 0x01,
+  0x48, 0x43, 0x01, 0x75, 0x01, 0x3e, 0x04, 0x00, 0x02, 0x01, 0x61, 0x01,
+  0x53, 0x4c, 0x01, 0x75, 0x01, 0x53, 0x58, 0x00, 0x02, 0x02, 0x61, 0x67,
+  0x01, 0x53, 0x69, 0x01, 0x6f, 0x01, 0x53, 0x75, 0x00, 0x02, 0x02, 0x61,
+  0x67, 0x01, 0x53, 0x7c, 0x01, 0x6f, 0x00, 0x27, 0x0f, 0x00, 0x02, 0x02,
+  0x6d, 0x6f, 0x01, 0x53, 0x75, 0x01, 0x72, 0x00, 0x64, 0xb6, 0x00, 0x02,
+  0x01, 0x6b, 0x01, 0x53, 0x89, 0x01, 0x72, 0x01, 0x48, 0x7e, 0x00, 0x01,
+  0x01, 0x73, 0x01, 0x44, 0xde, 0x00, 0x02, 0x01, 0x61, 0x00, 0x8d, 0xab,
+  0x01, 0x63, 0x01, 0x53, 0x95, 0x00, 0x03, 0x01, 0x61, 0x01, 0x53, 0x9c,
+  0x03, 0x69, 0x68, 0x73, 0x01, 0x2b, 0x5e, 0x01, 0x75, 0x00, 0x26, 0xf3,
+  0x00, 0x01, 0x01, 0x69, 0x00, 0x1e, 0x59, 0x00, 0x01, 0x01, 0x61, 0x00,
+  0x98, 0x97, 0x00, 0x01, 0x01, 0x69, 0x01, 0x44, 0xaa, 0x00, 0x02, 0x02,
+  0x61, 0x73, 0x01, 0x51, 0x54, 0x01, 0x69, 0x00, 0x12, 0x22, 0x00, 0x05,
+  0x01, 0x6d, 0x01, 0x53, 0xaa, 0x03, 0x6e, 0x61, 0x74, 0x01, 0x0e, 0xf2,
+  0x01, 0x72, 0x01, 0x53, 0xb8, 0x03, 0x77, 0x69, 0x6a, 0x00, 0x37, 0xb3,
+  0x03, 0x79, 0x61, 0x68, 0x00, 0xfd, 0x89, 0x00, 0x04, 0x02, 0x61, 0x6b,
+  0x01, 0x02, 0x04, 0x01, 0x68, 0x00, 0xef, 0x94, 0x01, 0x6b, 0x01, 0x53,
+  0xc5, 0x02, 0x6d, 0x61, 0x00, 0xcc, 0x28, 0x00, 0x03, 0x02, 0x62, 0x65,
+  0x01, 0x00, 0x8b, 0x01, 0x64, 0x01, 0x41, 0xa2, 0x01, 0x74, 0x01, 0x53,
+  0xd2, 0x00, 0x03, 0x01, 0x69, 0x00, 0xc5, 0x92, 0x05, 0x6f, 0x6e, 0x69,
+  0x68, 0x63, 0x00, 0x80, 0x9d, 0x01, 0x75, 0x00, 0x16, 0x9c, 0x00, 0x02,
+  0x02, 0x6f, 0x65, 0x01, 0x0b, 0x87, 0x04, 0x75, 0x73, 0x74, 0x6f, 0x00,
+  0x42, 0x3c, 0x00, 0x02, 0x02, 0x65, 0x6d, 0x01, 0x44, 0xe5, 0x01, 0x75,
+  0x01, 0x51, 0x22, 0x00, 0x02, 0x01, 0x6b, 0x01, 0x51, 0x22, 0x01, 0x6d,
+  0x00, 0x39, 0x28, 0x00, 0x02, 0x01, 0x61, 0x00, 0x40, 0xf1, 0x01, 0x6f,
+  0x01, 0x49, 0x0c, 0x00, 0x01, 0x01, 0x6e, 0x01, 0x29, 0x63, 0x00, 0x02,
+  0x01, 0x6b, 0x00, 0x43, 0x6a, 0x01, 0x79, 0x00, 0x39, 0x28, 0x00, 0x02,
+  0x04, 0x61, 0x6e, 0x69, 0x6d, 0x01, 0x0e, 0xf2, 0x02, 0x6f, 0x74, 0x01,
+  0x53, 0xdf, 0x00, 0x02, 0x01, 0x69, 0x00, 0x35, 0x0c, 0x04, 0x6f, 0x6e,
+  0x6f, 0x6b, 0x01, 0x37, 0xd9, 0x00, 0x02, 0x01, 0x69, 0x00, 0xc6, 0x65,
+  0x01, 0x75, 0x00, 0x84, 0x96, 0x00, 0x04, 0x03, 0x69, 0x68, 0x63, 0x01,
+  0x53, 0xeb, 0x01, 0x6e, 0x00, 0x1c, 0x65, 0x01, 0x6f, 0x00, 0x0c, 0x1d,
+  0x02, 0x75, 0x6b, 0x00, 0x83, 0x0e, 0x00, 0x01, 0x01, 0x61, 0x01, 0x27,
+  0xcc, 0x00, 0x01, 0x01, 0x61, 0x00, 0x70, 0xc4, 0x00, 0x02, 0x04, 0x61,
+  0x6d, 0x6f, 0x64, 0x01, 0x4d, 0xf4, 0x02, 0x6f, 0x6d, 0x01, 0x14, 0x53,
+  0x00, 0x02, 0x02, 0x61, 0x68, 0x01, 0x0e, 0xf2, 0x01, 0x75, 0x01, 0x4f,
+  0xc5, 0x00, 0x02, 0x01, 0x6b, 0x00, 0x83, 0x34, 0x01, 0x73, 0x00, 0x39,
+  0x28, 0x00, 0x01, 0x01, 0x6e, 0x00, 0x62, 0x3b, 0x00, 0x02, 0x01, 0x61,
+  0x00, 0x26, 0xf3, 0x01, 0x69, 0x00, 0x46, 0x83, 0x00, 0x02, 0x01, 0x61,
+  0x01, 0x27, 0x3d, 0x01, 0x69, 0x00, 0x12, 0x22, 0x00, 0x01, 0x01, 0x75,
+  0x01, 0x53, 0xf7, 0x00, 0x01, 0x01, 0x61, 0x00, 0x85, 0x88, 0x00, 0x02,
+  0x01, 0x66, 0x00, 0x5f, 0x90, 0x01, 0x6e, 0x01, 0x53, 0xfe, 0x00, 0x02,
+  0x04, 0x6f, 0x72, 0x69, 0x68, 0x01, 0x51, 0x22, 0x01, 0x75, 0x01, 0x26,
+  0x9a, 0x00, 0x01, 0x01, 0x73, 0x00, 0x28, 0xce, 0x00, 0x03, 0x01, 0x61,
+  0x01, 0x54, 0x05, 0x01, 0x6f, 0x00, 0x0e, 0x15, 0x01, 0x75, 0x00, 0xc9,
+  0x18, 0x00, 0x02, 0x02, 0x67, 0x61, 0x01, 0x45, 0xcb, 0x01, 0x6f, 0x00,
+  0x28, 0xdc, 0x00, 0x01, 0x01, 0x69, 0x01, 0x50, 0x19, 0x00, 0x03, 0x02,
+  0x67, 0x61, 0x01, 0x54, 0x0c, 0x01, 0x6b, 0x01, 0x54, 0x1a, 0x03, 0x7a,
+  0x69, 0x6d, 0x01, 0x3c, 0xb5, 0x00, 0x01, 0x01, 0x79, 0x00, 0x35, 0x0c,
+  0x00, 0x02, 0x01, 0x6b, 0x00, 0x26, 0xfa, 0x01, 0x79, 0x00, 0x68, 0x09,
+  0x00, 0x02, 0x02, 0x6e, 0x6f, 0x01, 0x31, 0x33, 0x01, 0x74, 0x00, 0x41,
+  0x08, 0x00, 0x01, 0x01, 0x68, 0x00, 0x39, 0x91, 0x00, 0x01, 0x01, 0x6f,
+  0x00, 0x5c, 0xe3, 0x00, 0x01, 0x01, 0x68, 0x00, 0x40, 0x21, 0x00, 0x05,
+  0x01, 0x61, 0x01, 0x54, 0x30, 0x02, 0x65, 0x6f, 0x01, 0x48, 0xa9, 0x03,
+  0x69, 0x68, 0x73, 0x00, 0xf4, 0x06, 0x01, 0x6f, 0x00, 0xe9, 0x88, 0x04,
+  0x75, 0x73, 0x74, 0x61, 0x01, 0x54, 0x3c, 0x00, 0x02, 0x01, 0x69, 0x00,
+  0x62, 0x3b, 0x01, 0x75, 0x01, 0x54, 0x48, 0x00, 0x04, 0x01, 0x61, 0x00,
+  0x61, 0xba, 0x02, 0x65, 0x6b, 0x00, 0xb2, 0xfd, 0x02, 0x6f, 0x6b, 0x01,
+  0x06, 0x15, 0x02, 0x75, 0x65, 0x00, 0x56, 0xf1, 0x00, 0x01, 0x01, 0x6d,
+  0x01, 0x3c, 0x41, 0x00, 0x02, 0x01, 0x61, 0x00, 0x16, 0x7b, 0x01, 0x6e,
+  0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x74, 0x01, 0x48, 0xe4, 0x00, 0x03,
+  0x01, 0x68, 0x00, 0x27, 0x0f, 0x01, 0x6b, 0x01, 0x50, 0x33, 0x01, 0x6d,
+  0x00, 0x46, 0x7c, 0x00, 0x02, 0x01, 0x61, 0x00, 0x37, 0xd5, 0x01, 0x69,
+  0x00, 0x1d, 0x1c, 0x00, 0x01, 0x01, 0x6f, 0x01, 0x2e, 0x33, 0x00, 0x01,
+  0x01, 0x6b, 0x00, 0x45, 0xa6, 0x00, 0x02, 0x01, 0x6b, 0x00, 0x0e, 0x15,
+  0x01, 0x6e, 0x00, 0x39, 0x28, 0x00, 0x02, 0x01, 0x69, 0x00, 0x83, 0x6a,
+  0x01, 0x73, 0x00, 0x80, 0x9d, 0x00, 0x04, 0x01, 0x62, 0x00, 0x52, 0xae,
+  0x01, 0x68, 0x01, 0x54, 0x55, 0x01, 0x70, 0x01, 0x1a, 0x59, 0x01, 0x79,
+  0x00, 0x29, 0x66, 0x00, 0x01, 0x01, 0x69, 0x00, 0x27, 0x25, 0x00, 0x02,
+  0x01, 0x69, 0x01, 0x42, 0x88, 0x01, 0x6e, 0x00, 0x80, 0x9d, 0x00, 0x03,
+  0x02, 0x65, 0x62, 0x01, 0x54, 0x61, 0x02, 0x6f, 0x6e, 0x01, 0x52, 0x4c,
+  0x03, 0x75, 0x66, 0x75, 0x00, 0xe4, 0xad, 0x00, 0x01, 0x01, 0x6d, 0x00,
+  0x43, 0x6a, 0x00, 0x01, 0x01, 0x75, 0x00, 0x9f, 0xdd, 0x00, 0x03, 0x01,
+  0x61, 0x00, 0x16, 0x7b, 0x01, 0x6f, 0x01, 0x54, 0x82, 0x04, 0x75, 0x7a,
+  0x61, 0x72, 0x01, 0x29, 0x63, 0x00, 0x02, 0x02, 0x61, 0x79, 0x01, 0x54,
+  0x8e, 0x01, 0x69, 0x01, 0x54, 0x95, 0x00, 0x02, 0x01, 0x67, 0x01, 0x54,
+  0x9c, 0x01, 0x6b, 0x01, 0x54, 0xa8, 0x00, 0x02, 0x01, 0x68, 0x00, 0x8d,
+  0xab, 0x01, 0x6d, 0x01, 0x54, 0xb4, 0x00, 0x02, 0x01, 0x61, 0x00, 0xb2,
+  0xfd, 0x01, 0x69, 0x01, 0x54, 0xbc, 0x00, 0x02, 0x03, 0x61, 0x77, 0x61,
+  0x01, 0x0c, 0x41, 0x01, 0x65, 0x01, 0x54, 0xc8, 0x00, 0x02, 0x01, 0x61,
+  0x01, 0x54, 0xcf, 0x01, 0x69, 0x01, 0x54, 0xe0, 0x01, 0x01, 0x01, 0x6b,
+  0x00, 0x43, 0x6a, 0x00, 0x03, 0x01, 0x69, 0x01, 0x27, 0x3d, 0x01, 0x6f,
+  0x00, 0x0e, 0x15, 0x01, 0x75, 0x01, 0x44, 0xd7, 0x00, 0x01, 0x01, 0x68,
+  0x01, 0x50, 0xc0, 0x00, 0x01, 0x01, 0x6d, 0x00, 0x13, 0x5b, 0x00, 0x02,
+  0x01, 0x77, 0x00, 0x0e, 0x15, 0x01, 0x79, 0x00, 0x39, 0x28, 0x00, 0x02,
+  0x01, 0x6b, 0x00, 0x2a, 0x10, 0x01, 0x75, 0x00, 0x0e, 0x15, 0x00, 0x02,
+  0x01, 0x73, 0x01, 0x54, 0xec, 0x01, 0x7a, 0x00, 0x13, 0x5b, 0x00, 0x01,
+  0x01, 0x75, 0x01, 0x50, 0xc0, 0x00, 0x02, 0x01, 0x61, 0x01, 0x27, 0x3d,
+  0x01, 0x69, 0x00, 0x2a, 0x10, 0x00, 0x02, 0x06, 0x68, 0x73, 0x75, 0x6b,
+  0x75, 0x66, 0x01, 0x54, 0xf8, 0x01, 0x6a, 0x01, 0x4e, 0x80, 0x00, 0x01,
+  0x01, 0x6b, 0x00, 0x37, 0xb3, 0x01, 0x01, 0x02, 0x68, 0x73, 0x01, 0x4d,
+  0xed, 0x00, 0x01, 0x01, 0x7a, 0x01, 0x4e, 0x80, 0x00, 0x01, 0x01, 0x79,
+  0x00, 0x39, 0x28, 0x00, 0x03, 0x01, 0x67, 0x01, 0x54, 0xff, 0x01, 0x6b,
+  0x01, 0x22, 0x60, 0x02, 0x7a, 0x69, 0x01, 0x50, 0xff, 0x00, 0x02, 0x01,
+  0x6b, 0x00, 0xfd, 0xac, 0x01, 0x73, 0x01, 0x55, 0x0b, 0x00, 0x02, 0x01,
+  0x61, 0x01, 0x55, 0x12, 0x01, 0x75, 0x01, 0x4e, 0x79, 0x00, 0x03, 0x01,
+  0x6b, 0x00, 0x1c, 0x65, 0x01, 0x6d, 0x01, 0x32, 0x82, 0x01, 0x74, 0x00,
+  0x41, 0x08, 0x00, 0x01, 0x01, 0x6a, 0x00, 0x6d, 0x8e, 0x00, 0x01, 0x01,
+  0x6f, 0x00, 0x26, 0xfa, 0x00, 0x01, 0x01, 0x6d, 0x01, 0x29, 0x63, 0x00,
+  0x02, 0x01, 0x67, 0x00, 0x29, 0x66, 0x01, 0x6b, 0x00, 0x29, 0x66, 0x00,
+  0x02, 0x01, 0x68, 0x00, 0x0f, 0xfa, 0x01, 0x6d, 0x01, 0x2c, 0x85, 0x00,
+  0x01, 0x01, 0x73, 0x00, 0x45, 0xad, 0x00, 0x01, 0x01, 0x75, 0x01, 0x44,
+  0x52, 0x00, 0x01, 0x01, 0x69, 0x01, 0x42, 0x8f, 0x01, 0x01, 0x01, 0x69,
+  0x01, 0x48, 0xa9, 0x00, 0x02, 0x01, 0x69, 0x01, 0x42, 0x81, 0x01, 0x75,
+  0x00, 0x0e, 0x15, 0x00, 0x03, 0x01, 0x61, 0x00, 0x74, 0x0f, 0x02, 0x6f,
+  0x6d, 0x01, 0x55, 0x1a, 0x01, 0x75, 0x01, 0x55, 0x26, 0x00, 0x01, 0x01,
+  0x61, 0x00, 0x0d, 0x6e, 0x00, 0x01, 0x03, 0x61, 0x74, 0x6f, 0x01, 0x42,
+  0x61, 0x00, 0x03, 0x01, 0x69, 0x00, 0x25, 0x56, 0x02, 0x6f, 0x65, 0x01,
+  0x48, 0xa9, 0x02, 0x75, 0x7a, 0x00, 0x83, 0x34, 0x00, 0x02, 0x01, 0x68,
+  0x01, 0x55, 0x2e, 0x01, 0x6d, 0x00, 0x80, 0x9d, 0x00, 0x02, 0x01, 0x61,
+  0x01, 0x55, 0x3a, 0x01, 0x69, 0x00, 0x35, 0x0c, 0x00, 0x02, 0x03, 0x6e,
+  0x61, 0x74, 0x01, 0x55, 0x41, 0x01, 0x79, 0x00, 0x26, 0xd7, 0x00, 0x03,
+  0x01, 0x67, 0x01, 0x4d, 0xf4, 0x02, 0x6b, 0x61, 0x01, 0x55, 0x48, 0x01,
+  0x6f, 0x00, 0x16, 0xb8, 0x00, 0x02, 0x01, 0x61, 0x01, 0x44, 0x68, 0x01,
+  0x69, 0x00, 0x35, 0x0c, 0x00, 0x02, 0x01, 0x68, 0x00, 0xec, 0x00, 0x01,
+  0x6d, 0x00, 0x13, 0x5b, 0x00, 0x02, 0x01, 0x74, 0x01, 0x55, 0x55, 0x09,
+  0x79, 0x61, 0x72, 0x75, 0x6d, 0x69, 0x68, 0x73, 0x61, 0x01, 0x55, 0x5c,
+  0x00, 0x02, 0x02, 0x68, 0x73, 0x01, 0x55, 0x68, 0x01, 0x72, 0x00, 0x22,
+  0x26, 0x00, 0x02, 0x01, 0x68, 0x01, 0x2b, 0x41, 0x03, 0x77, 0x61, 0x73,
+  0x01, 0x51, 0x41, 0x00, 0x02, 0x01, 0x61, 0x01, 0x27, 0xff, 0x01, 0x6f,
+  0x00, 0x27, 0x3a, 0x00, 0x02, 0x01, 0x61, 0x00, 0x44, 0x12, 0x01, 0x69,
+  0x01, 0x55, 0x80, 0x00, 0x01, 0x01, 0x6b, 0x01, 0x33, 0x5a, 0x00, 0x01,
+  0x01, 0x79, 0x00, 0x16, 0x89, 0x00, 0x02, 0x01, 0x64, 0x00, 0x26, 0xd7,
+  0x01, 0x74, 0x01, 0x55, 0x88, 0x00, 0x01, 0x01, 0x6b, 0x00, 0x41, 0xf9,
+  0x00, 0x01, 0x01, 0x7a, 0x00, 0x39, 0x28, 0x01, 0x01, 0x02, 0x73, 0x61,
+  0x00, 0xce, 0xfa, 0x00, 0x02, 0x02, 0x6d, 0x61, 0x01, 0x49, 0x2b, 0x01,
+  0x6e, 0x00, 0x39, 0x28, 0x00, 0x01, 0x01, 0x79, 0x01, 0x29, 0x63, 0x00,
+  0x02, 0x01, 0x6b, 0x00, 0x25, 0x56, 0x02, 0x6d, 0x61, 0x01, 0x3c, 0x54,
+  0x00, 0x02, 0x01, 0x69, 0x01, 0x55, 0x8f, 0x03, 0x75, 0x73, 0x74, 0x01,
+  0x4d, 0xf4, 0x00, 0x01, 0x01, 0x67, 0x00, 0x41, 0x08, 0x00, 0x01, 0x01,
+  0x6a, 0x00, 0x43, 0x6a, 0x00, 0x02, 0x02, 0x61, 0x6d, 0x01, 0x55, 0x96,
+  0x01, 0x6f, 0x00, 0x45, 0xa6, 0x00, 0x02, 0x01, 0x61, 0x00, 0x1d, 0x34,
+  0x01, 0x65, 0x00, 0x35, 0x51, 0x00, 0x03, 0x01, 0x63, 0x00, 0x36, 0xd0,
+  0x01, 0x6c, 0x00, 0x28, 0xce, 0x02, 0x73, 0x6a, 0x00, 0x0f, 0x6f, 0x00,
+  0x01, 0x01, 0x6f, 0x01, 0x46, 0x6a, 0x00, 0x01, 0x03, 0x69, 0x67, 0x67,
+  0x00, 0x29, 0xdf, 0x00, 0x01, 0x03, 0x6c, 0x75, 0x69, 0x00, 0x87, 0xcc,
+  0x00, 0x01, 0x01, 0x2d, 0x01, 0x2d, 0x46, 0x00, 0x01, 0x01, 0x73, 0x00,
+  0x39, 0x91, 0x00, 0x01, 0x01, 0x69, 0x01, 0x46, 0x91, 0x00, 0x01, 0x01,
+  0x74, 0x01, 0x14, 0x22, 0x00, 0x01, 0x01, 0x73, 0x01, 0x55, 0x9d, 0x00,
+  0x02, 0x01, 0x6e, 0x01, 0x55, 0xae, 0x01, 0x6f, 0x01, 0x2d, 0xbd, 0x00,
+  0x02, 0x01, 0x67, 0x00, 0x61, 0xb3, 0x01, 0x76, 0x00, 0xfa, 0xa6, 0x00,
+  0x01, 0x01, 0x2d, 0x00, 0x30, 0x72, 0x00, 0x02, 0x01, 0x2d, 0x01, 0x55,
+  0xc1, 0x01, 0x68, 0x01, 0x46, 0xde, 0x00, 0x03, 0x01, 0x73, 0x00, 0x5d,
+  0xbc, 0x01, 0x75, 0x00, 0x1d, 0x34, 0x04, 0x76, 0x6f, 0x67, 0x2d, 0x00,
+  0xc6, 0x93, 0x00, 0x01, 0x01, 0x74, 0x01, 0x55, 0xcd, 0x00, 0x02, 0x01,
+  0x73, 0x00, 0x5d, 0xbc, 0x01, 0x75, 0x00, 0x1d, 0x34, 0x00, 0x01, 0x01,
+  0x2e, 0x01, 0x55, 0xd9, 0x00, 0x01, 0x01, 0x61, 0x01, 0x2f, 0x4a, 0x00,
+  0x03, 0x02, 0x61, 0x73, 0x01, 0x47, 0x20, 0x01, 0x70, 0x01, 0x2f, 0x74,
+  0x02, 0x73, 0x75, 0x01, 0x55, 0xe0, 0x00, 0x02, 0x03, 0x72, 0x6f, 0x6e,
+  0x01, 0x55, 0xed, 0x01, 0x75, 0x01, 0x47, 0x51, 0x00, 0x02, 0x01, 0x2d,
+  0x01, 0x55, 0xf6, 0x01, 0x2e, 0x01, 0x56, 0x02, 0x00, 0x02, 0x01, 0x33,
+  0x00, 0x27, 0x0f, 0x04, 0x73, 0x70, 0x69, 0x66, 0x00, 0xf4, 0xbc, 0x00,
+  0x04, 0x01, 0x33, 0x00, 0x27, 0x0f, 0x01, 0x39, 0x01, 0x56, 0x0e, 0x01,
+  0x65, 0x00, 0xc7, 0xa5, 0x01, 0x6b, 0x01, 0x56, 0x1b, 0x00, 0x01, 0x02,
+  0x6f, 0x73, 0x01, 0x55, 0xed, 0x00, 0x02, 0x01, 0x2d, 0x01, 0x55, 0xf6,
+  0x01, 0x2e, 0x01, 0x55, 0xd9, 0x01, 0x01, 0x04, 0x6c, 0x61, 0x69, 0x6e,
+  0x00, 0x31, 0x0c, 0x00, 0x02, 0x01, 0x69, 0x00, 0x6f, 0x98, 0x03, 0x75,
+  0x64, 0x65, 0x01, 0x19, 0xdf, 0x00, 0x02, 0x01, 0x63, 0x00, 0x4c, 0x38,
+  0x01, 0x76, 0x00, 0x26, 0xd7, 0x00, 0x03, 0x09, 0x62, 0x65, 0x6c, 0x65,
+  0x63, 0x74, 0x73, 0x65, 0x76, 0x01, 0x54, 0x95, 0x02, 0x6f, 0x70, 0x00,
+  0x5c, 0xc5, 0x04, 0x74, 0x73, 0x75, 0x6c, 0x01, 0x03, 0xee, 0x00, 0x01,
+  0x01, 0x69, 0x01, 0x56, 0x29, 0x00, 0x02, 0x01, 0x6e, 0x00, 0xb9, 0x62,
+  0x01, 0x73, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x01, 0x65, 0x00, 0x13, 0x4d,
+  0x0a, 0x6e, 0x6f, 0x63, 0x6c, 0x61, 0x74, 0x6e, 0x65, 0x6d, 0x6e, 0x01,
+  0x19, 0xa2, 0x00, 0x02, 0x06, 0x74, 0x73, 0x65, 0x76, 0x6e, 0x69, 0x01,
+  0x31, 0xa9, 0x01, 0x76, 0x00, 0x29, 0x66, 0x00, 0x02, 0x05, 0x63, 0x6f,
+  0x73, 0x73, 0x61, 0x01, 0x56, 0x30, 0x02, 0x76, 0x61, 0x01, 0x56, 0x29,
+  0x00, 0x02, 0x03, 0x69, 0x61, 0x74, 0x00, 0xc4, 0xc9, 0x02, 0x72, 0x65,
+  0x00, 0x2c, 0x1e, 0x00, 0x02, 0x01, 0x72, 0x01, 0x45, 0x11, 0x01, 0x74,
+  0x00, 0x43, 0x6a, 0x00, 0x03, 0x01, 0x62, 0x00, 0x64, 0xb6, 0x01, 0x67,
+  0x00, 0x29, 0x66, 0x01, 0x68, 0x01, 0x51, 0xae, 0x00, 0x03, 0x04, 0x61,
+  0x67, 0x65, 0x64, 0x00, 0x48, 0x25, 0x01, 0x6b, 0x00, 0x1c, 0x65, 0x01,
+  0x75, 0x01, 0x53, 0xf7, 0x00, 0x03, 0x01, 0x67, 0x01, 0x56, 0x3c, 0x01,
+  0x6b, 0x01, 0x51, 0xae, 0x03, 0x7a, 0x75, 0x73, 0x00, 0xb9, 0xd1, 0x00,
+  0x01, 0x01, 0x68, 0x00, 0x9f, 0xdd, 0x00, 0x01, 0x01, 0x61, 0x01, 0x48,
+  0xa9, 0x00, 0x01, 0x02, 0x6f, 0x6e, 0x01, 0x51, 0xae, 0x00, 0x02, 0x02,
+  0x61, 0x62, 0x01, 0x56, 0x49, 0x01, 0x6f, 0x00, 0x46, 0x83, 0x00, 0x02,
+  0x01, 0x64, 0x00, 0x39, 0x28, 0x01, 0x74, 0x00, 0x68, 0x09, 0x00, 0x02,
+  0x01, 0x72, 0x00, 0x26, 0xfa, 0x01, 0x74, 0x00, 0x0e, 0x15, 0x00, 0x01,
+  0x01, 0x61, 0x00, 0x41, 0x08, 0x00, 0x02, 0x01, 0x69, 0x01, 0x56, 0x50,
+  0x01, 0x74, 0x00, 0x6d, 0x8e, 0x00, 0x02, 0x01, 0x74, 0x01, 0x4a, 0xcf,
+  0x01, 0x79, 0x00, 0x16, 0x89, 0x00, 0x02, 0x01, 0x67, 0x01, 0x51, 0x22,
+  0x01, 0x68, 0x01, 0x51, 0x22, 0x00, 0x01, 0x01, 0x6d, 0x00, 0x68, 0x09,
+  0x00, 0x02, 0x01, 0x61, 0x00, 0x26, 0xe5, 0x01, 0x75, 0x00, 0x41, 0x08,
+  0x00, 0x01, 0x01, 0x68, 0x00, 0xff, 0x36, 0x00, 0x01, 0x01, 0x75, 0x00,
+  0x41, 0xf9, 0x00, 0x02, 0x01, 0x68, 0x01, 0x45, 0x11, 0x01, 0x79, 0x01,
+  0x3c, 0x89, 0x00, 0x01, 0x01, 0x74, 0x01, 0x29, 0x63, 0x00, 0x01, 0x01,
+  0x68, 0x01, 0x3b, 0x14, 0x00, 0x01, 0x01, 0x6f, 0x00, 0x28, 0xdc, 0x00,
+  0x02, 0x01, 0x6e, 0x01, 0x48, 0xe4, 0x01, 0x73, 0x01, 0x56, 0x57, 0x00,
+  0x01, 0x01, 0x64, 0x00, 0x43, 0x6a, 0x00, 0x01, 0x01, 0x69, 0x00, 0x68,
+  0x09, 0x01, 0x01, 0x01, 0x61, 0x01, 0x56, 0x69, 0x00, 0x01, 0x01, 0x64,
+  0x00, 0x68, 0x09, 0x00, 0x02, 0x01, 0x62, 0x01, 0x22, 0x60, 0x01, 0x77,
+  0x01, 0x37, 0x9d, 0x00, 0x02, 0x01, 0x6b, 0x00, 0x0e, 0x15, 0x01, 0x75,
+  0x00, 0x27, 0x0f, 0x00, 0x01, 0x01, 0x79, 0x01, 0x33, 0x5a, 0x00, 0x03,
+  0x06, 0x61, 0x79, 0x61, 0x62, 0x61, 0x64, 0x00, 0xb9, 0x0e, 0x01, 0x69,
+  0x01, 0x56, 0x70, 0x06, 0x6f, 0x79, 0x69, 0x6d, 0x75, 0x73, 0x01, 0x33,
+  0x5a, 0x00, 0x02, 0x01, 0x72, 0x01, 0x56, 0x7c, 0x01, 0x73, 0x00, 0x39,
+  0x28, 0x00, 0x01, 0x01, 0x7a, 0x00, 0x2a, 0x10, 0x00, 0x03, 0x06, 0x67,
+  0x61, 0x6e, 0x69, 0x68, 0x63, 0x01, 0x0e, 0xf2, 0x01, 0x73, 0x01, 0x34,
+  0x45, 0x01, 0x74, 0x00, 0x68, 0x09, 0x00, 0x01, 0x01, 0x6d, 0x01, 0x33,
+  0xfb, 0x00, 0x02, 0x01, 0x61, 0x00, 0x74, 0x0f, 0x01, 0x65, 0x00, 0x48,
+  0x25, 0x00, 0x03, 0x01, 0x6e, 0x00, 0x41, 0x08, 0x01, 0x6f, 0x00, 0x35,
+  0x0c, 0x01, 0x75, 0x00, 0x9f, 0xdd, 0x00, 0x02, 0x02, 0x61, 0x77, 0x01,
+  0x37, 0xd9, 0x01, 0x75, 0x01, 0x44, 0x61, 0x00, 0x02, 0x01, 0x6b, 0x00,
+  0x29, 0x66, 0x01, 0x79, 0x01, 0x56, 0x83, 0x00, 0x02, 0x01, 0x61, 0x01,
+  0x56, 0x8f, 0x01, 0x75, 0x00, 0x26, 0xe5, 0x00, 0x02, 0x01, 0x67, 0x01,
+  0x56, 0x9c, 0x02, 0x6b, 0x6f, 0x01, 0x56, 0xa8, 0x00, 0x02, 0x01, 0x69,
+  0x00, 0xc5, 0x8b, 0x01, 0x75, 0x00, 0x9f, 0xdd, 0x00, 0x02, 0x01, 0x61,
+  0x00, 0x26, 0xf3, 0x01, 0x75, 0x00, 0xc5, 0xd3, 0x00, 0x01, 0x01, 0x61,
+  0x00, 0xc5, 0xd3, 0x00, 0x02, 0x01, 0x6e, 0x00, 0x15, 0xf4, 0x03, 0x72,
+  0x61, 0x69, 0x01, 0x55, 0x80, 0x00, 0x01, 0x01, 0x6f, 0x00, 0xc5, 0xd3,
+  0x00, 0x02, 0x01, 0x63, 0x01, 0x33, 0x01, 0x01, 0x73, 0x01, 0x56, 0xaf,
+  0x00, 0x04, 0x01, 0x61, 0x01, 0x56, 0xbb, 0x01, 0x69, 0x01, 0x37, 0x82,
+  0x01, 0x6f, 0x00, 0x0e, 0x15, 0x03, 0x75, 0x73, 0x74, 0x01, 0x2b, 0x5e,
+  0x00, 0x03, 0x01, 0x61, 0x00, 0x85, 0x88, 0x07, 0x6f, 0x74, 0x69, 0x68,
+  0x73, 0x6f, 0x79, 0x01, 0x27, 0xff, 0x01, 0x75, 0x00, 0x0e, 0x15, 0x00,
+  0x02, 0x01, 0x6f, 0x01, 0x46, 0x2a, 0x02, 0x75, 0x67, 0x01, 0x54, 0x8e,
+  0x00, 0x02, 0x01, 0x62, 0x00, 0x0e, 0x15, 0x01, 0x6b, 0x00, 0x37, 0xb3,
+  0x00, 0x03, 0x01, 0x61, 0x00, 0x35, 0x0c, 0x01, 0x6f, 0x00, 0x16, 0x7b,
+  0x01, 0x75, 0x01, 0x44, 0x52, 0x00, 0x02, 0x01, 0x6f, 0x00, 0x9b, 0x99,
+  0x01, 0x75, 0x01, 0x44, 0x52, 0x00, 0x04, 0x01, 0x61, 0x01, 0x50, 0x41,
+  0x01, 0x65, 0x01, 0x40, 0xa2, 0x01, 0x69, 0x01, 0x48, 0xbc, 0x01, 0x6f,
+  0x01, 0x50, 0x41, 0x00, 0x01, 0x02, 0x75, 0x7a, 0x00, 0x26, 0xfa, 0x00,
+  0x02, 0x02, 0x62, 0x69, 0x00, 0x52, 0xae, 0x04, 0x68, 0x6f, 0x6e, 0x69,
+  0x00, 0x47, 0xc2, 0x00, 0x02, 0x01, 0x67, 0x01, 0x56, 0xc7, 0x01, 0x6b,
+  0x01, 0x40, 0xa2, 0x00, 0x02, 0x01, 0x72, 0x00, 0x26, 0xd7, 0x01, 0x73,
+  0x00, 0x41, 0xf9, 0x00, 0x02, 0x01, 0x65, 0x00, 0xd6, 0xc9, 0x01, 0x75,
+  0x01, 0x3c, 0x09, 0x00, 0x02, 0x01, 0x6e, 0x01, 0x32, 0xfa, 0x01, 0x74,
+  0x00, 0x26, 0xd7, 0x00, 0x01, 0x01, 0x61, 0x01, 0x07, 0xd8, 0x00, 0x02,
+  0x01, 0x61, 0x01, 0x56, 0xd3, 0x01, 0x69, 0x01, 0x56, 0xdf, 0x00, 0x03,
+  0x01, 0x69, 0x01, 0x48, 0xbc, 0x01, 0x6f, 0x00, 0x16, 0x7b, 0x01, 0x75,
+  0x00, 0xcc, 0x28, 0x00, 0x02, 0x01, 0x61, 0x01, 0x56, 0xf0, 0x01, 0x6f,
+  0x01, 0x56, 0xfc, 0x00, 0x03, 0x01, 0x61, 0x01, 0x57, 0x08, 0x01, 0x69,
+  0x01, 0x57, 0x14, 0x01, 0x75, 0x00, 0x93, 0x83, 0x00, 0x04, 0x01, 0x67,
+  0x01, 0x57, 0x23, 0x01, 0x6b, 0x01, 0x57, 0x34, 0x01, 0x72, 0x00, 0x5d,
+  0xbc, 0x03, 0x7a, 0x6f, 0x72, 0x01, 0x52, 0x05, 0x00, 0x02, 0x01, 0x61,
+  0x01, 0x57, 0x40, 0x01, 0x69, 0x00, 0x26, 0xe5, 0x00, 0x01, 0x01, 0x74,
+  0x00, 0x1c, 0x65, 0x00, 0x02, 0x02, 0x63, 0x75, 0x01, 0x3b, 0xb4, 0x01,
+  0x73, 0x01, 0x57, 0x4c, 0x00, 0x03, 0x01, 0x61, 0x00, 0x5c, 0xe3, 0x01,
+  0x69, 0x00, 0x38, 0xd2, 0x01, 0x75, 0x01, 0x57, 0x59, 0x00, 0x03, 0x03,
+  0x61, 0x6b, 0x6f, 0x00, 0x55, 0x62, 0x01, 0x69, 0x01, 0x57, 0x66, 0x02,
+  0x75, 0x7a, 0x01, 0x57, 0x72, 0x00, 0x04, 0x01, 0x61, 0x01, 0x57, 0x79,
+  0x02, 0x69, 0x6d, 0x01, 0x40, 0xa2, 0x01, 0x6e, 0x00, 0x52, 0xae, 0x01,
+  0x6f, 0x00, 0x26, 0xf3, 0x00, 0x02, 0x03, 0x69, 0x68, 0x73, 0x01, 0x37,
+  0xd9, 0x01, 0x6f, 0x01, 0x3f, 0x8e, 0x00, 0x03, 0x04, 0x61, 0x73, 0x69,
+  0x6d, 0x01, 0x57, 0x85, 0x01, 0x69, 0x01, 0x2b, 0x83, 0x02, 0x6f, 0x6d,
+  0x01, 0x51, 0x22, 0x00, 0x06, 0x01, 0x61, 0x01, 0x57, 0x8c, 0x01, 0x65,
+  0x01, 0x57, 0xba, 0x01, 0x69, 0x01, 0x57, 0xc6, 0x03, 0x6e, 0x61, 0x6e,
+  0x01, 0x48, 0xfe, 0x01, 0x6f, 0x01, 0x57, 0xd7, 0x02, 0x75, 0x67, 0x01,
+  0x27, 0xff, 0x00, 0x05, 0x01, 0x61, 0x01, 0x57, 0xe9, 0x01, 0x65, 0x01,
+  0x58, 0x06, 0x01, 0x69, 0x01, 0x58, 0x13, 0x01, 0x6e, 0x01, 0x58, 0x29,
+  0x01, 0x6f, 0x01, 0x58, 0x37, 0x00, 0x07, 0x01, 0x64, 0x00, 0x43, 0x08,
+  0x01, 0x67, 0x00, 0x46, 0x7c, 0x02, 0x6b, 0x6f, 0x01, 0x29, 0x63, 0x03,
+  0x6d, 0x61, 0x79, 0x01, 0x58, 0x58, 0x03, 0x6e, 0x61, 0x68, 0x00, 0x61,
+  0xc1, 0x01, 0x72, 0x00, 0x38, 0x36, 0x04, 0x77, 0x61, 0x6b, 0x69, 0x01,
+  0x58, 0x64, 0x00, 0x02, 0x01, 0x61, 0x00, 0x7b, 0xf8, 0x01, 0x6f, 0x00,
+  0xc5, 0xd3, 0x00, 0x03, 0x01, 0x68, 0x01, 0x58, 0x71, 0x04, 0x6b, 0x75,
+  0x7a, 0x61, 0x00, 0x70, 0xbd, 0x01, 0x6d, 0x01, 0x58, 0x84, 0x00, 0x03,
+  0x01, 0x68, 0x01, 0x2b, 0xc6, 0x04, 0x73, 0x74, 0x69, 0x6d, 0x01, 0x33,
+  0x01, 0x01, 0x7a, 0x01, 0x58, 0x91, 0x00, 0x03, 0x01, 0x6d, 0x01, 0x58,
+  0x9d, 0x01, 0x73, 0x00, 0x2a, 0x10, 0x01, 0x79, 0x01, 0x58, 0xad, 0x00,
+  0x03, 0x02, 0x62, 0x61, 0x01, 0x35, 0x62, 0x01, 0x6e, 0x01, 0x58, 0xb4,
+  0x04, 0x74, 0x6f, 0x6d, 0x6f, 0x01, 0x54, 0xb4, 0x00, 0x04, 0x09, 0x61,
+  0x64, 0x6e, 0x65, 0x73, 0x61, 0x6d, 0x75, 0x73, 0x01, 0x4b, 0x34, 0x01,
+  0x6b, 0x01, 0x58, 0xc1, 0x01, 0x6d, 0x01, 0x58, 0xd1, 0x01, 0x75, 0x01,
+  0x58, 0xdd, 0x00, 0x03, 0x01, 0x6b, 0x00, 0x30, 0x48, 0x01, 0x6f, 0x00,
+  0x27, 0x0f, 0x01, 0x74, 0x01, 0x29, 0xde, 0x00, 0x05, 0x02, 0x6b, 0x61,
+  0x01, 0x58, 0xe4, 0x01, 0x6d, 0x01, 0x58, 0xf0, 0x01, 0x72, 0x01, 0x58,
+  0xfd, 0x01, 0x74, 0x01, 0x48, 0xfe, 0x01, 0x77, 0x01, 0x40, 0x94, 0x00,
+  0x02, 0x01, 0x6b, 0x01, 0x28, 0x26, 0x01, 0x72, 0x00, 0x80, 0x9d, 0x00,
+  0x03, 0x01, 0x68, 0x01, 0x59, 0x09, 0x05, 0x6d, 0x61, 0x6e, 0x69, 0x6d,
+  0x01, 0x59, 0x16, 0x01, 0x75, 0x00, 0x35, 0x0c, 0x00, 0x02, 0x01, 0x67,
+  0x00, 0xe7, 0x27, 0x01, 0x6e, 0x01, 0x22, 0x50, 0x00, 0x03, 0x01, 0x62,
+  0x01, 0x51, 0xae, 0x02, 0x6d, 0x69, 0x01, 0x59, 0x1d, 0x03, 0x77, 0x61,
+  0x67, 0x01, 0x4d, 0xf4, 0x00, 0x01, 0x01, 0x73, 0x01, 0x22, 0x60, 0x00,
+  0x05, 0x01, 0x67, 0x00, 0x2b, 0x73, 0x01, 0x68, 0x01, 0x59, 0x2b, 0x01,
+  0x6b, 0x01, 0x3a, 0x9a, 0x01, 0x6d, 0x01, 0x59, 0x3b, 0x04, 0x75, 0x6b,
+  0x69, 0x68, 0x01, 0x32, 0x57, 0x00, 0x02, 0x01, 0x61, 0x00, 0x0e, 0x15,
+  0x01, 0x69, 0x00, 0x68, 0x09, 0x00, 0x02, 0x01, 0x6e, 0x01, 0x40, 0x9b,
+  0x01, 0x74, 0x01, 0x59, 0x47, 0x00, 0x05, 0x02, 0x62, 0x61, 0x00, 0x3d,
+  0xe0, 0x01, 0x6d, 0x01, 0x59, 0x4e, 0x01, 0x72, 0x01, 0x59, 0x66, 0x02,
+  0x74, 0x61, 0x01, 0x59, 0x78, 0x01, 0x77, 0x01, 0x59, 0x89, 0x00, 0x03,
+  0x04, 0x67, 0x6e, 0x61, 0x62, 0x01, 0x59, 0x95, 0x01, 0x69, 0x00, 0x5d,
+  0x25, 0x02, 0x74, 0x61, 0x01, 0x59, 0x9c, 0x00, 0x06, 0x02, 0x61, 0x64,
+  0x00, 0x60, 0x5a, 0x01, 0x65, 0x00, 0x4c, 0x78, 0x02, 0x68, 0x73, 0x01,
+  0x59, 0xa8, 0x01, 0x6b, 0x01, 0x59, 0xb5, 0x01, 0x6d, 0x01, 0x55, 0x88,
+  0x01, 0x72, 0x01, 0x59, 0xc2, 0x00, 0x04, 0x01, 0x67, 0x01, 0x59, 0xcf,
+  0x02, 0x6e, 0x6f, 0x01, 0x59, 0xe7, 0x06, 0x72, 0x69, 0x68, 0x73, 0x61,
+  0x77, 0x01, 0x2b, 0x5e, 0x02, 0x74, 0x61, 0x01, 0x59, 0xf3, 0x00, 0x03,
+  0x03, 0x72, 0x61, 0x68, 0x00, 0x39, 0x28, 0x08, 0x73, 0x74, 0x61, 0x6d,
+  0x61, 0x6b, 0x61, 0x77, 0x01, 0x59, 0x95, 0x03, 0x7a, 0x69, 0x61, 0x01,
+  0x5a, 0x01, 0x00, 0x03, 0x01, 0x68, 0x00, 0xff, 0x36, 0x01, 0x6a, 0x00,
+  0x6d, 0x8e, 0x01, 0x6d, 0x00, 0x46, 0x7c, 0x00, 0x01, 0x01, 0x61, 0x01,
+  0x5a, 0x0d, 0x00, 0x02, 0x01, 0x6b, 0x01, 0x40, 0x9b, 0x01, 0x6d, 0x01,
+  0x3c, 0x6f, 0x00, 0x01, 0x01, 0x6e, 0x01, 0x3b, 0x1b, 0x00, 0x01, 0x01,
+  0x65, 0x00, 0x45, 0xad, 0x00, 0x01, 0x01, 0x61, 0x00, 0x9f, 0x52, 0x00,
+  0x01, 0x01, 0x6f, 0x01, 0x5a, 0x14, 0x00, 0x02, 0x04, 0x61, 0x74, 0x69,
+  0x6b, 0x01, 0x5a, 0x1b, 0x04, 0x69, 0x72, 0x6f, 0x6b, 0x01, 0x4d, 0xfb,
+  0x00, 0x01, 0x01, 0x73, 0x00, 0x56, 0x74, 0x00, 0x01, 0x01, 0x69, 0x01,
+  0x35, 0x62, 0x00, 0x02, 0x02, 0x61, 0x74, 0x01, 0x53, 0xfe, 0x01, 0x6f,
+  0x01, 0x26, 0x73, 0x00, 0x03, 0x01, 0x61, 0x01, 0x5a, 0x27, 0x01, 0x65,
+  0x01, 0x32, 0xfa, 0x01, 0x6f, 0x01, 0x51, 0xa7, 0x00, 0x01, 0x01, 0x68,
+  0x00, 0x41, 0x08, 0x00, 0x03, 0x02, 0x67, 0x61, 0x01, 0x5a, 0x33, 0x01,
+  0x68, 0x01, 0x29, 0x63, 0x01, 0x6b, 0x00, 0x1c, 0x65, 0x00, 0x03, 0x01,
+  0x67, 0x01, 0x5a, 0x3f, 0x02, 0x6b, 0x69, 0x01, 0x5a, 0x4e, 0x01, 0x7a,
+  0x01, 0x5a, 0x5a, 0x00, 0x01, 0x01, 0x75, 0x00, 0x26, 0xf3, 0x00, 0x01,
+  0x01, 0x67, 0x00, 0x1c, 0x65, 0x00, 0x01, 0x01, 0x6f, 0x01, 0x5a, 0x6d,
+  0x00, 0x01, 0x01, 0x69, 0x00, 0x2a, 0x10, 0x00, 0x02, 0x01, 0x67, 0x00,
+  0x29, 0x66, 0x01, 0x6e, 0x00, 0x15, 0xf4, 0x00, 0x02, 0x01, 0x61, 0x00,
+  0x8d, 0xab, 0x01, 0x73, 0x01, 0x4e, 0x1b, 0x00, 0x01, 0x01, 0x75, 0x01,
+  0x46, 0x2a, 0x00, 0x02, 0x01, 0x69, 0x00, 0x2b, 0x73, 0x01, 0x6f, 0x01,
+  0x45, 0x11, 0x00, 0x02, 0x01, 0x61, 0x01, 0x5a, 0x74, 0x01, 0x69, 0x00,
+  0x62, 0x3b, 0x00, 0x02, 0x01, 0x61, 0x01, 0x5a, 0x80, 0x01, 0x69, 0x00,
+  0xa0, 0x17, 0x00, 0x01, 0x01, 0x62, 0x01, 0x37, 0x82, 0x00, 0x01, 0x01,
+  0x61, 0x00, 0x1c, 0x6c, 0x00, 0x02, 0x02, 0x61, 0x77, 0x01, 0x37, 0x9d,
+  0x01, 0x6f, 0x01, 0x49, 0x76, 0x00, 0x02, 0x01, 0x61, 0x01, 0x5a, 0x93,
+  0x01, 0x6f, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x73, 0x00, 0x58, 0xaf,
+  0x00, 0x01, 0x02, 0x68, 0x63, 0x00, 0x46, 0x7c, 0x00, 0x02, 0x01, 0x69,
+  0x01, 0x3c, 0x76, 0x01, 0x6f, 0x00, 0x97, 0xbe, 0x00, 0x04, 0x01, 0x67,
+  0x00, 0x41, 0x08, 0x01, 0x6b, 0x01, 0x5a, 0xa0, 0x01, 0x74, 0x01, 0x5a,
+  0xac, 0x01, 0x77, 0x01, 0x5a, 0xbc, 0x00, 0x04, 0x03, 0x6d, 0x6f, 0x6a,
+  0x00, 0x58, 0xaf, 0x01, 0x6e, 0x01, 0x2c, 0x1d, 0x05, 0x73, 0x75, 0x72,
+  0x61, 0x6e, 0x01, 0x33, 0x5a, 0x01, 0x74, 0x01, 0x5a, 0xc8, 0x00, 0x03,
+  0x04, 0x68, 0x73, 0x6f, 0x79, 0x01, 0x3c, 0x89, 0x03, 0x6d, 0x61, 0x67,
+  0x01, 0x4d, 0xd3, 0x04, 0x6e, 0x61, 0x6f, 0x6b, 0x01, 0x32, 0xd9, 0x00,
+  0x06, 0x02, 0x68, 0x61, 0x00, 0xc7, 0x2c, 0x04, 0x6a, 0x6e, 0x6f, 0x68,
+  0x01, 0x5a, 0xd4, 0x02, 0x6e, 0x75, 0x00, 0xce, 0xd4, 0x03, 0x72, 0x69,
+  0x68, 0x01, 0x4e, 0x14, 0x04, 0x74, 0x61, 0x73, 0x69, 0x01, 0x5a, 0xdc,
+  0x02, 0x79, 0x6a, 0x00, 0xe7, 0x27, 0x00, 0x02, 0x03, 0x6b, 0x6f, 0x62,
+  0x01, 0x3d, 0x5b, 0x02, 0x6f, 0x70, 0x00, 0xb3, 0xea, 0x00, 0x02, 0x01,
+  0x61, 0x00, 0xcc, 0x28, 0x04, 0x69, 0x68, 0x73, 0x65, 0x01, 0x54, 0xc8,
+  0x00, 0x02, 0x01, 0x65, 0x01, 0x27, 0x3d, 0x01, 0x69, 0x01, 0x5a, 0xe8,
+  0x00, 0x01, 0x01, 0x74, 0x01, 0x32, 0xd9, 0x00, 0x03, 0x02, 0x61, 0x73,
+  0x01, 0x55, 0x88, 0x01, 0x69, 0x00, 0x1c, 0x65, 0x01, 0x75, 0x00, 0xc6,
+  0x93, 0x00, 0x01, 0x02, 0x6f, 0x74, 0x00, 0x41, 0xf9, 0x00, 0x02, 0x01,
+  0x6b, 0x01, 0x33, 0x5a, 0x01, 0x79, 0x00, 0x26, 0xd7, 0x00, 0x02, 0x01,
+  0x6e, 0x01, 0x58, 0xad, 0x05, 0x75, 0x73, 0x74, 0x6e, 0x65, 0x00, 0x28,
+  0x66, 0x00, 0x02, 0x01, 0x61, 0x01, 0x44, 0xb8, 0x01, 0x6f, 0x01, 0x48,
+  0xf7, 0x00, 0x02, 0x01, 0x6f, 0x00, 0x5d, 0x1e, 0x01, 0x74, 0x01, 0x41,
+  0xa2, 0x00, 0x02, 0x01, 0x61, 0x01, 0x5a, 0xf4, 0x01, 0x75, 0x01, 0x5b,
+  0x0a, 0x00, 0x02, 0x01, 0x6b, 0x01, 0x5b, 0x16, 0x01, 0x73, 0x01, 0x40,
+  0xa2, 0x00, 0x01, 0x01, 0x6b, 0x01, 0x37, 0x82, 0x00, 0x01, 0x01, 0x65,
+  0x01, 0x3c, 0x02, 0x00, 0x02, 0x01, 0x64, 0x00, 0x68, 0x09, 0x01, 0x7a,
+  0x00, 0x2a, 0x10, 0x00, 0x01, 0x01, 0x69, 0x01, 0x5b, 0x27, 0x00, 0x01,
+  0x01, 0x61, 0x01, 0x5b, 0x2e, 0x00, 0x01, 0x01, 0x6d, 0x00, 0x26, 0xfa,
+  0x00, 0x02, 0x01, 0x67, 0x01, 0x50, 0x33, 0x01, 0x6e, 0x00, 0x46, 0x7c,
+  0x00, 0x03, 0x01, 0x67, 0x01, 0x55, 0x88, 0x04, 0x6b, 0x69, 0x68, 0x73,
+  0x00, 0x38, 0x2f, 0x01, 0x6d, 0x00, 0x6f, 0x01, 0x00, 0x01, 0x01, 0x6f,
+  0x00, 0x98, 0x97, 0x01, 0x01, 0x01, 0x61, 0x00, 0x40, 0xf1, 0x00, 0x02,
+  0x01, 0x68, 0x00, 0x39, 0x28, 0x01, 0x79, 0x01, 0x5b, 0x35, 0x00, 0x03,
+  0x01, 0x6d, 0x00, 0x43, 0x6a, 0x01, 0x73, 0x01, 0x54, 0xf8, 0x01, 0x74,
+  0x00, 0x0e, 0x15, 0x00, 0x02, 0x01, 0x64, 0x00, 0x5d, 0xbc, 0x01, 0x6d,
+  0x00, 0x41, 0xf9, 0x00, 0x02, 0x03, 0x61, 0x74, 0x61, 0x01, 0x55, 0x3a,
+  0x01, 0x69, 0x00, 0x27, 0x25, 0x00, 0x01, 0x01, 0x74, 0x00, 0x45, 0xa6,
+  0x00, 0x02, 0x01, 0x68, 0x00, 0x40, 0x21, 0x01, 0x6b, 0x00, 0x41, 0x08,
+  0x00, 0x01, 0x01, 0x73, 0x00, 0x45, 0xa6, 0x01, 0x02, 0x01, 0x69, 0x01,
+  0x48, 0xdd, 0x01, 0x75, 0x00, 0x29, 0x58, 0x00, 0x02, 0x02, 0x68, 0x6f,
+  0x01, 0x5b, 0x41, 0x08, 0x6b, 0x61, 0x74, 0x6e, 0x65, 0x7a, 0x75, 0x6b,
+  0x00, 0x36, 0xd0, 0x00, 0x02, 0x01, 0x69, 0x01, 0x44, 0xaa, 0x01, 0x75,
+  0x01, 0x45, 0xec, 0x00, 0x02, 0x01, 0x68, 0x00, 0xeb, 0x8f, 0x01, 0x6e,
+  0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x75, 0x00, 0xa0, 0x17, 0x00, 0x02,
+  0x01, 0x61, 0x01, 0x48, 0xa9, 0x02, 0x75, 0x6b, 0x01, 0x4a, 0x87, 0x00,
+  0x02, 0x01, 0x6d, 0x01, 0x5b, 0x48, 0x04, 0x73, 0x61, 0x67, 0x65, 0x01,
+  0x32, 0xfa, 0x00, 0x01, 0x01, 0x61, 0x00, 0x40, 0xf1, 0x00, 0x02, 0x01,
+  0x72, 0x00, 0x7f, 0xc0, 0x01, 0x77, 0x00, 0x2a, 0x10, 0x00, 0x02, 0x01,
+  0x67, 0x01, 0x44, 0xb1, 0x01, 0x6b, 0x00, 0x26, 0xfa, 0x00, 0x01, 0x01,
+  0x61, 0x01, 0x46, 0x2a, 0x00, 0x02, 0x01, 0x67, 0x00, 0xee, 0xaa, 0x01,
+  0x6b, 0x01, 0x5b, 0x55, 0x00, 0x01, 0x01, 0x6f, 0x01, 0x32, 0x34, 0x00,
+  0x02, 0x01, 0x61, 0x01, 0x2b, 0xcd, 0x01, 0x6f, 0x00, 0x0e, 0x15, 0x00,
+  0x02, 0x01, 0x6d, 0x01, 0x39, 0xd8, 0x01, 0x74, 0x00, 0x29, 0x66, 0x00,
+  0x02, 0x01, 0x68, 0x00, 0x0e, 0x15, 0x02, 0x6b, 0x69, 0x00, 0xc5, 0x8b,
+  0x00, 0x02, 0x01, 0x6f, 0x00, 0x0e, 0x15, 0x01, 0x75, 0x00, 0xe4, 0xf4,
+  0x00, 0x02, 0x07, 0x62, 0x6f, 0x69, 0x68, 0x73, 0x75, 0x73, 0x00, 0x29,
+  0x66, 0x03, 0x77, 0x61, 0x74, 0x01, 0x4e, 0x40, 0x00, 0x01, 0x01, 0x6b,
+  0x01, 0x44, 0xe5, 0x00, 0x01, 0x01, 0x6e, 0x01, 0x32, 0xd9, 0x00, 0x01,
+  0x02, 0x69, 0x68, 0x00, 0xeb, 0x8f, 0x00, 0x02, 0x01, 0x61, 0x01, 0x5b,
+  0x5c, 0x03, 0x69, 0x68, 0x73, 0x01, 0x5b, 0x69, 0x00, 0x03, 0x01, 0x61,
+  0x01, 0x5b, 0x75, 0x01, 0x69, 0x00, 0x35, 0x0c, 0x01, 0x75, 0x01, 0x5b,
+  0x81, 0x00, 0x02, 0x01, 0x69, 0x00, 0x46, 0x83, 0x01, 0x6f, 0x01, 0x5b,
+  0x8d, 0x00, 0x02, 0x01, 0x6b, 0x01, 0x48, 0xe4, 0x01, 0x7a, 0x01, 0x2b,
+  0x5e, 0x00, 0x02, 0x01, 0x6d, 0x01, 0x48, 0x51, 0x01, 0x72, 0x00, 0x68,
+  0x09, 0x00, 0x02, 0x01, 0x61, 0x01, 0x48, 0xe4, 0x01, 0x75, 0x00, 0x8d,
+  0xab, 0x00, 0x01, 0x01, 0x6f, 0x00, 0x1c, 0x6c, 0x00, 0x03, 0x01, 0x67,
+  0x01, 0x43, 0x7e, 0x01, 0x6b, 0x00, 0x46, 0x7c, 0x01, 0x73, 0x00, 0x62,
+  0x9c, 0x00, 0x03, 0x05, 0x61, 0x73, 0x61, 0x69, 0x72, 0x01, 0x41, 0xa9,
+  0x01, 0x63, 0x01, 0x4e, 0x9f, 0x01, 0x73, 0x01, 0x5b, 0x99, 0x00, 0x02,
+  0x01, 0x61, 0x01, 0x5b, 0xa6, 0x02, 0x69, 0x68, 0x00, 0xd5, 0xdc, 0x00,
+  0x02, 0x02, 0x69, 0x6b, 0x00, 0x6a, 0xcc, 0x01, 0x6f, 0x00, 0x35, 0x0c,
+  0x00, 0x01, 0x03, 0x69, 0x68, 0x73, 0x01, 0x27, 0xff, 0x00, 0x02, 0x01,
+  0x6f, 0x01, 0x45, 0xd2, 0x02, 0x74, 0x61, 0x00, 0x0c, 0x43, 0x00, 0x01,
+  0x01, 0x61, 0x00, 0xf8, 0xb4, 0x00, 0x02, 0x02, 0x61, 0x68, 0x01, 0x5b,
+  0xb2, 0x01, 0x75, 0x01, 0x5b, 0xbe, 0x00, 0x02, 0x01, 0x67, 0x01, 0x5b,
+  0xc5, 0x01, 0x6b, 0x01, 0x5b, 0xd4, 0x00, 0x02, 0x01, 0x61, 0x01, 0x5b,
+  0xe0, 0x01, 0x75, 0x00, 0x27, 0x41, 0x00, 0x02, 0x01, 0x67, 0x00, 0x68,
+  0x09, 0x01, 0x6b, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x6b, 0x00, 0x13,
+  0x5b, 0x00, 0x02, 0x01, 0x69, 0x00, 0x0e, 0x15, 0x03, 0x75, 0x73, 0x74,
+  0x01, 0x38, 0x32, 0x00, 0x02, 0x03, 0x61, 0x79, 0x75, 0x00, 0x1c, 0x6c,
+  0x01, 0x69, 0x01, 0x23, 0x20, 0x00, 0x01, 0x01, 0x64, 0x00, 0x80, 0x9d,
+  0x00, 0x02, 0x05, 0x61, 0x68, 0x6f, 0x6e, 0x65, 0x00, 0x5d, 0xbc, 0x04,
+  0x75, 0x73, 0x74, 0x61, 0x01, 0x51, 0xa0, 0x00, 0x02, 0x01, 0x61, 0x01,
+  0x5b, 0xe7, 0x01, 0x6f, 0x00, 0x38, 0xd2, 0x00, 0x02, 0x02, 0x63, 0x69,
+  0x01, 0x5b, 0xbe, 0x01, 0x73, 0x01, 0x5b, 0xf3, 0x00, 0x02, 0x04, 0x61,
+  0x73, 0x61, 0x72, 0x00, 0x27, 0x25, 0x01, 0x75, 0x01, 0x5b, 0xff, 0x00,
+  0x02, 0x03, 0x61, 0x6b, 0x61, 0x01, 0x5a, 0x6d, 0x09, 0x69, 0x68, 0x63,
+  0x75, 0x67, 0x61, 0x77, 0x61, 0x6b, 0x01, 0x40, 0xa2, 0x00, 0x02, 0x07,
+  0x61, 0x73, 0x69, 0x6d, 0x61, 0x77, 0x61, 0x01, 0x3e, 0x0c, 0x01, 0x75,
+  0x01, 0x1a, 0xec, 0x00, 0x02, 0x01, 0x6e, 0x00, 0x29, 0x66, 0x01, 0x6f,
+  0x00, 0x85, 0x88, 0x00, 0x01, 0x02, 0x68, 0x63, 0x01, 0x53, 0x95, 0x00,
+  0x03, 0x01, 0x73, 0x00, 0x68, 0x09, 0x01, 0x74, 0x01, 0x33, 0x61, 0x01,
+  0x77, 0x00, 0x2a, 0x10, 0x00, 0x02, 0x01, 0x68, 0x01, 0x22, 0x57, 0x01,
+  0x77, 0x00, 0x45, 0xa6, 0x00, 0x02, 0x04, 0x61, 0x67, 0x69, 0x6d, 0x01,
+  0x43, 0x7e, 0x03, 0x69, 0x68, 0x63, 0x01, 0x37, 0x82, 0x00, 0x02, 0x01,
+  0x61, 0x00, 0x74, 0x0f, 0x01, 0x65, 0x00, 0x5d, 0x25, 0x00, 0x01, 0x01,
+  0x69, 0x01, 0x53, 0x33, 0x00, 0x02, 0x02, 0x61, 0x72, 0x01, 0x29, 0xba,
+  0x01, 0x6f, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x01, 0x61, 0x00, 0x27, 0x0f,
+  0x01, 0x6f, 0x00, 0x16, 0x7b, 0x00, 0x01, 0x01, 0x61, 0x00, 0x6a, 0xbe,
+  0x00, 0x02, 0x01, 0x72, 0x01, 0x56, 0x7c, 0x03, 0x73, 0x61, 0x67, 0x00,
+  0x22, 0xd6, 0x00, 0x02, 0x01, 0x61, 0x00, 0x83, 0x6a, 0x03, 0x69, 0x68,
+  0x73, 0x01, 0x37, 0x82, 0x00, 0x02, 0x02, 0x61, 0x62, 0x01, 0x3c, 0x41,
+  0x01, 0x75, 0x01, 0x5c, 0x0b, 0x00, 0x02, 0x02, 0x61, 0x73, 0x01, 0x45,
+  0x11, 0x01, 0x69, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x01, 0x65, 0x00, 0x27,
+  0x2c, 0x02, 0x6f, 0x67, 0x01, 0x5c, 0x17, 0x00, 0x02, 0x01, 0x69, 0x01,
+  0x18, 0x4c, 0x01, 0x6e, 0x00, 0x26, 0xfa, 0x00, 0x02, 0x01, 0x61, 0x00,
+  0x21, 0x6d, 0x01, 0x69, 0x00, 0x38, 0xd2, 0x00, 0x01, 0x01, 0x73, 0x01,
+  0x5a, 0x0d, 0x00, 0x01, 0x01, 0x61, 0x01, 0x32, 0x34, 0x01, 0x01, 0x01,
+  0x6b, 0x00, 0x26, 0xd7, 0x00, 0x02, 0x01, 0x6b, 0x01, 0x5c, 0x21, 0x03,
+  0x6e, 0x75, 0x73, 0x01, 0x44, 0xec, 0x00, 0x04, 0x01, 0x61, 0x00, 0x93,
+  0x75, 0x01, 0x69, 0x01, 0x5c, 0x2d, 0x01, 0x6f, 0x01, 0x50, 0x41, 0x01,
+  0x75, 0x00, 0x12, 0x22, 0x00, 0x02, 0x01, 0x6b, 0x01, 0x5c, 0x3e, 0x01,
+  0x77, 0x00, 0x2a, 0x10, 0x00, 0x02, 0x01, 0x6d, 0x01, 0x49, 0xf9, 0x01,
+  0x73, 0x01, 0x4d, 0xf4, 0x00, 0x02, 0x02, 0x62, 0x6d, 0x00, 0x84, 0xae,
+  0x01, 0x69, 0x01, 0x32, 0x34, 0x00, 0x02, 0x01, 0x69, 0x01, 0x5c, 0x4a,
+  0x01, 0x73, 0x00, 0x26, 0xd7, 0x00, 0x06, 0x01, 0x65, 0x00, 0x0e, 0x15,
+  0x01, 0x69, 0x01, 0x5c, 0x57, 0x01, 0x6d, 0x01, 0x5c, 0x6a, 0x02, 0x6e,
+  0x6f, 0x01, 0x5c, 0x76, 0x01, 0x6f, 0x01, 0x5c, 0x82, 0x01, 0x75, 0x01,
+  0x5c, 0x93, 0x00, 0x02, 0x01, 0x6f, 0x00, 0x28, 0xdc, 0x01, 0x79, 0x00,
+  0x0e, 0x15, 0x00, 0x01, 0x01, 0x61, 0x01, 0x00, 0x8b, 0x00, 0x01, 0x01,
+  0x72, 0x00, 0x52, 0xae, 0x00, 0x02, 0x01, 0x61, 0x00, 0x66, 0x03, 0x01,
+  0x6f, 0x01, 0x3c, 0x54, 0x00, 0x02, 0x01, 0x69, 0x01, 0x5c, 0xa5, 0x01,
+  0x6f, 0x00, 0x26, 0xf3, 0x00, 0x01, 0x02, 0x6f, 0x6e, 0x01, 0x44, 0xe5,
+  0x00, 0x02, 0x01, 0x61, 0x00, 0x16, 0x7b, 0x01, 0x6e, 0x01, 0x0e, 0xf2,
+  0x00, 0x01, 0x01, 0x6d, 0x00, 0x7f, 0xc0, 0x00, 0x03, 0x01, 0x67, 0x01,
+  0x14, 0x53, 0x01, 0x73, 0x01, 0x5c, 0xb1, 0x01, 0x77, 0x01, 0x44, 0xe5,
+  0x00, 0x02, 0x01, 0x68, 0x01, 0x4e, 0xf1, 0x01, 0x6d, 0x00, 0x0e, 0x15,
+  0x00, 0x02, 0x01, 0x61, 0x00, 0x26, 0xf3, 0x01, 0x75, 0x00, 0x45, 0x93,
+  0x00, 0x01, 0x01, 0x6f, 0x01, 0x32, 0xb1, 0x00, 0x02, 0x01, 0x61, 0x01,
+  0x5c, 0xbe, 0x01, 0x6f, 0x00, 0x0e, 0x15, 0x01, 0x01, 0x01, 0x6f, 0x01,
+  0x50, 0x41, 0x01, 0x01, 0x02, 0x6d, 0x6f, 0x01, 0x5c, 0xca, 0x00, 0x02,
+  0x01, 0x61, 0x01, 0x3c, 0x02, 0x01, 0x75, 0x00, 0x27, 0x0f, 0x01, 0x01,
+  0x02, 0x6b, 0x6f, 0x00, 0xbc, 0x2f, 0x00, 0x02, 0x01, 0x63, 0x01, 0x33,
+  0x01, 0x01, 0x73, 0x01, 0x50, 0x3a, 0x00, 0x01, 0x01, 0x77, 0x00, 0x45,
+  0xa6, 0x01, 0x01, 0x01, 0x6f, 0x01, 0x42, 0x61, 0x00, 0x02, 0x02, 0x6b,
+  0x6f, 0x01, 0x45, 0x11, 0x01, 0x73, 0x00, 0x0e, 0x15, 0x01, 0x01, 0x01,
+  0x75, 0x00, 0x29, 0x58, 0x00, 0x02, 0x01, 0x67, 0x00, 0x7f, 0xc0, 0x01,
+  0x73, 0x00, 0x2b, 0x73, 0x00, 0x04, 0x02, 0x61, 0x67, 0x01, 0x14, 0x53,
+  0x01, 0x69, 0x00, 0xb2, 0xfd, 0x01, 0x6f, 0x00, 0xe2, 0x54, 0x02, 0x75,
+  0x7a, 0x01, 0x48, 0xc3, 0x00, 0x01, 0x02, 0x68, 0x63, 0x00, 0x43, 0x6a,
+  0x00, 0x01, 0x01, 0x69, 0x01, 0x18, 0x4c, 0x00, 0x01, 0x01, 0x62, 0x00,
+  0x2a, 0x10, 0x00, 0x01, 0x01, 0x61, 0x00, 0x9f, 0xdd, 0x00, 0x03, 0x01,
+  0x2d, 0x01, 0x5c, 0xd2, 0x01, 0x6e, 0x01, 0x46, 0x8a, 0x01, 0x6f, 0x01,
+  0x2d, 0xbd, 0x00, 0x03, 0x02, 0x61, 0x73, 0x00, 0xf2, 0x95, 0x02, 0x65,
+  0x7a, 0x00, 0x17, 0x57, 0x01, 0x69, 0x01, 0x46, 0x91, 0x00, 0x02, 0x01,
+  0x61, 0x00, 0x27, 0x0f, 0x01, 0x73, 0x00, 0x5d, 0xbc, 0x00, 0x02, 0x01,
+  0x72, 0x01, 0x2e, 0xb1, 0x01, 0x75, 0x01, 0x2e, 0x7b, 0x00, 0x01, 0x01,
+  0x39, 0x01, 0x56, 0x0e, 0x01, 0x02, 0x02, 0x2d, 0x65, 0x00, 0xc7, 0xa5,
+  0x01, 0x2e, 0x01, 0x56, 0x02, 0x00, 0x01, 0x03, 0x2d, 0x70, 0x61, 0x01,
+  0x47, 0x20, 0x00, 0x02, 0x01, 0x33, 0x00, 0x27, 0x0f, 0x01, 0x65, 0x00,
+  0xc7, 0xa5, 0x00, 0x02, 0x01, 0x39, 0x01, 0x56, 0x0e, 0x01, 0x6b, 0x01,
+  0x56, 0x1b, 0x00, 0x01, 0x07, 0x64, 0x75, 0x6f, 0x6c, 0x63, 0x2e, 0x73,
+  0x01, 0x5c, 0xde, 0x00, 0x01, 0x08, 0x63, 0x61, 0x74, 0x73, 0x6c, 0x61,
+  0x75, 0x64, 0x00, 0xf5, 0xbd, 0x00, 0x01, 0x01, 0x6c, 0x01, 0x01, 0x66,
+  0x01, 0x01, 0x06, 0x2d, 0x72, 0x65, 0x67, 0x6e, 0x65, 0x00, 0x4d, 0x36,
+  0x00, 0x02, 0x02, 0x69, 0x6d, 0x01, 0x5c, 0xf3, 0x01, 0x6f, 0x01, 0x48,
+  0xa9, 0x00, 0x01, 0x01, 0x61, 0x00, 0xf4, 0xb5, 0x00, 0x01, 0x01, 0x6d,
+  0x00, 0x16, 0x89, 0x00, 0x02, 0x07, 0x61, 0x6b, 0x61, 0x61, 0x79, 0x61,
+  0x68, 0x00, 0x37, 0xb3, 0x01, 0x6f, 0x01, 0x33, 0x5a, 0x00, 0x01, 0x01,
+  0x6b, 0x00, 0xec, 0x1c, 0x00, 0x02, 0x01, 0x61, 0x01, 0x5c, 0xff, 0x01,
+  0x6e, 0x00, 0x0e, 0x15, 0x00, 0x01, 0x01, 0x61, 0x01, 0x55, 0x8f, 0x00,
+  0x02, 0x01, 0x61, 0x00, 0xc6, 0x07, 0x01, 0x69, 0x00, 0x12, 0x22, 0x00,
+  0x02, 0x01, 0x67, 0x00, 0x56, 0x74, 0x02, 0x6b, 0x61, 0x01, 0x5d, 0x0b,
+  0x00, 0x02, 0x01, 0x61, 0x01, 0x5d, 0x1c, 0x01, 0x69, 0x00, 0x1c, 0x65,
+  0x01, 0x01, 0x01, 0x72, 0x00, 0x7f, 0xc0, 0x00, 0x02, 0x01, 0x61, 0x01,
+  0x5d, 0x2d, 0x01, 0x69, 0x00, 0x0f, 0x6f, 0x00, 0x02, 0x01, 0x67, 0x01,
+  0x5d, 0x3b, 0x01, 0x6d, 0x01, 0x2b, 0x8a, 0x00, 0x02, 0x01, 0x65, 0x01,
+  0x3c, 0x54, 0x01, 0x75, 0x00, 0xe9, 0x88, 0x00, 0x02, 0x01, 0x6d, 0x00,
+  0xf3, 0x3c, 0x01, 0x77, 0x00, 0x68, 0x09, 0x01, 0x03, 0x01, 0x61, 0x00,
+  0x26, 0xf3, 0x01, 0x69, 0x01, 0x5d, 0x42, 0x01, 0x6d, 0x00, 0x26, 0xfa,
+  0x00, 0x02, 0x01, 0x64, 0x00, 0x7f, 0xc0, 0x01, 0x73, 0x00, 0x26, 0xd7,
+  0x00, 0x02, 0x01, 0x61, 0x01, 0x32, 0x34, 0x01, 0x73, 0x00, 0x0e, 0x15,
+  0x00, 0x02, 0x01, 0x74, 0x01, 0x02, 0x04, 0x01, 0x79, 0x01, 0x5d, 0x4f,
+  0x00, 0x02, 0x04, 0x68, 0x73, 0x61, 0x67, 0x01, 0x26, 0x73, 0x01, 0x6a,
+  0x01, 0x0e, 0xf2, 0x00, 0x03, 0x01, 0x65, 0x01, 0x5d, 0x64, 0x01, 0x69,
+  0x00, 0x1c, 0x6c, 0x01, 0x6f, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x01, 0x61,
+  0x00, 0x44, 0x12, 0x01, 0x69, 0x01, 0x5d, 0x70, 0x00, 0x02, 0x01, 0x67,
+  0x01, 0x5d, 0x7c, 0x01, 0x6b, 0x00, 0x6d, 0x8e, 0x00, 0x02, 0x01, 0x6f,
+  0x01, 0x44, 0x68, 0x02, 0x75, 0x62, 0x01, 0x22, 0x60, 0x00, 0x02, 0x01,
+  0x6b, 0x00, 0x0e, 0x15, 0x02, 0x73, 0x74, 0x01, 0x3c, 0xb5, 0x00, 0x02,
+  0x01, 0x68, 0x00, 0xff, 0x36, 0x01, 0x6a, 0x00, 0x6d, 0x8e, 0x00, 0x01,
+  0x01, 0x69, 0x01, 0x32, 0xd9, 0x00, 0x02, 0x01, 0x67, 0x00, 0x41, 0x08,
+  0x01, 0x6e, 0x00, 0x39, 0x28, 0x01, 0x01, 0x01, 0x61, 0x00, 0x35, 0x0c,
+  0x00, 0x08, 0x01, 0x64, 0x01, 0x5d, 0x8e, 0x01, 0x6b, 0x01, 0x52, 0x62,
+  0x02, 0x6d, 0x61, 0x01, 0x5d, 0x9b, 0x02, 0x72, 0x75, 0x01, 0x5d, 0xa7,
+  0x02, 0x73, 0x61, 0x01, 0x4e, 0x6b, 0x02, 0x77, 0x61, 0x01, 0x5d, 0xba,
+  0x01, 0x79, 0x00, 0x41, 0xf9, 0x01, 0x7a, 0x00, 0x41, 0xf9, 0x00, 0x02,
+  0x01, 0x62, 0x01, 0x5d, 0xc7, 0x01, 0x64, 0x01, 0x3c, 0xb5, 0x00, 0x03,
+  0x01, 0x67, 0x01, 0x37, 0xec, 0x01, 0x6a, 0x00, 0x38, 0x36, 0x01, 0x6d,
+  0x01, 0x2b, 0x5e, 0x00, 0x03, 0x01, 0x62, 0x00, 0x58, 0xaf, 0x02, 0x6e,
+  0x69, 0x01, 0x56, 0x50, 0x01, 0x74, 0x01, 0x5d, 0xce, 0x00, 0x05, 0x01,
+  0x6a, 0x00, 0x48, 0x25, 0x02, 0x6b, 0x6f, 0x01, 0x55, 0x96, 0x01, 0x6d,
+  0x01, 0x5d, 0xde, 0x01, 0x72, 0x01, 0x5d, 0xee, 0x02, 0x77, 0x69, 0x01,
+  0x5d, 0xfd, 0x00, 0x02, 0x02, 0x67, 0x61, 0x01, 0x43, 0x1a, 0x01, 0x6b,
+  0x00, 0x83, 0x34, 0x00, 0x04, 0x01, 0x67, 0x00, 0x29, 0x66, 0x01, 0x68,
+  0x01, 0x5e, 0x09, 0x01, 0x6b, 0x01, 0x5e, 0x16, 0x01, 0x6d, 0x01, 0x43,
+  0x4f, 0x00, 0x02, 0x02, 0x61, 0x6e, 0x01, 0x50, 0x20, 0x02, 0x65, 0x7a,
+  0x00, 0x5f, 0x90, 0x00, 0x05, 0x03, 0x68, 0x73, 0x6f, 0x01, 0x4b, 0x34,
+  0x01, 0x6a, 0x01, 0x27, 0xff, 0x01, 0x6e, 0x01, 0x5e, 0x24, 0x01, 0x6f,
+  0x00, 0x38, 0xd2, 0x05, 0x75, 0x68, 0x63, 0x69, 0x62, 0x00, 0x16, 0x89,
+  0x00, 0x02, 0x01, 0x65, 0x00, 0x45, 0xad, 0x01, 0x6f, 0x00, 0x16, 0x7b,
+  0x00, 0x02, 0x01, 0x69, 0x01, 0x37, 0x89, 0x02, 0x72, 0x65, 0x00, 0x5d,
+  0x25, 0x00, 0x03, 0x01, 0x61, 0x00, 0x8d, 0xab, 0x01, 0x63, 0x01, 0x57,
+  0x72, 0x03, 0x73, 0x61, 0x68, 0x01, 0x56, 0x49, 0x00, 0x02, 0x02, 0x61,
+  0x6e, 0x01, 0x5e, 0x30, 0x01, 0x69, 0x00, 0x21, 0x6d, 0x00, 0x02, 0x01,
+  0x69, 0x00, 0x72, 0x4d, 0x01, 0x6f, 0x00, 0x5d, 0xbc, 0x00, 0x02, 0x02,
+  0x61, 0x79, 0x01, 0x48, 0xc3, 0x04, 0x69, 0x68, 0x73, 0x6f, 0x01, 0x5e,
+  0x3c, 0x00, 0x01, 0x01, 0x6f, 0x01, 0x32, 0xfa, 0x00, 0x02, 0x02, 0x61,
+  0x74, 0x01, 0x5e, 0x43, 0x01, 0x75, 0x00, 0xb2, 0xfd, 0x00, 0x02, 0x05,
+  0x61, 0x7a, 0x61, 0x72, 0x75, 0x00, 0x47, 0xc2, 0x01, 0x6f, 0x00, 0x7f,
+  0xc0, 0x00, 0x02, 0x01, 0x61, 0x00, 0x3e, 0xb9, 0x01, 0x75, 0x01, 0x49,
+  0x59, 0x00, 0x01, 0x01, 0x73, 0x01, 0x4e, 0x6b, 0x00, 0x02, 0x01, 0x6e,
+  0x00, 0x0e, 0x15, 0x01, 0x73, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x02, 0x61,
+  0x79, 0x01, 0x33, 0x01, 0x01, 0x69, 0x01, 0x5e, 0x4f, 0x00, 0x02, 0x01,
+  0x61, 0x01, 0x5e, 0x60, 0x01, 0x65, 0x00, 0x27, 0x0f, 0x00, 0x02, 0x02,
+  0x63, 0x69, 0x01, 0x5e, 0x6c, 0x01, 0x73, 0x01, 0x5e, 0x81, 0x00, 0x01,
+  0x01, 0x61, 0x00, 0x8d, 0xab, 0x00, 0x02, 0x03, 0x68, 0x73, 0x75, 0x01,
+  0x5e, 0x8f, 0x01, 0x6d, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x04, 0x63, 0x6f,
+  0x67, 0x61, 0x00, 0x38, 0x94, 0x02, 0x73, 0x6f, 0x01, 0x44, 0x68, 0x00,
+  0x02, 0x01, 0x61, 0x00, 0x85, 0x88, 0x01, 0x75, 0x01, 0x5e, 0x9b, 0x00,
+  0x01, 0x01, 0x75, 0x01, 0x32, 0x7b, 0x00, 0x04, 0x01, 0x61, 0x01, 0x5e,
+  0xa2, 0x03, 0x69, 0x68, 0x73, 0x01, 0x5e, 0xae, 0x01, 0x6f, 0x00, 0x27,
+  0x0f, 0x01, 0x75, 0x00, 0x29, 0x58, 0x00, 0x02, 0x06, 0x61, 0x62, 0x6f,
+  0x69, 0x68, 0x73, 0x01, 0x51, 0x22, 0x02, 0x75, 0x67, 0x01, 0x5d, 0xc7,
+  0x00, 0x03, 0x01, 0x6b, 0x01, 0x51, 0x22, 0x01, 0x6d, 0x01, 0x0e, 0xf2,
+  0x01, 0x72, 0x00, 0x7f, 0xc0, 0x00, 0x02, 0x01, 0x61, 0x01, 0x5e, 0xba,
+  0x01, 0x6f, 0x00, 0x38, 0xd2, 0x00, 0x01, 0x01, 0x75, 0x01, 0x5e, 0x9b,
+  0x00, 0x02, 0x01, 0x64, 0x00, 0x0e, 0x15, 0x01, 0x74, 0x01, 0x4e, 0x80,
+  0x00, 0x02, 0x01, 0x61, 0x01, 0x5b, 0x2e, 0x02, 0x69, 0x69, 0x01, 0x5e,
+  0xcb, 0x00, 0x02, 0x01, 0x61, 0x01, 0x5e, 0xd3, 0x02, 0x75, 0x62, 0x00,
+  0x45, 0xa6, 0x00, 0x02, 0x01, 0x6f, 0x00, 0x41, 0xf9, 0x02, 0x75, 0x73,
+  0x01, 0x5a, 0x14, 0x00, 0x04, 0x03, 0x65, 0x74, 0x6f, 0x00, 0x26, 0xe5,
+  0x01, 0x69, 0x01, 0x42, 0x8f, 0x01, 0x6e, 0x00, 0x29, 0x66, 0x01, 0x6f,
+  0x01, 0x50, 0x41, 0x01, 0x02, 0x01, 0x64, 0x01, 0x5b, 0x55, 0x01, 0x72,
+  0x00, 0x7f, 0xc0, 0x00, 0x02, 0x01, 0x6d, 0x00, 0x45, 0xa6, 0x03, 0x73,
+  0x69, 0x6d, 0x01, 0x59, 0x95, 0x00, 0x02, 0x01, 0x69, 0x01, 0x42, 0x8f,
+  0x01, 0x6e, 0x00, 0x45, 0xa6, 0x00, 0x01, 0x01, 0x74, 0x00, 0x68, 0x09,
+  0x00, 0x01, 0x01, 0x74, 0x00, 0x43, 0x08, 0x00, 0x02, 0x01, 0x69, 0x01,
+  0x48, 0xa9, 0x01, 0x6f, 0x01, 0x50, 0x41, 0x00, 0x02, 0x01, 0x6b, 0x00,
+  0x29, 0x66, 0x01, 0x72, 0x00, 0x2b, 0x73, 0x00, 0x02, 0x01, 0x6d, 0x00,
+  0x45, 0xa6, 0x01, 0x6e, 0x00, 0x6d, 0x8e, 0x00, 0x02, 0x01, 0x65, 0x01,
+  0x26, 0x93, 0x04, 0x6f, 0x72, 0x75, 0x6d, 0x00, 0x13, 0x33, 0x00, 0x02,
+  0x01, 0x68, 0x00, 0x40, 0x21, 0x01, 0x6d, 0x00, 0x0e, 0x15, 0x00, 0x03,
+  0x03, 0x61, 0x6e, 0x61, 0x00, 0x83, 0x6a, 0x01, 0x65, 0x01, 0x41, 0xd9,
+  0x01, 0x6f, 0x00, 0x16, 0x7b, 0x00, 0x01, 0x01, 0x6e, 0x00, 0x43, 0x08,
+  0x00, 0x02, 0x01, 0x62, 0x00, 0x26, 0xfa, 0x01, 0x67, 0x01, 0x43, 0x4f,
+  0x00, 0x03, 0x02, 0x67, 0x69, 0x01, 0x50, 0x68, 0x02, 0x6b, 0x69, 0x01,
+  0x04, 0x0e, 0x01, 0x7a, 0x01, 0x4e, 0x6b, 0x00, 0x02, 0x01, 0x67, 0x00,
+  0x43, 0x6a, 0x02, 0x6b, 0x61, 0x01, 0x2e, 0x33, 0x00, 0x02, 0x01, 0x61,
+  0x01, 0x33, 0x4c, 0x01, 0x6f, 0x01, 0x32, 0xd9, 0x00, 0x02, 0x03, 0x61,
+  0x67, 0x6f, 0x01, 0x5e, 0xdf, 0x03, 0x69, 0x6b, 0x61, 0x01, 0x50, 0x6f,
+  0x00, 0x02, 0x01, 0x61, 0x00, 0x45, 0x93, 0x01, 0x6f, 0x01, 0x42, 0x61,
+  0x00, 0x02, 0x01, 0x61, 0x00, 0xc6, 0xf2, 0x01, 0x6f, 0x00, 0x5d, 0x1e,
+  0x01, 0x01, 0x02, 0x69, 0x72, 0x01, 0x4e, 0x6b, 0x00, 0x02, 0x01, 0x6a,
+  0x00, 0x6d, 0x8e, 0x01, 0x6d, 0x00, 0x0e, 0x15, 0x00, 0x02, 0x01, 0x68,
+  0x00, 0x0e, 0x15, 0x01, 0x6f, 0x00, 0x0e, 0x15, 0x00, 0x03, 0x05, 0x67,
+  0x69, 0x68, 0x73, 0x61, 0x01, 0x32, 0x82, 0x01, 0x68, 0x01, 0x5e, 0xe6,
+  0x02, 0x77, 0x61, 0x01, 0x5e, 0xf4, 0x00, 0x02, 0x01, 0x69, 0x00, 0x12,
+  0x22, 0x01, 0x6b, 0x01, 0x48, 0x4a, 0x00, 0x03, 0x01, 0x69, 0x00, 0x26,
+  0xd7, 0x01, 0x6f, 0x01, 0x45, 0xd2, 0x01, 0x75, 0x00, 0x5f, 0xa8, 0x00,
+  0x01, 0x01, 0x68, 0x00, 0x39, 0x21, 0x00, 0x01, 0x01, 0x67, 0x00, 0x7f,
+  0xc0, 0x00, 0x02, 0x01, 0x65, 0x01, 0x48, 0xa9, 0x01, 0x69, 0x00, 0x12,
+  0x22, 0x00, 0x01, 0x01, 0x6e, 0x00, 0x43, 0x6a, 0x00, 0x02, 0x01, 0x61,
+  0x00, 0x22, 0x1f, 0x02, 0x75, 0x7a, 0x00, 0x80, 0x9d, 0x00, 0x01, 0x01,
+  0x75, 0x00, 0xc9, 0x18, 0x01, 0x02, 0x01, 0x68, 0x01, 0x41, 0xec, 0x02,
+  0x79, 0x75, 0x00, 0x66, 0x03, 0x00, 0x02, 0x01, 0x69, 0x01, 0x0a, 0x99,
+  0x01, 0x75, 0x00, 0x84, 0x96, 0x00, 0x02, 0x01, 0x68, 0x00, 0x43, 0x6a,
+  0x01, 0x74, 0x00, 0x26, 0xfa, 0x00, 0x02, 0x01, 0x69, 0x01, 0x48, 0xdd,
+  0x01, 0x6b, 0x01, 0x3c, 0xb5, 0x00, 0x02, 0x01, 0x6b, 0x00, 0x0e, 0x15,
+  0x01, 0x79, 0x00, 0x46, 0x7c, 0x00, 0x02, 0x02, 0x61, 0x68, 0x01, 0x48,
+  0xe4, 0x01, 0x6f, 0x01, 0x44, 0x68, 0x00, 0x02, 0x01, 0x6d, 0x00, 0x41,
+  0xf9, 0x01, 0x7a, 0x01, 0x5d, 0x3b, 0x00, 0x02, 0x01, 0x69, 0x00, 0x12,
+  0x22, 0x01, 0x75, 0x01, 0x58, 0xdd, 0x00, 0x01, 0x01, 0x6d, 0x01, 0x4d,
+  0xf4, 0x00, 0x02, 0x01, 0x61, 0x00, 0x40, 0xf1, 0x04, 0x6f, 0x64, 0x6f,
+  0x79, 0x00, 0x27, 0x25, 0x00, 0x02, 0x01, 0x61, 0x00, 0x27, 0x0f, 0x01,
+  0x6f, 0x00, 0x0e, 0x15, 0x01, 0x01, 0x01, 0x73, 0x00, 0x13, 0x5b, 0x00,
+  0x02, 0x01, 0x6b, 0x01, 0x5f, 0x00, 0x01, 0x73, 0x01, 0x59, 0x47, 0x00,
+  0x02, 0x01, 0x61, 0x01, 0x5a, 0x6d, 0x01, 0x6f, 0x00, 0x1e, 0x60, 0x00,
+  0x02, 0x01, 0x66, 0x00, 0x97, 0x11, 0x01, 0x73, 0x00, 0x5c, 0xe3, 0x00,
+  0x02, 0x01, 0x6d, 0x00, 0x41, 0x08, 0x01, 0x75, 0x01, 0x3c, 0x09, 0x01,
+  0x01, 0x04, 0x69, 0x6d, 0x61, 0x6b, 0x01, 0x27, 0xff, 0x00, 0x02, 0x01,
+  0x61, 0x00, 0x0f, 0x6f, 0x01, 0x75, 0x00, 0x16, 0x9c, 0x00, 0x03, 0x01,
+  0x68, 0x01, 0x5f, 0x0c, 0x01, 0x6b, 0x00, 0x43, 0x6a, 0x01, 0x6d, 0x00,
+  0x68, 0x09, 0x00, 0x02, 0x01, 0x6b, 0x00, 0x83, 0x34, 0x01, 0x6f, 0x01,
+  0x31, 0x33, 0x00, 0x02, 0x01, 0x62, 0x00, 0x0e, 0x15, 0x02, 0x68, 0x73,
+  0x01, 0x32, 0xd9, 0x00, 0x03, 0x01, 0x61, 0x00, 0x0e, 0x15, 0x02, 0x68,
+  0x73, 0x00, 0x66, 0x37, 0x02, 0x72, 0x6f, 0x01, 0x0b, 0x87, 0x00, 0x02,
+  0x01, 0x65, 0x00, 0x0e, 0x15, 0x01, 0x6f, 0x01, 0x5f, 0x18, 0x00, 0x02,
+  0x01, 0x68, 0x00, 0x0e, 0x15, 0x01, 0x74, 0x01, 0x4a, 0xcf, 0x00, 0x03,
+  0x01, 0x6d, 0x00, 0x16, 0x89, 0x01, 0x73, 0x00, 0x0e, 0x15, 0x01, 0x74,
+  0x00, 0x0e, 0x15, 0x00, 0x03, 0x01, 0x6b, 0x00, 0x36, 0xd0, 0x02, 0x70,
+  0x70, 0x00, 0x37, 0xb3, 0x01, 0x73, 0x00, 0x16, 0x7b, 0x00, 0x02, 0x01,
+  0x68, 0x00, 0xeb, 0x8f, 0x01, 0x6d, 0x00, 0x68, 0x09, 0x00, 0x02, 0x02,
+  0x61, 0x67, 0x00, 0x42, 0x75, 0x01, 0x75, 0x01, 0x26, 0x9a, 0x00, 0x02,
+  0x01, 0x6b, 0x00, 0x29, 0x66, 0x01, 0x6e, 0x00, 0x0e, 0x15, 0x01, 0x01,
+  0x02, 0x6e, 0x61, 0x01, 0x27, 0xff, 0x00, 0x02, 0x01, 0x6e, 0x01, 0x46,
+  0x8a, 0x01, 0x6f, 0x01, 0x2d, 0xbd, 0x00, 0x02, 0x01, 0x66, 0x00, 0x27,
+  0xf5, 0x0a, 0x74, 0x65, 0x73, 0x73, 0x61, 0x2d, 0x77, 0x65, 0x69, 0x76,
+  0x00, 0x95, 0xc9, 0x00, 0x02, 0x01, 0x61, 0x00, 0x22, 0x1f, 0x01, 0x6f,
+  0x00, 0x0e, 0x15, 0x00, 0x02, 0x01, 0x6b, 0x00, 0x43, 0x6a, 0x01, 0x74,
+  0x00, 0x0e, 0x15, 0x00, 0x03, 0x01, 0x68, 0x00, 0x0e, 0x15, 0x01, 0x6e,
+  0x00, 0x2b, 0x73, 0x01, 0x74, 0x00, 0x0e, 0x15, 0x00, 0x03, 0x01, 0x6b,
+  0x00, 0x29, 0x66, 0x01, 0x6e, 0x00, 0x45, 0xa6, 0x01, 0x74, 0x00, 0x0e,
+  0x15, 0x00, 0x02, 0x01, 0x67, 0x00, 0x7f, 0xc0, 0x03, 0x68, 0x75, 0x6b,
+  0x01, 0x4e, 0x6b, 0x00, 0x01, 0x01, 0x61, 0x00, 0x29, 0x58, 0x00, 0x02,
+  0x02, 0x68, 0x73, 0x01, 0x5f, 0x24, 0x01, 0x6d, 0x01, 0x41, 0xff, 0x00,
+  0x03, 0x01, 0x61, 0x00, 0x27, 0x0f, 0x01, 0x6f, 0x01, 0x5f, 0x30, 0x05,
+  0x75, 0x73, 0x74, 0x61, 0x6d, 0x01, 0x33, 0x5a, 0x00, 0x02, 0x01, 0x6b,
+  0x00, 0x41, 0x08, 0x01, 0x6d, 0x00, 0x29, 0x66, 0x00, 0x02, 0x01, 0x68,
+  0x00, 0xff, 0x36, 0x01, 0x6d, 0x00, 0x68, 0x09, 0x00, 0x03, 0x01, 0x61,
+  0x01, 0x3c, 0x02, 0x02, 0x69, 0x68, 0x01, 0x33, 0x4c, 0x01, 0x6f, 0x01,
+  0x31, 0x2c, 0x00, 0x02, 0x01, 0x69, 0x00, 0x44, 0x12, 0x02, 0x6e, 0x6f,
+  0x01, 0x4f, 0xac, 0x00, 0x02, 0x01, 0x68, 0x01, 0x5f, 0x3c, 0x01, 0x79,
+  0x01, 0x5f, 0x48, 0x00, 0x02, 0x08, 0x75, 0x73, 0x74, 0x61, 0x6b, 0x69,
+  0x68, 0x63, 0x00, 0x29, 0x66, 0x01, 0x79, 0x00, 0x0e, 0x15, 0x00, 0x02,
+  0x01, 0x67, 0x01, 0x5f, 0x54, 0x02, 0x6b, 0x6f, 0x00, 0x30, 0x48, 0x00,
+  0x01, 0x01, 0x61, 0x01, 0x5b, 0x41, 0x00, 0x02, 0x01, 0x61, 0x00, 0xf5,
+  0x3a, 0x05, 0x6f, 0x6d, 0x69, 0x68, 0x73, 0x01, 0x5f, 0x60, 0x00, 0x02,
+  0x02, 0x61, 0x79, 0x01, 0x5f, 0x6c, 0x04, 0x69, 0x68, 0x73, 0x61, 0x01,
+  0x5f, 0x78, 0x00, 0x02, 0x01, 0x61, 0x01, 0x55, 0x8f, 0x04, 0x75, 0x6b,
+  0x61, 0x77, 0x01, 0x33, 0x45, 0x00, 0x02, 0x01, 0x61, 0x00, 0xb2, 0xfd,
+  0x01, 0x6e, 0x00, 0x13, 0x33, 0x00, 0x02, 0x02, 0x63, 0x75, 0x01, 0x5f,
+  0x7f, 0x01, 0x73, 0x01, 0x25, 0xba, 0x00, 0x02, 0x01, 0x61, 0x00, 0xf5,
+  0x3a, 0x03, 0x69, 0x68, 0x73, 0x01, 0x49, 0xe4, 0x00, 0x02, 0x01, 0x61,
+  0x01, 0x43, 0x77, 0x01, 0x69, 0x01, 0x5e, 0xcb, 0x00, 0x02, 0x01, 0x69,
+  0x00, 0x0e, 0x15, 0x01, 0x6f, 0x00, 0x16, 0x7b, 0x00, 0x01, 0x01, 0x67,
+  0x00, 0x68, 0x09, 0x00, 0x02, 0x01, 0x61, 0x00, 0x9f, 0x52, 0x01, 0x69,
+  0x01, 0x26, 0xa1, 0x00, 0x02, 0x06, 0x68, 0x73, 0x6f, 0x72, 0x69, 0x68,
+  0x01, 0x33, 0x5a, 0x01, 0x6a, 0x01, 0x5f, 0x8b, 0x00, 0x02, 0x01, 0x62,
+  0x00, 0x15, 0xf4, 0x01, 0x68, 0x01, 0x5f, 0x9b, 0x00, 0x03, 0x04, 0x61,
+  0x6b, 0x75, 0x73, 0x01, 0x31, 0x2c, 0x02, 0x6d, 0x6f, 0x00, 0x9b, 0x99,
+  0x01, 0x6e, 0x00, 0x26, 0xfa, 0x00, 0x02, 0x03, 0x69, 0x6e, 0x61, 0x00,
+  0xf7, 0x6b, 0x01, 0x6f, 0x01, 0x44, 0x68, 0x00, 0x02, 0x01, 0x6b, 0x00,
+  0x46, 0x7c, 0x01, 0x73, 0x01, 0x3a, 0xbc, 0x00, 0x01, 0x01, 0x7a, 0x00,
+  0x62, 0x9c, 0x00, 0x02, 0x01, 0x74, 0x00, 0x41, 0x08, 0x01, 0x79, 0x01,
+  0x5f, 0xa7, 0x00, 0x02, 0x01, 0x69, 0x00, 0x12, 0x22, 0x01, 0x75, 0x01,
+  0x26, 0x9a, 0x00, 0x03, 0x01, 0x67, 0x01, 0x5f, 0xb3, 0x01, 0x6b, 0x01,
+  0x5f, 0xc4, 0x01, 0x6e, 0x00, 0x52, 0xae, 0x00, 0x01, 0x02, 0x6d, 0x61,
+  0x01, 0x5e, 0x3c, 0x00, 0x02, 0x01, 0x77, 0x00, 0x2a, 0x10, 0x01, 0x7a,
+  0x01, 0x34, 0x45, 0x01, 0x01, 0x01, 0x72, 0x01, 0x2b, 0x91, 0x00, 0x02,
+  0x01, 0x65, 0x00, 0x39, 0x21, 0x03, 0x69, 0x6d, 0x61, 0x01, 0x4e, 0x72,
+  0x00, 0x02, 0x01, 0x64, 0x00, 0x41, 0x08, 0x01, 0x67, 0x01, 0x4e, 0x6b,
+  0x00, 0x02, 0x01, 0x61, 0x01, 0x5f, 0x78, 0x01, 0x69, 0x01, 0x44, 0xaa,
+  0x00, 0x02, 0x01, 0x61, 0x00, 0x8d, 0xab, 0x01, 0x73, 0x01, 0x50, 0x3a,
+  0x00, 0x02, 0x01, 0x6d, 0x00, 0x0e, 0x15, 0x01, 0x74, 0x01, 0x4d, 0xf4,
+  0x00, 0x02, 0x01, 0x61, 0x01, 0x5b, 0x2e, 0x01, 0x69, 0x00, 0x0f, 0x6f,
+  0x00, 0x02, 0x01, 0x72, 0x00, 0x64, 0xb6, 0x01, 0x74, 0x00, 0x52, 0xae,
+  0x00, 0x02, 0x01, 0x61, 0x01, 0x32, 0x34, 0x01, 0x69, 0x00, 0x12, 0x22,
+  0x00, 0x02, 0x01, 0x61, 0x01, 0x5f, 0xd0, 0x01, 0x6f, 0x01, 0x52, 0xbd,
+  0x00, 0x02, 0x01, 0x61, 0x01, 0x5f, 0xdc, 0x01, 0x6f, 0x01, 0x27, 0xcc,
+  0x00, 0x02, 0x01, 0x61, 0x00, 0x21, 0x6d, 0x01, 0x75, 0x00, 0x35, 0x0c,
+  0x00, 0x02, 0x01, 0x61, 0x00, 0x29, 0x58, 0x01, 0x75, 0x00, 0x84, 0x96,
+  0x00, 0x01, 0x01, 0x79, 0x00, 0x52, 0xae, 0x00, 0x02, 0x01, 0x6b, 0x01,
+  0x59, 0x16, 0x01, 0x6f, 0x01, 0x19, 0x80, 0x00, 0x02, 0x01, 0x61, 0x00,
+  0x88, 0x51, 0x05, 0x69, 0x6d, 0x61, 0x6b, 0x69, 0x01, 0x56, 0x69, 0x00,
+  0x02, 0x01, 0x65, 0x01, 0x27, 0x3d, 0x01, 0x69, 0x00, 0x12, 0x22, 0x00,
+  0x02, 0x01, 0x65, 0x01, 0x32, 0xfa, 0x01, 0x69, 0x01, 0x38, 0x39, 0x00,
+  0x03, 0x01, 0x61, 0x01, 0x52, 0x9a, 0x01, 0x65, 0x00, 0x5f, 0xa8, 0x01,
+  0x75, 0x00, 0x26, 0xf3, 0x00, 0x02, 0x01, 0x61, 0x01, 0x5f, 0xe8, 0x01,
+  0x69, 0x01, 0x5b, 0x27, 0x00, 0x02, 0x01, 0x6b, 0x00, 0x83, 0x34, 0x01,
+  0x74, 0x00, 0x16, 0x89, 0x00, 0x02, 0x01, 0x64, 0x01, 0x32, 0xd2, 0x01,
+  0x7a, 0x00, 0x41, 0xf9, 0x00, 0x03, 0x01, 0x6d, 0x00, 0x43, 0x6a, 0x01,
+  0x72, 0x00, 0x26, 0xfa, 0x01, 0x73, 0x00, 0x26, 0xd7,
+};
@@ -0,0 +1,176 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "./regex_literals.h"
+
+static bool isAlphanumeric(char c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+    (c >= '0' && c <= '9');
+}
+
+// Returns the offset just past the bracket expression starting at |i|, or
+// -1 if it isn't closed.  A ']' right after the '[' or "[^" is part of it,
+// and so is everything inside "[:", "[=" and "[." expressions.
+static int skipBracket(const char *regex, int regexLen, int i) {
+  i++;
+  if (i < regexLen && regex[i] == '^') {
+    i++;
+  }
+  if (i < regexLen && regex[i] == ']') {
+    i++;
+  }
+  while (i < regexLen && regex[i] != ']') {
+    if (regex[i] == '[' && i + 1 < regexLen &&
+        (regex[i + 1] == ':' || regex[i + 1] == '=' || regex[i + 1] == '.')) {
+      const char delimiter = regex[i + 1];
+      i += 2;
+      while (i + 1 < regexLen &&
+          (regex[i] != delimiter || regex[i + 1] != ']')) {
+        i++;
+      }
+      i += 2;
+      continue;
+    }
+    i++;
+  }
+  return i < regexLen ? i + 1 : -1;
+}
+
+// Returns the offset just past the group starting at |i|, or -1 if it isn't
+// closed.
+static int skipGroup(const char *regex, int regexLen, int i) {
+  int depth = 0;
+  while (i < regexLen) {
+    switch (regex[i]) {
+      case '\\':
+        i += 2;
+        continue;
+      case '[':
+        i = skipBracket(regex, regexLen, i);
+        if (i == -1) {
+          return -1;
+        }
+        continue;
+      case '(':
+        depth++;
+        break;
+      case ')':
+        if (--depth == 0) {
+          return i + 1;
+        }
+        break;
+    }
+    i++;
+  }
+  return -1;
+}
+
+// Returns the offset just past the quantifiers at |i|, if there are any,
+// and sets whether the atom before them can be left out or repeated.
+static int skipQuantifiers(const char *regex, int regexLen, int i,
+    bool *optional, bool *repeated) {
+  *optional = false;
+  *repeated = false;
+  while (i < regexLen) {
+    const char c = regex[i];
+    if (c == '?' || c == '*') {
+      *optional = true;
+      *repeated |= c == '*';
+      i++;
+    } else if (c == '+') {
+      *repeated = true;
+      i++;
+    } else if (c == '{') {
+      int min = 0;
+      int j = i + 1;
+      while (j < regexLen && regex[j] >= '0' && regex[j] <= '9') {
+        min = min * 10 + regex[j] - '0';
+        j++;
+      }
+      // Anything other than exactly one occurrence repeats it
+      *optional |= min == 0;
+      *repeated |= min != 1 || j >= regexLen || regex[j] != '}';
+      while (j < regexLen && regex[j] != '}') {
+        j++;
+      }
+      i = j + 1;
+    } else {
+      break;
+    }
+  }
+  return i;
+}
+
+bool findRegexLiterals(const char *regex, int regexLen,
+    std::vector<std::string> *literals) {
+  literals->clear();
+  std::string run;
+  int i = 0;
+  while (i < regexLen) {
+    // The character the atom at |i| matches, or 0 when it isn't a single
+    // plain character.
+    char literal = 0;
+    switch (regex[i]) {
+      case '\\':
+        if (i + 1 >= regexLen) {
+          literals->clear();
+          return false;
+        }
+        // Escaped letters and digits are classes, assertions and back
+        // references.
+        if (!isAlphanumeric(regex[i + 1])) {
+          literal = regex[i + 1];
+        }
+        i += 2;
+        break;
+      case '[':
+        i = skipBracket(regex, regexLen, i);
+        break;
+      case '(':
+        i = skipGroup(regex, regexLen, i);
+        break;
+      case ')':
+        i = -1;
+        break;
+      case '|':
+        // Either side can match on its own
+        literals->clear();
+        return true;
+      case '^':
+      case '$':
+      case '.':
+      case '*':
+      case '+':
+      case '?':
+      case '{':
+        i++;
+        break;
+      default:
+        literal = regex[i];
+        i++;
+        break;
+    }
+    if (i == -1) {
+      literals->clear();
+      return false;
+    }
+
+    bool optional, repeated;
+    i = skipQuantifiers(regex, regexLen, i, &optional, &repeated);
+    if (literal && !optional) {
+      run += literal;
+    }
+    if (!literal || optional || repeated) {
+      if (!run.empty()) {
+        literals->push_back(run);
+        run.clear();
+      }
+    }
+  }
+  if (!run.empty()) {
+    literals->push_back(run);
+  }
+  return true;
+}
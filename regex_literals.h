@@ -0,0 +1,21 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef REGEX_LITERALS_H_
+#define REGEX_LITERALS_H_
+
+#include <string>
+#include <vector>
+
+// Fills |literals| with runs of plain characters which every string matched
+// by |regex| contains, in the order they occur, and returns false if the
+// expression can't be analyzed.  Only the top level of the expression is
+// looked at: characters which are optional or repeated end a run, and
+// classes, groups and escapes like \d are skipped.  An expression with a
+// top level '|' has no such runs.
+bool findRegexLiterals(const char *regex, int regexLen,
+    std::vector<std::string> *literals);
+
+#endif  // REGEX_LITERALS_H_
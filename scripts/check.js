@@ -10,6 +10,8 @@
  *   node scripts/check.js --host www.scrumpoker.online --location https://www.scrumpoker.online/js/angular-google-analytics.js -O script
  * Checking a URL with discovery:
  *   node scripts/check.js  --host www.cnet.com --location "https://slashdot.org?t=1&ad_box_=2" --discover
+ * Checking a URL with discovery of every matching filter:
+ *   node scripts/check.js  --host www.cnet.com --location "https://slashdot.org?t=1&ad_box_=2" --discover --all
  * Checking a URL against a particular adblock list:
  *   node scripts/check.js  --uuid 03F91310-9244-40FA-BCF6-DA31B832F34D --host slashdot.org --location https://s.yimg.jp/images/ds/ult/toppage/rapidjp-1.0.0.js
  * Checking a URL from a loaded DAT file:
@@ -40,6 +42,7 @@ commander
   .option('-o, --output [output]', 'Optionally saves a DAT file')
   .option('-L, --list [list]', 'Filename for list of sites to check')
   .option('-D, --discover', 'If specified does filter discovery for matched filter')
+  .option('-A, --all', 'With --discover, finds all matching filters instead of the first ones')
   .option('-s, --stats', 'If specified outputs parsing stats')
   .option('-C, --cache', 'Optionally cache results and use cached results')
   .option('-O, --filter-option [filterOption]', 'Filter option to use', filterStringToFilterOption, FilterOptions.noFilterOption)
@@ -81,7 +84,9 @@ p.then((adBlockClient) => {
   }
   if (commander.location) {
     console.log('params:', commander.location, commander.filterOption, commander.host)
-    if (commander.discover) {
+    if (commander.discover && commander.all) {
+      console.log(JSON.stringify(adBlockClient.findAllMatchingFilters(commander.location, commander.filterOption, commander.host), null, 2))
+    } else if (commander.discover) {
       console.log(adBlockClient.findMatchingFilters(commander.location, commander.filterOption, commander.host))
     } else {
       console.log('Matches: ', adBlockClient.matches(commander.location, commander.filterOption, commander.host))
@@ -12,7 +12,8 @@ IGNORE_FILES = [
   os.path.join('./bad_fingerprints5.h'),
   os.path.join('./bad_fingerprints6.h'),
   os.path.join('./bad_fingerprints7.h'),
-  os.path.join('./bad_fingerprints8.h')
+  os.path.join('./bad_fingerprints8.h'),
+  os.path.join('./public_suffix_list_data.h')
 ]
 
 SOURCE_ROOT = os.path.abspath(os.path.dirname(os.path.dirname(__file__)))
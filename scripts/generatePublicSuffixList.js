@@ -0,0 +1,187 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+// Builds public_suffix_list_data.h from a local copy of the public suffix
+// list (https://publicsuffix.org/list/public_suffix_list.dat):
+//
+//   node scripts/generatePublicSuffixList.js public_suffix_list.dat
+//
+// The rules are stored reversed, so "co.uk" is "ku.oc", in a DAFSA: a trie
+// whose identical subtrees are shared, with runs of nodes which only have
+// one way out merged into a single edge.  public_suffix_list.cc walks it
+// from the end of a host.
+//
+// Each node is a flags byte, an edge count byte and the edges sorted by
+// their first character.  An edge is a length byte, that many characters
+// and the 3 byte big endian offset of the node it leads to.
+
+const fs = require('fs')
+const path = require('path')
+const url = require('url')
+
+const kRule = 1
+const kWildcard = 2
+const kException = 4
+
+const parseRules = (listTxt) => {
+  const rules = []
+  listTxt.split('\n').forEach((line) => {
+    let rule = line.trim().split(/\s/)[0]
+    if (!rule || rule.startsWith('//')) {
+      return
+    }
+    let flag = kRule
+    if (rule.startsWith('!')) {
+      flag = kException
+      rule = rule.substring(1)
+    } else if (rule.startsWith('*.')) {
+      flag = kWildcard
+      rule = rule.substring(2)
+    }
+    const asciiRule = url.domainToASCII(rule)
+    if (!asciiRule || asciiRule.includes('*')) {
+      console.warn(`Skipping unsupported rule: ${line}`)
+      return
+    }
+    rules.push({ key: asciiRule.split('').reverse().join(''), flag })
+  })
+  return rules
+}
+
+const buildTrie = (rules) => {
+  const root = { flags: 0, children: new Map() }
+  rules.forEach(({ key, flag }) => {
+    let node = root
+    for (const c of key) {
+      if (!node.children.has(c)) {
+        node.children.set(c, { flags: 0, children: new Map() })
+      }
+      node = node.children.get(c)
+    }
+    node.flags |= flag
+  })
+  return root
+}
+
+// Replaces every subtree by the first one seen with the same flags and
+// edges, and returns the new root.
+const minimize = (root) => {
+  const nodes = []
+  const bySignature = new Map()
+  const visit = (node) => {
+    const children = [...node.children.keys()].sort().map((c) => {
+      return [c, visit(node.children.get(c))]
+    })
+    const signature = node.flags + '|' +
+      children.map(([c, child]) => c + child.id).join(',')
+    if (!bySignature.has(signature)) {
+      const shared = { id: nodes.length, flags: node.flags, children, inDegree: 0 }
+      nodes.push(shared)
+      bySignature.set(signature, shared)
+    }
+    return bySignature.get(signature)
+  }
+  const minimizedRoot = visit(root)
+  nodes.forEach((node) => {
+    node.children.forEach(([c, child]) => child.inDegree++)
+  })
+  return minimizedRoot
+}
+
+// Follows an edge through the nodes which have no flags, a single edge and
+// nothing else leading to them.
+const mergeEdge = (c, child) => {
+  let label = c
+  while (child.flags === 0 && child.children.length === 1 &&
+      child.inDegree === 1) {
+    label += child.children[0][0]
+    child = child.children[0][1]
+  }
+  return { label, child }
+}
+
+const encode = (root) => {
+  const order = []
+  const queue = [root]
+  const seen = new Set([root])
+  while (queue.length) {
+    const node = queue.shift()
+    order.push(node)
+    node.edges = node.children.map(([c, child]) => mergeEdge(c, child))
+    if (node.edges.length > 255) {
+      throw new Error('Too many edges for one node')
+    }
+    node.edges.forEach(({ label, child }) => {
+      if (label.length > 255) {
+        throw new Error(`Edge label too long: ${label}`)
+      }
+      if (!seen.has(child)) {
+        seen.add(child)
+        queue.push(child)
+      }
+    })
+  }
+
+  // Node sizes don't depend on where they are, so offsets can be assigned
+  // before anything is written.
+  const offsets = new Map()
+  let offset = 0
+  order.forEach((node) => {
+    offsets.set(node, offset)
+    offset += 2 + node.edges.reduce((total, { label }) => {
+      return total + 1 + label.length + 3
+    }, 0)
+  })
+  if (offset >= 1 << 24) {
+    throw new Error('DAFSA is too large for 3 byte offsets')
+  }
+
+  const bytes = []
+  order.forEach((node) => {
+    bytes.push(node.flags, node.edges.length)
+    node.edges.forEach(({ label, child }) => {
+      const childOffset = offsets.get(child)
+      bytes.push(label.length)
+      for (const c of label) {
+        bytes.push(c.charCodeAt(0))
+      }
+      bytes.push((childOffset >> 16) & 0xff, (childOffset >> 8) & 0xff,
+        childOffset & 0xff)
+    })
+  })
+  return { bytes, numNodes: order.length }
+}
+
+const writeHeader = (bytes, numRules, sourceName, outputPath) => {
+  const lines = []
+  for (let i = 0; i < bytes.length; i += 12) {
+    lines.push('  ' + bytes.slice(i, i + 12).map((b) => {
+      return '0x' + b.toString(16).padStart(2, '0')
+    }).join(', ') + ',')
+  }
+  const header = `#pragma once
+/**
+  *
+  * Auto generated by scripts/generatePublicSuffixList.js from
+  * ${sourceName}, ${numRules} rules.
+  */
+static const uint8_t kPublicSuffixListDafsa[] = {
+${lines.join('\n')}
+};
+`
+  fs.writeFileSync(outputPath, header)
+}
+
+const listPath = process.argv[2]
+if (!listPath) {
+  console.error('Usage: node scripts/generatePublicSuffixList.js ' +
+    '<public_suffix_list.dat> [output header]')
+  process.exit(1)
+}
+const outputPath = process.argv[3] ||
+  path.join(__dirname, '..', 'public_suffix_list_data.h')
+const rules = parseRules(fs.readFileSync(listPath, 'utf8'))
+const { bytes, numNodes } = encode(minimize(buildTrie(rules)))
+writeHeader(bytes, rules.length, path.basename(listPath), outputPath)
+console.log(`${rules.length} rules, ${numNodes} nodes, ${bytes.length} bytes`)
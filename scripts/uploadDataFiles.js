@@ -6,7 +6,7 @@ const fs = require('fs')
 const s3 = require('s3-client')
 const commander = require('commander')
 const path = require('path')
-const dataFileVersion = 4
+const dataFileVersion = 7
 
 const client = s3.createClient({
   maxAsyncS3: 20,
@@ -0,0 +1,28 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "./serialization.h"
+
+void writeUint32(char *buffer, uint32_t value) {
+  for (int i = 0; i < 4; i++) {
+    buffer[i] = static_cast<char>(value >> (i * 8) & 0xff);
+  }
+}
+
+uint32_t readUint32(const char *buffer) {
+  const unsigned char *bytes = reinterpret_cast<const unsigned char *>(buffer);
+  return bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) |
+    (static_cast<uint32_t>(bytes[3]) << 24);
+}
+
+void writeUint64(char *buffer, uint64_t value) {
+  writeUint32(buffer, static_cast<uint32_t>(value));
+  writeUint32(buffer + 4, static_cast<uint32_t>(value >> 32));
+}
+
+uint64_t readUint64(const char *buffer) {
+  return readUint32(buffer) |
+    static_cast<uint64_t>(readUint32(buffer + 4)) << 32;
+}
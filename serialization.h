@@ -0,0 +1,19 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef SERIALIZATION_H_
+#define SERIALIZATION_H_
+
+#include <stdint.h>
+
+// Integers in the data file sections of the indexes are written a byte at a
+// time, least significant first, so the data file doesn't depend on the
+// endianness of the machine which wrote it.
+void writeUint32(char *buffer, uint32_t value);
+uint32_t readUint32(const char *buffer);
+void writeUint64(char *buffer, uint64_t value);
+uint64_t readUint64(const char *buffer);
+
+#endif  // SERIALIZATION_H_
@@ -0,0 +1,146 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <stdlib.h>
+#include <new>
+#include <string>
+#include <vector>
+#include "./ad_block_client.h"
+#include "./match_request.h"
+#include "./CppUnitLite/TestHarness.h"
+#include "./CppUnitLite/Test.h"
+#include "./util.h"
+
+using std::string;
+
+// Every heap allocation in the test program goes through these, and they
+// are only counted while |countAllocations| is set.
+static bool countAllocations = false;
+static int numAllocations = 0;
+
+static void * countedAlloc(size_t size) {
+  if (countAllocations) {
+    numAllocations++;
+  }
+  return malloc(size ? size : 1);
+}
+
+void * operator new(size_t size) {
+  void *p = countedAlloc(size);
+  if (!p) {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+
+void * operator new[](size_t size) {
+  void *p = countedAlloc(size);
+  if (!p) {
+    throw std::bad_alloc();
+  }
+  return p;
+}
+
+void * operator new(size_t size, const std::nothrow_t &) noexcept {
+  return countedAlloc(size);
+}
+
+void * operator new[](size_t size, const std::nothrow_t &) noexcept {
+  return countedAlloc(size);
+}
+
+void operator delete(void *p) noexcept {
+  free(p);
+}
+
+void operator delete[](void *p) noexcept {
+  free(p);
+}
+
+void operator delete(void *p, const std::nothrow_t &) noexcept {
+  free(p);
+}
+
+void operator delete[](void *p, const std::nothrow_t &) noexcept {
+  free(p);
+}
+
+// Returns the number of blocked URLs from checking every site in a few
+// different contexts.
+int sweepSiteList(AdBlockClient *client, const std::vector<string> &sites) {
+  const FilterOption contextOptions[] = {
+    FONoFilterOption, FOScript
+  };
+  const char *contextDomains[] = {
+    nullptr, "slashdot.org"
+  };
+  int numBlocks = 0;
+  for (const string &url : sites) {
+    for (FilterOption contextOption : contextOptions) {
+      for (const char *contextDomain : contextDomains) {
+        if (client->matches(url.c_str(), contextOption, contextDomain)) {
+          numBlocks++;
+        }
+      }
+    }
+  }
+  return numBlocks;
+}
+
+// Matching must not touch the heap once the lists are loaded, except to
+// lowercase URLs which don't fit in a request's inline buffer.
+TEST(allocations, noneWhileMatching) {
+  string && easyListTxt = // NOLINT
+    getFileContents("./test/data/easylist.txt");
+  string && easyPrivacyTxt = // NOLINT
+    getFileContents("./test/data/easyprivacy.txt");
+  string && ublockUnblockTxt = // NOLINT
+    getFileContents("./test/data/ublock-unbreak.txt");
+  string && braveUnblockTxt = // NOLINT
+    getFileContents("./test/data/brave-unbreak.txt");
+  std::vector<string> sites;
+  std::vector<string> longSites;
+  for (const string &url : getSiteListUrls()) {
+    if (url.length() > MatchRequest::kInlineInputLen) {
+      longSites.push_back(url);
+    } else {
+      sites.push_back(url);
+    }
+  }
+  CHECK(!longSites.empty());
+
+  AdBlockClient client;
+  client.parse(easyListTxt.c_str());
+  client.parse(easyPrivacyTxt.c_str());
+  client.parse(ublockUnblockTxt.c_str());
+  client.parse(braveUnblockTxt.c_str());
+  int size;
+  char *buffer = client.serialize(&size);
+  AdBlockClient client2;
+  CHECK(client2.deserialize(buffer));
+
+  AdBlockClient *clients[] = { &client, &client2 };
+  for (AdBlockClient *c : clients) {
+    // Warm up
+    int expectedBlocks = sweepSiteList(c, sites);
+    CHECK(expectedBlocks > 0);
+
+    numAllocations = 0;
+    countAllocations = true;
+    int numBlocks = sweepSiteList(c, sites);
+    countAllocations = false;
+    CHECK(compareNums(numBlocks, expectedBlocks));
+    CHECK(compareNums(numAllocations, 0));
+
+    // At most one lowercased copy for each of the 4 checks of a long URL
+    sweepSiteList(c, longSites);
+    numAllocations = 0;
+    countAllocations = true;
+    sweepSiteList(c, longSites);
+    countAllocations = false;
+    CHECK(numAllocations <= static_cast<int>(longSites.size()) * 4);
+  }
+  delete[] buffer;
+}
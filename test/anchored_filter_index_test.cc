@@ -0,0 +1,131 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <string.h>
+#include <vector>
+#include "./ad_block_client.h"
+#include "./anchored_filter_index.h"
+#include "./match_request.h"
+#include "./CppUnitLite/TestHarness.h"
+#include "./CppUnitLite/Test.h"
+#include "./util.h"
+
+// Returns the ids of the indexed filters which |index| finds for |url|, in
+// order
+static std::vector<int> findCandidates(const AnchoredFilterIndex &index,
+    const char *url) {
+  MatchRequest request(url, static_cast<int>(strlen(url)), FOImage,
+      "example.org", 11);
+  uint64_t candidates[1] = {};
+  index.findCandidates(request, candidates);
+  std::vector<int> found;
+  for (int i = 0; i < 64; i++) {
+    if (candidates[0] >> i & 1) {
+      found.push_back(i);
+    }
+  }
+  return found;
+}
+
+static const char *rules[] = { "|https://ads.", "|http://", ".swf|",
+  "/ad.php|", "|http://example.com/|", "/ad.", "|HTTP://Ads.$match-case",
+  "|https://ads." };
+static const int kNumRules = sizeof(rules) / sizeof(rules[0]);
+
+TEST(anchoredFilterIndex, findsAnchoredFilters) {
+  Filter filters[kNumRules];
+  for (int i = 0; i < kNumRules; i++) {
+    parseFilter(rules[i], filters + i);
+  }
+  CHECK(!AnchoredFilterIndex::isIndexed(filters[5]));
+  AnchoredFilterIndex index;
+  CHECK(!index.isBuilt());
+  index.build(filters, kNumRules);
+  CHECK(index.isBuilt());
+
+  std::vector<int> expected = { 1, 4 };
+  CHECK(findCandidates(index, "http://example.com/") == expected);
+  // The whole URL filter is a candidate for any URL it's a prefix of
+  CHECK(findCandidates(index, "http://example.com/a") == expected);
+  expected = { 1, 6 };
+  CHECK(findCandidates(index, "HTTP://ADS.example.org/") == expected);
+  // Filters with the same data are all found
+  expected = { 0, 7 };
+  CHECK(findCandidates(index, "https://ads.example.org/") == expected);
+  expected = { 2 };
+  CHECK(findCandidates(index, "https://example.org/movie.SWF") == expected);
+  expected = { 1, 3 };
+  CHECK(findCandidates(index, "http://example.org/ad.php") == expected);
+  CHECK(findCandidates(index, "ftp://example.org/ad.php?x") ==
+      std::vector<int>());
+  CHECK(findCandidates(index, "") == std::vector<int>());
+
+  index.clear();
+  CHECK(!index.isBuilt());
+}
+
+TEST(anchoredFilterIndex, serialize) {
+  Filter filters[kNumRules];
+  for (int i = 0; i < kNumRules; i++) {
+    parseFilter(rules[i], filters + i);
+  }
+  AnchoredFilterIndex index;
+  CHECK(compareNums(index.Serialize(nullptr), 0));
+  index.build(filters, kNumRules);
+  const uint32_t size = index.Serialize(nullptr);
+  char *buffer = new char[size];
+  CHECK(compareNums(index.Serialize(buffer), size));
+
+  AnchoredFilterIndex index2;
+  CHECK(compareNums(index2.Deserialize(buffer, size, kNumRules), size));
+  CHECK(compareNums(index2.getNumNodes(), index.getNumNodes()));
+  std::vector<int> expected = { 0, 2, 7 };
+  CHECK(findCandidates(index2, "https://ads.example.org/x.swf") ==
+      expected);
+
+  // Not for a shorter list, nor from a truncated buffer
+  CHECK(compareNums(index2.Deserialize(buffer, size, kNumRules - 1), 0));
+  CHECK(!index2.isBuilt());
+  CHECK(compareNums(index2.Deserialize(buffer, size - 1, kNumRules), 0));
+  CHECK(!index2.isBuilt());
+  delete[] buffer;
+}
+
+// Clients find the anchored filters without a fingerprint by the index and
+// save it in the data file
+TEST(anchoredFilterIndex, client) {
+  AdBlockClient client;
+  client.parse("|http://$third-party\n"
+      ".swf|\n"
+      "@@|https://$image\n");
+  CHECK(compareNums(client.numNoFingerprintFilters, 2));
+  CHECK(compareNums(client.numNoFingerprintExceptionFilters, 1));
+  CHECK(client.noFingerprintMatcher.getAnchoredFilterIndex().isBuilt());
+  CHECK(client.noFingerprintExceptionMatcher.getAnchoredFilterIndex()
+      .isBuilt());
+
+  int size;
+  char *buffer = client.serialize(&size);
+  AdBlockClient client2;
+  CHECK(client2.deserialize(buffer));
+  AdBlockClient *clients[] = { &client, &client2 };
+  for (AdBlockClient *c : clients) {
+    CHECK(c->matches("http://example.com/x.js", FOScript, "example.org"));
+    CHECK(!c->matches("http://example.com/x.js", FOScript, "example.com"));
+    CHECK(c->matches("https://example.com/ADFRAME.swf", FOObject,
+          "example.com"));
+    CHECK(!c->matches("https://example.com/adframe.swf?x", FOObject,
+          "example.com"));
+    // Only images are excepted, and not over http
+    CHECK(!c->matches("https://example.com/adframe.swf", FOImage,
+          "example.com"));
+    CHECK(c->matches("http://example.com/adframe.swf", FOImage,
+          "example.com"));
+  }
+  CHECK(compareNums(
+        client2.noFingerprintMatcher.getAnchoredFilterIndex().getNumNodes(),
+        client.noFingerprintMatcher.getAnchoredFilterIndex().getNumNodes()));
+  delete[] buffer;
+}
@@ -0,0 +1,137 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <string.h>
+#include <string>
+#include <vector>
+#include "./ad_block_client.h"
+#include "./filter_hit_counts.h"
+#include "./CppUnitLite/TestHarness.h"
+#include "./CppUnitLite/Test.h"
+#include "./util.h"
+
+using std::string;
+
+static bool filterDataIs(const Filter &filter, const char *data) {
+  return filter.dataLen == static_cast<int>(strlen(data)) &&
+    !memcmp(filter.data, data, filter.dataLen);
+}
+
+TEST(filterHitCounts, mostHitsFirst) {
+  AdBlockClient client;
+  client.parse("qbanner1.js\nqba*nner2.js\nqbanner3.js\nqbanner4.js\n");
+  CHECK(compareNums(client.numFilters, 4));
+  CHECK(filterDataIs(client.filters[0], "qbanner1.js"));
+
+  FilterHitCounts hitCounts;
+  CHECK(!hitCounts.isCounting());
+  hitCounts.start(client.numFilters);
+  CHECK(hitCounts.isCounting());
+  hitCounts.increment(1);
+  hitCounts.increment(2);
+  hitCounts.increment(3);
+  hitCounts.increment(3);
+  CHECK(compareNums(static_cast<int>(hitCounts.get(3)), 2));
+  CHECK(compareNums(static_cast<int>(hitCounts.get(0)), 0));
+  int order[4];
+  hitCounts.findOrder(client.filters, order);
+  // The wildcard filter costs more than the other one with a single hit
+  CHECK(compareNums(order[0], 3));
+  CHECK(compareNums(order[1], 2));
+  CHECK(compareNums(order[2], 1));
+  CHECK(compareNums(order[3], 0));
+  hitCounts.clear();
+  CHECK(!hitCounts.isCounting());
+}
+
+TEST(filterHitCounts, reordersFilters) {
+  const char *url = "http://example.com/qbanner3.js";
+  AdBlockClient client;
+  client.parse("qbanner1.js\nqbanner2.js\nqbanner3.js\n"
+      "@@qbanner3.js$domain=a.com\n");
+  // Nothing is counted until counting is started
+  client.matches(url, FOScript, "brianbondy.com");
+  client.reorderFilters();
+  CHECK(filterDataIs(client.filters[0], "qbanner1.js"));
+
+  client.startFilterHitCounting();
+  for (int i = 0; i < 3; i++) {
+    CHECK(client.matches(url, FOScript, "brianbondy.com"));
+  }
+  CHECK(client.matches("http://example.com/qbanner2.js", FOScript,
+        "brianbondy.com"));
+  CHECK(!client.matches(url, FOScript, "a.com"));
+  client.reorderFilters();
+  CHECK(filterDataIs(client.filters[0], "qbanner3.js"));
+  CHECK(filterDataIs(client.filters[1], "qbanner2.js"));
+  CHECK(filterDataIs(client.filters[2], "qbanner1.js"));
+  CHECK(client.matches(url, FOScript, "brianbondy.com"));
+  CHECK(client.matches("http://example.com/qbanner1.js", FOScript,
+        "brianbondy.com"));
+  CHECK(!client.matches(url, FOScript, "a.com"));
+
+  // The new order is written to data files
+  int size;
+  char *buffer = client.serialize(&size);
+  AdBlockClient client2;
+  CHECK(client2.deserialize(buffer));
+  CHECK(filterDataIs(client2.filters[0], "qbanner3.js"));
+  CHECK(client2.matches(url, FOScript, "brianbondy.com"));
+
+  // Filters which point into the data file can be reordered too
+  client2.startFilterHitCounting();
+  CHECK(client2.matches("http://example.com/qbanner1.js", FOScript,
+        "brianbondy.com"));
+  client2.reorderFilters();
+  CHECK(filterDataIs(client2.filters[0], "qbanner1.js"));
+  CHECK(filterDataIs(client2.filters[1], "qbanner3.js"));
+  CHECK(client2.matches(url, FOScript, "brianbondy.com"));
+  CHECK(!client2.matches(url, FOScript, "a.com"));
+  CHECK(!client2.matches("http://example.com/qbanner.js", FOScript,
+        "brianbondy.com"));
+  delete[] buffer;
+}
+
+TEST(filterHitCounts, frozenOrder) {
+  const char *url = "http://example.com/qbanner2.js";
+  AdBlockClient client;
+  client.parse("qbanner1.js\nqbanner2.js\n");
+  client.startFilterHitCounting();
+  client.setFilterOrderFrozen(true);
+  CHECK(client.isFilterOrderFrozen());
+  CHECK(client.matches(url, FOScript, "brianbondy.com"));
+  client.reorderFilters();
+  CHECK(filterDataIs(client.filters[0], "qbanner1.js"));
+  client.startFilterHitCounting();
+  CHECK(client.matches(url, FOScript, "brianbondy.com"));
+  client.reorderFilters();
+  CHECK(filterDataIs(client.filters[0], "qbanner1.js"));
+
+  client.setFilterOrderFrozen(false);
+  client.startFilterHitCounting();
+  CHECK(client.matches(url, FOScript, "brianbondy.com"));
+  client.reorderFilters();
+  CHECK(filterDataIs(client.filters[0], "qbanner2.js"));
+}
+
+// Reordering only changes which filter is found first, never whether a
+// request is blocked.
+TEST(filterHitCounts, sameAsBeforeReordering) {
+  string && easyListTxt = // NOLINT
+    getFileContents("./test/data/easylist.txt");
+  AdBlockClient client;
+  client.parse(easyListTxt.c_str());
+  AdBlockClient reorderedClient;
+  reorderedClient.parse(easyListTxt.c_str());
+
+  reorderedClient.startFilterHitCounting();
+  for (const string &url : getSiteListUrls(1000)) {
+    reorderedClient.matches(url.c_str(), FOScript, "slashdot.org");
+  }
+  reorderedClient.reorderFilters();
+  CHECK(sameMatchesForSiteList(1000, { FOScript },
+        { "slashdot.org", "www.cnn.com", "imgur.com" }, &reorderedClient,
+        &client));
+}
@@ -0,0 +1,156 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <string.h>
+#include <string>
+#include <vector>
+#include "./ad_block_client.h"
+#include "./fingerprint_automaton.h"
+#include "./CppUnitLite/TestHarness.h"
+#include "./CppUnitLite/Test.h"
+#include "./util.h"
+
+using std::string;
+
+// Runs |automaton| over |input| and returns the filter ids found at each
+// fingerprint end, in order.
+static std::vector<int> scan(const FingerprintAutomaton &automaton,
+    const char *input) {
+  std::vector<int> found;
+  int state = FingerprintAutomaton::kRootState;
+  for (const char *p = input; *p; p++) {
+    state = automaton.next(state, *p);
+    int numIds;
+    const int *ids = automaton.filterIds(state, &numIds);
+    found.insert(found.end(), ids, ids + numIds);
+  }
+  return found;
+}
+
+TEST(fingerprintAutomaton, findsOverlappingFingerprints) {
+  const char *rules[] = { "zqxjkv", "qxjkvw", "zqxjkv$image", "xjkvwy^" };
+  const int kNumRules = sizeof(rules) / sizeof(rules[0]);
+  Filter filters[kNumRules];
+  for (int i = 0; i < kNumRules; i++) {
+    parseFilter(rules[i], filters + i);
+  }
+  FingerprintAutomaton automaton;
+  CHECK(!automaton.isBuilt());
+  CHECK(automaton.build(filters, kNumRules));
+  CHECK(automaton.isBuilt());
+
+  // Fingerprints which share a prefix share their states
+  CHECK(compareNums(automaton.getNumStates(), 1 + 6 + 6 + 6));
+  CHECK(scan(automaton, "http://example.com/") == std::vector<int>());
+  // Each fingerprint is found through the fail links of the one before
+  std::vector<int> expected = { 0, 2, 1, 3 };
+  CHECK(scan(automaton, "http://example.com/zqxjkvwy.js") == expected);
+  expected = { 0, 2, 0, 2 };
+  CHECK(scan(automaton, "zqxjkvzqxjkv") == expected);
+  // Bytes which aren't in any fingerprint go back to the root
+  CHECK(scan(automaton, "zqx?jkvw") == std::vector<int>());
+
+  // A filter without a fingerprint can't be found by the automaton
+  Filter noFingerprint;
+  parseFilter("/ad.", &noFingerprint);
+  CHECK(!automaton.build(&noFingerprint, 1));
+  CHECK(!automaton.isBuilt());
+}
+
+TEST(fingerprintAutomaton, serializeAndDeserialize) {
+  const char *rules[] = { "zqxjkv", "qxjkvw", "zqxjkv$image", "xjkvwy^" };
+  const int kNumRules = sizeof(rules) / sizeof(rules[0]);
+  Filter filters[kNumRules];
+  for (int i = 0; i < kNumRules; i++) {
+    parseFilter(rules[i], filters + i);
+  }
+  FingerprintAutomaton automaton;
+  CHECK(automaton.build(filters, kNumRules));
+  uint32_t size = automaton.Serialize(nullptr);
+  char *buffer = new char[size];
+  CHECK(compareNums(automaton.Serialize(buffer), size));
+
+  FingerprintAutomaton automaton2;
+  CHECK(compareNums(automaton2.Deserialize(buffer, size, kNumRules), size));
+  CHECK(compareNums(automaton2.getNumStates(), automaton.getNumStates()));
+  CHECK(scan(automaton2, "zqxjkvwy") == scan(automaton, "zqxjkvwy"));
+
+  // Truncated data and filter ids past the end of the list are rejected
+  CHECK(compareNums(automaton2.Deserialize(buffer, size - 1, kNumRules),
+        0));
+  CHECK(!automaton2.isBuilt());
+  CHECK(compareNums(automaton2.Deserialize(buffer, size, 2), 0));
+  CHECK(!automaton2.isBuilt());
+  delete[] buffer;
+}
+
+// Data files keep the automatons of a client which has them enabled, and
+// clients without them skip them.
+TEST(fingerprintAutomaton, dataFiles) {
+  const char *rules = "zqxjkv\n"
+    "@@/zqxjkv/ok$image\n"
+    "||ads.example.com^\n";
+  AdBlockClient client;
+  client.setFingerprintAutomatonEnabled(true);
+  client.parse(rules);
+  CHECK(client.fingerprintAutomaton.isBuilt());
+  CHECK(client.exceptionFingerprintAutomaton.isBuilt());
+  int size;
+  char *buffer = client.serialize(&size);
+
+  AdBlockClient client2;
+  client2.setFingerprintAutomatonEnabled(true);
+  CHECK(client2.deserialize(buffer));
+  CHECK(client2.fingerprintAutomaton.isBuilt());
+  CHECK(compareNums(client2.fingerprintAutomaton.getNumStates(),
+        client.fingerprintAutomaton.getNumStates()));
+
+  AdBlockClient client3;
+  CHECK(client3.deserialize(buffer));
+  CHECK(!client3.fingerprintAutomaton.isBuilt());
+  client3.setFingerprintAutomatonEnabled(true);
+  CHECK(client3.fingerprintAutomaton.isBuilt());
+
+  // Data files written without the automaton get it built when loaded
+  AdBlockClient plainClient;
+  plainClient.parse(rules);
+  int plainSize;
+  char *plainBuffer = plainClient.serialize(&plainSize);
+  CHECK(plainSize < size);
+  AdBlockClient client4;
+  client4.setFingerprintAutomatonEnabled(true);
+  CHECK(client4.deserialize(plainBuffer));
+  CHECK(client4.fingerprintAutomaton.isBuilt());
+
+  AdBlockClient *clients[] = { &client, &client2, &client3, &client4 };
+  for (AdBlockClient *c : clients) {
+    CHECK(c->matches("http://example.com/zqxjkv/a.gif", FOImage,
+          "brianbondy.com"));
+    CHECK(!c->matches("http://example.com/zqxjkv/ok.gif", FOImage,
+          "brianbondy.com"));
+    CHECK(c->matches("http://ads.example.com/a.gif", FOImage,
+          "brianbondy.com"));
+    CHECK(!c->matches("http://example.com/zqxjk/a.gif", FOImage,
+          "brianbondy.com"));
+  }
+  delete[] plainBuffer;
+  delete[] buffer;
+}
+
+// The automaton finds the same filters as the fingerprint postings
+TEST(fingerprintAutomaton, sameAsPostings) {
+  string && easyListTxt = // NOLINT
+    getFileContents("./test/data/easylist.txt");
+  AdBlockClient client;
+  client.setFingerprintAutomatonEnabled(true);
+  client.parse(easyListTxt.c_str());
+  CHECK(client.fingerprintAutomaton.isBuilt());
+  AdBlockClient postingsClient;
+  postingsClient.parse(easyListTxt.c_str());
+  CHECK(!postingsClient.fingerprintAutomaton.isBuilt());
+  CHECK(sameMatchesForSiteList(2000, { FOScript },
+        { "slashdot.org", "www.cnn.com", "imgur.com" }, &client,
+        &postingsClient));
+}
@@ -0,0 +1,181 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <stdio.h>
+#include <string.h>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "./ad_block_client.h"
+#include "./host_suffix_trie.h"
+#include "./CppUnitLite/TestHarness.h"
+#include "./CppUnitLite/Test.h"
+#include "./util.h"
+
+using std::cout;
+using std::endl;
+using std::string;
+
+static uint8_t findSuffixes(const HostSuffixTrie &trie, const char *host,
+    uint8_t mask, std::vector<int> *starts) {
+  int suffixStarts[8];
+  int numSuffixes = 0;
+  uint8_t flags = trie.findSuffixes(host, static_cast<int>(strlen(host)),
+      mask, suffixStarts, 8, &numSuffixes);
+  starts->assign(suffixStarts, suffixStarts + numSuffixes);
+  return flags;
+}
+
+TEST(hostSuffixTrie, findsLabelSuffixes) {
+  HostSuffixTrie trie;
+  CHECK(!trie.isBuilt());
+  trie.add("example.com", 11, HostSuffixTrie::kHostAnchored);
+  CHECK(!trie.isBuilt());
+  trie.init();
+  trie.add("example.com", 11, HostSuffixTrie::kHostAnchored);
+  trie.add("ads.example.com", 15, HostSuffixTrie::kHostAnchored);
+  trie.add("ads.example.com", 15, HostSuffixTrie::kNoFingerprintDomain);
+  trie.add("com", 3, HostSuffixTrie::kHostAnchored);
+  trie.add("localhost", 9, HostSuffixTrie::kHostAnchoredException);
+  CHECK(trie.isBuilt());
+
+  std::vector<int> starts;
+  CHECK(findSuffixes(trie, "x.ads.example.com",
+        HostSuffixTrie::kHostAnchored, &starts) ==
+      HostSuffixTrie::kHostAnchored);
+  // Shortest first, and the TLD on its own is skipped
+  CHECK(compareNums(static_cast<int>(starts.size()), 2));
+  if (starts.size() == 2) {
+    CHECK(compareNums(starts[0], 6));
+    CHECK(compareNums(starts[1], 2));
+  }
+  CHECK(findSuffixes(trie, "x.ads.example.com",
+        HostSuffixTrie::kHostAnchored | HostSuffixTrie::kNoFingerprintDomain,
+        &starts) ==
+      (HostSuffixTrie::kHostAnchored | HostSuffixTrie::kNoFingerprintDomain));
+  CHECK(compareNums(static_cast<int>(starts.size()), 2));
+  CHECK(!findSuffixes(trie, "x.ads.example.com",
+        HostSuffixTrie::kHostAnchoredException, &starts));
+  CHECK(starts.empty());
+
+  // Labels have to match whole
+  CHECK(!findSuffixes(trie, "badexample.com",
+        HostSuffixTrie::kHostAnchored, &starts));
+  CHECK(!findSuffixes(trie, "example.co", HostSuffixTrie::kHostAnchored,
+        &starts));
+  CHECK(!findSuffixes(trie, "example.com.au", HostSuffixTrie::kHostAnchored,
+        &starts));
+  CHECK(!findSuffixes(trie, "", HostSuffixTrie::kHostAnchored, &starts));
+
+  // A single label is found when it is the whole host
+  CHECK(findSuffixes(trie, "com", HostSuffixTrie::kHostAnchored, &starts));
+  CHECK(findSuffixes(trie, "localhost",
+        HostSuffixTrie::kHostAnchoredException, &starts));
+  CHECK(!findSuffixes(trie, "a.localhost",
+        HostSuffixTrie::kHostAnchoredException, &starts));
+}
+
+TEST(hostSuffixTrie, serializes) {
+  HostSuffixTrie trie;
+  trie.init();
+  // Enough hosts for the node array and the slots to grow
+  char host[64];
+  for (int i = 0; i < 5000; i++) {
+    snprintf(host, sizeof(host), "h%d.example%d.com", i, i % 100);
+    trie.add(host, static_cast<int>(strlen(host)),
+        i % 2 ? HostSuffixTrie::kHostAnchored :
+        HostSuffixTrie::kNoFingerprintAntiDomain);
+  }
+  CHECK(compareNums(trie.getNumNodes(), 5102));
+
+  uint32_t size = trie.Serialize(nullptr);
+  char *buffer = new char[size];
+  CHECK(trie.Serialize(buffer) == size);
+  HostSuffixTrie trie2;
+  CHECK(trie2.Deserialize(buffer, size) == size);
+  CHECK(compareNums(trie2.getNumNodes(), trie.getNumNodes()));
+  CHECK(!HostSuffixTrie().Deserialize(buffer, size - 1));
+
+  std::vector<int> starts;
+  for (int i = 0; i < 5000; i += 7) {
+    snprintf(host, sizeof(host), "a.h%d.example%d.com", i, i % 100);
+    uint8_t expected = i % 2 ? HostSuffixTrie::kHostAnchored :
+      HostSuffixTrie::kNoFingerprintAntiDomain;
+    CHECK(findSuffixes(trie2, host, 0xff, &starts) == expected);
+    CHECK(compareNums(static_cast<int>(starts.size()), 1));
+  }
+  CHECK(!findSuffixes(trie2, "h1.example2.com", 0xff, &starts));
+
+  // Hosts can still be added after loading
+  trie2.add("example2.com", 12, HostSuffixTrie::kHostAnchoredException);
+  CHECK(findSuffixes(trie2, "h2.example2.com", 0xff, &starts) ==
+      (HostSuffixTrie::kHostAnchoredException |
+       HostSuffixTrie::kNoFingerprintAntiDomain));
+  delete[] buffer;
+}
+
+// The trie gives the same results as looking up every suffix in the hash
+// sets, for hosts and context domains which are in the lists, their
+// subdomains and their parent domains.
+TEST(hostSuffixTrie, sameAsHashSets) {
+  const char *rules = "||doubleclick.net^\n"
+      "||ads.example.co.uk/banner\n"
+      "@@||ok.doubleclick.net^$script\n"
+      "adv$domain=example.com|~foo.example.com\n"
+      "promo$domain=~co.uk\n"
+      "@@/adv/ok$domain=b.example.com\n";
+  AdBlockClient client;
+  client.parse(rules);
+  AdBlockClient hashSetClient;
+  hashSetClient.parse(rules);
+  CHECK(hashSetClient.hostSuffixTrie.isBuilt());
+  hashSetClient.hostSuffixTrie.clear();
+
+  const char *urls[] = {
+    "http://doubleclick.net/a.js",
+    "http://x.ad.doubleclick.net/a.js",
+    "http://ok.doubleclick.net/a.js",
+    "http://a.ok.doubleclick.net/a.js",
+    "http://net/a.js",
+    "http://ads.example.co.uk/banner.gif",
+    "http://x.ads.example.co.uk/banner.gif",
+    "http://example.co.uk/banner.gif",
+    "http://cdn.org/adv/ok.js",
+    "http://cdn.org/promo.js",
+  };
+  const char *domains[] = { "example.com", "a.foo.example.com",
+    "b.example.com", "www.dailymail.co.uk", "co.uk", "com" };
+  // Blocked on each of the domains, one string per URL
+  const char *expected[] = {
+    "111111",
+    "111111",
+    "000000",
+    "000000",
+    "000000",
+    "111111",
+    "111111",
+    "000000",
+    "100000",
+    "111001",
+  };
+  for (size_t i = 0; i < sizeof(urls) / sizeof(urls[0]); i++) {
+    for (size_t j = 0; j < sizeof(domains) / sizeof(domains[0]); j++) {
+      const bool matches = client.matches(urls[i], FOScript, domains[j]);
+      Filter *filter, *hashSetFilter;
+      Filter *exceptionFilter, *hashSetExceptionFilter;
+      client.findMatchingFilters(urls[i], FOScript, domains[j], &filter,
+          &exceptionFilter);
+      hashSetClient.findMatchingFilters(urls[i], FOScript, domains[j],
+          &hashSetFilter, &hashSetExceptionFilter);
+      if (matches != (expected[i][j] == '1') ||
+          matches != hashSetClient.matches(urls[i], FOScript, domains[j])) {
+        cout << "Mismatch for " << urls[i] << " on " << domains[j] << endl;
+        CHECK(false);
+      }
+      CHECK(!filter == !hashSetFilter);
+      CHECK(!exceptionFilter == !hashSetExceptionFilter);
+    }
+  }
+}
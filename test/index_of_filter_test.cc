@@ -0,0 +1,180 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <string.h>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "./ad_block_client.h"
+#include "./index_of_filter.h"
+#include "./url_lexer.h"
+#include "./CppUnitLite/TestHarness.h"
+#include "./CppUnitLite/Test.h"
+#include "./util.h"
+
+using std::cout;
+using std::endl;
+using std::string;
+
+static int indexOf(const string &input, const char *filter,
+    bool scalar = false) {
+  const int inputLen = static_cast<int>(input.length());
+  const char *filterEnd = filter + strlen(filter);
+  return scalar ?
+    indexOfFilterScalar(input.c_str(), inputLen, filter, filterEnd) :
+    indexOfFilter(input.c_str(), inputLen, filter, filterEnd);
+}
+
+// Checks both versions, the one using a separator bitmap, and
+// indexOfLiteral for filters without '^', against the expected result and
+// returns true if they all agree with it.
+static bool checkIndexOf(const string &input, const char *filter,
+    int expected) {
+  const int inputLen = static_cast<int>(input.length());
+  int scalarResult = indexOf(input, filter, true);
+  int result = indexOf(input, filter);
+  SeparatorBitmap separators;
+  findSeparators(input.c_str(), inputLen, &separators);
+  int bitmapResult = indexOfFilter(input.c_str(), inputLen, filter,
+      filter + strlen(filter), separators, 0);
+  int literalResult = strchr(filter, '^') ? expected :
+    indexOfLiteral(input.c_str(), inputLen, filter,
+        static_cast<int>(strlen(filter)));
+  if (scalarResult != expected || result != expected ||
+      bitmapResult != expected || literalResult != expected) {
+    cout << "indexOfFilter(\"" << input << "\", \"" << filter
+      << "\") expected " << expected << " scalar: " << scalarResult
+      << " actual: " << result << " bitmap: " << bitmapResult
+      << " literal: " << literalResult << endl;
+    return false;
+  }
+  return true;
+}
+
+// Searched while the static initializers of the test binary run, which may
+// be before those of index_of_filter.cc
+static const int literalIndexAtStartup =
+  indexOfLiteral("https://example.com/ads/a.js", 28, "/ads/", 5);
+
+TEST(indexOfFilter, searchesDuringStaticInitialization) {
+  CHECK(compareNums(literalIndexAtStartup, 19));
+}
+
+TEST(indexOfFilter, separatorsAndEnds) {
+  const string padding(40, 'x');
+  CHECK(checkIndexOf("abc", "abc", 0));
+  CHECK(checkIndexOf("xabc", "abc", 1));
+  CHECK(checkIndexOf("ab", "abc", -1));
+  CHECK(checkIndexOf("abc", "", 0));
+  CHECK(checkIndexOf("", "", -1));
+  CHECK(checkIndexOf("/abc/", "^", -1));
+  CHECK(checkIndexOf("/abc/", "^abc^", 0));
+  CHECK(checkIndexOf("x/abc", "^abc^", 1));
+  CHECK(checkIndexOf("/abc", "^abc^", -1));
+  CHECK(checkIndexOf("/abcd/", "^abc^", -1));
+  CHECK(checkIndexOf("a^c", "a^c", 0));
+  CHECK(checkIndexOf("a.c", "a^c", -1));
+  CHECK(checkIndexOf("a/c", "a^c", 0));
+  CHECK(checkIndexOf("xyz?", "^^", 3));
+  CHECK(checkIndexOf("xyz", "^^", -1));
+  CHECK(checkIndexOf("ab", "b^c", -1));
+  CHECK(checkIndexOf("abab", "ab^", 2));
+
+  // Long enough for the vector loops, with matches near the end and past it
+  CHECK(checkIndexOf(padding + "ad/banner", "/banner", 42));
+  CHECK(checkIndexOf(padding + "ad/banner", "banner^", 43));
+  CHECK(checkIndexOf(padding + "ad/banne", "banner^", -1));
+  CHECK(checkIndexOf(padding + "ab", "ab", 40));
+  CHECK(checkIndexOf(padding + "a", "ab", -1));
+  CHECK(checkIndexOf(padding + padding + "ab", "^ab", -1));
+  CHECK(checkIndexOf(padding + "/" + padding + "ab/", "^ab^", -1));
+  CHECK(checkIndexOf(padding + "/ab/" + padding, "^ab^", 40));
+  CHECK(checkIndexOf(padding + "/ab" + padding + "/ab", "^ab^", 83));
+}
+
+// Both versions must agree on every wildcard part of the easylist filters,
+// searched in real URLs and in URLs built to contain the part.
+TEST(indexOfFilter, sameAsScalarForEasyList) {
+  string && easyListTxt = // NOLINT
+    getFileContents("./test/data/easylist.txt");
+
+  std::vector<string> parts;
+  std::stringstream lines(easyListTxt);
+  string line;
+  while (std::getline(lines, line)) {
+    Filter f;
+    parseFilter(line.c_str(), &f);
+    if (f.filterType & (FTElementHiding | FTElementHidingException |
+          FTHTMLFiltering | FTComment | FTEmpty | FTHostOnly | FTRegex) ||
+        !f.data || f.dataLen <= 0) {
+      continue;
+    }
+    std::stringstream filterParts(string(f.data, f.dataLen));
+    string part;
+    while (std::getline(filterParts, part, '*')) {
+      if (!part.empty()) {
+        parts.push_back(part);
+      }
+    }
+  }
+  CHECK(parts.size() > 10000);
+
+  const std::vector<string> urls = getSiteListUrls(100);
+
+  int numMatches = 0;
+  int numMismatches = 0;
+  auto check = [&](const string &input, const string &part) {
+    const char *filterBegin = part.c_str();
+    const char *filterEnd = filterBegin + part.length();
+    const int inputLen = static_cast<int>(input.length());
+    int expected = indexOfFilterScalar(input.c_str(), inputLen,
+        filterBegin, filterEnd);
+    int result = indexOfFilter(input.c_str(), inputLen, filterBegin,
+        filterEnd);
+    if (expected != -1) {
+      numMatches++;
+    }
+    if (result != expected && numMismatches++ < 10) {
+      cout << "indexOfFilter(\"" << input << "\", \"" << part
+        << "\") expected " << expected << " actual: " << result << endl;
+    }
+    if (part.find('^') == string::npos) {
+      result = indexOfLiteral(input.c_str(), inputLen, filterBegin,
+          static_cast<int>(part.length()));
+      if (result != expected && numMismatches++ < 10) {
+        cout << "indexOfLiteral(\"" << input << "\", \"" << part
+          << "\") expected " << expected << " actual: " << result << endl;
+      }
+    }
+  };
+
+  for (const string &part : parts) {
+    for (const string &url : urls) {
+      check(url, part);
+    }
+    // The part itself with each ^ as a separator, at different offsets and
+    // cut off at the end so that trailing ^ run past the input.
+    string matching = part;
+    for (char &c : matching) {
+      if (c == '^') {
+        c = '/';
+      }
+    }
+    const string &url = urls[part.length() % urls.size()];
+    for (size_t offset = 0; offset < 40 && offset < url.length();
+        offset += 13) {
+      string input = url.substr(0, offset) + matching + url.substr(offset);
+      check(input, part);
+      string cutOff = url.substr(0, offset) + matching;
+      while (!cutOff.empty() && cutOff.back() == '/') {
+        cutOff.pop_back();
+        check(cutOff, part);
+      }
+    }
+  }
+  CHECK(numMatches > 10000);
+  CHECK(compareNums(numMismatches, 0));
+}
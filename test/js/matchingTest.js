@@ -137,6 +137,30 @@ describe('matching', function () {
     })
   })
 
+  describe('findAllMatchingFilters return values', function () {
+    before(function () {
+      this.client = new AdBlockClient()
+      this.client.parse('/pubads_\n.net/ad2/\n/ad2/*/x.js\n@@||fastly.net/ad2/$image,script,xmlhttprequest', true)
+    })
+    it('match', function () {
+      const queryResult = this.client.findAllMatchingFilters('https://securepubads.g.doubleclick.net/gpt/pubads_impl_rendering_193.js?cb=194', FilterOptions.script, 'www.cnn.com')
+      assert.equal(queryResult.matches, true)
+      assert.deepEqual(queryResult.matchingFilters, [{filter: '/pubads_', origRule: '/pubads_'}])
+      assert.deepEqual(queryResult.matchingExceptionFilters, [])
+    })
+    it('miss', function () {
+      const queryResult = this.client.findAllMatchingFilters('https://cdn.cnn.com/cnn/.e1mo/img/4.0/logos/menu_entertainment.png', FilterOptions.image, 'www.cnn.com')
+      assert.equal(queryResult.matches, false)
+      assert.deepEqual(queryResult.matchingFilters, [])
+    })
+    it('whitelisted', function () {
+      const queryResult = this.client.findAllMatchingFilters('https://0914.global.ssl.fastly.net/ad2/script/x.js?cb=1523383475084', FilterOptions.script, 'www.cnn.com')
+      assert.equal(queryResult.matches, false)
+      assert.deepEqual(queryResult.matchingFilters.map((f) => f.filter).sort(), ['.net/ad2/', '/ad2/*/x.js'])
+      assert.deepEqual(queryResult.matchingExceptionFilters, [{filter: 'fastly.net/ad2/', origRule: '@@||fastly.net/ad2/$image,script,xmlhttprequest'}])
+    })
+  })
+
   describe('original filter rules', function () {
     describe('returning original filter rule', function () {
       before(function () {
@@ -455,4 +479,101 @@ describe('matching', function () {
       })
     })
   })
+  describe('matchesBatch', function () {
+    before(function () {
+      this.client = new AdBlockClient()
+      this.client.parse('||ads.example.com^\n@@||ads.example.com/allowed/\n/banner/*$image')
+      this.urls = [
+        'http://ads.example.com/a.js',
+        'http://www.brianbondy.com/banner/ad.gif',
+        'http://ads.example.com/allowed/b.js',
+        'http://www.brianbondy.com/banner/ad.gif'
+      ]
+    })
+    it('matches each URL with a single option', function () {
+      assert.deepEqual(this.client.matchesBatch(this.urls, FilterOptions.image, 'slashdot.org'),
+        [true, true, false, true])
+    })
+    it('matches each URL with its own option', function () {
+      const options = [FilterOptions.script, FilterOptions.image, FilterOptions.script, FilterOptions.script]
+      assert.deepEqual(this.client.matchesBatch(this.urls, options, 'slashdot.org'),
+        this.urls.map((url, i) => this.client.matches(url, options[i], 'slashdot.org')))
+      assert.deepEqual(this.client.matchesBatch(this.urls, options, 'slashdot.org'),
+        [true, true, false, false])
+    })
+    it('returns an empty array for no URLs', function () {
+      assert.deepEqual(this.client.matchesBatch([], FilterOptions.noFilterOption, 'slashdot.org'), [])
+    })
+  })
+  describe('match cache', function () {
+    before(function () {
+      this.client = new AdBlockClient()
+      this.client.parse('/banner/*$image')
+      this.client.enableMatchCache(100)
+    })
+    it('counts hits and misses', function () {
+      const url = 'http://www.brianbondy.com/banner/ad.gif'
+      assert(this.client.matches(url, FilterOptions.image, 'slashdot.org'))
+      assert(this.client.matches(url, FilterOptions.image, 'slashdot.org'))
+      assert(!this.client.matches(url, FilterOptions.script, 'slashdot.org'))
+      const stats = this.client.getMatchingStats()
+      assert.equal(stats.numMatchCacheHits, 1)
+      assert.equal(stats.numMatchCacheMisses, 2)
+      assert.equal(stats.numMatchCacheEntries, 2)
+    })
+    it('is emptied by parse', function () {
+      this.client.parse('/banner/*$script')
+      assert.equal(this.client.getMatchingStats().numMatchCacheEntries, 0)
+      assert(this.client.matches('http://www.brianbondy.com/banner/ad.js', FilterOptions.script, 'slashdot.org'))
+    })
+  })
+  describe('host decision cache', function () {
+    before(function () {
+      this.client = new AdBlockClient()
+      this.client.parse('||ads.example.com^\n/banner/*$image')
+      this.client.enableHostDecisionCache(100)
+    })
+    it('answers URLs of hosts decided by host only filters', function () {
+      this.client.warmHostDecisionCache(['ads.example.com'], FilterOptions.script, 'slashdot.org')
+      assert(this.client.matches('http://ads.example.com/a.js', FilterOptions.script, 'slashdot.org'))
+      assert(this.client.matches('http://www.brianbondy.com/banner/ad.gif', FilterOptions.image, 'slashdot.org'))
+      const stats = this.client.getMatchingStats()
+      assert.equal(stats.numHostDecisionSaves, 1)
+      assert.equal(stats.numHostDecisionCacheHits, 1)
+      assert.equal(stats.numHostDecisionCacheEntries, 2)
+    })
+  })
+  describe('fingerprint automaton', function () {
+    before(function () {
+      this.client = new AdBlockClient()
+      this.client.setFingerprintAutomatonEnabled(true)
+      this.client.parse('zqxjkv\n@@zqxjkv/ok$image')
+    })
+    it('matches the same as without it', function () {
+      assert(this.client.matches('http://www.brianbondy.com/zqxjkv/a.gif', FilterOptions.image, 'slashdot.org'))
+      assert(!this.client.matches('http://www.brianbondy.com/zqxjkv/ok.gif', FilterOptions.image, 'slashdot.org'))
+      assert(!this.client.matches('http://www.brianbondy.com/zqxjk/a.gif', FilterOptions.image, 'slashdot.org'))
+    })
+    it('is kept in data files', function () {
+      const data = this.client.serialize()
+      const client2 = new AdBlockClient()
+      client2.setFingerprintAutomatonEnabled(true)
+      client2.deserialize(data)
+      assert(client2.matches('http://www.brianbondy.com/zqxjkv/a.gif', FilterOptions.image, 'slashdot.org'))
+    })
+  })
+  describe('case', function () {
+    before(function () {
+      this.client = new AdBlockClient()
+      this.client.parse('/BannerAd.\n/TrackerPixel.$match-case')
+    })
+    it('ignores the case of filters and URLs', function () {
+      assert(this.client.matches('http://www.brianbondy.com/bannerad.gif', FilterOptions.image, 'slashdot.org'))
+      assert(this.client.matches('http://www.brianbondy.com/BANNERAD.GIF', FilterOptions.image, 'slashdot.org'))
+    })
+    it('keeps the case of match-case filters', function () {
+      assert(this.client.matches('http://www.brianbondy.com/TrackerPixel.gif', FilterOptions.image, 'slashdot.org'))
+      assert(!this.client.matches('http://www.brianbondy.com/trackerpixel.gif', FilterOptions.image, 'slashdot.org'))
+    })
+  })
 })
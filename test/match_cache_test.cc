@@ -0,0 +1,283 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <string.h>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>  // NOLINT
+#include <vector>
+#include "./ad_block_client.h"
+#include "./match_cache.h"
+#include "./match_request.h"
+#include "./CppUnitLite/TestHarness.h"
+#include "./CppUnitLite/Test.h"
+#include "./util.h"
+
+using std::cout;
+using std::endl;
+using std::string;
+
+TEST(matchCache, leastRecentlyUsedIsEvicted) {
+  // 2 entries in each of the 16 shards, keys below 2^56 are all in the
+  // first one.
+  MatchCache cache(32);
+  CHECK(compareNums(static_cast<int>(cache.getMaxEntries()), 32));
+  bool matches = false;
+  CHECK(!cache.find(1, &matches));
+  cache.add(1, true);
+  cache.add(2, false);
+  CHECK(cache.find(1, &matches));
+  CHECK(matches);
+  cache.add(3, true);
+  CHECK(!cache.find(2, &matches));
+  CHECK(cache.find(1, &matches));
+  CHECK(matches);
+  CHECK(cache.find(3, &matches));
+  CHECK(compareNums(static_cast<int>(cache.getNumEntries()), 2));
+  CHECK(compareNums(static_cast<int>(cache.getNumEvictions()), 1));
+  CHECK(compareNums(static_cast<int>(cache.getNumHits()), 3));
+  CHECK(compareNums(static_cast<int>(cache.getNumMisses()), 2));
+
+  // Updating a result doesn't add an entry
+  cache.add(3, false);
+  CHECK(cache.find(3, &matches));
+  CHECK(!matches);
+  CHECK(compareNums(static_cast<int>(cache.getNumEntries()), 2));
+
+  cache.clear();
+  CHECK(!cache.find(1, &matches));
+  CHECK(compareNums(static_cast<int>(cache.getNumEntries()), 0));
+}
+
+TEST(matchCache, keyCoversAllParts) {
+  const char *url = "http://example.com/ads.js";
+  const int len = static_cast<int>(strlen(url));
+  MatchCache cache(10);
+  uint64_t key = cache.hash(url, len, FOScript, "a.com", 5);
+  CHECK(key == cache.hash(url, len, FOScript, "a.com", 5));
+  CHECK(key != cache.hash(url, len - 1, FOScript, "a.com", 5));
+  CHECK(key != cache.hash(url, len, FOImage, "a.com", 5));
+  CHECK(key != cache.hash(url, len, FOScript, "b.com", 5));
+  CHECK(key != cache.hash(url, len, FOScript, nullptr, 0));
+  CHECK(cache.hash(url, len, FOScript, "", 0) !=
+      cache.hash(url, len, FOScript, nullptr, 0));
+  // Moving bytes from the URL to the context domain changes the key too
+  CHECK(cache.hash(url, len - 3, FOScript, ".js", 3) !=
+      cache.hash(url, len, FOScript, "", 0));
+
+  // Each cache has its own hash key, so keys can't be worked out ahead
+  MatchCache otherCache(10);
+  CHECK(key != otherCache.hash(url, len, FOScript, "a.com", 5));
+}
+
+TEST(matchCache, sizedByBytes) {
+  AdBlockClient client;
+  CHECK(!client.getMatchCache());
+  client.enableMatchCache(0, 1 << 20);
+  CHECK(client.getMatchCache());
+  CHECK(client.getMatchCache()->getMaxEntries() ==
+      MatchCache::entriesForBytes(1 << 20));
+  client.enableMatchCache(100, 1 << 20);
+  CHECK(compareNums(
+        static_cast<int>(client.getMatchCache()->getMaxEntries()), 100));
+  client.disableMatchCache();
+  CHECK(!client.getMatchCache());
+}
+
+// Changing the filters has to drop every cached result
+TEST(matchCache, invalidatedByParseAndDeserialize) {
+  const char *url = "http://example.com/qads.js";
+  AdBlockClient client;
+  client.enableMatchCache(1000);
+  client.parse("/qbanner/*");
+  CHECK(!client.matches(url, FOScript, "brianbondy.com"));
+  CHECK(!client.matches(url, FOScript, "brianbondy.com"));
+  CHECK(compareNums(static_cast<int>(client.getMatchCache()->getNumHits()),
+        1));
+
+  client.parse("qads.js");
+  CHECK(compareNums(
+        static_cast<int>(client.getMatchCache()->getNumEntries()), 0));
+  CHECK(client.matches(url, FOScript, "brianbondy.com"));
+
+  client.clear();
+  CHECK(compareNums(
+        static_cast<int>(client.getMatchCache()->getNumEntries()), 0));
+  CHECK(!client.matches(url, FOScript, "brianbondy.com"));
+
+  AdBlockClient client2;
+  client2.parse("qads.js");
+  int size;
+  char *buffer = client2.serialize(&size);
+  CHECK(client.deserialize(buffer));
+  CHECK(client.matches(url, FOScript, "brianbondy.com"));
+  delete[] buffer;
+}
+
+// Cached and uncached results agree, also when several threads share a
+// client and a cache which is too small for all of the URLs.
+TEST(matchCache, sameAsUncached) {
+  string && easyListTxt = // NOLINT
+    getFileContents("./test/data/easylist.txt");
+  AdBlockClient client;
+  client.parse(easyListTxt.c_str());
+  AdBlockClient cachedClient;
+  cachedClient.parse(easyListTxt.c_str());
+  cachedClient.enableMatchCache(500);
+
+  const std::vector<string> urls = getSiteListUrls(1000);
+  std::vector<bool> expected;
+  int numBlocks = 0;
+  for (const string &u : urls) {
+    expected.push_back(client.matches(u.c_str(), FOScript, "slashdot.org"));
+    numBlocks += expected.back();
+  }
+  CHECK(numBlocks > 0);
+
+  const int kNumThreads = 4;
+  int numMismatches[kNumThreads] = {};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kNumThreads; t++) {
+    threads.push_back(std::thread([&, t]() {
+      // Each URL is checked a few times in a row so some are hits
+      for (size_t i = 0; i < urls.size(); i++) {
+        for (int repeat = 0; repeat < 3; repeat++) {
+          if (cachedClient.matches(urls[i].c_str(), FOScript,
+                "slashdot.org") != expected[i]) {
+            numMismatches[t]++;
+          }
+        }
+      }
+    }));
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+  for (int t = 0; t < kNumThreads; t++) {
+    CHECK(compareNums(numMismatches[t], 0));
+  }
+  MatchCache *cache = cachedClient.getMatchCache();
+  CHECK(cache->getNumHits() > urls.size());
+  CHECK(cache->getNumEvictions() > 0);
+  CHECK(cache->getNumEntries() <= 500);
+  CHECK(compareNums(static_cast<int>(cache->getNumHits() +
+          cache->getNumMisses()),
+        static_cast<int>(urls.size()) * kNumThreads * 3));
+}
+
+// Host only filters decide every URL of a host, any other filter which could
+// accept the request means the URL has to be checked.
+TEST(hostDecisionCache, decidedByHostOnlyFilters) {
+  AdBlockClient client;
+  client.parse("||ads.example.com^\n"
+      "||tracker.net^$third-party\n"
+      "@@||ok.ads.example.com^\n"
+      "/banner/*$image\n");
+  const char *urls[] = {
+    "https://ads.example.com/a.js",
+    "https://ok.ads.example.com/a.js",
+    "https://clean.org/a.js",
+    "https://tracker.net/a.js",
+    "https://tracker.net/a.js",
+    "https://clean.org/banner/a.png",
+  };
+  const FilterOption options[] = { FOScript, FOScript, FOScript, FOScript,
+    FOScript, FOImage };
+  const char *contextDomains[] = { "a.com", "a.com", "a.com", "a.com",
+    "tracker.net", "a.com" };
+  const HostDecision expected[] = { HDBlock, HDAllow, HDAllow, HDBlock,
+    HDAllow, HDCheckUrl };
+  for (int i = 0; i < 6; i++) {
+    MatchRequest request(urls[i], static_cast<int>(strlen(urls[i])),
+        options[i], contextDomains[i],
+        static_cast<int>(strlen(contextDomains[i])));
+    HostDecision decision = client.findHostDecision(request);
+    if (decision != expected[i]) {
+      cout << "Wrong host decision for " << urls[i] << ": " << decision
+        << endl;
+    }
+    CHECK(decision == expected[i]);
+  }
+
+  client.enableHostDecisionCache(100);
+  const char *hosts[] = { "ads.example.com", "clean.org" };
+  client.warmHostDecisionCache(hosts, 2, FOScript, "a.com");
+  CHECK(compareNums(static_cast<int>(
+          client.getHostDecisionCache()->getNumEntries()), 2));
+  CHECK(client.matches("https://ads.example.com/b.js", FOScript, "a.com"));
+  CHECK(!client.matches("https://clean.org/b.js", FOScript, "a.com"));
+  CHECK(client.matches("https://clean.org/banner/b.png", FOImage, "a.com"));
+  CHECK(compareNums(static_cast<int>(client.numHostDecisionSaves), 2));
+  CHECK(compareNums(static_cast<int>(
+          client.getHostDecisionCache()->getNumHits()), 2));
+
+  client.parse("/b.js");
+  CHECK(compareNums(static_cast<int>(
+          client.getHostDecisionCache()->getNumEntries()), 0));
+  CHECK(client.matches("https://clean.org/b.js", FOScript, "a.com"));
+}
+
+// A matching host only block filter decides the host even when other block
+// filters could match its URLs, as long as no exception filter could.
+TEST(hostDecisionCache, hostOnlyBlockWithOtherFilters) {
+  AdBlockClient client;
+  client.parse("||ads.example.com^\n"
+      "/banner/*\n"
+      "@@/banner/ok$image\n");
+  const char *urls[] = {
+    "https://ads.example.com/a.js",
+    "https://ads.example.com/a.png",
+    "https://clean.org/a.js",
+  };
+  const FilterOption options[] = { FOScript, FOImage, FOScript };
+  const HostDecision expected[] = { HDBlock, HDCheckUrl, HDCheckUrl };
+  for (int i = 0; i < 3; i++) {
+    MatchRequest request(urls[i], static_cast<int>(strlen(urls[i])),
+        options[i], "a.com", 5);
+    CHECK(client.findHostDecision(request) == expected[i]);
+  }
+
+  client.enableHostDecisionCache(100);
+  CHECK(client.matches("https://ads.example.com/banner/ok.js", FOScript,
+        "a.com"));
+  CHECK(client.matches("https://ads.example.com/b.js", FOScript, "a.com"));
+  CHECK(!client.matches("https://ads.example.com/banner/ok.png", FOImage,
+        "a.com"));
+  CHECK(client.matches("https://clean.org/banner/a.js", FOScript, "a.com"));
+  CHECK(compareNums(static_cast<int>(client.numHostDecisionSaves), 2));
+}
+
+// Host decisions give the same results as checking every URL, for a list of
+// host only rules where most URLs are decided by their host, and for
+// EasyList where few are.
+TEST(hostDecisionCache, sameAsWithout) {
+  string && easyListTxt = // NOLINT
+    getFileContents("./test/data/easylist.txt");
+  string hostRules;
+  std::stringstream lines(easyListTxt);
+  string line;
+  while (std::getline(lines, line)) {
+    if ((!line.compare(0, 2, "||") || !line.compare(0, 4, "@@||")) &&
+        line.find('/') == string::npos && line.find('*') == string::npos) {
+      hostRules += line + "\n";
+    }
+  }
+
+  const string *lists[] = { &hostRules, &easyListTxt };
+  for (const string *list : lists) {
+    AdBlockClient client;
+    client.parse(list->c_str());
+    AdBlockClient decidingClient;
+    decidingClient.parse(list->c_str());
+    decidingClient.enableHostDecisionCache(1000);
+    CHECK(sameMatchesForSiteList(2000, { FOScript, FOImage },
+          { "slashdot.org" }, &decidingClient, &client));
+    CHECK(decidingClient.getHostDecisionCache()->getNumHits() > 0);
+    if (list == &hostRules) {
+      CHECK(decidingClient.numHostDecisionSaves > 2000);
+    }
+  }
+}
@@ -0,0 +1,199 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <string.h>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "./ad_block_client.h"
+#include "./match_request.h"
+#include "./CppUnitLite/TestHarness.h"
+#include "./CppUnitLite/Test.h"
+#include "./util.h"
+
+using std::cout;
+using std::endl;
+using std::string;
+
+// Testing the parts of a URL which are computed once per request
+TEST(matchRequest, spans) {
+  const char *url = "https://ads.example.co.uk/banner.gif?x=1";
+  MatchRequest request(url, static_cast<int>(strlen(url)), FOImage,
+      "example.co.uk", 13);
+  CHECK(compareNums(request.hostLen, 17));
+  CHECK(!strncmp(request.host, "ads.example.co.uk", 17));
+  CHECK(!request.thirdParty);
+  CHECK(request.contextOption == (FOImage | FONotThirdParty));
+
+  CHECK(compareNums(request.numHostLabels, 4));
+  CHECK(compareNums(request.hostLabels[0], 0));
+  CHECK(compareNums(request.hostLabels[1], 4));
+  CHECK(compareNums(request.hostLabels[2], 12));
+  CHECK(compareNums(request.hostLabels[3], 15));
+
+  CHECK(compareNums(request.numContextDomainLabels, 3));
+  CHECK(compareNums(request.contextDomainLabels[1], 8));
+
+  MatchRequest thirdPartyRequest(url, static_cast<int>(strlen(url)),
+      FONoFilterOption, "brianbondy.com", 14);
+  CHECK(thirdPartyRequest.thirdParty);
+  CHECK(thirdPartyRequest.contextOption == FOThirdParty);
+
+  MatchRequest noContextRequest(url, static_cast<int>(strlen(url)));
+  CHECK(!noContextRequest.thirdParty);
+  CHECK(noContextRequest.contextOption == FONoFilterOption);
+  CHECK(compareNums(noContextRequest.numContextDomainLabels, 1));
+}
+
+// Hosts with more labels than fit keep the ones closest to the TLD
+TEST(matchRequest, manyLabels) {
+  std::string url = "http://";
+  for (int i = 0; i < MatchRequest::kMaxDomainLabels + 10; i++) {
+    url += "a.";
+  }
+  url += "example.com/";
+  MatchRequest request(url.c_str(), static_cast<int>(url.size()));
+  CHECK(compareNums(request.numHostLabels, MatchRequest::kMaxDomainLabels));
+  CHECK(compareNums(request.hostLabels[0], 0));
+  CHECK(compareNums(request.hostLabels[request.numHostLabels - 1],
+        request.hostLen - 3));
+  CHECK(compareNums(request.hostLabels[request.numHostLabels - 2],
+        request.hostLen - 11));
+}
+
+// Only the given lengths are used, neither string needs to be terminated
+TEST(matchRequest, explicitLengths) {
+  AdBlockClient client;
+  client.parse("||example.com^$third-party\n"
+      "|http://brianbondy.com/ad|\n"
+      "/tracker.js|\n"
+      "banner$domain=example.org\n"
+      "@@||example.com/ok^");
+
+  const char *urls = "http://example.com/ad.js"
+    "http://brianbondy.com/adx"
+    "http://example.com/ok/tracker.jsx";
+  const char *domains = "brianbondy.comexample.org";
+
+  MatchRequest request1(urls, 24, FOScript, domains, 14);
+  CHECK(client.matches(request1));
+  MatchRequest request2(urls, 24, FOScript, domains + 14, 11);
+  CHECK(client.matches(request2));
+  MatchRequest request3(urls, 24, FOScript, domains, 10);
+  CHECK(client.matches(request3));
+
+  MatchRequest request4(urls + 24, 24, FONoFilterOption);
+  CHECK(client.matches(request4));
+  MatchRequest request5(urls + 24, 25, FONoFilterOption);
+  CHECK(!client.matches(request5));
+
+  MatchRequest request6(urls + 49, 32, FOScript, domains, 14);
+  CHECK(!client.matches(request6));
+  MatchRequest request7(urls + 49, 33, FOScript, domains, 14);
+  CHECK(!client.matches(request7));
+
+  MatchRequest request8(urls + 49, 22, FOImage, domains + 14, 11);
+  CHECK(!client.matches(request8));
+  MatchRequest request9("http://a.com/banner.gif", 23, FOImage,
+      domains + 14, 11);
+  CHECK(client.matches(request9));
+  MatchRequest request10("http://a.com/banner.gif", 23, FOImage,
+      domains + 14, 10);
+  CHECK(!client.matches(request10));
+}
+
+// A batch should give the same answers as checking each URL on its own
+TEST(matchesBatch, sameAsMatches) {
+  AdBlockClient client;
+  client.parse(
+      "||ads.example.com^\n"
+      "@@||ads.example.com/allowed/\n"
+      "/banner/*$image\n"
+      "@@/banner/ok.gif$domain=brianbondy.com\n"
+      "/tracker.js$third-party\n"
+      "||cdn.example.org^$script,domain=slashdot.org\n");
+
+  const char *urls[] = {
+    "http://ads.example.com/a.js",
+    "https://cdn.example.org/lib.js",
+    "http://www.brianbondy.com/banner/ok.gif",
+    "http://ads.example.com/allowed/b.js",
+    "data:image/gif;base64,R0lGODlhAQABAIAAAAAAAP",
+    "https://cdn.example.org/tracker.js",
+    "http://www.brianbondy.com/banner/ad.gif",
+    "http://www.brianbondy.com/tracker.js",
+    "http://ads.example.com/c.gif",
+    "http://www.brianbondy.com/banner/ad.gif",
+    "http://ads.example.com/a.js",
+    // Grouped with the lowercase host
+    "http://ADS.Example.com/Allowed/e.js",
+    "http://Ads.example.com/f.gif",
+  };
+  const size_t n = sizeof(urls) / sizeof(urls[0]);
+  FilterOption opts[n];
+  for (size_t i = 0; i < n; i++) {
+    opts[i] = i % 2 ? FOScript : FOImage;
+  }
+
+  const char *contextDomains[] = {
+    "brianbondy.com", "slashdot.org", nullptr
+  };
+  for (const char *contextDomain : contextDomains) {
+    bool out[n];
+    client.matchesBatch(urls, nullptr, opts, contextDomain, out, n);
+    int numBlocks = 0;
+    for (size_t i = 0; i < n; i++) {
+      if (out[i] != client.matches(urls[i], opts[i], contextDomain)) {
+        cout << "Batch mismatch for " << urls[i] << " on "
+          << (contextDomain ? contextDomain : "no domain") << endl;
+        CHECK(false);
+      }
+      numBlocks += out[i];
+    }
+    CHECK(numBlocks > 0);
+  }
+
+  // Without options every URL is checked with FONoFilterOption
+  bool out[n];
+  int lens[n];
+  for (size_t i = 0; i < n; i++) {
+    lens[i] = static_cast<int>(strlen(urls[i]));
+  }
+  client.matchesBatch(urls, lens, nullptr, "slashdot.org", out, n);
+  for (size_t i = 0; i < n; i++) {
+    CHECK(out[i] == client.matches(urls[i], FONoFilterOption,
+          "slashdot.org"));
+  }
+}
+
+// Same as above for the default lists and a larger set of URLs
+TEST(matchesBatch, siteList) {
+  AdBlockClient client;
+  string && easyListTxt = // NOLINT
+    getFileContents("./test/data/easylist.txt");
+  client.parse(easyListTxt.c_str());
+
+  const std::vector<string> sites = getSiteListUrls();
+  std::vector<const char *> urls;
+  for (const string &url : sites) {
+    urls.push_back(url.c_str());
+  }
+
+  bool *out = new bool[urls.size()];
+  client.matchesBatch(urls.data(), nullptr, nullptr, "slashdot.org", out,
+      urls.size());
+  int numBlocks = 0;
+  int numMismatches = 0;
+  for (size_t i = 0; i < urls.size(); i++) {
+    numBlocks += out[i];
+    if (out[i] != client.matches(urls[i], FONoFilterOption,
+          "slashdot.org")) {
+      numMismatches++;
+    }
+  }
+  delete[] out;
+  CHECK(numBlocks > 0);
+  CHECK(compareNums(numMismatches, 0));
+}
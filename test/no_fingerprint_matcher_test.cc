@@ -0,0 +1,169 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <string.h>
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+#include "./ad_block_client.h"
+#include "./match_request.h"
+#include "./no_fingerprint_matcher.h"
+#include "./CppUnitLite/TestHarness.h"
+#include "./CppUnitLite/Test.h"
+#include "./util.h"
+
+using std::string;
+
+// Returns the ids of the candidates of |matcher| for |url|, in order
+static std::vector<int> findCandidates(const NoFingerprintMatcher &matcher,
+    int numFilters, const char *url) {
+  MatchRequest request(url, static_cast<int>(strlen(url)), FOImage,
+      "example.org", 11);
+  uint64_t candidates[NoFingerprintMatcher::kMaxWords];
+  std::vector<int> found;
+  if (!matcher.findCandidates(request, numFilters, candidates)) {
+    return found;
+  }
+  for (int i = 0; i < numFilters; i++) {
+    if (candidates[i / 64] >> (i % 64) & 1) {
+      found.push_back(i);
+    }
+  }
+  return found;
+}
+
+// Keys of any length, including ones which end inside each other
+TEST(noFingerprintMatcher, keysOfAnyLength) {
+  std::map<std::string, std::vector<int> > keys;
+  keys["ad"].push_back(0);
+  keys["load"].push_back(1);
+  keys["/ad."].push_back(2);
+  FingerprintAutomaton automaton;
+  automaton.build(keys);
+  std::vector<int> found;
+  int state = FingerprintAutomaton::kRootState;
+  for (const char *p = "/load/ad.js"; *p; p++) {
+    state = automaton.next(state, *p);
+    int numIds;
+    const int *ids = automaton.filterIds(state, &numIds);
+    found.insert(found.end(), ids, ids + numIds);
+  }
+  // "ad" ends inside "load", then "/ad." ends after "ad" again
+  std::vector<int> expected = { 1, 0, 0, 2 };
+  std::sort(found.begin(), found.end());
+  std::sort(expected.begin(), expected.end());
+  CHECK(found == expected);
+}
+
+TEST(noFingerprintMatcher, findsCandidates) {
+  const char *rules[] = { "/ad.", "-ad-*/banner^", "&adtype=", "/ad/*",
+    "/AdFrame.$match-case", "^", "/banner^", "/ad[0-9]/" };
+  const int kNumRules = sizeof(rules) / sizeof(rules[0]);
+  Filter filters[kNumRules];
+  for (int i = 0; i < kNumRules; i++) {
+    parseFilter(rules[i], filters + i);
+  }
+  NoFingerprintMatcher matcher;
+  CHECK(!matcher.isBuilt());
+  matcher.build(filters, kNumRules);
+  CHECK(matcher.isBuilt());
+  // The longest part of "-ad-*/banner^" is the same as "/banner^"
+  CHECK(compareNums(matcher.getNumKeys(), 5));
+
+  // The filters without a key, "^" and the regular expression, are always
+  // candidates.
+  std::vector<int> expected = { 5, 7 };
+  CHECK(findCandidates(matcher, kNumRules, "http://example.com/") ==
+      expected);
+  expected = { 0, 1, 5, 6, 7 };
+  CHECK(findCandidates(matcher, kNumRules,
+        "http://example.com/banner/ad.gif") == expected);
+  // Keys are found in the lowercased URL, match-case filters included
+  expected = { 4, 5, 7 };
+  CHECK(findCandidates(matcher, kNumRules,
+        "http://example.com/adframe.html") == expected);
+  CHECK(findCandidates(matcher, kNumRules,
+        "http://example.com/ADFRAME.html") == expected);
+
+  // Only for the list it was built for
+  CHECK(findCandidates(matcher, kNumRules - 1, "http://example.com/") ==
+      std::vector<int>());
+  matcher.clear();
+  CHECK(!matcher.isBuilt());
+}
+
+// Clients only try the candidates but find the same filter, the first one
+// in list order, as trying every filter.
+TEST(noFingerprintMatcher, firstMatchingFilter) {
+  const char *rules = "/ads/*.js\n/ad.\n-ad-*/banner^\n/banner^\n"
+    "@@/ads/*/ok^\n@@/ok^$script\n";
+  AdBlockClient client;
+  client.parse(rules);
+  CHECK(compareNums(client.numNoFingerprintFilters, 4));
+  CHECK(compareNums(client.numNoFingerprintExceptionFilters, 2));
+  AdBlockClient everyFilterClient;
+  everyFilterClient.parse(rules);
+  everyFilterClient.noFingerprintMatcher.clear();
+  everyFilterClient.noFingerprintExceptionMatcher.clear();
+
+  const char *urls[] = {
+    "http://example.com/ads/ad.js",
+    "http://example.com/x-ad-y/banner/",
+    "http://example.com/banner/",
+    "http://example.com/ads/x/ok/.js",
+    "http://example.com/ad.js/ok/",
+    "http://example.com/ok/",
+  };
+  const char *expectedFilters[] = { "/ads/*.js", "-ad-*/banner^",
+    "/banner^", "/ads/*.js", "/ad.", nullptr };
+  const char *expectedExceptions[] = { nullptr, nullptr, nullptr,
+    "/ads/*/ok^", "/ok^", nullptr };
+  for (int i = 0; i < static_cast<int>(sizeof(urls) / sizeof(urls[0]));
+      i++) {
+    MatchRequest request(urls[i], static_cast<int>(strlen(urls[i])),
+        FOScript, "slashdot.org", 12);
+    for (AdBlockClient *c : { &client, &everyFilterClient }) {
+      Filter *found, *foundException;
+      c->findMatchingFilters(request, &found, &foundException);
+      CHECK(!found == !expectedFilters[i]);
+      CHECK(!found || !strcmp(found->data, expectedFilters[i]));
+      CHECK(!foundException == !expectedExceptions[i]);
+      CHECK(!foundException ||
+          !strcmp(foundException->data, expectedExceptions[i]));
+    }
+  }
+}
+
+// The same lists give the same results when tried one filter at a time
+TEST(noFingerprintMatcher, sameAsEveryFilter) {
+  string && easyListTxt = // NOLINT
+    getFileContents("./test/data/easylist.txt");
+  string && easyPrivacyTxt = // NOLINT
+    getFileContents("./test/data/easyprivacy.txt");
+  AdBlockClient client;
+  client.parse(easyListTxt.c_str());
+  client.parse(easyPrivacyTxt.c_str());
+  CHECK(client.noFingerprintMatcher.isBuilt());
+  CHECK(client.numNoFingerprintFilters > 0);
+
+  AdBlockClient everyFilterClient;
+  everyFilterClient.parse(easyListTxt.c_str());
+  everyFilterClient.parse(easyPrivacyTxt.c_str());
+  everyFilterClient.noFingerprintMatcher.clear();
+  everyFilterClient.noFingerprintExceptionMatcher.clear();
+  CHECK(sameMatchesForSiteList(2000, { FOScript }, { "slashdot.org" },
+        &client, &everyFilterClient));
+
+  // Data files get the matchers built when they're loaded
+  int size;
+  char *buffer = client.serialize(&size);
+  AdBlockClient client2;
+  CHECK(client2.deserialize(buffer));
+  CHECK(client2.noFingerprintMatcher.isBuilt());
+  CHECK(compareNums(client2.noFingerprintMatcher.getNumKeys(),
+        client.noFingerprintMatcher.getNumKeys()));
+  delete[] buffer;
+}
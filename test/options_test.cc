@@ -5,7 +5,6 @@
 
 #include <string.h>
 #include <fstream>
-#include <sstream>
 #include <string>
 #include <algorithm>
 #include <cerrno>
@@ -273,3 +272,31 @@ TEST(options, optionsFromFilter) {
     },
     {}))
 }
+
+// Matching with the resource type and party indexes has to give the same
+// results as checking every filter.
+TEST(filterOptionIndex, sameAsLinearMatching) {
+  string && easyListTxt = // NOLINT
+    getFileContents("./test/data/easylist.txt");
+  AdBlockClient client;
+  client.parse(easyListTxt.c_str());
+  AdBlockClient linearClient;
+  linearClient.parse(easyListTxt.c_str());
+  linearClient.filterOptionIndex.clear();
+  linearClient.exceptionFilterOptionIndex.clear();
+  linearClient.noFingerprintFilterOptionIndex.clear();
+  linearClient.noFingerprintExceptionFilterOptionIndex.clear();
+  linearClient.noFingerprintDomainOnlyFilterOptionIndex.clear();
+  linearClient.noFingerprintAntiDomainOnlyFilterOptionIndex.clear();
+  linearClient.noFingerprintDomainOnlyExceptionFilterOptionIndex.clear();
+  linearClient.noFingerprintAntiDomainOnlyExceptionFilterOptionIndex.clear();
+  CHECK(client.filterOptionIndex.find(FOScript, client.numFilters));
+  CHECK(!linearClient.filterOptionIndex.find(FOScript,
+        linearClient.numFilters));
+
+  // The last one has two resource types and is never indexed
+  CHECK(sameMatchesForSiteList(2000, { FONoFilterOption, FOScript, FOImage,
+          FOStylesheet, FOSubdocument, FOXmlHttpRequest, FOMedia,
+          static_cast<FilterOption>(FOScript | FOImage) },
+        { nullptr, "slashdot.org", "google.com" }, &client, &linearClient));
+}
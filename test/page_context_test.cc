@@ -0,0 +1,198 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <string.h>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "./ad_block_client.h"
+#include "./page_context.h"
+#include "./CppUnitLite/TestHarness.h"
+#include "./CppUnitLite/Test.h"
+#include "./util.h"
+
+using std::cout;
+using std::endl;
+using std::string;
+
+TEST(pageContext, domainSpecificFilters) {
+  AdBlockClient client;
+  client.parse("adv$domain=example.com|~foo.example.com\n"
+      "banner$domain=~example.com\n"
+      "@@/adv/ok$domain=example.com\n"
+      "@@/banner/ok$domain=~brianbondy.com\n");
+
+  const char *domains[] = { "example.com", "foo.example.com",
+    "bar.example.com", "brianbondy.com", "com" };
+  const char *urls[] = {
+    "http://example.com/adv",
+    "http://example.com/adv/ok",
+    "http://example.com/banner",
+    "http://example.com/banner/ok",
+  };
+  for (const char *domain : domains) {
+    PageContext pageContext;
+    client.initPageContext((string("https://") + domain + "/").c_str(),
+        domain, &pageContext);
+    CHECK(!strcmp(pageContext.getContextDomain(), domain));
+    CHECK(compareNums(pageContext.getContextDomainLen(),
+          static_cast<int>(strlen(domain))));
+    CHECK(!pageContext.isDocumentException());
+    for (const char *url : urls) {
+      if (client.matches(url, FONoFilterOption, pageContext) !=
+          client.matches(url, FONoFilterOption, domain)) {
+        cout << "Mismatch for " << url << " on " << domain << endl;
+        CHECK(false);
+      }
+    }
+  }
+
+  PageContext pageContext;
+  client.initPageContext("https://foo.example.com/", "foo.example.com",
+      &pageContext);
+  CHECK(!client.matches("http://example.com/adv", FONoFilterOption,
+        pageContext));
+  client.initPageContext("https://bar.example.com/", "bar.example.com",
+      &pageContext);
+  CHECK(client.matches("http://example.com/adv", FONoFilterOption,
+        pageContext));
+  CHECK(!client.matches("http://example.com/adv/ok", FONoFilterOption,
+        pageContext));
+  CHECK(!client.matches("http://example.com/banner", FONoFilterOption,
+        pageContext));
+  client.initPageContext("https://brianbondy.com/", "brianbondy.com",
+      &pageContext);
+  CHECK(client.matches("http://example.com/banner/ok", FONoFilterOption,
+        pageContext));
+  client.initPageContext(nullptr, nullptr, &pageContext);
+  CHECK(!pageContext.getContextDomain());
+  CHECK(client.matches("http://example.com/banner", FONoFilterOption,
+        pageContext));
+}
+
+TEST(pageContext, documentException) {
+  AdBlockClient client;
+  client.parse("||ads.example.com^\n"
+      "@@||brianbondy.com^$document\n"
+      "@@||ads.example.com/ok^$image");
+  const char *url = "http://ads.example.com/ad.js";
+
+  PageContext pageContext;
+  client.initPageContext("https://brianbondy.com/", "brianbondy.com",
+      &pageContext);
+  CHECK(pageContext.isDocumentException());
+  CHECK(!client.matches(url, FOScript, pageContext));
+  CHECK(client.matches(url, FOScript, "brianbondy.com"));
+
+  // Batches are checked like matches() with a context domain
+  const char *urls[] = { url };
+  bool out[1] = { false };
+  client.matchesBatch(urls, nullptr, nullptr, "brianbondy.com", out, 1);
+  CHECK(out[0]);
+
+  client.initPageContext("https://example.com/", "example.com", &pageContext);
+  CHECK(!pageContext.isDocumentException());
+  CHECK(client.matches(url, FOScript, pageContext));
+  CHECK(!client.matches("http://ads.example.com/ok/a.png", FOImage,
+        pageContext));
+}
+
+// $document exceptions are checked against the page URL, so the ones for a
+// path or a scheme only allow the pages they name.
+TEST(pageContext, documentExceptionForPageUrl) {
+  AdBlockClient client;
+  client.parse("||ads.example.com^\n"
+      "@@||brianbondy.com/blog/$document\n"
+      "@@|http://example.org/$document\n");
+  const char *url = "http://ads.example.com/ad.js";
+
+  PageContext pageContext;
+  client.initPageContext("https://brianbondy.com/blog/post.html",
+      "brianbondy.com", &pageContext);
+  CHECK(pageContext.isDocumentException());
+  CHECK(!client.matches(url, FOScript, pageContext));
+  client.initPageContext("https://brianbondy.com/", "brianbondy.com",
+      &pageContext);
+  CHECK(!pageContext.isDocumentException());
+  CHECK(client.matches(url, FOScript, pageContext));
+
+  client.initPageContext("http://example.org/", "example.org", &pageContext);
+  CHECK(pageContext.isDocumentException());
+  client.initPageContext("https://example.org/", "example.org",
+      &pageContext);
+  CHECK(!pageContext.isDocumentException());
+
+  // Without a page URL only the context domain is used
+  client.initPageContext(nullptr, "example.org", &pageContext);
+  CHECK(!pageContext.isDocumentException());
+  CHECK(!strcmp(pageContext.getContextDomain(), "example.org"));
+  CHECK(client.matches(url, FOScript, pageContext));
+}
+
+// A page context built before the filters changed is ignored instead of
+// pointing at filters which moved or no longer exist.
+TEST(pageContext, staleContext) {
+  AdBlockClient client;
+  client.parse("adv$domain=example.com\n"
+      "banner$domain=example.com\n"
+      "popup$domain=example.com\n"
+      "@@||brianbondy.com^$document\n");
+  PageContext pageContext;
+  client.initPageContext("https://example.com/", "example.com", &pageContext);
+  CHECK(client.matches("http://example.com/popup", FONoFilterOption,
+        pageContext));
+  PageContext documentPageContext;
+  client.initPageContext("https://brianbondy.com/", "brianbondy.com",
+      &documentPageContext);
+  CHECK(documentPageContext.isDocumentException());
+
+  client.clear();
+  client.parse("tracker$domain=example.com\n||ads.example.com^\n");
+  CHECK(!client.matches("http://example.com/popup", FONoFilterOption,
+        pageContext));
+  CHECK(client.matches("http://example.com/tracker", FONoFilterOption,
+        pageContext));
+  CHECK(!client.matches("http://example.com/tracker", FONoFilterOption,
+        "brianbondy.com"));
+  CHECK(client.matches("http://brianbondy.com/tracker", FONoFilterOption,
+        "example.com"));
+  // The $document exception is gone with its filter
+  CHECK(client.matches("http://ads.example.com/a.js", FOScript,
+        documentPageContext));
+  PageContext neverBuilt;
+  CHECK(client.matches("http://ads.example.com/a.js", FOScript, neverBuilt));
+
+  // Parsing more filters also changes the ids
+  client.initPageContext("https://example.com/", "example.com", &pageContext);
+  client.parse("@@/tracker$domain=example.com\n");
+  CHECK(!client.matches("http://example.com/tracker", FONoFilterOption,
+        pageContext));
+}
+
+// Results with a page context are the same as with the context domain for
+// the default lists, on pages without a $document exception.
+TEST(pageContext, sameAsMatches) {
+  string && easyListTxt = // NOLINT
+    getFileContents("./test/data/easylist.txt");
+  AdBlockClient client;
+  client.parse(easyListTxt.c_str());
+
+  const char *domains[] = { "slashdot.org", "www.cnn.com", "facebook.com",
+    "imgur.com", "www.dailymail.co.uk" };
+  for (const char *domain : domains) {
+    PageContext pageContext;
+    client.initPageContext((string("https://") + domain + "/").c_str(),
+        domain, &pageContext);
+    CHECK(!pageContext.isDocumentException());
+    CHECK(sameMatchesForSiteList(1000, { FONoFilterOption, FOScript,
+            FOImage, FOSubdocument }, { domain },
+          [&](const char *url, FilterOption contextOption, const char *) {
+            return client.matches(url, contextOption, pageContext);
+          }, [&](const char *url, FilterOption contextOption,
+            const char *contextDomain) {
+            return client.matches(url, contextOption, contextDomain);
+          }));
+  }
+}
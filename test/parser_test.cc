@@ -3,18 +3,22 @@
  * License, v. 2.0. If a copy of the MPL was not distributed with this
  * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
 
+#include <stdlib.h>
 #include <string.h>
 #include <fstream>
-#include <sstream>
 #include <string>
 #include <cerrno>
 #include <algorithm>
 #include <iostream>
 #include <set>
+#include <vector>
 #include "./CppUnitLite/TestHarness.h"
 #include "./CppUnitLite/Test.h"
 #include "./ad_block_client.h"
+#include "./fingerprint_postings.h"
 #include "./hash_set.h"
+#include "./match_request.h"
+#include "./page_context.h"
 #include "./util.h"
 
 using std::string;
@@ -184,16 +188,66 @@ TEST(client, parseFilterMatchesFilter) {
       "http://example.com:8000/foo.bar?a=12&b=%D1%82%D0%B5%D1%81%D1%82",
     },
     {}));
+  // Filter data is lowercased when it's parsed and matches either case
   CHECK(testFilter("^%D1%82%D0%B5%D1%81%D1%82^",
     FTNoFilterType,
     FONoFilterOption,
-    "^%D1%82%D0%B5%D1%81%D1%82^",
+    "^%d1%82%d0%b5%d1%81%d1%82^",
     {
       "http://example.com:8000/foo.bar?a=12&b=%D1%82%D0%B5%D1%81%D1%82",
+      "http://example.com:8000/foo.bar?a=12&b=%d1%82%d0%b5%d1%81%d1%82",
     },
     {
       "http://example.com:8000/foo.bar?a=12&b%D1%82%D0%B5%D1%81%D1%823",
     }));
+  CHECK(testFilter("/BannerAd.GIF|",
+    FTRightAnchored,
+    FONoFilterOption,
+    "/bannerad.gif",
+    {
+      "http://example.com/BannerAd.GIF",
+      "http://example.com/bannerad.gif",
+      "http://EXAMPLE.COM/BANNERAD.GIF",
+    },
+    {
+      "http://example.com/bannerad.gif?x",
+    }));
+  CHECK(testFilter("||Ads.Example.com/Banner^",
+    FTHostAnchored,
+    FONoFilterOption,
+    "ads.example.com/banner^",
+    {
+      "http://ads.example.com/banner/1.gif",
+      "https://ADS.example.com/BANNER?x=1",
+    },
+    {
+      "http://ads.example.com/banners.gif",
+    }));
+  // match-case filters keep their data as is and only match that case
+  CHECK(testFilter("/BannerAd*.GIF$match-case",
+    FTNoFilterType,
+    FOMatchCase,
+    "/BannerAd*.GIF",
+    {
+      "http://example.com/BannerAd_1.GIF",
+      "http://EXAMPLE.COM/BannerAd.GIF",
+    },
+    {
+      "http://example.com/bannerad_1.gif",
+      "http://example.com/BannerAd_1.gif",
+      "http://example.com/BANNERAD_1.GIF",
+    }));
+  CHECK(testFilter("|http://example.com/AdServer$match-case,script",
+    FTLeftAnchored,
+    static_cast<FilterOption>(FOMatchCase | FOScript),
+    "http://example.com/AdServer",
+    {
+      "http://example.com/AdServer?x=1",
+    },
+    {
+      "http://example.com/adserver?x=1",
+      "http://example.com/ADSERVER?x=1",
+    }));
   CHECK(testFilter("^foo.bar^",
     FTNoFilterType,
     FONoFilterOption,
@@ -229,7 +283,7 @@ TEST(client, parseFilterMatchesFilter) {
     "||static.tumblr.com/dhqhfum/WgAn39721/cfh_header_banner_v2.jpg",
     FTHostAnchored,
     FONoFilterOption,
-    "static.tumblr.com/dhqhfum/WgAn39721/cfh_header_banner_v2.jpg",
+    "static.tumblr.com/dhqhfum/wgan39721/cfh_header_banner_v2.jpg",
     {
       "http://static.tumblr.com/dhqhfum/WgAn39721/cfh_header_banner_v2.jpg"
     },
@@ -583,6 +637,8 @@ TEST(client, optionRules) {
     }));
 }
 
+// Filters with options which aren't supported are dropped when parsing, so
+// they aren't counted.
 struct ListCounts {
   size_t filters;
   size_t cosmeticFilters;
@@ -590,10 +646,10 @@ struct ListCounts {
   size_t exceptions;
 };
 
-ListCounts easyList = { 24478, 31144, 0, 5589 };
-ListCounts easyPrivacy = { 11817, 0, 0, 1020 };
-ListCounts ublockUnbreak = { 4, 8, 0, 94 };
-ListCounts braveUnbreak = { 31, 0, 0, 4 };
+ListCounts easyList = { 24081, 31144, 0, 5080 };
+ListCounts easyPrivacy = { 11889, 0, 0, 1021 };
+ListCounts ublockUnbreak = { 4, 8, 0, 98 };
+ListCounts braveUnbreak = { 32, 0, 0, 4 };
 ListCounts disconnectSimpleMalware = { 2450, 0, 0, 0 };
 ListCounts spam404MainBlacklist = { 5629, 166, 0, 0 };
 
@@ -608,7 +664,7 @@ TEST(client, parse_easylist) {
           client.numNoFingerprintFilters +
           client.numNoFingerprintDomainOnlyFilters +
           client.numNoFingerprintAntiDomainOnlyFilters +
-          client.hostAnchoredHashSet->GetSize(),
+          client.numHostAnchoredFilters,
         easyList.filters));
   CHECK(compareNums(client.numCosmeticFilters, easyList.cosmeticFilters));
   CHECK(compareNums(client.numHtmlFilters, easyList.htmlFilters));
@@ -616,7 +672,7 @@ TEST(client, parse_easylist) {
           client.numNoFingerprintExceptionFilters +
           client.numNoFingerprintDomainOnlyExceptionFilters +
           client.numNoFingerprintAntiDomainOnlyExceptionFilters +
-          client.hostAnchoredExceptionHashSet->GetSize(),
+          client.numHostAnchoredExceptionFilters,
         easyList.exceptions));
 }
 
@@ -631,7 +687,7 @@ TEST(client, parse_easyprivacy) {
           client.numNoFingerprintFilters +
           client.numNoFingerprintDomainOnlyFilters +
           client.numNoFingerprintAntiDomainOnlyFilters +
-          client.hostAnchoredHashSet->GetSize(),
+          client.numHostAnchoredFilters,
         easyPrivacy.filters));
   CHECK(compareNums(client.numCosmeticFilters, easyPrivacy.cosmeticFilters));
   CHECK(compareNums(client.numHtmlFilters, easyPrivacy.htmlFilters));
@@ -639,7 +695,7 @@ TEST(client, parse_easyprivacy) {
           client.numNoFingerprintExceptionFilters +
           client.numNoFingerprintDomainOnlyExceptionFilters +
           client.numNoFingerprintAntiDomainOnlyExceptionFilters +
-          client.hostAnchoredExceptionHashSet->GetSize(),
+          client.numHostAnchoredExceptionFilters,
         easyPrivacy.exceptions));
 }
 
@@ -654,7 +710,7 @@ TEST(client, parse_ublock_unbreak) {
          client.numNoFingerprintFilters +
           client.numNoFingerprintDomainOnlyFilters +
           client.numNoFingerprintAntiDomainOnlyFilters +
-          client.hostAnchoredHashSet->GetSize(),
+          client.numHostAnchoredFilters,
         ublockUnbreak.filters));
   CHECK(compareNums(client.numCosmeticFilters, ublockUnbreak.cosmeticFilters));
   CHECK(compareNums(client.numHtmlFilters, ublockUnbreak.htmlFilters));
@@ -662,7 +718,7 @@ TEST(client, parse_ublock_unbreak) {
           client.numNoFingerprintExceptionFilters +
           client.numNoFingerprintDomainOnlyExceptionFilters +
           client.numNoFingerprintAntiDomainOnlyExceptionFilters +
-          client.hostAnchoredExceptionHashSet->GetSize(),
+          client.numHostAnchoredExceptionFilters,
         ublockUnbreak.exceptions));
 }
 
@@ -677,7 +733,7 @@ TEST(client, parse_brave_unbreak) {
           client.numNoFingerprintFilters +
           client.numNoFingerprintDomainOnlyFilters +
           client.numNoFingerprintAntiDomainOnlyFilters +
-          client.hostAnchoredHashSet->GetSize(),
+          client.numHostAnchoredFilters,
         braveUnbreak.filters));
   CHECK(compareNums(client.numCosmeticFilters, braveUnbreak.cosmeticFilters));
   CHECK(compareNums(client.numHtmlFilters, braveUnbreak.htmlFilters));
@@ -685,7 +741,7 @@ TEST(client, parse_brave_unbreak) {
           client.numNoFingerprintExceptionFilters +
           client.numNoFingerprintDomainOnlyExceptionFilters +
           client.numNoFingerprintAntiDomainOnlyExceptionFilters +
-          client.hostAnchoredExceptionHashSet->GetSize(),
+          client.numHostAnchoredExceptionFilters,
         braveUnbreak.exceptions));
 }
 
@@ -700,7 +756,7 @@ TEST(client, parse_brave_disconnect_simple_malware) {
           client.numNoFingerprintFilters +
           client.numNoFingerprintDomainOnlyFilters +
           client.numNoFingerprintAntiDomainOnlyFilters +
-          client.hostAnchoredHashSet->GetSize(),
+          client.numHostAnchoredFilters,
         disconnectSimpleMalware.filters));
   CHECK(compareNums(client.numCosmeticFilters,
         disconnectSimpleMalware.cosmeticFilters));
@@ -710,7 +766,7 @@ TEST(client, parse_brave_disconnect_simple_malware) {
           client.numNoFingerprintExceptionFilters +
           client.numNoFingerprintDomainOnlyExceptionFilters +
           client.numNoFingerprintAntiDomainOnlyExceptionFilters +
-          client.hostAnchoredExceptionHashSet->GetSize(),
+          client.numHostAnchoredExceptionFilters,
         disconnectSimpleMalware.exceptions));
 }
 
@@ -726,7 +782,7 @@ TEST(client, parse_spam404_main_blacklist) {
           client.numNoFingerprintFilters +
           client.numNoFingerprintDomainOnlyFilters +
           client.numNoFingerprintAntiDomainOnlyFilters +
-          client.hostAnchoredHashSet->GetSize(),
+          client.numHostAnchoredFilters,
         spam404MainBlacklist.filters));
   CHECK(compareNums(client.numCosmeticFilters,
         spam404MainBlacklist.cosmeticFilters));
@@ -735,7 +791,7 @@ TEST(client, parse_spam404_main_blacklist) {
           client.numNoFingerprintExceptionFilters +
           client.numNoFingerprintDomainOnlyExceptionFilters +
           client.numNoFingerprintAntiDomainOnlyExceptionFilters +
-          client.hostAnchoredExceptionHashSet->GetSize(),
+          client.numHostAnchoredExceptionFilters,
         spam404MainBlacklist.exceptions));
 
   const char *urlToCheck = "http://excellentmovies.net/";
@@ -771,7 +827,7 @@ TEST(client, parse_multiList) {
           client.numNoFingerprintFilters +
           client.numNoFingerprintDomainOnlyFilters +
           client.numNoFingerprintAntiDomainOnlyFilters +
-          client.hostAnchoredHashSet->GetSize(),
+          client.numHostAnchoredFilters,
         easyList.filters +
           easyPrivacy.filters +
           ublockUnbreak.filters +
@@ -790,7 +846,7 @@ TEST(client, parse_multiList) {
           braveUnbreak.htmlFilters));
   /*
   CHECK(compareNums(client.numExceptionFilters +
-          client.hostAnchoredExceptionHashSet->GetSize() +
+          client.numHostAnchoredExceptionFilters +
           client.numNoFingerprintExceptionFilters,
           client.numNoFingerprintDomainOnlyExceptionFilters +
           client.numNoFingerprintAntiDomainOnlyExceptionFilters +
@@ -820,7 +876,7 @@ TEST(client, parse_malware_multiList) {
           client.numNoFingerprintFilters +
           client.numNoFingerprintDomainOnlyFilters +
           client.numNoFingerprintAntiDomainOnlyFilters +
-          client.hostAnchoredHashSet->GetSize(),
+          client.numHostAnchoredFilters,
         disconnectSimpleMalware.filters +
           spam404MainBlacklist.filters));
   */
@@ -833,7 +889,7 @@ TEST(client, parse_malware_multiList) {
           spam404MainBlacklist.htmlFilters));
 
   CHECK(compareNums(client.numExceptionFilters +
-          client.hostAnchoredExceptionHashSet->GetSize() +
+          client.numHostAnchoredExceptionFilters +
           client.numNoFingerprintExceptionFilters +
           client.numNoFingerprintAntiDomainOnlyExceptionFilters,
         disconnectSimpleMalware.exceptions+
@@ -921,25 +977,21 @@ TEST(serializationTests, serializationTests2) {
   AdBlockClient client2;
   CHECK(client2.deserialize(buffer));
 
-  Filter f(static_cast<FilterType>(FTHostAnchored | FTHostOnly), FOThirdParty,
-      FONoFilterOption, "googlesyndication.com", 21, nullptr,
-      "googlesyndication.com");
-  Filter f2(FTNoFilterType, FOThirdParty, FONoFilterOption,
-      "googleayndication.com", 21, nullptr, "googleayndication.com");
-  CHECK(client.hostAnchoredHashSet->Exists(f));
-  CHECK(client2.hostAnchoredHashSet->Exists(f));
-  CHECK(!client.hostAnchoredHashSet->Exists(f2));
-  CHECK(!client2.hostAnchoredHashSet->Exists(f2));
-
-  Filter f3(static_cast<FilterType>(FTHostAnchored | FTHostOnly | FTException),
-      FONoFilterOption, FONoFilterOption, "googlesyndication.ca",
-      20, nullptr, "googlesyndication.ca");
-  Filter f4(FTNoFilterType, FONoFilterOption, FONoFilterOption,
-      "googleayndication.ca", 20, nullptr, "googleayndication.ca");
-  CHECK(client.hostAnchoredExceptionHashSet->Exists(f3));
-  CHECK(client2.hostAnchoredExceptionHashSet->Exists(f3));
-  CHECK(!client.hostAnchoredExceptionHashSet->Exists(f4));
-  CHECK(!client2.hostAnchoredExceptionHashSet->Exists(f4));
+  FingerprintPostings f("googlesyndication.com", 21);
+  FingerprintPostings f2("googleayndication.com", 21);
+  CHECK(client.hostAnchoredPostings->Exists(f));
+  CHECK(client2.hostAnchoredPostings->Exists(f));
+  CHECK(!client.hostAnchoredPostings->Exists(f2));
+  CHECK(!client2.hostAnchoredPostings->Exists(f2));
+  CHECK(compareNums(client2.numHostAnchoredFilters, 1));
+  CHECK(client2.hostAnchoredFilters[0].filterOption == FOThirdParty);
+
+  FingerprintPostings f3("googlesyndication.ca", 20);
+  FingerprintPostings f4("googleayndication.ca", 20);
+  CHECK(client.hostAnchoredExceptionPostings->Exists(f3));
+  CHECK(client2.hostAnchoredExceptionPostings->Exists(f3));
+  CHECK(!client.hostAnchoredExceptionPostings->Exists(f4));
+  CHECK(!client2.hostAnchoredExceptionPostings->Exists(f4));
 
   delete[] buffer;
 }
@@ -979,3 +1031,680 @@ TEST(findMatchingFilters, basic) {
   CHECK(!strcmp(matchingFilter->data, "googlesyndication.com/safeframe/"));
   CHECK(!strcmp(matchingExceptionFilter->data, "safeframe"));
 }
+
+static bool hasFilterData(const std::vector<Filter *> &filters,
+    const char *data) {
+  // Filters copied into the host hash sets aren't null terminated
+  for (const Filter *filter : filters) {
+    if (filter->dataLen == static_cast<int>(strlen(data)) &&
+        !memcmp(filter->data, data, filter->dataLen)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+TEST(findAllMatchingFilters, basic) {
+  AdBlockClient client;
+  client.parse("adv\n"
+      "/adv/*.js\n"
+      "||example.com^\n"
+      "banner\n"
+      "@@adv$domain=a.com\n"
+      "@@||example.com/adv/\n"
+      "@@||example.org^\n", true);
+  const char *urlToCheck = "http://example.com/adv/x.js";
+  std::vector<Filter *> matchingFilters;
+  std::vector<Filter *> matchingExceptionFilters;
+
+  CHECK(!client.findAllMatchingFilters(urlToCheck, FOScript, "b.com",
+    &matchingFilters, &matchingExceptionFilters));
+  CHECK(compareNums(static_cast<int>(matchingFilters.size()), 3));
+  CHECK(hasFilterData(matchingFilters, "adv"));
+  CHECK(hasFilterData(matchingFilters, "/adv/*.js"));
+  CHECK(hasFilterData(matchingFilters, "example.com^"));
+  CHECK(compareNums(static_cast<int>(matchingExceptionFilters.size()), 1));
+  CHECK(hasFilterData(matchingExceptionFilters, "example.com/adv/"));
+  CHECK(!strcmp(matchingExceptionFilters[0]->ruleDefinition,
+        "@@||example.com/adv/"));
+
+  CHECK(!client.findAllMatchingFilters(urlToCheck, FOScript, "a.com",
+    &matchingFilters, &matchingExceptionFilters));
+  CHECK(compareNums(static_cast<int>(matchingFilters.size()), 3));
+  CHECK(compareNums(static_cast<int>(matchingExceptionFilters.size()), 2));
+
+  CHECK(client.findAllMatchingFilters("http://example.net/adv", FOScript,
+    "b.com", &matchingFilters, &matchingExceptionFilters));
+  CHECK(compareNums(static_cast<int>(matchingFilters.size()), 1));
+  CHECK(matchingExceptionFilters.empty());
+
+  // Exceptions are found when nothing is blocked
+  CHECK(!client.findAllMatchingFilters("http://example.org/", FOScript,
+    "b.com", &matchingFilters, &matchingExceptionFilters));
+  CHECK(matchingFilters.empty());
+  CHECK(compareNums(static_cast<int>(matchingExceptionFilters.size()), 1));
+}
+
+// findMatchingFilters and findAllMatchingFilters skip lists the same way
+// as matches(), so they have to agree with it, and the filters found first
+// have to be among all of the filters found.
+TEST(findAllMatchingFilters, sameAsMatches) {
+  string && easyListTxt = // NOLINT
+    getFileContents("./test/data/easylist.txt");
+  AdBlockClient client;
+  client.parse(easyListTxt.c_str());
+  client.parse("@@||doubleclick.net^$script\n");
+
+  int numExceptions = 0;
+  int numNotFoundByAll = 0;
+  CHECK(sameMatchesForSiteList(1000, { FOScript },
+        { "slashdot.org", "www.cnn.com" },
+        [&](const char *url, FilterOption contextOption,
+          const char *contextDomain) {
+          Filter *filter, *exceptionFilter;
+          bool found = client.findMatchingFilters(url, contextOption,
+              contextDomain, &filter, &exceptionFilter);
+          std::vector<Filter *> matchingFilters;
+          std::vector<Filter *> matchingExceptionFilters;
+          bool foundAll = client.findAllMatchingFilters(url, contextOption,
+              contextDomain, &matchingFilters, &matchingExceptionFilters);
+          numExceptions += exceptionFilter != nullptr;
+          numNotFoundByAll += foundAll != found ||
+            (filter && std::find(matchingFilters.begin(),
+              matchingFilters.end(), filter) == matchingFilters.end()) ||
+            (exceptionFilter && std::find(matchingExceptionFilters.begin(),
+              matchingExceptionFilters.end(), exceptionFilter) ==
+              matchingExceptionFilters.end());
+          return found;
+        },
+        [&client](const char *url, FilterOption contextOption,
+          const char *contextDomain) {
+          return client.matches(url, contextOption, contextDomain);
+        }));
+  CHECK(numExceptions > 0);
+  CHECK(compareNums(numNotFoundByAll, 0));
+}
+
+// Everything matching needs should be prepared up front so that a parsed or
+// deserialized client can be shared between threads.
+TEST(readOnlyMatching, preparedAtLoadTime) {
+  AdBlockClient client;
+  client.parse("adv$domain=example.com|~foo.example.com\n"
+      "banner$domain=~example.com\n"
+      "/ads/*$script");
+  int size;
+  char * buffer = client.serialize(&size);
+  AdBlockClient client2;
+  CHECK(client2.deserialize(buffer));
+
+  AdBlockClient *clients[] = { &client, &client2 };
+  for (AdBlockClient *c : clients) {
+    CHECK(compareNums(c->numNoFingerprintDomainOnlyFilters, 0));
+    CHECK(compareNums(c->numNoFingerprintAntiDomainOnlyFilters, 1));
+    CHECK(compareNums(c->numNoFingerprintFilters, 2));
+    Filter *f = c->noFingerprintAntiDomainOnlyFilters;
+    CHECK(f->domainsParsed);
+    CHECK(compareNums(f->dataLen, 6));
+    CHECK(compareNums(f->getDomainCount(true), 1));
+    for (int i = 0; i < c->numNoFingerprintFilters; i++) {
+      f = c->noFingerprintFilters + i;
+      CHECK(f->dataLen == static_cast<int>(strlen(f->data)));
+      if (f->domainList) {
+        CHECK(f->domainsParsed);
+        CHECK(compareNums(f->getDomainCount(false), 1));
+        CHECK(compareNums(f->getDomainCount(true), 1));
+      }
+    }
+    CHECK(c->matches("http://example.com/adv", FONoFilterOption,
+          "example.com"));
+    CHECK(!c->matches("http://example.com/adv", FONoFilterOption,
+          "foo.example.com"));
+    CHECK(c->matches("http://example.com/banner", FONoFilterOption,
+          "brianbondy.com"));
+    CHECK(!c->matches("http://example.com/banner", FONoFilterOption,
+          "example.com"));
+  }
+  delete[] buffer;
+}
+
+// Returns a copy of a serialized buffer without the last |numSections| sizes
+// in its header and the sections they describe, which is what data files
+// written before those sections were added look like.
+static char * withoutTrailingSections(const char *buffer, int size,
+    int numSections, int *newSize) {
+  int headerLen = static_cast<int>(strlen(buffer));
+  int oldHeaderLen = headerLen;
+  for (int commas = 0; commas < numSections; oldHeaderLen--) {
+    if (buffer[oldHeaderLen - 1] == ',') {
+      commas++;
+    }
+  }
+  unsigned int sectionsSize = 0;
+  const char *p = buffer + oldHeaderLen;
+  for (int i = 0; i < numSections; i++) {
+    char *next;
+    sectionsSize += strtoul(p + 1, &next, 16);
+    p = next;
+  }
+  *newSize = size - (headerLen - oldHeaderLen) - sectionsSize;
+  char *oldBuffer = new char[*newSize];
+  memcpy(oldBuffer, buffer, oldHeaderLen);
+  oldBuffer[oldHeaderLen] = '\0';
+  memcpy(oldBuffer + oldHeaderLen + 1, buffer + headerLen + 1,
+      *newSize - oldHeaderLen - 1);
+  return oldBuffer;
+}
+
+TEST(fingerprintPostings, serializedAndRebuilt) {
+  AdBlockClient client;
+  client.parse("/qbanners/*\n"
+      "||example.com/qadverts/\n"
+      "qadvertisement$script\n"
+      "@@/qbanners/ok.$image");
+  int size;
+  char * buffer = client.serialize(&size);
+
+  // Strip the fingerprint postings and the sections which come after them
+  // to get a data file in the format used before they were added.
+  int oldSize;
+  char *oldBuffer = withoutTrailingSections(buffer, size, 15, &oldSize);
+  int postingsOnlySize;
+  delete[] withoutTrailingSections(buffer, size, 13, &postingsOnlySize);
+  CHECK(oldSize < postingsOnlySize);
+
+  AdBlockClient client2;
+  CHECK(client2.deserialize(buffer));
+  AdBlockClient client3;
+  CHECK(client3.deserialize(oldBuffer));
+
+  AdBlockClient *clients[] = { &client, &client2, &client3 };
+  for (AdBlockClient *c : clients) {
+    CHECK(compareNums(c->numFilters, 2));
+    CHECK(compareNums(c->numHostAnchoredFilters, 1));
+    CHECK(compareNums(c->numExceptionFilters, 1));
+    CHECK(c->matches("http://brianbondy.com/qbanners/ad.gif",
+          FOImage, "brianbondy.com"));
+    CHECK(!c->matches("http://brianbondy.com/qbanners/ok.gif",
+          FOImage, "brianbondy.com"));
+    CHECK(c->matches("http://brianbondy.com/qbanners/ok.gif",
+          FOScript, "brianbondy.com"));
+    CHECK(c->matches("http://example.com/qadverts/a.gif",
+          FOImage, "brianbondy.com"));
+    CHECK(!c->matches("http://brianbondy.com/qadverts/a.gif",
+          FOImage, "brianbondy.com"));
+    CHECK(c->matches("http://brianbondy.com/qadvertisement.js",
+          FOScript, "brianbondy.com"));
+    CHECK(!c->matches("http://brianbondy.com/qadvertisement.png",
+          FOImage, "brianbondy.com"));
+  }
+  delete[] buffer;
+  delete[] oldBuffer;
+}
+
+TEST(filterOptionIndex, serializedAndRebuilt) {
+  AdBlockClient client;
+  client.parse("/qbanners/*$script\n"
+      "/qadverts/$image,third-party\n"
+      "qadvertisement$~image\n"
+      "@@/qbanners/ok.$script,~third-party");
+  int size;
+  char * buffer = client.serialize(&size);
+  // The option indexes and the sections after them
+  int oldSize;
+  char *oldBuffer = withoutTrailingSections(buffer, size, 13, &oldSize);
+  CHECK(oldSize < size);
+
+  AdBlockClient client2;
+  CHECK(client2.deserialize(buffer));
+  AdBlockClient client3;
+  CHECK(client3.deserialize(oldBuffer));
+
+  AdBlockClient *clients[] = { &client, &client2, &client3 };
+  for (AdBlockClient *c : clients) {
+    const uint64_t *scripts = c->filterOptionIndex.find(FOScript,
+        c->numFilters);
+    const uint64_t *thirdPartyImages = c->filterOptionIndex.find(
+        static_cast<FilterOption>(FOImage | FOThirdParty), c->numFilters);
+    CHECK(scripts && thirdPartyImages);
+    if (!scripts || !thirdPartyImages) {
+      continue;
+    }
+    CHECK(compareNums(static_cast<int>(*scripts), 5));
+    CHECK(compareNums(static_cast<int>(*thirdPartyImages), 2));
+    CHECK(c->exceptionFilterOptionIndex.find(
+          static_cast<FilterOption>(FOScript | FONotThirdParty),
+          c->numExceptionFilters));
+    CHECK(!c->filterOptionIndex.find(FOScript, c->numFilters + 1));
+
+    CHECK(c->matches("http://brianbondy.com/qbanners/ad.js",
+          FOScript, "example.com"));
+    CHECK(!c->matches("http://brianbondy.com/qbanners/ok.js",
+          FOScript, "brianbondy.com"));
+    CHECK(c->matches("http://brianbondy.com/qbanners/ok.js",
+          FOScript, "example.com"));
+    CHECK(!c->matches("http://brianbondy.com/qbanners/ad.gif",
+          FOImage, "example.com"));
+    CHECK(c->matches("http://example.com/qadverts/a.gif",
+          FOImage, "brianbondy.com"));
+    CHECK(!c->matches("http://example.com/qadverts/a.gif",
+          FOImage, "example.com"));
+    CHECK(c->matches("http://brianbondy.com/qadvertisement.js",
+          FOScript, "brianbondy.com"));
+    CHECK(!c->matches("http://brianbondy.com/qadvertisement.png",
+          FOImage, "brianbondy.com"));
+  }
+  delete[] buffer;
+  delete[] oldBuffer;
+}
+
+TEST(hostSuffixTrie, serializedAndMissing) {
+  AdBlockClient client;
+  client.parse("||ads.example.com^\n"
+      "||tracker.com^$third-party\n"
+      "@@||ok.ads.example.com^\n"
+      "adv$domain=example.com|~foo.example.com\n"
+      "@@/adv/ok$domain=bar.example.com");
+  CHECK(client.hostSuffixTrie.isBuilt());
+  int size;
+  char * buffer = client.serialize(&size);
+  // The trie and the sections after it
+  int oldSize;
+  char *oldBuffer = withoutTrailingSections(buffer, size, 5, &oldSize);
+  CHECK(oldSize < size);
+
+  AdBlockClient client2;
+  CHECK(client2.deserialize(buffer));
+  CHECK(client2.hostSuffixTrie.isBuilt());
+  CHECK(compareNums(client2.hostSuffixTrie.getNumNodes(),
+        client.hostSuffixTrie.getNumNodes()));
+  // Without the trie the postings are looked up for every suffix
+  AdBlockClient client3;
+  CHECK(client3.deserialize(oldBuffer));
+  CHECK(!client3.hostSuffixTrie.isBuilt());
+
+  AdBlockClient *clients[] = { &client, &client2, &client3 };
+  for (AdBlockClient *c : clients) {
+    CHECK(c->matches("http://ads.example.com/a.gif", FOImage,
+          "brianbondy.com"));
+    CHECK(c->matches("http://x.ads.example.com/a.gif", FOImage,
+          "brianbondy.com"));
+    CHECK(!c->matches("http://ok.ads.example.com/a.gif", FOImage,
+          "brianbondy.com"));
+    CHECK(!c->matches("http://example.com/a.gif", FOImage,
+          "brianbondy.com"));
+    CHECK(c->matches("http://a.tracker.com/a.gif", FOImage,
+          "brianbondy.com"));
+    CHECK(!c->matches("http://a.tracker.com/a.gif", FOImage,
+          "tracker.com"));
+    CHECK(c->matches("http://brianbondy.com/adv", FOImage,
+          "bar.example.com"));
+    CHECK(!c->matches("http://brianbondy.com/adv", FOImage,
+          "foo.example.com"));
+    CHECK(!c->matches("http://brianbondy.com/adv/ok", FOImage,
+          "bar.example.com"));
+    CHECK(c->matches("http://brianbondy.com/adv/ok", FOImage,
+          "baz.example.com"));
+  }
+  delete[] buffer;
+  delete[] oldBuffer;
+}
+
+TEST(hostAnchoredPostings, everyFilterForAHost) {
+  AdBlockClient client;
+  client.parse("||tracker.com^$script\n"
+      "||tracker.com^$image,third-party\n"
+      "||tracker.com/pixel/\n"
+      "||ads.example.com/banner/*.gif\n"
+      "@@||tracker.com^$script,domain=ok.com\n"
+      "@@||cdn.tracker.com/pixel/ok");
+  // Rules with options or a path aren't left to the fingerprint lists
+  CHECK(compareNums(client.numFilters + client.numNoFingerprintFilters, 0));
+  CHECK(compareNums(client.numExceptionFilters +
+        client.numNoFingerprintExceptionFilters, 0));
+  CHECK(compareNums(client.numHostAnchoredFilters, 4));
+  CHECK(compareNums(client.numHostAnchoredExceptionFilters, 2));
+  FingerprintPostings *postings =
+    client.hostAnchoredPostings->Find(FingerprintPostings("tracker.com", 11));
+  CHECK(postings && postings->numFilterIds == 3);
+
+  int size;
+  char *buffer = client.serialize(&size);
+  AdBlockClient client2;
+  CHECK(client2.deserialize(buffer));
+  CHECK(compareNums(client2.numHostAnchoredFilters, 4));
+  CHECK(compareNums(client2.numHostAnchoredExceptionFilters, 2));
+
+  AdBlockClient *clients[] = { &client, &client2 };
+  for (AdBlockClient *c : clients) {
+    // Each option variant for the same host is checked
+    CHECK(c->matches("http://tracker.com/t.js", FOScript, "brianbondy.com"));
+    CHECK(c->matches("http://a.tracker.com/t.gif", FOImage,
+          "brianbondy.com"));
+    CHECK(!c->matches("http://a.tracker.com/t.gif", FOImage, "tracker.com"));
+    CHECK(!c->matches("http://tracker.com/t.css", FOStylesheet,
+          "brianbondy.com"));
+    CHECK(c->matches("http://tracker.com/pixel/t.css", FOStylesheet,
+          "brianbondy.com"));
+    CHECK(!c->matches("http://nottracker.com/pixel/t.css", FOStylesheet,
+          "brianbondy.com"));
+    CHECK(c->matches("http://ads.example.com/banner/a/b.gif", FOImage,
+          "brianbondy.com"));
+    CHECK(!c->matches("http://example.com/banner/a/b.gif", FOImage,
+          "brianbondy.com"));
+    CHECK(!c->matches("http://brianbondy.com/?ads.example.com/banner/b.gif",
+          FOImage, "brianbondy.com"));
+    // Exceptions are looked up by host the same way
+    CHECK(!c->matches("http://tracker.com/t.js", FOScript, "ok.com"));
+    CHECK(!c->matches("http://cdn.tracker.com/pixel/ok.gif", FOImage,
+          "brianbondy.com"));
+    CHECK(c->matches("http://cdn.tracker.com/pixel/no.gif", FOImage,
+          "brianbondy.com"));
+
+    std::vector<Filter *> matchingFilters;
+    std::vector<Filter *> matchingExceptionFilters;
+    CHECK(c->findAllMatchingFilters("http://tracker.com/pixel/t.js",
+          FOScript, "brianbondy.com", &matchingFilters,
+          &matchingExceptionFilters));
+    CHECK(compareNums(static_cast<int>(matchingFilters.size()), 2));
+    CHECK(compareNums(static_cast<int>(matchingExceptionFilters.size()),
+          0));
+  }
+  delete[] buffer;
+}
+
+// Rules with a path and no fingerprint which only apply on some domains
+// stay in the domain specific lists, so they don't apply without a context
+// domain.
+TEST(hostAnchoredPostings, domainOnlyWithoutContextDomain) {
+  const char *rules = "||a.co/$domain=example.com\n"
+      "||tracker.com/pixel/$domain=example.com\n"
+      "||b.co^\n"
+      "@@||b.co/$domain=example.com\n";
+  AdBlockClient client;
+  client.parse(rules);
+  CHECK(compareNums(client.numHostAnchoredFilters, 2));
+  CHECK(compareNums(client.numNoFingerprintDomainOnlyFilters, 1));
+  CHECK(compareNums(client.numHostAnchoredExceptionFilters, 0));
+  CHECK(compareNums(client.numNoFingerprintDomainOnlyExceptionFilters, 1));
+
+  int size;
+  char *buffer = client.serialize(&size);
+  AdBlockClient client2;
+  CHECK(client2.deserialize(buffer));
+  AdBlockClient client3;
+  client3.enableHostDecisionCache(100);
+  client3.parse(rules);
+
+  AdBlockClient *clients[] = { &client, &client2, &client3 };
+  for (AdBlockClient *c : clients) {
+    CHECK(c->matches("http://a.co/x.js", FOScript, "example.com"));
+    CHECK(!c->matches("http://a.co/x.js", FOScript, "brianbondy.com"));
+    CHECK(!c->matches("http://a.co/x.js", FOScript));
+    CHECK(c->matches("http://tracker.com/pixel/a.gif", FOImage,
+          "example.com"));
+    // The exception only applies with its context domain
+    CHECK(!c->matches("http://b.co/x.js", FOScript, "example.com"));
+    CHECK(c->matches("http://b.co/x.js", FOScript, "brianbondy.com"));
+    CHECK(c->matches("http://b.co/x.js", FOScript));
+
+    std::vector<Filter *> matchingFilters;
+    std::vector<Filter *> matchingExceptionFilters;
+    CHECK(!c->findAllMatchingFilters("http://a.co/x.js", FOScript, nullptr,
+          &matchingFilters, &matchingExceptionFilters));
+    CHECK(matchingFilters.empty());
+    CHECK(c->findAllMatchingFilters("http://b.co/x.js", FOScript, nullptr,
+          &matchingFilters, &matchingExceptionFilters));
+    CHECK(matchingExceptionFilters.empty());
+  }
+  delete[] buffer;
+}
+
+TEST(domainPostings, onlyFiltersForTheDomain) {
+  const char *rules = "adv$domain=example.com|other.com\n"
+      "banner$domain=a.example.com|example.com\n"
+      "promo$domain=~example.com\n"
+      "sponsor$domain=~other.com|~brianbondy.com\n"
+      "@@/adv/ok$domain=b.example.com\n"
+      "@@/sponsor/ok$domain=~c.example.com";
+  AdBlockClient client;
+  client.parse(rules);
+  CHECK(compareNums(client.numNoFingerprintDomainOnlyFilters, 2));
+  CHECK(compareNums(client.numNoFingerprintAntiDomainOnlyFilters, 2));
+  FingerprintPostings *postings = client.noFingerprintDomainPostings->Find(
+      FingerprintPostings("example.com", 11));
+  CHECK(postings && postings->numFilterIds == 2);
+  postings = client.noFingerprintAntiDomainPostings->Find(
+      FingerprintPostings("other.com", 9));
+  CHECK(postings && postings->numFilterIds == 1);
+  CHECK(!client.noFingerprintAntiDomainPostings->Find(
+      FingerprintPostings("~other.com", 10)));
+
+  int size;
+  char *buffer = client.serialize(&size);
+  AdBlockClient client2;
+  CHECK(client2.deserialize(buffer));
+  // Reordering the filters changes their ids
+  AdBlockClient client3;
+  client3.parse(rules);
+  client3.startFilterHitCounting();
+  client3.matches("http://brianbondy.com/sponsor", FOImage, "cnn.com");
+  client3.reorderFilters();
+
+  AdBlockClient *clients[] = { &client, &client2, &client3 };
+  for (AdBlockClient *c : clients) {
+    CHECK(c->matches("http://brianbondy.com/adv", FOImage,
+          "www.example.com"));
+    CHECK(c->matches("http://brianbondy.com/adv", FOImage, "other.com"));
+    CHECK(!c->matches("http://brianbondy.com/adv", FOImage, "cnn.com"));
+    CHECK(!c->matches("http://brianbondy.com/adv", FOImage, "com"));
+    CHECK(c->matches("http://brianbondy.com/banner", FOImage,
+          "a.example.com"));
+    // Only the filters which name a domain are excluded on it
+    CHECK(!c->matches("http://brianbondy.com/promo", FOImage,
+          "www.example.com"));
+    CHECK(c->matches("http://brianbondy.com/promo", FOImage, "other.com"));
+    CHECK(c->matches("http://brianbondy.com/sponsor", FOImage,
+          "example.com"));
+    CHECK(!c->matches("http://brianbondy.com/sponsor", FOImage,
+          "brianbondy.com"));
+    CHECK(c->matches("http://brianbondy.com/promo", FOImage, nullptr));
+    CHECK(!c->matches("http://brianbondy.com/adv", FOImage, nullptr));
+    // Exceptions are found the same way
+    CHECK(!c->matches("http://brianbondy.com/adv/ok", FOImage,
+          "b.example.com"));
+    CHECK(c->matches("http://brianbondy.com/adv/ok", FOImage,
+          "a.example.com"));
+    CHECK(!c->matches("http://brianbondy.com/sponsor/ok", FOImage,
+          "cnn.com"));
+    CHECK(c->matches("http://brianbondy.com/sponsor/ok", FOImage,
+          "c.example.com"));
+
+    PageContext pageContext;
+    c->initPageContext("https://a.example.com/", "a.example.com",
+        &pageContext);
+    CHECK(c->matches("http://brianbondy.com/banner", FOImage, pageContext));
+    CHECK(!c->matches("http://brianbondy.com/promo", FOImage, pageContext));
+    CHECK(c->matches("http://brianbondy.com/sponsor", FOImage, pageContext));
+
+    std::vector<Filter *> matchingFilters;
+    std::vector<Filter *> matchingExceptionFilters;
+    CHECK(c->findAllMatchingFilters("http://brianbondy.com/adv/banner/sponsor",
+          FOImage, "a.example.com", &matchingFilters,
+          &matchingExceptionFilters));
+    CHECK(compareNums(static_cast<int>(matchingFilters.size()), 3));
+  }
+  delete[] buffer;
+}
+
+#ifdef ENABLE_REGEX
+TEST(regexFilters, compiledOnce) {
+  AdBlockClient client;
+  client.parse("/banner[0-9]+\\.gif/\n"
+      "/[unbalanced/");
+  int size;
+  char * buffer = client.serialize(&size);
+  AdBlockClient client2;
+  CHECK(client2.deserialize(buffer));
+
+  AdBlockClient *clients[] = { &client, &client2 };
+  for (AdBlockClient *c : clients) {
+    CHECK(compareNums(c->numNoFingerprintFilters, 2));
+    for (int i = 0; i < c->numNoFingerprintFilters; i++) {
+      Filter *f = c->noFingerprintFilters + i;
+      CHECK(f->filterType & FTRegex);
+      CHECK((f->regex != nullptr) == !strcmp(f->data, "banner[0-9]+\\.gif"));
+    }
+    CHECK(c->matches("http://example.com/banner12.gif", FOImage,
+          "example.com"));
+    CHECK(!c->matches("http://example.com/banner.gif", FOImage,
+          "example.com"));
+    CHECK(!c->matches("http://example.com/[unbalanced", FOImage,
+          "example.com"));
+  }
+
+  // Only the given length of the input is searched
+  Filter *f = client.noFingerprintFilters;
+  if (!f->regex) {
+    f++;
+  }
+  const char *url = "http://example.com/banner12.gif";
+  CHECK(f->matches(url, static_cast<int>(strlen(url))));
+  CHECK(!f->matches(url, static_cast<int>(strlen(url)) - 1));
+  delete[] buffer;
+}
+#endif
+
+TEST(filterShape, pickedAtLoadTime) {
+  struct {
+    const char *rule;
+    FilterShape shape;
+    int numParts;
+  } rules[] = {
+    { "|http://example.com/|", FSExact, 0 },
+    { "|http://example.com/", FSLeftAnchored, 0 },
+    { "swf|", FSRightAnchored, 0 },
+    { "banner", FSLiteral, 0 },
+    { "^banner^", FSSeparatorLiteral, 0 },
+    { "||example.com/banner", FSHostAnchoredLiteral, 0 },
+    { "||example.com^$script", FSHostAnchoredSeparatorLiteral, 0 },
+    { "/banner/*/img^", FSWildcard, 2 },
+    { "*ads**", FSWildcard, 4 },
+    { "||example.com/*.js", FSHostAnchoredWildcard, 2 },
+  };
+  for (const auto &rule : rules) {
+    AdBlockClient client;
+    client.parse(rule.rule);
+    Filter *f = client.noFingerprintFilters;
+    if (client.numFilters) {
+      f = client.filters;
+    } else if (client.numHostAnchoredFilters) {
+      f = client.hostAnchoredFilters;
+    }
+    CHECK(f != nullptr);
+    if (!f) {
+      continue;
+    }
+    int size;
+    char *buffer = client.serialize(&size);
+    AdBlockClient client2;
+    CHECK(client2.deserialize(buffer));
+    Filter copy(*f);
+    const Filter *filters[] = { f, &copy, client2.numFilters ?
+      client2.filters : client2.noFingerprintFilters };
+    for (const Filter *filter : filters) {
+      if (filter == client2.noFingerprintFilters &&
+          !client2.numNoFingerprintFilters) {
+        continue;
+      }
+      if (filter->shape != rule.shape) {
+        cout << "Wrong shape for " << rule.rule << ": " << filter->shape
+          << endl;
+      }
+      CHECK(filter->shape == rule.shape);
+      CHECK((filter->partEnds != nullptr) == (rule.numParts > 0));
+      if (rule.numParts) {
+        CHECK(compareNums(filter->partEnds[rule.numParts - 1],
+              filter->dataLen));
+      }
+    }
+    delete[] buffer;
+  }
+}
+
+// Filters built by hand aren't compiled, and have to match the same URLs as
+// the same filters compiled at parse time.
+TEST(filterShape, sameAsUncompiled) {
+  string && easyListTxt = // NOLINT
+    getFileContents("./test/data/easylist.txt");
+  AdBlockClient client;
+  client.parse(easyListTxt.c_str());
+
+  const std::vector<string> urls = getSiteListUrls(300);
+  const Filter *lists[] = { client.filters, client.noFingerprintFilters,
+    client.exceptionFilters };
+  const int listSizes[] = { client.numFilters, client.numNoFingerprintFilters,
+    client.numExceptionFilters };
+  int numMatches = 0;
+  int numMismatches = 0;
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < listSizes[i]; j++) {
+      const Filter &f = lists[i][j];
+      Filter uncompiled(f.filterType, f.filterOption, f.antiFilterOption,
+          f.data, f.dataLen, f.domainList, f.host, f.hostLen);
+      CHECK(uncompiled.shape == FSUnknown);
+      for (const string &u : urls) {
+        MatchRequest request(u.c_str(), static_cast<int>(u.length()),
+            FONoFilterOption, "slashdot.org", 12);
+        bool matches = f.matches(request);
+        numMatches += matches;
+        if (matches != uncompiled.matches(request) &&
+            numMismatches++ < 10) {
+          cout << "Mismatch for " << f.data << " on " << u << endl;
+        }
+      }
+    }
+  }
+  CHECK(numMatches > 0);
+  CHECK(compareNums(numMismatches, 0));
+}
+
+// The signature and minimum length only leave out bytes which '*' and '^'
+// stand for, and are the same however the filter was loaded.
+TEST(filterSignature, pickedAtLoadTime) {
+  AdBlockClient client;
+  client.parse("||example.com^ad*banner\nzqxjkvw*^x\nab^c$script");
+  int size;
+  char *buffer = client.serialize(&size);
+  AdBlockClient client2;
+  CHECK(client2.deserialize(buffer));
+  const Filter *filters[] = { client.hostAnchoredFilters,
+    client.filters, client.noFingerprintFilters,
+    client2.hostAnchoredFilters, client2.filters,
+    client2.noFingerprintFilters };
+  for (const Filter *f : filters) {
+    CHECK(f != nullptr);
+    if (!f) {
+      continue;
+    }
+    Filter copy(*f);
+    int expectedLen = 0;
+    for (int i = 0; i < f->dataLen; i++) {
+      expectedLen += f->data[i] != '*' && f->data[i] != '^';
+    }
+    CHECK(compareNums(f->minInputLen, expectedLen));
+    CHECK(compareNums(copy.minInputLen, expectedLen));
+    CHECK(!f->signature.empty());
+    CHECK(copy.signature.contains(f->signature) &&
+        f->signature.contains(copy.signature));
+  }
+
+  const char *url = "http://example.com/adbanner";
+  MatchRequest request(url, static_cast<int>(strlen(url)));
+  CHECK(request.bigramSignature.contains(
+        client.hostAnchoredFilters->signature));
+  CHECK(client.matches(url));
+  // Too short for "example.com" and "adbanner"
+  CHECK(!client.matches("http://e.com/adbanner"));
+  CHECK(!client.matches("http://example.com/adbann"));
+  delete[] buffer;
+}
@@ -0,0 +1,101 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <string.h>
+#include <iostream>
+#include <string>
+#include "./ad_block_client.h"
+#include "./match_request.h"
+#include "./public_suffix_list.h"
+#include "./CppUnitLite/TestHarness.h"
+#include "./CppUnitLite/Test.h"
+#include "./util.h"
+
+using std::cout;
+using std::endl;
+using std::string;
+
+// Returns the registrable domain of |host| as a string
+static string registrableDomain(const char *host) {
+  int len;
+  const char *domain = getRegistrableDomain(host,
+      static_cast<int>(strlen(host)), &len);
+  return string(domain, len);
+}
+
+static bool checkRegistrableDomain(const char *host, const char *expected) {
+  string domain = registrableDomain(host);
+  if (domain != expected) {
+    cout << "Registrable domain of " << host << " is " << domain
+      << ", expected " << expected << endl;
+    return false;
+  }
+  return true;
+}
+
+TEST(publicSuffixList, registrableDomains) {
+  // Plain rules
+  CHECK(checkRegistrableDomain("example.com", "example.com"));
+  CHECK(checkRegistrableDomain("www.example.com", "example.com"));
+  CHECK(checkRegistrableDomain("a.b.example.co.uk", "example.co.uk"));
+  CHECK(checkRegistrableDomain("WWW.Example.CO.UK", "Example.CO.UK"));
+  CHECK(checkRegistrableDomain("www.example.com.", "example.com"));
+  // Wildcard and exception rules
+  CHECK(checkRegistrableDomain("www.test.ck", "www.test.ck"));
+  CHECK(checkRegistrableDomain("a.www.test.ck", "www.test.ck"));
+  CHECK(checkRegistrableDomain("www.ck", "www.ck"));
+  CHECK(checkRegistrableDomain("a.www.ck", "www.ck"));
+  CHECK(checkRegistrableDomain("a.b.kawasaki.jp", "a.b.kawasaki.jp"));
+  CHECK(checkRegistrableDomain("a.city.kawasaki.jp", "city.kawasaki.jp"));
+  // Private rules
+  CHECK(checkRegistrableDomain("a.b.github.io", "b.github.io"));
+  CHECK(checkRegistrableDomain("x.y.blogspot.com", "y.blogspot.com"));
+  // Punycode rules, 公司.cn and 中国
+  CHECK(checkRegistrableDomain("a.b.xn--55qx5d.cn", "b.xn--55qx5d.cn"));
+  CHECK(checkRegistrableDomain("www.xn--fiqs8s", "www.xn--fiqs8s"));
+  // Unknown TLDs only have the TLD as the public suffix
+  CHECK(checkRegistrableDomain("a.b.example.notatld", "example.notatld"));
+  // Public suffixes, single labels and IP addresses are kept whole
+  CHECK(checkRegistrableDomain("co.uk", "co.uk"));
+  CHECK(checkRegistrableDomain("test.ck", "test.ck"));
+  CHECK(checkRegistrableDomain("localhost", "localhost"));
+  CHECK(checkRegistrableDomain("192.168.0.1", "192.168.0.1"));
+  CHECK(checkRegistrableDomain("[::1]", "[::1]"));
+  CHECK(checkRegistrableDomain("", ""));
+
+  CHECK(compareNums(getPublicSuffixLen("www.example.co.uk", 17), 5));
+  CHECK(compareNums(getPublicSuffixLen("example.com", 11), 3));
+  CHECK(compareNums(getPublicSuffixLen("a.www.ck", 8), 2));
+  // Only whole labels match a rule
+  CHECK(compareNums(getPublicSuffixLen("example.xco.uk", 14), 2));
+}
+
+TEST(publicSuffixList, thirdParty) {
+  CHECK(!isThirdPartyDomain("sub.example.co.uk", 17, "cdn.example.co.uk", 17));
+  CHECK(!isThirdPartyDomain("www.example.com", 15, "example.com", 11));
+  CHECK(!isThirdPartyDomain("example.com", 11, "ADS.EXAMPLE.COM", 15));
+  CHECK(isThirdPartyDomain("example.co.uk", 13, "other.co.uk", 11));
+  CHECK(isThirdPartyDomain("a.github.io", 11, "b.github.io", 11));
+  CHECK(isThirdPartyDomain("example.com", 11, "example.net", 11));
+  CHECK(isThirdPartyDomain("example.com", 11, "", 0));
+
+  const char *url = "https://cdn.example.co.uk/ads/banner.gif";
+  MatchRequest request(url, static_cast<int>(strlen(url)), FOImage,
+      "sub.example.co.uk", 17);
+  CHECK(!request.thirdParty);
+  CHECK(request.contextOption == (FOImage | FONotThirdParty));
+
+  AdBlockClient client;
+  client.parse("/ads/banner.gif$third-party\n");
+  CHECK(!client.matches(url, FOImage, "sub.example.co.uk"));
+  CHECK(!client.matches(url, FOImage, "example.co.uk"));
+  CHECK(client.matches(url, FOImage, "example.com"));
+  Filter *matchingFilter;
+  Filter *matchingExceptionFilter;
+  CHECK(!client.findMatchingFilters(url, FOImage, "www.example.co.uk",
+        &matchingFilter, &matchingExceptionFilter));
+  CHECK(client.findMatchingFilters(url, FOImage, "other.co.uk",
+        &matchingFilter, &matchingExceptionFilter));
+}
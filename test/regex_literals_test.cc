@@ -0,0 +1,118 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <string.h>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "./ad_block_client.h"
+#include "./regex_literals.h"
+#include "./CppUnitLite/TestHarness.h"
+#include "./CppUnitLite/Test.h"
+#include "./util.h"
+
+using std::cout;
+using std::endl;
+using std::string;
+using std::vector;
+
+// Checks the literals found in |regex|, printing them when they differ
+static bool testRegexLiterals(const char *regex, bool expectedResult,
+    const vector<string> &expectedLiterals) {
+  vector<string> literals;
+  const bool result = findRegexLiterals(regex,
+      static_cast<int>(strlen(regex)), &literals);
+  if (result != expectedResult || literals != expectedLiterals) {
+    cout << "Wrong literals for " << regex << ":";
+    for (const string &literal : literals) {
+      cout << " \"" << literal << "\"";
+    }
+    cout << endl;
+    return false;
+  }
+  return true;
+}
+
+TEST(regexLiterals, requiredRuns) {
+  CHECK(testRegexLiterals("banner", true, { "banner" }));
+  CHECK(testRegexLiterals("ads\\/banner[0-9]+\\.gif", true,
+        { "ads/banner", ".gif" }));
+  CHECK(testRegexLiterals("^https?:\\/\\/adserver\\.", true,
+        { "http", "://adserver." }));
+  // Repeated characters have to occur once, optional ones not at all
+  CHECK(testRegexLiterals("ads+erver", true, { "ads", "erver" }));
+  CHECK(testRegexLiterals("ads*erver", true, { "ad", "erver" }));
+  CHECK(testRegexLiterals("ads{2}erver", true, { "ads", "erver" }));
+  CHECK(testRegexLiterals("ads{1}erver", true, { "adserver" }));
+  CHECK(testRegexLiterals("ads{0,1}erver", true, { "ad", "erver" }));
+  // Classes, groups, escapes and anchors end a run
+  CHECK(testRegexLiterals("track(er|ing)\\.js", true, { "track", ".js" }));
+  CHECK(testRegexLiterals("ad[])|]banner", true, { "ad", "banner" }));
+  CHECK(testRegexLiterals("ad[[:digit:]]banner", true, { "ad", "banner" }));
+  CHECK(testRegexLiterals("pixel\\d+\\.gif$", true, { "pixel", ".gif" }));
+  CHECK(testRegexLiterals("a.b", true, { "a", "b" }));
+}
+
+TEST(regexLiterals, noRequiredRuns) {
+  // Either side of a top level alternation can match on its own
+  CHECK(testRegexLiterals("banner|popup", true, {}));
+  CHECK(testRegexLiterals("(banner|popup)", true, {}));
+  CHECK(testRegexLiterals("[0-9]+\\d", true, {}));
+  CHECK(testRegexLiterals("", true, {}));
+  // Unbalanced expressions can't be analyzed
+  CHECK(testRegexLiterals("[banner", false, {}));
+  CHECK(testRegexLiterals("(banner", false, {}));
+  CHECK(testRegexLiterals("banner)", false, {}));
+  CHECK(testRegexLiterals("banner\\", false, {}));
+}
+
+// Regular expressions with a literal long enough are looked up by
+// fingerprint and the others are still tried for every request.
+TEST(regexLiterals, fingerprints) {
+  char fingerprint[AdBlockClient::kFingerprintSize + 1];
+  Filter f;
+  parseFilter("/ADS\\/BANNER[0-9]+\\.gif/", &f);
+  CHECK(f.filterType & FTRegex);
+  CHECK(AdBlockClient::getFingerprint(fingerprint, f));
+  // Looked up in the lowercased URL
+  CHECK(!strcmp(fingerprint, "ads/ba"));
+
+  // Runs are lowercased before the bad fingerprints are left out
+  Filter upperCase;
+  parseFilter("/BannerAd[0-9]/", &upperCase);
+  CHECK(!AdBlockClient::getFingerprint(fingerprint, upperCase));
+  Filter lowerCase;
+  parseFilter("/bannerad[0-9]/", &lowerCase);
+  CHECK(!AdBlockClient::getFingerprint(fingerprint, lowerCase));
+  Filter mixedCase;
+  parseFilter("/TrackerPixel[0-9]/", &mixedCase);
+  CHECK(AdBlockClient::getFingerprint(fingerprint, mixedCase));
+  char lowerCaseFingerprint[AdBlockClient::kFingerprintSize + 1];
+  CHECK(AdBlockClient::getFingerprint(lowerCaseFingerprint,
+        "trackerpixel"));
+  CHECK(!strcmp(fingerprint, lowerCaseFingerprint));
+
+  Filter alternation;
+  parseFilter("/banner|popup/", &alternation);
+  CHECK(!AdBlockClient::getFingerprint(fingerprint, alternation));
+
+  AdBlockClient client;
+  client.parse("/ads/banner[0-9]+\\.gif/\n"
+      "/^https?://adserver\\./\n"
+      "/popup|popunder/\n"
+      "/a[0-9]b/\n");
+  CHECK(compareNums(client.numFilters, 2));
+  CHECK(compareNums(client.numNoFingerprintFilters, 2));
+#ifdef ENABLE_REGEX
+  CHECK(client.matches("http://example.com/ads/BANNER12.gif", FOImage,
+        "example.com"));
+  CHECK(client.matches("https://adserver.example.com/", FOImage,
+        "example.com"));
+  CHECK(!client.matches("http://example.com/ads/banner.gif", FOImage,
+        "example.com"));
+  CHECK(client.matches("http://example.com/popup", FOImage, "example.com"));
+  CHECK(client.matches("http://example.com/a1b", FOImage, "example.com"));
+#endif
+}
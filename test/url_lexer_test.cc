@@ -0,0 +1,242 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include <string.h>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "./ad_block_client.h"
+#include "./index_of_filter.h"
+#include "./match_request.h"
+#include "./protocol.h"
+#include "./url_lexer.h"
+#include "./CppUnitLite/TestHarness.h"
+#include "./CppUnitLite/Test.h"
+#include "./util.h"
+
+using std::cout;
+using std::endl;
+using std::string;
+
+// Lexes |url| and returns true if the bitmap, host and protocol agree with
+// the byte at a time versions.
+static bool checkLexUrl(const string &url) {
+  const int urlLen = static_cast<int>(url.length());
+  SeparatorBitmap separators;
+  const char *host;
+  int hostLen;
+  bool blockable = lexUrl(url.c_str(), urlLen, &separators, &host, &hostLen);
+
+  SeparatorBitmap expectedSeparators;
+  findSeparatorsScalar(url.c_str(), urlLen, &expectedSeparators);
+  int expectedHostLen;
+  const char *expectedHost = getUrlHost(url.c_str(), urlLen,
+      &expectedHostLen);
+  bool ok = blockable == isBlockableProtocol(url.c_str(), urlLen) &&
+    host == expectedHost && hostLen == expectedHostLen &&
+    separators.len == expectedSeparators.len;
+  for (int i = 0; ok && i < separators.len; i++) {
+    ok = separators.isSeparatorAt(i) == expectedSeparators.isSeparatorAt(i) &&
+      separators.isSeparatorAt(i) == isSeparatorChar(url[i]);
+  }
+  if (!ok) {
+    cout << "lexUrl mismatch for " << url << endl;
+  }
+  return ok;
+}
+
+// Lexed while the static initializers of the test binary run, which may be
+// before those of url_lexer.cc
+static bool lexAtStartup() {
+  SeparatorBitmap separators;
+  const char *host;
+  int hostLen;
+  return lexUrl("https://ads.example.com/a.js", 28, &separators, &host,
+      &hostLen) && hostLen == 15 && !strncmp(host, "ads.example.com", 15);
+}
+static const bool lexedAtStartup = lexAtStartup();
+
+TEST(urlLexer, lexesDuringStaticInitialization) {
+  CHECK(lexedAtStartup);
+}
+
+TEST(urlLexer, sameAsByteAtATime) {
+  CHECK(checkLexUrl(""));
+  CHECK(checkLexUrl("example.com"));
+  CHECK(checkLexUrl("http://example.com"));
+  CHECK(checkLexUrl("HTTPS://Example.com:8080/a?b=c;d^e"));
+  CHECK(checkLexUrl("blob:https://example.com/uuid"));
+  CHECK(checkLexUrl("ws:///example.com"));
+  CHECK(checkLexUrl("data:image/png;base64,iVBORw0KGgo="));
+  CHECK(checkLexUrl("http:/"));
+
+  // Every separator at every position of a block and around block ends
+  const char *separators = ":?/=^$;.-_";
+  for (int len = 1; len < 140; len++) {
+    for (const char *c = separators; *c; c++) {
+      string url = "https://" + string(len, 'a');
+      url[len % url.length()] = *c;
+      CHECK(checkLexUrl(url));
+    }
+  }
+
+  // URLs longer than the bitmap still find their host and protocol
+  string longUrl = "https://ads.example.com/" +
+    string(SeparatorBitmap::kMaxLen, 'x') + "/banner";
+  CHECK(checkLexUrl(longUrl));
+  CHECK(checkLexUrl(string(SeparatorBitmap::kMaxLen + 10, 'x') +
+        "://example.com/"));
+
+  int numMismatches = 0;
+  for (const string &url : getSiteListUrls()) {
+    if (!checkLexUrl(url) && ++numMismatches >= 10) {
+      break;
+    }
+  }
+  CHECK(compareNums(numMismatches, 0));
+}
+
+TEST(urlLexer, separatorBitmapForFilters) {
+  const string url = "https://example.com/ad/banner?size=300";
+  SeparatorBitmap separators;
+  findSeparators(url.c_str(), static_cast<int>(url.length()), &separators);
+  CHECK(compareNums(separators.findNext(0, separators.len), 5));
+  CHECK(compareNums(separators.findNext(8, separators.len), 19));
+  CHECK(compareNums(separators.findNext(30, 34), 34));
+
+  // The bitmap is for the whole URL, the searched input can start later
+  const char *filter = "^banner^";
+  const int offset = 10;
+  CHECK(compareNums(indexOfFilter(url.c_str() + offset,
+          static_cast<int>(url.length()) - offset, filter,
+          filter + strlen(filter), separators, offset), 12));
+  const char *noMatch = "^example^";
+  CHECK(compareNums(indexOfFilter(url.c_str() + offset,
+          static_cast<int>(url.length()) - offset, noMatch,
+          noMatch + strlen(noMatch), separators, offset), -1));
+
+  AdBlockClient client;
+  client.parse("^banner^\n/ad/*^size=\n");
+  CHECK(client.matches(url.c_str(), FOImage, "example.org"));
+  CHECK(client.matches("https://example.com/ad/x?size=1", FOImage,
+        "example.org"));
+  CHECK(!client.matches("https://example.com/ad/xsize=1", FOImage,
+        "example.org"));
+  CHECK(!client.matches("data:image/png;base64,/banner/", FOImage,
+        "example.org"));
+}
+
+// Lowercases |s| both ways and returns true if they agree with each other
+// and with tolower on ASCII letters.
+static bool checkLowercase(const string &s) {
+  const int len = static_cast<int>(s.length());
+  std::vector<char> out(len + 1), expected(len + 1);
+  const bool changed = lowercaseAscii(s.c_str(), len, out.data());
+  const bool expectedChanged = lowercaseAsciiScalar(s.c_str(), len,
+      expected.data());
+  bool ok = changed == expectedChanged &&
+    !memcmp(out.data(), expected.data(), len);
+  bool anyUpper = false;
+  for (int i = 0; ok && i < len; i++) {
+    const bool upper = s[i] >= 'A' && s[i] <= 'Z';
+    anyUpper |= upper;
+    ok = out[i] == (upper ? s[i] - 'A' + 'a' : s[i]);
+  }
+  ok = ok && changed == anyUpper;
+  if (!ok) {
+    cout << "lowercaseAscii mismatch for " << s << endl;
+  }
+  return ok;
+}
+
+TEST(urlLexer, lowercaseSameAsByteAtATime) {
+  CHECK(checkLowercase(""));
+  CHECK(checkLowercase("http://example.com/"));
+  CHECK(checkLowercase("HTTPS://Example.COM:8080/A?b=C@[`{Z"));
+  // Bytes from 0x80 aren't letters
+  CHECK(checkLowercase("http://example.com/\xc3\x89\xc4\x80\xff\xc1\xda"));
+
+  // An uppercase letter at every position of a block and around block ends
+  for (int len = 1; len < 70; len++) {
+    for (int i = 0; i < len; i++) {
+      string s(len, 'a');
+      s[i] = 'A' + i % 26;
+      CHECK(checkLowercase(s));
+      s[i] = '@' + (i % 2) * ('[' - '@');
+      CHECK(checkLowercase(s));
+    }
+  }
+
+  // The output can be the input
+  char buffer[] = "https://Example.com/BannerAd_1.GIF?Size=300X250";
+  CHECK(lowercaseAscii(buffer, static_cast<int>(strlen(buffer)), buffer));
+  CHECK(!strcmp(buffer, "https://example.com/bannerad_1.gif?size=300x250"));
+  CHECK(!lowercaseAscii(buffer, static_cast<int>(strlen(buffer)), buffer));
+}
+
+// Requests are matched in lowercase, match-case filters against the URL as
+// it was passed in.
+TEST(urlLexer, matchRequestLowercasesInput) {
+  const string url = "https://Ads.Example.com/BannerAd.GIF";
+  MatchRequest request(url.c_str(), static_cast<int>(url.length()),
+      FOImage, "example.org", 11);
+  CHECK(!strncmp(request.input, "https://ads.example.com/bannerad.gif",
+        url.length()));
+  CHECK(request.originalInput == url.c_str());
+  CHECK(compareNums(request.hostLen, 15));
+  CHECK(!strncmp(request.host, "ads.example.com", request.hostLen));
+
+  const string lowercase = "https://ads.example.com/bannerad.gif";
+  MatchRequest lowercaseRequest(lowercase.c_str(),
+      static_cast<int>(lowercase.length()), FOImage, "example.org", 11);
+  CHECK(lowercaseRequest.input == lowercase.c_str());
+
+  // Longer than the inline buffer
+  const string longUrl = "https://example.com/" +
+    string(MatchRequest::kInlineInputLen, 'X') + "/BannerAd.GIF";
+  MatchRequest longRequest(longUrl.c_str(),
+      static_cast<int>(longUrl.length()), FOImage, "example.org", 11);
+  CHECK(compareNums(static_cast<int>(longRequest.input[30]),
+        static_cast<int>('x')));
+
+  // Their fingerprints are lowercase and never one of the bad ones
+  char fingerprint[AdBlockClient::kFingerprintSize + 1];
+  Filter matchCase;
+  parseFilter("Banner$match-case", &matchCase);
+  CHECK(!AdBlockClient::getFingerprint(fingerprint, matchCase));
+  Filter mixedCase;
+  parseFilter("/TrackerPixel$match-case", &mixedCase);
+  CHECK(AdBlockClient::getFingerprint(fingerprint, mixedCase));
+  char lowerCaseFingerprint[AdBlockClient::kFingerprintSize + 1];
+  CHECK(AdBlockClient::getFingerprint(lowerCaseFingerprint,
+        "/trackerpixel"));
+  CHECK(!strcmp(fingerprint, lowerCaseFingerprint));
+
+  AdBlockClient client;
+  client.parse("/BannerAd.\n"
+      "/TrackerPixel$match-case\n"
+      "||Ads.Example.net^\n");
+  CHECK(client.matches(url.c_str(), FOImage, "example.org"));
+  CHECK(client.matches("https://example.com/bannerad.gif", FOImage,
+        "example.org"));
+  CHECK(client.matches("https://example.com/TrackerPixel.gif", FOImage,
+        "example.org"));
+  CHECK(!client.matches("https://example.com/trackerpixel.gif", FOImage,
+        "example.org"));
+  CHECK(client.matches("https://ADS.example.net/x.gif", FOImage,
+        "example.org"));
+
+  // Data files keep the lowercased data and the match-case option
+  int size;
+  char *buffer = client.serialize(&size);
+  AdBlockClient client2;
+  CHECK(client2.deserialize(buffer));
+  CHECK(client2.matches(url.c_str(), FOImage, "example.org"));
+  CHECK(client2.matches("https://example.com/TrackerPixel.gif", FOImage,
+        "example.org"));
+  CHECK(!client2.matches("https://example.com/trackerpixel.gif", FOImage,
+        "example.org"));
+  delete[] buffer;
+}
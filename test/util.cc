@@ -7,6 +7,8 @@
 #include <sstream>
 #include <iostream>
 #include <string>
+#include <vector>
+#include "./ad_block_client.h"
 #include "./CppUnitLite/TestHarness.h"
 #include "./test/util.h"
 
@@ -31,3 +33,53 @@ bool compareNums(int actual, int expected) {
   }
   return true;
 }
+
+std::vector<std::string> getSiteListUrls(int maxUrls) {
+  std::stringstream ss(getFileContents("./test/data/sitelist.txt"));
+  std::vector<std::string> urls;
+  std::string url;
+  while ((maxUrls == -1 || static_cast<int>(urls.size()) < maxUrls) &&
+      ss >> url) {
+    urls.push_back(url);
+  }
+  return urls;
+}
+
+bool sameMatchesForSiteList(int numUrls,
+    const std::vector<FilterOption> &contextOptions,
+    const std::vector<const char *> &contextDomains,
+    const MatchesFn &matches, const MatchesFn &expectedMatches) {
+  const std::vector<std::string> urls = getSiteListUrls(numUrls);
+  int numBlocks = 0;
+  int numMismatches = 0;
+  for (const char *contextDomain : contextDomains) {
+    for (FilterOption contextOption : contextOptions) {
+      for (const std::string &url : urls) {
+        const bool expected = expectedMatches(url.c_str(), contextOption,
+            contextDomain);
+        numBlocks += expected;
+        if (matches(url.c_str(), contextOption, contextDomain) != expected &&
+            numMismatches++ < 10) {
+          cout << "Mismatch for " << url << " " << contextOption << " on "
+            << (contextDomain ? contextDomain : "no domain") << endl;
+        }
+      }
+    }
+  }
+  return numBlocks > 0 && compareNums(numMismatches, 0);
+}
+
+bool sameMatchesForSiteList(int numUrls,
+    const std::vector<FilterOption> &contextOptions,
+    const std::vector<const char *> &contextDomains,
+    AdBlockClient *client, AdBlockClient *expectedClient) {
+  return sameMatchesForSiteList(numUrls, contextOptions, contextDomains,
+      [client](const char *url, FilterOption contextOption,
+        const char *contextDomain) {
+        return client->matches(url, contextOption, contextDomain);
+      },
+      [expectedClient](const char *url, FilterOption contextOption,
+        const char *contextDomain) {
+        return expectedClient->matches(url, contextOption, contextDomain);
+      });
+}
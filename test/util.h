@@ -6,10 +6,37 @@
 #ifndef TEST_UTIL_H_
 #define TEST_UTIL_H_
 
+#include <functional>
 #include <string>
+#include <vector>
+#include "./filter.h"
+
+class AdBlockClient;
 
 SimpleString StringFrom(const std::string& value);
 std::string getFileContents(const char *filename);
 bool compareNums(int actual, int expected);
 
+// Returns the first |maxUrls| URLs of test/data/sitelist.txt, or all of
+// them when |maxUrls| is -1.
+std::vector<std::string> getSiteListUrls(int maxUrls = -1);
+
+// Whether a URL is blocked for a context option and context domain
+typedef std::function<bool(const char *url, FilterOption contextOption,
+    const char *contextDomain)> MatchesFn;
+
+// Checks the first |numUrls| site list URLs with each of |contextOptions|
+// on each of |contextDomains| with both |matches| and |expectedMatches|.
+// Returns true if they always agree and at least one URL is blocked, the
+// first mismatches are printed.
+bool sameMatchesForSiteList(int numUrls,
+    const std::vector<FilterOption> &contextOptions,
+    const std::vector<const char *> &contextDomains,
+    const MatchesFn &matches, const MatchesFn &expectedMatches);
+// Same as above comparing the matches() results of two clients
+bool sameMatchesForSiteList(int numUrls,
+    const std::vector<FilterOption> &contextOptions,
+    const std::vector<const char *> &contextDomains,
+    AdBlockClient *client, AdBlockClient *expectedClient);
+
 #endif  // TEST_UTIL_H_
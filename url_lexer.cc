@@ -0,0 +1,206 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "./url_lexer.h"
+
+#include "./ad_block_client.h"
+#include "./match_request.h"
+#include "./protocol.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define HAS_SSE2
+#include <emmintrin.h>
+#endif
+
+// AVX2 is only used when the CPU reports it, which needs the GCC and clang
+// target attribute and CPU detection builtins.
+#if defined(HAS_SSE2) && (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define HAS_AVX2_DISPATCH
+#include <immintrin.h>
+#endif
+
+typedef void (*FindSeparatorsFn)(const char *input, int inputLen,
+    SeparatorBitmap *separators);
+
+// Sets the bits of the bytes from |i| to |len| one at a time.  Bits of the
+// word |i| is in which are before it have to be set already.
+static void findSeparatorsFrom(const char *input, int i, int len,
+    SeparatorBitmap *separators) {
+  for (; i < len; i++) {
+    if ((i & 63) == 0) {
+      separators->words[i >> 6] = 0;
+    }
+    if (isSeparatorChar(input[i])) {
+      separators->words[i >> 6] |= 1ULL << (i & 63);
+    }
+  }
+}
+
+static inline int coveredLen(int inputLen) {
+  return inputLen < SeparatorBitmap::kMaxLen ?
+    inputLen : SeparatorBitmap::kMaxLen;
+}
+
+void findSeparatorsScalar(const char *input, int inputLen,
+    SeparatorBitmap *separators) {
+  separators->len = coveredLen(inputLen);
+  findSeparatorsFrom(input, 0, separators->len, separators);
+}
+
+#ifdef HAS_SSE2
+static inline __m128i separatorMask(__m128i v) {
+  return _mm_or_si128(
+      _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8(':')),
+          _mm_cmpeq_epi8(v, _mm_set1_epi8('?'))),
+        _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('/')),
+          _mm_cmpeq_epi8(v, _mm_set1_epi8('=')))),
+      _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('^')),
+        _mm_cmpeq_epi8(v, _mm_set1_epi8('$'))));
+}
+
+// Each block of 16 bytes fills a quarter of a word
+static void findSeparatorsSSE2(const char *input, int inputLen,
+    SeparatorBitmap *separators) {
+  const int len = coveredLen(inputLen);
+  separators->len = len;
+  int i = 0;
+  for (; i + 16 <= len; i += 16) {
+    const __m128i v =
+      _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + i));
+    const uint64_t mask = static_cast<unsigned int>(
+        _mm_movemask_epi8(separatorMask(v)));
+    if ((i & 63) == 0) {
+      separators->words[i >> 6] = mask;
+    } else {
+      separators->words[i >> 6] |= mask << (i & 63);
+    }
+  }
+  findSeparatorsFrom(input, i, len, separators);
+}
+#endif
+
+#ifdef HAS_AVX2_DISPATCH
+__attribute__((target("avx2")))
+static inline __m256i separatorMaskAVX2(__m256i v) {
+  return _mm256_or_si256(
+      _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8(':')),
+          _mm256_cmpeq_epi8(v, _mm256_set1_epi8('?'))),
+        _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('/')),
+          _mm256_cmpeq_epi8(v, _mm256_set1_epi8('=')))),
+      _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('^')),
+        _mm256_cmpeq_epi8(v, _mm256_set1_epi8('$'))));
+}
+
+// Each block of 32 bytes fills half a word
+__attribute__((target("avx2")))
+static void findSeparatorsAVX2(const char *input, int inputLen,
+    SeparatorBitmap *separators) {
+  const int len = coveredLen(inputLen);
+  separators->len = len;
+  int i = 0;
+  for (; i + 32 <= len; i += 32) {
+    const __m256i v =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i *>(input + i));
+    const uint64_t mask = static_cast<unsigned int>(
+        _mm256_movemask_epi8(separatorMaskAVX2(v)));
+    if ((i & 63) == 0) {
+      separators->words[i >> 6] = mask;
+    } else {
+      separators->words[i >> 6] |= mask << 32;
+    }
+  }
+  findSeparatorsFrom(input, i, len, separators);
+}
+#endif
+
+static FindSeparatorsFn chooseFindSeparators() {
+#ifdef HAS_AVX2_DISPATCH
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    return findSeparatorsAVX2;
+  }
+#endif
+#ifdef HAS_SSE2
+  return findSeparatorsSSE2;
+#else
+  return findSeparatorsScalar;
+#endif
+}
+
+void findSeparators(const char *input, int inputLen,
+    SeparatorBitmap *separators) {
+  // Chosen on the first call rather than by a global initializer, so that
+  // matching from another file's static initializers works too.
+  static const FindSeparatorsFn impl = chooseFindSeparators();
+  impl(input, inputLen, separators);
+}
+
+static bool lowercaseAsciiFrom(const char *input, int i, int len,
+    char *out) {
+  bool changed = false;
+  for (; i < len; i++) {
+    const char c = input[i];
+    out[i] = lowercaseAsciiChar(c);
+    changed |= out[i] != c;
+  }
+  return changed;
+}
+
+bool lowercaseAsciiScalar(const char *input, int len, char *out) {
+  return lowercaseAsciiFrom(input, 0, len, out);
+}
+
+bool lowercaseAscii(const char *input, int len, char *out) {
+  int i = 0;
+  bool changed = false;
+#ifdef HAS_SSE2
+  // Bytes from 0x80 are negative in the signed compares so they're never
+  // taken for letters.
+  const __m128i beforeA = _mm_set1_epi8('A' - 1);
+  const __m128i afterZ = _mm_set1_epi8('Z' + 1);
+  const __m128i caseBit = _mm_set1_epi8(0x20);
+  __m128i anyUpper = _mm_setzero_si128();
+  for (; i + 16 <= len; i += 16) {
+    const __m128i v =
+      _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + i));
+    const __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(v, beforeA),
+        _mm_cmplt_epi8(v, afterZ));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i),
+        _mm_or_si128(v, _mm_and_si128(upper, caseBit)));
+    anyUpper = _mm_or_si128(anyUpper, upper);
+  }
+  changed = _mm_movemask_epi8(anyUpper) != 0;
+#endif
+  return lowercaseAsciiFrom(input, i, len, out) || changed;
+}
+
+bool lexUrl(const char *url, int urlLen, SeparatorBitmap *separators,
+    const char **host, int *hostLen) {
+  findSeparators(url, urlLen, separators);
+  if (!separators->covers(urlLen)) {
+    *host = getUrlHost(url, urlLen, hostLen);
+    return isBlockableProtocol(url, urlLen);
+  }
+
+  // The host starts after the first ':' and the slashes which follow it,
+  // and ends at the next separator.
+  int i = separators->findNext(0, urlLen);
+  while (i < urlLen && url[i] != ':') {
+    i = separators->findNext(i + 1, urlLen);
+  }
+  if (i < urlLen) {
+    i++;
+    while (i < urlLen && url[i] == '/') {
+      i++;
+    }
+  }
+  *host = url + i;
+  *hostLen = separators->findNext(i, urlLen) - i;
+  return isBlockableProtocol(url, urlLen);
+}
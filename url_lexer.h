@@ -0,0 +1,105 @@
+/* Copyright (c) 2015 Brian R. Bondy. Distributed under the MPL2 license.
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#ifndef URL_LEXER_H_
+#define URL_LEXER_H_
+
+#include <stdint.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#include "./base.h"
+
+// One bit for each byte of a URL, set where the byte is one of the
+// separator characters that '^' in a filter matches, the same ones as
+// isSeparatorChar().  Only the first kMaxLen bytes are covered so that the
+// bitmap can be kept inline in a MatchRequest, anything after that has to be
+// checked with isSeparatorChar().
+class SeparatorBitmap {
+ public:
+  static const int kMaxLen = 4096;
+
+  SeparatorBitmap() : len(0) {
+  }
+
+  // True if the bitmap has bits for the first |end| bytes of the URL
+  bool covers(int end) const {
+    return end <= len;
+  }
+  bool isSeparatorAt(int i) const {
+    return (words[i >> 6] >> (i & 63)) & 1;
+  }
+  // Returns the first separator in [from, to), or |to| if there is none.
+  // The range has to be covered.
+  int findNext(int from, int to) const {
+    int i = from;
+    while (i < to) {
+      const uint64_t word = words[i >> 6] >> (i & 63);
+      if (word) {
+        const int pos = i + countTrailingZeros64(word);
+        return pos < to ? pos : to;
+      }
+      i = (i | 63) + 1;
+    }
+    return to;
+  }
+
+  // Number of bytes covered
+  int len;
+  // Bit i % 64 of word i / 64 is for byte i
+  uint64_t words[kMaxLen / 64];
+
+ private:
+  static int countTrailingZeros64(uint64_t word) {
+#if defined(_MSC_VER) && !defined(__clang__) && defined(_M_X64)
+    unsigned long index;  // NOLINT
+    _BitScanForward64(&index, word);
+    return static_cast<int>(index);
+#elif defined(_MSC_VER) && !defined(__clang__)
+    int i = 0;
+    while (!(word & 1)) {
+      word >>= 1;
+      i++;
+    }
+    return i;
+#else
+    return __builtin_ctzll(word);
+#endif
+  }
+};
+
+// Fills |separators| for |input| with a vector compare of every byte against
+// each separator.  This uses AVX2 when the CPU supports it, SSE2 otherwise
+// on x86, and the separator table everywhere else.
+void findSeparators(const char *input, int inputLen,
+    SeparatorBitmap *separators);
+
+// Same as above, testing each byte with isSeparatorChar().  This is the
+// reference behavior the vector versions have to agree with.
+void findSeparatorsScalar(const char *input, int inputLen,
+    SeparatorBitmap *separators);
+
+inline char lowercaseAsciiChar(char c) {
+  return c >= 'A' && c <= 'Z' ? c | 0x20 : c;
+}
+
+// Copies the |len| bytes of |input| to |out| with the ASCII letters
+// lowercased and returns true if any of them was uppercase.  Filters are
+// matched case insensitively by lowercasing their data when they are parsed
+// and each URL once here.  |out| can be |input|.  This uses SSE2 on x86 and
+// goes a byte at a time everywhere else.
+bool lowercaseAscii(const char *input, int len, char *out);
+
+// Same as above a byte at a time, the reference behavior for the vector
+// version.
+bool lowercaseAsciiScalar(const char *input, int len, char *out);
+
+// Lexes |url| in one pass: fills |separators|, sets |host| and |hostLen| to
+// the host the same way getUrlHost() does, and returns whether the URL has
+// a blockable protocol like isBlockableProtocol().
+bool lexUrl(const char *url, int urlLen, SeparatorBitmap *separators,
+    const char **host, int *hostLen);
+
+#endif  // URL_LEXER_H_